@@ -0,0 +1,221 @@
+#!/usr/bin/python
+
+"""
+Adds the modification tracking to the classes generated by CPACSGen in src/generated.
+
+Each generated class with a WriteCPACS function gets
+- a flag m_dirty, which is set in the constructors, the setters and the Remove functions,
+- for each list of child objects, the elements at the last call of ClearDirty.
+  Thus, elements erased, inserted or reordered via the non-const getters are detected as well,
+- the functions IsDirty, ClearDirty and WriteDirtyCPACS. They descend into the
+  child objects written by WriteCPACS.
+
+Classes, which already have the flag, are skipped. Hence, the script can be
+run again on already processed files.
+"""
+
+import argparse
+import glob
+import os
+import re
+
+WRITE_DECL = '        TIGL_EXPORT virtual void WriteCPACS(const TixiDocumentHandle& tixiHandle, const std::string& xpath) const;\n'
+NEW_DECLS = ('\n'
+             '        TIGL_EXPORT virtual bool IsDirty() const;\n'
+             '        TIGL_EXPORT virtual void ClearDirty();\n'
+             '        TIGL_EXPORT virtual void WriteDirtyCPACS(const TixiDocumentHandle& tixiHandle, const std::string& xpath) const;\n')
+MEMBERS_END = '\n    private:\n#ifdef HAVE_CPP11\n'
+DIRTY_MEMBER = 'bool m_dirty;'
+
+
+def clean_member(member):
+    """Name of the member storing the list elements at the last ClearDirty"""
+    return member + 'Clean'
+
+
+def find_children(cls, hsrc, csrc):
+    """Returns (kind, member, path, element type) for all child objects written by WriteCPACS"""
+    wm = re.search(r'    void %s::WriteCPACS\(const TixiDocumentHandle& tixiHandle, const std::string& xpath\) const\n    \{\n(.*?)\n    \}\n' % cls, csrc, re.S)
+    children = []
+    for line in wm.group(1).split('\n'):
+        r = re.match(r'^\s+(m_\w+)\.WriteCPACS\(tixiHandle, xpath \+ "(/[^"]+)"\);$', line)
+        if r:
+            children.append(('required', r.group(1), r.group(2), None))
+            continue
+        r = re.match(r'^\s+(m_\w+)->WriteCPACS\(tixiHandle, xpath \+ "(/[^"]+)"\);$', line)
+        if r:
+            children.append(('optional', r.group(1), r.group(2), None))
+            continue
+        r = re.match(r'^\s+tixi::TixiSaveElements\(tixiHandle, xpath \+ "(/[^"]+)", (m_\w+)\);$', line)
+        if r:
+            member = r.group(2)
+            decl = re.search(r'^\s+(std::vector<[^;]*?>)\s+%s;$' % member, hsrc, re.M)
+            assert decl, (cls, member)
+            # lists of primitive values are written by the parent
+            element = re.match(r'std::vector<\s*unique_ptr<(.+)>\s*>$', decl.group(1))
+            if element:
+                children.append(('vector', member, r.group(1), element.group(1).strip()))
+            continue
+        assert 'WriteCPACS(' not in line and 'TixiSaveElements(' not in line, (cls, line)
+    return children, wm.end()
+
+
+def add_initializers(cls, csrc, initializers):
+    """Appends the initializers to all constructors of the class"""
+    lines = csrc.split('\n')
+    out = []
+    nctor = 0
+    i = 0
+    while i < len(lines):
+        line = lines[i]
+        out.append(line)
+        i += 1
+        if not re.match(r'^    %s::%s\(.*\)$' % (cls, cls), line):
+            continue
+        nctor += 1
+        if lines[i].startswith('        : '):
+            while lines[i] != '    {':
+                out.append(lines[i])
+                i += 1
+            out += ['        , %s' % init for init in initializers]
+        else:
+            assert lines[i] == '    {', (cls, lines[i])
+            out.append('        : %s' % initializers[0])
+            out += ['        , %s' % init for init in initializers[1:]]
+    assert nctor >= 1, cls
+    return '\n'.join(out)
+
+
+def mark_modifications(cls, csrc):
+    """Sets the flag in the setters and the Remove functions"""
+    lines = csrc.split('\n')
+    out = []
+    i = 0
+    while i < len(lines):
+        line = lines[i]
+        out.append(line)
+        i += 1
+        if re.match(r'^    void %s::(Set\w+|Remove\w+)\(.*\)$' % cls, line):
+            assert lines[i] == '    {', (cls, lines[i])
+            out += [lines[i], '        m_dirty = true;']
+            i += 1
+    return '\n'.join(out)
+
+
+def dirty_functions(cls, children):
+    isdirty = ['    bool %s::IsDirty() const' % cls, '    {']
+    clear = ['    void %s::ClearDirty()' % cls, '    {', '        m_dirty = false;']
+    write = ['    void %s::WriteDirtyCPACS(const TixiDocumentHandle& tixiHandle, const std::string& xpath) const' % cls, '    {']
+    if not children:
+        isdirty += ['        return m_dirty;']
+        write += ['        if (m_dirty) {',
+                  '            WriteCPACS(tixiHandle, xpath);',
+                  '        }']
+    else:
+        isdirty += ['        if (m_dirty) {', '            return true;', '        }']
+        write += ['        if (m_dirty) {',
+                  '            WriteCPACS(tixiHandle, xpath);',
+                  '            return;',
+                  '        }']
+        for kind, member, path, element in children:
+            name = path[1:]
+            if kind == 'required':
+                isdirty += ['        if (%s.IsDirty()) {' % member, '            return true;', '        }']
+                clear += ['        %s.ClearDirty();' % member]
+                write += ['',
+                          '        // write modified element %s' % name,
+                          '        if (%s.IsDirty()) {' % member,
+                          '            tixi::TixiCreateElementIfNotExists(tixiHandle, xpath + "%s");' % path,
+                          '            %s.WriteDirtyCPACS(tixiHandle, xpath + "%s");' % (member, path),
+                          '        }']
+            elif kind == 'optional':
+                isdirty += ['        if (%s && %s->IsDirty()) {' % (member, member), '            return true;', '        }']
+                clear += ['        if (%s) {' % member, '            %s->ClearDirty();' % member, '        }']
+                write += ['',
+                          '        // write modified element %s' % name,
+                          '        if (%s && %s->IsDirty()) {' % (member, member),
+                          '            tixi::TixiCreateElementIfNotExists(tixiHandle, xpath + "%s");' % path,
+                          '            %s->WriteDirtyCPACS(tixiHandle, xpath + "%s");' % (member, path),
+                          '        }']
+            else:
+                isdirty += ['        if (%s.size() != %s.size()) {' % (member, clean_member(member)),
+                            '            return true;',
+                            '        }',
+                            '        for (std::size_t i = 0; i < %s.size(); i++) {' % member,
+                            '            if (%s[i].get() != %s[i] || %s[i]->IsDirty()) {' % (member, clean_member(member), member),
+                            '                return true;',
+                            '            }',
+                            '        }']
+                clear += ['        %s.clear();' % clean_member(member),
+                          '        for (std::size_t i = 0; i < %s.size(); i++) {' % member,
+                          '            %s.push_back(%s[i].get());' % (clean_member(member), member),
+                          '            %s[i]->ClearDirty();' % member,
+                          '        }']
+                write += ['',
+                          '        // write modified elements %s' % name,
+                          '        tixi::TixiSaveDirtyElements(tixiHandle, xpath + "%s", %s, %s);' % (path, member, clean_member(member))]
+        isdirty += ['        return false;']
+    isdirty += ['    }']
+    clear += ['    }']
+    write += ['    }']
+    return '\n' + '\n'.join(isdirty) + '\n\n' + '\n'.join(clear) + '\n\n' + '\n'.join(write) + '\n'
+
+
+def process_class(header, stats):
+    with open(header, newline='') as f:
+        hsrc = f.read()
+    if WRITE_DECL not in hsrc or DIRTY_MEMBER in hsrc:
+        return
+    cls = re.search(r'^    class (\w+)\n', hsrc, re.M).group(1)
+    source = header[:-2] + '.cpp'
+    with open(source, newline='') as f:
+        csrc = f.read()
+    assert '\r' not in hsrc and '\r' not in csrc, cls
+
+    children, _ = find_children(cls, hsrc, csrc)
+    lists = [(member, element) for kind, member, path, element in children if kind == 'vector']
+
+    # header
+    hsrc = hsrc.replace(WRITE_DECL, WRITE_DECL + NEW_DECLS)
+    members = '\n        /// Set by the setters, cleared after the object has been read or written\n        %s\n' % DIRTY_MEMBER
+    if lists:
+        members += '\n        /// List elements at the last call of ClearDirty\n'
+        members += ''.join('        std::vector<const %s*> %s;\n' % (element, clean_member(member)) for member, element in lists)
+    assert hsrc.count(MEMBERS_END) == 1, cls
+    hsrc = hsrc.replace(MEMBERS_END, members + MEMBERS_END)
+
+    # source
+    csrc = add_initializers(cls, csrc, ['m_dirty(true)'])
+    csrc = mark_modifications(cls, csrc)
+    _, end = find_children(cls, hsrc, csrc)
+    csrc = csrc[:end] + dirty_functions(cls, children) + csrc[end:]
+
+    with open(header, 'w', newline='') as f:
+        f.write(hsrc)
+    with open(source, 'w', newline='') as f:
+        f.write(csrc)
+    stats['classes'] += 1
+    stats['lists'] += len(lists)
+
+
+def process_directory(directory):
+    """Adds the modification tracking to all generated classes of the directory"""
+    stats = {'classes': 0, 'lists': 0}
+    for header in sorted(glob.glob(os.path.join(directory, 'CPACS*.h'))):
+        process_class(header, stats)
+
+    print('Added the modification tracking to %d classes with %d lists' % (stats['classes'], stats['lists']))
+
+
+def main():
+    default_dir = os.path.join(os.path.dirname(os.path.abspath(__file__)), '..', '..', 'src', 'generated')
+
+    parser = argparse.ArgumentParser(description='Add the modification tracking to the CPACSGen classes')
+    parser.add_argument('-d', '--directory', default=default_dir, help='Directory of the generated files')
+    args = parser.parse_args()
+
+    process_directory(args.directory)
+
+
+if __name__ == "__main__":
+    main()
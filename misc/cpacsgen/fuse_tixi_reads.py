@@ -0,0 +1,117 @@
+#!/usr/bin/python
+
+"""
+Post-processes the readers generated by CPACSGen in src/generated.
+
+CPACSGen emits a TixiCheckElement/TixiCheckAttribute test followed by a
+TixiGetElement/TixiGetAttribute call for each optional primitive value.
+Each of these calls evaluates the xpath from the document root. This script
+replaces the pair by a single TixiTryGetElement/TixiTryGetAttribute call
+(see TixiHelper.h). Enums and other types keep the two-step form.
+
+The script only changes code in the form emitted by CPACSGen, hence it can
+be run again on already processed files.
+"""
+
+import argparse
+import glob
+import os
+import re
+
+TYPES = {'std::string', 'double', 'int', 'bool', 'std::time_t'}
+
+ELEMENT_RE = re.compile(
+    r'^(?P<ind>[ ]+)if \(tixi::TixiCheckElement\(tixiHandle, (?P<xp>xpath \+ "[^"]+")\)\) \{\n'
+    r'(?P=ind)    (?P<m>m_\w+) = tixi::TixiGetElement<(?P<t>[\w:]+)>\(tixiHandle, (?P=xp)\);\n', re.M)
+ATTRIBUTE_RE = re.compile(
+    r'^(?P<ind>[ ]+)if \(tixi::TixiCheckAttribute\(tixiHandle, xpath, (?P<xp>"[^"]+")\)\) \{\n'
+    r'(?P=ind)    (?P<m>m_\w+) = tixi::TixiGetAttribute<(?P<t>[\w:]+)>\(tixiHandle, xpath, (?P=xp)\);\n', re.M)
+
+
+def member_types(header):
+    """Returns the declared types of the members of the generated class"""
+    types = {}
+    if not os.path.exists(header):
+        return types
+    with open(header) as f:
+        for line in f:
+            m = re.match(r'^\s+(.+?)\s+(m_\w+);\s*$', line)
+            if m:
+                types[m.group(2)] = m.group(1).strip()
+    return types
+
+
+def transform(src, regex, make_call, types, stats):
+    out = []
+    pos = 0
+    for m in regex.finditer(src):
+        if m.start() < pos:
+            continue
+        t = m.group('t')
+        member = m.group('m')
+        if t not in TYPES or types.get(member) not in (t, 'boost::optional<%s>' % t):
+            stats['skipped'] += 1
+            continue
+        ind = m.group('ind')
+        call = make_call(m)
+
+        # find the end of the if block
+        close = '\n' + ind + '}\n'
+        end = src.index(close, m.end() - 1)
+        body = src[m.end():end + 1]
+        after = end + len(close)
+        out.append(src[pos:m.start()])
+        if body.strip():
+            # keep the remaining statements of the block
+            out.append('%sif (%s) {\n' % (ind, call))
+            pos = m.end()
+        elif src.startswith(ind + 'else {\n', after):
+            out.append('%sif (!%s) {\n' % (ind, call))
+            pos = after + len(ind + 'else {\n')
+        else:
+            out.append('%s%s;\n' % (ind, call))
+            pos = after
+        stats['converted'] += 1
+    out.append(src[pos:])
+    return ''.join(out)
+
+
+def process_directory(directory):
+    """Fuses the reads in all generated sources of the directory"""
+    stats = {'converted': 0, 'skipped': 0}
+    for cpp in sorted(glob.glob(os.path.join(directory, '*.cpp'))):
+        with open(cpp, newline='') as f:
+            src = f.read()
+        crlf = '\r\n' in src
+        if crlf:
+            src = src.replace('\r\n', '\n')
+
+        types = member_types(cpp[:-4] + '.h')
+        new = transform(src, ELEMENT_RE,
+                        lambda m: 'tixi::TixiTryGetElement(tixiHandle, %s, %s)' % (m.group('xp'), m.group('m')),
+                        types, stats)
+        new = transform(new, ATTRIBUTE_RE,
+                        lambda m: 'tixi::TixiTryGetAttribute(tixiHandle, xpath, %s, %s)' % (m.group('xp'), m.group('m')),
+                        types, stats)
+
+        if new != src:
+            if crlf:
+                new = new.replace('\n', '\r\n')
+            with open(cpp, 'w', newline='') as f:
+                f.write(new)
+
+    print('Converted %d reads, skipped %d reads' % (stats['converted'], stats['skipped']))
+
+
+def main():
+    default_dir = os.path.join(os.path.dirname(os.path.abspath(__file__)), '..', '..', 'src', 'generated')
+
+    parser = argparse.ArgumentParser(description='Fuse the existence checks and reads of the CPACSGen readers')
+    parser.add_argument('-d', '--directory', default=default_dir, help='Directory of the generated files')
+    args = parser.parse_args()
+
+    process_directory(args.directory)
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,35 @@
+#!/usr/bin/python
+
+"""
+Applies all TiGL changes to the classes generated by CPACSGen in src/generated.
+
+The steps match the code emitted by CPACSGen and by the previous steps,
+hence they must run in this order. Run this script after each regeneration
+of the classes.
+"""
+
+import argparse
+import os
+
+import add_dirty_tracking
+import fuse_tixi_reads
+
+STEPS = [
+    fuse_tixi_reads,     # fuse the existence checks and reads of optional values
+    add_dirty_tracking,  # IsDirty, ClearDirty and WriteDirtyCPACS
+]
+
+
+def main():
+    default_dir = os.path.join(os.path.dirname(os.path.abspath(__file__)), '..', '..', 'src', 'generated')
+
+    parser = argparse.ArgumentParser(description='Post-process the classes generated by CPACSGen')
+    parser.add_argument('-d', '--directory', default=default_dir, help='Directory of the generated files')
+    args = parser.parse_args()
+
+    for step in STEPS:
+        step.process_directory(args.directory)
+
+
+if __name__ == "__main__":
+    main()
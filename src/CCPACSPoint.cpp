@@ -44,6 +44,7 @@ CTiglPoint CCPACSPoint::AsPoint() const
 
 void CCPACSPoint::SetAsPoint(const CTiglPoint& point)
 {
+    m_dirty = true;
     m_x = point.x;
     m_y = point.y;
     m_z = point.z;
@@ -52,6 +53,7 @@ void CCPACSPoint::SetAsPoint(const CTiglPoint& point)
 CCPACSPoint &CCPACSPoint::operator=(const CCPACSPoint & p)
 {
     // For now, we don't replace the uid, just the values
+    m_dirty = true;
     m_x = p.m_x;
     m_y = p.m_y;
     m_z = p.m_z;
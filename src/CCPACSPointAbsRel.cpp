@@ -39,6 +39,7 @@ CCPACSPointAbsRel::CCPACSPointAbsRel(const CCPACSPointAbsRel &p)
 CCPACSPointAbsRel &CCPACSPointAbsRel::operator =(const CCPACSPointAbsRel &p)
 {
     // For now, we don't replace the uid, just the values
+    m_dirty = true;
     m_x = p.m_x;
     m_y = p.m_y;
     m_z = p.m_z;
@@ -59,6 +60,7 @@ CTiglPoint CCPACSPointAbsRel::AsPoint() const
 
 void CCPACSPointAbsRel::SetAsPoint(const CTiglPoint& point)
 {
+    m_dirty = true;
     m_x = point.x;
     m_y = point.y;
     m_z = point.z;
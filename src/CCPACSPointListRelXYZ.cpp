@@ -64,6 +64,8 @@ const std::vector<CTiglPoint>& CCPACSPointListRelXYZ::AsVector() const
 
 std::vector<CTiglPoint>& CCPACSPointListRelXYZ::AsVector()
 {
+    // the cache may be modified through the returned reference
+    m_dirty = true;
     return m_vec;
 }
 
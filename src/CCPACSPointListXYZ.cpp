@@ -66,6 +66,8 @@ const std::vector<CTiglPoint>& CCPACSPointListXYZ::AsVector() const
 
 std::vector<CTiglPoint>& CCPACSPointListXYZ::AsVector()
 {
+    // the cache may be modified through the returned reference
+    m_dirty = true;
     return m_vec;
 }
 
@@ -70,6 +70,8 @@ const std::vector<double>& CCPACSStringVector::AsVector() const
 
 std::vector<double>& CCPACSStringVector::AsVector()
 {
+    // the cache may be modified through the returned reference
+    m_dirty = true;
     return m_vec;
 }
 
@@ -31,6 +31,10 @@ public:
     TIGL_EXPORT void ReadCPACS(const TixiDocumentHandle& tixiHandle, const std::string& xpath) OVERRIDE;
     TIGL_EXPORT void WriteCPACS(const TixiDocumentHandle& tixiHandle, const std::string& xpath) const OVERRIDE;
 
+    using generated::CPACSStringVectorBase::IsDirty;
+    using generated::CPACSStringVectorBase::ClearDirty;
+    using generated::CPACSStringVectorBase::WriteDirtyCPACS;
+
     using generated::CPACSStringVectorBase::GetMapType;
     using generated::CPACSStringVectorBase::SetMapType;
 
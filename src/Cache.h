@@ -21,9 +21,43 @@
 #include <boost/thread/lock_guard.hpp>
 
 #include "CheckedMutex.h"
+#include "CTiglProfiler.h"
+#include "typename.h"
 
 namespace tigl
 {
+    namespace detail
+    {
+        inline std::string profilingUid(const std::string& uid)
+        {
+            return uid;
+        }
+
+        inline std::string profilingUid(const boost::optional<std::string>& uid)
+        {
+            return uid ? *uid : std::string();
+        }
+
+        // prefer the defaulted uid of geometric components, fall back to GetUID
+        template <typename T>
+        auto componentUid(const T& instance, int) -> decltype(profilingUid(instance.GetDefaultedUID()))
+        {
+            return profilingUid(instance.GetDefaultedUID());
+        }
+
+        template <typename T>
+        auto componentUid(const T& instance, long) -> decltype(profilingUid(instance.GetUID()))
+        {
+            return profilingUid(instance.GetUID());
+        }
+
+        template <typename T>
+        std::string componentUid(const T&, ...)
+        {
+            return std::string();
+        }
+    }
+
     template <typename T>
     class ScopeLockedReference {
     public:
@@ -73,6 +107,11 @@ namespace tigl
             boost::lock_guard<boost::mutex> guard(m_mutex);
             if (!m_cache) {
                 m_cache.emplace();
+                CTiglScopedTimer timer;
+                if (CTiglProfiler::IsEnabled()) {
+                    timer.Start("Cache<" + typeName<CacheStruct>() + ", " + typeName(typeid(m_instance)) + ">",
+                                detail::componentUid(m_instance, 0));
+                }
                 try {
                     (m_instance.*m_buildFunc)(*m_cache);
                 }
@@ -84,6 +123,13 @@ namespace tigl
             return m_cache.value();
         }
 
+        // returns true, if the cache has been built and not been cleared since
+        bool isBuilt() const
+        {
+            boost::lock_guard<boost::mutex> guard(m_mutex);
+            return static_cast<bool>(m_cache);
+        }
+
         const CacheStruct& operator*() const { return value(); }
         const CacheStruct* operator->() const { return &value(); }
 
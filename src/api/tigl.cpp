@@ -22,6 +22,9 @@
 #include <iostream>
 #include <exception>
 #include <cstdlib>
+#include <vector>
+#include <limits>
+#include <algorithm>
 
 #include "tigl.h"
 #include "tigl_version.h"
@@ -50,6 +53,12 @@
 #include "CCPACSRotorBladeAttachment.h"
 #include "CTiglAttachedRotorBlade.h"
 #include "CGlobalExporterConfigs.h"
+#include "CTiglLoftDiskCache.h"
+#include "CTiglCacheAccounting.h"
+#include "CTiglSolidClassifier.h"
+#include "CTiglIntegralProperties.h"
+#include "CTiglAbstractGeometricComponent.h"
+#include "CTiglProfiler.h"
 
 #include "CTiglPoint.h"
 
@@ -58,6 +67,9 @@
 #include "TopoDS_Shape.hxx"
 #include "TopoDS_Edge.hxx"
 #include "TopoDS_Vertex.hxx"
+#include "gp_Lin.hxx"
+#include "gp_Vec.hxx"
+#include "Precision.hxx"
 
 /*****************************************************************************/
 /* Private functions.                                                 */
@@ -70,6 +82,93 @@ namespace
         TIGL_VERSION_STRING;
 
     static std::string const emptyString = "";
+
+    // Batched point evaluations with at least this number of points
+    // are distributed over all hardware threads
+    const int parallelPointEvaluationThreshold = 1000;
+
+    int pointEvaluationThreadCount(int nPoints)
+    {
+        return nPoints >= parallelPointEvaluationThreshold ? 0 : 1;
+    }
+
+    void copyPoints(const std::vector<gp_Pnt>& points, double* pointsX, double* pointsY, double* pointsZ)
+    {
+        for (size_t i = 0; i < points.size(); ++i) {
+            pointsX[i] = points[i].X();
+            pointsY[i] = points[i].Y();
+            pointsZ[i] = points[i].Z();
+        }
+    }
+
+    TiglReturnCode wingGetPoints(TiglCPACSConfigurationHandle cpacsHandle, int wingIndex, int segmentIndex, bool fromUpper,
+                                 int nPoints, const double* etas, const double* xsis,
+                                 double* pointsX, double* pointsY, double* pointsZ, const char* functionName)
+    {
+        if (etas == NULL || xsis == NULL || pointsX == NULL || pointsY == NULL || pointsZ == NULL) {
+            LOG(ERROR) << "Null pointer argument for etas, xsis, pointsX, pointsY or pointsZ\n"
+                       << "in function call to " << functionName << ".";
+            return TIGL_NULL_POINTER;
+        }
+        if (nPoints < 0) {
+            LOG(ERROR) << "Negative number of points in function call to " << functionName << ".";
+            return TIGL_ERROR;
+        }
+
+        try {
+            tigl::CCPACSConfigurationManager& manager = tigl::CCPACSConfigurationManager::GetInstance();
+            tigl::CCPACSConfiguration& config = manager.GetConfiguration(cpacsHandle);
+            tigl::CCPACSWing& wing = config.GetWing(wingIndex);
+            const tigl::CCPACSWingSegment& segment = wing.GetSegment(segmentIndex);
+
+            std::vector<double> etaValues(etas, etas + nPoints);
+            std::vector<double> xsiValues(xsis, xsis + nPoints);
+            copyPoints(segment.GetPoints(etaValues, xsiValues, fromUpper, pointEvaluationThreadCount(nPoints)),
+                       pointsX, pointsY, pointsZ);
+            return TIGL_SUCCESS;
+        }
+        catch (const tigl::CTiglError& ex) {
+            LOG(ERROR) << ex.what();
+            return ex.getCode();
+        }
+        catch (std::exception& ex) {
+            LOG(ERROR) << ex.what();
+            return TIGL_ERROR;
+        }
+        catch (...) {
+            LOG(ERROR) << "Caught an unknown exception in " << functionName;
+            return TIGL_ERROR;
+        }
+    }
+
+    // returns the cached integral properties of the component, if available
+    tigl::CTiglIntegralProperties componentIntegralProperties(TiglCPACSConfigurationHandle cpacsHandle,
+                                                              const char* componentUID,
+                                                              TiglIntegrationAccuracy accuracy)
+    {
+        if (accuracy != TIGL_INTEGRATION_FAST && accuracy != TIGL_INTEGRATION_EXACT) {
+            throw tigl::CTiglError("Invalid integration accuracy", TIGL_ERROR);
+        }
+
+        tigl::CCPACSConfigurationManager& manager = tigl::CCPACSConfigurationManager::GetInstance();
+        tigl::CCPACSConfiguration& config = manager.GetConfiguration(cpacsHandle);
+        tigl::CTiglUIDManager& uidManager = config.GetUIDManager();
+        if (!uidManager.HasGeometricComponent(componentUID)) {
+            throw tigl::CTiglError("Component \"" + std::string(componentUID) + "\" is not a geometric component", TIGL_UID_ERROR);
+        }
+
+        tigl::ITiglGeometricComponent& component = uidManager.GetGeometricComponent(componentUID);
+        const tigl::CTiglAbstractGeometricComponent* cachedComponent = dynamic_cast<tigl::CTiglAbstractGeometricComponent*>(&component);
+        if (cachedComponent) {
+            return cachedComponent->GetIntegralProperties(accuracy);
+        }
+
+        PNamedShape loft = component.GetLoft();
+        if (!loft) {
+            throw tigl::CTiglError("Component \"" + std::string(componentUID) + "\" has no geometry", TIGL_ERROR);
+        }
+        return tigl::ComputeIntegralProperties(loft->Shape(), accuracy);
+    }
 }
 
 TixiPrintMsgFnc oldTixiMessageHandler = NULL;
@@ -275,6 +374,41 @@ TIGL_COMMON_EXPORT TiglReturnCode tiglSaveCPACSConfiguration(const char* configu
 }
 
 
+TIGL_COMMON_EXPORT TiglReturnCode tiglSaveCPACSConfigurationIncremental(const char* configurationUID, TiglCPACSConfigurationHandle cpacsHandle)
+{
+    if (configurationUID == NULL) {
+        LOG(ERROR) << "Null pointer for argument configurationUID in tiglSaveCPACSConfigurationIncremental.";
+        return TIGL_NULL_POINTER;
+    }
+
+    tigl::CCPACSConfigurationManager& manager = tigl::CCPACSConfigurationManager::GetInstance();
+
+    if (!manager.IsValid(cpacsHandle)) {
+        LOG(ERROR) << "Invalid cpacsHandle passed to tiglSaveCPACSConfigurationIncremental!";
+        return TIGL_UNINITIALIZED;
+    }
+
+    tigl::CCPACSConfiguration& config = manager.GetConfiguration(cpacsHandle);
+
+    try {
+        config.WriteDirtyCPACS(configurationUID);
+        return TIGL_SUCCESS;
+    }
+    catch (const tigl::CTiglError& ex) {
+        LOG(ERROR) << ex.what();
+        return TIGL_ERROR;
+    }
+    catch (std::exception& ex) {
+        LOG(ERROR) << ex.what();
+        return TIGL_ERROR;
+    }
+    catch (...) {
+        LOG(ERROR) << "Caught an exception in tiglSaveCPACSConfigurationIncremental!";
+        return TIGL_ERROR;
+    }
+}
+
+
 TIGL_COMMON_EXPORT TiglReturnCode tiglCloseCPACSConfiguration(TiglCPACSConfigurationHandle cpacsHandle)
 {
     try {
@@ -720,6 +854,34 @@ TIGL_COMMON_EXPORT TiglReturnCode tiglWingGetLowerPoint(TiglCPACSConfigurationHa
     }
 }
 
+TIGL_COMMON_EXPORT TiglReturnCode tiglWingGetUpperPoints(TiglCPACSConfigurationHandle cpacsHandle,
+                                                         int wingIndex,
+                                                         int segmentIndex,
+                                                         int nPoints,
+                                                         const double* etas,
+                                                         const double* xsis,
+                                                         double* pointsX,
+                                                         double* pointsY,
+                                                         double* pointsZ)
+{
+    return wingGetPoints(cpacsHandle, wingIndex, segmentIndex, true, nPoints, etas, xsis,
+                         pointsX, pointsY, pointsZ, "tiglWingGetUpperPoints");
+}
+
+TIGL_COMMON_EXPORT TiglReturnCode tiglWingGetLowerPoints(TiglCPACSConfigurationHandle cpacsHandle,
+                                                         int wingIndex,
+                                                         int segmentIndex,
+                                                         int nPoints,
+                                                         const double* etas,
+                                                         const double* xsis,
+                                                         double* pointsX,
+                                                         double* pointsY,
+                                                         double* pointsZ)
+{
+    return wingGetPoints(cpacsHandle, wingIndex, segmentIndex, false, nPoints, etas, xsis,
+                         pointsX, pointsY, pointsZ, "tiglWingGetLowerPoints");
+}
+
 TIGL_COMMON_EXPORT TiglReturnCode tiglWingGetChordPoint(TiglCPACSConfigurationHandle cpacsHandle,
                                                         int wingIndex,
                                                         int segmentIndex,
@@ -1843,6 +2005,71 @@ TIGL_COMMON_EXPORT TiglReturnCode tiglWingComponentSegmentFindSegment(TiglCPACSC
     }
 }
 
+TIGL_COMMON_EXPORT TiglReturnCode tiglWingComponentSegmentPointsGetSegmentEtaXsi(TiglCPACSConfigurationHandle cpacsHandle,
+                                                                                 const char *componentSegmentUID,
+                                                                                 int nPoints,
+                                                                                 const double* pointsX,
+                                                                                 const double* pointsY,
+                                                                                 const double* pointsZ,
+                                                                                 int* segmentIndices,
+                                                                                 double* segmentEtas,
+                                                                                 double* segmentXsis)
+{
+    if (!componentSegmentUID) {
+        LOG(ERROR) << "Null pointer argument for componentSegmentUID \n"
+                   << "in function call to tiglWingComponentSegmentPointsGetSegmentEtaXsi.";
+        return TIGL_NULL_POINTER;
+    }
+
+    if (!pointsX || !pointsY || !pointsZ || !segmentIndices || !segmentEtas || !segmentXsis) {
+        LOG(ERROR) << "Null pointer argument for pointsX, pointsY, pointsZ, segmentIndices, segmentEtas or segmentXsis\n"
+                   << "in function call to tiglWingComponentSegmentPointsGetSegmentEtaXsi.";
+        return TIGL_NULL_POINTER;
+    }
+
+    if (nPoints < 0) {
+        LOG(ERROR) << "Negative number of points in function call to tiglWingComponentSegmentPointsGetSegmentEtaXsi.";
+        return TIGL_ERROR;
+    }
+
+    try {
+        tigl::CCPACSConfigurationManager& manager = tigl::CCPACSConfigurationManager::GetInstance();
+        tigl::CCPACSConfiguration& config = manager.GetConfiguration(cpacsHandle);
+
+        const tigl::CCPACSWingComponentSegment& cs = config.GetUIDManager()
+                .ResolveObject<tigl::CCPACSWingComponentSegment>(componentSegmentUID);
+
+        std::vector<gp_Pnt> points;
+        points.reserve(nPoints);
+        for (int i = 0; i < nPoints; ++i) {
+            points.push_back(gp_Pnt(pointsX[i], pointsY[i], pointsZ[i]));
+        }
+
+        std::vector<const tigl::CCPACSWingSegment*> segments;
+        std::vector<double> etas, xsis;
+        cs.findSegments(points, segments, etas, xsis, pointEvaluationThreadCount(nPoints));
+
+        for (int i = 0; i < nPoints; ++i) {
+            segmentIndices[i] = segments[i] ? segments[i]->GetSegmentIndex() : 0;
+            segmentEtas[i]    = etas[i];
+            segmentXsis[i]    = xsis[i];
+        }
+        return TIGL_SUCCESS;
+    }
+    catch (const tigl::CTiglError& ex) {
+        LOG(ERROR) << ex.what();
+        return ex.getCode();
+    }
+    catch (std::exception& ex) {
+        LOG(ERROR) << ex.what();
+        return TIGL_ERROR;
+    }
+    catch (...) {
+        LOG(ERROR) << "Caught an exception in tiglWingComponentSegmentPointsGetSegmentEtaXsi!";
+        return TIGL_ERROR;
+    }
+}
+
 TIGL_COMMON_EXPORT TiglReturnCode tiglWingComponentSegmentGetPoint(TiglCPACSConfigurationHandle cpacsHandle,
                                                                    const char *componentSegmentUID, double eta, double xsi,
                                                                    double * x, double * y, double * z)
@@ -1900,6 +2127,58 @@ TIGL_COMMON_EXPORT TiglReturnCode tiglWingComponentSegmentGetPoint(TiglCPACSConf
     }
 }
 
+TIGL_COMMON_EXPORT TiglReturnCode tiglWingComponentSegmentGetPoints(TiglCPACSConfigurationHandle cpacsHandle,
+                                                                    const char *componentSegmentUID,
+                                                                    int nPoints,
+                                                                    const double* etas,
+                                                                    const double* xsis,
+                                                                    double* x,
+                                                                    double* y,
+                                                                    double* z)
+{
+    if (!componentSegmentUID) {
+        LOG(ERROR) << "Null pointer argument for componentSegmentUID \n"
+                   << "in function call to tiglWingComponentSegmentGetPoints.";
+        return TIGL_NULL_POINTER;
+    }
+
+    if (!etas || !xsis || !x || !y || !z) {
+        LOG(ERROR) << "Null pointer argument for etas, xsis, x, y, or z\n"
+                   << "in function call to tiglWingComponentSegmentGetPoints.";
+        return TIGL_NULL_POINTER;
+    }
+
+    if (nPoints < 0) {
+        LOG(ERROR) << "Negative number of points in function call to tiglWingComponentSegmentGetPoints.";
+        return TIGL_ERROR;
+    }
+
+    try {
+        tigl::CCPACSConfigurationManager& manager = tigl::CCPACSConfigurationManager::GetInstance();
+        tigl::CCPACSConfiguration& config = manager.GetConfiguration(cpacsHandle);
+
+        const tigl::CCPACSWingComponentSegment& compSeg = config.GetUIDManager()
+                .ResolveObject<tigl::CCPACSWingComponentSegment>(componentSegmentUID);
+
+        std::vector<double> etaValues(etas, etas + nPoints);
+        std::vector<double> xsiValues(xsis, xsis + nPoints);
+        copyPoints(compSeg.GetPoints(etaValues, xsiValues, pointEvaluationThreadCount(nPoints)), x, y, z);
+        return TIGL_SUCCESS;
+    }
+    catch (const tigl::CTiglError& ex) {
+        LOG(ERROR) << ex.what();
+        return ex.getCode();
+    }
+    catch (std::exception& ex) {
+        LOG(ERROR) << ex.what();
+        return TIGL_ERROR;
+    }
+    catch (...) {
+        LOG(ERROR) << "Caught an exception in tiglWingComponentSegmentGetPoints!";
+        return TIGL_ERROR;
+    }
+}
+
 TiglReturnCode tiglWingComponentSegmentPointGetEtaXsi(TiglCPACSConfigurationHandle cpacsHandle,
                                                       const char *componentSegmentUID,
                                                       double pX, double pY, double pZ,
@@ -2652,6 +2931,119 @@ TIGL_COMMON_EXPORT TiglReturnCode tiglFuselageGetPoint(TiglCPACSConfigurationHan
     }
 }
 
+TIGL_COMMON_EXPORT TiglReturnCode tiglFuselageGetPoints(TiglCPACSConfigurationHandle cpacsHandle,
+                                                        int fuselageIndex,
+                                                        int segmentIndex,
+                                                        int nPoints,
+                                                        const double* etas,
+                                                        const double* zetas,
+                                                        double* pointsX,
+                                                        double* pointsY,
+                                                        double* pointsZ)
+{
+    if (etas == 0 || zetas == 0 || pointsX == 0 || pointsY == 0 || pointsZ == 0) {
+        LOG(ERROR) << "Null pointer argument for etas, zetas, pointsX, pointsY or pointsZ\n"
+                   << "in function call to tiglFuselageGetPoints.";
+        return TIGL_NULL_POINTER;
+    }
+
+    if (nPoints < 0) {
+        LOG(ERROR) << "Negative number of points in function call to tiglFuselageGetPoints.";
+        return TIGL_ERROR;
+    }
+
+    try {
+        tigl::CCPACSConfigurationManager& manager = tigl::CCPACSConfigurationManager::GetInstance();
+        tigl::CCPACSConfiguration& config = manager.GetConfiguration(cpacsHandle);
+        tigl::CCPACSFuselage& fuselage = config.GetFuselage(fuselageIndex);
+        const tigl::CCPACSFuselageSegment& segment = fuselage.GetSegment(segmentIndex);
+
+        std::vector<double> etaValues(etas, etas + nPoints);
+        std::vector<double> zetaValues(zetas, zetas + nPoints);
+        copyPoints(segment.GetPoints(etaValues, zetaValues, pointEvaluationThreadCount(nPoints)),
+                   pointsX, pointsY, pointsZ);
+        return TIGL_SUCCESS;
+    }
+    catch (const tigl::CTiglError& ex) {
+        LOG(ERROR) << ex.what();
+        return ex.getCode();
+    }
+    catch (std::exception& ex) {
+        LOG(ERROR) << ex.what();
+        return TIGL_ERROR;
+    }
+    catch (...) {
+        LOG(ERROR) << "Caught an exception in tiglFuselageGetPoints!";
+        return TIGL_ERROR;
+    }
+}
+
+TIGL_COMMON_EXPORT TiglReturnCode tiglFuselageGetRayIntersections(TiglCPACSConfigurationHandle cpacsHandle,
+                                                                  int fuselageIndex,
+                                                                  int nRays,
+                                                                  const double* originsX,
+                                                                  const double* originsY,
+                                                                  const double* originsZ,
+                                                                  const double* directionsX,
+                                                                  const double* directionsY,
+                                                                  const double* directionsZ,
+                                                                  double* pointsX,
+                                                                  double* pointsY,
+                                                                  double* pointsZ,
+                                                                  int* hits)
+{
+    if (originsX == 0 || originsY == 0 || originsZ == 0 || directionsX == 0 || directionsY == 0 || directionsZ == 0 ||
+        pointsX == 0 || pointsY == 0 || pointsZ == 0 || hits == 0) {
+        LOG(ERROR) << "Null pointer argument for the ray or intersection arrays\n"
+                   << "in function call to tiglFuselageGetRayIntersections.";
+        return TIGL_NULL_POINTER;
+    }
+
+    if (nRays < 0) {
+        LOG(ERROR) << "Negative number of rays in function call to tiglFuselageGetRayIntersections.";
+        return TIGL_ERROR;
+    }
+
+    try {
+        tigl::CCPACSConfigurationManager& manager = tigl::CCPACSConfigurationManager::GetInstance();
+        tigl::CCPACSConfiguration& config = manager.GetConfiguration(cpacsHandle);
+        const tigl::CCPACSFuselage& fuselage = config.GetFuselage(fuselageIndex);
+
+        std::vector<gp_Lin> rays;
+        rays.reserve(nRays);
+        for (int i = 0; i < nRays; ++i) {
+            const gp_Vec direction(directionsX[i], directionsY[i], directionsZ[i]);
+            if (direction.Magnitude() < Precision::Confusion()) {
+                LOG(ERROR) << "Zero ray direction in function call to tiglFuselageGetRayIntersections.";
+                return TIGL_MATH_ERROR;
+            }
+            rays.push_back(gp_Lin(gp_Pnt(originsX[i], originsY[i], originsZ[i]), gp_Dir(direction)));
+        }
+
+        std::vector<gp_Pnt> intersections;
+        std::vector<bool> rayHits;
+        fuselage.IntersectRays(rays, intersections, rayHits, pointEvaluationThreadCount(nRays));
+
+        copyPoints(intersections, pointsX, pointsY, pointsZ);
+        for (int i = 0; i < nRays; ++i) {
+            hits[i] = rayHits[i] ? 1 : 0;
+        }
+        return TIGL_SUCCESS;
+    }
+    catch (const tigl::CTiglError& ex) {
+        LOG(ERROR) << ex.what();
+        return ex.getCode();
+    }
+    catch (std::exception& ex) {
+        LOG(ERROR) << ex.what();
+        return TIGL_ERROR;
+    }
+    catch (...) {
+        LOG(ERROR) << "Caught an exception in tiglFuselageGetRayIntersections!";
+        return TIGL_ERROR;
+    }
+}
+
 TIGL_COMMON_EXPORT TiglReturnCode tiglFuselageGetPointAngle(TiglCPACSConfigurationHandle cpacsHandle,
                                                             int fuselageIndex,
                                                             int segmentIndex,
@@ -6622,6 +7014,104 @@ TIGL_COMMON_EXPORT TiglReturnCode tiglComponentGetHashCode(TiglCPACSConfiguratio
     }
 }
 
+TIGL_COMMON_EXPORT TiglReturnCode tiglComponentGetIntegralProperties(TiglCPACSConfigurationHandle cpacsHandle,
+                                                                     const char* componentUID,
+                                                                     TiglIntegrationAccuracy accuracy,
+                                                                     double* volumePtr,
+                                                                     double* surfaceAreaPtr,
+                                                                     double* centroidXPtr,
+                                                                     double* centroidYPtr,
+                                                                     double* centroidZPtr)
+{
+    if (componentUID == NULL) {
+        LOG(ERROR) << "Null pointer argument for componentUID\n"
+                   << "in function call to tiglComponentGetIntegralProperties.";
+        return TIGL_NULL_POINTER;
+    }
+
+    if (volumePtr == NULL || surfaceAreaPtr == NULL || centroidXPtr == NULL || centroidYPtr == NULL || centroidZPtr == NULL) {
+        LOG(ERROR) << "Null pointer argument for volumePtr, surfaceAreaPtr, centroidXPtr, centroidYPtr or centroidZPtr\n"
+                   << "in function call to tiglComponentGetIntegralProperties.";
+        return TIGL_NULL_POINTER;
+    }
+
+    try {
+        const tigl::CTiglIntegralProperties properties = componentIntegralProperties(cpacsHandle, componentUID, accuracy);
+        *volumePtr      = properties.volume;
+        *surfaceAreaPtr = properties.surfaceArea;
+        *centroidXPtr   = properties.centroid.x;
+        *centroidYPtr   = properties.centroid.y;
+        *centroidZPtr   = properties.centroid.z;
+        return TIGL_SUCCESS;
+    }
+    catch (const tigl::CTiglError& ex) {
+        LOG(ERROR) << ex.what();
+        return ex.getCode();
+    }
+    catch (std::exception& ex) {
+        LOG(ERROR) << ex.what();
+        return TIGL_ERROR;
+    }
+    catch (Standard_Failure& err) {
+        LOG(ERROR) << "Cannot compute shape `" << componentUID << "`: " << err.GetMessageString();
+        return TIGL_ERROR;
+    }
+    catch (...) {
+        LOG(ERROR) << "Caught an exception in tiglComponentGetIntegralProperties!";
+        return TIGL_ERROR;
+    }
+}
+
+TIGL_COMMON_EXPORT TiglReturnCode tiglComponentGetInertiaTensor(TiglCPACSConfigurationHandle cpacsHandle,
+                                                                const char* componentUID,
+                                                                TiglIntegrationAccuracy accuracy,
+                                                                double* ixxPtr,
+                                                                double* iyyPtr,
+                                                                double* izzPtr,
+                                                                double* ixyPtr,
+                                                                double* ixzPtr,
+                                                                double* iyzPtr)
+{
+    if (componentUID == NULL) {
+        LOG(ERROR) << "Null pointer argument for componentUID\n"
+                   << "in function call to tiglComponentGetInertiaTensor.";
+        return TIGL_NULL_POINTER;
+    }
+
+    if (ixxPtr == NULL || iyyPtr == NULL || izzPtr == NULL || ixyPtr == NULL || ixzPtr == NULL || iyzPtr == NULL) {
+        LOG(ERROR) << "Null pointer argument for ixxPtr, iyyPtr, izzPtr, ixyPtr, ixzPtr or iyzPtr\n"
+                   << "in function call to tiglComponentGetInertiaTensor.";
+        return TIGL_NULL_POINTER;
+    }
+
+    try {
+        const tigl::CTiglIntegralProperties properties = componentIntegralProperties(cpacsHandle, componentUID, accuracy);
+        *ixxPtr = properties.inertia(1, 1);
+        *iyyPtr = properties.inertia(2, 2);
+        *izzPtr = properties.inertia(3, 3);
+        *ixyPtr = properties.inertia(1, 2);
+        *ixzPtr = properties.inertia(1, 3);
+        *iyzPtr = properties.inertia(2, 3);
+        return TIGL_SUCCESS;
+    }
+    catch (const tigl::CTiglError& ex) {
+        LOG(ERROR) << ex.what();
+        return ex.getCode();
+    }
+    catch (std::exception& ex) {
+        LOG(ERROR) << ex.what();
+        return TIGL_ERROR;
+    }
+    catch (Standard_Failure& err) {
+        LOG(ERROR) << "Cannot compute shape `" << componentUID << "`: " << err.GetMessageString();
+        return TIGL_ERROR;
+    }
+    catch (...) {
+        LOG(ERROR) << "Caught an exception in tiglComponentGetInertiaTensor!";
+        return TIGL_ERROR;
+    }
+}
+
 TIGL_COMMON_EXPORT const char * tiglGetErrorString(TiglReturnCode code)
 {
     if (code > TIGL_MATH_ERROR || code < 0) {
@@ -6791,6 +7281,71 @@ TIGL_COMMON_EXPORT TiglReturnCode tiglLogSetVerbosity(TiglLogLevel consoleVerbos
     return TIGL_SUCCESS;
 }
 
+TIGL_COMMON_EXPORT TiglReturnCode tiglProfilingEnable(TiglBoolean enabled)
+{
+    try {
+        tigl::CTiglProfiler::Instance().SetEnabled(enabled == TIGL_TRUE);
+        return TIGL_SUCCESS;
+    }
+    catch (std::exception& ex) {
+        LOG(ERROR) << "In tiglProfilingEnable: " << ex.what();
+    }
+    catch (...) {
+        LOG(ERROR) << "Caught an exception in tiglProfilingEnable!";
+    }
+    return TIGL_ERROR;
+}
+
+TIGL_COMMON_EXPORT TiglReturnCode tiglProfilingReset(void)
+{
+    try {
+        tigl::CTiglProfiler::Instance().Reset();
+        return TIGL_SUCCESS;
+    }
+    catch (std::exception& ex) {
+        LOG(ERROR) << "In tiglProfilingReset: " << ex.what();
+    }
+    catch (...) {
+        LOG(ERROR) << "Caught an exception in tiglProfilingReset!";
+    }
+    return TIGL_ERROR;
+}
+
+TIGL_COMMON_EXPORT TiglReturnCode tiglProfilingGetReport(TiglProfilingFormat format, char** reportPtr)
+{
+    if (reportPtr == NULL) {
+        LOG(ERROR) << "Null pointer argument for reportPtr in function call to tiglProfilingGetReport.";
+        return TIGL_NULL_POINTER;
+    }
+
+    // the returned string is valid until the next call
+    static std::string report;
+
+    try {
+        tigl::CTiglProfiler& profiler = tigl::CTiglProfiler::Instance();
+        switch (format) {
+        case TIGL_PROFILING_JSON:
+            report = profiler.JsonReport();
+            break;
+        case TIGL_PROFILING_CHROME_TRACE:
+            report = profiler.ChromeTraceReport();
+            break;
+        default:
+            LOG(ERROR) << "Invalid report format in tiglProfilingGetReport.";
+            return TIGL_ERROR;
+        }
+        *reportPtr = const_cast<char*>(report.c_str());
+        return TIGL_SUCCESS;
+    }
+    catch (std::exception& ex) {
+        LOG(ERROR) << "In tiglProfilingGetReport: " << ex.what();
+    }
+    catch (...) {
+        LOG(ERROR) << "Caught an exception in tiglProfilingGetReport!";
+    }
+    return TIGL_ERROR;
+}
+
 TIGL_COMMON_EXPORT TiglReturnCode tiglCheckPointInside(TiglCPACSConfigurationHandle cpacsHandle,
                                                        double px, double py, double pz,
                                                        const char *componentUID, TiglBoolean *isInside)
@@ -6809,11 +7364,9 @@ TIGL_COMMON_EXPORT TiglReturnCode tiglCheckPointInside(TiglCPACSConfigurationHan
         const tigl::CCPACSConfigurationManager& manager = tigl::CCPACSConfigurationManager::GetInstance();
         tigl::CCPACSConfiguration& config = manager.GetConfiguration(cpacsHandle);
 
-        // get component
-        tigl::ITiglGeometricComponent& component = config.GetUIDManager().GetGeometricComponent(componentUID);
-
-        const TopoDS_Shape shape = component.GetLoft()->Shape();
-        *isInside = IsPointInsideShape(shape, gp_Pnt(px, py, pz)) ? TIGL_TRUE : TIGL_FALSE;
+        // the classifier of the component is reused by subsequent calls
+        tigl::CTiglSolidClassifier& classifier = config.GetSolidClassifier(componentUID);
+        *isInside = classifier.IsInside(gp_Pnt(px, py, pz)) ? TIGL_TRUE : TIGL_FALSE;
 
         return TIGL_SUCCESS;
     }
@@ -6833,6 +7386,63 @@ TIGL_COMMON_EXPORT TiglReturnCode tiglCheckPointInside(TiglCPACSConfigurationHan
     return TIGL_ERROR;
 }
 
+TIGL_COMMON_EXPORT TiglReturnCode tiglCheckPointsInside(TiglCPACSConfigurationHandle cpacsHandle,
+                                                        const char* componentUID,
+                                                        int nPoints,
+                                                        const double* px,
+                                                        const double* py,
+                                                        const double* pz,
+                                                        TiglBoolean* isInside)
+{
+    if (!componentUID) {
+        LOG(ERROR) << "Argument componentUID is NULL in tiglCheckPointsInside!";
+        return TIGL_NULL_POINTER;
+    }
+
+    if (!px || !py || !pz || !isInside) {
+        LOG(ERROR) << "Argument px, py, pz or isInside is NULL in tiglCheckPointsInside!";
+        return TIGL_NULL_POINTER;
+    }
+
+    if (nPoints < 0) {
+        LOG(ERROR) << "Argument nPoints is negative in tiglCheckPointsInside!";
+        return TIGL_ERROR;
+    }
+
+    try {
+        const tigl::CCPACSConfigurationManager& manager = tigl::CCPACSConfigurationManager::GetInstance();
+        tigl::CCPACSConfiguration& config = manager.GetConfiguration(cpacsHandle);
+
+        std::vector<gp_Pnt> points;
+        points.reserve(nPoints);
+        for (int i = 0; i < nPoints; ++i) {
+            points.push_back(gp_Pnt(px[i], py[i], pz[i]));
+        }
+
+        tigl::CTiglSolidClassifier& classifier = config.GetSolidClassifier(componentUID);
+        std::vector<bool> inside = classifier.IsInside(points);
+        for (int i = 0; i < nPoints; ++i) {
+            isInside[i] = inside[i] ? TIGL_TRUE : TIGL_FALSE;
+        }
+
+        return TIGL_SUCCESS;
+    }
+    catch (const tigl::CTiglError& ex) {
+        LOG(ERROR) << "In tiglCheckPointsInside: " << ex.what();
+        return ex.getCode();
+    }
+    catch (std::exception& ex) {
+        LOG(ERROR) << "In tiglCheckPointsInside: " << ex.what();
+    }
+    catch (Standard_Failure& err) {
+        LOG(ERROR) << "Cannot compute shape `" << componentUID << "`: " << err.GetMessageString();
+    }
+    catch (...) {
+        LOG(ERROR) << "Caught an exception in tiglCheckPointsInside!";
+    }
+    return TIGL_ERROR;
+}
+
 TiglReturnCode tiglSetExportOptions(const char *exporter_name, const char *option_name, const char *option_value)
 {
     if (!exporter_name) {
@@ -7019,3 +7629,193 @@ TiglReturnCode tiglConfigurationGetBoundingBox(TiglCPACSConfigurationHandle cpac
     return TIGL_ERROR;
 
 }
+
+TiglReturnCode tiglConfigurationGetRebuiltComponentCount(TiglCPACSConfigurationHandle cpacsHandle, int* countPtr)
+{
+    if (!countPtr) {
+        LOG(ERROR) << "Null pointer for argument countPtr in tiglConfigurationGetRebuiltComponentCount";
+        return TIGL_NULL_POINTER;
+    }
+
+    try {
+        const tigl::CCPACSConfigurationManager& manager = tigl::CCPACSConfigurationManager::GetInstance();
+        tigl::CCPACSConfiguration& config = manager.GetConfiguration(cpacsHandle);
+
+        *countPtr = static_cast<int>(config.GetRebuiltComponents().size());
+        return TIGL_SUCCESS;
+    }
+    catch (const tigl::CTiglError& ex) {
+        LOG(ERROR) << "In tiglConfigurationGetRebuiltComponentCount: " << ex.what();
+        return ex.getCode();
+    }
+    catch (std::exception& ex) {
+        LOG(ERROR) << "In tiglConfigurationGetRebuiltComponentCount: " << ex.what();
+    }
+    catch (...) {
+        LOG(ERROR) << "Caught an exception in tiglConfigurationGetRebuiltComponentCount!";
+    }
+    return TIGL_ERROR;
+}
+
+TiglReturnCode tiglConfigurationGetRebuiltComponentUID(TiglCPACSConfigurationHandle cpacsHandle, int componentIndex, char** componentUID)
+{
+    if (!componentUID) {
+        LOG(ERROR) << "Null pointer for argument componentUID in tiglConfigurationGetRebuiltComponentUID";
+        return TIGL_NULL_POINTER;
+    }
+
+    try {
+        const tigl::CCPACSConfigurationManager& manager = tigl::CCPACSConfigurationManager::GetInstance();
+        tigl::CCPACSConfiguration& config = manager.GetConfiguration(cpacsHandle);
+
+        std::vector<std::string> rebuiltComponents = config.GetRebuiltComponents();
+        if (componentIndex < 1 || componentIndex > static_cast<int>(rebuiltComponents.size())) {
+            LOG(ERROR) << "Invalid component index in tiglConfigurationGetRebuiltComponentUID";
+            return TIGL_INDEX_ERROR;
+        }
+
+        // return the uid stored in the uid manager, which lives as long as the configuration
+        const tigl::ShapeContainerType& components = config.GetUIDManager().GetShapeContainer();
+        tigl::ShapeContainerType::const_iterator it = components.find(rebuiltComponents[componentIndex - 1]);
+        if (it == components.end()) {
+            LOG(ERROR) << "Rebuilt component " << rebuiltComponents[componentIndex - 1]
+                       << " is not registered in tiglConfigurationGetRebuiltComponentUID";
+            return TIGL_NOT_FOUND;
+        }
+        *componentUID = const_cast<char*>(it->first.c_str());
+        return TIGL_SUCCESS;
+    }
+    catch (const tigl::CTiglError& ex) {
+        LOG(ERROR) << "In tiglConfigurationGetRebuiltComponentUID: " << ex.what();
+        return ex.getCode();
+    }
+    catch (std::exception& ex) {
+        LOG(ERROR) << "In tiglConfigurationGetRebuiltComponentUID: " << ex.what();
+    }
+    catch (...) {
+        LOG(ERROR) << "Caught an exception in tiglConfigurationGetRebuiltComponentUID!";
+    }
+    return TIGL_ERROR;
+}
+
+TiglReturnCode tiglConfigurationClearRebuiltComponents(TiglCPACSConfigurationHandle cpacsHandle)
+{
+    try {
+        const tigl::CCPACSConfigurationManager& manager = tigl::CCPACSConfigurationManager::GetInstance();
+        tigl::CCPACSConfiguration& config = manager.GetConfiguration(cpacsHandle);
+
+        config.ClearRebuiltComponents();
+        return TIGL_SUCCESS;
+    }
+    catch (const tigl::CTiglError& ex) {
+        LOG(ERROR) << "In tiglConfigurationClearRebuiltComponents: " << ex.what();
+        return ex.getCode();
+    }
+    catch (std::exception& ex) {
+        LOG(ERROR) << "In tiglConfigurationClearRebuiltComponents: " << ex.what();
+    }
+    catch (...) {
+        LOG(ERROR) << "Caught an exception in tiglConfigurationClearRebuiltComponents!";
+    }
+    return TIGL_ERROR;
+}
+
+TiglReturnCode tiglConfigurationBuildAllLofts(TiglCPACSConfigurationHandle cpacsHandle, int nThreads)
+{
+    try {
+        const tigl::CCPACSConfigurationManager& manager = tigl::CCPACSConfigurationManager::GetInstance();
+        tigl::CCPACSConfiguration& config = manager.GetConfiguration(cpacsHandle);
+
+        config.BuildAllLofts(nThreads);
+        return TIGL_SUCCESS;
+    }
+    catch (const tigl::CTiglError& ex) {
+        LOG(ERROR) << "In tiglConfigurationBuildAllLofts: " << ex.what();
+        return ex.getCode();
+    }
+    catch (std::exception& ex) {
+        LOG(ERROR) << "In tiglConfigurationBuildAllLofts: " << ex.what();
+    }
+    catch (...) {
+        LOG(ERROR) << "Caught an exception in tiglConfigurationBuildAllLofts!";
+    }
+    return TIGL_ERROR;
+}
+
+TiglReturnCode tiglSetLoftCacheDirectory(const char* directory)
+{
+    if (directory == NULL) {
+        LOG(ERROR) << "Null pointer argument for directory in function call to tiglSetLoftCacheDirectory.";
+        return TIGL_NULL_POINTER;
+    }
+
+    try {
+        tigl::CTiglLoftDiskCache::SetDirectory(directory);
+        return TIGL_SUCCESS;
+    }
+    catch (const tigl::CTiglError& ex) {
+        LOG(ERROR) << "In tiglSetLoftCacheDirectory: " << ex.what();
+        return ex.getCode();
+    }
+    catch (std::exception& ex) {
+        LOG(ERROR) << "In tiglSetLoftCacheDirectory: " << ex.what();
+    }
+    catch (...) {
+        LOG(ERROR) << "Caught an exception in tiglSetLoftCacheDirectory!";
+    }
+    return TIGL_ERROR;
+}
+
+TiglReturnCode tiglSetCacheMemoryBudget(double budgetBytes)
+{
+    if (budgetBytes < 0.) {
+        LOG(ERROR) << "Negative memory budget in function call to tiglSetCacheMemoryBudget.";
+        return TIGL_ERROR;
+    }
+
+    try {
+        const double maxBudget = static_cast<double>(std::numeric_limits<size_t>::max());
+        tigl::CTiglCacheAccounting::SetMemoryBudget(budgetBytes < maxBudget ? static_cast<size_t>(budgetBytes)
+                                                                            : std::numeric_limits<size_t>::max());
+        return TIGL_SUCCESS;
+    }
+    catch (std::exception& ex) {
+        LOG(ERROR) << "In tiglSetCacheMemoryBudget: " << ex.what();
+    }
+    catch (...) {
+        LOG(ERROR) << "Caught an exception in tiglSetCacheMemoryBudget!";
+    }
+    return TIGL_ERROR;
+}
+
+TiglReturnCode tiglConfigurationGetCacheStatistics(TiglCPACSConfigurationHandle cpacsHandle,
+                                                   double* hits, double* misses, double* evictions,
+                                                   double* residentBytes)
+{
+    if (!hits || !misses || !evictions || !residentBytes) {
+        LOG(ERROR) << "Null pointer argument in function call to tiglConfigurationGetCacheStatistics.";
+        return TIGL_NULL_POINTER;
+    }
+
+    try {
+        tigl::CCPACSConfigurationManager& manager = tigl::CCPACSConfigurationManager::GetInstance();
+        const tigl::CTiglCacheStatistics stats = manager.GetConfiguration(cpacsHandle).GetCacheStatistics();
+
+        *hits          = static_cast<double>(stats.hits);
+        *misses        = static_cast<double>(stats.misses);
+        *evictions     = static_cast<double>(stats.evictions);
+        *residentBytes = static_cast<double>(stats.residentBytes);
+        return TIGL_SUCCESS;
+    }
+    catch (const tigl::CTiglError& ex) {
+        LOG(ERROR) << "In tiglConfigurationGetCacheStatistics: " << ex.what();
+        return ex.getCode();
+    }
+    catch (std::exception& ex) {
+        LOG(ERROR) << "In tiglConfigurationGetCacheStatistics: " << ex.what();
+    }
+    catch (...) {
+        LOG(ERROR) << "Caught an exception in tiglConfigurationGetCacheStatistics!";
+    }
+    return TIGL_ERROR;
+}
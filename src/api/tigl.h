@@ -322,6 +322,52 @@ typedef const char** TiglStringList;
 typedef enum TiglImportExportFormat TiglImportExportFormat;
 
 
+/**
+ \ingroup Enums
+  Definition of the report formats of ::tiglProfilingGetReport.
+*/
+enum TiglProfilingFormat
+{
+    TIGL_PROFILING_JSON         = 0,       /**< Aggregated timing tree as JSON */
+    TIGL_PROFILING_CHROME_TRACE = 1        /**< All timers in the Chrome trace event format */
+};
+
+/**
+* @brief Definition of the report formats of ::tiglProfilingGetReport.
+*
+* Possible values are:
+*
+* - TIGL_PROFILING_JSON:         The timings aggregated per operation and component uid as JSON tree.
+* - TIGL_PROFILING_CHROME_TRACE: All timers in the Chrome trace event format, which can be viewed
+*                                with chrome://tracing.
+*
+*/
+typedef enum TiglProfilingFormat TiglProfilingFormat;
+
+
+/**
+ \ingroup Enums
+  Definition of the accuracy of the integral properties, see ::tiglComponentGetIntegralProperties.
+*/
+enum TiglIntegrationAccuracy
+{
+    TIGL_INTEGRATION_FAST  = 0,       /**< Integration of a triangulation */
+    TIGL_INTEGRATION_EXACT = 1        /**< Gauss integration of the surfaces */
+};
+
+/**
+* @brief Definition of the accuracy of the integral properties (volume, area, centroid, inertia).
+*
+* Possible values are:
+*
+* - TIGL_INTEGRATION_FAST:  The properties are integrated over a triangulation of the component.
+*                           The relative error is about 1e-3.
+* - TIGL_INTEGRATION_EXACT: The properties are integrated over the exact surfaces of the component.
+*
+*/
+typedef enum TiglIntegrationAccuracy TiglIntegrationAccuracy;
+
+
 /**
   \defgroup GeneralFunctions General TIGL handling functions
     Function to open, create, and close CPACS-files.
@@ -363,6 +409,24 @@ TIGL_COMMON_EXPORT TiglReturnCode tiglOpenCPACSConfiguration(TixiDocumentHandle
 */
 TIGL_COMMON_EXPORT TiglReturnCode tiglSaveCPACSConfiguration(const char* configurationUID, TiglCPACSConfigurationHandle cpacsHandle);
 
+/**
+* @brief Writes the parts of a CPACS configuration, that have been modified since it was opened or saved.
+*
+* Unmodified elements are not visited, which makes saving much faster than tiglSaveCPACSConfiguration
+* if only a few values have been changed. The result is the same as with tiglSaveCPACSConfiguration,
+* as long as the TIXI document has not been modified by other means since the last open or save.
+*
+* @param[in] configurationUID The UID of the configuration that should be written.
+* @param[in] cpacsHandle Handle to the CPACS configuration. This handle is used in calls to other TIGL functions.
+*
+* @return
+*   - TIGL_SUCCESS if the CPACS configuration was successfully written
+*   - TIGL_NULL_POINTER if configurationUID is an invalid null pointer
+*   - TIGL_UNINITIALIZED if cpacsHandle is not managed by the CCPACSConfigurationManager
+*   - TIGL_ERROR if some other kind of error occurred
+*/
+TIGL_COMMON_EXPORT TiglReturnCode tiglSaveCPACSConfigurationIncremental(const char* configurationUID, TiglCPACSConfigurationHandle cpacsHandle);
+
 /**
 * @brief Closes a CPACS configuration and cleans up all memory used by the configuration.
 *        After closing a configuration the associated configuration handle is no longer valid.
@@ -620,6 +684,92 @@ TIGL_COMMON_EXPORT TiglReturnCode tiglWingGetLowerPoint(TiglCPACSConfigurationHa
                                                         double* pointYPtr,
                                                         double* pointZPtr);
 
+/**
+* @brief Returns multiple points on the upper wing surface for a
+* a given wing and segment index.
+*
+* This function is equivalent to calling ::tiglWingGetUpperPoint for each
+* pair of eta and xsi coordinates. The wing segment, its profiles and transformations
+* are resolved only once for all points, which makes this function much faster
+* when many points are required. Large point sets are evaluated in parallel.
+*
+* The output arrays pointsX, pointsY and pointsZ have to be allocated by the user and
+* must have the size nPoints.
+*
+* @param[in]  cpacsHandle  Handle for the CPACS configuration
+* @param[in]  wingIndex    The index of the wing, starting at 1
+* @param[in]  segmentIndex The index of the segment of the wing, starting at 1
+* @param[in]  nPoints      Number of points to evaluate, i.e. size of the input and output arrays
+* @param[in]  etas         Array of eta values in the range 0.0 <= eta <= 1.0
+* @param[in]  xsis         Array of xsi values in the range 0.0 <= xsi <= 1.0
+* @param[out] pointsX      Array of the x-coordinates of the points in absolute world coordinates
+* @param[out] pointsY      Array of the y-coordinates of the points in absolute world coordinates
+* @param[out] pointsZ      Array of the z-coordinates of the points in absolute world coordinates
+*
+* @cond
+* #annotate in: 4A(3), 5A(3) out: 6AM(3), 7AM(3), 8AM(3)#
+* @endcond
+*
+* @return
+*   - TIGL_SUCCESS if all points were found
+*   - TIGL_NOT_FOUND if a point was not found or the cpacs handle is not valid
+*   - TIGL_INDEX_ERROR if wingIndex or segmentIndex are not valid
+*   - TIGL_NULL_POINTER if etas, xsis, pointsX, pointsY or pointsZ are null pointers
+*   - TIGL_ERROR if nPoints is negative or some other error occurred
+*/
+TIGL_COMMON_EXPORT TiglReturnCode tiglWingGetUpperPoints(TiglCPACSConfigurationHandle cpacsHandle,
+                                                         int wingIndex,
+                                                         int segmentIndex,
+                                                         int nPoints,
+                                                         const double* etas,
+                                                         const double* xsis,
+                                                         double* pointsX,
+                                                         double* pointsY,
+                                                         double* pointsZ);
+
+/**
+* @brief Returns multiple points on the lower wing surface for a
+* a given wing and segment index.
+*
+* This function is equivalent to calling ::tiglWingGetLowerPoint for each
+* pair of eta and xsi coordinates. The wing segment, its profiles and transformations
+* are resolved only once for all points, which makes this function much faster
+* when many points are required. Large point sets are evaluated in parallel.
+*
+* The output arrays pointsX, pointsY and pointsZ have to be allocated by the user and
+* must have the size nPoints.
+*
+* @param[in]  cpacsHandle  Handle for the CPACS configuration
+* @param[in]  wingIndex    The index of the wing, starting at 1
+* @param[in]  segmentIndex The index of the segment of the wing, starting at 1
+* @param[in]  nPoints      Number of points to evaluate, i.e. size of the input and output arrays
+* @param[in]  etas         Array of eta values in the range 0.0 <= eta <= 1.0
+* @param[in]  xsis         Array of xsi values in the range 0.0 <= xsi <= 1.0
+* @param[out] pointsX      Array of the x-coordinates of the points in absolute world coordinates
+* @param[out] pointsY      Array of the y-coordinates of the points in absolute world coordinates
+* @param[out] pointsZ      Array of the z-coordinates of the points in absolute world coordinates
+*
+* @cond
+* #annotate in: 4A(3), 5A(3) out: 6AM(3), 7AM(3), 8AM(3)#
+* @endcond
+*
+* @return
+*   - TIGL_SUCCESS if all points were found
+*   - TIGL_NOT_FOUND if a point was not found or the cpacs handle is not valid
+*   - TIGL_INDEX_ERROR if wingIndex or segmentIndex are not valid
+*   - TIGL_NULL_POINTER if etas, xsis, pointsX, pointsY or pointsZ are null pointers
+*   - TIGL_ERROR if nPoints is negative or some other error occurred
+*/
+TIGL_COMMON_EXPORT TiglReturnCode tiglWingGetLowerPoints(TiglCPACSConfigurationHandle cpacsHandle,
+                                                         int wingIndex,
+                                                         int segmentIndex,
+                                                         int nPoints,
+                                                         const double* etas,
+                                                         const double* xsis,
+                                                         double* pointsX,
+                                                         double* pointsY,
+                                                         double* pointsZ);
+
 /**
 * @brief Returns a point on the wing chord surface for a
 * a given wing and segment index.
@@ -1274,6 +1424,46 @@ TIGL_COMMON_EXPORT TiglReturnCode tiglWingComponentSegmentFindSegment(TiglCPACSC
                                                                       const char *componentSegmentUID, double x, double y,
                                                                       double z, char** segmentUID, char** wingUID);
 
+/**
+* @brief Returns the wing segment indices and the segment eta and xsi coordinates for multiple points on a componentSegment.
+*
+* For each point, the same segment is found as with ::tiglWingComponentSegmentFindSegment. The segments are
+* looked up in a spatial index of the component segment, which makes this function well suited to map large point sets
+* (e.g. finite element nodes) onto the component segment. Points outside the component segment are assigned to the
+* nearest segment, if they are closer than 1cm. The eta and xsi coordinates are clamped to the segment.
+*
+* The output arrays have to be allocated by the user and must have the size nPoints.
+*
+* @param[in]  cpacsHandle             Handle for the CPACS configuration
+* @param[in]  componentSegmentUID     UID of the componentSegment
+* @param[in]  nPoints                 Number of points, i.e. size of the input and output arrays
+* @param[in]  pointsX, pointsY, pointsZ  Arrays of the global coordinates of the points
+* @param[out] segmentIndices          Array of the wing segment indices (1 <= index <= number of wing segments), see ::tiglWingGetSegmentUID.
+*                                     The index is 0, if the point does not lie on the component segment within 1cm tolerance.
+* @param[out] segmentEtas             Array of the eta coordinates of the points on the corresponding segments
+* @param[out] segmentXsis             Array of the xsi coordinates of the points on the corresponding segments
+*
+* @cond
+* #annotate in: 3A(2), 4A(2), 5A(2) out: 6AM(2), 7AM(2), 8AM(2)#
+* @endcond
+*
+* @return
+*   - TIGL_SUCCESS if no error occurred, even if some points do not lie on the component segment
+*   - TIGL_NOT_FOUND if no configuration was found for the given handle
+*   - TIGL_UID_ERROR if the componentSegment does not exist
+*   - TIGL_NULL_POINTER if componentSegmentUID or any of the arrays is a null pointer
+*   - TIGL_ERROR if nPoints is negative or some other error occurred
+*/
+TIGL_COMMON_EXPORT TiglReturnCode tiglWingComponentSegmentPointsGetSegmentEtaXsi(TiglCPACSConfigurationHandle cpacsHandle,
+                                                                                 const char *componentSegmentUID,
+                                                                                 int nPoints,
+                                                                                 const double* pointsX,
+                                                                                 const double* pointsY,
+                                                                                 const double* pointsZ,
+                                                                                 int* segmentIndices,
+                                                                                 double* segmentEtas,
+                                                                                 double* segmentXsis);
+
 
 /**
 * @brief Returns x,y,z koordinates for a given eta and xsi on a componentSegment.
@@ -1299,6 +1489,41 @@ TIGL_COMMON_EXPORT TiglReturnCode tiglWingComponentSegmentGetPoint(TiglCPACSConf
                                                                    double * y, 
                                                                    double * z);
 
+/**
+* @brief Returns x,y,z koordinates for multiple eta and xsi coordinates on a componentSegment.
+*
+* This function is equivalent to calling ::tiglWingComponentSegmentGetPoint for each pair of
+* eta and xsi coordinates, but resolves the component segment only once.
+* The output arrays x, y and z have to be allocated by the user and must have the size nPoints.
+*
+* @param[in]  cpacsHandle               Handle for the CPACS configuration
+* @param[in]  componentSegmentUID       UID of the componentSegment
+* @param[in]  nPoints                   Number of points to evaluate, i.e. size of the input and output arrays
+* @param[in]  etas, xsis                Arrays of the eta and xsi coordinates of the points on the componentSegment
+* @param[out] x                         Array of the x coordinates of the points
+* @param[out] y                         Array of the y coordinates of the points
+* @param[out] z                         Array of the z coordinates of the points
+*
+* @cond
+* #annotate in: 3A(2), 4A(2) out: 5AM(2), 6AM(2), 7AM(2)#
+* @endcond
+*
+* @return
+*   - TIGL_SUCCESS if no error occurred
+*   - TIGL_NOT_FOUND if no configuration was found for the given handle
+*   - TIGL_UID_ERROR if the componentSegment does not exist
+*   - TIGL_NULL_POINTER if componentSegmentUID, etas, xsis, x, y or z are null pointers
+*   - TIGL_ERROR if nPoints is negative or some other error occurred
+*/
+TIGL_COMMON_EXPORT TiglReturnCode tiglWingComponentSegmentGetPoints(TiglCPACSConfigurationHandle cpacsHandle,
+                                                                    const char *componentSegmentUID,
+                                                                    int nPoints,
+                                                                    const double* etas,
+                                                                    const double* xsis,
+                                                                    double* x,
+                                                                    double* y,
+                                                                    double* z);
+
 /**
  * @brief Projects a points onto the chord face of the wing component segment
  *        and returns the eta/xsi coordinates of the point of projection.
@@ -1647,6 +1872,93 @@ TIGL_COMMON_EXPORT TiglReturnCode tiglFuselageGetPoint(TiglCPACSConfigurationHan
                                                        double* pointYPtr,
                                                        double* pointZPtr);
 
+/**
+* @brief Returns multiple points on a fuselage surface for a given fuselage and segment index.
+*
+* This function is equivalent to calling ::tiglFuselageGetPoint for each pair of eta and zeta
+* coordinates. The fuselage segment, its profiles and transformations are resolved only once
+* for all points, which makes this function much faster when many points are required.
+* Large point sets are evaluated in parallel.
+*
+* The output arrays pointsX, pointsY and pointsZ have to be allocated by the user and
+* must have the size nPoints.
+*
+* @param[in]  cpacsHandle   Handle for the CPACS configuration
+* @param[in]  fuselageIndex The index of the fuselage, starting at 1
+* @param[in]  segmentIndex  The index of the segment of the fuselage, starting at 1
+* @param[in]  nPoints       Number of points to evaluate, i.e. size of the input and output arrays
+* @param[in]  etas          Array of eta values in the range 0.0 <= eta <= 1.0
+* @param[in]  zetas         Array of zeta values in the range 0.0 <= zeta <= 1.0
+* @param[out] pointsX       Array of the x-coordinates of the points in absolute world coordinates
+* @param[out] pointsY       Array of the y-coordinates of the points in absolute world coordinates
+* @param[out] pointsZ       Array of the z-coordinates of the points in absolute world coordinates
+*
+* @cond
+* #annotate in: 4A(3), 5A(3) out: 6AM(3), 7AM(3), 8AM(3)#
+* @endcond
+*
+* @return
+*   - TIGL_SUCCESS if all points were found
+*   - TIGL_NOT_FOUND if the cpacs handle is not valid
+*   - TIGL_INDEX_ERROR if fuselageIndex or segmentIndex are not valid
+*   - TIGL_NULL_POINTER if etas, zetas, pointsX, pointsY or pointsZ are null pointers
+*   - TIGL_ERROR if nPoints is negative or some other error occurred
+*/
+TIGL_COMMON_EXPORT TiglReturnCode tiglFuselageGetPoints(TiglCPACSConfigurationHandle cpacsHandle,
+                                                        int fuselageIndex,
+                                                        int segmentIndex,
+                                                        int nPoints,
+                                                        const double* etas,
+                                                        const double* zetas,
+                                                        double* pointsX,
+                                                        double* pointsY,
+                                                        double* pointsZ);
+
+/**
+* @brief Intersects multiple rays with the fuselage surface.
+*
+* Each ray starts at its origin and follows its direction, both given in absolute world coordinates.
+* The intersection is computed as for the placement of stringers and frames, i.e. the rays should
+* start inside the fuselage. The fuselage faces are organized in a spatial search tree, which is
+* built only once per fuselage loft. Large numbers of rays are intersected in parallel.
+*
+* The output arrays have to be allocated by the user and must have the size nRays.
+*
+* @param[in]  cpacsHandle   Handle for the CPACS configuration
+* @param[in]  fuselageIndex The index of the fuselage, starting at 1
+* @param[in]  nRays         Number of rays, i.e. size of the input and output arrays
+* @param[in]  originsX, originsY, originsZ        Arrays of the ray origins
+* @param[in]  directionsX, directionsY, directionsZ  Arrays of the ray directions. The directions must not be zero.
+* @param[out] pointsX, pointsY, pointsZ           Arrays of the intersection points in absolute world coordinates
+* @param[out] hits          Array of flags, which are 1 if the ray hits the fuselage and 0 otherwise.
+*                           If a ray misses the fuselage, its intersection point is undefined.
+*
+* @cond
+* #annotate in: 3A(2), 4A(2), 5A(2), 6A(2), 7A(2), 8A(2) out: 9AM(2), 10AM(2), 11AM(2), 12AM(2)#
+* @endcond
+*
+* @return
+*   - TIGL_SUCCESS if no error occurred, even if some rays miss the fuselage
+*   - TIGL_NOT_FOUND if the cpacs handle is not valid
+*   - TIGL_INDEX_ERROR if fuselageIndex is not valid
+*   - TIGL_NULL_POINTER if any of the arrays is a null pointer
+*   - TIGL_MATH_ERROR if a ray direction is zero
+*   - TIGL_ERROR if nRays is negative or some other error occurred
+*/
+TIGL_COMMON_EXPORT TiglReturnCode tiglFuselageGetRayIntersections(TiglCPACSConfigurationHandle cpacsHandle,
+                                                                  int fuselageIndex,
+                                                                  int nRays,
+                                                                  const double* originsX,
+                                                                  const double* originsY,
+                                                                  const double* originsZ,
+                                                                  const double* directionsX,
+                                                                  const double* directionsY,
+                                                                  const double* directionsZ,
+                                                                  double* pointsX,
+                                                                  double* pointsY,
+                                                                  double* pointsZ,
+                                                                  int* hits);
+
 
 /**
 * @brief Returns a point on a fuselage surface for a given fuselage and segment index and an angle alpha (degree).
@@ -3383,11 +3695,25 @@ TIGL_COMMON_EXPORT TiglReturnCode tiglGetCurveParameter (TiglCPACSConfigurationH
 *      To avoid duplicate vertices, normals should be disabled.
 *    - MultiplePieces (Values: "true", "false"): Whether to export the shapes into multiple vtk pieces.
 *    - WriteMetaData (Values: "true", "false"): Whether to add meta data (e.g. wing segments etc...)
+*    - WriteBinary (Values: "true", "false"): Whether to stream the data as raw binary appended data
+*      instead of ascii. This is much faster and requires less memory for large meshes.
+*    - CompressBinary (Values: "true", "false"): Whether to zlib compress the binary data (requires WriteBinary).
+*    - ParallelMeshing (Values: "true", "false"): Whether to mesh and annotate the faces in parallel.
 *  - IGES:
 *    - IGES5.3 (Values: "true", "false"): Whether to use IGES 5.3 format, that supports shells and solids.
 *      Note: Some software do not yet implement this standard. E.g. Catia might only load this, when set to false!
 *    - FaceNames (Values: "UIDOnly", "FaceNameOnly", "UIDandFaceName", "None"): Defines, how to write the names of the
 *      faces to the IGES files. The most versatile is probably "UIDandFaceName". (Default: "FaceNameOnly")
+*  - STEP:
+*    - WriteAssembly (Values: "true", "false"): Whether to write the shapes as parts of a product assembly.
+*      Shapes sharing the same geometry at different locations (e.g. rotor blades) are written only once.
+*      Mirrored shapes are still written as separate parts. (Default: "false")
+*  - STL:
+*    - WriteBinary (Values: "true", "false"): Whether to write binary instead of ascii stl files. (Default: "false")
+*    - MultipleSolids (Values: "true", "false"): Whether to write a named solid for each shape, or each group of faces
+*      defined by ShapeGroupMode, instead of a single solid. Ascii files contain multiple solid blocks, binary
+*      mode writes each solid into its own file <filename>_<solid name>.stl. (Default: "false")
+*    - ParallelMeshing (Values: "true", "false"): Whether to mesh the faces in parallel. (Default: "false")
 *
 * Example: The IGES export normally does only write half-models. It does not apply symmetries.
 * to change this, just call 
@@ -4541,6 +4867,64 @@ TIGL_COMMON_EXPORT TiglReturnCode tiglLogSetVerbosity(TiglLogLevel level);
 
 /*@}*/ // end of doxygen group
 
+/*****************************************************************************************************/
+/**
+  \defgroup ProfilingFunctions Profiling functions.
+    The following functions measure, where TiGL spends its time. If profiling is enabled, TiGL
+    times the reading of CPACS files, the build of all cached geometries, boolean operations,
+    meshing and exports. The timings are aggregated per operation and component uid into a tree,
+    where nested operations are children of the operation they are called from.
+
+    Profiling is disabled by default. A disabled profiler has no noticeable overhead.
+ */
+/*@{*/
+
+/**
+* @brief Enables or disables the profiling of TiGL.
+*
+* Disabling the profiling keeps the timings collected so far. Use ::tiglProfilingReset
+* to remove them.
+*
+* @param[in]  enabled Set to true, if the profiling should be enabled.
+*
+* @return
+*   - TIGL_SUCCESS if no error occurred
+*   - TIGL_ERROR if some error occurred
+*/
+TIGL_COMMON_EXPORT TiglReturnCode tiglProfilingEnable(TiglBoolean enabled);
+
+/**
+* @brief Removes all timings collected so far.
+*
+* @return
+*   - TIGL_SUCCESS if no error occurred
+*   - TIGL_ERROR if some error occurred
+*/
+TIGL_COMMON_EXPORT TiglReturnCode tiglProfilingReset(void);
+
+/**
+* @brief Returns a report of all timings collected since profiling was enabled or reset.
+*
+* The JSON report is a tree of nodes with the fields "operation", "uid", "count",
+* "total_time_s", "self_time_s" and "children". The children are sorted by their total time.
+* Operations, which ran in parallel threads, may take longer in total than their parent.
+*
+* The Chrome trace report contains every single timer and can be opened in chrome://tracing.
+* At most one million timers are recorded, further timers are only aggregated.
+*
+* @param[in]  format    Format of the report
+* @param[out] reportPtr Pointer to the report. The string is owned by TiGL and is valid
+*                       until the next call of this function.
+*
+* @return
+*   - TIGL_SUCCESS if no error occurred
+*   - TIGL_NULL_POINTER if reportPtr is a null pointer
+*   - TIGL_ERROR if some other error occurred
+*/
+TIGL_COMMON_EXPORT TiglReturnCode tiglProfilingGetReport(TiglProfilingFormat format, char** reportPtr);
+
+/*@}*/ // end of doxygen group
+
 /*@}*/
 /*****************************************************************************************************/
 /**
@@ -4573,6 +4957,47 @@ TIGL_COMMON_EXPORT TiglReturnCode tiglCheckPointInside(TiglCPACSConfigurationHan
                                                        const char* componentUID,
                                                        TiglBoolean* isInside);
 
+/**
+ * @brief Checks for multiple points, whether they lie inside the given geometric object.
+ *
+ * This function is equivalent to calling ::tiglCheckPointInside for each point, but
+ * much faster for many points. The component is triangulated once and the triangulation
+ * is used to classify all points that are not close to the surface. Only points close
+ * to the surface are classified with the exact (and slow) algorithm. The classifier is kept
+ * for subsequent calls of ::tiglCheckPointsInside and ::tiglCheckPointInside as long as
+ * the geometry of the component does not change.
+ *
+ * This function works only for solid objects!
+ *
+ * The output array isInside has to be allocated by the user and must have the size nPoints.
+ *
+ * @param[in]  cpacsHandle   Handle for the CPACS configuration
+ * @param[in]  componentUID  UID of the component (e.g. a fuselage UID, wing UID, wing segment UID ...)
+ * @param[in]  nPoints       Number of points, i.e. size of the input and output arrays
+ * @param[in]  px            Array of the x coordinates of the points
+ * @param[in]  py            Array of the y coordinates of the points
+ * @param[in]  pz            Array of the z coordinates of the points
+ * @param[out] isInside      Array, that returns for each point whether it lies inside the object or not.
+ *
+ * @cond
+ * #annotate in: 3A(2), 4A(2), 5A(2) out: 6AM(2)#
+ * @endcond
+ *
+ * @return
+ *   - TIGL_SUCCESS if no error occurred.
+ *   - TIGL_NOT_FOUND if no configuration was found for the given handle.
+ *   - TIGL_UID_ERROR if the component does not exist or is not a geometric object.
+ *   - TIGL_NULL_POINTER if componentUID, px, py, pz or isInside are null.
+ *   - TIGL_ERROR if nPoints is negative or some error occurred, e.g. the component is not a solid object.
+ */
+TIGL_COMMON_EXPORT TiglReturnCode tiglCheckPointsInside(TiglCPACSConfigurationHandle cpacsHandle,
+                                                        const char* componentUID,
+                                                        int nPoints,
+                                                        const double* px,
+                                                        const double* py,
+                                                        const double* pz,
+                                                        TiglBoolean* isInside);
+
 /**
 * @brief Returns a unique HashCode for a geometric component. 
 * 
@@ -4595,6 +5020,76 @@ TIGL_COMMON_EXPORT TiglReturnCode tiglComponentGetHashCode(TiglCPACSConfiguratio
                                                            const char* componentUID,
                                                            int* hashCodePtr);
 
+/**
+* @brief Returns the volume, the surface area and the centroid of a geometric component.
+*
+* The component, for example a wing, a fuselage or a rotor, is specified via its UID.
+* The properties are computed for unit density. The centroid is the center of the volume,
+* or the center of the surface for components without volume. The properties are cached
+* per accuracy and computed again only if the geometry of the component changes.
+*
+* @param[in]  cpacsHandle     Handle for the CPACS configuration
+* @param[in]  componentUID    The uid of the component
+* @param[in]  accuracy        TIGL_INTEGRATION_EXACT integrates the exact surfaces, TIGL_INTEGRATION_FAST
+*                             integrates a triangulation with a relative error of about 1e-3, which is
+*                             much faster for complex components.
+* @param[out] volumePtr       Volume of the component
+* @param[out] surfaceAreaPtr  Surface area of the component
+* @param[out] centroidXPtr    X coordinate of the centroid
+* @param[out] centroidYPtr    Y coordinate of the centroid
+* @param[out] centroidZPtr    Z coordinate of the centroid
+*
+* @return
+*   - TIGL_SUCCESS if no error occurred
+*   - TIGL_NOT_FOUND if no configuration was found for the given handle
+*   - TIGL_UID_ERROR if the component does not exist or is not a geometric object
+*   - TIGL_NULL_POINTER if componentUID or one of the output arguments is a null pointer
+*   - TIGL_ERROR if some other error occurred
+*/
+TIGL_COMMON_EXPORT TiglReturnCode tiglComponentGetIntegralProperties(TiglCPACSConfigurationHandle cpacsHandle,
+                                                                     const char* componentUID,
+                                                                     TiglIntegrationAccuracy accuracy,
+                                                                     double* volumePtr,
+                                                                     double* surfaceAreaPtr,
+                                                                     double* centroidXPtr,
+                                                                     double* centroidYPtr,
+                                                                     double* centroidZPtr);
+
+/**
+* @brief Returns the inertia tensor of a geometric component about its centroid.
+*
+* The inertia is computed for unit density, i.e. it has to be scaled with the density of
+* the component. For components without volume, the inertia of the surface is returned.
+* The products of inertia are returned with the sign convention of the inertia tensor,
+* e.g. ixy is the negative integral of x*y.
+*
+* @param[in]  cpacsHandle     Handle for the CPACS configuration
+* @param[in]  componentUID    The uid of the component
+* @param[in]  accuracy        Accuracy of the integration, see ::tiglComponentGetIntegralProperties
+* @param[out] ixxPtr          Moment of inertia about the x axis
+* @param[out] iyyPtr          Moment of inertia about the y axis
+* @param[out] izzPtr          Moment of inertia about the z axis
+* @param[out] ixyPtr          xy entry of the inertia tensor
+* @param[out] ixzPtr          xz entry of the inertia tensor
+* @param[out] iyzPtr          yz entry of the inertia tensor
+*
+* @return
+*   - TIGL_SUCCESS if no error occurred
+*   - TIGL_NOT_FOUND if no configuration was found for the given handle
+*   - TIGL_UID_ERROR if the component does not exist or is not a geometric object
+*   - TIGL_NULL_POINTER if componentUID or one of the output arguments is a null pointer
+*   - TIGL_ERROR if some other error occurred
+*/
+TIGL_COMMON_EXPORT TiglReturnCode tiglComponentGetInertiaTensor(TiglCPACSConfigurationHandle cpacsHandle,
+                                                                const char* componentUID,
+                                                                TiglIntegrationAccuracy accuracy,
+                                                                double* ixxPtr,
+                                                                double* iyyPtr,
+                                                                double* izzPtr,
+                                                                double* ixyPtr,
+                                                                double* ixzPtr,
+                                                                double* iyzPtr);
+
 
 /**
 * @brief Translates an error code into a string
@@ -4647,6 +5142,158 @@ TIGL_COMMON_EXPORT TiglReturnCode tiglConfigurationGetBoundingBox(TiglCPACSConfi
                                                                   double* maxX, double* maxY, double* maxZ);
 
 
+/**
+* @brief Returns the number of geometric components, whose loft has been (re)built
+* since the configuration has been opened or since the last call of
+* ::tiglConfigurationClearRebuiltComponents.
+*
+* Changing the geometry of a component (e.g. the rotation of a wing section) only
+* invalidates the lofts depending on it. This function can be used to check, which
+* components had to be rebuilt afterwards.
+*
+* @param[in]  cpacsHandle Handle for the CPACS configuration
+* @param[out] countPtr    Number of rebuilt components
+*
+* @return
+*   - TIGL_SUCCESS if no error occurred
+*   - TIGL_NOT_FOUND if no configuration was found for the given handle
+*   - TIGL_NULL_POINTER if countPtr is a null pointer
+*   - TIGL_ERROR if some other error occurred
+*/
+TIGL_COMMON_EXPORT TiglReturnCode tiglConfigurationGetRebuiltComponentCount(TiglCPACSConfigurationHandle cpacsHandle,
+                                                                            int* countPtr);
+
+/**
+* @brief Returns the UID of a rebuilt geometric component. The string returned must not be
+* deleted by the caller via free(). It will be deleted when the CPACS configuration
+* is closed.
+*
+* @param[in]  cpacsHandle     Handle for the CPACS configuration
+* @param[in]  componentIndex  The index of the rebuilt component, starting at 1
+* @param[out] componentUID    The uid of the rebuilt component
+*
+* @return
+*   - TIGL_SUCCESS if no error occurred
+*   - TIGL_NOT_FOUND if no configuration was found for the given handle or the component is no longer registered
+*   - TIGL_INDEX_ERROR if componentIndex is not valid
+*   - TIGL_NULL_POINTER if componentUID is a null pointer
+*   - TIGL_ERROR if some other error occurred
+*/
+TIGL_COMMON_EXPORT TiglReturnCode tiglConfigurationGetRebuiltComponentUID(TiglCPACSConfigurationHandle cpacsHandle,
+                                                                          int componentIndex,
+                                                                          char** componentUID);
+
+/**
+* @brief Resets the list of rebuilt geometric components, see
+* ::tiglConfigurationGetRebuiltComponentCount.
+*
+* @param[in]  cpacsHandle Handle for the CPACS configuration
+*
+* @return
+*   - TIGL_SUCCESS if no error occurred
+*   - TIGL_NOT_FOUND if no configuration was found for the given handle
+*   - TIGL_ERROR if some other error occurred
+*/
+TIGL_COMMON_EXPORT TiglReturnCode tiglConfigurationClearRebuiltComponents(TiglCPACSConfigurationHandle cpacsHandle);
+
+/**
+* @brief Builds the lofts of all geometric components of the configuration in advance.
+*
+* Normally, the lofts are built on demand, one after another. This function builds
+* the lofts in advance, such that subsequent exports or geometric queries
+* do not have to wait for them. Independent lofts (e.g. of different wings and
+* fuselages) are built concurrently, lofts derived from other lofts (e.g. segments
+* cut from the wing loft, component segments, structures) are built concurrently
+* in a later stage. The resulting geometry is identical to the
+* geometry built on demand. Components, whose loft cannot be built, are skipped
+* with a warning. The error is reported again, when their loft is requested.
+*
+* @param[in]  cpacsHandle Handle for the CPACS configuration
+* @param[in]  nThreads    Number of threads to use. If nThreads <= 0, all hardware threads are used.
+*
+* @return
+*   - TIGL_SUCCESS if no error occurred
+*   - TIGL_NOT_FOUND if no configuration was found for the given handle
+*   - TIGL_ERROR if some other error occurred
+*/
+TIGL_COMMON_EXPORT TiglReturnCode tiglConfigurationBuildAllLofts(TiglCPACSConfigurationHandle cpacsHandle, int nThreads);
+
+/**
+* @brief Enables the persistent loft cache in the given directory.
+*
+* If enabled, the lofts of all geometric components are stored as BRep files
+* in the cache directory and are loaded instead of rebuilt, when the same CPACS
+* file is opened again with the same TiGL version. The cache entries are
+* identified by a hash of the CPACS document and the component uid, hence
+* changed CPACS files will never load outdated geometry. After the geometry
+* of an opened configuration has been modified, the cache is not used for this
+* configuration anymore. Segment lofts, which are cut from the wing or fuselage
+* loft, are not stored. They are cut from the loaded parent loft instead, such
+* that they share their faces with it.
+*
+* The setting affects only configurations that are opened afterwards. The cache
+* directory is never cleaned up by TiGL.
+*
+* @param[in]  directory Path to the cache directory, which is created if required.
+*                       An empty string disables the cache (default).
+*
+* @return
+*   - TIGL_SUCCESS if no error occurred
+*   - TIGL_NULL_POINTER if directory is a null pointer
+*   - TIGL_OPEN_FAILED if the directory could not be created
+*   - TIGL_ERROR if some other error occurred
+*/
+TIGL_COMMON_EXPORT TiglReturnCode tiglSetLoftCacheDirectory(const char* directory);
+
+/**
+* @brief Sets a memory budget for the cached geometry of all opened configurations.
+*
+* TiGL caches the lofts of all geometric components and the results of intersections.
+* If the estimated memory of these caches exceeds the budget, the least recently
+* used entries are evicted, when the configuration is accessed the next time.
+* The least recently used entries of other configurations are released at the next
+* access of their own configuration, unless they are used before.
+* Evicted lofts are rebuilt on demand (or loaded from the loft disk cache, see
+* ::tiglSetLoftCacheDirectory). Entries, which have been used by the previous function
+* call on the configuration, are never evicted. Hence, the budget can be exceeded
+* temporarily.
+*
+* Evicted intersection results cannot be rebuilt from their intersection ID. Functions
+* using an evicted intersection ID return TIGL_NOT_FOUND. In this case, the intersection
+* has to be computed again, which returns the same ID.
+*
+* The memory is an estimate based on the size of the B-rep geometry and the triangulations.
+*
+* @param[in]  budgetBytes Memory budget in bytes. A budget of 0 disables the eviction (default).
+*
+* @return
+*   - TIGL_SUCCESS if no error occurred
+*   - TIGL_ERROR if budgetBytes is negative or some other error occurred
+*/
+TIGL_COMMON_EXPORT TiglReturnCode tiglSetCacheMemoryBudget(double budgetBytes);
+
+/**
+* @brief Returns the statistics of the cached lofts and intersection results of a configuration.
+*
+* @param[in]  cpacsHandle   Handle for the CPACS configuration
+* The counters are returned as double, which represents them exactly up to 2^53.
+*
+* @param[out] hits          Number of requests served from the cache
+* @param[out] misses        Number of requests, which had to build the cached geometry
+* @param[out] evictions     Number of entries evicted to meet the memory budget (see ::tiglSetCacheMemoryBudget)
+* @param[out] residentBytes Estimated memory of all cached entries in bytes
+*
+* @return
+*   - TIGL_SUCCESS if no error occurred
+*   - TIGL_NOT_FOUND if no configuration was found for the given handle
+*   - TIGL_NULL_POINTER if hits, misses, evictions or residentBytes is a null pointer
+*   - TIGL_ERROR if some other error occurred
+*/
+TIGL_COMMON_EXPORT TiglReturnCode tiglConfigurationGetCacheStatistics(TiglCPACSConfigurationHandle cpacsHandle,
+                                                                      double* hits, double* misses, double* evictions,
+                                                                      double* residentBytes);
+
+
 /**
 * @brief Returns the span of a wing. 
 *
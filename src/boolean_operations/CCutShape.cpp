@@ -28,6 +28,7 @@
 #include "CTrimShape.h"
 #include "CMergeShapes.h"
 #include "CNamedShape.h"
+#include "CTiglProfiler.h"
 
 #define USE_OWN_ALGO
 
@@ -89,6 +90,7 @@ void CCutShape::Perform()
            _resultshape.reset();
             return;
         }
+        tigl::CTiglScopedTimer timer("CCutShape", _source->Name());
 
         PrepareFiller();
 #ifdef USE_OWN_ALGO
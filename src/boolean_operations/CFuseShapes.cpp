@@ -23,13 +23,19 @@
 #include "CBooleanOperTools.h"
 #include "CTrimShape.h"
 #include "BRepSewingToBRepBuilderShapeAdapter.h"
+#include "CTiglProfiler.h"
 
 #include <cassert>
+#include <vector>
 
 #include <TopoDS.hxx>
 #include <TopoDS_Shape.hxx>
 #include <TopoDS_Solid.hxx>
+#include <TopoDS_Compound.hxx>
 #include <TopExp.hxx>
+#include <BRep_Builder.hxx>
+#include <Bnd_Box.hxx>
+#include <BRepBndLib.hxx>
 
 #include <BRepBuilderAPI_Sewing.hxx>
 #include <BRepBuilderAPI_MakeSolid.hxx>
@@ -46,8 +52,19 @@
 
 //#define DEBUG_BOP
 
+namespace
+{
+    PNamedShape MakeIntersectionShape(const TopoDS_Shape& intersection, const PNamedShape parent, const PNamedShape child)
+    {
+        PNamedShape intersectionShape(new CNamedShape(intersection, std::string("INT" + std::string(parent->Name()) + child->Name()).c_str()));
+        intersectionShape->SetShortName(std::string("INT" + std::string(parent->ShortName()) + child->ShortName()).c_str());
+        return intersectionShape;
+    }
+} // namespace
+
 CFuseShapes::CFuseShapes(const PNamedShape parent, const ListPNamedShape &childs)
-    : _resultshape()
+    : _runParallel(false)
+    , _resultshape()
 {
     Clear();
     _parent = parent;
@@ -90,11 +107,20 @@ const PNamedShape CFuseShapes::TrimmedParent()
 void CFuseShapes::Perform()
 {
     if (!_hasPerformed) {
+        tigl::CTiglScopedTimer timer("CFuseShapes", _parent ? _parent->Name() : "");
         DoFuse();
         _hasPerformed = true;
     }
 }
 
+void CFuseShapes::SetRunParallel(bool runParallel)
+{
+    if (runParallel != _runParallel) {
+        _hasPerformed = false;
+        _runParallel = runParallel;
+    }
+}
+
 void CFuseShapes::Clear()
 {
     _hasPerformed = false;
@@ -113,6 +139,7 @@ void CFuseShapes::DoFuse()
     BRepBuilderAPI_Sewing shellMaker;
 
     _trimmedChilds.clear();
+    _intersections.clear();
     ListPNamedShape::const_iterator childIter;
 
     TrimOperation childTrim  = EXCLUDE;
@@ -129,7 +156,7 @@ void CFuseShapes::DoFuse()
             _trimmedChilds.push_back(child);
         }
     }
-    else {
+    else if (!_runParallel || !DoParallelTrimming(parentTrim, childTrim)) {
         // trim the childs with the parent and vice versa
         _trimmedParent = _parent->DeepCopy();
         for (childIter = _childs.begin(); childIter != _childs.end(); ++childIter) {
@@ -161,9 +188,7 @@ void CFuseShapes::DoFuse()
             // calculate intersection
             // Todo: make a new BOP out of this
             TopoDS_Shape intersection = BRepAlgoAPI_Section(_trimmedParent->Shape(), child->Shape(), DSFill);
-            PNamedShape intersectionShape(new CNamedShape(intersection, std::string("INT" + std::string(_parent->Name()) + child->Name()).c_str()));
-            intersectionShape->SetShortName(std::string("INT" + std::string(_parent->ShortName()) + child->ShortName()).c_str());
-            _intersections.push_back(intersectionShape);
+            _intersections.push_back(MakeIntersectionShape(intersection, _parent, child));
 
 #ifdef DEBUG_BOP
             stop = clock();
@@ -235,3 +260,85 @@ void CFuseShapes::DoFuse()
 
     _resultshape = result;
 }
+
+/**
+ * Trims the parent and all children using a single pave filler, that is run in parallel.
+ *
+ * Children, whose bounding box does not intersect the parent's bounding box
+ * are not added to the pave filler. This is only possible, if the remaining children do
+ * not intersect each other, as they would be split at each other otherwise.
+ * In this case, false is returned and nothing is computed.
+ */
+bool CFuseShapes::DoParallelTrimming(TrimOperation parentTrim, TrimOperation childTrim)
+{
+    Bnd_Box parentBox;
+    BRepBndLib::Add(_parent->Shape(), parentBox);
+
+    std::vector<Bnd_Box> childBoxes(_childs.size());
+    std::vector<bool> touchesParent(_childs.size(), false);
+    ListPNamedShape touchingChilds;
+    for (size_t i = 0; i < _childs.size(); ++i) {
+        if (!_childs[i]) {
+            continue;
+        }
+        BRepBndLib::Add(_childs[i]->Shape(), childBoxes[i]);
+        touchesParent[i] = !parentBox.IsOut(childBoxes[i]);
+        if (touchesParent[i]) {
+            for (size_t j = 0; j < i; ++j) {
+                if (touchesParent[j] && !childBoxes[j].IsOut(childBoxes[i])) {
+                    return false;
+                }
+            }
+            touchingChilds.push_back(_childs[i]);
+        }
+    }
+
+    BOPAlgo_PaveFiller DSFill;
+    if (!touchingChilds.empty()) {
+#if OCC_VERSION_HEX >= VERSION_HEX_CODE(7,3,0)
+        TopTools_ListOfShape aLS;
+#else
+        BOPCol_ListOfShape aLS;
+#endif
+        aLS.Append(_parent->Shape());
+        for (ListPNamedShape::const_iterator childIter = touchingChilds.begin(); childIter != touchingChilds.end(); ++childIter) {
+            aLS.Append((*childIter)->Shape());
+        }
+        DSFill.SetArguments(aLS);
+        DSFill.SetRunParallel(Standard_True);
+        DSFill.Perform();
+    }
+
+    for (size_t i = 0; i < _childs.size(); ++i) {
+        const PNamedShape child = _childs[i];
+        if (!child) {
+            continue;
+        }
+
+        if (touchesParent[i]) {
+            TopoDS_Shape intersection = BRepAlgoAPI_Section(_parent->Shape(), child->Shape(), DSFill);
+            _intersections.push_back(MakeIntersectionShape(intersection, _parent, child));
+            PNamedShape trimmedChild = CTrimShape(child, _parent, DSFill, childTrim);
+            _trimmedChilds.push_back(trimmedChild);
+        }
+        else {
+            // No intersection, but the child is converted to a shell as in the serial trimming.
+            // Its own pave filler is cheap, as the shapes are disjoint.
+            TopoDS_Compound emptyIntersection;
+            BRep_Builder builder;
+            builder.MakeCompound(emptyIntersection);
+            _intersections.push_back(MakeIntersectionShape(emptyIntersection, _parent, child));
+            PNamedShape trimmedChild = CTrimShape(child, _parent, childTrim);
+            _trimmedChilds.push_back(trimmedChild);
+        }
+    }
+
+    if (touchingChilds.empty()) {
+        _trimmedParent = _parent->DeepCopy();
+    }
+    else {
+        _trimmedParent = CTrimShape(_parent, touchingChilds, DSFill, parentTrim);
+    }
+
+    return true;
+}
@@ -21,6 +21,7 @@
 
 #include "PNamedShape.h"
 #include "ListPNamedShape.h"
+#include "CTrimShape.h"
 #include "tigl_internal.h"
 
 /**
@@ -50,12 +51,19 @@ public:
 
     TIGL_EXPORT void Perform();
 
+    // If enabled, children not touching the parent are skipped using a bounding box check
+    // and all remaining children are intersected with the parent in a single, parallel
+    // pave filler run. The result is the same as in the serial mode. Disabled by default.
+    TIGL_EXPORT void SetRunParallel(bool runParallel);
+
 
 protected:
     void Clear();
     void DoFuse();
+    bool DoParallelTrimming(TrimOperation parentTrim, TrimOperation childTrim);
 
     bool _hasPerformed;
+    bool _runParallel;
 
     PNamedShape _resultshape, _parent, _trimmedParent;
     ListPNamedShape _childs, _trimmedChilds, _intersections;
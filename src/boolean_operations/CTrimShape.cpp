@@ -24,7 +24,9 @@
 #include "tiglcommonfunctions.h"
 #include "CTiglError.h"
 #include "CNamedShape.h"
+#include "CTiglProfiler.h"
 
+#include <atomic>
 #include <cassert>
 #include <string>
 
@@ -54,7 +56,7 @@
 namespace
 {
 
-    static unsigned int itrim = 0;
+    static std::atomic<unsigned int> itrim(0);
 
 
     // Writes shape and its central face points into brep file (for debugging purposes)
@@ -75,12 +77,40 @@ namespace
         }
 
         std::stringstream str;
-        str << "trim_" << itrim << "_" << name << ".brep";
+        str << "trim_" << itrim.load() << "_" << name << ".brep";
 
         BRepTools::Write(c, str.str().c_str());
     }
 
-    TopoDS_Shape GetFacesNotInShape(BRepBuilderAPI_MakeShape& bop, const TopoDS_Shape& originalShape, const TopoDS_Shape& splittedShape, const TopoDS_Shape& shapeToExInclude, TrimOperation op)
+    // Returns true, if a face with the central point p is kept after trimming with the tools
+    bool KeepFace(const gp_Pnt& p, const ListPNamedShape& tools, TrimOperation op)
+    {
+        for (ListPNamedShape::const_iterator it = tools.begin(); it != tools.end(); ++it) {
+            // check if point is in shapeToExclude
+            BRepClass3d_SolidClassifier classifier;
+            classifier.Load((*it)->Shape());
+            classifier.Perform(p, Precision::Confusion());
+
+            switch (op) {
+            case EXCLUDE:
+                if (classifier.State() == TopAbs_IN || classifier.State() == TopAbs_ON) {
+                    return false;
+                }
+                break;
+            case INCLUDE:
+                if (classifier.State() == TopAbs_IN) {
+                    return true;
+                }
+                break;
+            default:
+                printf("illegal operation\n");
+                return false;
+            }
+        }
+        return op == EXCLUDE;
+    }
+
+    TopoDS_Shape GetFacesNotInShape(BRepBuilderAPI_MakeShape& bop, const TopoDS_Shape& originalShape, const TopoDS_Shape& splittedShape, const ListPNamedShape& shapesToExInclude, TrimOperation op)
     {
 
         TopoDS_Compound compound;
@@ -99,25 +129,8 @@ namespace
                 TopoDS_Face splitface = TopoDS::Face(it.Value());
                 gp_Pnt p = GetCentralFacePoint(splitface);
 
-                // check if point is in shapeToExclude
-                BRepClass3d_SolidClassifier classifier;
-                classifier.Load(shapeToExInclude);
-                classifier.Perform(p, Precision::Confusion());
-
-
-                switch (op) {
-                case EXCLUDE:
-                    if (classifier.State() != TopAbs_IN && classifier.State() != TopAbs_ON) {
-                        compoundmaker.Add(compound, splitface);
-                    }
-                    break;
-                case INCLUDE:
-                    if (classifier.State() == TopAbs_IN) {
-                        compoundmaker.Add(compound, splitface);
-                    }
-                    break;
-                default:
-                    printf("illegal operation\n");
+                if (KeepFace(p, shapesToExInclude, op)) {
+                    compoundmaker.Add(compound, splitface);
                 }
             }
         }
@@ -133,25 +146,8 @@ namespace
                 const TopoDS_Face& originalFace = TopoDS::Face(originMap.FindKey(index));
                 gp_Pnt p = GetCentralFacePoint(originalFace);
 
-                // check if point is in shapeToExclude
-                BRepClass3d_SolidClassifier classifier;
-                classifier.Load(shapeToExInclude);
-                classifier.Perform(p, Precision::Confusion());
-
-
-                switch (op) {
-                case EXCLUDE:
-                    if (classifier.State() != TopAbs_IN && classifier.State() != TopAbs_ON) {
-                        compoundmaker.Add(compound, originalFace);
-                    }
-                    break;
-                case INCLUDE:
-                    if (classifier.State() == TopAbs_IN) {
-                        compoundmaker.Add(compound, originalFace);
-                    }
-                    break;
-                default:
-                    printf("illegal operation\n");
+                if (KeepFace(p, shapesToExInclude, op)) {
+                    compoundmaker.Add(compound, originalFace);
                 }
             }
         }
@@ -162,14 +158,22 @@ namespace
 } // namespace
 
 CTrimShape::CTrimShape(const PNamedShape shape, const PNamedShape trimmingTool, TrimOperation op)
-    : _operation(op), _resultshape(), _tool(trimmingTool), _source(shape), _dsfiller(NULL)
+    : _operation(op), _resultshape(), _source(shape), _tools(1, trimmingTool), _dsfiller(NULL)
 {
     _fillerAllocated = false;
     _hasPerformed = false;
 }
 
 CTrimShape::CTrimShape(const PNamedShape shape, const PNamedShape trimmingTool, const BOPAlgo_PaveFiller & filler, TrimOperation op)
-    : _operation(op), _resultshape(), _tool(trimmingTool), _source(shape)
+    : _operation(op), _resultshape(), _source(shape), _tools(1, trimmingTool)
+{
+    _fillerAllocated = false;
+    _hasPerformed = false;
+    _dsfiller = (BOPAlgo_PaveFiller*) &filler;
+}
+
+CTrimShape::CTrimShape(const PNamedShape shape, const ListPNamedShape& trimmingTools, const BOPAlgo_PaveFiller & filler, TrimOperation op)
+    : _operation(op), _resultshape(), _source(shape), _tools(trimmingTools)
 {
     _fillerAllocated = false;
     _hasPerformed = false;
@@ -191,7 +195,7 @@ CTrimShape::operator PNamedShape()
 
 void CTrimShape::PrepareFiller()
 {
-    if (!_tool || !_source) {
+    if (_tools.empty() || !_source) {
         return;
     }
 
@@ -201,7 +205,9 @@ void CTrimShape::PrepareFiller()
 #else
         BOPCol_ListOfShape aLS;
 #endif
-        aLS.Append(_tool->Shape());
+        for (ListPNamedShape::const_iterator it = _tools.begin(); it != _tools.end(); ++it) {
+            aLS.Append((*it)->Shape());
+        }
         aLS.Append(_source->Shape());
 
         _dsfiller = new BOPAlgo_PaveFiller;
@@ -218,33 +224,45 @@ void CTrimShape::Perform()
         if (!_source) {
             throw tigl::CTiglError("Null pointer for source argument in CTrimShape", TIGL_NULL_POINTER);
         }
+        tigl::CTiglScopedTimer timer("CTrimShape", _source->Name());
 
-        if (!_tool) {
+        if (_tools.empty()) {
             throw tigl::CTiglError("Null pointer for tool argument in CTrimShape", TIGL_NULL_POINTER);
         }
+        for (ListPNamedShape::const_iterator it = _tools.begin(); it != _tools.end(); ++it) {
+            if (!*it) {
+                throw tigl::CTiglError("Null pointer for tool argument in CTrimShape", TIGL_NULL_POINTER);
+            }
+        }
 
         bool debug = (getenv("TIGL_DEBUG_BOP") != NULL);
 
         if (debug) {
             WriteDebugShape(_source->Shape(), "source");
-            WriteDebugShape(_tool->Shape(), "tool");
+            for (ListPNamedShape::const_iterator it = _tools.begin(); it != _tools.end(); ++it) {
+                WriteDebugShape((*it)->Shape(), "tool");
+            }
         }
 
         PrepareFiller();
         GEOMAlgo_Splitter splitter;
         BOPBuilderShapeToBRepBuilderShapeAdapter splitAdapter(splitter);
         splitter.AddArgument(_source->Shape());
-        splitter.AddTool(_tool->Shape());
+        for (ListPNamedShape::const_iterator it = _tools.begin(); it != _tools.end(); ++it) {
+            splitter.AddTool((*it)->Shape());
+        }
         splitter.PerformWithFiller(*_dsfiller);
 
         if (debug) {
             WriteDebugShape(splitter.Shape(), "split");
         }
 
-        TopoDS_Shape trimmedShape = GetFacesNotInShape(splitAdapter, _source->Shape(), splitter.Shape(), _tool->Shape(), _operation);
+        TopoDS_Shape trimmedShape = GetFacesNotInShape(splitAdapter, _source->Shape(), splitter.Shape(), _tools, _operation);
         _resultshape = PNamedShape(new CNamedShape(trimmedShape, _source->Name()));
         CBooleanOperTools::MapFaceNamesAfterBOP(splitAdapter, _source, _resultshape);
-        CBooleanOperTools::MapFaceNamesAfterBOP(splitAdapter, _tool,   _resultshape);
+        for (ListPNamedShape::const_iterator it = _tools.begin(); it != _tools.end(); ++it) {
+            CBooleanOperTools::MapFaceNamesAfterBOP(splitAdapter, *it, _resultshape);
+        }
 
         // create shell
         _resultshape = CBooleanOperTools::Shellify(_resultshape);
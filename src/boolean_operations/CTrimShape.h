@@ -20,6 +20,7 @@
 #define CTRIMSHAPE_H
 
 #include "PNamedShape.h"
+#include "ListPNamedShape.h"
 #include "tigl_internal.h"
 
 class BOPAlgo_PaveFiller;
@@ -36,6 +37,11 @@ public:
     // the trimming tool must be a solid!
     TIGL_EXPORT CTrimShape(const PNamedShape shape, const PNamedShape trimmingTool, TrimOperation = EXCLUDE);
     TIGL_EXPORT CTrimShape(const PNamedShape shape, const PNamedShape trimmingTool, const BOPAlgo_PaveFiller&, TrimOperation = EXCLUDE);
+
+    // Trims the shape with several solids at once. With EXCLUDE, all faces inside any
+    // of the tools are removed. With INCLUDE, all faces inside any of the tools are kept.
+    // The filler must contain the shape and all tools as arguments.
+    TIGL_EXPORT CTrimShape(const PNamedShape shape, const ListPNamedShape& trimmingTools, const BOPAlgo_PaveFiller&, TrimOperation = EXCLUDE);
     TIGL_EXPORT virtual ~CTrimShape();
 
     TIGL_EXPORT operator PNamedShape ();
@@ -49,7 +55,8 @@ protected:
     bool _hasPerformed;
     TrimOperation _operation;
 
-    PNamedShape _resultshape, _tool, _source;
+    PNamedShape _resultshape, _source;
+    ListPNamedShape _tools;
     BOPAlgo_PaveFiller* _dsfiller;
     bool _fillerAllocated;
 
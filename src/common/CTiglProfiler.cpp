@@ -0,0 +1,281 @@
+/*
+* Copyright (C) 2019 German Aerospace Center (DLR/SC)
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*/
+
+#include "CTiglProfiler.h"
+
+#include <algorithm>
+#include <cstdio>
+#include <memory>
+#include <sstream>
+
+#include <boost/thread/lock_guard.hpp>
+
+namespace tigl
+{
+
+struct ProfileNode
+{
+    ProfileNode(const std::string& operation, const std::string& uid, ProfileNode* parent)
+        : operation(operation)
+        , uid(uid)
+        , parent(parent)
+        , count(0)
+        , totalNs(0)
+    {
+    }
+
+    std::string operation;
+    std::string uid;
+    ProfileNode* parent;
+    unsigned long long count;
+    long long totalNs;
+
+    // nodes are never deleted before the profiler, as running timers may still refer to them
+    std::vector<std::unique_ptr<ProfileNode> > children;
+};
+
+namespace
+{
+
+thread_local ProfileNode* currentNode = NULL;
+
+int currentThreadId()
+{
+    static std::atomic<int> nextId(1);
+    thread_local int id = nextId++;
+    return id;
+}
+
+void resetNode(ProfileNode& node)
+{
+    node.count   = 0;
+    node.totalNs = 0;
+    for (size_t i = 0; i < node.children.size(); ++i) {
+        resetNode(*node.children[i]);
+    }
+}
+
+std::string jsonString(const std::string& value)
+{
+    std::string result = "\"";
+    for (std::string::const_iterator it = value.begin(); it != value.end(); ++it) {
+        const unsigned char c = static_cast<unsigned char>(*it);
+        if (c == '"' || c == '\\') {
+            result += '\\';
+            result += static_cast<char>(c);
+        }
+        else if (c < 0x20) {
+            char buffer[8];
+            std::snprintf(buffer, sizeof(buffer), "\\u%04x", c);
+            result += buffer;
+        }
+        else {
+            result += static_cast<char>(c);
+        }
+    }
+    return result + "\"";
+}
+
+std::string jsonSeconds(long long ns)
+{
+    char buffer[32];
+    std::snprintf(buffer, sizeof(buffer), "%.9g", static_cast<double>(ns) * 1e-9);
+    return buffer;
+}
+
+bool isSlower(const ProfileNode* a, const ProfileNode* b)
+{
+    return a->totalNs > b->totalNs;
+}
+
+void writeNodeJson(const ProfileNode& node, std::ostream& out, int indent)
+{
+    // the root is not timed itself, it sums up the top level timers
+    const bool isRoot = node.parent == NULL;
+
+    const std::string pad(static_cast<size_t>(indent), ' ');
+
+    std::vector<const ProfileNode*> children;
+    long long childrenNs = 0;
+    for (size_t i = 0; i < node.children.size(); ++i) {
+        if (node.children[i]->count > 0) {
+            children.push_back(node.children[i].get());
+            childrenNs += node.children[i]->totalNs;
+        }
+    }
+    std::stable_sort(children.begin(), children.end(), isSlower);
+
+    // children running in parallel threads may take longer than their parent
+    const long long totalNs = isRoot ? childrenNs : node.totalNs;
+    const long long selfNs  = std::max(totalNs - childrenNs, 0LL);
+
+    out << pad << "{\n"
+        << pad << "  \"operation\": " << jsonString(node.operation) << ",\n"
+        << pad << "  \"uid\": " << jsonString(node.uid) << ",\n"
+        << pad << "  \"count\": " << (isRoot ? 1ULL : node.count) << ",\n"
+        << pad << "  \"total_time_s\": " << jsonSeconds(totalNs) << ",\n"
+        << pad << "  \"self_time_s\": " << jsonSeconds(selfNs) << ",\n"
+        << pad << "  \"children\": [";
+    for (size_t i = 0; i < children.size(); ++i) {
+        out << (i == 0 ? "\n" : ",\n");
+        writeNodeJson(*children[i], out, indent + 4);
+    }
+    out << (children.empty() ? "]\n" : "\n" + pad + "  ]\n") << pad << "}";
+}
+
+} // namespace
+
+std::atomic<bool> CTiglProfiler::s_enabled(false);
+
+CTiglProfiler::CTiglProfiler()
+    : m_root(new ProfileNode("total", "", NULL))
+    , m_droppedEvents(0)
+    , m_epoch(std::chrono::steady_clock::now())
+{
+}
+
+CTiglProfiler::~CTiglProfiler()
+{
+    delete m_root;
+}
+
+CTiglProfiler& CTiglProfiler::Instance()
+{
+    static CTiglProfiler profiler;
+    return profiler;
+}
+
+void CTiglProfiler::SetEnabled(bool enabled)
+{
+    s_enabled.store(enabled);
+}
+
+void CTiglProfiler::Reset()
+{
+    boost::lock_guard<boost::mutex> guard(m_mutex);
+    resetNode(*m_root);
+    m_events.clear();
+    m_droppedEvents = 0;
+    m_epoch = std::chrono::steady_clock::now();
+}
+
+ProfileNode* CTiglProfiler::CurrentNode()
+{
+    return currentNode;
+}
+
+void CTiglProfiler::SetCurrentNode(ProfileNode* node)
+{
+    currentNode = node;
+}
+
+ProfileNode* CTiglProfiler::EnterNode(const std::string& operation, const std::string& uid)
+{
+    boost::lock_guard<boost::mutex> guard(m_mutex);
+
+    ProfileNode* parent = currentNode ? currentNode : m_root;
+    for (size_t i = 0; i < parent->children.size(); ++i) {
+        ProfileNode* child = parent->children[i].get();
+        if (child->operation == operation && child->uid == uid) {
+            return child;
+        }
+    }
+    parent->children.push_back(std::unique_ptr<ProfileNode>(new ProfileNode(operation, uid, parent)));
+    return parent->children.back().get();
+}
+
+void CTiglProfiler::LeaveNode(ProfileNode* node, std::chrono::steady_clock::time_point start,
+                              std::chrono::steady_clock::time_point stop)
+{
+    using std::chrono::duration_cast;
+
+    const long long durationNs = duration_cast<std::chrono::nanoseconds>(stop - start).count();
+    const int threadId = currentThreadId();
+
+    boost::lock_guard<boost::mutex> guard(m_mutex);
+    node->count++;
+    node->totalNs += durationNs;
+
+    if (m_events.size() < MaxTraceEvents) {
+        TraceEvent event;
+        event.node       = node;
+        event.startUs    = duration_cast<std::chrono::microseconds>(start - m_epoch).count();
+        event.durationUs = duration_cast<std::chrono::microseconds>(stop - start).count();
+        event.threadId   = threadId;
+        m_events.push_back(event);
+    }
+    else {
+        m_droppedEvents++;
+    }
+}
+
+std::string CTiglProfiler::JsonReport() const
+{
+    boost::lock_guard<boost::mutex> guard(m_mutex);
+
+    std::ostringstream out;
+    writeNodeJson(*m_root, out, 0);
+    out << "\n";
+    return out.str();
+}
+
+std::string CTiglProfiler::ChromeTraceReport() const
+{
+    boost::lock_guard<boost::mutex> guard(m_mutex);
+
+    std::ostringstream out;
+    out << "{\"traceEvents\": [";
+    for (size_t i = 0; i < m_events.size(); ++i) {
+        const TraceEvent& event = m_events[i];
+        out << (i == 0 ? "\n" : ",\n")
+            << "  {\"name\": " << jsonString(event.node->operation)
+            << ", \"cat\": \"tigl\", \"ph\": \"X\""
+            << ", \"ts\": " << event.startUs
+            << ", \"dur\": " << event.durationUs
+            << ", \"pid\": 1, \"tid\": " << event.threadId
+            << ", \"args\": {\"uid\": " << jsonString(event.node->uid) << "}}";
+    }
+    out << "\n],\n"
+        << "\"displayTimeUnit\": \"ms\",\n"
+        << "\"otherData\": {\"droppedEvents\": " << m_droppedEvents << "}}\n";
+    return out.str();
+}
+
+void CTiglScopedTimer::Start(const std::string& operation, const std::string& uid)
+{
+    if (m_node) {
+        Stop();
+    }
+    CTiglProfiler& profiler = CTiglProfiler::Instance();
+    m_parent = CTiglProfiler::CurrentNode();
+    m_node   = profiler.EnterNode(operation, uid);
+    CTiglProfiler::SetCurrentNode(m_node);
+    m_start  = std::chrono::steady_clock::now();
+}
+
+void CTiglScopedTimer::Stop()
+{
+    if (!m_node) {
+        return;
+    }
+    const std::chrono::steady_clock::time_point stop = std::chrono::steady_clock::now();
+    CTiglProfiler::Instance().LeaveNode(m_node, m_start, stop);
+    CTiglProfiler::SetCurrentNode(m_parent);
+    m_node   = NULL;
+    m_parent = NULL;
+}
+
+} // namespace tigl
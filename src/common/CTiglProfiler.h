@@ -0,0 +1,185 @@
+/*
+* Copyright (C) 2019 German Aerospace Center (DLR/SC)
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*/
+/**
+* @file
+* @brief Hierarchical profiling of cache builds, boolean operations, meshing and exports
+*/
+
+#ifndef CTIGLPROFILER_H
+#define CTIGLPROFILER_H
+
+#include "tigl_internal.h"
+
+#include <atomic>
+#include <chrono>
+#include <string>
+#include <vector>
+
+#include <boost/thread/mutex.hpp>
+
+namespace tigl
+{
+
+struct ProfileNode;
+
+/**
+ * @brief Collects the timings of all CTiglScopedTimer instances
+ *
+ * The timings are aggregated into a tree. Each node is identified by an
+ * operation and a component uid and is attached to the node of the timer,
+ * that was running in the same thread when the timer was started. Timers
+ * started in the threads of ParallelFor are attached to the node of the
+ * calling thread.
+ *
+ * Profiling is disabled by default. A disabled profiler costs a single
+ * relaxed atomic load per timer.
+ */
+class CTiglProfiler
+{
+public:
+    TIGL_EXPORT static CTiglProfiler& Instance();
+
+    static bool IsEnabled()
+    {
+        return s_enabled.load(std::memory_order_relaxed);
+    }
+
+    TIGL_EXPORT void SetEnabled(bool enabled);
+
+    /// Removes all timings collected so far
+    TIGL_EXPORT void Reset();
+
+    /// Returns the aggregated timing tree as JSON
+    TIGL_EXPORT std::string JsonReport() const;
+
+    /// Returns all recorded timers in the Chrome trace event format (chrome://tracing)
+    TIGL_EXPORT std::string ChromeTraceReport() const;
+
+    /// Node new timers of the calling thread are attached to, NULL for the root
+    TIGL_EXPORT static ProfileNode* CurrentNode();
+    TIGL_EXPORT static void SetCurrentNode(ProfileNode* node);
+
+    // used by CTiglScopedTimer
+    ProfileNode* EnterNode(const std::string& operation, const std::string& uid);
+    void LeaveNode(ProfileNode* node, std::chrono::steady_clock::time_point start,
+                   std::chrono::steady_clock::time_point stop);
+
+private:
+    struct TraceEvent
+    {
+        const ProfileNode* node;
+        long long startUs;
+        long long durationUs;
+        int threadId;
+    };
+
+    CTiglProfiler();
+    ~CTiglProfiler();
+
+    TIGL_EXPORT static std::atomic<bool> s_enabled;
+
+    // limits the memory of the trace events, further events are counted only
+    static const size_t MaxTraceEvents = 1000000;
+
+    mutable boost::mutex m_mutex;
+    ProfileNode* m_root;
+    std::vector<TraceEvent> m_events;
+    size_t m_droppedEvents;
+    std::chrono::steady_clock::time_point m_epoch;
+};
+
+/**
+ * @brief Measures the time of the enclosing scope, if profiling is enabled
+ *
+ * Usage:
+ *     CTiglScopedTimer timer("CFuseShapes");
+ *
+ * If the uid is expensive to compute, default construct the timer and call
+ * Start only if CTiglProfiler::IsEnabled().
+ */
+class CTiglScopedTimer
+{
+public:
+    CTiglScopedTimer()
+        : m_node(NULL)
+        , m_parent(NULL)
+    {
+    }
+
+    explicit CTiglScopedTimer(const char* operation)
+        : m_node(NULL)
+        , m_parent(NULL)
+    {
+        if (CTiglProfiler::IsEnabled()) {
+            Start(operation, std::string());
+        }
+    }
+
+    CTiglScopedTimer(const char* operation, const std::string& uid)
+        : m_node(NULL)
+        , m_parent(NULL)
+    {
+        if (CTiglProfiler::IsEnabled()) {
+            Start(operation, uid);
+        }
+    }
+
+    ~CTiglScopedTimer()
+    {
+        if (m_node) {
+            Stop();
+        }
+    }
+
+    TIGL_EXPORT void Start(const std::string& operation, const std::string& uid);
+
+    /// Stops the timer before the end of the scope
+    TIGL_EXPORT void Stop();
+
+private:
+    CTiglScopedTimer(const CTiglScopedTimer&);
+    CTiglScopedTimer& operator=(const CTiglScopedTimer&);
+
+    ProfileNode* m_node;
+    ProfileNode* m_parent;
+    std::chrono::steady_clock::time_point m_start;
+};
+
+/// Attaches the timers of a worker thread to the node of the thread that started it
+class CTiglProfilerNodeGuard
+{
+public:
+    explicit CTiglProfilerNodeGuard(ProfileNode* node)
+        : m_previous(CTiglProfiler::CurrentNode())
+    {
+        CTiglProfiler::SetCurrentNode(node);
+    }
+
+    ~CTiglProfilerNodeGuard()
+    {
+        CTiglProfiler::SetCurrentNode(m_previous);
+    }
+
+private:
+    CTiglProfilerNodeGuard(const CTiglProfilerNodeGuard&);
+    CTiglProfilerNodeGuard& operator=(const CTiglProfilerNodeGuard&);
+
+    ProfileNode* m_previous;
+};
+
+} // namespace tigl
+
+#endif // CTIGLPROFILER_H
@@ -109,6 +109,7 @@
 #include <limits>
 
 #include "Debugging.h"
+#include "CTiglProfiler.h"
 
 namespace
 {
@@ -1248,11 +1249,27 @@ std::vector<TopoDS_Shape> GetSubShapes(const TopoDS_Shape& shape, TopAbs_ShapeEn
     return result;
 }
 
+namespace
+{
+    // Configures the boolean operation to run in parallel. In the non destructive mode,
+    // the arguments are not modified, i.e. the same shape can be used in concurrent booleans.
+    template <typename BooleanAlgo>
+    void setupBooleanAlgo(BooleanAlgo& algo)
+    {
+        algo.SetRunParallel(Standard_True);
+#if OCC_VERSION_HEX >= VERSION_HEX_CODE(7,2,0)
+        algo.SetNonDestructive(Standard_True);
+#endif
+    }
+}
+
 TopoDS_Shape CutShapes(const TopoDS_Shape& shape1, const TopoDS_Shape& shape2)
 {
+    tigl::CTiglScopedTimer timer("CutShapes");
     BRepAlgoAPI_Section cutter(shape1, shape2, Standard_False);
     cutter.ComputePCurveOn1(Standard_True);
     cutter.Approximation(Standard_True);
+    setupBooleanAlgo(cutter);
     cutter.Build();
     if (!cutter.IsDone()) {
         LOG(ERROR) << "Error cutting shapes in method CutShapes!";
@@ -1261,8 +1278,98 @@ TopoDS_Shape CutShapes(const TopoDS_Shape& shape1, const TopoDS_Shape& shape2)
     return cutter.Shape();
 }
 
+namespace
+{
+    // Intersects all faces with the shape in a single boolean operation and assigns the
+    // section edges to the faces they originate from. The pcurves of the section edges
+    // are computed on the faces, if facesFirst is true, and on the shape otherwise.
+    std::vector<TopoDS_Shape> CutShapeAndFaces(const std::vector<TopoDS_Shape>& faces, const TopoDS_Shape& shape, bool facesFirst)
+    {
+        std::vector<TopoDS_Shape> result(faces.size());
+        if (faces.size() == 1) {
+            result[0] = facesFirst ? CutShapes(faces[0], shape) : CutShapes(shape, faces[0]);
+            return result;
+        }
+
+        BRep_Builder builder;
+        TopoDS_Compound faceCompound;
+        builder.MakeCompound(faceCompound);
+        TopTools_IndexedMapOfShape faceMap;
+        for (size_t i = 0; i < faces.size(); ++i) {
+            builder.Add(faceCompound, faces[i]);
+            faceMap.Add(faces[i]);
+        }
+
+        std::vector<TopoDS_Compound> edges(faces.size());
+        for (size_t i = 0; i < faces.size(); ++i) {
+            builder.MakeCompound(edges[i]);
+        }
+
+        // intersect all faces at once and assign the section edges to the faces they originate from
+        bool allAssigned = faceMap.Extent() == static_cast<int>(faces.size());
+        if (allAssigned) {
+            BRepAlgoAPI_Section cutter(facesFirst ? TopoDS_Shape(faceCompound) : shape,
+                                       facesFirst ? shape : TopoDS_Shape(faceCompound),
+                                       Standard_False);
+            cutter.ComputePCurveOn1(Standard_True);
+            cutter.Approximation(Standard_True);
+            setupBooleanAlgo(cutter);
+            cutter.Build();
+            if (!cutter.IsDone()) {
+                LOG(ERROR) << "Error cutting shapes in method CutShapesPerFace!";
+                throw tigl::CTiglError("Error cutting shapes in method CutShapesPerFace!");
+            }
+
+            for (TopExp_Explorer exp(cutter.Shape(), TopAbs_EDGE); exp.More() && allAssigned; exp.Next()) {
+                TopoDS_Shape face;
+                int index = 0;
+                const Standard_Boolean hasAncestor = facesFirst
+                        ? cutter.HasAncestorFaceOn1(exp.Current(), face)
+                        : cutter.HasAncestorFaceOn2(exp.Current(), face);
+                if (hasAncestor) {
+                    index = faceMap.FindIndex(face);
+                }
+                if (index > 0) {
+                    builder.Add(edges[index - 1], exp.Current());
+                }
+                else {
+                    allAssigned = false;
+                }
+            }
+        }
+
+        // Edges coinciding with existing edges have no ancestor face. In this case
+        // and for duplicate faces, each face is cut separately.
+        if (!allAssigned) {
+            LOG(INFO) << "Cannot assign section edges to the cut faces. Cutting each face separately.";
+            for (size_t i = 0; i < faces.size(); ++i) {
+                result[i] = facesFirst ? CutShapes(faces[i], shape) : CutShapes(shape, faces[i]);
+            }
+            return result;
+        }
+
+        for (size_t i = 0; i < faces.size(); ++i) {
+            result[i] = edges[i];
+        }
+        return result;
+    }
+}
+
+std::vector<TopoDS_Shape> CutShapesPerFace(const std::vector<TopoDS_Shape>& faces, const TopoDS_Shape& shape)
+{
+    tigl::CTiglScopedTimer timer("CutShapesPerFace");
+    return CutShapeAndFaces(faces, shape, true);
+}
+
+std::vector<TopoDS_Shape> CutShapesPerFace(const TopoDS_Shape& shape, const std::vector<TopoDS_Shape>& faces)
+{
+    tigl::CTiglScopedTimer timer("CutShapesPerFace");
+    return CutShapeAndFaces(faces, shape, false);
+}
+
 TopoDS_Shape SplitShape(const TopoDS_Shape& src, const TopoDS_Shape& tool)
 {
+    tigl::CTiglScopedTimer timer("SplitShape");
     double fuzzyValue = Precision::Confusion();
 
     const int c_tries = 3;
@@ -1270,6 +1377,7 @@ TopoDS_Shape SplitShape(const TopoDS_Shape& src, const TopoDS_Shape& tool)
         GEOMAlgo_Splitter splitter;
         splitter.AddArgument(src);
         splitter.AddTool(tool);
+        setupBooleanAlgo(splitter);
 #if OCC_VERSION_HEX >= VERSION_HEX_CODE(6,9,0)
         splitter.SetFuzzyValue(fuzzyValue);
 #endif
@@ -1600,10 +1708,13 @@ TopoDS_Shape TransformedShape(const tigl::CTiglRelativelyPositionedComponent& co
 
 TopoDS_Shape GetFacesByName(const PNamedShape shape, const std::string &name)
 {
+    TopTools_IndexedMapOfShape faceMap;
+    TopExp::MapShapes(shape->Shape(), TopAbs_FACE, faceMap);
+
     std::vector<TopoDS_Face> faces;
-    for (int i = 0; i < static_cast<int>(shape->GetFaceCount()); i++) {
+    for (int i = 0; i < static_cast<int>(shape->GetFaceCount()) && i < faceMap.Extent(); i++) {
         if (shape->GetFaceTraits(i).Name() == name) {
-            faces.push_back(GetFace(shape->Shape(), i));
+            faces.push_back(TopoDS::Face(faceMap(i + 1)));
         }
     }
     
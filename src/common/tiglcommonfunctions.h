@@ -224,6 +224,16 @@ TIGL_EXPORT std::vector<TopoDS_Shape> GetSubShapes(const TopoDS_Shape& shape, To
 // Throws an exception in case the interesection failed
 TIGL_EXPORT TopoDS_Shape CutShapes(const TopoDS_Shape& shape1, const TopoDS_Shape& shape2);
 
+// Cuts each of the faces with the shape and returns a compound of the intersection edges per face.
+// All faces are intersected in a single, parallel boolean operation. The result is equivalent
+// to calling CutShapes(faces[i], shape) for each face.
+// Throws an exception in case the interesection failed
+TIGL_EXPORT std::vector<TopoDS_Shape> CutShapesPerFace(const std::vector<TopoDS_Shape>& faces, const TopoDS_Shape& shape);
+
+// Same as above, but equivalent to calling CutShapes(shape, faces[i]) for each face,
+// i.e. the pcurves of the intersection edges are computed on the shape instead of the faces.
+TIGL_EXPORT std::vector<TopoDS_Shape> CutShapesPerFace(const TopoDS_Shape& shape, const std::vector<TopoDS_Shape>& faces);
+
 // Helper for splitting a shape by another shape
 TIGL_EXPORT TopoDS_Shape SplitShape(const TopoDS_Shape& src, const TopoDS_Shape& tool);
 
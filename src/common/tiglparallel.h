@@ -0,0 +1,150 @@
+/*
+* Copyright (C) 2019 German Aerospace Center (DLR/SC)
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*/
+
+#ifndef TIGLPARALLEL_H
+#define TIGLPARALLEL_H
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <exception>
+#include <vector>
+
+#include <boost/thread/thread.hpp>
+
+#include "CTiglProfiler.h"
+
+namespace tigl
+{
+
+/// Returns the number of hardware threads, at least 1
+inline int GetHardwareThreadCount()
+{
+    unsigned int n = boost::thread::hardware_concurrency();
+    return n > 0 ? static_cast<int>(n) : 1;
+}
+
+/**
+ * @brief Calls func(i) for every i in [0, count) using up to nThreads threads
+ *
+ * The index range is split into contiguous blocks, one block per thread.
+ * If nThreads <= 0, the number of hardware threads is used. If only one
+ * thread is requested, func is called in the calling thread.
+ *
+ * func must be safe to call concurrently for different indices. If func throws,
+ * the first exception (in index order of the blocks) is rethrown in the calling
+ * thread after all threads have finished. Profiling timers of the threads are
+ * attached to the current timer of the calling thread.
+ */
+template <typename Func>
+void ParallelFor(size_t count, Func func, int nThreads = 0)
+{
+    if (nThreads <= 0) {
+        nThreads = GetHardwareThreadCount();
+    }
+
+    const size_t nBlocks = std::min(static_cast<size_t>(nThreads), count);
+    if (nBlocks <= 1) {
+        for (size_t i = 0; i < count; ++i) {
+            func(i);
+        }
+        return;
+    }
+
+    std::vector<std::exception_ptr> errors(nBlocks);
+    ProfileNode* profileNode = CTiglProfiler::CurrentNode();
+    boost::thread_group threads;
+
+    const size_t blockSize = count / nBlocks;
+    const size_t remainder = count % nBlocks;
+    size_t begin = 0;
+    for (size_t iblock = 0; iblock < nBlocks; ++iblock) {
+        const size_t end = begin + blockSize + (iblock < remainder ? 1 : 0);
+        std::exception_ptr& error = errors[iblock];
+        threads.create_thread([&func, &error, profileNode, begin, end]() {
+            CTiglProfilerNodeGuard profileGuard(profileNode);
+            try {
+                for (size_t i = begin; i < end; ++i) {
+                    func(i);
+                }
+            }
+            catch (...) {
+                error = std::current_exception();
+            }
+        });
+        begin = end;
+    }
+    threads.join_all();
+
+    for (size_t iblock = 0; iblock < nBlocks; ++iblock) {
+        if (errors[iblock]) {
+            std::rethrow_exception(errors[iblock]);
+        }
+    }
+}
+
+/**
+ * @brief Calls func(i) for every i in [0, count) using up to nThreads threads
+ *
+ * In contrast to ParallelFor, each thread fetches the next unprocessed index.
+ * This balances the load, if the runtime of func strongly varies between indices.
+ * All indices are processed, even if func throws. Afterwards, the exception
+ * of the smallest index is rethrown in the calling thread.
+ */
+template <typename Func>
+void ParallelForDynamic(size_t count, Func func, int nThreads = 0)
+{
+    if (nThreads <= 0) {
+        nThreads = GetHardwareThreadCount();
+    }
+
+    std::vector<std::exception_ptr> errors(count);
+    std::atomic<size_t> next(0);
+    ProfileNode* profileNode = CTiglProfiler::CurrentNode();
+    auto worker = [&func, &errors, &next, profileNode, count]() {
+        CTiglProfilerNodeGuard profileGuard(profileNode);
+        for (size_t i = next++; i < count; i = next++) {
+            try {
+                func(i);
+            }
+            catch (...) {
+                errors[i] = std::current_exception();
+            }
+        }
+    };
+
+    const size_t nWorkers = std::min(static_cast<size_t>(nThreads), count);
+    if (nWorkers <= 1) {
+        worker();
+    }
+    else {
+        boost::thread_group threads;
+        for (size_t iworker = 0; iworker < nWorkers; ++iworker) {
+            threads.create_thread(worker);
+        }
+        threads.join_all();
+    }
+
+    for (size_t i = 0; i < count; ++i) {
+        if (errors[i]) {
+            std::rethrow_exception(errors[i]);
+        }
+    }
+}
+
+} // namespace tigl
+
+#endif // TIGLPARALLEL_H
@@ -45,7 +45,16 @@
 #include <Bnd_Box.hxx>
 #include "CTiglFusePlane.h"
 #include "CNamedShape.h"
+#include "CTiglLoftDiskCache.h"
+#include "CTiglSolidClassifier.h"
+#include "CCPACSWingProfile.h"
+#include "CCPACSFuselageProfile.h"
+#include "tiglparallel.h"
+#include "CTiglProfiler.h"
 #include "generated/TixiHelper.h"
+#include "tigl_version.h"
+
+#include <Standard_Failure.hxx>
 
 #include <cfloat>
 #include <limits>
@@ -56,12 +65,16 @@ namespace tigl
 // Constructor
 CCPACSConfiguration::CCPACSConfiguration(TixiDocumentHandle tixiHandle)
     : tixiDocumentHandle(tixiHandle) , acSystems(this)
+    , cacheAccounting(new CTiglCacheAccounting())
 {
+    shapeCache.SetAccounting(cacheAccounting);
 }
 
 // Destructor
 CCPACSConfiguration::~CCPACSConfiguration()
 {
+    // the eviction of the classifiers refers to this configuration
+    cacheAccounting->RemovePrefix("solidClassifier:");
 }
 
 // Invalidates the internal state of the configuration and forces
@@ -79,6 +92,159 @@ void CCPACSConfiguration::Invalidate()
     }
     aircraftFuser.reset();
     shapeCache.Clear();
+    solidClassifiers.clear();
+    cacheAccounting->RemovePrefix("solidClassifier:");
+    if (loftCacheContext) {
+        loftCacheContext->valid = false;
+    }
+}
+
+// Invalidates the fused aircraft, but keeps the lofts of all components
+void CCPACSConfiguration::InvalidateFusedAircraft()
+{
+    aircraftFuser.reset();
+
+    // the geometry does not match the document anymore
+    if (loftCacheContext) {
+        loftCacheContext->valid = false;
+    }
+}
+
+// Returns the uids of all components, whose loft has been (re)built since
+// the configuration has been read or since the last call of ClearRebuiltComponents
+std::vector<std::string> CCPACSConfiguration::GetRebuiltComponents() const
+{
+    std::vector<std::string> rebuiltComponents;
+    const ShapeContainerType& components = uidManager.GetShapeContainer();
+    for (ShapeContainerType::const_iterator it = components.begin(); it != components.end(); ++it) {
+        const CTiglAbstractGeometricComponent* component = dynamic_cast<const CTiglAbstractGeometricComponent*>(it->second);
+        if (!component) {
+            continue;
+        }
+
+        std::map<std::string, unsigned int>::const_iterator countIt = loftBuildCounts.find(it->first);
+        unsigned int lastCount = countIt != loftBuildCounts.end() ? countIt->second : 0;
+        if (component->GetLoftBuildCount() > lastCount) {
+            rebuiltComponents.push_back(it->first);
+        }
+    }
+    return rebuiltComponents;
+}
+
+// Resets the list of rebuilt components
+void CCPACSConfiguration::ClearRebuiltComponents()
+{
+    loftBuildCounts.clear();
+    const ShapeContainerType& components = uidManager.GetShapeContainer();
+    for (ShapeContainerType::const_iterator it = components.begin(); it != components.end(); ++it) {
+        const CTiglAbstractGeometricComponent* component = dynamic_cast<const CTiglAbstractGeometricComponent*>(it->second);
+        if (component) {
+            loftBuildCounts[it->first] = component->GetLoftBuildCount();
+        }
+    }
+}
+
+namespace
+{
+    const int LoftBuildStages = 4;
+
+    // Returns true for segments, whose loft is cut from the wing or fuselage loft
+    bool IsCutFromParentLoft(const ITiglGeometricComponent& component)
+    {
+        switch (component.GetComponentType()) {
+        case TIGL_COMPONENT_WINGSEGMENT: {
+            const CCPACSWingSegment* segment = dynamic_cast<const CCPACSWingSegment*>(&component);
+            return segment && !segment->IsLoftedLinearly();
+        }
+        case TIGL_COMPONENT_FUSELSEGMENT: {
+            const CCPACSFuselageSegment* segment = dynamic_cast<const CCPACSFuselageSegment*>(&component);
+            return segment && !segment->IsLoftedLinearly();
+        }
+        default:
+            return false;
+        }
+    }
+
+    // The lofts of a stage depend only on the lofts of lower stages
+    int LoftBuildStage(const ITiglGeometricComponent& component)
+    {
+        switch (component.GetComponentType()) {
+        case TIGL_COMPONENT_WINGSHELL:
+        case TIGL_COMPONENT_WINGRIB:
+        case TIGL_COMPONENT_WINGSPAR:
+        case TIGL_COMPONENT_WINGCELL:
+            // require the component segments
+            return 3;
+        case TIGL_COMPONENT_WINGCOMPSEGMENT:
+        case TIGL_COMPONENT_ROTOR:
+            // require the segment lofts or the attached rotor blades
+            return 2;
+        case TIGL_COMPONENT_ATTACHED_ROTORBLADE:
+            // requires the loft of the unattached rotor blade
+            return 1;
+        case TIGL_COMPONENT_WINGSEGMENT:
+        case TIGL_COMPONENT_FUSELSEGMENT:
+            // cut from the wing or fuselage loft, unless lofted linearly
+            return IsCutFromParentLoft(component) ? 1 : 0;
+        default:
+            // the fuselage structure requires the fuselage loft, all others
+            // are built from their profiles and guide curves only
+            return (component.GetComponentIntent() & TIGL_INTENT_INNER_STRUCTURE) ? 1 : 0;
+        }
+    }
+
+    template <typename Func>
+    void TryBuild(const std::string& uid, Func build)
+    {
+        try {
+            build();
+        }
+        catch (const CTiglError& ex) {
+            LOG(WARNING) << "Cannot build the geometry of " << uid << ": " << ex.what();
+        }
+        catch (const Standard_Failure& ex) {
+            LOG(WARNING) << "Cannot build the geometry of " << uid << ": " << ex.GetMessageString();
+        }
+        catch (const std::exception& ex) {
+            LOG(WARNING) << "Cannot build the geometry of " << uid << ": " << ex.what();
+        }
+    }
+}
+
+// Builds the lofts of all geometric components in advance.
+// The lofts are built by the same functions and from the same data as on
+// demand, hence they are identical. As all lazily computed data is stored in
+// mutex guarded caches, the components may be built in any order. The stages
+// only avoid, that threads wait for the lofts built by other threads, i.e. only
+// the lofts within a stage are built concurrently.
+void CCPACSConfiguration::BuildAllLofts(int nThreads)
+{
+    // profiles are shared by many components
+    const std::vector<CCPACSWingProfile*> wingProfiles = uidManager.ResolveObjects<CCPACSWingProfile>();
+    ParallelForDynamic(wingProfiles.size(), [&wingProfiles](size_t i) {
+        TryBuild(wingProfiles[i]->GetUID(), [&]() { wingProfiles[i]->GetWire(); });
+    }, nThreads);
+
+    const std::vector<CCPACSFuselageProfile*> fuselageProfiles = uidManager.ResolveObjects<CCPACSFuselageProfile>();
+    ParallelForDynamic(fuselageProfiles.size(), [&fuselageProfiles](size_t i) {
+        TryBuild(fuselageProfiles[i]->GetUID(), [&]() { fuselageProfiles[i]->GetWire(); });
+    }, nThreads);
+
+    std::vector<std::vector<std::pair<std::string, ITiglGeometricComponent*> > > stages(LoftBuildStages);
+    const ShapeContainerType& components = uidManager.GetShapeContainer();
+    for (ShapeContainerType::const_iterator it = components.begin(); it != components.end(); ++it) {
+        if (it->second->GetComponentType() == TIGL_COMPONENT_PLANE) {
+            continue;
+        }
+        stages[LoftBuildStage(*it->second)].push_back(*it);
+    }
+
+    for (size_t istage = 0; istage < stages.size(); ++istage) {
+        const std::vector<std::pair<std::string, ITiglGeometricComponent*> >& stage = stages[istage];
+        ParallelForDynamic(stage.size(), [&stage](size_t i) {
+            TryBuild(stage[i].first, [&]() { stage[i].second->GetLoft(); });
+        }, nThreads);
+    }
 }
 
 namespace {
@@ -90,6 +256,8 @@ namespace {
 // Build up memory structure for whole CPACS file
 void CCPACSConfiguration::ReadCPACS(const std::string& configurationUID)
 {
+    CTiglScopedTimer timer("ReadCPACS", configurationUID);
+
     char* path;
     if (tixiUIDGetXPath(tixiDocumentHandle, configurationUID.c_str(), &path) != SUCCESS) {
         throw CTiglError("XML error while reading in CCPACSConfiguration::ReadCPACS", TIGL_XML_ERROR);
@@ -97,11 +265,13 @@ void CCPACSConfiguration::ReadCPACS(const std::string& configurationUID)
 
     if (tixi::TixiCheckElement(tixiDocumentHandle, headerXPath)) {
         header.ReadCPACS(tixiDocumentHandle, headerXPath);
+        header.ClearDirty();
     }
     if (tixi::TixiCheckElement(tixiDocumentHandle, profilesXPath)) {
         profiles = boost::in_place(&uidManager);
         // read wing airfoils, fuselage profiles, rotor airfoils and guide curve profiles
         profiles->ReadCPACS(tixiDocumentHandle, profilesXPath);
+        profiles->ClearDirty();
     }
     if (tixi::TixiCheckElement(tixiDocumentHandle, farFieldXPath)) {
         farField.ReadCPACS(tixiDocumentHandle, farFieldXPath);
@@ -114,23 +284,88 @@ void CCPACSConfiguration::ReadCPACS(const std::string& configurationUID)
         rotorcraftModel = boost::in_place(this);
         // TODO(bgruber): why can't we just write "/cpacs/vehicles/rotorcraft/model[" + configurationUID + "]" ?
         rotorcraftModel->ReadCPACS(tixiDocumentHandle, path); // reads everything underneath /cpacs/vehicles/rotorcraft/model
+        rotorcraftModel->ClearDirty();
     }
     else {
         rotorcraftModel = boost::none;
         aircraftModel = boost::in_place(this);
         // TODO(bgruber): why can't we just write "/cpacs/vehicles/aircraft/model[" + configurationUID + "]" ?
         aircraftModel->ReadCPACS(tixiDocumentHandle, path); // reads everything underneath /cpacs/vehicles/aircraft/model
+        aircraftModel->ClearDirty();
     }
 
     acSystems.ReadCPACS(tixiDocumentHandle, configurationUID);
 
     // Now do parent <-> child transformations. Child should use the parent coordinate system as root.
     uidManager.SetParentComponents();
+    loftBuildCounts.clear();
+
+    InitLoftCache(configurationUID);
+    InitCacheAccounting();
+}
+
+void CCPACSConfiguration::InitCacheAccounting()
+{
+    const ShapeContainerType& components = uidManager.GetShapeContainer();
+    for (ShapeContainerType::const_iterator it = components.begin(); it != components.end(); ++it) {
+        CTiglAbstractGeometricComponent* component = dynamic_cast<CTiglAbstractGeometricComponent*>(it->second);
+        if (component && !it->first.empty()) {
+            component->SetCacheAccounting(cacheAccounting, it->first);
+        }
+    }
+}
+
+// The cache key of a loft is computed from the whole CPACS document, the configuration,
+// the component and the TiGL version. Hashing only the component's subtree would
+// require to track all its dependencies (profiles, positionings, parent transformations,
+// guide curves ...), which is error prone. Hence, any change of the document is a cache miss.
+void CCPACSConfiguration::InitLoftCache(const std::string& configurationUID)
+{
+    loftCacheContext.reset();
+    if (!CTiglLoftDiskCache::IsEnabled()) {
+        return;
+    }
+
+    // the string is owned by tixi
+    char* documentText = NULL;
+    if (tixiExportDocumentAsString(tixiDocumentHandle, &documentText) != SUCCESS || !documentText) {
+        LOG(WARNING) << "Cannot export CPACS document. The loft cache is not used.";
+        return;
+    }
+
+    std::string documentKey = TIGL_VERSION_STRING;
+    documentKey += "\n";
+    documentKey += TIGL_REVISION;
+    documentKey += "\n";
+    documentKey += configurationUID;
+    documentKey += "\n";
+    documentKey += documentText;
+    loftCacheContext = CSharedPtr<CTiglLoftCacheContext>(new CTiglLoftCacheContext(CTiglLoftDiskCache::Hash(documentKey), [this]() {
+        return IsGeometryDirty();
+    }));
+
+    const ShapeContainerType& components = uidManager.GetShapeContainer();
+    for (ShapeContainerType::const_iterator it = components.begin(); it != components.end(); ++it) {
+        CTiglAbstractGeometricComponent* component = dynamic_cast<CTiglAbstractGeometricComponent*>(it->second);
+        if (!component || it->first.empty()) {
+            continue;
+        }
+
+        // Lofts loaded from separate files would not share their faces with the parent loft.
+        // These lofts are cut from the cached parent loft again instead.
+        if (IsCutFromParentLoft(*it->second)) {
+            continue;
+        }
+
+        component->SetLoftCacheContext(loftCacheContext, CTiglLoftDiskCache::Hash(loftCacheContext->documentHash + "\n" + it->first));
+    }
 }
 
 // Write CPACS structure to tixiHandle
 void CCPACSConfiguration::WriteCPACS(const std::string& configurationUID)
 {
+    CTiglScopedTimer timer("WriteCPACS", configurationUID);
+
     header.WriteCPACS(tixiDocumentHandle, headerXPath);
     if (aircraftModel) {
         tixi::TixiCreateElementsIfNotExists(tixiDocumentHandle, "/cpacs/vehicles/aircraft/model");
@@ -148,6 +383,65 @@ void CCPACSConfiguration::WriteCPACS(const std::string& configurationUID)
         tixi::TixiCreateElementsIfNotExists(tixiDocumentHandle, profilesXPath);
         profiles->WriteCPACS(tixiDocumentHandle, profilesXPath);
     }
+
+    ClearDirty();
+}
+
+// The header does not define any geometry
+bool CCPACSConfiguration::IsGeometryDirty() const
+{
+    return (aircraftModel && aircraftModel->IsDirty())
+        || (rotorcraftModel && rotorcraftModel->IsDirty())
+        || (profiles && profiles->IsDirty());
+}
+
+// Write the modified parts of the CPACS structure to tixiHandle
+void CCPACSConfiguration::WriteDirtyCPACS(const std::string& configurationUID)
+{
+    // a new model uid changes the xpath of all elements
+    if ((aircraftModel && aircraftModel->GetUID() != configurationUID) ||
+        (rotorcraftModel && rotorcraftModel->GetUID() != configurationUID)) {
+        WriteCPACS(configurationUID);
+        return;
+    }
+
+    CTiglScopedTimer timer("WriteDirtyCPACS", configurationUID);
+
+    if (header.IsDirty()) {
+        tixi::TixiCreateElementsIfNotExists(tixiDocumentHandle, headerXPath);
+        header.WriteDirtyCPACS(tixiDocumentHandle, headerXPath);
+    }
+    if (aircraftModel && aircraftModel->IsDirty()) {
+        aircraftModel->WriteDirtyCPACS(tixiDocumentHandle, "/cpacs/vehicles/aircraft/model[@uID=\"" + configurationUID + "\"]");
+    }
+    if (rotorcraftModel && rotorcraftModel->IsDirty()) {
+        rotorcraftModel->WriteDirtyCPACS(tixiDocumentHandle, "/cpacs/vehicles/rotorcraft/model[@uID=\"" + configurationUID + "\"]");
+    }
+    if (profiles && profiles->IsDirty()) {
+        tixi::TixiCreateElementsIfNotExists(tixiDocumentHandle, profilesXPath);
+        profiles->WriteDirtyCPACS(tixiDocumentHandle, profilesXPath);
+    }
+
+    ClearDirty();
+}
+
+void CCPACSConfiguration::ClearDirty()
+{
+    // the modifications are not detectable anymore, but the document differs from its hash
+    if (loftCacheContext) {
+        loftCacheContext->IsValid();
+    }
+
+    header.ClearDirty();
+    if (aircraftModel) {
+        aircraftModel->ClearDirty();
+    }
+    if (rotorcraftModel) {
+        rotorcraftModel->ClearDirty();
+    }
+    if (profiles) {
+        profiles->ClearDirty();
+    }
 }
 
 
@@ -607,11 +901,41 @@ CTiglShapeCache& CCPACSConfiguration::GetShapeCache()
     return shapeCache;
 }
 
+CTiglCacheStatistics CCPACSConfiguration::GetCacheStatistics() const
+{
+    return cacheAccounting->GetStatistics();
+}
+
+void CCPACSConfiguration::EnforceCacheBudget()
+{
+    cacheAccounting->EnforceBudget();
+}
+
 CTiglMemoryPool& CCPACSConfiguration::GetMemoryPool()
 {
     return memoryPool;
 }
 
+CTiglSolidClassifier& CCPACSConfiguration::GetSolidClassifier(const std::string& componentUID)
+{
+    const TopoDS_Shape loft = uidManager.GetGeometricComponent(componentUID).GetLoft()->Shape();
+
+    // the classifier keeps the solid alive, hence it is accounted and evicted like the lofts
+    const std::string accountingKey = "solidClassifier:" + componentUID;
+    CSharedPtr<CTiglSolidClassifier>& classifier = solidClassifiers[componentUID];
+    if (!classifier || !classifier->Solid().IsSame(loft)) {
+        classifier.reset();
+        classifier = CSharedPtr<CTiglSolidClassifier>(new CTiglSolidClassifier(loft));
+        cacheAccounting->Insert(accountingKey, classifier->EstimateMemory(), [this, componentUID]() {
+            solidClassifiers.erase(componentUID);
+        });
+    }
+    else {
+        cacheAccounting->Touch(accountingKey);
+    }
+    return *classifier;
+}
+
 std::string CCPACSConfiguration::GetName() const
 {
     if(aircraftModel) {
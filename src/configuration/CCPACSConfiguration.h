@@ -25,6 +25,10 @@
 
 #include "tigl_internal.h"
 
+#include <map>
+#include <string>
+#include <vector>
+
 #include "CTiglUIDManager.h"
 #include "CTiglLogging.h"
 #include "CCPACSAircraftModel.h"
@@ -39,6 +43,7 @@
 #include "TopoDS_Compound.hxx"
 #include "BRep_Builder.hxx"
 #include "CTiglShapeCache.h"
+#include "CTiglCacheAccounting.h"
 #include "CTiglMemoryPool.h"
 #include "CSharedPtr.h"
 #include "CCPACSProfiles.h"
@@ -49,6 +54,8 @@ namespace tigl
 
 class CTiglFusePlane;
 typedef CSharedPtr<CTiglFusePlane> PTiglFusePlane;
+struct CTiglLoftCacheContext;
+class CTiglSolidClassifier;
 
 class CCPACSConfiguration
 {
@@ -64,12 +71,31 @@ public:
     // recalculation of wires, lofts etc.
     TIGL_EXPORT void Invalidate();
 
+    // Invalidates the fused aircraft, but keeps the lofts of all components.
+    // Called by components, whose geometry changed.
+    TIGL_EXPORT void InvalidateFusedAircraft();
+
+    // Returns the uids of all components, whose loft has been (re)built since
+    // the configuration has been read or since the last call of ClearRebuiltComponents
+    TIGL_EXPORT std::vector<std::string> GetRebuiltComponents() const;
+
+    // Resets the list of rebuilt components
+    TIGL_EXPORT void ClearRebuiltComponents();
+
+    // Builds the lofts of all geometric components in advance using nThreads threads
+    // (all hardware threads, if nThreads <= 0). Lofts, that cannot be built, are skipped.
+    TIGL_EXPORT void BuildAllLofts(int nThreads = 0);
+
     // Read CPACS configuration
     TIGL_EXPORT void ReadCPACS(const std::string& configurationUID);
 
     // Write CPACS configuration
     TIGL_EXPORT void WriteCPACS(const std::string& configurationUID);
 
+    // Writes only the objects, that have been modified since the last read or write.
+    // The tixi document must not have been changed by other means in between.
+    TIGL_EXPORT void WriteDirtyCPACS(const std::string& configurationUID);
+
     // Returns the underlying tixi document handle used by a CPACS configuration
     TIGL_EXPORT TixiDocumentHandle GetTixiDocumentHandle() const;
 
@@ -188,8 +214,19 @@ public:
 
     TIGL_EXPORT CTiglShapeCache& GetShapeCache();
 
+    // Returns the hits, misses, evictions and resident memory of the cached lofts and shapes
+    TIGL_EXPORT CTiglCacheStatistics GetCacheStatistics() const;
+
+    // Evicts cached lofts and shapes, if the global cache memory budget is exceeded.
+    // Must not be called while cached geometry of this configuration is in use.
+    TIGL_EXPORT void EnforceCacheBudget();
+
     TIGL_EXPORT CTiglMemoryPool& GetMemoryPool();
 
+    // Returns a point classifier for the loft of the given geometric component.
+    // The classifier is cached and only rebuilt, if the loft has changed.
+    TIGL_EXPORT CTiglSolidClassifier& GetSolidClassifier(const std::string& componentUID);
+
     /** Getter/Setter for member name */
     TIGL_EXPORT std::string GetName() const;
 
@@ -212,6 +249,18 @@ private:
     // Assignment operator
     void operator=(const CCPACSConfiguration&);
 
+    // Attaches the loft disk cache to all components, if the cache is enabled
+    void InitLoftCache(const std::string& configurationUID);
+
+    // Attaches the memory accounting to all components
+    void InitCacheAccounting();
+
+    // Marks the written objects as unmodified
+    void ClearDirty();
+
+    // Returns true, if any object defining the geometry has been modified since it has been read or written
+    bool IsGeometryDirty() const;
+
 private:
     CTiglUIDManager                        uidManager;           /**< Stores the unique ids of the components. */ // list as first member, has to be created first and destroyed last
     boost::optional<CCPACSAircraftModel>   aircraftModel;
@@ -222,8 +271,12 @@ private:
     CCPACSACSystems                        acSystems;            /**< Configuration aircraft systems element */
     CCPACSFarField                         farField;             /**< Far field configuration for CFD tools */
     PTiglFusePlane                         aircraftFuser;        /**< The aircraft fusing algo */
+    CSharedPtr<CTiglCacheAccounting>       cacheAccounting;      /**< Memory accounting of the cached lofts and shapes */
     CTiglShapeCache                        shapeCache;
     CTiglMemoryPool                        memoryPool;
+    std::map<std::string, unsigned int>    loftBuildCounts;      /**< Loft build counts at the last call of ClearRebuiltComponents */
+    CSharedPtr<CTiglLoftCacheContext>      loftCacheContext;     /**< Shared state of the loft disk cache, null if the cache is disabled */
+    std::map<std::string, CSharedPtr<CTiglSolidClassifier> > solidClassifiers; /**< Point classifiers of the component lofts */
 };
 
 /// Computes the bounding box coordinates of the specified component
@@ -96,6 +96,10 @@ CCPACSConfiguration& CCPACSConfigurationManager::GetConfiguration(TiglCPACSConfi
     }
 
     CCPACSConfiguration* config = iter->second;
+
+    // Every API call starts here, hence no cached geometry of this
+    // configuration is in use and it is safe to evict it
+    config->EnforceCacheBudget();
     return *config;
 }
 
@@ -50,7 +50,8 @@ public:
     // Removes and deletes a configuration from the configuration container
     TIGL_EXPORT void DeleteConfiguration(TiglCPACSConfigurationHandle handle);
 
-    // Returns the configuration for a given handle
+    // Returns the configuration for a given handle.
+    // Evicts cached geometry of the configuration, if the cache memory budget is exceeded.
     TIGL_EXPORT CCPACSConfiguration& GetConfiguration(TiglCPACSConfigurationHandle handle) const;
 
     // Tests if a given configuration handle is valid
@@ -21,11 +21,13 @@
 #include "CCPACSConfiguration.h"
 #include "CTiglUIDManager.h"
 #include "CTiglLogging.h"
+#include "CTiglProfiler.h"
 #include "CFuseShapes.h"
 #include "CCutShape.h"
 #include "CMergeShapes.h"
 #include "CTrimShape.h"
 #include "tiglcommonfunctions.h"
+#include "tiglparallel.h"
 
 #include <BOPAlgo_PaveFiller.hxx>
 #include <BRepAlgoAPI_Cut.hxx>
@@ -38,16 +40,49 @@
 #endif
 
 
+#include <algorithm>
 #include <string>
 #include <cassert>
 
 namespace tigl
 {
 
+namespace
+{
+    // cuts all intersections with the tool and removes the empty ones
+    void CutIntersections(ListPNamedShape& intersections, const PNamedShape tool)
+    {
+        ListPNamedShape newInts;
+        for (ListPNamedShape::iterator intIt = intersections.begin(); intIt != intersections.end(); ++intIt) {
+            PNamedShape inters = *intIt;
+            if (!inters) {
+                continue;
+            }
+
+            TopoDS_Shape sh = BRepAlgoAPI_Cut(inters->Shape(), tool->Shape());
+            if (!sh.IsNull()) {
+                inters->SetShape(sh);
+                newInts.push_back(inters);
+            }
+        }
+        intersections = newInts;
+    }
+
+    // builds the lofts of all components in advance, such that they are not built concurrently
+    void BuildLofts(const std::vector<CTiglRelativelyPositionedComponent*>& components)
+    {
+        for (std::vector<CTiglRelativelyPositionedComponent*>::const_iterator it = components.begin(); it != components.end(); ++it) {
+            (*it)->GetLoft();
+            BuildLofts((*it)->GetChildren(false));
+        }
+    }
+} // namespace
+
 CTiglFusePlane::CTiglFusePlane(CCPACSConfiguration& config)
     : _myconfig(config)
 {
     _mymode = HALF_PLANE;
+    _runParallel = false;
     Invalidate();
 }
 
@@ -59,6 +94,14 @@ void CTiglFusePlane::SetResultMode(TiglFuseResultMode mode)
     }
 }
 
+void CTiglFusePlane::SetRunParallel(bool runParallel)
+{
+    if (runParallel != _runParallel) {
+        Invalidate();
+        _runParallel = runParallel;
+    }
+}
+
 const PNamedShape CTiglFusePlane::FusedPlane()
 {
     Perform();
@@ -88,7 +131,21 @@ void CTiglFusePlane::Invalidate()
 }
 
 
-PNamedShape CTiglFusePlane::FuseWithChilds(CTiglRelativelyPositionedComponent* parent, const std::vector<CTiglRelativelyPositionedComponent*>& children)
+/**
+ * Fuses the parent with its children. The children subtrees are fused
+ * first, concurrently if more than one thread is available.
+ *
+ * The subtree uses at most nThreads threads. The threads are split among
+ * the concurrently fused children subtrees, such that nested levels do not
+ * start additional threads.
+ *
+ * The intersections of the subtree are appended to intersections. All shapes,
+ * the intersections were trimmed with in this subtree, are appended to trimmingShapes
+ * in the order they were applied. This way, the intersections are the same as if the
+ * tree was processed serially in depth-first order.
+ */
+PNamedShape CTiglFusePlane::FuseWithChilds(CTiglRelativelyPositionedComponent* parent, const std::vector<CTiglRelativelyPositionedComponent*>& children,
+                                           ListPNamedShape& intersections, ListPNamedShape& trimmingShapes, int nThreads)
 {
     PNamedShape parentShape;
     if (parent) {
@@ -105,38 +162,50 @@ PNamedShape CTiglFusePlane::FuseWithChilds(CTiglRelativelyPositionedComponent* p
         return parentShape;
     }
 
-    ListPNamedShape childShapes;
-    for (std::vector<CTiglRelativelyPositionedComponent*>::const_iterator it = children.begin(); it != children.end(); ++it) {
-        childShapes.push_back(FuseWithChilds(*it, (*it)->GetChildren(false)));
-    }
+    ListPNamedShape childShapes(children.size());
+    std::vector<ListPNamedShape> childIntersections(children.size());
+    std::vector<ListPNamedShape> childTrimmingShapes(children.size());
+    const int nConcurrentChildren = static_cast<int>(std::min(static_cast<size_t>(nThreads), children.size()));
+    const int nChildThreads = std::max(1, nThreads / nConcurrentChildren);
+    ParallelFor(children.size(), [&](size_t i) {
+        childShapes[i] = FuseWithChilds(children[i], children[i]->GetChildren(false), childIntersections[i], childTrimmingShapes[i], nChildThreads);
+    }, nConcurrentChildren);
+
+    // the children subtrees are finished, all threads of this subtree are available again
     CFuseShapes fuser(parentShape, childShapes);
+    fuser.SetRunParallel(nThreads > 1);
     PNamedShape result = fuser.NamedShape();
 
-    // trim previous intersections
-    ListPNamedShape::iterator intIt = _intersections.begin();
-    ListPNamedShape newInts;
-    for (; intIt != _intersections.end(); ++intIt) {
-        PNamedShape inters = *intIt;
-        if (!inters) {
-            continue;
+    // collect intersections of the subtrees, the previous ones being trimmed by the following subtrees
+    for (size_t i = 0; i < children.size(); ++i) {
+        const ListPNamedShape& tools = childTrimmingShapes[i];
+        for (ListPNamedShape::const_iterator toolIt = tools.begin(); toolIt != tools.end(); ++toolIt) {
+            CutIntersections(intersections, *toolIt);
         }
+        intersections.insert(intersections.end(), childIntersections[i].begin(), childIntersections[i].end());
+        trimmingShapes.insert(trimmingShapes.end(), tools.begin(), tools.end());
+    }
 
-        TopoDS_Shape sh = inters->Shape();
-        if (parentShape) {
-            sh = BRepAlgoAPI_Cut(sh, parentShape->Shape());
-        }
-        if (!sh.IsNull()) {
-            inters->SetShape(sh);
-            newInts.push_back(inters);
+    // trim previous intersections
+    if (parentShape) {
+        CutIntersections(intersections, parentShape);
+        trimmingShapes.push_back(parentShape);
+    }
+    else {
+        ListPNamedShape newInts;
+        for (ListPNamedShape::iterator intIt = intersections.begin(); intIt != intersections.end(); ++intIt) {
+            if (*intIt) {
+                newInts.push_back(*intIt);
+            }
         }
+        intersections = newInts;
     }
-    _intersections = newInts;
 
     // insert intersections
     ListPNamedShape::const_iterator it = fuser.Intersections().begin();
     for (; it != fuser.Intersections().end(); it++) {
         if (*it) {
-            _intersections.push_back(*it);
+            intersections.push_back(*it);
         }
     }
     
@@ -153,12 +222,20 @@ void CTiglFusePlane::Perform()
         return;
     }
 
+    CTiglScopedTimer timer("CTiglFusePlane");
+
     CTiglUIDManager& uidManager = _myconfig.GetUIDManager();
     std::vector<CTiglRelativelyPositionedComponent*> rootComponentPtrs;
     const RelativeComponentContainerType& rootComponents = uidManager.GetRootGeometricComponents();
     for (RelativeComponentContainerType::const_iterator it = rootComponents.begin(); it != rootComponents.end(); ++it)
         rootComponentPtrs.push_back(it->second);
-    _result = FuseWithChilds(NULL, rootComponentPtrs);
+
+    if (_runParallel) {
+        BuildLofts(rootComponentPtrs);
+    }
+
+    ListPNamedShape trimmingShapes;
+    _result = FuseWithChilds(NULL, rootComponentPtrs, _intersections, trimmingShapes, _runParallel ? GetHardwareThreadCount() : 1);
 
     CCPACSFarField& farfield = _myconfig.GetFarField();
     if (farfield.GetType() != NONE && (_mymode == FULL_PLANE_TRIMMED_FF || _mymode == HALF_PLANE_TRIMMED_FF)) {
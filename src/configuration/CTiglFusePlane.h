@@ -46,12 +46,18 @@ public:
     // sets mode for plane generation, by default a half plane is created
     TIGL_EXPORT void SetResultMode(TiglFuseResultMode mode);
 
+    // If enabled, independent branches of the component tree are fused concurrently
+    // and the single fuse operations use parallel boolean operations.
+    // The result is the same as in serial mode. Disabled by default.
+    TIGL_EXPORT void SetRunParallel(bool runParallel);
+
     TIGL_EXPORT const PNamedShape FusedPlane();
     TIGL_EXPORT const PNamedShape FarField();
     TIGL_EXPORT const ListPNamedShape& Intersections();
 
 private:
-    PNamedShape FuseWithChilds(CTiglRelativelyPositionedComponent* parent, const std::vector<CTiglRelativelyPositionedComponent*>& children);
+    PNamedShape FuseWithChilds(CTiglRelativelyPositionedComponent* parent, const std::vector<CTiglRelativelyPositionedComponent*>& children,
+                               ListPNamedShape& intersections, ListPNamedShape& trimmingShapes, int nThreads);
     
     void Invalidate();
     void Perform();
@@ -62,6 +68,7 @@ private:
     CCPACSConfiguration& _myconfig;       /**< Ref to CPACS config >**/
     TiglFuseResultMode    _mymode;
     bool _hasPerformed;
+    bool _runParallel;
 };
 
 } // namespace tigl
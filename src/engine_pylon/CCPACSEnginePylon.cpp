@@ -36,6 +36,7 @@ std::string CCPACSEnginePylon::GetDefaultedUID() const
 
 void CCPACSEnginePylon::Invalidate()
 {
+    CTiglAbstractGeometricComponent::Reset();
 }
 
 PNamedShape CCPACSEnginePylon::BuildLoft() const
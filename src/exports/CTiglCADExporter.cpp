@@ -23,6 +23,7 @@
 #include "CCPACSWingSegment.h"
 #include "CCPACSFuselageSegment.h"
 #include "CCPACSExternalObject.h"
+#include "CTiglProfiler.h"
 
 #include <string>
 #include <algorithm>
@@ -34,6 +35,10 @@ namespace tigl
 
 bool CTiglCADExporter::Write(const std::string &filename) const
 {
+    CTiglScopedTimer timer;
+    if (CTiglProfiler::IsEnabled()) {
+        timer.Start("Export " + SupportedFileType(), "");
+    }
     return WriteImpl(filename);
 }
 
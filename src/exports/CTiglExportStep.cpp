@@ -64,6 +64,10 @@
 #include "TopExp_Explorer.hxx"
 #include "TopTools_IndexedMapOfShape.hxx"
 #include "TopTools_HSequenceOfShape.hxx"
+#include "TopTools_MapOfShape.hxx"
+#include "TopLoc_Location.hxx"
+#include "TopoDS_Compound.hxx"
+#include "BRep_Builder.hxx"
 #include "TopoDS_Edge.hxx"
 #include "ShapeAnalysis_FreeBounds.hxx"
 
@@ -304,6 +308,86 @@ void CTiglExportStep::AddToStep(PNamedShape shape, STEPControl_Writer& writer) c
 }
 
 
+bool CTiglExportStep::WriteAssembly() const
+{
+    return GlobalExportOptions().HasOption("WriteAssembly")
+            ? GlobalExportOptions().Get<bool>("WriteAssembly")
+            : StepOptions().Get<bool>("WriteAssembly");
+}
+
+/**
+ * @brief Adds all shapes as parts of one assembly to the step file.
+ *
+ * The geometry of each part is written once. Shapes that differ only
+ * in their location are written as further occurrences of the same part.
+ * Shapes without faces are not part of the assembly and are written as wires.
+ */
+void CTiglExportStep::AddAssemblyToStep(STEPControl_Writer& writer) const
+{
+    BRep_Builder builder;
+    TopoDS_Compound assembly;
+    builder.MakeCompound(assembly);
+
+    std::string assemblyName = "Assembly";
+    ListPNamedShape parts;
+    TopTools_MapOfShape partShapes;
+    bool hasParts = false;
+    for (size_t ishape = 0; ishape < NShapes(); ++ishape) {
+        PNamedShape shape = GetShape(ishape);
+        if (!shape) {
+            continue;
+        }
+
+        TopExp_Explorer faceExplorer(shape->Shape(), TopAbs_FACE);
+        if (!faceExplorer.More()) {
+            AddToStep(shape, writer);
+            continue;
+        }
+
+        if (!hasParts && GetConfiguration(ishape)) {
+            assemblyName = GetConfiguration(ishape)->GetUID();
+        }
+
+        builder.Add(assembly, shape->Shape());
+        hasParts = true;
+
+        // the writer stores the part without its location
+        TopoDS_Shape partShape = shape->Shape().Located(TopLoc_Location());
+        if (partShapes.Add(partShape)) {
+            PNamedShape part(new CNamedShape(*shape));
+            part->SetShape(partShape);
+            parts.push_back(part);
+        }
+    }
+
+    if (!hasParts) {
+        return;
+    }
+
+    // the setting is global, restore the value of the caller afterwards
+    const int writeAssembly = Interface_Static::IVal("write.step.assembly");
+    Interface_Static::SetIVal("write.step.assembly", 1);
+    int ret = IFSelect_RetFail;
+    try {
+        ret = writer.Transfer(assembly, STEP_WRITEMODE);
+    }
+    catch (...) {
+        Interface_Static::SetIVal("write.step.assembly", writeAssembly);
+        throw;
+    }
+    Interface_Static::SetIVal("write.step.assembly", writeAssembly);
+    if (ret > IFSelect_RetDone) {
+        throw CTiglError("Export to STEP file failed in CTiglExportStep. Could not translate assembly " 
+                         + assemblyName + " to step entity,", TIGL_ERROR);
+    }
+
+    Handle(Transfer_FinderProcess) FP = writer.WS()->TransferWriter()->FinderProcess();
+    for (ListPNamedShape::iterator it = parts.begin(); it != parts.end(); ++it) {
+        WriteStepNames(FP, *it);
+    }
+    WriteStepProductName(FP, PNamedShape(new CNamedShape(assembly, assemblyName.c_str())));
+}
+
 // Save a sequence of shapes in STEP Format
 bool CTiglExportStep::WriteImpl(const std::string& filename) const
 {
@@ -316,6 +400,12 @@ bool CTiglExportStep::WriteImpl(const std::string& filename) const
     Interface_Static::SetCVal("xstep.cascade.unit", "M");
     Interface_Static::SetCVal("write.step.unit", "M");
 
+    if (WriteAssembly()) {
+        STEPControl_Writer stepWriter;
+        AddAssemblyToStep(stepWriter);
+        return stepWriter.Write(const_cast<char*>(filename.c_str())) <= IFSelect_RetDone;
+    }
+
     ListPNamedShape list;
     for (size_t ishape = 0; ishape < NShapes(); ++ishape) {
         ShapeGroupMode groupMode = GlobalExportOptions().Get<ShapeGroupMode>("ShapeGroupMode");
@@ -42,6 +42,7 @@ public:
         Set("ApplySymmetries", false);
         Set("IncludeFarfield", true);
         Set("ShapeGroupMode", NAMED_COMPOUNDS);
+        AddOption("WriteAssembly", false);
     }
 };
 
@@ -51,6 +52,18 @@ public:
     StepShapeOptions(){}
 };
 
+/**
+ * @brief Exports shapes and configurations to STEP
+ *
+ * If the option "WriteAssembly" is set, the shapes are written as one product
+ * assembly. Each shape becomes a part, which is placed as an occurrence
+ * into the assembly. Shapes sharing the same geometry at different locations
+ * (e.g. the attached blades of a rotor) are written only once. In this mode, the
+ * option "ShapeGroupMode" is ignored.
+ *
+ * Mirrored shapes are still written as separate parts, as STEP placements
+ * cannot describe reflections.
+ */
 class CTiglExportStep : public CTiglCADExporter
 {
 
@@ -74,6 +87,11 @@ private:
     void operator=(const CTiglExportStep& ) { /* Do nothing */ }
 
     void AddToStep(PNamedShape shape, STEPControl_Writer &writer) const;
+
+    // Writes all shapes as parts of a single assembly
+    void AddAssemblyToStep(STEPControl_Writer &writer) const;
+
+    bool WriteAssembly() const;
 };
 
 } // end namespace tigl
@@ -24,18 +24,278 @@
 #include "CTiglExporterFactory.h"
 #include "CTiglTypeRegistry.h"
 
+#include "CTiglLogging.h"
+#include "CNamedShape.h"
+#include "CTiglProfiler.h"
+#include "to_string.h"
+
 #include "TopoDS_Shape.hxx"
-#include "Standard_CString.hxx"
-#include "ShapeFix_Shape.hxx"
-#include "BRep_Builder.hxx"
-#include "BRepTools.hxx"
+#include "TopoDS.hxx"
+#include "TopoDS_Face.hxx"
+#include "TopExp.hxx"
+#include "TopTools_IndexedMapOfShape.hxx"
+#include "BRep_Tool.hxx"
 #include "BRepMesh_IncrementalMesh.hxx"
-#include "StlAPI_Writer.hxx"
-#include "Interface_Static.hxx"
-#include "StlAPI.hxx"
+#include "Poly_Triangulation.hxx"
+#include "gp_Trsf.hxx"
+#include "gp_Vec.hxx"
 #include "CTiglFusePlane.h"
 
+#include <algorithm>
 #include <cassert>
+#include <cctype>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <map>
+#include <set>
+#include <stdint.h>
+#include <vector>
+
+namespace
+{
+
+// A named group of faces, that is written as one stl solid
+struct StlSolid
+{
+    explicit StlSolid(const std::string& name)
+        : name(name)
+    {
+    }
+
+    std::string name;
+    std::vector<TopoDS_Face> faces;
+};
+
+// Splits the faces of the shape into solids according to the group mode
+void addSolids(const PNamedShape& shape, tigl::ShapeGroupMode groupMode, std::vector<StlSolid>& solids)
+{
+    TopTools_IndexedMapOfShape faceMap;
+    TopExp::MapShapes(shape->Shape(), TopAbs_FACE, faceMap);
+
+    std::map<std::string, size_t> solidIndex;
+    for (int iface = 1; iface <= faceMap.Extent(); ++iface) {
+        const CFaceTraits& traits = shape->GetFaceTraits(iface - 1);
+
+        std::string name = shape->Name();
+        if (groupMode == tigl::NAMED_COMPOUNDS && traits.Origin()) {
+            name = traits.Origin()->Name();
+        }
+        else if (groupMode == tigl::FACES) {
+            name = traits.Origin() ? traits.Origin()->Name() : shape->Name();
+            name += "_" + traits.Name();
+        }
+
+        const TopoDS_Face& face = TopoDS::Face(faceMap(iface));
+        if (groupMode == tigl::FACES) {
+            solids.push_back(StlSolid(name));
+            solids.back().faces.push_back(face);
+            continue;
+        }
+
+        // faces with the same name are merged only within the shape
+        std::map<std::string, size_t>::iterator it = solidIndex.find(name);
+        if (it == solidIndex.end()) {
+            it = solidIndex.insert(std::make_pair(name, solids.size())).first;
+            solids.push_back(StlSolid(name));
+        }
+        solids[it->second].faces.push_back(face);
+    }
+}
+
+// Calls func(p1, p2, p3) for each triangle of the solid's triangulation,
+// the vertices are ordered counter-clockwise with respect to the outer face normal
+template <typename Func>
+void forEachTriangle(const StlSolid& solid, Func func)
+{
+    for (std::vector<TopoDS_Face>::const_iterator it = solid.faces.begin(); it != solid.faces.end(); ++it) {
+        const TopoDS_Face& face = *it;
+        TopLoc_Location location;
+        const Handle(Poly_Triangulation) triangulation = BRep_Tool::Triangulation(face, location);
+        if (triangulation.IsNull()) {
+            continue;
+        }
+
+        const gp_Trsf nodeTransformation = location;
+        const bool reversed = face.Orientation() == TopAbs_REVERSED || face.Orientation() == TopAbs_INTERNAL;
+        const TColgp_Array1OfPnt& nodes = triangulation->Nodes();
+        const Poly_Array1OfTriangle& triangles = triangulation->Triangles();
+        for (int j = triangles.Lower(); j <= triangles.Upper(); j++) {
+            int occindex1, occindex2, occindex3;
+            triangles(j).Get(occindex1, occindex2, occindex3);
+            if (reversed) {
+                std::swap(occindex2, occindex3);
+            }
+            func(nodes(occindex1).Transformed(nodeTransformation),
+                 nodes(occindex2).Transformed(nodeTransformation),
+                 nodes(occindex3).Transformed(nodeTransformation));
+        }
+    }
+}
+
+size_t countTriangles(const StlSolid& solid)
+{
+    size_t nTriangles = 0;
+    for (std::vector<TopoDS_Face>::const_iterator it = solid.faces.begin(); it != solid.faces.end(); ++it) {
+        TopLoc_Location location;
+        const Handle(Poly_Triangulation) triangulation = BRep_Tool::Triangulation(*it, location);
+        if (!triangulation.IsNull()) {
+            nTriangles += static_cast<size_t>(triangulation->NbTriangles());
+        }
+    }
+    return nTriangles;
+}
+
+gp_Vec facetNormal(const gp_Pnt& p1, const gp_Pnt& p2, const gp_Pnt& p3)
+{
+    gp_Vec n = gp_Vec(p1, p2).Crossed(gp_Vec(p1, p3));
+    if (n.SquareMagnitude() > 0.) {
+        n.Normalize();
+    }
+    return n;
+}
+
+class AsciiSolidWriter
+{
+public:
+    explicit AsciiSolidWriter(std::ostream& out)
+        : m_out(out)
+    {
+    }
+
+    void operator()(const gp_Pnt& p1, const gp_Pnt& p2, const gp_Pnt& p3)
+    {
+        const gp_Vec n = facetNormal(p1, p2, p3);
+        char buffer[512];
+        int len = std::snprintf(buffer, sizeof(buffer),
+                                "  facet normal %.9e %.9e %.9e\n"
+                                "    outer loop\n"
+                                "      vertex %.9e %.9e %.9e\n"
+                                "      vertex %.9e %.9e %.9e\n"
+                                "      vertex %.9e %.9e %.9e\n"
+                                "    endloop\n"
+                                "  endfacet\n",
+                                n.X(), n.Y(), n.Z(),
+                                p1.X(), p1.Y(), p1.Z(),
+                                p2.X(), p2.Y(), p2.Z(),
+                                p3.X(), p3.Y(), p3.Z());
+        m_out.write(buffer, len);
+    }
+
+private:
+    std::ostream& m_out;
+};
+
+// writes little endian values independent of the platform
+class BinarySolidWriter
+{
+public:
+    explicit BinarySolidWriter(std::ostream& out)
+        : m_out(out)
+    {
+    }
+
+    void operator()(const gp_Pnt& p1, const gp_Pnt& p2, const gp_Pnt& p3)
+    {
+        const gp_Vec n = facetNormal(p1, p2, p3);
+        unsigned char buffer[50];
+        unsigned char* pos = buffer;
+        pos = writeFloat(pos, n.X());
+        pos = writeFloat(pos, n.Y());
+        pos = writeFloat(pos, n.Z());
+        const gp_Pnt* points[3] = {&p1, &p2, &p3};
+        for (int i = 0; i < 3; ++i) {
+            pos = writeFloat(pos, points[i]->X());
+            pos = writeFloat(pos, points[i]->Y());
+            pos = writeFloat(pos, points[i]->Z());
+        }
+        // attribute byte count
+        pos[0] = 0;
+        pos[1] = 0;
+        m_out.write(reinterpret_cast<const char*>(buffer), sizeof(buffer));
+    }
+
+    static unsigned char* writeUInt32(unsigned char* pos, uint32_t value)
+    {
+        for (int i = 0; i < 4; ++i) {
+            pos[i] = static_cast<unsigned char>((value >> (8 * i)) & 0xFF);
+        }
+        return pos + 4;
+    }
+
+private:
+    static unsigned char* writeFloat(unsigned char* pos, double value)
+    {
+        float f = static_cast<float>(value);
+        uint32_t bits;
+        std::memcpy(&bits, &f, sizeof(bits));
+        return writeUInt32(pos, bits);
+    }
+
+    std::ostream& m_out;
+};
+
+void writeAsciiSolid(std::ostream& out, const StlSolid& solid)
+{
+    out << "solid " << solid.name << "\n";
+    forEachTriangle(solid, AsciiSolidWriter(out));
+    out << "endsolid " << solid.name << "\n";
+}
+
+bool writeBinarySolid(const std::string& filename, const StlSolid& solid)
+{
+    std::ofstream out(filename.c_str(), std::ios::out | std::ios::binary);
+    if (!out) {
+        LOG(ERROR) << "Cannot open file " << filename << " for writing." << std::endl;
+        return false;
+    }
+
+    const size_t nTriangles = countTriangles(solid);
+    if (nTriangles > 0xFFFFFFFFu) {
+        LOG(ERROR) << "Too many triangles for a binary stl file in " << filename << "." << std::endl;
+        return false;
+    }
+
+    // The header must not start with "solid", as some readers would treat the file as ascii
+    unsigned char header[84];
+    std::memset(header, 0, sizeof(header));
+    std::string headerText = "TiGL binary STL: " + solid.name;
+    std::memcpy(header, headerText.c_str(), std::min<size_t>(headerText.size(), 80));
+    BinarySolidWriter::writeUInt32(header + 80, static_cast<uint32_t>(nTriangles));
+    out.write(reinterpret_cast<const char*>(header), sizeof(header));
+
+    forEachTriangle(solid, BinarySolidWriter(out));
+    return static_cast<bool>(out);
+}
+
+// Returns <filename without extension>_<solid name>.<extension>. The solid name
+// is reduced to characters valid in file names and made unique.
+std::string solidFileName(const std::string& filename, const std::string& solidName, std::set<std::string>& usedNames)
+{
+    std::string name = solidName;
+    for (std::string::iterator it = name.begin(); it != name.end(); ++it) {
+        if (!isalnum(static_cast<unsigned char>(*it)) && *it != '-' && *it != '_') {
+            *it = '_';
+        }
+    }
+
+    std::string uniqueName = name;
+    for (int i = 2; !usedNames.insert(uniqueName).second; ++i) {
+        uniqueName = name + "_" + tigl::std_to_string(i);
+    }
+
+    std::string stem = filename;
+    std::string extension;
+    const size_t dotPos = filename.find_last_of(".");
+    const size_t sepPos = filename.find_last_of("/\\");
+    if (dotPos != std::string::npos && (sepPos == std::string::npos || dotPos > sepPos)) {
+        stem = filename.substr(0, dotPos);
+        extension = filename.substr(dotPos);
+    }
+    return stem + "_" + uniqueName + extension;
+}
+
+} // namespace
 
 namespace tigl 
 {
@@ -63,43 +323,75 @@ ShapeExportOptions CTiglExportStl::GetDefaultShapeOptions() const
     return TriangulatedExportOptions(0.001);
 }
 
+/**
+ * Meshes the shapes and streams the triangles directly from the face
+ * triangulations into the file, i.e. no compound of all shapes is built.
+ *
+ * With the MultipleSolids option, each shape group is written as its own named
+ * solid. Ascii files then contain multiple solid blocks, binary mode writes
+ * one file per solid, named <filename>_<solid name>.stl
+ */
 bool CTiglExportStl::WriteImpl(const std::string& filename) const
 {
+    const bool writeBinary = GlobalExportOptions().Get<bool>("WriteBinary");
+    const bool multipleSolids = GlobalExportOptions().Get<bool>("MultipleSolids");
+    const bool runParallel = GlobalExportOptions().Get<bool>("ParallelMeshing");
+    const ShapeGroupMode groupMode = GlobalExportOptions().GroupMode();
+
+    std::vector<StlSolid> solids;
     for (size_t ishape = 0; ishape < NShapes(); ++ishape) {
         PNamedShape shape = GetShape(ishape);
-        if (shape) {
-            BRepMesh_IncrementalMesh(shape->Shape(), GetOptions(ishape).Get<double>("Deflection"));
+        if (!shape) {
+            continue;
+        }
+
+        {
+            CTiglScopedTimer timer("BRepMesh_IncrementalMesh", shape->Name());
+            BRepMesh_IncrementalMesh(shape->Shape(), GetOptions(ishape).Get<double>("Deflection"), Standard_False, 0.5, runParallel);
         }
-    }
 
-    if (NShapes() > 1) {
-        TopoDS_Compound c;
-        BRep_Builder b;
-        b.MakeCompound(c);
-        
-        for (size_t ishape = 0; ishape < NShapes(); ++ishape) {
-            PNamedShape shape = GetShape(ishape);
-            if (shape) {
-                b.Add(c, shape->Shape());
+        if (multipleSolids) {
+            addSolids(shape, groupMode, solids);
+        }
+        else {
+            if (solids.empty()) {
+                solids.push_back(StlSolid(shape->Name()));
+            }
+            TopTools_IndexedMapOfShape faceMap;
+            TopExp::MapShapes(shape->Shape(), TopAbs_FACE, faceMap);
+            for (int iface = 1; iface <= faceMap.Extent(); ++iface) {
+                solids.back().faces.push_back(TopoDS::Face(faceMap(iface)));
             }
         }
-        
-        // write the file
-        StlAPI_Writer StlWriter;
-        StlWriter.Write(c, const_cast<char*>(filename.c_str()));
-        
-        return true;
     }
-    else if (NShapes() == 1) {
-        PNamedShape shape = GetShape(0);
-        StlAPI_Writer StlWriter;
-        StlWriter.Write(shape->Shape(), const_cast<char*>(filename.c_str()));
-        
+
+    if (solids.empty()) {
+        return false;
+    }
+
+    if (writeBinary) {
+        if (solids.size() == 1) {
+            return writeBinarySolid(filename, solids.front());
+        }
+
+        std::set<std::string> usedNames;
+        for (std::vector<StlSolid>::const_iterator it = solids.begin(); it != solids.end(); ++it) {
+            if (!writeBinarySolid(solidFileName(filename, it->name, usedNames), *it)) {
+                return false;
+            }
+        }
         return true;
     }
-    else {
+
+    std::ofstream out(filename.c_str(), std::ios::out | std::ios::binary);
+    if (!out) {
+        LOG(ERROR) << "Cannot open file " << filename << " for writing." << std::endl;
         return false;
     }
+    for (std::vector<StlSolid>::const_iterator it = solids.begin(); it != solids.end(); ++it) {
+        writeAsciiSolid(out, *it);
+    }
+    return static_cast<bool>(out);
 }
 
 } // end namespace tigl
@@ -36,6 +36,14 @@ class StlOptions : public ExporterOptions
 public:
     StlOptions()
     {
+        // writes binary instead of ascii stl files
+        AddOption("WriteBinary", false);
+        // writes a named solid per shape group (see ShapeGroupMode) instead of a single solid.
+        // In binary mode, each solid is written into its own file.
+        AddOption("MultipleSolids", false);
+        // mesh the faces of each shape using all cores
+        AddOption("ParallelMeshing", false);
+
         Set("ApplySymmetries", true);
         Set("IncludeFarfield", false);
     }
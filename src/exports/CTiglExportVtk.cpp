@@ -21,8 +21,15 @@
 
 // standard libraries
 #include <iostream>
+#include <fstream>
+#include <sstream>
 #include <algorithm>
+#include <cstdio>
+#include <functional>
+#include <memory>
+#include <stdint.h>
 
+#include "tigl_config.h"
 #include "CTiglLogging.h"
 #include "CTiglExportVtk.h"
 #include "CCPACSConfiguration.h"
@@ -36,6 +43,7 @@
 #include "CGroupShapes.h"
 #include "CTiglExporterFactory.h"
 #include "CTiglTypeRegistry.h"
+#include "UniquePtr.h"
 
 // algorithms
 #include "BRepMesh.hxx"
@@ -45,8 +53,374 @@
 #include "CTiglTriangularizer.h"
 #include "CTiglPolyData.h"
 
+#ifdef ZLIB_FOUND
+#include <zlib.h>
+#endif
+
 namespace
 {
+    // uncompressed size of the compressed blocks, same as used by vtk
+    const size_t VTK_BLOCK_SIZE = 32768;
+
+    bool isLittleEndian()
+    {
+        const uint16_t test = 1;
+        return *reinterpret_cast<const unsigned char*>(&test) == 1;
+    }
+
+    std::string xmlEscape(const std::string& str)
+    {
+        std::string result;
+        result.reserve(str.size());
+        for (std::string::const_iterator it = str.begin(); it != str.end(); ++it) {
+            switch (*it) {
+            case '&':
+                result += "&amp;";
+                break;
+            case '<':
+                result += "&lt;";
+                break;
+            case '>':
+                result += "&gt;";
+                break;
+            case '"':
+                result += "&quot;";
+                break;
+            default:
+                result += *it;
+            }
+        }
+        return result;
+    }
+
+    /**
+     * Receives the binary values of a vtk data array.
+     *
+     * Without compression, the data are written in blocks directly to the output stream.
+     * With compression, each block is compressed and the result is kept in memory,
+     * as the size of the compressed data must be known before writing.
+     */
+    class AppendedDataSink
+    {
+    public:
+        // writes the uncompressed data to the stream
+        explicit AppendedDataSink(std::ostream& out)
+            : m_out(&out), m_rawSize(0)
+        {
+        }
+
+        // compresses the data into memory
+        AppendedDataSink()
+            : m_out(NULL), m_rawSize(0)
+        {
+        }
+
+        template <typename T>
+        void Write(T value)
+        {
+            const char* bytes = reinterpret_cast<const char*>(&value);
+            m_buffer.insert(m_buffer.end(), bytes, bytes + sizeof(T));
+            m_rawSize += sizeof(T);
+            if (m_buffer.size() >= VTK_BLOCK_SIZE) {
+                WriteBlock(VTK_BLOCK_SIZE);
+            }
+        }
+
+        void Finish()
+        {
+            while (!m_buffer.empty()) {
+                WriteBlock(std::min(m_buffer.size(), VTK_BLOCK_SIZE));
+            }
+        }
+
+        // number of bytes, the compressed data take in the file, including the header
+        uint64_t CompressedByteCount() const
+        {
+            return (3 + m_compressedSizes.size()) * sizeof(uint64_t) + m_compressedData.size();
+        }
+
+        void WriteCompressed(std::ostream& out) const
+        {
+            const uint64_t nBlocks = m_compressedSizes.size();
+            const uint64_t blockSize = VTK_BLOCK_SIZE;
+            const uint64_t lastBlockSize = m_rawSize % VTK_BLOCK_SIZE;
+            out.write(reinterpret_cast<const char*>(&nBlocks), sizeof(uint64_t));
+            out.write(reinterpret_cast<const char*>(&blockSize), sizeof(uint64_t));
+            out.write(reinterpret_cast<const char*>(&lastBlockSize), sizeof(uint64_t));
+            if (nBlocks > 0) {
+                out.write(reinterpret_cast<const char*>(&m_compressedSizes[0]), nBlocks * sizeof(uint64_t));
+                out.write(&m_compressedData[0], m_compressedData.size());
+            }
+        }
+
+    private:
+        void WriteBlock(size_t size)
+        {
+            if (m_out) {
+                m_out->write(&m_buffer[0], size);
+            }
+            else {
+#ifdef ZLIB_FOUND
+                uLongf compressedSize = compressBound(static_cast<uLong>(size));
+                const size_t oldSize = m_compressedData.size();
+                m_compressedData.resize(oldSize + compressedSize);
+                int ret = compress2(reinterpret_cast<Bytef*>(&m_compressedData[oldSize]), &compressedSize,
+                                    reinterpret_cast<const Bytef*>(&m_buffer[0]), static_cast<uLong>(size), Z_DEFAULT_COMPRESSION);
+                if (ret != Z_OK) {
+                    throw tigl::CTiglError("Error compressing vtk data in AppendedDataSink::WriteBlock", TIGL_ERROR);
+                }
+                m_compressedData.resize(oldSize + compressedSize);
+                m_compressedSizes.push_back(compressedSize);
+#else
+                throw tigl::CTiglError("TiGL was built without zlib support in AppendedDataSink::WriteBlock", TIGL_ERROR);
+#endif
+            }
+            m_buffer.erase(m_buffer.begin(), m_buffer.begin() + size);
+        }
+
+        std::ostream* m_out;
+        uint64_t m_rawSize;
+        std::vector<char> m_buffer;
+        std::vector<uint64_t> m_compressedSizes;
+        std::vector<char> m_compressedData;
+    };
+
+    // A vtk data array, that is written to the appended data section
+    struct AppendedDataArray
+    {
+        AppendedDataArray(const std::string& section, const std::string& type, const std::string& name,
+                          int nComponents, uint64_t nBytes, std::function<void(AppendedDataSink&)> writeValues)
+            : section(section), type(type), name(name), nComponents(nComponents), nBytes(nBytes), writeValues(writeValues), offset(0)
+        {
+        }
+
+        std::string section;   // the xml element the array belongs to
+        std::string type;
+        std::string name;
+        int nComponents;
+        uint64_t nBytes;       // uncompressed size of the data
+        std::function<void(AppendedDataSink&)> writeValues;
+        uint64_t offset;       // offset in the appended data section
+        std::shared_ptr<AppendedDataSink> compressed;
+    };
+
+    void writeDataArrayHeaders(std::ostream& out, const std::vector<AppendedDataArray>& arrays, const std::string& section)
+    {
+        for (std::vector<AppendedDataArray>::const_iterator it = arrays.begin(); it != arrays.end(); ++it) {
+            if (it->section != section) {
+                continue;
+            }
+            out << "        <DataArray type=\"" << it->type << "\" Name=\"" << xmlEscape(it->name) << "\"";
+            if (it->nComponents > 1) {
+                out << " NumberOfComponents=\"" << it->nComponents << "\"";
+            }
+            out << " format=\"appended\" offset=\"" << it->offset << "\"/>\n";
+        }
+    }
+
+    /**
+     * Writes a vtk file with raw binary appended data piece by piece.
+     *
+     * The xml headers of all pieces precede the appended data section. Hence, the
+     * headers are collected in memory, while the data arrays are written to a temporary
+     * file, which is copied behind the headers in Finish. A piece can be released
+     * directly after AddPiece.
+     */
+    class AppendedDataWriter
+    {
+    public:
+        AppendedDataWriter(const std::string& filename, bool compress)
+            : m_filename(filename)
+            , m_dataFilename(filename + ".appended.tmp")
+            , m_compress(compress)
+            , m_offset(0)
+        {
+#ifndef ZLIB_FOUND
+            if (m_compress) {
+                LOG(WARNING) << "TiGL was built without zlib. The vtk file will not be compressed." << std::endl;
+                m_compress = false;
+            }
+#endif
+            m_data.open(m_dataFilename.c_str(), std::ios::in | std::ios::out | std::ios::binary | std::ios::trunc);
+            if (!m_data) {
+                LOG(ERROR) << "Cannot open file " << m_dataFilename << " for writing." << std::endl;
+            }
+        }
+
+        ~AppendedDataWriter()
+        {
+            if (m_data.is_open()) {
+                m_data.close();
+            }
+            std::remove(m_dataFilename.c_str());
+        }
+
+        bool IsOpen() const
+        {
+            return m_data.is_open();
+        }
+
+        // writes the data arrays of the piece to the temporary file and stores its xml header
+        void AddPiece(const tigl::CTiglPolyObject& co)
+        {
+            if (co.getNPolygons() == 0) {
+                return;
+            }
+
+            uint64_t nvert = 0;
+            for (unsigned long iPoly = 0; iPoly < co.getNPolygons(); ++iPoly) {
+                nvert += co.getNPointsOfPolygon(iPoly);
+            }
+
+            std::vector<AppendedDataArray> arrays;
+            if (co.hasNormals()) {
+                arrays.push_back(AppendedDataArray("PointData", "Float64", "surf_normals", 3, 3 * sizeof(double) * co.getNVertices(),
+                                                   [&co](AppendedDataSink& sink) {
+                    for (unsigned long i = 0; i < co.getNVertices(); ++i) {
+                        const tigl::CTiglPoint& n = co.getVertexNormal(i);
+                        sink.Write(n.x);
+                        sink.Write(n.y);
+                        sink.Write(n.z);
+                    }
+                }));
+            }
+
+            for (unsigned int iData = 0; iData < co.getNumberOfPolyRealData(); ++iData) {
+                const std::string dataField = co.getPolyDataFieldName(iData);
+                arrays.push_back(AppendedDataArray("CellData", "Float64", dataField, 1, sizeof(double) * co.getNPolygons(),
+                                                   [&co, dataField](AppendedDataSink& sink) {
+                    for (unsigned long jPoly = 0; jPoly < co.getNPolygons(); ++jPoly) {
+                        sink.Write(co.getPolyDataReal(jPoly, dataField.c_str()));
+                    }
+                }));
+            }
+
+            arrays.push_back(AppendedDataArray("Points", "Float64", "Points", 3, 3 * sizeof(double) * co.getNVertices(),
+                                               [&co](AppendedDataSink& sink) {
+                for (unsigned long i = 0; i < co.getNVertices(); ++i) {
+                    const tigl::CTiglPoint& p = co.getVertexPoint(i);
+                    sink.Write(p.x);
+                    sink.Write(p.y);
+                    sink.Write(p.z);
+                }
+            }));
+
+            arrays.push_back(AppendedDataArray("Polys", "Int64", "connectivity", 1, sizeof(int64_t) * nvert,
+                                               [&co](AppendedDataSink& sink) {
+                for (unsigned long iPoly = 0; iPoly < co.getNPolygons(); ++iPoly) {
+                    for (unsigned long jPoint = 0; jPoint < co.getNPointsOfPolygon(iPoly); ++jPoint) {
+                        sink.Write(static_cast<int64_t>(co.getVertexIndexOfPolygon(jPoint, iPoly)));
+                    }
+                }
+            }));
+
+            arrays.push_back(AppendedDataArray("Polys", "Int64", "offsets", 1, sizeof(int64_t) * co.getNPolygons(),
+                                               [&co](AppendedDataSink& sink) {
+                int64_t next = 0;
+                for (unsigned long iPoly = 0; iPoly < co.getNPolygons(); ++iPoly) {
+                    next += co.getNPointsOfPolygon(iPoly);
+                    sink.Write(next);
+                }
+            }));
+
+            // write the data. With compression, only one compressed array is kept in memory.
+            for (std::vector<AppendedDataArray>::iterator it = arrays.begin(); it != arrays.end(); ++it) {
+                it->offset = m_offset;
+                if (m_compress) {
+                    AppendedDataSink compressed;
+                    it->writeValues(compressed);
+                    compressed.Finish();
+                    compressed.WriteCompressed(m_data);
+                    m_offset += compressed.CompressedByteCount();
+                }
+                else {
+                    m_data.write(reinterpret_cast<const char*>(&it->nBytes), sizeof(uint64_t));
+                    AppendedDataSink sink(m_data);
+                    it->writeValues(sink);
+                    sink.Finish();
+                    m_offset += sizeof(uint64_t) + it->nBytes;
+                }
+            }
+
+            // write the xml header of the piece
+            m_pieces << "    <Piece NumberOfPoints=\"" << co.getNVertices() << "\" NumberOfVerts=\"0\" NumberOfLines=\"0\""
+                     << " NumberOfStrips=\"0\" NumberOfPolys=\"" << co.getNPolygons() << "\">\n";
+            if (co.hasNormals()) {
+                m_pieces << "      <PointData Normals=\"surf_normals\">\n";
+                writeDataArrayHeaders(m_pieces, arrays, "PointData");
+                m_pieces << "      </PointData>\n";
+            }
+            if (co.getNumberOfPolyRealData() > 0) {
+                m_pieces << "      <CellData>\n";
+                writeDataArrayHeaders(m_pieces, arrays, "CellData");
+                m_pieces << "      </CellData>\n";
+            }
+            m_pieces << "      <Points>\n";
+            writeDataArrayHeaders(m_pieces, arrays, "Points");
+            m_pieces << "      </Points>\n";
+            m_pieces << "      <Polys>\n";
+            writeDataArrayHeaders(m_pieces, arrays, "Polys");
+            if (co.hasMetadata()) {
+                m_pieces << "        <MetaData elements=\"" << xmlEscape(co.getMetadataElements()) << "\">\n";
+                for (unsigned long iPoly = 0; iPoly < co.getNPolygons(); ++iPoly) {
+                    m_pieces << "            " << xmlEscape(co.getPolyMetadata(iPoly)) << "\n";
+                }
+                m_pieces << "        </MetaData>\n";
+            }
+            m_pieces << "      </Polys>\n";
+            m_pieces << "    </Piece>\n";
+        }
+
+        // writes the vtk file from the piece headers and the temporary data file
+        bool Finish()
+        {
+            if (!m_data) {
+                return false;
+            }
+
+            std::ofstream out(m_filename.c_str(), std::ios::out | std::ios::binary);
+            if (!out) {
+                LOG(ERROR) << "Cannot open file " << m_filename << " for writing." << std::endl;
+                return false;
+            }
+
+            std::stringstream creator;
+            creator << "tigl " << tiglGetVersion();
+
+            out << "<?xml version=\"1.0\"?>\n";
+            out << "<VTKFile type=\"PolyData\" version=\"1.0\" byte_order=\"" << (isLittleEndian() ? "LittleEndian" : "BigEndian") << "\""
+                << " header_type=\"UInt64\"";
+            if (m_compress) {
+                out << " compressor=\"vtkZLibDataCompressor\"";
+            }
+            out << ">\n";
+            out << "  <MetaData creator=\"" << xmlEscape(creator.str()) << "\"/>\n";
+            out << "  <PolyData>\n";
+            out << m_pieces.str();
+            out << "  </PolyData>\n";
+
+            // copy the binary data
+            out << "  <AppendedData encoding=\"raw\">\n   _";
+            if (m_offset > 0) {
+                m_data.flush();
+                m_data.seekg(0);
+                out << m_data.rdbuf();
+            }
+            out << "\n  </AppendedData>\n";
+            out << "</VTKFile>\n";
+
+            return out.good();
+        }
+
+    private:
+        std::string m_filename;
+        std::string m_dataFilename;
+        bool m_compress;
+        std::fstream m_data;          // the appended data of the pieces added so far
+        std::ostringstream m_pieces;  // the xml headers of the pieces added so far
+        uint64_t m_offset;            // offset of the next data array in the appended data section
+    };
+
     void setMinMax(const tigl::CTiglPoint& p, double* oldmin, double* oldmax)
     {
         if (p.x > *oldmax) {
@@ -108,66 +482,108 @@ CTiglExportVtk::~CTiglExportVtk()
 
 bool CTiglExportVtk::WriteImpl(const std::string &filename) const
 {
-    TixiDocumentHandle handle;
-    tixiCreateDocument("VTKFile", &handle);
-    writeVTKHeader(handle);
-
     size_t nTotalVertices = 0;
     size_t nTotalPolys = 0;
 
     bool multiplePieces = GlobalExportOptions().Get<bool>("MultiplePieces");
     bool normalsEnabled = GlobalExportOptions().Get<bool>("WriteNormals");
+    bool writeBinary = GlobalExportOptions().Get<bool>("WriteBinary");
+    bool compress = GlobalExportOptions().Get<bool>("CompressBinary");
+    bool runParallel = GlobalExportOptions().Get<bool>("ParallelMeshing");
 
     ComponentTraingMode myMode = NO_INFO;
     if (GlobalExportOptions().Get<bool>("WriteMetaData")) {
         myMode = SEGMENT_INFO;
     }
 
-    if (multiplePieces) {
-        for (unsigned int i = 0; i < NShapes(); ++i) {
-            // Do the meshing
-            PNamedShape pshape = GetShape(i);
-            double deflection = GetOptions(i).Get<double>("Deflection");
-
-            const CTiglUIDManager* mgr = GetConfiguration(i) ? &(GetConfiguration(i)->GetUIDManager()) : NULL;
-            CTiglTriangularizer mesher(mgr, pshape, deflection, myMode, normalsEnabled);
-            const CTiglPolyData& polys = mesher.getTriangulation();
-            writeVTKPiece(polys.currentObject(), handle, i + 1);
-
-            nTotalVertices += polys.getTotalVertexCount();
-            nTotalPolys += polys.getTotalPolygonCount();
+    // the pieces are written as soon as they are meshed
+    std::function<void(const CTiglPolyObject&)> writePiece;
+    std::function<bool()> finish;
+
+    unique_ptr<AppendedDataWriter> appendedWriter;
+    TixiDocumentHandle handle = -1;
+    unsigned int nAsciiPieces = 0;
+    if (writeBinary) {
+        appendedWriter = make_unique<AppendedDataWriter>(filename, compress);
+        if (!appendedWriter->IsOpen()) {
+            return false;
         }
+        AppendedDataWriter& writer = *appendedWriter;
+        writePiece = [&writer](const CTiglPolyObject& co) {
+            writer.AddPiece(co);
+        };
+        finish = [&writer]() {
+            return writer.Finish();
+        };
     }
     else {
-        double minDeflection = FLT_MAX;
-        ListPNamedShape shapes;
-        for (unsigned int i = 0; i < NShapes(); ++i) {
-            shapes.push_back(GetShape(i));
-            double deflection = GetOptions(i).Get<double>("Deflection");
-            if (deflection < minDeflection) {
-                minDeflection = deflection;
+        tixiCreateDocument("VTKFile", &handle);
+        writeVTKHeader(handle);
+        writePiece = [&handle, &nAsciiPieces](const CTiglPolyObject& co) {
+            if (writeVTKPiece(co, handle, nAsciiPieces + 1)) {
+                nAsciiPieces++;
+            }
+        };
+        finish = [&handle, &filename]() {
+            return tixiSaveDocument(handle, filename.c_str()) == SUCCESS;
+        };
+    }
+
+    // meshes the shape and writes it. The triangulation is released before the next shape is meshed.
+    auto meshAndWrite = [&](const CTiglUIDManager* mgr, PNamedShape shape, double deflection) {
+        CTiglTriangularizer mesher(mgr, shape, deflection, myMode, normalsEnabled, runParallel);
+        const CTiglPolyData& polys = mesher.getTriangulation();
+        nTotalVertices += polys.getTotalVertexCount();
+        nTotalPolys += polys.getTotalPolygonCount();
+        writePiece(polys.currentObject());
+    };
+
+    bool success = false;
+    try {
+        if (multiplePieces) {
+            for (unsigned int i = 0; i < NShapes(); ++i) {
+                double deflection = GetOptions(i).Get<double>("Deflection");
+                const CTiglUIDManager* mgr = GetConfiguration(i) ? &(GetConfiguration(i)->GetUIDManager()) : NULL;
+                meshAndWrite(mgr, GetShape(i), deflection);
             }
         }
-  
-        // search for the first uid manager available
-        const CTiglUIDManager* mgr = NULL;
-        for (unsigned int i = 0; i < NShapes(); ++i) {
-            if (GetConfiguration(i)) {
-                mgr = &(GetConfiguration(i)->GetUIDManager());
-                break;
+        else {
+            double minDeflection = FLT_MAX;
+            ListPNamedShape shapes;
+            for (unsigned int i = 0; i < NShapes(); ++i) {
+                shapes.push_back(GetShape(i));
+                double deflection = GetOptions(i).Get<double>("Deflection");
+                if (deflection < minDeflection) {
+                    minDeflection = deflection;
+                }
+            }
+
+            // search for the first uid manager available
+            const CTiglUIDManager* mgr = NULL;
+            for (unsigned int i = 0; i < NShapes(); ++i) {
+                if (GetConfiguration(i)) {
+                    mgr = &(GetConfiguration(i)->GetUIDManager());
+                    break;
+                }
             }
+
+            meshAndWrite(mgr, CGroupShapes(shapes), minDeflection);
         }
 
-        PNamedShape groupedShape = CGroupShapes(shapes);
-        CTiglTriangularizer mesher(mgr, groupedShape, minDeflection, myMode, normalsEnabled);
-        const CTiglPolyData& polys = mesher.getTriangulation();
-        writeVTKPiece(polys.currentObject(), handle, 1);
+        success = finish();
+    }
+    catch (...) {
+        if (handle >= 0) {
+            tixiCloseDocument(handle);
+        }
+        throw;
+    }
 
-        nTotalVertices += polys.getTotalVertexCount();
-        nTotalPolys += polys.getTotalPolygonCount();
+    if (handle >= 0) {
+        tixiCloseDocument(handle);
     }
-    
-    if (tixiSaveDocument(handle, filename.c_str())!= SUCCESS) {
+
+    if (!success) {
         return false;
     }
     LOG(INFO) << "VTK Export succeeded with " << nTotalPolys
@@ -175,21 +591,56 @@ bool CTiglExportVtk::WriteImpl(const std::string &filename) const
     return true;
 }
 
-void CTiglExportVtk::WritePolys(const CTiglPolyData& polys, const char *filename)
+void CTiglExportVtk::WritePolys(const CTiglPolyData& polys, const char *filename, bool binary, bool compress)
 {
-    TixiDocumentHandle handle;
-    tixiCreateDocument("VTKFile", &handle);
-    writeVTKHeader(handle);
+    std::vector<const CTiglPolyObject*> objects;
     for (unsigned int iObj = 1; iObj <= polys.getNObjects(); ++iObj) {
-        writeVTKPiece(polys.getObject(iObj), handle, iObj);
+        objects.push_back(&polys.getObject(iObj));
     }
-    if (tixiSaveDocument(handle, filename)!= SUCCESS) {
+
+    bool success = binary ? writeVTKAppended(objects, filename, compress) : writeVTKAscii(objects, filename);
+    if (!success) {
         throw CTiglError("Error saving vtk file!");
     }
     LOG(INFO) << "VTK Export succeeded with " << polys.getTotalPolygonCount()
               << " polygons and " << polys.getTotalVertexCount() << " vertices." << std::endl;
 }
 
+bool CTiglExportVtk::writeVTKAscii(const std::vector<const CTiglPolyObject*>& objects, const std::string& filename)
+{
+    TixiDocumentHandle handle;
+    tixiCreateDocument("VTKFile", &handle);
+    writeVTKHeader(handle);
+    unsigned int nPieces = 0;
+    for (unsigned int iObj = 0; iObj < objects.size(); ++iObj) {
+        if (writeVTKPiece(*objects[iObj], handle, nPieces + 1)) {
+            nPieces++;
+        }
+    }
+    bool success = tixiSaveDocument(handle, filename.c_str()) == SUCCESS;
+    tixiCloseDocument(handle);
+    return success;
+}
+
+/**
+ * Streams the polygon data as vtk xml file with raw binary appended data.
+ *
+ * In contrast to writeVTKAscii, no xml document is built in memory. The data arrays
+ * are written directly from the polygon objects to the file.
+ */
+bool CTiglExportVtk::writeVTKAppended(const std::vector<const CTiglPolyObject*>& objects, const std::string& filename, bool compress)
+{
+    AppendedDataWriter writer(filename, compress);
+    if (!writer.IsOpen()) {
+        return false;
+    }
+
+    for (std::vector<const CTiglPolyObject*>::const_iterator it = objects.begin(); it != objects.end(); ++it) {
+        writer.AddPiece(**it);
+    }
+    return writer.Finish();
+}
+
 void CTiglExportVtk::writeVTKHeader(TixiDocumentHandle& handle)
 {
     tixiAddTextAttribute(handle, "/VTKFile", "type", "PolyData");
@@ -205,11 +656,12 @@ void CTiglExportVtk::writeVTKHeader(TixiDocumentHandle& handle)
     tixiCreateElement(handle, "/VTKFile", "PolyData");
 }
 
-// writes the polygon data of a surface (in vtk they call it piece)
-void CTiglExportVtk::writeVTKPiece(const CTiglPolyObject& co, TixiDocumentHandle& handle, unsigned int iObject)
+// writes the polygon data of a surface (in vtk they call it piece).
+// Returns false, if the surface is empty and no piece was written.
+bool CTiglExportVtk::writeVTKPiece(const CTiglPolyObject& co, TixiDocumentHandle& handle, unsigned int iObject)
 {
     if (co.getNPolygons() == 0) {
-        return;
+        return false;
     }
 
     // count number of vertices - this is not necessarily the number of points
@@ -219,7 +671,7 @@ void CTiglExportVtk::writeVTKPiece(const CTiglPolyObject& co, TixiDocumentHandle
     }
 
     if (nvert <= 0) {
-        return;
+        return false;
     }
 
     // surface specific stuff
@@ -363,6 +815,8 @@ void CTiglExportVtk::writeVTKPiece(const CTiglPolyObject& co, TixiDocumentHandle
         tmpPath += "/MetaData";
         tixiAddTextAttribute(handle, tmpPath.c_str(), "elements", co.getMetadataElements() );
     }
+
+    return true;
 }
 
 } // end namespace tigl
@@ -28,6 +28,7 @@
 
 #include <string>
 #include <map>
+#include <vector>
 
 namespace tigl 
 {
@@ -43,6 +44,12 @@ public:
         AddOption("WriteNormals", true);
         AddOption("MultiplePieces", false);
         AddOption("WriteMetaData", true);
+        // streams the data as raw binary appended data instead of ascii
+        AddOption("WriteBinary", false);
+        // zlib compression of the binary data, requires WriteBinary
+        AddOption("CompressBinary", false);
+        // mesh and annotate the faces using all cores
+        AddOption("ParallelMeshing", false);
 
         Set("ApplySymmetries", true);
         Set("IncludeFarfield", false);
@@ -63,7 +70,8 @@ public:
     TIGL_EXPORT virtual ~CTiglExportVtk();
 
     /// Exports a polygonal data representation directly
-    TIGL_EXPORT static void WritePolys(const CTiglPolyData& polys, const char * filename);
+    /// If binary is true, the data are streamed as raw binary appended data, optionally zlib compressed
+    TIGL_EXPORT static void WritePolys(const CTiglPolyData& polys, const char * filename, bool binary = false, bool compress = false);
 
 private:
     bool WriteImpl(const std::string& filename) const OVERRIDE;
@@ -73,8 +81,10 @@ private:
         return "vtp;vtk";
     }
 
-    static void writeVTKPiece(const CTiglPolyObject& co, TixiDocumentHandle& handle, unsigned int iObject); 
+    static bool writeVTKPiece(const CTiglPolyObject& co, TixiDocumentHandle& handle, unsigned int iObject);
     static void writeVTKHeader(TixiDocumentHandle& handle);
+    static bool writeVTKAscii(const std::vector<const CTiglPolyObject*>& objects, const std::string& filename);
+    static bool writeVTKAppended(const std::vector<const CTiglPolyObject*>& objects, const std::string& filename, bool compress);
 };
 
 } // end namespace tigl
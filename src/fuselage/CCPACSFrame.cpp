@@ -129,9 +129,7 @@ void CCPACSFrame::BuildGeometry(TopoDS_Shape& cache, bool just1DElements) const
         // create a frame in the fuselage, following the path described by all the positions in frame/frameposition[]
 
         // place every point on the fuselage loft
-        std::vector<gp_Lin> pointList;
-        for (size_t i = 0; i < m_framePositions.size(); i++)
-            pointList.push_back(fuselage.Intersection(*m_framePositions[i]));
+        const std::vector<gp_Lin> pointList = fuselage.Intersections(m_framePositions);
 
         // with a ShapeExtend_WireData, the individual segment orientation is not crucial during the wire building
         Handle(ShapeExtend_WireData) wirePath = new ShapeExtend_WireData;
@@ -34,14 +34,13 @@
 #include "CTiglCurveConnector.h"
 #include "CTiglMakeLoft.h"
 #include "CTiglBSplineAlgorithms.h"
+#include "tiglparallel.h"
 
 #include "BRepOffsetAPI_ThruSections.hxx"
 #include "BRepAlgoAPI_Fuse.hxx"
 #include "ShapeFix_Shape.hxx"
-#include "GProp_GProps.hxx"
 #include "BRep_Tool.hxx"
 #include "BRepTools.hxx"
-#include "BRepGProp.hxx"
 #include "BRepBuilderAPI_Transform.hxx"
 #include "Geom_TrimmedCurve.hxx"
 #include "TopoDS_Edge.hxx"
@@ -54,10 +53,13 @@
 #include "TopExp.hxx"
 #include "TopTools_IndexedMapOfShape.hxx"
 #include <TopExp_Explorer.hxx>
-#include <IntCurvesFace_Intersector.hxx>
 #include <BRepBuilderAPI_MakeVertex.hxx>
 #include <BRepProj_Projection.hxx>
 #include <TopTools_ListIteratorOfListOfShape.hxx>
+#include <Precision.hxx>
+#include <gp_Vec.hxx>
+
+#include <boost/thread/lock_guard.hpp>
 
 
 namespace tigl
@@ -66,7 +68,8 @@ namespace tigl
 CCPACSFuselage::CCPACSFuselage(CCPACSFuselages* parent, CTiglUIDManager* uidMgr)
     : generated::CPACSFuselage(parent, uidMgr)
     , CTiglRelativelyPositionedComponent(&m_parentUID, &m_transformation, &m_symmetry)
-    , guideCurves(*this, &CCPACSFuselage::BuildGuideCurves) {
+    , guideCurves(*this, &CCPACSFuselage::BuildGuideCurves)
+    , surfaceArea(0.) {
     Cleanup();
     if (parent->IsParent<CCPACSAircraftModel>())
         configuration = &parent->GetParent<CCPACSAircraftModel>()->GetConfiguration();
@@ -83,8 +86,12 @@ CCPACSFuselage::~CCPACSFuselage()
 // Invalidates internal state
 void CCPACSFuselage::Invalidate()
 {
-    loft.clear();
+    CTiglAbstractGeometricComponent::Reset();
     guideCurves.clear();
+    {
+        boost::lock_guard<boost::mutex> lock(localGeometryMutex);
+        localGeometry.reset();
+    }
     m_segments.Invalidate();
     if (m_positionings)
         m_positionings->Invalidate();
@@ -92,6 +99,46 @@ void CCPACSFuselage::Invalidate()
         m_structure->Invalidate();
 }
 
+// Invalidates only the geometry depending on the given section element
+void CCPACSFuselage::InvalidateSectionElement(const std::string& elementUID)
+{
+    for (int i = 1; i <= m_segments.GetSegmentCount(); ++i) {
+        CCPACSFuselageSegment& segment = m_segments.GetSegment(i);
+        // segments, that are not lofted linearly, are cut from the fuselage loft
+        if (segment.GetFromElementUID() == elementUID || segment.GetToElementUID() == elementUID
+            || !segment.IsLoftedLinearly()) {
+            segment.Invalidate();
+        }
+    }
+
+    // the fuselage loft, its structure and the fused aircraft depend on all segments
+    CTiglAbstractGeometricComponent::Reset();
+    guideCurves.clear();
+    {
+        boost::lock_guard<boost::mutex> lock(localGeometryMutex);
+        localGeometry.reset();
+    }
+    if (m_structure)
+        m_structure->Invalidate();
+    configuration->InvalidateFusedAircraft();
+}
+
+void CCPACSFuselage::EvictDerivedGeometry()
+{
+    for (int i = 1; i <= m_segments.GetSegmentCount(); ++i) {
+        CCPACSFuselageSegment& segment = m_segments.GetSegment(i);
+        if (!segment.IsLoftedLinearly()) {
+            segment.EvictLoft();
+        }
+    }
+    {
+        // the local geometry keeps the global loft and an unaccounted copy of it
+        boost::lock_guard<boost::mutex> lock(localGeometryMutex);
+        localGeometry.reset();
+    }
+    surfaceAreaLoft.reset();
+}
+
 // Cleanup routine
 void CCPACSFuselage::Cleanup()
 {
@@ -136,12 +183,31 @@ PNamedShape CCPACSFuselage::GetLoft(TiglCoordinateSystem cs) const
         return loft;
     }
     else {
+        return GetLocalGeometry()->loft;
+    }
+}
+
+CSharedPtr<const CCPACSFuselage::LocalGeometry> CCPACSFuselage::GetLocalGeometry() const
+{
+    const PNamedShape globalLoft = CTiglRelativelyPositionedComponent::GetLoft();
+    if (!globalLoft) {
+        throw CTiglError("Fuselage loft could not be built in CCPACSFuselage::GetLocalGeometry", TIGL_ERROR);
+    }
+
+    boost::lock_guard<boost::mutex> lock(localGeometryMutex);
+    if (!localGeometry || localGeometry->globalLoft != globalLoft) {
+        CSharedPtr<LocalGeometry> geometry(new LocalGeometry);
+        geometry->globalLoft = globalLoft;
+
         // we want to modify the shape. we have to create a copy first
-        loft = loft->DeepCopy();
-        TopoDS_Shape transformedLoft = GetTransformationMatrix().Inverted().Transform(loft->Shape());
-        loft->SetShape(transformedLoft);
-        return loft;
+        geometry->loft = globalLoft->DeepCopy();
+        TopoDS_Shape transformedLoft = GetTransformationMatrix().Inverted().Transform(geometry->loft->Shape());
+        geometry->loft->SetShape(transformedLoft);
+
+        geometry->rayCaster.SetShape(transformedLoft, 0.1);
+        localGeometry = geometry;
     }
+    return localGeometry;
 }
 
 // Get section count
@@ -286,13 +352,7 @@ gp_Pnt CCPACSFuselage::GetPoint(int segmentIndex, double eta, double zeta)
 // Returns the volume of this fuselage
 double CCPACSFuselage::GetVolume()
 {
-    const TopoDS_Shape fusedSegments = GetLoft()->Shape();
-
-    // Calculate volume
-    GProp_GProps System;
-    BRepGProp::VolumeProperties(fusedSegments, System);
-    double myVolume = System.Mass();
-    return myVolume;
+    return GetIntegralProperties(TIGL_INTEGRATION_EXACT).volume;
 }
 
 // Returns the circumference of the segment "segmentIndex" at a given eta
@@ -304,24 +364,28 @@ double CCPACSFuselage::GetCircumference(const int segmentIndex, const double eta
 // Returns the surface area of this fuselage
 double CCPACSFuselage::GetSurfaceArea()
 {
-    const PNamedShape& fusedSegments = GetLoft();
+    const PNamedShape fusedSegments = GetLoft();
+    if (surfaceAreaLoft == fusedSegments) {
+        return surfaceArea;
+    }
 
-    // loop over all faces that are not symmetry, front or rear
-    double myArea = 0.;
+    // collect all faces that are not symmetry, front or rear
+    TopoDS_Compound faces;
+    BRep_Builder builder;
+    builder.MakeCompound(faces);
 
     TopTools_IndexedMapOfShape shapeMap;
     TopExp::MapShapes(fusedSegments->Shape(), TopAbs_FACE, shapeMap);
     for (int i = 1; i <= shapeMap.Extent(); ++i) {
         if (GetUID() == fusedSegments->GetFaceTraits(i-1).Name()) {
-            const TopoDS_Face& f = TopoDS::Face(shapeMap(i));
-            GProp_GProps System;
-            BRepGProp::SurfaceProperties(f, System);
-            myArea += System.Mass();
+            builder.Add(faces, shapeMap(i));
         }
     }
 
     // Calculate surface area
-    return myArea;
+    surfaceArea     = ComputeIntegralProperties(faces, TIGL_INTEGRATION_EXACT).surfaceArea;
+    surfaceAreaLoft = fusedSegments;
+    return surfaceArea;
 }
 
 // Returns the point where the distance between the selected fuselage and the ground is at minimum.
@@ -423,23 +487,16 @@ gp_Lin CCPACSFuselage::Intersection(gp_Pnt pRef, double angleRef) const
     // build a line to position the intersection with the fuselage shape
     gp_Lin line(pRef, angleDir);
 
-    // fuselage loft
-    const TopoDS_Shape loft = GetLoft(FUSELAGE_COORDINATE_SYSTEM)->Shape();
-
-    // get the list of shape from the fuselage shape
-    TopExp_Explorer exp;
-    for (exp.Init(loft, TopAbs_FACE); exp.More(); exp.Next()) {
-        IntCurvesFace_Intersector intersection(TopoDS::Face(exp.Current()), 0.1); // intersection builder
-        intersection.Perform(line, 0, std::numeric_limits<Standard_Real>::max());
-        if (intersection.IsDone() && intersection.NbPnt() > 0) {
-            gp_Lin result(intersection.Pnt(1), line.Direction());
-            // return the line with the point on the fuselage as the origin, and the previous line's direction
-            return result;
-        }
+    // intersect with the faces of the fuselage loft
+    const CSharedPtr<const LocalGeometry> geometry = GetLocalGeometry();
+    gp_Pnt intersection;
+    if (geometry->rayCaster.Perform(line, intersection)) {
+        // return the line with the point on the fuselage as the origin, and the previous line's direction
+        return gp_Lin(intersection, line.Direction());
     }
 
     TRACE_POINT(debug);
-    debug.dumpShape(loft, "loft");
+    debug.dumpShape(geometry->loft->Shape(), "loft");
     debug.dumpShape(BRepBuilderAPI_MakeEdge(pRef, pRef.XYZ() + angleDir.XYZ() * 1000), "line");
 
     throw std::logic_error("Error computing intersection line");
@@ -452,6 +509,83 @@ gp_Lin CCPACSFuselage::Intersection(const CCPACSFuselageStringerFramePosition& p
     return Intersection(pRef, angleRefRad);
 }
 
+std::vector<gp_Lin> CCPACSFuselage::Intersections(const std::vector<gp_Pnt>& pRefs, const std::vector<double>& anglesRef, int nThreads) const
+{
+    if (pRefs.size() != anglesRef.size()) {
+        throw CTiglError("Number of reference points and angles differ in CCPACSFuselage::Intersections", TIGL_ERROR);
+    }
+
+    std::vector<gp_Lin> result(pRefs.size());
+    if (result.empty()) {
+        return result;
+    }
+
+    // build the loft and the ray caster before going parallel
+    result[0] = Intersection(pRefs[0], anglesRef[0]);
+    ParallelFor(pRefs.size() - 1, [&](size_t i) {
+        result[i + 1] = Intersection(pRefs[i + 1], anglesRef[i + 1]);
+    }, nThreads);
+
+    return result;
+}
+
+std::vector<gp_Lin> CCPACSFuselage::Intersections(const std::vector<unique_ptr<CCPACSFuselageStringerFramePosition> >& positions, int nThreads) const
+{
+    std::vector<gp_Pnt> pRefs;
+    std::vector<double> anglesRef;
+    for (size_t i = 0; i < positions.size(); ++i) {
+        pRefs.push_back(positions[i]->GetRefPoint());
+        anglesRef.push_back((M_PI / 180.) * positions[i]->GetReferenceAngle());
+    }
+    return Intersections(pRefs, anglesRef, nThreads);
+}
+
+namespace
+{
+    gp_Lin transformRay(const CTiglTransformation& transformation, const gp_Lin& ray)
+    {
+        const gp_Pnt origin = transformation.Transform(ray.Location());
+        const gp_Vec direction(origin, transformation.Transform(gp_Pnt(ray.Location().XYZ() + ray.Direction().XYZ())));
+        if (direction.Magnitude() < Precision::Confusion()) {
+            throw CTiglError("Degenerated ray direction in CCPACSFuselage::IntersectRays", TIGL_MATH_ERROR);
+        }
+        return gp_Lin(origin, gp_Dir(direction));
+    }
+}
+
+bool CCPACSFuselage::IntersectRay(const gp_Lin& globalRay, gp_Pnt& globalIntersection) const
+{
+    std::vector<gp_Pnt> intersections;
+    std::vector<bool> hits;
+    IntersectRays(std::vector<gp_Lin>(1, globalRay), intersections, hits);
+    if (hits[0]) {
+        globalIntersection = intersections[0];
+    }
+    return hits[0];
+}
+
+void CCPACSFuselage::IntersectRays(const std::vector<gp_Lin>& globalRays, std::vector<gp_Pnt>& globalIntersections,
+                                   std::vector<bool>& hits, int nThreads) const
+{
+    // the ray caster works on the loft in fuselage coordinates
+    const CTiglTransformation toGlobal = GetTransformationMatrix();
+    const CTiglTransformation toLocal  = toGlobal.Inverted();
+
+    std::vector<gp_Lin> localRays;
+    localRays.reserve(globalRays.size());
+    for (size_t i = 0; i < globalRays.size(); ++i) {
+        localRays.push_back(transformRay(toLocal, globalRays[i]));
+    }
+
+    GetLocalGeometry()->rayCaster.Perform(localRays, globalIntersections, hits, nThreads);
+
+    for (size_t i = 0; i < globalIntersections.size(); ++i) {
+        if (hits[i]) {
+            globalIntersections[i] = toGlobal.Transform(globalIntersections[i]);
+        }
+    }
+}
+
 namespace
 {
     TopoDS_Wire project(TopoDS_Shape wireOrEdge, BRepProj_Projection& proj, DebugScope& debug)
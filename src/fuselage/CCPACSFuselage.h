@@ -35,12 +35,19 @@
 #include "CCPACSGuideCurve.h"
 #include "CTiglFuselageConnection.h"
 #include "Cache.h"
+#include "CSharedPtr.h"
+#include "CTiglRayCaster.h"
+#include "generated/UniquePtr.h"
 
 #include "TopoDS_Shape.hxx"
 #include "TopoDS_Compound.hxx"
 #include "BRep_Builder.hxx"
 #include <gp_Lin.hxx>
 
+#include <boost/thread/mutex.hpp>
+
+#include <vector>
+
 namespace tigl
 {
 class CCPACSConfiguration;
@@ -58,6 +65,12 @@ public:
     // Invalidates internal state
     TIGL_EXPORT void Invalidate();
 
+    // Invalidates only the geometry depending on the given section element, i.e.
+    // the segments connected to the element, the segments cut from the fuselage loft,
+    // the fuselage structure and the fuselage loft. Linearly lofted segments not
+    // connected to the element keep their cached geometry.
+    TIGL_EXPORT void InvalidateSectionElement(const std::string& elementUID);
+
     // Read CPACS fuselage elements
     TIGL_EXPORT void ReadCPACS(const TixiDocumentHandle& tixiHandle, const std::string& fuselageXPath) OVERRIDE;
 
@@ -66,6 +79,8 @@ public:
 
     TIGL_EXPORT std::string GetDefaultedUID() const OVERRIDE;
 
+    // Returns the loft in global or fuselage coordinates. The loft in fuselage coordinates
+    // is computed once per loft and shared, i.e. it must not be modified by the caller.
     TIGL_EXPORT PNamedShape GetLoft(TiglCoordinateSystem cs = GLOBAL_COORDINATE_SYSTEM) const;
 
     // Get section count
@@ -124,6 +139,19 @@ public:
     TIGL_EXPORT gp_Lin Intersection(gp_Pnt pRef, double angleRef) const;
     TIGL_EXPORT gp_Lin Intersection(const CCPACSFuselageStringerFramePosition& pos) const;
 
+    // create the lines intersecting the fuselage for multiple positions using up to nThreads threads
+    // (nThreads <= 0: all hardware threads). The results are the same as from Intersection.
+    TIGL_EXPORT std::vector<gp_Lin> Intersections(const std::vector<gp_Pnt>& pRefs, const std::vector<double>& anglesRef, int nThreads = 1) const;
+    TIGL_EXPORT std::vector<gp_Lin> Intersections(const std::vector<unique_ptr<CCPACSFuselageStringerFramePosition> >& positions, int nThreads = 1) const;
+
+    // Intersects rays given in global coordinates with the fuselage loft. Returns false, if the ray misses the fuselage.
+    // The intersection is the same as used for Intersection, i.e. intended for rays starting inside the fuselage.
+    TIGL_EXPORT bool IntersectRay(const gp_Lin& globalRay, gp_Pnt& globalIntersection) const;
+
+    // Intersects multiple rays given in global coordinates using up to nThreads threads (nThreads <= 0: all hardware threads).
+    TIGL_EXPORT void IntersectRays(const std::vector<gp_Lin>& globalRays, std::vector<gp_Pnt>& globalIntersections,
+                                   std::vector<bool>& hits, int nThreads = 1) const;
+
     // project the edge/wire onto the fuselage loft
     TIGL_EXPORT TopoDS_Wire projectConic(TopoDS_Shape wireOrEdge, gp_Pnt origin) const;
     TIGL_EXPORT TopoDS_Wire projectParallel(TopoDS_Shape wireOrEdge, gp_Dir direction) const;
@@ -139,12 +167,26 @@ protected:
     // Adds all segments of this fuselage to one shape
     PNamedShape BuildLoft() const OVERRIDE;
 
+    // Drops the segment lofts cut from the fuselage loft and the local geometry
+    void EvictDerivedGeometry() OVERRIDE;
+
     void SetFaceTraits(PNamedShape loft) const;
 
 private:
     // get short name for loft
     std::string GetShortShapeName() const;
 
+    // loft in fuselage coordinates and the ray caster used for the stringer and frame placement
+    struct LocalGeometry
+    {
+        PNamedShape globalLoft; // loft the local geometry was built from
+        PNamedShape loft;
+        CTiglRayCaster rayCaster;
+    };
+
+    // Returns the local geometry of the current loft, builds it if required
+    CSharedPtr<const LocalGeometry> GetLocalGeometry() const;
+
 private:
     CCPACSConfiguration*       configuration;        /**< Parent configuration    */
     FusedElementsContainerType fusedElements;        /**< Stores already fused segments */
@@ -153,6 +195,13 @@ private:
     Cache<TopoDS_Compound, CCPACSFuselage> guideCurves;
     BRep_Builder               aBuilder;
     double                     myVolume;             /**< Volume of this fuselage              */
+    PNamedShape                surfaceAreaLoft;      /**< Loft, for which the surface area has been computed */
+    double                     surfaceArea;          /**< Surface area of surfaceAreaLoft */
+
+    // The loft cache is also cleared by the base classes. Hence, the local geometry
+    // is checked against the loft it was built from instead of using a Cache.
+    mutable boost::mutex                      localGeometryMutex;
+    mutable CSharedPtr<const LocalGeometry>   localGeometry;
 
     friend class CCPACSFuselageSegment;
 };
@@ -74,6 +74,7 @@ void CCPACSFuselageProfiles::DeleteProfile( std::string uid )
 {
     for (std::vector<unique_ptr<CCPACSProfileGeometry> >::iterator it = m_fuselageProfiles.begin(); it != m_fuselageProfiles.end(); ++it) {
         if ((*it)->GetUID() == uid) {
+            m_dirty = true;
             m_fuselageProfiles.erase(it);
             return;
         }
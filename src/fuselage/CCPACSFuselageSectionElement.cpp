@@ -35,8 +35,13 @@ CCPACSFuselageSectionElement::CCPACSFuselageSectionElement(CCPACSFuselageSection
 
 void CCPACSFuselageSectionElement::SetProfileUID(const std::string& value) {
     generated::CPACSFuselageElement::SetProfileUID(value);
-    // invalidate fuselage
-    m_parent->GetParent()->GetParent()->GetParent()->Invalidate();
+    Invalidate();
+}
+
+// Invalidates the geometry of the fuselage segments connected to this element
+void CCPACSFuselageSectionElement::Invalidate()
+{
+    m_parent->GetParent()->GetParent()->GetParent()->InvalidateSectionElement(m_uID);
 }
 
 // Gets the section element transformation
@@ -63,16 +68,19 @@ CTiglPoint CCPACSFuselageSectionElement::GetScaling() const
 void CCPACSFuselageSectionElement::SetTranslation(const CTiglPoint &translation)
 {
     m_transformation.setTranslation(translation, ABS_LOCAL);
+    Invalidate();
 }
 
 void CCPACSFuselageSectionElement::SetRotation(const CTiglPoint &rotation)
 {
     m_transformation.setRotation(rotation);
+    Invalidate();
 }
 
 void CCPACSFuselageSectionElement::SetScaling(const CTiglPoint &scaling)
 {
     m_transformation.setScaling(scaling);
+    Invalidate();
 }
 
 } // end namespace tigl
@@ -51,6 +51,9 @@ public:
     TIGL_EXPORT void SetRotation(const CTiglPoint& rotation);
 
     TIGL_EXPORT void SetScaling(const CTiglPoint& scaling);
+
+    // Invalidates the geometry depending on this element
+    TIGL_EXPORT void Invalidate();
 };
 
 } // end namespace tigl
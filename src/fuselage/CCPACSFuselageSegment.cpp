@@ -35,6 +35,7 @@
 #include "CTiglLogging.h"
 #include "CCPACSConfiguration.h"
 #include "tiglcommonfunctions.h"
+#include "tiglparallel.h"
 #include "CNamedShape.h"
 #include "CTiglMakeLoft.h"
 #include "CTiglPatchShell.h"
@@ -89,7 +90,7 @@
 
 namespace
 {
-    gp_Pnt transformProfilePoint(const tigl::CTiglTransformation& fuselTransform, const tigl::CTiglFuselageConnection& connection, const gp_Pnt& pointOnProfile)
+    tigl::CTiglTransformation getProfileTransformation(const tigl::CTiglTransformation& fuselTransform, const tigl::CTiglFuselageConnection& connection)
     {
         // Do section element transformation on points
         tigl::CTiglTransformation trafo = connection.GetSectionElementTransformation();
@@ -104,9 +105,12 @@ namespace
 
         trafo.PreMultiply(fuselTransform);
 
-        gp_Pnt transformedPoint = trafo.Transform(pointOnProfile);
+        return trafo;
+    }
 
-        return transformedPoint;
+    gp_Pnt transformProfilePoint(const tigl::CTiglTransformation& fuselTransform, const tigl::CTiglFuselageConnection& connection, const gp_Pnt& pointOnProfile)
+    {
+        return getProfileTransformation(fuselTransform, connection).Transform(pointOnProfile);
     }
 
     TopoDS_Wire transformProfileWire(const tigl::CTiglTransformation& fuselTransform, const tigl::CTiglFuselageConnection& connection, const TopoDS_Wire& wire)
@@ -168,6 +172,11 @@ void CCPACSFuselageSegment::Invalidate()
     CTiglAbstractSegment<CCPACSFuselageSegment>::Reset();
 }
 
+bool CCPACSFuselageSegment::IsLoftedLinearly() const
+{
+    return loftLinearly;
+}
+
 // Read CPACS segment elements
 void CCPACSFuselageSegment::ReadCPACS(const TixiDocumentHandle& tixiHandle, const std::string& segmentXPath)
 {
@@ -565,6 +574,39 @@ gp_Pnt CCPACSFuselageSegment::GetPoint(double eta, double zeta)
     return profilePoint;
 }
 
+// Gets points on the fuselage segment for a list of eta/zeta coordinates. The profiles
+// and section transformations are resolved only once for the whole list. The points
+// are evaluated using up to nThreads threads (nThreads <= 0: number of hardware threads).
+std::vector<gp_Pnt> CCPACSFuselageSegment::GetPoints(const std::vector<double>& etas, const std::vector<double>& zetas, int nThreads) const
+{
+    if (etas.size() != zetas.size()) {
+        throw CTiglError("Number of eta and zeta values differ in CCPACSFuselageSegment::GetPoints", TIGL_ERROR);
+    }
+
+    const CCPACSFuselageProfile& startProfile = startConnection.GetProfile();
+    const CCPACSFuselageProfile& endProfile   = endConnection.GetProfile();
+
+    const CTiglTransformation fuselageTransformation = GetFuselage().GetTransformationMatrix();
+    const CTiglTransformation startTransformation    = getProfileTransformation(fuselageTransformation, startConnection);
+    const CTiglTransformation endTransformation      = getProfileTransformation(fuselageTransformation, endConnection);
+
+    std::vector<gp_Pnt> points(etas.size());
+    ParallelFor(etas.size(), [&](size_t i) {
+        const double eta = etas[i];
+        if (eta < 0.0 || eta > 1.0) {
+            throw CTiglError("Parameter eta not in the range 0.0 <= eta <= 1.0 in CCPACSFuselageSegment::GetPoints", TIGL_ERROR);
+        }
+
+        const gp_Pnt startProfilePoint = startTransformation.Transform(startProfile.GetPoint(zetas[i]));
+        const gp_Pnt endProfilePoint   = endTransformation.Transform(endProfile.GetPoint(zetas[i]));
+
+        // linear interpolation in eta direction, same as in GetPoint
+        points[i] = gp_Pnt(startProfilePoint.XYZ() * (1. - eta) + endProfilePoint.XYZ() * eta);
+    }, nThreads);
+
+    return points;
+}
+
 TIGL_EXPORT gp_Pnt CCPACSFuselageSegment::GetTransformedProfileOriginStart() const
 {
     return transformProfilePoint(GetFuselage().GetTransformationMatrix(), startConnection, gp_Pnt(0., 0., 0.));
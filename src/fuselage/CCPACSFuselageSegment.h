@@ -53,6 +53,9 @@ public:
     // Invalidates internal state
     TIGL_EXPORT void Invalidate();
 
+    // Returns true, if the loft is built from the segment profiles only and not cut from the fuselage loft
+    TIGL_EXPORT bool IsLoftedLinearly() const;
+
     // Read CPACS segment elements
     TIGL_EXPORT void ReadCPACS(const TixiDocumentHandle& tixiHandle, const std::string& segmentXPath) OVERRIDE;
 
@@ -120,6 +123,12 @@ public:
     // the point is the start point of the profile wire, for zeta = 1.0 the last profile wire point.
     TIGL_EXPORT gp_Pnt GetPoint(double eta, double zeta);
 
+    // Gets points on the fuselage segment for a list of eta/zeta coordinates.
+    // This is equivalent to calling GetPoint for each pair, but resolves the
+    // profiles and transformations only once. The points are computed
+    // using up to nThreads threads (nThreads <= 0: all hardware threads).
+    TIGL_EXPORT std::vector<gp_Pnt> GetPoints(const std::vector<double>& etas, const std::vector<double>& zetas, int nThreads = 1) const;
+
     // Gets the origin (0, 0, 0) of the inner & outer profiles after trafo
     // These should be a good approximation for the center point
     TIGL_EXPORT gp_Pnt GetTransformedProfileOriginStart() const;
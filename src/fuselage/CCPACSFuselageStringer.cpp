@@ -96,10 +96,7 @@ void CCPACSFuselageStringer::BuildGeometry(TopoDS_Shape& cache, bool just1DEleme
 
     // -1) place every points in the fuselage loft
     CCPACSFuselage& fuselage  = *m_parent->GetParent()->GetParent();
-    std::vector<gp_Lin> pointList;
-    for (size_t i = 0; i < m_stringerPositions.size(); i++) {
-        pointList.push_back(fuselage.Intersection(*m_stringerPositions[i]));
-    }
+    const std::vector<gp_Lin> pointList = fuselage.Intersections(m_stringerPositions);
 
     // creation of the profile plane
     // the plan axis system is defined by : the location, the normal vector, the x vector. It's a right-handed system
@@ -84,6 +84,7 @@ double CCPACSFuselageStringerFramePosition::GetReferenceZRel() const {
 
 void CCPACSFuselageStringerFramePosition::SetPositionXRel(double positionXRel)
 {
+    m_dirty = true;
     //m_relCache->positionXRel = positionXRel;
     m_positionX = m_relCache->xmin + (m_relCache->xmax - m_relCache->xmin) * positionXRel;
     if (fabs(m_positionX) < 1e-6)
@@ -93,6 +94,7 @@ void CCPACSFuselageStringerFramePosition::SetPositionXRel(double positionXRel)
 
 void CCPACSFuselageStringerFramePosition::SetReferenceYRel(double referenceYRel)
 {
+    m_dirty = true;
     //m_relCache->referenceYRel = referenceYRel;
     m_referenceY = m_relCache->ymin + (m_relCache->ymax - m_relCache->ymin) * referenceYRel;
     if (fabs(m_referenceY) < 1e-6)
@@ -102,6 +104,7 @@ void CCPACSFuselageStringerFramePosition::SetReferenceYRel(double referenceYRel)
 
 void CCPACSFuselageStringerFramePosition::SetReferenceZRel(double referenceZRel)
 {
+    m_dirty = true;
     //m_relCache->referenceZRel = referenceZRel;
     m_referenceZ = m_relCache->zmin + (m_relCache->zmax - m_relCache->zmin) * referenceZRel;
     if (fabs(m_referenceZ) < 1e-6)
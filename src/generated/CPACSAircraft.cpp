@@ -28,6 +28,7 @@ namespace generated
 {
     CPACSAircraft::CPACSAircraft(CTiglUIDManager* uidMgr)
         : m_uidMgr(uidMgr)
+        , m_dirty(true)
     {
     }
 
@@ -61,6 +62,43 @@ namespace generated
 
     }
 
+    bool CPACSAircraft::IsDirty() const
+    {
+        if (m_dirty) {
+            return true;
+        }
+        if (m_models.size() != m_modelsClean.size()) {
+            return true;
+        }
+        for (std::size_t i = 0; i < m_models.size(); i++) {
+            if (m_models[i].get() != m_modelsClean[i] || m_models[i]->IsDirty()) {
+                return true;
+            }
+        }
+        return false;
+    }
+
+    void CPACSAircraft::ClearDirty()
+    {
+        m_dirty = false;
+        m_modelsClean.clear();
+        for (std::size_t i = 0; i < m_models.size(); i++) {
+            m_modelsClean.push_back(m_models[i].get());
+            m_models[i]->ClearDirty();
+        }
+    }
+
+    void CPACSAircraft::WriteDirtyCPACS(const TixiDocumentHandle& tixiHandle, const std::string& xpath) const
+    {
+        if (m_dirty) {
+            WriteCPACS(tixiHandle, xpath);
+            return;
+        }
+
+        // write modified elements model
+        tixi::TixiSaveDirtyElements(tixiHandle, xpath + "/model", m_models, m_modelsClean);
+    }
+
     const std::vector<unique_ptr<CCPACSAircraftModel> >& CPACSAircraft::GetModels() const
     {
         return m_models;
@@ -79,6 +117,7 @@ namespace generated
 
     void CPACSAircraft::RemoveModel(CCPACSAircraftModel& ref)
     {
+        m_dirty = true;
         for (std::size_t i = 0; i < m_models.size(); i++) {
             if (m_models[i].get() == &ref) {
                 m_models.erase(m_models.begin() + i);
@@ -27,6 +27,7 @@ namespace generated
 {
     CPACSAircraftModel::CPACSAircraftModel(CTiglUIDManager* uidMgr)
         : m_uidMgr(uidMgr)
+        , m_dirty(true)
     {
     }
 
@@ -48,8 +49,7 @@ namespace generated
     void CPACSAircraftModel::ReadCPACS(const TixiDocumentHandle& tixiHandle, const std::string& xpath)
     {
         // read attribute uID
-        if (tixi::TixiCheckAttribute(tixiHandle, xpath, "uID")) {
-            m_uID = tixi::TixiGetAttribute<std::string>(tixiHandle, xpath, "uID");
+        if (tixi::TixiTryGetAttribute(tixiHandle, xpath, "uID", m_uID)) {
             if (m_uID.empty()) {
                 LOG(WARNING) << "Required attribute uID is empty at xpath " << xpath;
             }
@@ -59,8 +59,7 @@ namespace generated
         }
 
         // read element name
-        if (tixi::TixiCheckElement(tixiHandle, xpath + "/name")) {
-            m_name = tixi::TixiGetElement<std::string>(tixiHandle, xpath + "/name");
+        if (tixi::TixiTryGetElement(tixiHandle, xpath + "/name", m_name)) {
             if (m_name.empty()) {
                 LOG(WARNING) << "Required element name is empty at xpath " << xpath;
             }
@@ -70,8 +69,7 @@ namespace generated
         }
 
         // read element description
-        if (tixi::TixiCheckElement(tixiHandle, xpath + "/description")) {
-            m_description = tixi::TixiGetElement<std::string>(tixiHandle, xpath + "/description");
+        if (tixi::TixiTryGetElement(tixiHandle, xpath + "/description", m_description)) {
             if (m_description->empty()) {
                 LOG(WARNING) << "Optional element description is present but empty at xpath " << xpath;
             }
@@ -190,6 +188,75 @@ namespace generated
 
     }
 
+    bool CPACSAircraftModel::IsDirty() const
+    {
+        if (m_dirty) {
+            return true;
+        }
+        if (m_fuselages && m_fuselages->IsDirty()) {
+            return true;
+        }
+        if (m_wings && m_wings->IsDirty()) {
+            return true;
+        }
+        if (m_enginePylons && m_enginePylons->IsDirty()) {
+            return true;
+        }
+        if (m_genericGeometryComponents && m_genericGeometryComponents->IsDirty()) {
+            return true;
+        }
+        return false;
+    }
+
+    void CPACSAircraftModel::ClearDirty()
+    {
+        m_dirty = false;
+        if (m_fuselages) {
+            m_fuselages->ClearDirty();
+        }
+        if (m_wings) {
+            m_wings->ClearDirty();
+        }
+        if (m_enginePylons) {
+            m_enginePylons->ClearDirty();
+        }
+        if (m_genericGeometryComponents) {
+            m_genericGeometryComponents->ClearDirty();
+        }
+    }
+
+    void CPACSAircraftModel::WriteDirtyCPACS(const TixiDocumentHandle& tixiHandle, const std::string& xpath) const
+    {
+        if (m_dirty) {
+            WriteCPACS(tixiHandle, xpath);
+            return;
+        }
+
+        // write modified element fuselages
+        if (m_fuselages && m_fuselages->IsDirty()) {
+            tixi::TixiCreateElementIfNotExists(tixiHandle, xpath + "/fuselages");
+            m_fuselages->WriteDirtyCPACS(tixiHandle, xpath + "/fuselages");
+        }
+
+        // write modified element wings
+        if (m_wings && m_wings->IsDirty()) {
+            tixi::TixiCreateElementIfNotExists(tixiHandle, xpath + "/wings");
+            m_wings->WriteDirtyCPACS(tixiHandle, xpath + "/wings");
+        }
+
+        // write modified element enginePylons
+        if (m_enginePylons && m_enginePylons->IsDirty()) {
+            tixi::TixiCreateElementIfNotExists(tixiHandle, xpath + "/enginePylons");
+            m_enginePylons->WriteDirtyCPACS(tixiHandle, xpath + "/enginePylons");
+        }
+
+        // write modified element genericGeometryComponents
+        if (m_genericGeometryComponents && m_genericGeometryComponents->IsDirty()) {
+            tixi::TixiCreateElementIfNotExists(tixiHandle, xpath + "/genericGeometryComponents");
+            m_genericGeometryComponents->WriteDirtyCPACS(tixiHandle, xpath + "/genericGeometryComponents");
+        }
+    }
+
     const std::string& CPACSAircraftModel::GetUID() const
     {
         return m_uID;
@@ -197,6 +264,7 @@ namespace generated
 
     void CPACSAircraftModel::SetUID(const std::string& value)
     {
+        m_dirty = true;
         if (m_uidMgr) {
             m_uidMgr->TryUnregisterObject(m_uID);
             m_uidMgr->RegisterObject(value, *this);
@@ -211,6 +279,7 @@ namespace generated
 
     void CPACSAircraftModel::SetName(const std::string& value)
     {
+        m_dirty = true;
         m_name = value;
     }
 
@@ -221,6 +290,7 @@ namespace generated
 
     void CPACSAircraftModel::SetDescription(const boost::optional<std::string>& value)
     {
+        m_dirty = true;
         m_description = value;
     }
 
@@ -273,6 +343,7 @@ namespace generated
 
     void CPACSAircraftModel::RemoveFuselages()
     {
+        m_dirty = true;
         m_fuselages = boost::none;
     }
 
@@ -285,6 +356,7 @@ namespace generated
 
     void CPACSAircraftModel::RemoveWings()
     {
+        m_dirty = true;
         m_wings = boost::none;
     }
 
@@ -297,6 +369,7 @@ namespace generated
 
     void CPACSAircraftModel::RemoveEnginePylons()
     {
+        m_dirty = true;
         m_enginePylons = boost::none;
     }
 
@@ -309,6 +382,7 @@ namespace generated
 
     void CPACSAircraftModel::RemoveGenericGeometryComponents()
     {
+        m_dirty = true;
         m_genericGeometryComponents = boost::none;
     }
 
@@ -27,6 +27,7 @@ namespace generated
 {
     CPACSAlignmentCrossBeam::CPACSAlignmentCrossBeam(CTiglUIDManager* uidMgr)
         : m_uidMgr(uidMgr)
+        , m_dirty(true)
     {
     }
 
@@ -48,8 +49,7 @@ namespace generated
     void CPACSAlignmentCrossBeam::ReadCPACS(const TixiDocumentHandle& tixiHandle, const std::string& xpath)
     {
         // read attribute uID
-        if (tixi::TixiCheckAttribute(tixiHandle, xpath, "uID")) {
-            m_uID = tixi::TixiGetAttribute<std::string>(tixiHandle, xpath, "uID");
+        if (tixi::TixiTryGetAttribute(tixiHandle, xpath, "uID", m_uID)) {
             if (m_uID.empty()) {
                 LOG(WARNING) << "Required attribute uID is empty at xpath " << xpath;
             }
@@ -59,29 +59,19 @@ namespace generated
         }
 
         // read element offset1LocX
-        if (tixi::TixiCheckElement(tixiHandle, xpath + "/offset1LocX")) {
-            m_offset1LocX = tixi::TixiGetElement<double>(tixiHandle, xpath + "/offset1LocX");
-        }
+        tixi::TixiTryGetElement(tixiHandle, xpath + "/offset1LocX", m_offset1LocX);
 
         // read element offset2LocX
-        if (tixi::TixiCheckElement(tixiHandle, xpath + "/offset2LocX")) {
-            m_offset2LocX = tixi::TixiGetElement<double>(tixiHandle, xpath + "/offset2LocX");
-        }
+        tixi::TixiTryGetElement(tixiHandle, xpath + "/offset2LocX", m_offset2LocX);
 
         // read element rotationLocX
-        if (tixi::TixiCheckElement(tixiHandle, xpath + "/rotationLocX")) {
-            m_rotationLocX = tixi::TixiGetElement<double>(tixiHandle, xpath + "/rotationLocX");
-        }
+        tixi::TixiTryGetElement(tixiHandle, xpath + "/rotationLocX", m_rotationLocX);
 
         // read element translationLocY
-        if (tixi::TixiCheckElement(tixiHandle, xpath + "/translationLocY")) {
-            m_translationLocY = tixi::TixiGetElement<double>(tixiHandle, xpath + "/translationLocY");
-        }
+        tixi::TixiTryGetElement(tixiHandle, xpath + "/translationLocY", m_translationLocY);
 
         // read element translationLocZ
-        if (tixi::TixiCheckElement(tixiHandle, xpath + "/translationLocZ")) {
-            m_translationLocZ = tixi::TixiGetElement<double>(tixiHandle, xpath + "/translationLocZ");
-        }
+        tixi::TixiTryGetElement(tixiHandle, xpath + "/translationLocZ", m_translationLocZ);
 
         if (m_uidMgr && !m_uID.empty()) m_uidMgr->RegisterObject(m_uID, *this);
     }
@@ -148,6 +138,23 @@ namespace generated
 
     }
 
+    bool CPACSAlignmentCrossBeam::IsDirty() const
+    {
+        return m_dirty;
+    }
+
+    void CPACSAlignmentCrossBeam::ClearDirty()
+    {
+        m_dirty = false;
+    }
+
+    void CPACSAlignmentCrossBeam::WriteDirtyCPACS(const TixiDocumentHandle& tixiHandle, const std::string& xpath) const
+    {
+        if (m_dirty) {
+            WriteCPACS(tixiHandle, xpath);
+        }
+    }
+
     const std::string& CPACSAlignmentCrossBeam::GetUID() const
     {
         return m_uID;
@@ -155,6 +162,7 @@ namespace generated
 
     void CPACSAlignmentCrossBeam::SetUID(const std::string& value)
     {
+        m_dirty = true;
         if (m_uidMgr) {
             m_uidMgr->TryUnregisterObject(m_uID);
             m_uidMgr->RegisterObject(value, *this);
@@ -169,6 +177,7 @@ namespace generated
 
     void CPACSAlignmentCrossBeam::SetOffset1LocX(const boost::optional<double>& value)
     {
+        m_dirty = true;
         m_offset1LocX = value;
     }
 
@@ -179,6 +188,7 @@ namespace generated
 
     void CPACSAlignmentCrossBeam::SetOffset2LocX(const boost::optional<double>& value)
     {
+        m_dirty = true;
         m_offset2LocX = value;
     }
 
@@ -189,6 +199,7 @@ namespace generated
 
     void CPACSAlignmentCrossBeam::SetRotationLocX(const boost::optional<double>& value)
     {
+        m_dirty = true;
         m_rotationLocX = value;
     }
 
@@ -199,6 +210,7 @@ namespace generated
 
     void CPACSAlignmentCrossBeam::SetTranslationLocY(const boost::optional<double>& value)
     {
+        m_dirty = true;
         m_translationLocY = value;
     }
 
@@ -209,6 +221,7 @@ namespace generated
 
     void CPACSAlignmentCrossBeam::SetTranslationLocZ(const boost::optional<double>& value)
     {
+        m_dirty = true;
         m_translationLocZ = value;
     }
 
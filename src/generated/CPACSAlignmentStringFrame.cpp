@@ -27,6 +27,7 @@ namespace generated
 {
     CPACSAlignmentStringFrame::CPACSAlignmentStringFrame(CTiglUIDManager* uidMgr)
         : m_uidMgr(uidMgr)
+        , m_dirty(true)
     {
     }
 
@@ -48,8 +49,7 @@ namespace generated
     void CPACSAlignmentStringFrame::ReadCPACS(const TixiDocumentHandle& tixiHandle, const std::string& xpath)
     {
         // read attribute uID
-        if (tixi::TixiCheckAttribute(tixiHandle, xpath, "uID")) {
-            m_uID = tixi::TixiGetAttribute<std::string>(tixiHandle, xpath, "uID");
+        if (tixi::TixiTryGetAttribute(tixiHandle, xpath, "uID", m_uID)) {
             if (m_uID.empty()) {
                 LOG(WARNING) << "Required attribute uID is empty at xpath " << xpath;
             }
@@ -59,19 +59,13 @@ namespace generated
         }
 
         // read element rotationLocX
-        if (tixi::TixiCheckElement(tixiHandle, xpath + "/rotationLocX")) {
-            m_rotationLocX = tixi::TixiGetElement<double>(tixiHandle, xpath + "/rotationLocX");
-        }
+        tixi::TixiTryGetElement(tixiHandle, xpath + "/rotationLocX", m_rotationLocX);
 
         // read element translationLocY
-        if (tixi::TixiCheckElement(tixiHandle, xpath + "/translationLocY")) {
-            m_translationLocY = tixi::TixiGetElement<double>(tixiHandle, xpath + "/translationLocY");
-        }
+        tixi::TixiTryGetElement(tixiHandle, xpath + "/translationLocY", m_translationLocY);
 
         // read element translationLocZ
-        if (tixi::TixiCheckElement(tixiHandle, xpath + "/translationLocZ")) {
-            m_translationLocZ = tixi::TixiGetElement<double>(tixiHandle, xpath + "/translationLocZ");
-        }
+        tixi::TixiTryGetElement(tixiHandle, xpath + "/translationLocZ", m_translationLocZ);
 
         if (m_uidMgr && !m_uID.empty()) m_uidMgr->RegisterObject(m_uID, *this);
     }
@@ -116,6 +110,23 @@ namespace generated
 
     }
 
+    bool CPACSAlignmentStringFrame::IsDirty() const
+    {
+        return m_dirty;
+    }
+
+    void CPACSAlignmentStringFrame::ClearDirty()
+    {
+        m_dirty = false;
+    }
+
+    void CPACSAlignmentStringFrame::WriteDirtyCPACS(const TixiDocumentHandle& tixiHandle, const std::string& xpath) const
+    {
+        if (m_dirty) {
+            WriteCPACS(tixiHandle, xpath);
+        }
+    }
+
     const std::string& CPACSAlignmentStringFrame::GetUID() const
     {
         return m_uID;
@@ -123,6 +134,7 @@ namespace generated
 
     void CPACSAlignmentStringFrame::SetUID(const std::string& value)
     {
+        m_dirty = true;
         if (m_uidMgr) {
             m_uidMgr->TryUnregisterObject(m_uID);
             m_uidMgr->RegisterObject(value, *this);
@@ -137,6 +149,7 @@ namespace generated
 
     void CPACSAlignmentStringFrame::SetRotationLocX(const boost::optional<double>& value)
     {
+        m_dirty = true;
         m_rotationLocX = value;
     }
 
@@ -147,6 +160,7 @@ namespace generated
 
     void CPACSAlignmentStringFrame::SetTranslationLocY(const boost::optional<double>& value)
     {
+        m_dirty = true;
         m_translationLocY = value;
     }
 
@@ -157,6 +171,7 @@ namespace generated
 
     void CPACSAlignmentStringFrame::SetTranslationLocZ(const boost::optional<double>& value)
     {
+        m_dirty = true;
         m_translationLocZ = value;
     }
 
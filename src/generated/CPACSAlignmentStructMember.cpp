@@ -27,6 +27,7 @@ namespace generated
 {
     CPACSAlignmentStructMember::CPACSAlignmentStructMember(CTiglUIDManager* uidMgr)
         : m_uidMgr(uidMgr)
+        , m_dirty(true)
     {
     }
 
@@ -48,8 +49,7 @@ namespace generated
     void CPACSAlignmentStructMember::ReadCPACS(const TixiDocumentHandle& tixiHandle, const std::string& xpath)
     {
         // read attribute uID
-        if (tixi::TixiCheckAttribute(tixiHandle, xpath, "uID")) {
-            m_uID = tixi::TixiGetAttribute<std::string>(tixiHandle, xpath, "uID");
+        if (tixi::TixiTryGetAttribute(tixiHandle, xpath, "uID", m_uID)) {
             if (m_uID.empty()) {
                 LOG(WARNING) << "Required attribute uID is empty at xpath " << xpath;
             }
@@ -59,24 +59,16 @@ namespace generated
         }
 
         // read element offsetLocX
-        if (tixi::TixiCheckElement(tixiHandle, xpath + "/offsetLocX")) {
-            m_offsetLocX = tixi::TixiGetElement<double>(tixiHandle, xpath + "/offsetLocX");
-        }
+        tixi::TixiTryGetElement(tixiHandle, xpath + "/offsetLocX", m_offsetLocX);
 
         // read element rotationLocX
-        if (tixi::TixiCheckElement(tixiHandle, xpath + "/rotationLocX")) {
-            m_rotationLocX = tixi::TixiGetElement<double>(tixiHandle, xpath + "/rotationLocX");
-        }
+        tixi::TixiTryGetElement(tixiHandle, xpath + "/rotationLocX", m_rotationLocX);
 
         // read element translationLocY
-        if (tixi::TixiCheckElement(tixiHandle, xpath + "/translationLocY")) {
-            m_translationLocY = tixi::TixiGetElement<double>(tixiHandle, xpath + "/translationLocY");
-        }
+        tixi::TixiTryGetElement(tixiHandle, xpath + "/translationLocY", m_translationLocY);
 
         // read element translationLocZ
-        if (tixi::TixiCheckElement(tixiHandle, xpath + "/translationLocZ")) {
-            m_translationLocZ = tixi::TixiGetElement<double>(tixiHandle, xpath + "/translationLocZ");
-        }
+        tixi::TixiTryGetElement(tixiHandle, xpath + "/translationLocZ", m_translationLocZ);
 
         if (m_uidMgr && !m_uID.empty()) m_uidMgr->RegisterObject(m_uID, *this);
     }
@@ -132,6 +124,23 @@ namespace generated
 
     }
 
+    bool CPACSAlignmentStructMember::IsDirty() const
+    {
+        return m_dirty;
+    }
+
+    void CPACSAlignmentStructMember::ClearDirty()
+    {
+        m_dirty = false;
+    }
+
+    void CPACSAlignmentStructMember::WriteDirtyCPACS(const TixiDocumentHandle& tixiHandle, const std::string& xpath) const
+    {
+        if (m_dirty) {
+            WriteCPACS(tixiHandle, xpath);
+        }
+    }
+
     const std::string& CPACSAlignmentStructMember::GetUID() const
     {
         return m_uID;
@@ -139,6 +148,7 @@ namespace generated
 
     void CPACSAlignmentStructMember::SetUID(const std::string& value)
     {
+        m_dirty = true;
         if (m_uidMgr) {
             m_uidMgr->TryUnregisterObject(m_uID);
             m_uidMgr->RegisterObject(value, *this);
@@ -153,6 +163,7 @@ namespace generated
 
     void CPACSAlignmentStructMember::SetOffsetLocX(const boost::optional<double>& value)
     {
+        m_dirty = true;
         m_offsetLocX = value;
     }
 
@@ -163,6 +174,7 @@ namespace generated
 
     void CPACSAlignmentStructMember::SetRotationLocX(const boost::optional<double>& value)
     {
+        m_dirty = true;
         m_rotationLocX = value;
     }
 
@@ -173,6 +185,7 @@ namespace generated
 
     void CPACSAlignmentStructMember::SetTranslationLocY(const boost::optional<double>& value)
     {
+        m_dirty = true;
         m_translationLocY = value;
     }
 
@@ -183,6 +196,7 @@ namespace generated
 
     void CPACSAlignmentStructMember::SetTranslationLocZ(const boost::optional<double>& value)
     {
+        m_dirty = true;
         m_translationLocZ = value;
     }
 
@@ -49,6 +49,10 @@ namespace generated
         TIGL_EXPORT virtual void ReadCPACS(const TixiDocumentHandle& tixiHandle, const std::string& xpath);
         TIGL_EXPORT virtual void WriteCPACS(const TixiDocumentHandle& tixiHandle, const std::string& xpath) const;
 
+        TIGL_EXPORT virtual bool IsDirty() const;
+        TIGL_EXPORT virtual void ClearDirty();
+        TIGL_EXPORT virtual void WriteDirtyCPACS(const TixiDocumentHandle& tixiHandle, const std::string& xpath) const;
+
         TIGL_EXPORT virtual const std::string& GetUID() const;
         TIGL_EXPORT virtual void SetUID(const std::string& value);
 
@@ -84,6 +88,9 @@ namespace generated
         /// to x ynd y axes)
         boost::optional<double> m_translationLocZ;
 
+        /// Set by the setters, cleared after the object has been read or written
+        bool m_dirty;
+
     private:
 #ifdef HAVE_CPP11
         CPACSAlignmentStructMember(const CPACSAlignmentStructMember&) = delete;
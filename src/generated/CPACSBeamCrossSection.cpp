@@ -32,6 +32,7 @@ namespace generated
         , m_xMax(0)
         , m_yMin(0)
         , m_yMax(0)
+        , m_dirty(true)
     {
     }
 
@@ -53,8 +54,7 @@ namespace generated
     void CPACSBeamCrossSection::ReadCPACS(const TixiDocumentHandle& tixiHandle, const std::string& xpath)
     {
         // read attribute uID
-        if (tixi::TixiCheckAttribute(tixiHandle, xpath, "uID")) {
-            m_uID = tixi::TixiGetAttribute<std::string>(tixiHandle, xpath, "uID");
+        if (tixi::TixiTryGetAttribute(tixiHandle, xpath, "uID", m_uID)) {
             if (m_uID.empty()) {
                 LOG(WARNING) << "Required attribute uID is empty at xpath " << xpath;
             }
@@ -64,42 +64,27 @@ namespace generated
         }
 
         // read element area
-        if (tixi::TixiCheckElement(tixiHandle, xpath + "/area")) {
-            m_area = tixi::TixiGetElement<double>(tixiHandle, xpath + "/area");
-        }
-        else {
+        if (!tixi::TixiTryGetElement(tixiHandle, xpath + "/area", m_area)) {
             LOG(ERROR) << "Required element area is missing at xpath " << xpath;
         }
 
         // read element xMin
-        if (tixi::TixiCheckElement(tixiHandle, xpath + "/xMin")) {
-            m_xMin = tixi::TixiGetElement<double>(tixiHandle, xpath + "/xMin");
-        }
-        else {
+        if (!tixi::TixiTryGetElement(tixiHandle, xpath + "/xMin", m_xMin)) {
             LOG(ERROR) << "Required element xMin is missing at xpath " << xpath;
         }
 
         // read element xMax
-        if (tixi::TixiCheckElement(tixiHandle, xpath + "/xMax")) {
-            m_xMax = tixi::TixiGetElement<double>(tixiHandle, xpath + "/xMax");
-        }
-        else {
+        if (!tixi::TixiTryGetElement(tixiHandle, xpath + "/xMax", m_xMax)) {
             LOG(ERROR) << "Required element xMax is missing at xpath " << xpath;
         }
 
         // read element yMin
-        if (tixi::TixiCheckElement(tixiHandle, xpath + "/yMin")) {
-            m_yMin = tixi::TixiGetElement<double>(tixiHandle, xpath + "/yMin");
-        }
-        else {
+        if (!tixi::TixiTryGetElement(tixiHandle, xpath + "/yMin", m_yMin)) {
             LOG(ERROR) << "Required element yMin is missing at xpath " << xpath;
         }
 
         // read element yMax
-        if (tixi::TixiCheckElement(tixiHandle, xpath + "/yMax")) {
-            m_yMax = tixi::TixiGetElement<double>(tixiHandle, xpath + "/yMax");
-        }
-        else {
+        if (!tixi::TixiTryGetElement(tixiHandle, xpath + "/yMax", m_yMax)) {
             LOG(ERROR) << "Required element yMax is missing at xpath " << xpath;
         }
 
@@ -133,6 +118,23 @@ namespace generated
 
     }
 
+    bool CPACSBeamCrossSection::IsDirty() const
+    {
+        return m_dirty;
+    }
+
+    void CPACSBeamCrossSection::ClearDirty()
+    {
+        m_dirty = false;
+    }
+
+    void CPACSBeamCrossSection::WriteDirtyCPACS(const TixiDocumentHandle& tixiHandle, const std::string& xpath) const
+    {
+        if (m_dirty) {
+            WriteCPACS(tixiHandle, xpath);
+        }
+    }
+
     const std::string& CPACSBeamCrossSection::GetUID() const
     {
         return m_uID;
@@ -140,6 +142,7 @@ namespace generated
 
     void CPACSBeamCrossSection::SetUID(const std::string& value)
     {
+        m_dirty = true;
         if (m_uidMgr) {
             m_uidMgr->TryUnregisterObject(m_uID);
             m_uidMgr->RegisterObject(value, *this);
@@ -154,6 +157,7 @@ namespace generated
 
     void CPACSBeamCrossSection::SetArea(const double& value)
     {
+        m_dirty = true;
         m_area = value;
     }
 
@@ -164,6 +168,7 @@ namespace generated
 
     void CPACSBeamCrossSection::SetXMin(const double& value)
     {
+        m_dirty = true;
         m_xMin = value;
     }
 
@@ -174,6 +179,7 @@ namespace generated
 
     void CPACSBeamCrossSection::SetXMax(const double& value)
     {
+        m_dirty = true;
         m_xMax = value;
     }
 
@@ -184,6 +190,7 @@ namespace generated
 
     void CPACSBeamCrossSection::SetYMin(const double& value)
     {
+        m_dirty = true;
         m_yMin = value;
     }
 
@@ -194,6 +201,7 @@ namespace generated
 
     void CPACSBeamCrossSection::SetYMax(const double& value)
     {
+        m_dirty = true;
         m_yMax = value;
     }
 
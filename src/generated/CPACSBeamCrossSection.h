@@ -48,6 +48,10 @@ namespace generated
         TIGL_EXPORT virtual void ReadCPACS(const TixiDocumentHandle& tixiHandle, const std::string& xpath);
         TIGL_EXPORT virtual void WriteCPACS(const TixiDocumentHandle& tixiHandle, const std::string& xpath) const;
 
+        TIGL_EXPORT virtual bool IsDirty() const;
+        TIGL_EXPORT virtual void ClearDirty();
+        TIGL_EXPORT virtual void WriteDirtyCPACS(const TixiDocumentHandle& tixiHandle, const std::string& xpath) const;
+
         TIGL_EXPORT virtual const std::string& GetUID() const;
         TIGL_EXPORT virtual void SetUID(const std::string& value);
 
@@ -76,6 +80,9 @@ namespace generated
         double      m_yMin;
         double      m_yMax;
 
+        /// Set by the setters, cleared after the object has been read or written
+        bool m_dirty;
+
     private:
 #ifdef HAVE_CPP11
         CPACSBeamCrossSection(const CPACSBeamCrossSection&) = delete;
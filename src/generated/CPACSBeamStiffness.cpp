@@ -34,6 +34,7 @@ namespace generated
         , m_GIt(0)
         , m_G(0)
         , m_It(0)
+        , m_dirty(true)
     {
     }
 
@@ -55,8 +56,7 @@ namespace generated
     void CPACSBeamStiffness::ReadCPACS(const TixiDocumentHandle& tixiHandle, const std::string& xpath)
     {
         // read attribute uID
-        if (tixi::TixiCheckAttribute(tixiHandle, xpath, "uID")) {
-            m_uID = tixi::TixiGetAttribute<std::string>(tixiHandle, xpath, "uID");
+        if (tixi::TixiTryGetAttribute(tixiHandle, xpath, "uID", m_uID)) {
             if (m_uID.empty()) {
                 LOG(WARNING) << "Required attribute uID is empty at xpath " << xpath;
             }
@@ -66,58 +66,37 @@ namespace generated
         }
 
         // read element EA
-        if (tixi::TixiCheckElement(tixiHandle, xpath + "/EA")) {
-            m_EA = tixi::TixiGetElement<double>(tixiHandle, xpath + "/EA");
-        }
-        else {
+        if (!tixi::TixiTryGetElement(tixiHandle, xpath + "/EA", m_EA)) {
             LOG(ERROR) << "Required element EA is missing at xpath " << xpath;
         }
 
         // read element EIxx
-        if (tixi::TixiCheckElement(tixiHandle, xpath + "/EIxx")) {
-            m_EIxx = tixi::TixiGetElement<double>(tixiHandle, xpath + "/EIxx");
-        }
-        else {
+        if (!tixi::TixiTryGetElement(tixiHandle, xpath + "/EIxx", m_EIxx)) {
             LOG(ERROR) << "Required element EIxx is missing at xpath " << xpath;
         }
 
         // read element EIyy
-        if (tixi::TixiCheckElement(tixiHandle, xpath + "/EIyy")) {
-            m_EIyy = tixi::TixiGetElement<double>(tixiHandle, xpath + "/EIyy");
-        }
-        else {
+        if (!tixi::TixiTryGetElement(tixiHandle, xpath + "/EIyy", m_EIyy)) {
             LOG(ERROR) << "Required element EIyy is missing at xpath " << xpath;
         }
 
         // read element EIxy
-        if (tixi::TixiCheckElement(tixiHandle, xpath + "/EIxy")) {
-            m_EIxy = tixi::TixiGetElement<double>(tixiHandle, xpath + "/EIxy");
-        }
-        else {
+        if (!tixi::TixiTryGetElement(tixiHandle, xpath + "/EIxy", m_EIxy)) {
             LOG(ERROR) << "Required element EIxy is missing at xpath " << xpath;
         }
 
         // read element GIt
-        if (tixi::TixiCheckElement(tixiHandle, xpath + "/GIt")) {
-            m_GIt = tixi::TixiGetElement<double>(tixiHandle, xpath + "/GIt");
-        }
-        else {
+        if (!tixi::TixiTryGetElement(tixiHandle, xpath + "/GIt", m_GIt)) {
             LOG(ERROR) << "Required element GIt is missing at xpath " << xpath;
         }
 
         // read element G
-        if (tixi::TixiCheckElement(tixiHandle, xpath + "/G")) {
-            m_G = tixi::TixiGetElement<double>(tixiHandle, xpath + "/G");
-        }
-        else {
+        if (!tixi::TixiTryGetElement(tixiHandle, xpath + "/G", m_G)) {
             LOG(ERROR) << "Required element G is missing at xpath " << xpath;
         }
 
         // read element It
-        if (tixi::TixiCheckElement(tixiHandle, xpath + "/It")) {
-            m_It = tixi::TixiGetElement<double>(tixiHandle, xpath + "/It");
-        }
-        else {
+        if (!tixi::TixiTryGetElement(tixiHandle, xpath + "/It", m_It)) {
             LOG(ERROR) << "Required element It is missing at xpath " << xpath;
         }
 
@@ -159,6 +138,23 @@ namespace generated
 
     }
 
+    bool CPACSBeamStiffness::IsDirty() const
+    {
+        return m_dirty;
+    }
+
+    void CPACSBeamStiffness::ClearDirty()
+    {
+        m_dirty = false;
+    }
+
+    void CPACSBeamStiffness::WriteDirtyCPACS(const TixiDocumentHandle& tixiHandle, const std::string& xpath) const
+    {
+        if (m_dirty) {
+            WriteCPACS(tixiHandle, xpath);
+        }
+    }
+
     const std::string& CPACSBeamStiffness::GetUID() const
     {
         return m_uID;
@@ -166,6 +162,7 @@ namespace generated
 
     void CPACSBeamStiffness::SetUID(const std::string& value)
     {
+        m_dirty = true;
         if (m_uidMgr) {
             m_uidMgr->TryUnregisterObject(m_uID);
             m_uidMgr->RegisterObject(value, *this);
@@ -180,6 +177,7 @@ namespace generated
 
     void CPACSBeamStiffness::SetEA(const double& value)
     {
+        m_dirty = true;
         m_EA = value;
     }
 
@@ -190,6 +188,7 @@ namespace generated
 
     void CPACSBeamStiffness::SetEIxx(const double& value)
     {
+        m_dirty = true;
         m_EIxx = value;
     }
 
@@ -200,6 +199,7 @@ namespace generated
 
     void CPACSBeamStiffness::SetEIyy(const double& value)
     {
+        m_dirty = true;
         m_EIyy = value;
     }
 
@@ -210,6 +210,7 @@ namespace generated
 
     void CPACSBeamStiffness::SetEIxy(const double& value)
     {
+        m_dirty = true;
         m_EIxy = value;
     }
 
@@ -220,6 +221,7 @@ namespace generated
 
     void CPACSBeamStiffness::SetGIt(const double& value)
     {
+        m_dirty = true;
         m_GIt = value;
     }
 
@@ -230,6 +232,7 @@ namespace generated
 
     void CPACSBeamStiffness::SetG(const double& value)
     {
+        m_dirty = true;
         m_G = value;
     }
 
@@ -240,6 +243,7 @@ namespace generated
 
     void CPACSBeamStiffness::SetIt(const double& value)
     {
+        m_dirty = true;
         m_It = value;
     }
 
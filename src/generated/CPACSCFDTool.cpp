@@ -25,6 +25,7 @@ namespace tigl
 namespace generated
 {
     CPACSCFDTool::CPACSCFDTool()
+        : m_dirty(true)
     {
     }
 
@@ -43,8 +44,7 @@ namespace generated
         }
 
         // read element aircraftModelUID
-        if (tixi::TixiCheckElement(tixiHandle, xpath + "/aircraftModelUID")) {
-            m_aircraftModelUID = tixi::TixiGetElement<std::string>(tixiHandle, xpath + "/aircraftModelUID");
+        if (tixi::TixiTryGetElement(tixiHandle, xpath + "/aircraftModelUID", m_aircraftModelUID)) {
             if (m_aircraftModelUID.empty()) {
                 LOG(WARNING) << "Required element aircraftModelUID is empty at xpath " << xpath;
             }
@@ -79,6 +79,47 @@ namespace generated
 
     }
 
+    bool CPACSCFDTool::IsDirty() const
+    {
+        if (m_dirty) {
+            return true;
+        }
+        if (m_tool.IsDirty()) {
+            return true;
+        }
+        if (m_farField.IsDirty()) {
+            return true;
+        }
+        return false;
+    }
+
+    void CPACSCFDTool::ClearDirty()
+    {
+        m_dirty = false;
+        m_tool.ClearDirty();
+        m_farField.ClearDirty();
+    }
+
+    void CPACSCFDTool::WriteDirtyCPACS(const TixiDocumentHandle& tixiHandle, const std::string& xpath) const
+    {
+        if (m_dirty) {
+            WriteCPACS(tixiHandle, xpath);
+            return;
+        }
+
+        // write modified element tool
+        if (m_tool.IsDirty()) {
+            tixi::TixiCreateElementIfNotExists(tixiHandle, xpath + "/tool");
+            m_tool.WriteDirtyCPACS(tixiHandle, xpath + "/tool");
+        }
+
+        // write modified element farField
+        if (m_farField.IsDirty()) {
+            tixi::TixiCreateElementIfNotExists(tixiHandle, xpath + "/farField");
+            m_farField.WriteDirtyCPACS(tixiHandle, xpath + "/farField");
+        }
+    }
+
     const CPACSTool& CPACSCFDTool::GetTool() const
     {
         return m_tool;
@@ -96,6 +137,7 @@ namespace generated
 
     void CPACSCFDTool::SetAircraftModelUID(const std::string& value)
     {
+        m_dirty = true;
         m_aircraftModelUID = value;
     }
 
@@ -26,6 +26,7 @@ namespace generated
 {
     CPACSCap::CPACSCap()
         : m_area(0)
+        , m_dirty(true)
     {
     }
 
@@ -36,10 +37,7 @@ namespace generated
     void CPACSCap::ReadCPACS(const TixiDocumentHandle& tixiHandle, const std::string& xpath)
     {
         // read element area
-        if (tixi::TixiCheckElement(tixiHandle, xpath + "/area")) {
-            m_area = tixi::TixiGetElement<double>(tixiHandle, xpath + "/area");
-        }
-        else {
+        if (!tixi::TixiTryGetElement(tixiHandle, xpath + "/area", m_area)) {
             LOG(ERROR) << "Required element area is missing at xpath " << xpath;
         }
 
@@ -65,6 +63,37 @@ namespace generated
 
     }
 
+    bool CPACSCap::IsDirty() const
+    {
+        if (m_dirty) {
+            return true;
+        }
+        if (m_material.IsDirty()) {
+            return true;
+        }
+        return false;
+    }
+
+    void CPACSCap::ClearDirty()
+    {
+        m_dirty = false;
+        m_material.ClearDirty();
+    }
+
+    void CPACSCap::WriteDirtyCPACS(const TixiDocumentHandle& tixiHandle, const std::string& xpath) const
+    {
+        if (m_dirty) {
+            WriteCPACS(tixiHandle, xpath);
+            return;
+        }
+
+        // write modified element material
+        if (m_material.IsDirty()) {
+            tixi::TixiCreateElementIfNotExists(tixiHandle, xpath + "/material");
+            m_material.WriteDirtyCPACS(tixiHandle, xpath + "/material");
+        }
+    }
+
     const double& CPACSCap::GetArea() const
     {
         return m_area;
@@ -72,6 +101,7 @@ namespace generated
 
     void CPACSCap::SetArea(const double& value)
     {
+        m_dirty = true;
         m_area = value;
     }
 
@@ -30,6 +30,7 @@ namespace generated
 {
     CPACSCargoCrossBeamStrutsAssembly::CPACSCargoCrossBeamStrutsAssembly(CCPACSFuselageStructure* parent, CTiglUIDManager* uidMgr)
         : m_uidMgr(uidMgr)
+        , m_dirty(true)
     {
         //assert(parent != NULL);
         m_parent = parent;
@@ -75,6 +76,43 @@ namespace generated
 
     }
 
+    bool CPACSCargoCrossBeamStrutsAssembly::IsDirty() const
+    {
+        if (m_dirty) {
+            return true;
+        }
+        if (m_cargoCrossBeamStruts.size() != m_cargoCrossBeamStrutsClean.size()) {
+            return true;
+        }
+        for (std::size_t i = 0; i < m_cargoCrossBeamStruts.size(); i++) {
+            if (m_cargoCrossBeamStruts[i].get() != m_cargoCrossBeamStrutsClean[i] || m_cargoCrossBeamStruts[i]->IsDirty()) {
+                return true;
+            }
+        }
+        return false;
+    }
+
+    void CPACSCargoCrossBeamStrutsAssembly::ClearDirty()
+    {
+        m_dirty = false;
+        m_cargoCrossBeamStrutsClean.clear();
+        for (std::size_t i = 0; i < m_cargoCrossBeamStruts.size(); i++) {
+            m_cargoCrossBeamStrutsClean.push_back(m_cargoCrossBeamStruts[i].get());
+            m_cargoCrossBeamStruts[i]->ClearDirty();
+        }
+    }
+
+    void CPACSCargoCrossBeamStrutsAssembly::WriteDirtyCPACS(const TixiDocumentHandle& tixiHandle, const std::string& xpath) const
+    {
+        if (m_dirty) {
+            WriteCPACS(tixiHandle, xpath);
+            return;
+        }
+
+        // write modified elements cargoCrossBeamStrut
+        tixi::TixiSaveDirtyElements(tixiHandle, xpath + "/cargoCrossBeamStrut", m_cargoCrossBeamStruts, m_cargoCrossBeamStrutsClean);
+    }
+
     const std::vector<unique_ptr<CCPACSCrossBeamStrutAssemblyPosition> >& CPACSCargoCrossBeamStrutsAssembly::GetCargoCrossBeamStruts() const
     {
         return m_cargoCrossBeamStruts;
@@ -93,6 +131,7 @@ namespace generated
 
     void CPACSCargoCrossBeamStrutsAssembly::RemoveCargoCrossBeamStrut(CCPACSCrossBeamStrutAssemblyPosition& ref)
     {
+        m_dirty = true;
         for (std::size_t i = 0; i < m_cargoCrossBeamStruts.size(); i++) {
             if (m_cargoCrossBeamStruts[i].get() == &ref) {
                 m_cargoCrossBeamStruts.erase(m_cargoCrossBeamStruts.begin() + i);
@@ -30,6 +30,7 @@ namespace generated
 {
     CPACSCargoCrossBeamsAssembly::CPACSCargoCrossBeamsAssembly(CCPACSFuselageStructure* parent, CTiglUIDManager* uidMgr)
         : m_uidMgr(uidMgr)
+        , m_dirty(true)
     {
         //assert(parent != NULL);
         m_parent = parent;
@@ -75,6 +76,43 @@ namespace generated
 
     }
 
+    bool CPACSCargoCrossBeamsAssembly::IsDirty() const
+    {
+        if (m_dirty) {
+            return true;
+        }
+        if (m_cargoCrossBeams.size() != m_cargoCrossBeamsClean.size()) {
+            return true;
+        }
+        for (std::size_t i = 0; i < m_cargoCrossBeams.size(); i++) {
+            if (m_cargoCrossBeams[i].get() != m_cargoCrossBeamsClean[i] || m_cargoCrossBeams[i]->IsDirty()) {
+                return true;
+            }
+        }
+        return false;
+    }
+
+    void CPACSCargoCrossBeamsAssembly::ClearDirty()
+    {
+        m_dirty = false;
+        m_cargoCrossBeamsClean.clear();
+        for (std::size_t i = 0; i < m_cargoCrossBeams.size(); i++) {
+            m_cargoCrossBeamsClean.push_back(m_cargoCrossBeams[i].get());
+            m_cargoCrossBeams[i]->ClearDirty();
+        }
+    }
+
+    void CPACSCargoCrossBeamsAssembly::WriteDirtyCPACS(const TixiDocumentHandle& tixiHandle, const std::string& xpath) const
+    {
+        if (m_dirty) {
+            WriteCPACS(tixiHandle, xpath);
+            return;
+        }
+
+        // write modified elements cargoCrossBeam
+        tixi::TixiSaveDirtyElements(tixiHandle, xpath + "/cargoCrossBeam", m_cargoCrossBeams, m_cargoCrossBeamsClean);
+    }
+
     const std::vector<unique_ptr<CCPACSCrossBeamAssemblyPosition> >& CPACSCargoCrossBeamsAssembly::GetCargoCrossBeams() const
     {
         return m_cargoCrossBeams;
@@ -93,6 +131,7 @@ namespace generated
 
     void CPACSCargoCrossBeamsAssembly::RemoveCargoCrossBeam(CCPACSCrossBeamAssemblyPosition& ref)
     {
+        m_dirty = true;
         for (std::size_t i = 0; i < m_cargoCrossBeams.size(); i++) {
             if (m_cargoCrossBeams[i].get() == &ref) {
                 m_cargoCrossBeams.erase(m_cargoCrossBeams.begin() + i);
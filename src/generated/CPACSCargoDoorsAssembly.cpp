@@ -30,6 +30,7 @@ namespace generated
 {
     CPACSCargoDoorsAssembly::CPACSCargoDoorsAssembly(CCPACSFuselageStructure* parent, CTiglUIDManager* uidMgr)
         : m_uidMgr(uidMgr)
+        , m_dirty(true)
     {
         //assert(parent != NULL);
         m_parent = parent;
@@ -75,6 +76,43 @@ namespace generated
 
     }
 
+    bool CPACSCargoDoorsAssembly::IsDirty() const
+    {
+        if (m_dirty) {
+            return true;
+        }
+        if (m_cargoDoors.size() != m_cargoDoorsClean.size()) {
+            return true;
+        }
+        for (std::size_t i = 0; i < m_cargoDoors.size(); i++) {
+            if (m_cargoDoors[i].get() != m_cargoDoorsClean[i] || m_cargoDoors[i]->IsDirty()) {
+                return true;
+            }
+        }
+        return false;
+    }
+
+    void CPACSCargoDoorsAssembly::ClearDirty()
+    {
+        m_dirty = false;
+        m_cargoDoorsClean.clear();
+        for (std::size_t i = 0; i < m_cargoDoors.size(); i++) {
+            m_cargoDoorsClean.push_back(m_cargoDoors[i].get());
+            m_cargoDoors[i]->ClearDirty();
+        }
+    }
+
+    void CPACSCargoDoorsAssembly::WriteDirtyCPACS(const TixiDocumentHandle& tixiHandle, const std::string& xpath) const
+    {
+        if (m_dirty) {
+            WriteCPACS(tixiHandle, xpath);
+            return;
+        }
+
+        // write modified elements cargoDoor
+        tixi::TixiSaveDirtyElements(tixiHandle, xpath + "/cargoDoor", m_cargoDoors, m_cargoDoorsClean);
+    }
+
     const std::vector<unique_ptr<CCPACSDoorAssemblyPosition> >& CPACSCargoDoorsAssembly::GetCargoDoors() const
     {
         return m_cargoDoors;
@@ -93,6 +131,7 @@ namespace generated
 
     void CPACSCargoDoorsAssembly::RemoveCargoDoor(CCPACSDoorAssemblyPosition& ref)
     {
+        m_dirty = true;
         for (std::size_t i = 0; i < m_cargoDoors.size(); i++) {
             if (m_cargoDoors[i].get() == &ref) {
                 m_cargoDoors.erase(m_cargoDoors.begin() + i);
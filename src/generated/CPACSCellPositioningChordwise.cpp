@@ -27,6 +27,7 @@ namespace tigl
 namespace generated
 {
     CPACSCellPositioningChordwise::CPACSCellPositioningChordwise(CCPACSWingCell* parent)
+        : m_dirty(true)
     {
         //assert(parent != NULL);
         m_parent = parent;
@@ -49,22 +50,17 @@ namespace generated
     void CPACSCellPositioningChordwise::ReadCPACS(const TixiDocumentHandle& tixiHandle, const std::string& xpath)
     {
         // read element sparUID
-        if (tixi::TixiCheckElement(tixiHandle, xpath + "/sparUID")) {
-            m_sparUID_choice1 = tixi::TixiGetElement<std::string>(tixiHandle, xpath + "/sparUID");
+        if (tixi::TixiTryGetElement(tixiHandle, xpath + "/sparUID", m_sparUID_choice1)) {
             if (m_sparUID_choice1->empty()) {
                 LOG(WARNING) << "Optional element sparUID is present but empty at xpath " << xpath;
             }
         }
 
         // read element xsi1
-        if (tixi::TixiCheckElement(tixiHandle, xpath + "/xsi1")) {
-            m_xsi1_choice2 = tixi::TixiGetElement<double>(tixiHandle, xpath + "/xsi1");
-        }
+        tixi::TixiTryGetElement(tixiHandle, xpath + "/xsi1", m_xsi1_choice2);
 
         // read element xsi2
-        if (tixi::TixiCheckElement(tixiHandle, xpath + "/xsi2")) {
-            m_xsi2_choice2 = tixi::TixiGetElement<double>(tixiHandle, xpath + "/xsi2");
-        }
+        tixi::TixiTryGetElement(tixiHandle, xpath + "/xsi2", m_xsi2_choice2);
 
         if (!ValidateChoices()) {
             LOG(ERROR) << "Invalid choice configuration at xpath " << xpath;
@@ -108,6 +104,23 @@ namespace generated
 
     }
 
+    bool CPACSCellPositioningChordwise::IsDirty() const
+    {
+        return m_dirty;
+    }
+
+    void CPACSCellPositioningChordwise::ClearDirty()
+    {
+        m_dirty = false;
+    }
+
+    void CPACSCellPositioningChordwise::WriteDirtyCPACS(const TixiDocumentHandle& tixiHandle, const std::string& xpath) const
+    {
+        if (m_dirty) {
+            WriteCPACS(tixiHandle, xpath);
+        }
+    }
+
     bool CPACSCellPositioningChordwise::ValidateChoices() const
     {
         return
@@ -149,6 +162,7 @@ namespace generated
 
     void CPACSCellPositioningChordwise::SetSparUID_choice1(const boost::optional<std::string>& value)
     {
+        m_dirty = true;
         m_sparUID_choice1 = value;
     }
 
@@ -159,6 +173,7 @@ namespace generated
 
     void CPACSCellPositioningChordwise::SetXsi1_choice2(const boost::optional<double>& value)
     {
+        m_dirty = true;
         m_xsi1_choice2 = value;
     }
 
@@ -169,6 +184,7 @@ namespace generated
 
     void CPACSCellPositioningChordwise::SetXsi2_choice2(const boost::optional<double>& value)
     {
+        m_dirty = true;
         m_xsi2_choice2 = value;
     }
 
@@ -53,6 +53,10 @@ namespace generated
         TIGL_EXPORT virtual void ReadCPACS(const TixiDocumentHandle& tixiHandle, const std::string& xpath);
         TIGL_EXPORT virtual void WriteCPACS(const TixiDocumentHandle& tixiHandle, const std::string& xpath) const;
 
+        TIGL_EXPORT virtual bool IsDirty() const;
+        TIGL_EXPORT virtual void ClearDirty();
+        TIGL_EXPORT virtual void WriteDirtyCPACS(const TixiDocumentHandle& tixiHandle, const std::string& xpath) const;
+
         TIGL_EXPORT bool ValidateChoices() const;
 
         TIGL_EXPORT virtual const boost::optional<std::string>& GetSparUID_choice1() const;
@@ -78,6 +82,9 @@ namespace generated
         /// end.
         boost::optional<double>      m_xsi2_choice2;
 
+        /// Set by the setters, cleared after the object has been read or written
+        bool m_dirty;
+
     private:
 #ifdef HAVE_CPP11
         CPACSCellPositioningChordwise(const CPACSCellPositioningChordwise&) = delete;
@@ -27,6 +27,7 @@ namespace tigl
 namespace generated
 {
     CPACSCellPositioningSpanwise::CPACSCellPositioningSpanwise(CCPACSWingCell* parent)
+        : m_dirty(true)
     {
         //assert(parent != NULL);
         m_parent = parent;
@@ -49,23 +50,16 @@ namespace generated
     void CPACSCellPositioningSpanwise::ReadCPACS(const TixiDocumentHandle& tixiHandle, const std::string& xpath)
     {
         // read element eta1
-        if (tixi::TixiCheckElement(tixiHandle, xpath + "/eta1")) {
-            m_eta1_choice1 = tixi::TixiGetElement<double>(tixiHandle, xpath + "/eta1");
-        }
+        tixi::TixiTryGetElement(tixiHandle, xpath + "/eta1", m_eta1_choice1);
 
         // read element eta2
-        if (tixi::TixiCheckElement(tixiHandle, xpath + "/eta2")) {
-            m_eta2_choice1 = tixi::TixiGetElement<double>(tixiHandle, xpath + "/eta2");
-        }
+        tixi::TixiTryGetElement(tixiHandle, xpath + "/eta2", m_eta2_choice1);
 
         // read element ribNumber
-        if (tixi::TixiCheckElement(tixiHandle, xpath + "/ribNumber")) {
-            m_ribNumber_choice2 = tixi::TixiGetElement<int>(tixiHandle, xpath + "/ribNumber");
-        }
+        tixi::TixiTryGetElement(tixiHandle, xpath + "/ribNumber", m_ribNumber_choice2);
 
         // read element ribDefinitionUID
-        if (tixi::TixiCheckElement(tixiHandle, xpath + "/ribDefinitionUID")) {
-            m_ribDefinitionUID_choice2 = tixi::TixiGetElement<std::string>(tixiHandle, xpath + "/ribDefinitionUID");
+        if (tixi::TixiTryGetElement(tixiHandle, xpath + "/ribDefinitionUID", m_ribDefinitionUID_choice2)) {
             if (m_ribDefinitionUID_choice2->empty()) {
                 LOG(WARNING) << "Optional element ribDefinitionUID is present but empty at xpath " << xpath;
             }
@@ -124,6 +118,23 @@ namespace generated
 
     }
 
+    bool CPACSCellPositioningSpanwise::IsDirty() const
+    {
+        return m_dirty;
+    }
+
+    void CPACSCellPositioningSpanwise::ClearDirty()
+    {
+        m_dirty = false;
+    }
+
+    void CPACSCellPositioningSpanwise::WriteDirtyCPACS(const TixiDocumentHandle& tixiHandle, const std::string& xpath) const
+    {
+        if (m_dirty) {
+            WriteCPACS(tixiHandle, xpath);
+        }
+    }
+
     bool CPACSCellPositioningSpanwise::ValidateChoices() const
     {
         return
@@ -169,6 +180,7 @@ namespace generated
 
     void CPACSCellPositioningSpanwise::SetEta1_choice1(const boost::optional<double>& value)
     {
+        m_dirty = true;
         m_eta1_choice1 = value;
     }
 
@@ -179,6 +191,7 @@ namespace generated
 
     void CPACSCellPositioningSpanwise::SetEta2_choice1(const boost::optional<double>& value)
     {
+        m_dirty = true;
         m_eta2_choice1 = value;
     }
 
@@ -189,6 +202,7 @@ namespace generated
 
     void CPACSCellPositioningSpanwise::SetRibNumber_choice2(const boost::optional<int>& value)
     {
+        m_dirty = true;
         m_ribNumber_choice2 = value;
     }
 
@@ -199,6 +213,7 @@ namespace generated
 
     void CPACSCellPositioningSpanwise::SetRibDefinitionUID_choice2(const boost::optional<std::string>& value)
     {
+        m_dirty = true;
         m_ribDefinitionUID_choice2 = value;
     }
 
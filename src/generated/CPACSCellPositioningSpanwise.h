@@ -53,6 +53,10 @@ namespace generated
         TIGL_EXPORT virtual void ReadCPACS(const TixiDocumentHandle& tixiHandle, const std::string& xpath);
         TIGL_EXPORT virtual void WriteCPACS(const TixiDocumentHandle& tixiHandle, const std::string& xpath) const;
 
+        TIGL_EXPORT virtual bool IsDirty() const;
+        TIGL_EXPORT virtual void ClearDirty();
+        TIGL_EXPORT virtual void WriteDirtyCPACS(const TixiDocumentHandle& tixiHandle, const std::string& xpath) const;
+
         TIGL_EXPORT bool ValidateChoices() const;
 
         TIGL_EXPORT virtual const boost::optional<double>& GetEta1_choice1() const;
@@ -85,6 +89,9 @@ namespace generated
         /// rib of this ribDefinition set is defined by using 'ribNumber'.
         boost::optional<std::string> m_ribDefinitionUID_choice2;
 
+        /// Set by the setters, cleared after the object has been read or written
+        bool m_dirty;
+
     private:
 #ifdef HAVE_CPP11
         CPACSCellPositioningSpanwise(const CPACSCellPositioningSpanwise&) = delete;
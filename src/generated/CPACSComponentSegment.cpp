@@ -29,6 +29,7 @@ namespace generated
 {
     CPACSComponentSegment::CPACSComponentSegment(CCPACSWingComponentSegments* parent, CTiglUIDManager* uidMgr)
         : m_uidMgr(uidMgr)
+        , m_dirty(true)
     {
         //assert(parent != NULL);
         m_parent = parent;
@@ -62,8 +63,7 @@ namespace generated
     void CPACSComponentSegment::ReadCPACS(const TixiDocumentHandle& tixiHandle, const std::string& xpath)
     {
         // read attribute uID
-        if (tixi::TixiCheckAttribute(tixiHandle, xpath, "uID")) {
-            m_uID = tixi::TixiGetAttribute<std::string>(tixiHandle, xpath, "uID");
+        if (tixi::TixiTryGetAttribute(tixiHandle, xpath, "uID", m_uID)) {
             if (m_uID.empty()) {
                 LOG(WARNING) << "Required attribute uID is empty at xpath " << xpath;
             }
@@ -73,8 +73,7 @@ namespace generated
         }
 
         // read element name
-        if (tixi::TixiCheckElement(tixiHandle, xpath + "/name")) {
-            m_name = tixi::TixiGetElement<std::string>(tixiHandle, xpath + "/name");
+        if (tixi::TixiTryGetElement(tixiHandle, xpath + "/name", m_name)) {
             if (m_name.empty()) {
                 LOG(WARNING) << "Required element name is empty at xpath " << xpath;
             }
@@ -84,16 +83,14 @@ namespace generated
         }
 
         // read element description
-        if (tixi::TixiCheckElement(tixiHandle, xpath + "/description")) {
-            m_description = tixi::TixiGetElement<std::string>(tixiHandle, xpath + "/description");
+        if (tixi::TixiTryGetElement(tixiHandle, xpath + "/description", m_description)) {
             if (m_description->empty()) {
                 LOG(WARNING) << "Optional element description is present but empty at xpath " << xpath;
             }
         }
 
         // read element fromElementUID
-        if (tixi::TixiCheckElement(tixiHandle, xpath + "/fromElementUID")) {
-            m_fromElementUID = tixi::TixiGetElement<std::string>(tixiHandle, xpath + "/fromElementUID");
+        if (tixi::TixiTryGetElement(tixiHandle, xpath + "/fromElementUID", m_fromElementUID)) {
             if (m_fromElementUID.empty()) {
                 LOG(WARNING) << "Required element fromElementUID is empty at xpath " << xpath;
             }
@@ -103,8 +100,7 @@ namespace generated
         }
 
         // read element toElementUID
-        if (tixi::TixiCheckElement(tixiHandle, xpath + "/toElementUID")) {
-            m_toElementUID = tixi::TixiGetElement<std::string>(tixiHandle, xpath + "/toElementUID");
+        if (tixi::TixiTryGetElement(tixiHandle, xpath + "/toElementUID", m_toElementUID)) {
             if (m_toElementUID.empty()) {
                 LOG(WARNING) << "Required element toElementUID is empty at xpath " << xpath;
             }
@@ -190,6 +186,51 @@ namespace generated
 
     }
 
+    bool CPACSComponentSegment::IsDirty() const
+    {
+        if (m_dirty) {
+            return true;
+        }
+        if (m_structure && m_structure->IsDirty()) {
+            return true;
+        }
+        if (m_controlSurfaces && m_controlSurfaces->IsDirty()) {
+            return true;
+        }
+        return false;
+    }
+
+    void CPACSComponentSegment::ClearDirty()
+    {
+        m_dirty = false;
+        if (m_structure) {
+            m_structure->ClearDirty();
+        }
+        if (m_controlSurfaces) {
+            m_controlSurfaces->ClearDirty();
+        }
+    }
+
+    void CPACSComponentSegment::WriteDirtyCPACS(const TixiDocumentHandle& tixiHandle, const std::string& xpath) const
+    {
+        if (m_dirty) {
+            WriteCPACS(tixiHandle, xpath);
+            return;
+        }
+
+        // write modified element structure
+        if (m_structure && m_structure->IsDirty()) {
+            tixi::TixiCreateElementIfNotExists(tixiHandle, xpath + "/structure");
+            m_structure->WriteDirtyCPACS(tixiHandle, xpath + "/structure");
+        }
+
+        // write modified element controlSurfaces
+        if (m_controlSurfaces && m_controlSurfaces->IsDirty()) {
+            tixi::TixiCreateElementIfNotExists(tixiHandle, xpath + "/controlSurfaces");
+            m_controlSurfaces->WriteDirtyCPACS(tixiHandle, xpath + "/controlSurfaces");
+        }
+    }
+
     const std::string& CPACSComponentSegment::GetUID() const
     {
         return m_uID;
@@ -197,6 +238,7 @@ namespace generated
 
     void CPACSComponentSegment::SetUID(const std::string& value)
     {
+        m_dirty = true;
         if (m_uidMgr) {
             m_uidMgr->TryUnregisterObject(m_uID);
             m_uidMgr->RegisterObject(value, *this);
@@ -211,6 +253,7 @@ namespace generated
 
     void CPACSComponentSegment::SetName(const std::string& value)
     {
+        m_dirty = true;
         m_name = value;
     }
 
@@ -221,6 +264,7 @@ namespace generated
 
     void CPACSComponentSegment::SetDescription(const boost::optional<std::string>& value)
     {
+        m_dirty = true;
         m_description = value;
     }
 
@@ -231,6 +275,7 @@ namespace generated
 
     void CPACSComponentSegment::SetFromElementUID(const std::string& value)
     {
+        m_dirty = true;
         m_fromElementUID = value;
     }
 
@@ -241,6 +286,7 @@ namespace generated
 
     void CPACSComponentSegment::SetToElementUID(const std::string& value)
     {
+        m_dirty = true;
         m_toElementUID = value;
     }
 
@@ -273,6 +319,7 @@ namespace generated
 
     void CPACSComponentSegment::RemoveStructure()
     {
+        m_dirty = true;
         m_structure = boost::none;
     }
 
@@ -285,6 +332,7 @@ namespace generated
 
     void CPACSComponentSegment::RemoveControlSurfaces()
     {
+        m_dirty = true;
         m_controlSurfaces = boost::none;
     }
 
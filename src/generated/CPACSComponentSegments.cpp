@@ -30,6 +30,7 @@ namespace generated
 {
     CPACSComponentSegments::CPACSComponentSegments(CCPACSWing* parent, CTiglUIDManager* uidMgr)
         : m_uidMgr(uidMgr)
+        , m_dirty(true)
     {
         //assert(parent != NULL);
         m_parent = parent;
@@ -75,6 +76,43 @@ namespace generated
 
     }
 
+    bool CPACSComponentSegments::IsDirty() const
+    {
+        if (m_dirty) {
+            return true;
+        }
+        if (m_componentSegments.size() != m_componentSegmentsClean.size()) {
+            return true;
+        }
+        for (std::size_t i = 0; i < m_componentSegments.size(); i++) {
+            if (m_componentSegments[i].get() != m_componentSegmentsClean[i] || m_componentSegments[i]->IsDirty()) {
+                return true;
+            }
+        }
+        return false;
+    }
+
+    void CPACSComponentSegments::ClearDirty()
+    {
+        m_dirty = false;
+        m_componentSegmentsClean.clear();
+        for (std::size_t i = 0; i < m_componentSegments.size(); i++) {
+            m_componentSegmentsClean.push_back(m_componentSegments[i].get());
+            m_componentSegments[i]->ClearDirty();
+        }
+    }
+
+    void CPACSComponentSegments::WriteDirtyCPACS(const TixiDocumentHandle& tixiHandle, const std::string& xpath) const
+    {
+        if (m_dirty) {
+            WriteCPACS(tixiHandle, xpath);
+            return;
+        }
+
+        // write modified elements componentSegment
+        tixi::TixiSaveDirtyElements(tixiHandle, xpath + "/componentSegment", m_componentSegments, m_componentSegmentsClean);
+    }
+
     const std::vector<unique_ptr<CCPACSWingComponentSegment> >& CPACSComponentSegments::GetComponentSegments() const
     {
         return m_componentSegments;
@@ -93,6 +131,7 @@ namespace generated
 
     void CPACSComponentSegments::RemoveComponentSegment(CCPACSWingComponentSegment& ref)
     {
+        m_dirty = true;
         for (std::size_t i = 0; i < m_componentSegments.size(); i++) {
             if (m_componentSegments[i].get() == &ref) {
                 m_componentSegments.erase(m_componentSegments.begin() + i);
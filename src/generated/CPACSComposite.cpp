@@ -28,6 +28,7 @@ namespace generated
 {
     CPACSComposite::CPACSComposite(CTiglUIDManager* uidMgr)
         : m_uidMgr(uidMgr)
+        , m_dirty(true)
     {
     }
 
@@ -49,8 +50,7 @@ namespace generated
     void CPACSComposite::ReadCPACS(const TixiDocumentHandle& tixiHandle, const std::string& xpath)
     {
         // read attribute uID
-        if (tixi::TixiCheckAttribute(tixiHandle, xpath, "uID")) {
-            m_uID = tixi::TixiGetAttribute<std::string>(tixiHandle, xpath, "uID");
+        if (tixi::TixiTryGetAttribute(tixiHandle, xpath, "uID", m_uID)) {
             if (m_uID.empty()) {
                 LOG(WARNING) << "Required attribute uID is empty at xpath " << xpath;
             }
@@ -60,8 +60,7 @@ namespace generated
         }
 
         // read element name
-        if (tixi::TixiCheckElement(tixiHandle, xpath + "/name")) {
-            m_name = tixi::TixiGetElement<std::string>(tixiHandle, xpath + "/name");
+        if (tixi::TixiTryGetElement(tixiHandle, xpath + "/name", m_name)) {
             if (m_name.empty()) {
                 LOG(WARNING) << "Required element name is empty at xpath " << xpath;
             }
@@ -71,17 +70,14 @@ namespace generated
         }
 
         // read element description
-        if (tixi::TixiCheckElement(tixiHandle, xpath + "/description")) {
-            m_description = tixi::TixiGetElement<std::string>(tixiHandle, xpath + "/description");
+        if (tixi::TixiTryGetElement(tixiHandle, xpath + "/description", m_description)) {
             if (m_description->empty()) {
                 LOG(WARNING) << "Optional element description is present but empty at xpath " << xpath;
             }
         }
 
         // read element offset
-        if (tixi::TixiCheckElement(tixiHandle, xpath + "/offset")) {
-            m_offset = tixi::TixiGetElement<double>(tixiHandle, xpath + "/offset");
-        }
+        tixi::TixiTryGetElement(tixiHandle, xpath + "/offset", m_offset);
 
         // read element compositeLayer
         if (tixi::TixiCheckElement(tixiHandle, xpath + "/compositeLayer")) {
@@ -127,6 +123,43 @@ namespace generated
 
     }
 
+    bool CPACSComposite::IsDirty() const
+    {
+        if (m_dirty) {
+            return true;
+        }
+        if (m_compositeLayers.size() != m_compositeLayersClean.size()) {
+            return true;
+        }
+        for (std::size_t i = 0; i < m_compositeLayers.size(); i++) {
+            if (m_compositeLayers[i].get() != m_compositeLayersClean[i] || m_compositeLayers[i]->IsDirty()) {
+                return true;
+            }
+        }
+        return false;
+    }
+
+    void CPACSComposite::ClearDirty()
+    {
+        m_dirty = false;
+        m_compositeLayersClean.clear();
+        for (std::size_t i = 0; i < m_compositeLayers.size(); i++) {
+            m_compositeLayersClean.push_back(m_compositeLayers[i].get());
+            m_compositeLayers[i]->ClearDirty();
+        }
+    }
+
+    void CPACSComposite::WriteDirtyCPACS(const TixiDocumentHandle& tixiHandle, const std::string& xpath) const
+    {
+        if (m_dirty) {
+            WriteCPACS(tixiHandle, xpath);
+            return;
+        }
+
+        // write modified elements compositeLayer
+        tixi::TixiSaveDirtyElements(tixiHandle, xpath + "/compositeLayer", m_compositeLayers, m_compositeLayersClean);
+    }
+
     const std::string& CPACSComposite::GetUID() const
     {
         return m_uID;
@@ -134,6 +167,7 @@ namespace generated
 
     void CPACSComposite::SetUID(const std::string& value)
     {
+        m_dirty = true;
         if (m_uidMgr) {
             m_uidMgr->TryUnregisterObject(m_uID);
             m_uidMgr->RegisterObject(value, *this);
@@ -148,6 +182,7 @@ namespace generated
 
     void CPACSComposite::SetName(const std::string& value)
     {
+        m_dirty = true;
         m_name = value;
     }
 
@@ -158,6 +193,7 @@ namespace generated
 
     void CPACSComposite::SetDescription(const boost::optional<std::string>& value)
     {
+        m_dirty = true;
         m_description = value;
     }
 
@@ -168,6 +204,7 @@ namespace generated
 
     void CPACSComposite::SetOffset(const boost::optional<double>& value)
     {
+        m_dirty = true;
         m_offset = value;
     }
 
@@ -189,6 +226,7 @@ namespace generated
 
     void CPACSComposite::RemoveCompositeLayer(CPACSCompositeLayer& ref)
     {
+        m_dirty = true;
         for (std::size_t i = 0; i < m_compositeLayers.size(); i++) {
             if (m_compositeLayers[i].get() == &ref) {
                 m_compositeLayers.erase(m_compositeLayers.begin() + i);
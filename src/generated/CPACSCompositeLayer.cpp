@@ -27,6 +27,7 @@ namespace generated
     CPACSCompositeLayer::CPACSCompositeLayer()
         : m_thickness(0)
         , m_phi(0)
+        , m_dirty(true)
     {
     }
 
@@ -37,40 +38,31 @@ namespace generated
     void CPACSCompositeLayer::ReadCPACS(const TixiDocumentHandle& tixiHandle, const std::string& xpath)
     {
         // read element name
-        if (tixi::TixiCheckElement(tixiHandle, xpath + "/name")) {
-            m_name = tixi::TixiGetElement<std::string>(tixiHandle, xpath + "/name");
+        if (tixi::TixiTryGetElement(tixiHandle, xpath + "/name", m_name)) {
             if (m_name->empty()) {
                 LOG(WARNING) << "Optional element name is present but empty at xpath " << xpath;
             }
         }
 
         // read element description
-        if (tixi::TixiCheckElement(tixiHandle, xpath + "/description")) {
-            m_description = tixi::TixiGetElement<std::string>(tixiHandle, xpath + "/description");
+        if (tixi::TixiTryGetElement(tixiHandle, xpath + "/description", m_description)) {
             if (m_description->empty()) {
                 LOG(WARNING) << "Optional element description is present but empty at xpath " << xpath;
             }
         }
 
         // read element thickness
-        if (tixi::TixiCheckElement(tixiHandle, xpath + "/thickness")) {
-            m_thickness = tixi::TixiGetElement<double>(tixiHandle, xpath + "/thickness");
-        }
-        else {
+        if (!tixi::TixiTryGetElement(tixiHandle, xpath + "/thickness", m_thickness)) {
             LOG(ERROR) << "Required element thickness is missing at xpath " << xpath;
         }
 
         // read element phi
-        if (tixi::TixiCheckElement(tixiHandle, xpath + "/phi")) {
-            m_phi = tixi::TixiGetElement<double>(tixiHandle, xpath + "/phi");
-        }
-        else {
+        if (!tixi::TixiTryGetElement(tixiHandle, xpath + "/phi", m_phi)) {
             LOG(ERROR) << "Required element phi is missing at xpath " << xpath;
         }
 
         // read element materialUID
-        if (tixi::TixiCheckElement(tixiHandle, xpath + "/materialUID")) {
-            m_materialUID = tixi::TixiGetElement<std::string>(tixiHandle, xpath + "/materialUID");
+        if (tixi::TixiTryGetElement(tixiHandle, xpath + "/materialUID", m_materialUID)) {
             if (m_materialUID.empty()) {
                 LOG(WARNING) << "Required element materialUID is empty at xpath " << xpath;
             }
@@ -119,6 +111,23 @@ namespace generated
 
     }
 
+    bool CPACSCompositeLayer::IsDirty() const
+    {
+        return m_dirty;
+    }
+
+    void CPACSCompositeLayer::ClearDirty()
+    {
+        m_dirty = false;
+    }
+
+    void CPACSCompositeLayer::WriteDirtyCPACS(const TixiDocumentHandle& tixiHandle, const std::string& xpath) const
+    {
+        if (m_dirty) {
+            WriteCPACS(tixiHandle, xpath);
+        }
+    }
+
     const boost::optional<std::string>& CPACSCompositeLayer::GetName() const
     {
         return m_name;
@@ -126,6 +135,7 @@ namespace generated
 
     void CPACSCompositeLayer::SetName(const boost::optional<std::string>& value)
     {
+        m_dirty = true;
         m_name = value;
     }
 
@@ -136,6 +146,7 @@ namespace generated
 
     void CPACSCompositeLayer::SetDescription(const boost::optional<std::string>& value)
     {
+        m_dirty = true;
         m_description = value;
     }
 
@@ -146,6 +157,7 @@ namespace generated
 
     void CPACSCompositeLayer::SetThickness(const double& value)
     {
+        m_dirty = true;
         m_thickness = value;
     }
 
@@ -156,6 +168,7 @@ namespace generated
 
     void CPACSCompositeLayer::SetPhi(const double& value)
     {
+        m_dirty = true;
         m_phi = value;
     }
 
@@ -166,6 +179,7 @@ namespace generated
 
     void CPACSCompositeLayer::SetMaterialUID(const std::string& value)
     {
+        m_dirty = true;
         m_materialUID = value;
     }
 
@@ -45,6 +45,10 @@ namespace generated
         TIGL_EXPORT virtual void ReadCPACS(const TixiDocumentHandle& tixiHandle, const std::string& xpath);
         TIGL_EXPORT virtual void WriteCPACS(const TixiDocumentHandle& tixiHandle, const std::string& xpath) const;
 
+        TIGL_EXPORT virtual bool IsDirty() const;
+        TIGL_EXPORT virtual void ClearDirty();
+        TIGL_EXPORT virtual void WriteDirtyCPACS(const TixiDocumentHandle& tixiHandle, const std::string& xpath) const;
+
         TIGL_EXPORT virtual const boost::optional<std::string>& GetName() const;
         TIGL_EXPORT virtual void SetName(const boost::optional<std::string>& value);
 
@@ -76,6 +80,9 @@ namespace generated
         /// Material UID of the layer
         std::string                  m_materialUID;
 
+        /// Set by the setters, cleared after the object has been read or written
+        bool m_dirty;
+
     private:
 #ifdef HAVE_CPP11
         CPACSCompositeLayer(const CPACSCompositeLayer&) = delete;
@@ -28,6 +28,7 @@ namespace generated
 {
     CPACSComposites::CPACSComposites(CTiglUIDManager* uidMgr)
         : m_uidMgr(uidMgr)
+        , m_dirty(true)
     {
     }
 
@@ -61,6 +62,43 @@ namespace generated
 
     }
 
+    bool CPACSComposites::IsDirty() const
+    {
+        if (m_dirty) {
+            return true;
+        }
+        if (m_composites.size() != m_compositesClean.size()) {
+            return true;
+        }
+        for (std::size_t i = 0; i < m_composites.size(); i++) {
+            if (m_composites[i].get() != m_compositesClean[i] || m_composites[i]->IsDirty()) {
+                return true;
+            }
+        }
+        return false;
+    }
+
+    void CPACSComposites::ClearDirty()
+    {
+        m_dirty = false;
+        m_compositesClean.clear();
+        for (std::size_t i = 0; i < m_composites.size(); i++) {
+            m_compositesClean.push_back(m_composites[i].get());
+            m_composites[i]->ClearDirty();
+        }
+    }
+
+    void CPACSComposites::WriteDirtyCPACS(const TixiDocumentHandle& tixiHandle, const std::string& xpath) const
+    {
+        if (m_dirty) {
+            WriteCPACS(tixiHandle, xpath);
+            return;
+        }
+
+        // write modified elements composite
+        tixi::TixiSaveDirtyElements(tixiHandle, xpath + "/composite", m_composites, m_compositesClean);
+    }
+
     const std::vector<unique_ptr<CPACSComposite> >& CPACSComposites::GetComposites() const
     {
         return m_composites;
@@ -79,6 +117,7 @@ namespace generated
 
     void CPACSComposites::RemoveComposite(CPACSComposite& ref)
     {
+        m_dirty = true;
         for (std::size_t i = 0; i < m_composites.size(); i++) {
             if (m_composites[i].get() == &ref) {
                 m_composites.erase(m_composites.begin() + i);
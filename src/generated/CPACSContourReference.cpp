@@ -28,6 +28,7 @@ namespace generated
         : m_rotX(0)
         , m_scalY(0)
         , m_scalZ(0)
+        , m_dirty(true)
     {
     }
 
@@ -38,8 +39,7 @@ namespace generated
     void CPACSContourReference::ReadCPACS(const TixiDocumentHandle& tixiHandle, const std::string& xpath)
     {
         // read element airfoilUID
-        if (tixi::TixiCheckElement(tixiHandle, xpath + "/airfoilUID")) {
-            m_airfoilUID = tixi::TixiGetElement<std::string>(tixiHandle, xpath + "/airfoilUID");
+        if (tixi::TixiTryGetElement(tixiHandle, xpath + "/airfoilUID", m_airfoilUID)) {
             if (m_airfoilUID.empty()) {
                 LOG(WARNING) << "Required element airfoilUID is empty at xpath " << xpath;
             }
@@ -49,26 +49,17 @@ namespace generated
         }
 
         // read element rotX
-        if (tixi::TixiCheckElement(tixiHandle, xpath + "/rotX")) {
-            m_rotX = tixi::TixiGetElement<double>(tixiHandle, xpath + "/rotX");
-        }
-        else {
+        if (!tixi::TixiTryGetElement(tixiHandle, xpath + "/rotX", m_rotX)) {
             LOG(ERROR) << "Required element rotX is missing at xpath " << xpath;
         }
 
         // read element scalY
-        if (tixi::TixiCheckElement(tixiHandle, xpath + "/scalY")) {
-            m_scalY = tixi::TixiGetElement<double>(tixiHandle, xpath + "/scalY");
-        }
-        else {
+        if (!tixi::TixiTryGetElement(tixiHandle, xpath + "/scalY", m_scalY)) {
             LOG(ERROR) << "Required element scalY is missing at xpath " << xpath;
         }
 
         // read element scalZ
-        if (tixi::TixiCheckElement(tixiHandle, xpath + "/scalZ")) {
-            m_scalZ = tixi::TixiGetElement<double>(tixiHandle, xpath + "/scalZ");
-        }
-        else {
+        if (!tixi::TixiTryGetElement(tixiHandle, xpath + "/scalZ", m_scalZ)) {
             LOG(ERROR) << "Required element scalZ is missing at xpath " << xpath;
         }
 
@@ -94,6 +85,23 @@ namespace generated
 
     }
 
+    bool CPACSContourReference::IsDirty() const
+    {
+        return m_dirty;
+    }
+
+    void CPACSContourReference::ClearDirty()
+    {
+        m_dirty = false;
+    }
+
+    void CPACSContourReference::WriteDirtyCPACS(const TixiDocumentHandle& tixiHandle, const std::string& xpath) const
+    {
+        if (m_dirty) {
+            WriteCPACS(tixiHandle, xpath);
+        }
+    }
+
     const std::string& CPACSContourReference::GetAirfoilUID() const
     {
         return m_airfoilUID;
@@ -101,6 +109,7 @@ namespace generated
 
     void CPACSContourReference::SetAirfoilUID(const std::string& value)
     {
+        m_dirty = true;
         m_airfoilUID = value;
     }
 
@@ -111,6 +120,7 @@ namespace generated
 
     void CPACSContourReference::SetRotX(const double& value)
     {
+        m_dirty = true;
         m_rotX = value;
     }
 
@@ -121,6 +131,7 @@ namespace generated
 
     void CPACSContourReference::SetScalY(const double& value)
     {
+        m_dirty = true;
         m_scalY = value;
     }
 
@@ -131,6 +142,7 @@ namespace generated
 
     void CPACSContourReference::SetScalZ(const double& value)
     {
+        m_dirty = true;
         m_scalZ = value;
     }
 
@@ -29,6 +29,7 @@ namespace generated
         , m_rotZ(0)
         , m_scalY(0)
         , m_scalZ(0)
+        , m_dirty(true)
     {
     }
 
@@ -47,8 +48,7 @@ namespace generated
         }
 
         // read element airfoilUID
-        if (tixi::TixiCheckElement(tixiHandle, xpath + "/airfoilUID")) {
-            m_airfoilUID = tixi::TixiGetElement<std::string>(tixiHandle, xpath + "/airfoilUID");
+        if (tixi::TixiTryGetElement(tixiHandle, xpath + "/airfoilUID", m_airfoilUID)) {
             if (m_airfoilUID.empty()) {
                 LOG(WARNING) << "Required element airfoilUID is empty at xpath " << xpath;
             }
@@ -58,34 +58,22 @@ namespace generated
         }
 
         // read element rotX
-        if (tixi::TixiCheckElement(tixiHandle, xpath + "/rotX")) {
-            m_rotX = tixi::TixiGetElement<double>(tixiHandle, xpath + "/rotX");
-        }
-        else {
+        if (!tixi::TixiTryGetElement(tixiHandle, xpath + "/rotX", m_rotX)) {
             LOG(ERROR) << "Required element rotX is missing at xpath " << xpath;
         }
 
         // read element rotZ
-        if (tixi::TixiCheckElement(tixiHandle, xpath + "/rotZ")) {
-            m_rotZ = tixi::TixiGetElement<double>(tixiHandle, xpath + "/rotZ");
-        }
-        else {
+        if (!tixi::TixiTryGetElement(tixiHandle, xpath + "/rotZ", m_rotZ)) {
             LOG(ERROR) << "Required element rotZ is missing at xpath " << xpath;
         }
 
         // read element scalY
-        if (tixi::TixiCheckElement(tixiHandle, xpath + "/scalY")) {
-            m_scalY = tixi::TixiGetElement<double>(tixiHandle, xpath + "/scalY");
-        }
-        else {
+        if (!tixi::TixiTryGetElement(tixiHandle, xpath + "/scalY", m_scalY)) {
             LOG(ERROR) << "Required element scalY is missing at xpath " << xpath;
         }
 
         // read element scalZ
-        if (tixi::TixiCheckElement(tixiHandle, xpath + "/scalZ")) {
-            m_scalZ = tixi::TixiGetElement<double>(tixiHandle, xpath + "/scalZ");
-        }
-        else {
+        if (!tixi::TixiTryGetElement(tixiHandle, xpath + "/scalZ", m_scalZ)) {
             LOG(ERROR) << "Required element scalZ is missing at xpath " << xpath;
         }
 
@@ -119,6 +107,37 @@ namespace generated
 
     }
 
+    bool CPACSControlSurfaceAirfoil::IsDirty() const
+    {
+        if (m_dirty) {
+            return true;
+        }
+        if (m_eta.IsDirty()) {
+            return true;
+        }
+        return false;
+    }
+
+    void CPACSControlSurfaceAirfoil::ClearDirty()
+    {
+        m_dirty = false;
+        m_eta.ClearDirty();
+    }
+
+    void CPACSControlSurfaceAirfoil::WriteDirtyCPACS(const TixiDocumentHandle& tixiHandle, const std::string& xpath) const
+    {
+        if (m_dirty) {
+            WriteCPACS(tixiHandle, xpath);
+            return;
+        }
+
+        // write modified element eta
+        if (m_eta.IsDirty()) {
+            tixi::TixiCreateElementIfNotExists(tixiHandle, xpath + "/eta");
+            m_eta.WriteDirtyCPACS(tixiHandle, xpath + "/eta");
+        }
+    }
+
     const CPACSEtaIsoLine& CPACSControlSurfaceAirfoil::GetEta() const
     {
         return m_eta;
@@ -136,6 +155,7 @@ namespace generated
 
     void CPACSControlSurfaceAirfoil::SetAirfoilUID(const std::string& value)
     {
+        m_dirty = true;
         m_airfoilUID = value;
     }
 
@@ -146,6 +166,7 @@ namespace generated
 
     void CPACSControlSurfaceAirfoil::SetRotX(const double& value)
     {
+        m_dirty = true;
         m_rotX = value;
     }
 
@@ -156,6 +177,7 @@ namespace generated
 
     void CPACSControlSurfaceAirfoil::SetRotZ(const double& value)
     {
+        m_dirty = true;
         m_rotZ = value;
     }
 
@@ -166,6 +188,7 @@ namespace generated
 
     void CPACSControlSurfaceAirfoil::SetScalY(const double& value)
     {
+        m_dirty = true;
         m_scalY = value;
     }
 
@@ -176,6 +199,7 @@ namespace generated
 
     void CPACSControlSurfaceAirfoil::SetScalZ(const double& value)
     {
+        m_dirty = true;
         m_scalZ = value;
     }
 
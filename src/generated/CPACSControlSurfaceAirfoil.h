@@ -53,6 +53,10 @@ namespace generated
         TIGL_EXPORT virtual void ReadCPACS(const TixiDocumentHandle& tixiHandle, const std::string& xpath);
         TIGL_EXPORT virtual void WriteCPACS(const TixiDocumentHandle& tixiHandle, const std::string& xpath) const;
 
+        TIGL_EXPORT virtual bool IsDirty() const;
+        TIGL_EXPORT virtual void ClearDirty();
+        TIGL_EXPORT virtual void WriteDirtyCPACS(const TixiDocumentHandle& tixiHandle, const std::string& xpath) const;
+
         TIGL_EXPORT virtual const CPACSEtaIsoLine& GetEta() const;
         TIGL_EXPORT virtual CPACSEtaIsoLine& GetEta();
 
@@ -100,6 +104,9 @@ namespace generated
         /// Scaling in thickness direction of the airfoil.
         double          m_scalZ;
 
+        /// Set by the setters, cleared after the object has been read or written
+        bool m_dirty;
+
     private:
 #ifdef HAVE_CPP11
         CPACSControlSurfaceAirfoil(const CPACSControlSurfaceAirfoil&) = delete;
@@ -27,6 +27,7 @@ namespace tigl
 namespace generated
 {
     CPACSControlSurfaceBorderTrailingEdge::CPACSControlSurfaceBorderTrailingEdge(CPACSControlSurfaceOuterShapeTrailingEdge* parent)
+        : m_dirty(true)
     {
         //assert(parent != NULL);
         m_parent = parent;
@@ -166,6 +167,95 @@ namespace generated
 
     }
 
+    bool CPACSControlSurfaceBorderTrailingEdge::IsDirty() const
+    {
+        if (m_dirty) {
+            return true;
+        }
+        if (m_etaLE.IsDirty()) {
+            return true;
+        }
+        if (m_etaTE && m_etaTE->IsDirty()) {
+            return true;
+        }
+        if (m_xsiLE.IsDirty()) {
+            return true;
+        }
+        if (m_innerShape && m_innerShape->IsDirty()) {
+            return true;
+        }
+        if (m_leadingEdgeShape && m_leadingEdgeShape->IsDirty()) {
+            return true;
+        }
+        if (m_airfoil && m_airfoil->IsDirty()) {
+            return true;
+        }
+        return false;
+    }
+
+    void CPACSControlSurfaceBorderTrailingEdge::ClearDirty()
+    {
+        m_dirty = false;
+        m_etaLE.ClearDirty();
+        if (m_etaTE) {
+            m_etaTE->ClearDirty();
+        }
+        m_xsiLE.ClearDirty();
+        if (m_innerShape) {
+            m_innerShape->ClearDirty();
+        }
+        if (m_leadingEdgeShape) {
+            m_leadingEdgeShape->ClearDirty();
+        }
+        if (m_airfoil) {
+            m_airfoil->ClearDirty();
+        }
+    }
+
+    void CPACSControlSurfaceBorderTrailingEdge::WriteDirtyCPACS(const TixiDocumentHandle& tixiHandle, const std::string& xpath) const
+    {
+        if (m_dirty) {
+            WriteCPACS(tixiHandle, xpath);
+            return;
+        }
+
+        // write modified element etaLE
+        if (m_etaLE.IsDirty()) {
+            tixi::TixiCreateElementIfNotExists(tixiHandle, xpath + "/etaLE");
+            m_etaLE.WriteDirtyCPACS(tixiHandle, xpath + "/etaLE");
+        }
+
+        // write modified element etaTE
+        if (m_etaTE && m_etaTE->IsDirty()) {
+            tixi::TixiCreateElementIfNotExists(tixiHandle, xpath + "/etaTE");
+            m_etaTE->WriteDirtyCPACS(tixiHandle, xpath + "/etaTE");
+        }
+
+        // write modified element xsiLE
+        if (m_xsiLE.IsDirty()) {
+            tixi::TixiCreateElementIfNotExists(tixiHandle, xpath + "/xsiLE");
+            m_xsiLE.WriteDirtyCPACS(tixiHandle, xpath + "/xsiLE");
+        }
+
+        // write modified element innerShape
+        if (m_innerShape && m_innerShape->IsDirty()) {
+            tixi::TixiCreateElementIfNotExists(tixiHandle, xpath + "/innerShape");
+            m_innerShape->WriteDirtyCPACS(tixiHandle, xpath + "/innerShape");
+        }
+
+        // write modified element leadingEdgeShape
+        if (m_leadingEdgeShape && m_leadingEdgeShape->IsDirty()) {
+            tixi::TixiCreateElementIfNotExists(tixiHandle, xpath + "/leadingEdgeShape");
+            m_leadingEdgeShape->WriteDirtyCPACS(tixiHandle, xpath + "/leadingEdgeShape");
+        }
+
+        // write modified element airfoil
+        if (m_airfoil && m_airfoil->IsDirty()) {
+            tixi::TixiCreateElementIfNotExists(tixiHandle, xpath + "/airfoil");
+            m_airfoil->WriteDirtyCPACS(tixiHandle, xpath + "/airfoil");
+        }
+    }
+
     const CPACSEtaIsoLine& CPACSControlSurfaceBorderTrailingEdge::GetEtaLE() const
     {
         return m_etaLE;
@@ -235,6 +325,7 @@ namespace generated
 
     void CPACSControlSurfaceBorderTrailingEdge::RemoveEtaTE()
     {
+        m_dirty = true;
         m_etaTE = boost::none;
     }
 
@@ -247,6 +338,7 @@ namespace generated
 
     void CPACSControlSurfaceBorderTrailingEdge::RemoveInnerShape()
     {
+        m_dirty = true;
         m_innerShape = boost::none;
     }
 
@@ -259,6 +351,7 @@ namespace generated
 
     void CPACSControlSurfaceBorderTrailingEdge::RemoveLeadingEdgeShape()
     {
+        m_dirty = true;
         m_leadingEdgeShape = boost::none;
     }
 
@@ -271,6 +364,7 @@ namespace generated
 
     void CPACSControlSurfaceBorderTrailingEdge::RemoveAirfoil()
     {
+        m_dirty = true;
         m_airfoil = boost::none;
     }
 
@@ -26,6 +26,7 @@ namespace tigl
 namespace generated
 {
     CPACSControlSurfaceContours::CPACSControlSurfaceContours()
+        : m_dirty(true)
     {
     }
 
@@ -49,6 +50,43 @@ namespace generated
 
     }
 
+    bool CPACSControlSurfaceContours::IsDirty() const
+    {
+        if (m_dirty) {
+            return true;
+        }
+        if (m_intermediateAirfoils.size() != m_intermediateAirfoilsClean.size()) {
+            return true;
+        }
+        for (std::size_t i = 0; i < m_intermediateAirfoils.size(); i++) {
+            if (m_intermediateAirfoils[i].get() != m_intermediateAirfoilsClean[i] || m_intermediateAirfoils[i]->IsDirty()) {
+                return true;
+            }
+        }
+        return false;
+    }
+
+    void CPACSControlSurfaceContours::ClearDirty()
+    {
+        m_dirty = false;
+        m_intermediateAirfoilsClean.clear();
+        for (std::size_t i = 0; i < m_intermediateAirfoils.size(); i++) {
+            m_intermediateAirfoilsClean.push_back(m_intermediateAirfoils[i].get());
+            m_intermediateAirfoils[i]->ClearDirty();
+        }
+    }
+
+    void CPACSControlSurfaceContours::WriteDirtyCPACS(const TixiDocumentHandle& tixiHandle, const std::string& xpath) const
+    {
+        if (m_dirty) {
+            WriteCPACS(tixiHandle, xpath);
+            return;
+        }
+
+        // write modified elements intermediateAirfoil
+        tixi::TixiSaveDirtyElements(tixiHandle, xpath + "/intermediateAirfoil", m_intermediateAirfoils, m_intermediateAirfoilsClean);
+    }
+
     const std::vector<unique_ptr<CPACSControlSurfaceAirfoil> >& CPACSControlSurfaceContours::GetIntermediateAirfoils() const
     {
         return m_intermediateAirfoils;
@@ -67,6 +105,7 @@ namespace generated
 
     void CPACSControlSurfaceContours::RemoveIntermediateAirfoil(CPACSControlSurfaceAirfoil& ref)
     {
+        m_dirty = true;
         for (std::size_t i = 0; i < m_intermediateAirfoils.size(); i++) {
             if (m_intermediateAirfoils[i].get() == &ref) {
                 m_intermediateAirfoils.erase(m_intermediateAirfoils.begin() + i);
@@ -47,6 +47,10 @@ namespace generated
         TIGL_EXPORT virtual void ReadCPACS(const TixiDocumentHandle& tixiHandle, const std::string& xpath);
         TIGL_EXPORT virtual void WriteCPACS(const TixiDocumentHandle& tixiHandle, const std::string& xpath) const;
 
+        TIGL_EXPORT virtual bool IsDirty() const;
+        TIGL_EXPORT virtual void ClearDirty();
+        TIGL_EXPORT virtual void WriteDirtyCPACS(const TixiDocumentHandle& tixiHandle, const std::string& xpath) const;
+
         TIGL_EXPORT virtual const std::vector<unique_ptr<CPACSControlSurfaceAirfoil> >& GetIntermediateAirfoils() const;
         TIGL_EXPORT virtual std::vector<unique_ptr<CPACSControlSurfaceAirfoil> >& GetIntermediateAirfoils();
 
@@ -56,6 +60,12 @@ namespace generated
     protected:
         std::vector<unique_ptr<CPACSControlSurfaceAirfoil> > m_intermediateAirfoils;
 
+        /// Set by the setters, cleared after the object has been read or written
+        bool m_dirty;
+
+        /// List elements at the last call of ClearDirty
+        std::vector<const CPACSControlSurfaceAirfoil*> m_intermediateAirfoilsClean;
+
     private:
 #ifdef HAVE_CPP11
         CPACSControlSurfaceContours(const CPACSControlSurfaceContours&) = delete;
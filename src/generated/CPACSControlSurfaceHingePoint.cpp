@@ -29,6 +29,7 @@ namespace generated
     CPACSControlSurfaceHingePoint::CPACSControlSurfaceHingePoint(CPACSControlSurfacePath* parent)
         : m_hingeXsi(0)
         , m_hingeRelHeight(0)
+        , m_dirty(true)
     {
         //assert(parent != NULL);
         m_parent = parent;
@@ -51,18 +52,12 @@ namespace generated
     void CPACSControlSurfaceHingePoint::ReadCPACS(const TixiDocumentHandle& tixiHandle, const std::string& xpath)
     {
         // read element hingeXsi
-        if (tixi::TixiCheckElement(tixiHandle, xpath + "/hingeXsi")) {
-            m_hingeXsi = tixi::TixiGetElement<double>(tixiHandle, xpath + "/hingeXsi");
-        }
-        else {
+        if (!tixi::TixiTryGetElement(tixiHandle, xpath + "/hingeXsi", m_hingeXsi)) {
             LOG(ERROR) << "Required element hingeXsi is missing at xpath " << xpath;
         }
 
         // read element hingeRelHeight
-        if (tixi::TixiCheckElement(tixiHandle, xpath + "/hingeRelHeight")) {
-            m_hingeRelHeight = tixi::TixiGetElement<double>(tixiHandle, xpath + "/hingeRelHeight");
-        }
-        else {
+        if (!tixi::TixiTryGetElement(tixiHandle, xpath + "/hingeRelHeight", m_hingeRelHeight)) {
             LOG(ERROR) << "Required element hingeRelHeight is missing at xpath " << xpath;
         }
 
@@ -80,6 +75,23 @@ namespace generated
 
     }
 
+    bool CPACSControlSurfaceHingePoint::IsDirty() const
+    {
+        return m_dirty;
+    }
+
+    void CPACSControlSurfaceHingePoint::ClearDirty()
+    {
+        m_dirty = false;
+    }
+
+    void CPACSControlSurfaceHingePoint::WriteDirtyCPACS(const TixiDocumentHandle& tixiHandle, const std::string& xpath) const
+    {
+        if (m_dirty) {
+            WriteCPACS(tixiHandle, xpath);
+        }
+    }
+
     const double& CPACSControlSurfaceHingePoint::GetHingeXsi() const
     {
         return m_hingeXsi;
@@ -87,6 +99,7 @@ namespace generated
 
     void CPACSControlSurfaceHingePoint::SetHingeXsi(const double& value)
     {
+        m_dirty = true;
         m_hingeXsi = value;
     }
 
@@ -97,6 +110,7 @@ namespace generated
 
     void CPACSControlSurfaceHingePoint::SetHingeRelHeight(const double& value)
     {
+        m_dirty = true;
         m_hingeRelHeight = value;
     }
 
@@ -57,6 +57,10 @@ namespace generated
         TIGL_EXPORT virtual void ReadCPACS(const TixiDocumentHandle& tixiHandle, const std::string& xpath);
         TIGL_EXPORT virtual void WriteCPACS(const TixiDocumentHandle& tixiHandle, const std::string& xpath) const;
 
+        TIGL_EXPORT virtual bool IsDirty() const;
+        TIGL_EXPORT virtual void ClearDirty();
+        TIGL_EXPORT virtual void WriteDirtyCPACS(const TixiDocumentHandle& tixiHandle, const std::string& xpath) const;
+
         TIGL_EXPORT virtual const double& GetHingeXsi() const;
         TIGL_EXPORT virtual void SetHingeXsi(const double& value);
 
@@ -74,6 +78,9 @@ namespace generated
         /// Reference is the parent airfoil height.
         double m_hingeRelHeight;
 
+        /// Set by the setters, cleared after the object has been read or written
+        bool m_dirty;
+
     private:
 #ifdef HAVE_CPP11
         CPACSControlSurfaceHingePoint(const CPACSControlSurfaceHingePoint&) = delete;
@@ -29,6 +29,7 @@ namespace generated
     CPACSControlSurfaceOuterShapeTrailingEdge::CPACSControlSurfaceOuterShapeTrailingEdge(CCPACSTrailingEdgeDevice* parent)
         : m_innerBorder(this)
         , m_outerBorder(this)
+        , m_dirty(true)
     {
         //assert(parent != NULL);
         m_parent = parent;
@@ -102,6 +103,59 @@ namespace generated
 
     }
 
+    bool CPACSControlSurfaceOuterShapeTrailingEdge::IsDirty() const
+    {
+        if (m_dirty) {
+            return true;
+        }
+        if (m_innerBorder.IsDirty()) {
+            return true;
+        }
+        if (m_outerBorder.IsDirty()) {
+            return true;
+        }
+        if (m_intermediateAirfoils && m_intermediateAirfoils->IsDirty()) {
+            return true;
+        }
+        return false;
+    }
+
+    void CPACSControlSurfaceOuterShapeTrailingEdge::ClearDirty()
+    {
+        m_dirty = false;
+        m_innerBorder.ClearDirty();
+        m_outerBorder.ClearDirty();
+        if (m_intermediateAirfoils) {
+            m_intermediateAirfoils->ClearDirty();
+        }
+    }
+
+    void CPACSControlSurfaceOuterShapeTrailingEdge::WriteDirtyCPACS(const TixiDocumentHandle& tixiHandle, const std::string& xpath) const
+    {
+        if (m_dirty) {
+            WriteCPACS(tixiHandle, xpath);
+            return;
+        }
+
+        // write modified element innerBorder
+        if (m_innerBorder.IsDirty()) {
+            tixi::TixiCreateElementIfNotExists(tixiHandle, xpath + "/innerBorder");
+            m_innerBorder.WriteDirtyCPACS(tixiHandle, xpath + "/innerBorder");
+        }
+
+        // write modified element outerBorder
+        if (m_outerBorder.IsDirty()) {
+            tixi::TixiCreateElementIfNotExists(tixiHandle, xpath + "/outerBorder");
+            m_outerBorder.WriteDirtyCPACS(tixiHandle, xpath + "/outerBorder");
+        }
+
+        // write modified element intermediateAirfoils
+        if (m_intermediateAirfoils && m_intermediateAirfoils->IsDirty()) {
+            tixi::TixiCreateElementIfNotExists(tixiHandle, xpath + "/intermediateAirfoils");
+            m_intermediateAirfoils->WriteDirtyCPACS(tixiHandle, xpath + "/intermediateAirfoils");
+        }
+    }
+
     const CCPACSControlSurfaceBorderTrailingEdge& CPACSControlSurfaceOuterShapeTrailingEdge::GetInnerBorder() const
     {
         return m_innerBorder;
@@ -141,6 +195,7 @@ namespace generated
 
     void CPACSControlSurfaceOuterShapeTrailingEdge::RemoveIntermediateAirfoils()
     {
+        m_dirty = true;
         m_intermediateAirfoils = boost::none;
     }
 
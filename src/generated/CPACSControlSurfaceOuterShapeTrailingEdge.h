@@ -63,6 +63,10 @@ namespace generated
         TIGL_EXPORT virtual void ReadCPACS(const TixiDocumentHandle& tixiHandle, const std::string& xpath);
         TIGL_EXPORT virtual void WriteCPACS(const TixiDocumentHandle& tixiHandle, const std::string& xpath) const;
 
+        TIGL_EXPORT virtual bool IsDirty() const;
+        TIGL_EXPORT virtual void ClearDirty();
+        TIGL_EXPORT virtual void WriteDirtyCPACS(const TixiDocumentHandle& tixiHandle, const std::string& xpath) const;
+
         TIGL_EXPORT virtual const CCPACSControlSurfaceBorderTrailingEdge& GetInnerBorder() const;
         TIGL_EXPORT virtual CCPACSControlSurfaceBorderTrailingEdge& GetInnerBorder();
 
@@ -82,6 +86,9 @@ namespace generated
         CCPACSControlSurfaceBorderTrailingEdge       m_outerBorder;
         boost::optional<CPACSControlSurfaceContours> m_intermediateAirfoils;
 
+        /// Set by the setters, cleared after the object has been read or written
+        bool m_dirty;
+
     private:
 #ifdef HAVE_CPP11
         CPACSControlSurfaceOuterShapeTrailingEdge(const CPACSControlSurfaceOuterShapeTrailingEdge&) = delete;
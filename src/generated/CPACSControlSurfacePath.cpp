@@ -32,6 +32,7 @@ namespace generated
         , m_innerHingePoint(this)
         , m_outerHingePoint(this)
         , m_steps(this, m_uidMgr)
+        , m_dirty(true)
     {
         //assert(parent != NULL);
         m_parent = parent;
@@ -105,6 +106,57 @@ namespace generated
 
     }
 
+    bool CPACSControlSurfacePath::IsDirty() const
+    {
+        if (m_dirty) {
+            return true;
+        }
+        if (m_innerHingePoint.IsDirty()) {
+            return true;
+        }
+        if (m_outerHingePoint.IsDirty()) {
+            return true;
+        }
+        if (m_steps.IsDirty()) {
+            return true;
+        }
+        return false;
+    }
+
+    void CPACSControlSurfacePath::ClearDirty()
+    {
+        m_dirty = false;
+        m_innerHingePoint.ClearDirty();
+        m_outerHingePoint.ClearDirty();
+        m_steps.ClearDirty();
+    }
+
+    void CPACSControlSurfacePath::WriteDirtyCPACS(const TixiDocumentHandle& tixiHandle, const std::string& xpath) const
+    {
+        if (m_dirty) {
+            WriteCPACS(tixiHandle, xpath);
+            return;
+        }
+
+        // write modified element innerHingePoint
+        if (m_innerHingePoint.IsDirty()) {
+            tixi::TixiCreateElementIfNotExists(tixiHandle, xpath + "/innerHingePoint");
+            m_innerHingePoint.WriteDirtyCPACS(tixiHandle, xpath + "/innerHingePoint");
+        }
+
+        // write modified element outerHingePoint
+        if (m_outerHingePoint.IsDirty()) {
+            tixi::TixiCreateElementIfNotExists(tixiHandle, xpath + "/outerHingePoint");
+            m_outerHingePoint.WriteDirtyCPACS(tixiHandle, xpath + "/outerHingePoint");
+        }
+
+        // write modified element steps
+        if (m_steps.IsDirty()) {
+            tixi::TixiCreateElementIfNotExists(tixiHandle, xpath + "/steps");
+            m_steps.WriteDirtyCPACS(tixiHandle, xpath + "/steps");
+        }
+    }
+
     const CCPACSControlSurfaceHingePoint& CPACSControlSurfacePath::GetInnerHingePoint() const
     {
         return m_innerHingePoint;
@@ -80,6 +80,10 @@ namespace generated
         TIGL_EXPORT virtual void ReadCPACS(const TixiDocumentHandle& tixiHandle, const std::string& xpath);
         TIGL_EXPORT virtual void WriteCPACS(const TixiDocumentHandle& tixiHandle, const std::string& xpath) const;
 
+        TIGL_EXPORT virtual bool IsDirty() const;
+        TIGL_EXPORT virtual void ClearDirty();
+        TIGL_EXPORT virtual void WriteDirtyCPACS(const TixiDocumentHandle& tixiHandle, const std::string& xpath) const;
+
         TIGL_EXPORT virtual const CCPACSControlSurfaceHingePoint& GetInnerHingePoint() const;
         TIGL_EXPORT virtual CCPACSControlSurfaceHingePoint& GetInnerHingePoint();
 
@@ -98,6 +102,9 @@ namespace generated
         CCPACSControlSurfaceHingePoint m_outerHingePoint;
         CCPACSControlSurfaceSteps      m_steps;
 
+        /// Set by the setters, cleared after the object has been read or written
+        bool m_dirty;
+
     private:
 #ifdef HAVE_CPP11
         CPACSControlSurfacePath(const CPACSControlSurfacePath&) = delete;
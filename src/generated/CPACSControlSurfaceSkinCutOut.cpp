@@ -27,6 +27,7 @@ namespace tigl
 namespace generated
 {
     CPACSControlSurfaceSkinCutOut::CPACSControlSurfaceSkinCutOut(CPACSControlSurfaceWingCutOut* parent)
+        : m_dirty(true)
     {
         //assert(parent != NULL);
         m_parent = parent;
@@ -49,22 +50,17 @@ namespace generated
     void CPACSControlSurfaceSkinCutOut::ReadCPACS(const TixiDocumentHandle& tixiHandle, const std::string& xpath)
     {
         // read element sparUID
-        if (tixi::TixiCheckElement(tixiHandle, xpath + "/sparUID")) {
-            m_sparUID_choice1 = tixi::TixiGetElement<std::string>(tixiHandle, xpath + "/sparUID");
+        if (tixi::TixiTryGetElement(tixiHandle, xpath + "/sparUID", m_sparUID_choice1)) {
             if (m_sparUID_choice1->empty()) {
                 LOG(WARNING) << "Optional element sparUID is present but empty at xpath " << xpath;
             }
         }
 
         // read element xsiInnerBorder
-        if (tixi::TixiCheckElement(tixiHandle, xpath + "/xsiInnerBorder")) {
-            m_xsiInnerBorder_choice2 = tixi::TixiGetElement<double>(tixiHandle, xpath + "/xsiInnerBorder");
-        }
+        tixi::TixiTryGetElement(tixiHandle, xpath + "/xsiInnerBorder", m_xsiInnerBorder_choice2);
 
         // read element xsiOuterBorder
-        if (tixi::TixiCheckElement(tixiHandle, xpath + "/xsiOuterBorder")) {
-            m_xsiOuterBorder_choice2 = tixi::TixiGetElement<double>(tixiHandle, xpath + "/xsiOuterBorder");
-        }
+        tixi::TixiTryGetElement(tixiHandle, xpath + "/xsiOuterBorder", m_xsiOuterBorder_choice2);
 
         if (!ValidateChoices()) {
             LOG(ERROR) << "Invalid choice configuration at xpath " << xpath;
@@ -108,6 +104,23 @@ namespace generated
 
     }
 
+    bool CPACSControlSurfaceSkinCutOut::IsDirty() const
+    {
+        return m_dirty;
+    }
+
+    void CPACSControlSurfaceSkinCutOut::ClearDirty()
+    {
+        m_dirty = false;
+    }
+
+    void CPACSControlSurfaceSkinCutOut::WriteDirtyCPACS(const TixiDocumentHandle& tixiHandle, const std::string& xpath) const
+    {
+        if (m_dirty) {
+            WriteCPACS(tixiHandle, xpath);
+        }
+    }
+
     bool CPACSControlSurfaceSkinCutOut::ValidateChoices() const
     {
         return
@@ -149,6 +162,7 @@ namespace generated
 
     void CPACSControlSurfaceSkinCutOut::SetSparUID_choice1(const boost::optional<std::string>& value)
     {
+        m_dirty = true;
         m_sparUID_choice1 = value;
     }
 
@@ -159,6 +173,7 @@ namespace generated
 
     void CPACSControlSurfaceSkinCutOut::SetXsiInnerBorder_choice2(const boost::optional<double>& value)
     {
+        m_dirty = true;
         m_xsiInnerBorder_choice2 = value;
     }
 
@@ -169,6 +184,7 @@ namespace generated
 
     void CPACSControlSurfaceSkinCutOut::SetXsiOuterBorder_choice2(const boost::optional<double>& value)
     {
+        m_dirty = true;
         m_xsiOuterBorder_choice2 = value;
     }
 
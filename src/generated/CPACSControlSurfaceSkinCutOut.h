@@ -60,6 +60,10 @@ namespace generated
         TIGL_EXPORT virtual void ReadCPACS(const TixiDocumentHandle& tixiHandle, const std::string& xpath);
         TIGL_EXPORT virtual void WriteCPACS(const TixiDocumentHandle& tixiHandle, const std::string& xpath) const;
 
+        TIGL_EXPORT virtual bool IsDirty() const;
+        TIGL_EXPORT virtual void ClearDirty();
+        TIGL_EXPORT virtual void WriteDirtyCPACS(const TixiDocumentHandle& tixiHandle, const std::string& xpath) const;
+
         TIGL_EXPORT bool ValidateChoices() const;
 
         TIGL_EXPORT virtual const boost::optional<std::string>& GetSparUID_choice1() const;
@@ -86,6 +90,9 @@ namespace generated
         /// out begins.
         boost::optional<double>      m_xsiOuterBorder_choice2;
 
+        /// Set by the setters, cleared after the object has been read or written
+        bool m_dirty;
+
     private:
 #ifdef HAVE_CPP11
         CPACSControlSurfaceSkinCutOut(const CPACSControlSurfaceSkinCutOut&) = delete;
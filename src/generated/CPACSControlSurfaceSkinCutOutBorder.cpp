@@ -27,6 +27,7 @@ namespace tigl
 namespace generated
 {
     CPACSControlSurfaceSkinCutOutBorder::CPACSControlSurfaceSkinCutOutBorder(CPACSControlSurfaceWingCutOut* parent)
+        : m_dirty(true)
     {
         //assert(parent != NULL);
         m_parent = parent;
@@ -49,17 +50,14 @@ namespace generated
     void CPACSControlSurfaceSkinCutOutBorder::ReadCPACS(const TixiDocumentHandle& tixiHandle, const std::string& xpath)
     {
         // read element ribDefinitionUID
-        if (tixi::TixiCheckElement(tixiHandle, xpath + "/ribDefinitionUID")) {
-            m_ribDefinitionUID_choice1 = tixi::TixiGetElement<std::string>(tixiHandle, xpath + "/ribDefinitionUID");
+        if (tixi::TixiTryGetElement(tixiHandle, xpath + "/ribDefinitionUID", m_ribDefinitionUID_choice1)) {
             if (m_ribDefinitionUID_choice1->empty()) {
                 LOG(WARNING) << "Optional element ribDefinitionUID is present but empty at xpath " << xpath;
             }
         }
 
         // read element ribNumber
-        if (tixi::TixiCheckElement(tixiHandle, xpath + "/ribNumber")) {
-            m_ribNumber_choice1 = tixi::TixiGetElement<int>(tixiHandle, xpath + "/ribNumber");
-        }
+        tixi::TixiTryGetElement(tixiHandle, xpath + "/ribNumber", m_ribNumber_choice1);
 
         // read element etaLE
         if (tixi::TixiCheckElement(tixiHandle, xpath + "/etaLE")) {
@@ -136,6 +134,51 @@ namespace generated
 
     }
 
+    bool CPACSControlSurfaceSkinCutOutBorder::IsDirty() const
+    {
+        if (m_dirty) {
+            return true;
+        }
+        if (m_etaLE_choice2 && m_etaLE_choice2->IsDirty()) {
+            return true;
+        }
+        if (m_etaTE_choice2 && m_etaTE_choice2->IsDirty()) {
+            return true;
+        }
+        return false;
+    }
+
+    void CPACSControlSurfaceSkinCutOutBorder::ClearDirty()
+    {
+        m_dirty = false;
+        if (m_etaLE_choice2) {
+            m_etaLE_choice2->ClearDirty();
+        }
+        if (m_etaTE_choice2) {
+            m_etaTE_choice2->ClearDirty();
+        }
+    }
+
+    void CPACSControlSurfaceSkinCutOutBorder::WriteDirtyCPACS(const TixiDocumentHandle& tixiHandle, const std::string& xpath) const
+    {
+        if (m_dirty) {
+            WriteCPACS(tixiHandle, xpath);
+            return;
+        }
+
+        // write modified element etaLE
+        if (m_etaLE_choice2 && m_etaLE_choice2->IsDirty()) {
+            tixi::TixiCreateElementIfNotExists(tixiHandle, xpath + "/etaLE");
+            m_etaLE_choice2->WriteDirtyCPACS(tixiHandle, xpath + "/etaLE");
+        }
+
+        // write modified element etaTE
+        if (m_etaTE_choice2 && m_etaTE_choice2->IsDirty()) {
+            tixi::TixiCreateElementIfNotExists(tixiHandle, xpath + "/etaTE");
+            m_etaTE_choice2->WriteDirtyCPACS(tixiHandle, xpath + "/etaTE");
+        }
+    }
+
     bool CPACSControlSurfaceSkinCutOutBorder::ValidateChoices() const
     {
         return
@@ -181,6 +224,7 @@ namespace generated
 
     void CPACSControlSurfaceSkinCutOutBorder::SetRibDefinitionUID_choice1(const boost::optional<std::string>& value)
     {
+        m_dirty = true;
         m_ribDefinitionUID_choice1 = value;
     }
 
@@ -191,6 +235,7 @@ namespace generated
 
     void CPACSControlSurfaceSkinCutOutBorder::SetRibNumber_choice1(const boost::optional<int>& value)
     {
+        m_dirty = true;
         m_ribNumber_choice1 = value;
     }
 
@@ -223,6 +268,7 @@ namespace generated
 
     void CPACSControlSurfaceSkinCutOutBorder::RemoveEtaLE_choice2()
     {
+        m_dirty = true;
         m_etaLE_choice2 = boost::none;
     }
 
@@ -235,6 +281,7 @@ namespace generated
 
     void CPACSControlSurfaceSkinCutOutBorder::RemoveEtaTE_choice2()
     {
+        m_dirty = true;
         m_etaTE_choice2 = boost::none;
     }
 
@@ -30,6 +30,7 @@ namespace generated
     CPACSControlSurfaceStep::CPACSControlSurfaceStep(CCPACSControlSurfaceSteps* parent, CTiglUIDManager* uidMgr)
         : m_uidMgr(uidMgr)
         , m_relDeflection(0)
+        , m_dirty(true)
     {
         //assert(parent != NULL);
         m_parent = parent;
@@ -62,10 +63,7 @@ namespace generated
     void CPACSControlSurfaceStep::ReadCPACS(const TixiDocumentHandle& tixiHandle, const std::string& xpath)
     {
         // read element relDeflection
-        if (tixi::TixiCheckElement(tixiHandle, xpath + "/relDeflection")) {
-            m_relDeflection = tixi::TixiGetElement<double>(tixiHandle, xpath + "/relDeflection");
-        }
-        else {
+        if (!tixi::TixiTryGetElement(tixiHandle, xpath + "/relDeflection", m_relDeflection)) {
             LOG(ERROR) << "Required element relDeflection is missing at xpath " << xpath;
         }
 
@@ -92,9 +90,7 @@ namespace generated
         }
 
         // read element hingeLineRotation
-        if (tixi::TixiCheckElement(tixiHandle, xpath + "/hingeLineRotation")) {
-            m_hingeLineRotation = tixi::TixiGetElement<double>(tixiHandle, xpath + "/hingeLineRotation");
-        }
+        tixi::TixiTryGetElement(tixiHandle, xpath + "/hingeLineRotation", m_hingeLineRotation);
 
     }
 
@@ -139,6 +135,51 @@ namespace generated
 
     }
 
+    bool CPACSControlSurfaceStep::IsDirty() const
+    {
+        if (m_dirty) {
+            return true;
+        }
+        if (m_innerHingeTranslation && m_innerHingeTranslation->IsDirty()) {
+            return true;
+        }
+        if (m_outerHingeTranslation && m_outerHingeTranslation->IsDirty()) {
+            return true;
+        }
+        return false;
+    }
+
+    void CPACSControlSurfaceStep::ClearDirty()
+    {
+        m_dirty = false;
+        if (m_innerHingeTranslation) {
+            m_innerHingeTranslation->ClearDirty();
+        }
+        if (m_outerHingeTranslation) {
+            m_outerHingeTranslation->ClearDirty();
+        }
+    }
+
+    void CPACSControlSurfaceStep::WriteDirtyCPACS(const TixiDocumentHandle& tixiHandle, const std::string& xpath) const
+    {
+        if (m_dirty) {
+            WriteCPACS(tixiHandle, xpath);
+            return;
+        }
+
+        // write modified element innerHingeTranslation
+        if (m_innerHingeTranslation && m_innerHingeTranslation->IsDirty()) {
+            tixi::TixiCreateElementIfNotExists(tixiHandle, xpath + "/innerHingeTranslation");
+            m_innerHingeTranslation->WriteDirtyCPACS(tixiHandle, xpath + "/innerHingeTranslation");
+        }
+
+        // write modified element outerHingeTranslation
+        if (m_outerHingeTranslation && m_outerHingeTranslation->IsDirty()) {
+            tixi::TixiCreateElementIfNotExists(tixiHandle, xpath + "/outerHingeTranslation");
+            m_outerHingeTranslation->WriteDirtyCPACS(tixiHandle, xpath + "/outerHingeTranslation");
+        }
+    }
+
     const double& CPACSControlSurfaceStep::GetRelDeflection() const
     {
         return m_relDeflection;
@@ -146,6 +187,7 @@ namespace generated
 
     void CPACSControlSurfaceStep::SetRelDeflection(const double& value)
     {
+        m_dirty = true;
         m_relDeflection = value;
     }
 
@@ -176,6 +218,7 @@ namespace generated
 
     void CPACSControlSurfaceStep::SetHingeLineRotation(const boost::optional<double>& value)
     {
+        m_dirty = true;
         m_hingeLineRotation = value;
     }
 
@@ -188,6 +231,7 @@ namespace generated
 
     void CPACSControlSurfaceStep::RemoveInnerHingeTranslation()
     {
+        m_dirty = true;
         m_innerHingeTranslation = boost::none;
     }
 
@@ -200,6 +244,7 @@ namespace generated
 
     void CPACSControlSurfaceStep::RemoveOuterHingeTranslation()
     {
+        m_dirty = true;
         m_outerHingeTranslation = boost::none;
     }
 
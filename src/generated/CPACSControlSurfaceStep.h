@@ -75,6 +75,10 @@ namespace generated
         TIGL_EXPORT virtual void ReadCPACS(const TixiDocumentHandle& tixiHandle, const std::string& xpath);
         TIGL_EXPORT virtual void WriteCPACS(const TixiDocumentHandle& tixiHandle, const std::string& xpath) const;
 
+        TIGL_EXPORT virtual bool IsDirty() const;
+        TIGL_EXPORT virtual void ClearDirty();
+        TIGL_EXPORT virtual void WriteDirtyCPACS(const TixiDocumentHandle& tixiHandle, const std::string& xpath) const;
+
         TIGL_EXPORT virtual const double& GetRelDeflection() const;
         TIGL_EXPORT virtual void SetRelDeflection(const double& value);
 
@@ -121,6 +125,9 @@ namespace generated
         /// heading from the inner to the outer border. Defaults to zero.
         boost::optional<double>       m_hingeLineRotation;
 
+        /// Set by the setters, cleared after the object has been read or written
+        bool m_dirty;
+
     private:
 #ifdef HAVE_CPP11
         CPACSControlSurfaceStep(const CPACSControlSurfaceStep&) = delete;
@@ -30,6 +30,7 @@ namespace generated
 {
     CPACSControlSurfaceSteps::CPACSControlSurfaceSteps(CPACSControlSurfacePath* parent, CTiglUIDManager* uidMgr)
         : m_uidMgr(uidMgr)
+        , m_dirty(true)
     {
         //assert(parent != NULL);
         m_parent = parent;
@@ -75,6 +76,43 @@ namespace generated
 
     }
 
+    bool CPACSControlSurfaceSteps::IsDirty() const
+    {
+        if (m_dirty) {
+            return true;
+        }
+        if (m_steps.size() != m_stepsClean.size()) {
+            return true;
+        }
+        for (std::size_t i = 0; i < m_steps.size(); i++) {
+            if (m_steps[i].get() != m_stepsClean[i] || m_steps[i]->IsDirty()) {
+                return true;
+            }
+        }
+        return false;
+    }
+
+    void CPACSControlSurfaceSteps::ClearDirty()
+    {
+        m_dirty = false;
+        m_stepsClean.clear();
+        for (std::size_t i = 0; i < m_steps.size(); i++) {
+            m_stepsClean.push_back(m_steps[i].get());
+            m_steps[i]->ClearDirty();
+        }
+    }
+
+    void CPACSControlSurfaceSteps::WriteDirtyCPACS(const TixiDocumentHandle& tixiHandle, const std::string& xpath) const
+    {
+        if (m_dirty) {
+            WriteCPACS(tixiHandle, xpath);
+            return;
+        }
+
+        // write modified elements step
+        tixi::TixiSaveDirtyElements(tixiHandle, xpath + "/step", m_steps, m_stepsClean);
+    }
+
     const std::vector<unique_ptr<CCPACSControlSurfaceStep> >& CPACSControlSurfaceSteps::GetSteps() const
     {
         return m_steps;
@@ -93,6 +131,7 @@ namespace generated
 
     void CPACSControlSurfaceSteps::RemoveStep(CCPACSControlSurfaceStep& ref)
     {
+        m_dirty = true;
         for (std::size_t i = 0; i < m_steps.size(); i++) {
             if (m_steps[i].get() == &ref) {
                 m_steps.erase(m_steps.begin() + i);
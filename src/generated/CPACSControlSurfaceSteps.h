@@ -58,6 +58,10 @@ namespace generated
         TIGL_EXPORT virtual void ReadCPACS(const TixiDocumentHandle& tixiHandle, const std::string& xpath);
         TIGL_EXPORT virtual void WriteCPACS(const TixiDocumentHandle& tixiHandle, const std::string& xpath) const;
 
+        TIGL_EXPORT virtual bool IsDirty() const;
+        TIGL_EXPORT virtual void ClearDirty();
+        TIGL_EXPORT virtual void WriteDirtyCPACS(const TixiDocumentHandle& tixiHandle, const std::string& xpath) const;
+
         TIGL_EXPORT virtual const std::vector<unique_ptr<CCPACSControlSurfaceStep> >& GetSteps() const;
         TIGL_EXPORT virtual std::vector<unique_ptr<CCPACSControlSurfaceStep> >& GetSteps();
 
@@ -71,6 +75,12 @@ namespace generated
 
         std::vector<unique_ptr<CCPACSControlSurfaceStep> > m_steps;
 
+        /// Set by the setters, cleared after the object has been read or written
+        bool m_dirty;
+
+        /// List elements at the last call of ClearDirty
+        std::vector<const CCPACSControlSurfaceStep*> m_stepsClean;
+
     private:
 #ifdef HAVE_CPP11
         CPACSControlSurfaceSteps(const CPACSControlSurfaceSteps&) = delete;
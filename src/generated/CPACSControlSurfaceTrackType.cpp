@@ -29,6 +29,7 @@ namespace generated
 {
     CPACSControlSurfaceTrackType::CPACSControlSurfaceTrackType(CPACSControlSurfaceTracks* parent, CTiglUIDManager* uidMgr)
         : m_uidMgr(uidMgr)
+        , m_dirty(true)
     {
         //assert(parent != NULL);
         m_parent = parent;
@@ -62,8 +63,7 @@ namespace generated
     void CPACSControlSurfaceTrackType::ReadCPACS(const TixiDocumentHandle& tixiHandle, const std::string& xpath)
     {
         // read attribute uID
-        if (tixi::TixiCheckAttribute(tixiHandle, xpath, "uID")) {
-            m_uID = tixi::TixiGetAttribute<std::string>(tixiHandle, xpath, "uID");
+        if (tixi::TixiTryGetAttribute(tixiHandle, xpath, "uID", m_uID)) {
             if (m_uID.empty()) {
                 LOG(WARNING) << "Required attribute uID is empty at xpath " << xpath;
             }
@@ -166,6 +166,61 @@ namespace generated
 
     }
 
+    bool CPACSControlSurfaceTrackType::IsDirty() const
+    {
+        if (m_dirty) {
+            return true;
+        }
+        if (m_eta.IsDirty()) {
+            return true;
+        }
+        if (m_actuator && m_actuator->IsDirty()) {
+            return true;
+        }
+        if (m_trackStructure && m_trackStructure->IsDirty()) {
+            return true;
+        }
+        return false;
+    }
+
+    void CPACSControlSurfaceTrackType::ClearDirty()
+    {
+        m_dirty = false;
+        m_eta.ClearDirty();
+        if (m_actuator) {
+            m_actuator->ClearDirty();
+        }
+        if (m_trackStructure) {
+            m_trackStructure->ClearDirty();
+        }
+    }
+
+    void CPACSControlSurfaceTrackType::WriteDirtyCPACS(const TixiDocumentHandle& tixiHandle, const std::string& xpath) const
+    {
+        if (m_dirty) {
+            WriteCPACS(tixiHandle, xpath);
+            return;
+        }
+
+        // write modified element eta
+        if (m_eta.IsDirty()) {
+            tixi::TixiCreateElementIfNotExists(tixiHandle, xpath + "/eta");
+            m_eta.WriteDirtyCPACS(tixiHandle, xpath + "/eta");
+        }
+
+        // write modified element actuator
+        if (m_actuator && m_actuator->IsDirty()) {
+            tixi::TixiCreateElementIfNotExists(tixiHandle, xpath + "/actuator");
+            m_actuator->WriteDirtyCPACS(tixiHandle, xpath + "/actuator");
+        }
+
+        // write modified element trackStructure
+        if (m_trackStructure && m_trackStructure->IsDirty()) {
+            tixi::TixiCreateElementIfNotExists(tixiHandle, xpath + "/trackStructure");
+            m_trackStructure->WriteDirtyCPACS(tixiHandle, xpath + "/trackStructure");
+        }
+    }
+
     const std::string& CPACSControlSurfaceTrackType::GetUID() const
     {
         return m_uID;
@@ -173,6 +228,7 @@ namespace generated
 
     void CPACSControlSurfaceTrackType::SetUID(const std::string& value)
     {
+        m_dirty = true;
         if (m_uidMgr) {
             m_uidMgr->TryUnregisterObject(m_uID);
             m_uidMgr->RegisterObject(value, *this);
@@ -197,6 +253,7 @@ namespace generated
 
     void CPACSControlSurfaceTrackType::SetTrackType(const CPACSControlSurfaceTrackType_trackType& value)
     {
+        m_dirty = true;
         m_trackType = value;
     }
 
@@ -207,6 +264,7 @@ namespace generated
 
     void CPACSControlSurfaceTrackType::SetTrackSubType(const boost::optional<CPACSControlSurfaceTrackType_trackSubType>& value)
     {
+        m_dirty = true;
         m_trackSubType = value;
     }
 
@@ -239,6 +297,7 @@ namespace generated
 
     void CPACSControlSurfaceTrackType::RemoveActuator()
     {
+        m_dirty = true;
         m_actuator = boost::none;
     }
 
@@ -251,6 +310,7 @@ namespace generated
 
     void CPACSControlSurfaceTrackType::RemoveTrackStructure()
     {
+        m_dirty = true;
         m_trackStructure = boost::none;
     }
 
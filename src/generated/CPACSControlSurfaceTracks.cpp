@@ -30,6 +30,7 @@ namespace generated
 {
     CPACSControlSurfaceTracks::CPACSControlSurfaceTracks(CCPACSTrailingEdgeDevice* parent, CTiglUIDManager* uidMgr)
         : m_uidMgr(uidMgr)
+        , m_dirty(true)
     {
         //assert(parent != NULL);
         m_parent = parent;
@@ -75,6 +76,43 @@ namespace generated
 
     }
 
+    bool CPACSControlSurfaceTracks::IsDirty() const
+    {
+        if (m_dirty) {
+            return true;
+        }
+        if (m_tracks.size() != m_tracksClean.size()) {
+            return true;
+        }
+        for (std::size_t i = 0; i < m_tracks.size(); i++) {
+            if (m_tracks[i].get() != m_tracksClean[i] || m_tracks[i]->IsDirty()) {
+                return true;
+            }
+        }
+        return false;
+    }
+
+    void CPACSControlSurfaceTracks::ClearDirty()
+    {
+        m_dirty = false;
+        m_tracksClean.clear();
+        for (std::size_t i = 0; i < m_tracks.size(); i++) {
+            m_tracksClean.push_back(m_tracks[i].get());
+            m_tracks[i]->ClearDirty();
+        }
+    }
+
+    void CPACSControlSurfaceTracks::WriteDirtyCPACS(const TixiDocumentHandle& tixiHandle, const std::string& xpath) const
+    {
+        if (m_dirty) {
+            WriteCPACS(tixiHandle, xpath);
+            return;
+        }
+
+        // write modified elements track
+        tixi::TixiSaveDirtyElements(tixiHandle, xpath + "/track", m_tracks, m_tracksClean);
+    }
+
     const std::vector<unique_ptr<CCPACSControlSurfaceTrackType> >& CPACSControlSurfaceTracks::GetTracks() const
     {
         return m_tracks;
@@ -93,6 +131,7 @@ namespace generated
 
     void CPACSControlSurfaceTracks::RemoveTrack(CCPACSControlSurfaceTrackType& ref)
     {
+        m_dirty = true;
         for (std::size_t i = 0; i < m_tracks.size(); i++) {
             if (m_tracks[i].get() == &ref) {
                 m_tracks.erase(m_tracks.begin() + i);
@@ -29,6 +29,7 @@ namespace generated
     CPACSControlSurfaceWingCutOut::CPACSControlSurfaceWingCutOut(CCPACSTrailingEdgeDevice* parent)
         : m_upperSkin(this)
         , m_lowerSkin(this)
+        , m_dirty(true)
     {
         //assert(parent != NULL);
         m_parent = parent;
@@ -168,6 +169,95 @@ namespace generated
 
     }
 
+    bool CPACSControlSurfaceWingCutOut::IsDirty() const
+    {
+        if (m_dirty) {
+            return true;
+        }
+        if (m_upperSkin.IsDirty()) {
+            return true;
+        }
+        if (m_lowerSkin.IsDirty()) {
+            return true;
+        }
+        if (m_cutOutProfileControlPoint && m_cutOutProfileControlPoint->IsDirty()) {
+            return true;
+        }
+        if (m_cutOutProfiles && m_cutOutProfiles->IsDirty()) {
+            return true;
+        }
+        if (m_innerBorder && m_innerBorder->IsDirty()) {
+            return true;
+        }
+        if (m_outerBorder && m_outerBorder->IsDirty()) {
+            return true;
+        }
+        return false;
+    }
+
+    void CPACSControlSurfaceWingCutOut::ClearDirty()
+    {
+        m_dirty = false;
+        m_upperSkin.ClearDirty();
+        m_lowerSkin.ClearDirty();
+        if (m_cutOutProfileControlPoint) {
+            m_cutOutProfileControlPoint->ClearDirty();
+        }
+        if (m_cutOutProfiles) {
+            m_cutOutProfiles->ClearDirty();
+        }
+        if (m_innerBorder) {
+            m_innerBorder->ClearDirty();
+        }
+        if (m_outerBorder) {
+            m_outerBorder->ClearDirty();
+        }
+    }
+
+    void CPACSControlSurfaceWingCutOut::WriteDirtyCPACS(const TixiDocumentHandle& tixiHandle, const std::string& xpath) const
+    {
+        if (m_dirty) {
+            WriteCPACS(tixiHandle, xpath);
+            return;
+        }
+
+        // write modified element upperSkin
+        if (m_upperSkin.IsDirty()) {
+            tixi::TixiCreateElementIfNotExists(tixiHandle, xpath + "/upperSkin");
+            m_upperSkin.WriteDirtyCPACS(tixiHandle, xpath + "/upperSkin");
+        }
+
+        // write modified element lowerSkin
+        if (m_lowerSkin.IsDirty()) {
+            tixi::TixiCreateElementIfNotExists(tixiHandle, xpath + "/lowerSkin");
+            m_lowerSkin.WriteDirtyCPACS(tixiHandle, xpath + "/lowerSkin");
+        }
+
+        // write modified element cutOutProfileControlPoint
+        if (m_cutOutProfileControlPoint && m_cutOutProfileControlPoint->IsDirty()) {
+            tixi::TixiCreateElementIfNotExists(tixiHandle, xpath + "/cutOutProfileControlPoint");
+            m_cutOutProfileControlPoint->WriteDirtyCPACS(tixiHandle, xpath + "/cutOutProfileControlPoint");
+        }
+
+        // write modified element cutOutProfiles
+        if (m_cutOutProfiles && m_cutOutProfiles->IsDirty()) {
+            tixi::TixiCreateElementIfNotExists(tixiHandle, xpath + "/cutOutProfiles");
+            m_cutOutProfiles->WriteDirtyCPACS(tixiHandle, xpath + "/cutOutProfiles");
+        }
+
+        // write modified element innerBorder
+        if (m_innerBorder && m_innerBorder->IsDirty()) {
+            tixi::TixiCreateElementIfNotExists(tixiHandle, xpath + "/innerBorder");
+            m_innerBorder->WriteDirtyCPACS(tixiHandle, xpath + "/innerBorder");
+        }
+
+        // write modified element outerBorder
+        if (m_outerBorder && m_outerBorder->IsDirty()) {
+            tixi::TixiCreateElementIfNotExists(tixiHandle, xpath + "/outerBorder");
+            m_outerBorder->WriteDirtyCPACS(tixiHandle, xpath + "/outerBorder");
+        }
+    }
+
     const CCPACSControlSurfaceSkinCutout& CPACSControlSurfaceWingCutOut::GetUpperSkin() const
     {
         return m_upperSkin;
@@ -237,6 +327,7 @@ namespace generated
 
     void CPACSControlSurfaceWingCutOut::RemoveCutOutProfileControlPoint()
     {
+        m_dirty = true;
         m_cutOutProfileControlPoint = boost::none;
     }
 
@@ -249,6 +340,7 @@ namespace generated
 
     void CPACSControlSurfaceWingCutOut::RemoveCutOutProfiles()
     {
+        m_dirty = true;
         m_cutOutProfiles = boost::none;
     }
 
@@ -261,6 +353,7 @@ namespace generated
 
     void CPACSControlSurfaceWingCutOut::RemoveInnerBorder()
     {
+        m_dirty = true;
         m_innerBorder = boost::none;
     }
 
@@ -273,6 +366,7 @@ namespace generated
 
     void CPACSControlSurfaceWingCutOut::RemoveOuterBorder()
     {
+        m_dirty = true;
         m_outerBorder = boost::none;
     }
 
@@ -66,6 +66,10 @@ namespace generated
         TIGL_EXPORT virtual void ReadCPACS(const TixiDocumentHandle& tixiHandle, const std::string& xpath);
         TIGL_EXPORT virtual void WriteCPACS(const TixiDocumentHandle& tixiHandle, const std::string& xpath) const;
 
+        TIGL_EXPORT virtual bool IsDirty() const;
+        TIGL_EXPORT virtual void ClearDirty();
+        TIGL_EXPORT virtual void WriteDirtyCPACS(const TixiDocumentHandle& tixiHandle, const std::string& xpath) const;
+
         TIGL_EXPORT virtual const CCPACSControlSurfaceSkinCutout& GetUpperSkin() const;
         TIGL_EXPORT virtual CCPACSControlSurfaceSkinCutout& GetUpperSkin();
 
@@ -106,6 +110,9 @@ namespace generated
         boost::optional<CCPACSControlSurfaceSkinCutOutBorder> m_innerBorder;
         boost::optional<CCPACSControlSurfaceSkinCutOutBorder> m_outerBorder;
 
+        /// Set by the setters, cleared after the object has been read or written
+        bool m_dirty;
+
     private:
 #ifdef HAVE_CPP11
         CPACSControlSurfaceWingCutOut(const CPACSControlSurfaceWingCutOut&) = delete;
@@ -29,6 +29,7 @@ namespace generated
 {
     CPACSControlSurfaces::CPACSControlSurfaces(CCPACSWingComponentSegment* parent, CTiglUIDManager* uidMgr)
         : m_uidMgr(uidMgr)
+        , m_dirty(true)
     {
         //assert(parent != NULL);
         m_parent = parent;
@@ -88,6 +89,39 @@ namespace generated
 
     }
 
+    bool CPACSControlSurfaces::IsDirty() const
+    {
+        if (m_dirty) {
+            return true;
+        }
+        if (m_trailingEdgeDevices && m_trailingEdgeDevices->IsDirty()) {
+            return true;
+        }
+        return false;
+    }
+
+    void CPACSControlSurfaces::ClearDirty()
+    {
+        m_dirty = false;
+        if (m_trailingEdgeDevices) {
+            m_trailingEdgeDevices->ClearDirty();
+        }
+    }
+
+    void CPACSControlSurfaces::WriteDirtyCPACS(const TixiDocumentHandle& tixiHandle, const std::string& xpath) const
+    {
+        if (m_dirty) {
+            WriteCPACS(tixiHandle, xpath);
+            return;
+        }
+
+        // write modified element trailingEdgeDevices
+        if (m_trailingEdgeDevices && m_trailingEdgeDevices->IsDirty()) {
+            tixi::TixiCreateElementIfNotExists(tixiHandle, xpath + "/trailingEdgeDevices");
+            m_trailingEdgeDevices->WriteDirtyCPACS(tixiHandle, xpath + "/trailingEdgeDevices");
+        }
+    }
+
     const boost::optional<CCPACSTrailingEdgeDevices>& CPACSControlSurfaces::GetTrailingEdgeDevices() const
     {
         return m_trailingEdgeDevices;
@@ -107,6 +141,7 @@ namespace generated
 
     void CPACSControlSurfaces::RemoveTrailingEdgeDevices()
     {
+        m_dirty = true;
         m_trailingEdgeDevices = boost::none;
     }
 
@@ -59,6 +59,10 @@ namespace generated
         TIGL_EXPORT virtual void ReadCPACS(const TixiDocumentHandle& tixiHandle, const std::string& xpath);
         TIGL_EXPORT virtual void WriteCPACS(const TixiDocumentHandle& tixiHandle, const std::string& xpath) const;
 
+        TIGL_EXPORT virtual bool IsDirty() const;
+        TIGL_EXPORT virtual void ClearDirty();
+        TIGL_EXPORT virtual void WriteDirtyCPACS(const TixiDocumentHandle& tixiHandle, const std::string& xpath) const;
+
         TIGL_EXPORT virtual const boost::optional<CCPACSTrailingEdgeDevices>& GetTrailingEdgeDevices() const;
         TIGL_EXPORT virtual boost::optional<CCPACSTrailingEdgeDevices>& GetTrailingEdgeDevices();
 
@@ -72,6 +76,9 @@ namespace generated
 
         boost::optional<CCPACSTrailingEdgeDevices> m_trailingEdgeDevices;
 
+        /// Set by the setters, cleared after the object has been read or written
+        bool m_dirty;
+
     private:
 #ifdef HAVE_CPP11
         CPACSControlSurfaces(const CPACSControlSurfaces&) = delete;
@@ -27,6 +27,7 @@ namespace generated
 {
     CPACSCpacs::CPACSCpacs(CTiglUIDManager* uidMgr)
         : m_uidMgr(uidMgr)
+        , m_dirty(true)
     {
     }
 
@@ -108,6 +109,61 @@ namespace generated
 
     }
 
+    bool CPACSCpacs::IsDirty() const
+    {
+        if (m_dirty) {
+            return true;
+        }
+        if (m_header.IsDirty()) {
+            return true;
+        }
+        if (m_vehicles && m_vehicles->IsDirty()) {
+            return true;
+        }
+        if (m_toolspecific && m_toolspecific->IsDirty()) {
+            return true;
+        }
+        return false;
+    }
+
+    void CPACSCpacs::ClearDirty()
+    {
+        m_dirty = false;
+        m_header.ClearDirty();
+        if (m_vehicles) {
+            m_vehicles->ClearDirty();
+        }
+        if (m_toolspecific) {
+            m_toolspecific->ClearDirty();
+        }
+    }
+
+    void CPACSCpacs::WriteDirtyCPACS(const TixiDocumentHandle& tixiHandle, const std::string& xpath) const
+    {
+        if (m_dirty) {
+            WriteCPACS(tixiHandle, xpath);
+            return;
+        }
+
+        // write modified element header
+        if (m_header.IsDirty()) {
+            tixi::TixiCreateElementIfNotExists(tixiHandle, xpath + "/header");
+            m_header.WriteDirtyCPACS(tixiHandle, xpath + "/header");
+        }
+
+        // write modified element vehicles
+        if (m_vehicles && m_vehicles->IsDirty()) {
+            tixi::TixiCreateElementIfNotExists(tixiHandle, xpath + "/vehicles");
+            m_vehicles->WriteDirtyCPACS(tixiHandle, xpath + "/vehicles");
+        }
+
+        // write modified element toolspecific
+        if (m_toolspecific && m_toolspecific->IsDirty()) {
+            tixi::TixiCreateElementIfNotExists(tixiHandle, xpath + "/toolspecific");
+            m_toolspecific->WriteDirtyCPACS(tixiHandle, xpath + "/toolspecific");
+        }
+    }
+
     const CPACSHeader& CPACSCpacs::GetHeader() const
     {
         return m_header;
@@ -147,6 +203,7 @@ namespace generated
 
     void CPACSCpacs::RemoveVehicles()
     {
+        m_dirty = true;
         m_vehicles = boost::none;
     }
 
@@ -159,6 +216,7 @@ namespace generated
 
     void CPACSCpacs::RemoveToolspecific()
     {
+        m_dirty = true;
         m_toolspecific = boost::none;
     }
 
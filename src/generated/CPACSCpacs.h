@@ -194,6 +194,10 @@ namespace generated
         TIGL_EXPORT virtual void ReadCPACS(const TixiDocumentHandle& tixiHandle, const std::string& xpath);
         TIGL_EXPORT virtual void WriteCPACS(const TixiDocumentHandle& tixiHandle, const std::string& xpath) const;
 
+        TIGL_EXPORT virtual bool IsDirty() const;
+        TIGL_EXPORT virtual void ClearDirty();
+        TIGL_EXPORT virtual void WriteDirtyCPACS(const TixiDocumentHandle& tixiHandle, const std::string& xpath) const;
+
         TIGL_EXPORT virtual const CPACSHeader& GetHeader() const;
         TIGL_EXPORT virtual CPACSHeader& GetHeader();
 
@@ -216,6 +220,9 @@ namespace generated
         boost::optional<CPACSVehicles>     m_vehicles;
         boost::optional<CPACSToolspecific> m_toolspecific;
 
+        /// Set by the setters, cleared after the object has been read or written
+        bool m_dirty;
+
     private:
 #ifdef HAVE_CPP11
         CPACSCpacs(const CPACSCpacs&) = delete;
@@ -30,6 +30,7 @@ namespace generated
     CPACSCrossBeamAssemblyPosition::CPACSCrossBeamAssemblyPosition(CCPACSCargoCrossBeamsAssembly* parent, CTiglUIDManager* uidMgr)
         : m_uidMgr(uidMgr)
         , m_positionZ(0)
+        , m_dirty(true)
     {
         //assert(parent != NULL);
         m_parent = parent;
@@ -63,8 +64,7 @@ namespace generated
     void CPACSCrossBeamAssemblyPosition::ReadCPACS(const TixiDocumentHandle& tixiHandle, const std::string& xpath)
     {
         // read attribute uID
-        if (tixi::TixiCheckAttribute(tixiHandle, xpath, "uID")) {
-            m_uID = tixi::TixiGetAttribute<std::string>(tixiHandle, xpath, "uID");
+        if (tixi::TixiTryGetAttribute(tixiHandle, xpath, "uID", m_uID)) {
             if (m_uID.empty()) {
                 LOG(WARNING) << "Required attribute uID is empty at xpath " << xpath;
             }
@@ -74,8 +74,7 @@ namespace generated
         }
 
         // read element structuralElementUID
-        if (tixi::TixiCheckElement(tixiHandle, xpath + "/structuralElementUID")) {
-            m_structuralElementUID = tixi::TixiGetElement<std::string>(tixiHandle, xpath + "/structuralElementUID");
+        if (tixi::TixiTryGetElement(tixiHandle, xpath + "/structuralElementUID", m_structuralElementUID)) {
             if (m_structuralElementUID.empty()) {
                 LOG(WARNING) << "Required element structuralElementUID is empty at xpath " << xpath;
             }
@@ -85,8 +84,7 @@ namespace generated
         }
 
         // read element frameUID
-        if (tixi::TixiCheckElement(tixiHandle, xpath + "/frameUID")) {
-            m_frameUID = tixi::TixiGetElement<std::string>(tixiHandle, xpath + "/frameUID");
+        if (tixi::TixiTryGetElement(tixiHandle, xpath + "/frameUID", m_frameUID)) {
             if (m_frameUID.empty()) {
                 LOG(WARNING) << "Required element frameUID is empty at xpath " << xpath;
             }
@@ -96,10 +94,7 @@ namespace generated
         }
 
         // read element positionZ
-        if (tixi::TixiCheckElement(tixiHandle, xpath + "/positionZ")) {
-            m_positionZ = tixi::TixiGetElement<double>(tixiHandle, xpath + "/positionZ");
-        }
-        else {
+        if (!tixi::TixiTryGetElement(tixiHandle, xpath + "/positionZ", m_positionZ)) {
             LOG(ERROR) << "Required element positionZ is missing at xpath " << xpath;
         }
 
@@ -147,6 +142,39 @@ namespace generated
 
     }
 
+    bool CPACSCrossBeamAssemblyPosition::IsDirty() const
+    {
+        if (m_dirty) {
+            return true;
+        }
+        if (m_alignment && m_alignment->IsDirty()) {
+            return true;
+        }
+        return false;
+    }
+
+    void CPACSCrossBeamAssemblyPosition::ClearDirty()
+    {
+        m_dirty = false;
+        if (m_alignment) {
+            m_alignment->ClearDirty();
+        }
+    }
+
+    void CPACSCrossBeamAssemblyPosition::WriteDirtyCPACS(const TixiDocumentHandle& tixiHandle, const std::string& xpath) const
+    {
+        if (m_dirty) {
+            WriteCPACS(tixiHandle, xpath);
+            return;
+        }
+
+        // write modified element alignment
+        if (m_alignment && m_alignment->IsDirty()) {
+            tixi::TixiCreateElementIfNotExists(tixiHandle, xpath + "/alignment");
+            m_alignment->WriteDirtyCPACS(tixiHandle, xpath + "/alignment");
+        }
+    }
+
     const std::string& CPACSCrossBeamAssemblyPosition::GetUID() const
     {
         return m_uID;
@@ -154,6 +182,7 @@ namespace generated
 
     void CPACSCrossBeamAssemblyPosition::SetUID(const std::string& value)
     {
+        m_dirty = true;
         if (m_uidMgr) {
             m_uidMgr->TryUnregisterObject(m_uID);
             m_uidMgr->RegisterObject(value, *this);
@@ -168,6 +197,7 @@ namespace generated
 
     void CPACSCrossBeamAssemblyPosition::SetStructuralElementUID(const std::string& value)
     {
+        m_dirty = true;
         m_structuralElementUID = value;
     }
 
@@ -178,6 +208,7 @@ namespace generated
 
     void CPACSCrossBeamAssemblyPosition::SetFrameUID(const std::string& value)
     {
+        m_dirty = true;
         m_frameUID = value;
     }
 
@@ -188,6 +219,7 @@ namespace generated
 
     void CPACSCrossBeamAssemblyPosition::SetPositionZ(const double& value)
     {
+        m_dirty = true;
         m_positionZ = value;
     }
 
@@ -210,6 +242,7 @@ namespace generated
 
     void CPACSCrossBeamAssemblyPosition::RemoveAlignment()
     {
+        m_dirty = true;
         m_alignment = boost::none;
     }
 
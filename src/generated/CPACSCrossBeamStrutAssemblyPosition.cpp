@@ -30,6 +30,7 @@ namespace generated
     CPACSCrossBeamStrutAssemblyPosition::CPACSCrossBeamStrutAssemblyPosition(CCPACSCargoCrossBeamStrutsAssembly* parent, CTiglUIDManager* uidMgr)
         : m_uidMgr(uidMgr)
         , m_positionYAtCrossBeam(0)
+        , m_dirty(true)
     {
         //assert(parent != NULL);
         m_parent = parent;
@@ -63,8 +64,7 @@ namespace generated
     void CPACSCrossBeamStrutAssemblyPosition::ReadCPACS(const TixiDocumentHandle& tixiHandle, const std::string& xpath)
     {
         // read attribute uID
-        if (tixi::TixiCheckAttribute(tixiHandle, xpath, "uID")) {
-            m_uID = tixi::TixiGetAttribute<std::string>(tixiHandle, xpath, "uID");
+        if (tixi::TixiTryGetAttribute(tixiHandle, xpath, "uID", m_uID)) {
             if (m_uID.empty()) {
                 LOG(WARNING) << "Required attribute uID is empty at xpath " << xpath;
             }
@@ -74,8 +74,7 @@ namespace generated
         }
 
         // read element structuralElementUID
-        if (tixi::TixiCheckElement(tixiHandle, xpath + "/structuralElementUID")) {
-            m_structuralElementUID = tixi::TixiGetElement<std::string>(tixiHandle, xpath + "/structuralElementUID");
+        if (tixi::TixiTryGetElement(tixiHandle, xpath + "/structuralElementUID", m_structuralElementUID)) {
             if (m_structuralElementUID.empty()) {
                 LOG(WARNING) << "Required element structuralElementUID is empty at xpath " << xpath;
             }
@@ -85,8 +84,7 @@ namespace generated
         }
 
         // read element frameUID
-        if (tixi::TixiCheckElement(tixiHandle, xpath + "/frameUID")) {
-            m_frameUID = tixi::TixiGetElement<std::string>(tixiHandle, xpath + "/frameUID");
+        if (tixi::TixiTryGetElement(tixiHandle, xpath + "/frameUID", m_frameUID)) {
             if (m_frameUID.empty()) {
                 LOG(WARNING) << "Required element frameUID is empty at xpath " << xpath;
             }
@@ -96,8 +94,7 @@ namespace generated
         }
 
         // read element crossBeamUID
-        if (tixi::TixiCheckElement(tixiHandle, xpath + "/crossBeamUID")) {
-            m_crossBeamUID = tixi::TixiGetElement<std::string>(tixiHandle, xpath + "/crossBeamUID");
+        if (tixi::TixiTryGetElement(tixiHandle, xpath + "/crossBeamUID", m_crossBeamUID)) {
             if (m_crossBeamUID.empty()) {
                 LOG(WARNING) << "Required element crossBeamUID is empty at xpath " << xpath;
             }
@@ -107,17 +104,12 @@ namespace generated
         }
 
         // read element positionYAtCrossBeam
-        if (tixi::TixiCheckElement(tixiHandle, xpath + "/positionYAtCrossBeam")) {
-            m_positionYAtCrossBeam = tixi::TixiGetElement<double>(tixiHandle, xpath + "/positionYAtCrossBeam");
-        }
-        else {
+        if (!tixi::TixiTryGetElement(tixiHandle, xpath + "/positionYAtCrossBeam", m_positionYAtCrossBeam)) {
             LOG(ERROR) << "Required element positionYAtCrossBeam is missing at xpath " << xpath;
         }
 
         // read element angleX
-        if (tixi::TixiCheckElement(tixiHandle, xpath + "/angleX")) {
-            m_angleX = tixi::TixiGetElement<double>(tixiHandle, xpath + "/angleX");
-        }
+        tixi::TixiTryGetElement(tixiHandle, xpath + "/angleX", m_angleX);
 
         // read element alignment
         if (tixi::TixiCheckElement(tixiHandle, xpath + "/alignment")) {
@@ -178,6 +170,39 @@ namespace generated
 
     }
 
+    bool CPACSCrossBeamStrutAssemblyPosition::IsDirty() const
+    {
+        if (m_dirty) {
+            return true;
+        }
+        if (m_alignment && m_alignment->IsDirty()) {
+            return true;
+        }
+        return false;
+    }
+
+    void CPACSCrossBeamStrutAssemblyPosition::ClearDirty()
+    {
+        m_dirty = false;
+        if (m_alignment) {
+            m_alignment->ClearDirty();
+        }
+    }
+
+    void CPACSCrossBeamStrutAssemblyPosition::WriteDirtyCPACS(const TixiDocumentHandle& tixiHandle, const std::string& xpath) const
+    {
+        if (m_dirty) {
+            WriteCPACS(tixiHandle, xpath);
+            return;
+        }
+
+        // write modified element alignment
+        if (m_alignment && m_alignment->IsDirty()) {
+            tixi::TixiCreateElementIfNotExists(tixiHandle, xpath + "/alignment");
+            m_alignment->WriteDirtyCPACS(tixiHandle, xpath + "/alignment");
+        }
+    }
+
     const std::string& CPACSCrossBeamStrutAssemblyPosition::GetUID() const
     {
         return m_uID;
@@ -185,6 +210,7 @@ namespace generated
 
     void CPACSCrossBeamStrutAssemblyPosition::SetUID(const std::string& value)
     {
+        m_dirty = true;
         if (m_uidMgr) {
             m_uidMgr->TryUnregisterObject(m_uID);
             m_uidMgr->RegisterObject(value, *this);
@@ -199,6 +225,7 @@ namespace generated
 
     void CPACSCrossBeamStrutAssemblyPosition::SetStructuralElementUID(const std::string& value)
     {
+        m_dirty = true;
         m_structuralElementUID = value;
     }
 
@@ -209,6 +236,7 @@ namespace generated
 
     void CPACSCrossBeamStrutAssemblyPosition::SetFrameUID(const std::string& value)
     {
+        m_dirty = true;
         m_frameUID = value;
     }
 
@@ -219,6 +247,7 @@ namespace generated
 
     void CPACSCrossBeamStrutAssemblyPosition::SetCrossBeamUID(const std::string& value)
     {
+        m_dirty = true;
         m_crossBeamUID = value;
     }
 
@@ -229,6 +258,7 @@ namespace generated
 
     void CPACSCrossBeamStrutAssemblyPosition::SetPositionYAtCrossBeam(const double& value)
     {
+        m_dirty = true;
         m_positionYAtCrossBeam = value;
     }
 
@@ -239,6 +269,7 @@ namespace generated
 
     void CPACSCrossBeamStrutAssemblyPosition::SetAngleX(const boost::optional<double>& value)
     {
+        m_dirty = true;
         m_angleX = value;
     }
 
@@ -261,6 +292,7 @@ namespace generated
 
     void CPACSCrossBeamStrutAssemblyPosition::RemoveAlignment()
     {
+        m_dirty = true;
         m_alignment = boost::none;
     }
 
@@ -29,6 +29,7 @@ namespace generated
         , m_upperN2(0)
         , m_lowerN1(0)
         , m_lowerN2(0)
+        , m_dirty(true)
     {
     }
 
@@ -47,18 +48,12 @@ namespace generated
         }
 
         // read element upperN1
-        if (tixi::TixiCheckElement(tixiHandle, xpath + "/upperN1")) {
-            m_upperN1 = tixi::TixiGetElement<double>(tixiHandle, xpath + "/upperN1");
-        }
-        else {
+        if (!tixi::TixiTryGetElement(tixiHandle, xpath + "/upperN1", m_upperN1)) {
             LOG(ERROR) << "Required element upperN1 is missing at xpath " << xpath;
         }
 
         // read element upperN2
-        if (tixi::TixiCheckElement(tixiHandle, xpath + "/upperN2")) {
-            m_upperN2 = tixi::TixiGetElement<double>(tixiHandle, xpath + "/upperN2");
-        }
-        else {
+        if (!tixi::TixiTryGetElement(tixiHandle, xpath + "/upperN2", m_upperN2)) {
             LOG(ERROR) << "Required element upperN2 is missing at xpath " << xpath;
         }
 
@@ -71,18 +66,12 @@ namespace generated
         }
 
         // read element lowerN1
-        if (tixi::TixiCheckElement(tixiHandle, xpath + "/lowerN1")) {
-            m_lowerN1 = tixi::TixiGetElement<double>(tixiHandle, xpath + "/lowerN1");
-        }
-        else {
+        if (!tixi::TixiTryGetElement(tixiHandle, xpath + "/lowerN1", m_lowerN1)) {
             LOG(ERROR) << "Required element lowerN1 is missing at xpath " << xpath;
         }
 
         // read element lowerN2
-        if (tixi::TixiCheckElement(tixiHandle, xpath + "/lowerN2")) {
-            m_lowerN2 = tixi::TixiGetElement<double>(tixiHandle, xpath + "/lowerN2");
-        }
-        else {
+        if (!tixi::TixiTryGetElement(tixiHandle, xpath + "/lowerN2", m_lowerN2)) {
             LOG(ERROR) << "Required element lowerN2 is missing at xpath " << xpath;
         }
 
@@ -95,9 +84,7 @@ namespace generated
         }
 
         // read element trailingEdgeThickness
-        if (tixi::TixiCheckElement(tixiHandle, xpath + "/trailingEdgeThickness")) {
-            m_trailingEdgeThickness = tixi::TixiGetElement<double>(tixiHandle, xpath + "/trailingEdgeThickness");
-        }
+        tixi::TixiTryGetElement(tixiHandle, xpath + "/trailingEdgeThickness", m_trailingEdgeThickness);
 
     }
 
@@ -144,6 +131,57 @@ namespace generated
 
     }
 
+    bool CPACSCst2D::IsDirty() const
+    {
+        if (m_dirty) {
+            return true;
+        }
+        if (m_psi.IsDirty()) {
+            return true;
+        }
+        if (m_upperB.IsDirty()) {
+            return true;
+        }
+        if (m_lowerB.IsDirty()) {
+            return true;
+        }
+        return false;
+    }
+
+    void CPACSCst2D::ClearDirty()
+    {
+        m_dirty = false;
+        m_psi.ClearDirty();
+        m_upperB.ClearDirty();
+        m_lowerB.ClearDirty();
+    }
+
+    void CPACSCst2D::WriteDirtyCPACS(const TixiDocumentHandle& tixiHandle, const std::string& xpath) const
+    {
+        if (m_dirty) {
+            WriteCPACS(tixiHandle, xpath);
+            return;
+        }
+
+        // write modified element psi
+        if (m_psi.IsDirty()) {
+            tixi::TixiCreateElementIfNotExists(tixiHandle, xpath + "/psi");
+            m_psi.WriteDirtyCPACS(tixiHandle, xpath + "/psi");
+        }
+
+        // write modified element upperB
+        if (m_upperB.IsDirty()) {
+            tixi::TixiCreateElementIfNotExists(tixiHandle, xpath + "/upperB");
+            m_upperB.WriteDirtyCPACS(tixiHandle, xpath + "/upperB");
+        }
+
+        // write modified element lowerB
+        if (m_lowerB.IsDirty()) {
+            tixi::TixiCreateElementIfNotExists(tixiHandle, xpath + "/lowerB");
+            m_lowerB.WriteDirtyCPACS(tixiHandle, xpath + "/lowerB");
+        }
+    }
+
     const CCPACSStringVector& CPACSCst2D::GetPsi() const
     {
         return m_psi;
@@ -161,6 +199,7 @@ namespace generated
 
     void CPACSCst2D::SetUpperN1(const double& value)
     {
+        m_dirty = true;
         m_upperN1 = value;
     }
 
@@ -171,6 +210,7 @@ namespace generated
 
     void CPACSCst2D::SetUpperN2(const double& value)
     {
+        m_dirty = true;
         m_upperN2 = value;
     }
 
@@ -191,6 +231,7 @@ namespace generated
 
     void CPACSCst2D::SetLowerN1(const double& value)
     {
+        m_dirty = true;
         m_lowerN1 = value;
     }
 
@@ -201,6 +242,7 @@ namespace generated
 
     void CPACSCst2D::SetLowerN2(const double& value)
     {
+        m_dirty = true;
         m_lowerN2 = value;
     }
 
@@ -221,6 +263,7 @@ namespace generated
 
     void CPACSCst2D::SetTrailingEdgeThickness(const boost::optional<double>& value)
     {
+        m_dirty = true;
         m_trailingEdgeThickness = value;
     }
 
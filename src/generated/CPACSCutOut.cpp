@@ -30,6 +30,7 @@ namespace generated
         , m_width(0)
         , m_height(0)
         , m_filletRadius(0)
+        , m_dirty(true)
     {
     }
 
@@ -51,8 +52,7 @@ namespace generated
     void CPACSCutOut::ReadCPACS(const TixiDocumentHandle& tixiHandle, const std::string& xpath)
     {
         // read attribute uID
-        if (tixi::TixiCheckAttribute(tixiHandle, xpath, "uID")) {
-            m_uID = tixi::TixiGetAttribute<std::string>(tixiHandle, xpath, "uID");
+        if (tixi::TixiTryGetAttribute(tixiHandle, xpath, "uID", m_uID)) {
             if (m_uID.empty()) {
                 LOG(WARNING) << "Required attribute uID is empty at xpath " << xpath;
             }
@@ -62,48 +62,36 @@ namespace generated
         }
 
         // read element name
-        if (tixi::TixiCheckElement(tixiHandle, xpath + "/name")) {
-            m_name = tixi::TixiGetElement<std::string>(tixiHandle, xpath + "/name");
+        if (tixi::TixiTryGetElement(tixiHandle, xpath + "/name", m_name)) {
             if (m_name->empty()) {
                 LOG(WARNING) << "Optional element name is present but empty at xpath " << xpath;
             }
         }
 
         // read element description
-        if (tixi::TixiCheckElement(tixiHandle, xpath + "/description")) {
-            m_description = tixi::TixiGetElement<std::string>(tixiHandle, xpath + "/description");
+        if (tixi::TixiTryGetElement(tixiHandle, xpath + "/description", m_description)) {
             if (m_description->empty()) {
                 LOG(WARNING) << "Optional element description is present but empty at xpath " << xpath;
             }
         }
 
         // read element width
-        if (tixi::TixiCheckElement(tixiHandle, xpath + "/width")) {
-            m_width = tixi::TixiGetElement<double>(tixiHandle, xpath + "/width");
-        }
-        else {
+        if (!tixi::TixiTryGetElement(tixiHandle, xpath + "/width", m_width)) {
             LOG(ERROR) << "Required element width is missing at xpath " << xpath;
         }
 
         // read element height
-        if (tixi::TixiCheckElement(tixiHandle, xpath + "/height")) {
-            m_height = tixi::TixiGetElement<double>(tixiHandle, xpath + "/height");
-        }
-        else {
+        if (!tixi::TixiTryGetElement(tixiHandle, xpath + "/height", m_height)) {
             LOG(ERROR) << "Required element height is missing at xpath " << xpath;
         }
 
         // read element filletRadius
-        if (tixi::TixiCheckElement(tixiHandle, xpath + "/filletRadius")) {
-            m_filletRadius = tixi::TixiGetElement<double>(tixiHandle, xpath + "/filletRadius");
-        }
-        else {
+        if (!tixi::TixiTryGetElement(tixiHandle, xpath + "/filletRadius", m_filletRadius)) {
             LOG(ERROR) << "Required element filletRadius is missing at xpath " << xpath;
         }
 
         // read element reinforcementElementUID
-        if (tixi::TixiCheckElement(tixiHandle, xpath + "/reinforcementElementUID")) {
-            m_reinforcementElementUID = tixi::TixiGetElement<std::string>(tixiHandle, xpath + "/reinforcementElementUID");
+        if (tixi::TixiTryGetElement(tixiHandle, xpath + "/reinforcementElementUID", m_reinforcementElementUID)) {
             if (m_reinforcementElementUID->empty()) {
                 LOG(WARNING) << "Optional element reinforcementElementUID is present but empty at xpath " << xpath;
             }
@@ -164,6 +152,23 @@ namespace generated
 
     }
 
+    bool CPACSCutOut::IsDirty() const
+    {
+        return m_dirty;
+    }
+
+    void CPACSCutOut::ClearDirty()
+    {
+        m_dirty = false;
+    }
+
+    void CPACSCutOut::WriteDirtyCPACS(const TixiDocumentHandle& tixiHandle, const std::string& xpath) const
+    {
+        if (m_dirty) {
+            WriteCPACS(tixiHandle, xpath);
+        }
+    }
+
     const std::string& CPACSCutOut::GetUID() const
     {
         return m_uID;
@@ -171,6 +176,7 @@ namespace generated
 
     void CPACSCutOut::SetUID(const std::string& value)
     {
+        m_dirty = true;
         if (m_uidMgr) {
             m_uidMgr->TryUnregisterObject(m_uID);
             m_uidMgr->RegisterObject(value, *this);
@@ -185,6 +191,7 @@ namespace generated
 
     void CPACSCutOut::SetName(const boost::optional<std::string>& value)
     {
+        m_dirty = true;
         m_name = value;
     }
 
@@ -195,6 +202,7 @@ namespace generated
 
     void CPACSCutOut::SetDescription(const boost::optional<std::string>& value)
     {
+        m_dirty = true;
         m_description = value;
     }
 
@@ -205,6 +213,7 @@ namespace generated
 
     void CPACSCutOut::SetWidth(const double& value)
     {
+        m_dirty = true;
         m_width = value;
     }
 
@@ -215,6 +224,7 @@ namespace generated
 
     void CPACSCutOut::SetHeight(const double& value)
     {
+        m_dirty = true;
         m_height = value;
     }
 
@@ -225,6 +235,7 @@ namespace generated
 
     void CPACSCutOut::SetFilletRadius(const double& value)
     {
+        m_dirty = true;
         m_filletRadius = value;
     }
 
@@ -235,6 +246,7 @@ namespace generated
 
     void CPACSCutOut::SetReinforcementElementUID(const boost::optional<std::string>& value)
     {
+        m_dirty = true;
         m_reinforcementElementUID = value;
     }
 
@@ -27,6 +27,7 @@ namespace generated
     CPACSCutOutControlPoint::CPACSCutOutControlPoint()
         : m_relHeight(0)
         , m_xsi(0)
+        , m_dirty(true)
     {
     }
 
@@ -37,18 +38,12 @@ namespace generated
     void CPACSCutOutControlPoint::ReadCPACS(const TixiDocumentHandle& tixiHandle, const std::string& xpath)
     {
         // read element relHeight
-        if (tixi::TixiCheckElement(tixiHandle, xpath + "/relHeight")) {
-            m_relHeight = tixi::TixiGetElement<double>(tixiHandle, xpath + "/relHeight");
-        }
-        else {
+        if (!tixi::TixiTryGetElement(tixiHandle, xpath + "/relHeight", m_relHeight)) {
             LOG(ERROR) << "Required element relHeight is missing at xpath " << xpath;
         }
 
         // read element xsi
-        if (tixi::TixiCheckElement(tixiHandle, xpath + "/xsi")) {
-            m_xsi = tixi::TixiGetElement<double>(tixiHandle, xpath + "/xsi");
-        }
-        else {
+        if (!tixi::TixiTryGetElement(tixiHandle, xpath + "/xsi", m_xsi)) {
             LOG(ERROR) << "Required element xsi is missing at xpath " << xpath;
         }
 
@@ -66,6 +61,23 @@ namespace generated
 
     }
 
+    bool CPACSCutOutControlPoint::IsDirty() const
+    {
+        return m_dirty;
+    }
+
+    void CPACSCutOutControlPoint::ClearDirty()
+    {
+        m_dirty = false;
+    }
+
+    void CPACSCutOutControlPoint::WriteDirtyCPACS(const TixiDocumentHandle& tixiHandle, const std::string& xpath) const
+    {
+        if (m_dirty) {
+            WriteCPACS(tixiHandle, xpath);
+        }
+    }
+
     const double& CPACSCutOutControlPoint::GetRelHeight() const
     {
         return m_relHeight;
@@ -73,6 +85,7 @@ namespace generated
 
     void CPACSCutOutControlPoint::SetRelHeight(const double& value)
     {
+        m_dirty = true;
         m_relHeight = value;
     }
 
@@ -83,6 +96,7 @@ namespace generated
 
     void CPACSCutOutControlPoint::SetXsi(const double& value)
     {
+        m_dirty = true;
         m_xsi = value;
     }
 
@@ -25,6 +25,7 @@ namespace tigl
 namespace generated
 {
     CPACSCutOutControlPoints::CPACSCutOutControlPoints()
+        : m_dirty(true)
     {
     }
 
@@ -64,6 +65,47 @@ namespace generated
 
     }
 
+    bool CPACSCutOutControlPoints::IsDirty() const
+    {
+        if (m_dirty) {
+            return true;
+        }
+        if (m_innerBorder.IsDirty()) {
+            return true;
+        }
+        if (m_outerBorder.IsDirty()) {
+            return true;
+        }
+        return false;
+    }
+
+    void CPACSCutOutControlPoints::ClearDirty()
+    {
+        m_dirty = false;
+        m_innerBorder.ClearDirty();
+        m_outerBorder.ClearDirty();
+    }
+
+    void CPACSCutOutControlPoints::WriteDirtyCPACS(const TixiDocumentHandle& tixiHandle, const std::string& xpath) const
+    {
+        if (m_dirty) {
+            WriteCPACS(tixiHandle, xpath);
+            return;
+        }
+
+        // write modified element innerBorder
+        if (m_innerBorder.IsDirty()) {
+            tixi::TixiCreateElementIfNotExists(tixiHandle, xpath + "/innerBorder");
+            m_innerBorder.WriteDirtyCPACS(tixiHandle, xpath + "/innerBorder");
+        }
+
+        // write modified element outerBorder
+        if (m_outerBorder.IsDirty()) {
+            tixi::TixiCreateElementIfNotExists(tixiHandle, xpath + "/outerBorder");
+            m_outerBorder.WriteDirtyCPACS(tixiHandle, xpath + "/outerBorder");
+        }
+    }
+
     const CPACSCutOutControlPoint& CPACSCutOutControlPoints::GetInnerBorder() const
     {
         return m_innerBorder;
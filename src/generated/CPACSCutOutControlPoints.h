@@ -43,6 +43,10 @@ namespace generated
         TIGL_EXPORT virtual void ReadCPACS(const TixiDocumentHandle& tixiHandle, const std::string& xpath);
         TIGL_EXPORT virtual void WriteCPACS(const TixiDocumentHandle& tixiHandle, const std::string& xpath) const;
 
+        TIGL_EXPORT virtual bool IsDirty() const;
+        TIGL_EXPORT virtual void ClearDirty();
+        TIGL_EXPORT virtual void WriteDirtyCPACS(const TixiDocumentHandle& tixiHandle, const std::string& xpath) const;
+
         TIGL_EXPORT virtual const CPACSCutOutControlPoint& GetInnerBorder() const;
         TIGL_EXPORT virtual CPACSCutOutControlPoint& GetInnerBorder();
 
@@ -53,6 +57,9 @@ namespace generated
         CPACSCutOutControlPoint m_innerBorder;
         CPACSCutOutControlPoint m_outerBorder;
 
+        /// Set by the setters, cleared after the object has been read or written
+        bool m_dirty;
+
     private:
 #ifdef HAVE_CPP11
         CPACSCutOutControlPoints(const CPACSCutOutControlPoints&) = delete;
@@ -26,6 +26,7 @@ namespace generated
 {
     CPACSCutOutProfile::CPACSCutOutProfile()
         : m_rotZ(0)
+        , m_dirty(true)
     {
     }
 
@@ -36,8 +37,7 @@ namespace generated
     void CPACSCutOutProfile::ReadCPACS(const TixiDocumentHandle& tixiHandle, const std::string& xpath)
     {
         // read element profileUID
-        if (tixi::TixiCheckElement(tixiHandle, xpath + "/profileUID")) {
-            m_profileUID = tixi::TixiGetElement<std::string>(tixiHandle, xpath + "/profileUID");
+        if (tixi::TixiTryGetElement(tixiHandle, xpath + "/profileUID", m_profileUID)) {
             if (m_profileUID.empty()) {
                 LOG(WARNING) << "Required element profileUID is empty at xpath " << xpath;
             }
@@ -55,10 +55,7 @@ namespace generated
         }
 
         // read element rotZ
-        if (tixi::TixiCheckElement(tixiHandle, xpath + "/rotZ")) {
-            m_rotZ = tixi::TixiGetElement<double>(tixiHandle, xpath + "/rotZ");
-        }
-        else {
+        if (!tixi::TixiTryGetElement(tixiHandle, xpath + "/rotZ", m_rotZ)) {
             LOG(ERROR) << "Required element rotZ is missing at xpath " << xpath;
         }
 
@@ -80,6 +77,37 @@ namespace generated
 
     }
 
+    bool CPACSCutOutProfile::IsDirty() const
+    {
+        if (m_dirty) {
+            return true;
+        }
+        if (m_eta.IsDirty()) {
+            return true;
+        }
+        return false;
+    }
+
+    void CPACSCutOutProfile::ClearDirty()
+    {
+        m_dirty = false;
+        m_eta.ClearDirty();
+    }
+
+    void CPACSCutOutProfile::WriteDirtyCPACS(const TixiDocumentHandle& tixiHandle, const std::string& xpath) const
+    {
+        if (m_dirty) {
+            WriteCPACS(tixiHandle, xpath);
+            return;
+        }
+
+        // write modified element eta
+        if (m_eta.IsDirty()) {
+            tixi::TixiCreateElementIfNotExists(tixiHandle, xpath + "/eta");
+            m_eta.WriteDirtyCPACS(tixiHandle, xpath + "/eta");
+        }
+    }
+
     const std::string& CPACSCutOutProfile::GetProfileUID() const
     {
         return m_profileUID;
@@ -87,6 +115,7 @@ namespace generated
 
     void CPACSCutOutProfile::SetProfileUID(const std::string& value)
     {
+        m_dirty = true;
         m_profileUID = value;
     }
 
@@ -107,6 +136,7 @@ namespace generated
 
     void CPACSCutOutProfile::SetRotZ(const double& value)
     {
+        m_dirty = true;
         m_rotZ = value;
     }
 
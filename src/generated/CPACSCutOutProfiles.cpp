@@ -26,6 +26,7 @@ namespace tigl
 namespace generated
 {
     CPACSCutOutProfiles::CPACSCutOutProfiles()
+        : m_dirty(true)
     {
     }
 
@@ -73,6 +74,63 @@ namespace generated
 
     }
 
+    bool CPACSCutOutProfiles::IsDirty() const
+    {
+        if (m_dirty) {
+            return true;
+        }
+        if (m_outerCutOutProfile.IsDirty()) {
+            return true;
+        }
+        if (m_innerCutOutProfile.IsDirty()) {
+            return true;
+        }
+        if (m_cutOutProfiles.size() != m_cutOutProfilesClean.size()) {
+            return true;
+        }
+        for (std::size_t i = 0; i < m_cutOutProfiles.size(); i++) {
+            if (m_cutOutProfiles[i].get() != m_cutOutProfilesClean[i] || m_cutOutProfiles[i]->IsDirty()) {
+                return true;
+            }
+        }
+        return false;
+    }
+
+    void CPACSCutOutProfiles::ClearDirty()
+    {
+        m_dirty = false;
+        m_outerCutOutProfile.ClearDirty();
+        m_innerCutOutProfile.ClearDirty();
+        m_cutOutProfilesClean.clear();
+        for (std::size_t i = 0; i < m_cutOutProfiles.size(); i++) {
+            m_cutOutProfilesClean.push_back(m_cutOutProfiles[i].get());
+            m_cutOutProfiles[i]->ClearDirty();
+        }
+    }
+
+    void CPACSCutOutProfiles::WriteDirtyCPACS(const TixiDocumentHandle& tixiHandle, const std::string& xpath) const
+    {
+        if (m_dirty) {
+            WriteCPACS(tixiHandle, xpath);
+            return;
+        }
+
+        // write modified element outerCutOutProfile
+        if (m_outerCutOutProfile.IsDirty()) {
+            tixi::TixiCreateElementIfNotExists(tixiHandle, xpath + "/outerCutOutProfile");
+            m_outerCutOutProfile.WriteDirtyCPACS(tixiHandle, xpath + "/outerCutOutProfile");
+        }
+
+        // write modified element innerCutOutProfile
+        if (m_innerCutOutProfile.IsDirty()) {
+            tixi::TixiCreateElementIfNotExists(tixiHandle, xpath + "/innerCutOutProfile");
+            m_innerCutOutProfile.WriteDirtyCPACS(tixiHandle, xpath + "/innerCutOutProfile");
+        }
+
+        // write modified elements cutOutProfile
+        tixi::TixiSaveDirtyElements(tixiHandle, xpath + "/cutOutProfile", m_cutOutProfiles, m_cutOutProfilesClean);
+    }
+
     const CPACSOuterCutOutProfile& CPACSCutOutProfiles::GetOuterCutOutProfile() const
     {
         return m_outerCutOutProfile;
@@ -111,6 +169,7 @@ namespace generated
 
     void CPACSCutOutProfiles::RemoveCutOutProfile(CPACSCutOutProfile& ref)
     {
+        m_dirty = true;
         for (std::size_t i = 0; i < m_cutOutProfiles.size(); i++) {
             if (m_cutOutProfiles[i].get() == &ref) {
                 m_cutOutProfiles.erase(m_cutOutProfiles.begin() + i);
@@ -47,6 +47,10 @@ namespace generated
         TIGL_EXPORT virtual void ReadCPACS(const TixiDocumentHandle& tixiHandle, const std::string& xpath);
         TIGL_EXPORT virtual void WriteCPACS(const TixiDocumentHandle& tixiHandle, const std::string& xpath) const;
 
+        TIGL_EXPORT virtual bool IsDirty() const;
+        TIGL_EXPORT virtual void ClearDirty();
+        TIGL_EXPORT virtual void WriteDirtyCPACS(const TixiDocumentHandle& tixiHandle, const std::string& xpath) const;
+
         TIGL_EXPORT virtual const CPACSOuterCutOutProfile& GetOuterCutOutProfile() const;
         TIGL_EXPORT virtual CPACSOuterCutOutProfile& GetOuterCutOutProfile();
 
@@ -64,6 +68,12 @@ namespace generated
         CPACSOuterCutOutProfile                      m_innerCutOutProfile;
         std::vector<unique_ptr<CPACSCutOutProfile> > m_cutOutProfiles;
 
+        /// Set by the setters, cleared after the object has been read or written
+        bool m_dirty;
+
+        /// List elements at the last call of ClearDirty
+        std::vector<const CPACSCutOutProfile*> m_cutOutProfilesClean;
+
     private:
 #ifdef HAVE_CPP11
         CPACSCutOutProfiles(const CPACSCutOutProfiles&) = delete;
@@ -29,6 +29,7 @@ namespace generated
 {
     CPACSDoorAssemblyPosition::CPACSDoorAssemblyPosition(CPACSCargoDoorsAssembly* parent, CTiglUIDManager* uidMgr)
         : m_uidMgr(uidMgr)
+        , m_dirty(true)
     {
         //assert(parent != NULL);
         m_parent = parent;
@@ -62,8 +63,7 @@ namespace generated
     void CPACSDoorAssemblyPosition::ReadCPACS(const TixiDocumentHandle& tixiHandle, const std::string& xpath)
     {
         // read attribute uID
-        if (tixi::TixiCheckAttribute(tixiHandle, xpath, "uID")) {
-            m_uID = tixi::TixiGetAttribute<std::string>(tixiHandle, xpath, "uID");
+        if (tixi::TixiTryGetAttribute(tixiHandle, xpath, "uID", m_uID)) {
             if (m_uID.empty()) {
                 LOG(WARNING) << "Required attribute uID is empty at xpath " << xpath;
             }
@@ -73,16 +73,14 @@ namespace generated
         }
 
         // read element name
-        if (tixi::TixiCheckElement(tixiHandle, xpath + "/name")) {
-            m_name = tixi::TixiGetElement<std::string>(tixiHandle, xpath + "/name");
+        if (tixi::TixiTryGetElement(tixiHandle, xpath + "/name", m_name)) {
             if (m_name->empty()) {
                 LOG(WARNING) << "Optional element name is present but empty at xpath " << xpath;
             }
         }
 
         // read element description
-        if (tixi::TixiCheckElement(tixiHandle, xpath + "/description")) {
-            m_description = tixi::TixiGetElement<std::string>(tixiHandle, xpath + "/description");
+        if (tixi::TixiTryGetElement(tixiHandle, xpath + "/description", m_description)) {
             if (m_description->empty()) {
                 LOG(WARNING) << "Optional element description is present but empty at xpath " << xpath;
             }
@@ -94,8 +92,7 @@ namespace generated
         }
 
         // read element doorElementUID
-        if (tixi::TixiCheckElement(tixiHandle, xpath + "/doorElementUID")) {
-            m_doorElementUID = tixi::TixiGetElement<std::string>(tixiHandle, xpath + "/doorElementUID");
+        if (tixi::TixiTryGetElement(tixiHandle, xpath + "/doorElementUID", m_doorElementUID)) {
             if (m_doorElementUID.empty()) {
                 LOG(WARNING) << "Required element doorElementUID is empty at xpath " << xpath;
             }
@@ -105,8 +102,7 @@ namespace generated
         }
 
         // read element startFrameUID
-        if (tixi::TixiCheckElement(tixiHandle, xpath + "/startFrameUID")) {
-            m_startFrameUID = tixi::TixiGetElement<std::string>(tixiHandle, xpath + "/startFrameUID");
+        if (tixi::TixiTryGetElement(tixiHandle, xpath + "/startFrameUID", m_startFrameUID)) {
             if (m_startFrameUID.empty()) {
                 LOG(WARNING) << "Required element startFrameUID is empty at xpath " << xpath;
             }
@@ -116,8 +112,7 @@ namespace generated
         }
 
         // read element endFrameUID
-        if (tixi::TixiCheckElement(tixiHandle, xpath + "/endFrameUID")) {
-            m_endFrameUID = tixi::TixiGetElement<std::string>(tixiHandle, xpath + "/endFrameUID");
+        if (tixi::TixiTryGetElement(tixiHandle, xpath + "/endFrameUID", m_endFrameUID)) {
             if (m_endFrameUID.empty()) {
                 LOG(WARNING) << "Required element endFrameUID is empty at xpath " << xpath;
             }
@@ -127,8 +122,7 @@ namespace generated
         }
 
         // read element startStringerUID
-        if (tixi::TixiCheckElement(tixiHandle, xpath + "/startStringerUID")) {
-            m_startStringerUID = tixi::TixiGetElement<std::string>(tixiHandle, xpath + "/startStringerUID");
+        if (tixi::TixiTryGetElement(tixiHandle, xpath + "/startStringerUID", m_startStringerUID)) {
             if (m_startStringerUID.empty()) {
                 LOG(WARNING) << "Required element startStringerUID is empty at xpath " << xpath;
             }
@@ -138,8 +132,7 @@ namespace generated
         }
 
         // read element endStringerUID
-        if (tixi::TixiCheckElement(tixiHandle, xpath + "/endStringerUID")) {
-            m_endStringerUID = tixi::TixiGetElement<std::string>(tixiHandle, xpath + "/endStringerUID");
+        if (tixi::TixiTryGetElement(tixiHandle, xpath + "/endStringerUID", m_endStringerUID)) {
             if (m_endStringerUID.empty()) {
                 LOG(WARNING) << "Required element endStringerUID is empty at xpath " << xpath;
             }
@@ -149,24 +142,16 @@ namespace generated
         }
 
         // read element zBase
-        if (tixi::TixiCheckElement(tixiHandle, xpath + "/zBase")) {
-            m_zBase = tixi::TixiGetElement<double>(tixiHandle, xpath + "/zBase");
-        }
+        tixi::TixiTryGetElement(tixiHandle, xpath + "/zBase", m_zBase);
 
         // read element minWidth
-        if (tixi::TixiCheckElement(tixiHandle, xpath + "/minWidth")) {
-            m_minWidth = tixi::TixiGetElement<double>(tixiHandle, xpath + "/minWidth");
-        }
+        tixi::TixiTryGetElement(tixiHandle, xpath + "/minWidth", m_minWidth);
 
         // read element minHeight
-        if (tixi::TixiCheckElement(tixiHandle, xpath + "/minHeight")) {
-            m_minHeight = tixi::TixiGetElement<double>(tixiHandle, xpath + "/minHeight");
-        }
+        tixi::TixiTryGetElement(tixiHandle, xpath + "/minHeight", m_minHeight);
 
         // read element ySign
-        if (tixi::TixiCheckElement(tixiHandle, xpath + "/ySign")) {
-            m_ySign = tixi::TixiGetElement<int>(tixiHandle, xpath + "/ySign");
-        }
+        tixi::TixiTryGetElement(tixiHandle, xpath + "/ySign", m_ySign);
 
         if (m_uidMgr && !m_uID.empty()) m_uidMgr->RegisterObject(m_uID, *this);
     }
@@ -275,6 +260,23 @@ namespace generated
 
     }
 
+    bool CPACSDoorAssemblyPosition::IsDirty() const
+    {
+        return m_dirty;
+    }
+
+    void CPACSDoorAssemblyPosition::ClearDirty()
+    {
+        m_dirty = false;
+    }
+
+    void CPACSDoorAssemblyPosition::WriteDirtyCPACS(const TixiDocumentHandle& tixiHandle, const std::string& xpath) const
+    {
+        if (m_dirty) {
+            WriteCPACS(tixiHandle, xpath);
+        }
+    }
+
     const std::string& CPACSDoorAssemblyPosition::GetUID() const
     {
         return m_uID;
@@ -282,6 +284,7 @@ namespace generated
 
     void CPACSDoorAssemblyPosition::SetUID(const std::string& value)
     {
+        m_dirty = true;
         if (m_uidMgr) {
             m_uidMgr->TryUnregisterObject(m_uID);
             m_uidMgr->RegisterObject(value, *this);
@@ -296,6 +299,7 @@ namespace generated
 
     void CPACSDoorAssemblyPosition::SetName(const boost::optional<std::string>& value)
     {
+        m_dirty = true;
         m_name = value;
     }
 
@@ -306,6 +310,7 @@ namespace generated
 
     void CPACSDoorAssemblyPosition::SetDescription(const boost::optional<std::string>& value)
     {
+        m_dirty = true;
         m_description = value;
     }
 
@@ -316,6 +321,7 @@ namespace generated
 
     void CPACSDoorAssemblyPosition::SetDoorType(const boost::optional<CPACSDoorAssemblyPosition_doorType>& value)
     {
+        m_dirty = true;
         m_doorType = value;
     }
 
@@ -326,6 +332,7 @@ namespace generated
 
     void CPACSDoorAssemblyPosition::SetDoorElementUID(const std::string& value)
     {
+        m_dirty = true;
         m_doorElementUID = value;
     }
 
@@ -336,6 +343,7 @@ namespace generated
 
     void CPACSDoorAssemblyPosition::SetStartFrameUID(const std::string& value)
     {
+        m_dirty = true;
         m_startFrameUID = value;
     }
 
@@ -346,6 +354,7 @@ namespace generated
 
     void CPACSDoorAssemblyPosition::SetEndFrameUID(const std::string& value)
     {
+        m_dirty = true;
         m_endFrameUID = value;
     }
 
@@ -356,6 +365,7 @@ namespace generated
 
     void CPACSDoorAssemblyPosition::SetStartStringerUID(const std::string& value)
     {
+        m_dirty = true;
         m_startStringerUID = value;
     }
 
@@ -366,6 +376,7 @@ namespace generated
 
     void CPACSDoorAssemblyPosition::SetEndStringerUID(const std::string& value)
     {
+        m_dirty = true;
         m_endStringerUID = value;
     }
 
@@ -376,6 +387,7 @@ namespace generated
 
     void CPACSDoorAssemblyPosition::SetZBase(const boost::optional<double>& value)
     {
+        m_dirty = true;
         m_zBase = value;
     }
 
@@ -386,6 +398,7 @@ namespace generated
 
     void CPACSDoorAssemblyPosition::SetMinWidth(const boost::optional<double>& value)
     {
+        m_dirty = true;
         m_minWidth = value;
     }
 
@@ -396,6 +409,7 @@ namespace generated
 
     void CPACSDoorAssemblyPosition::SetMinHeight(const boost::optional<double>& value)
     {
+        m_dirty = true;
         m_minHeight = value;
     }
 
@@ -406,6 +420,7 @@ namespace generated
 
     void CPACSDoorAssemblyPosition::SetYSign(const boost::optional<int>& value)
     {
+        m_dirty = true;
         m_ySign = value;
     }
 
@@ -27,6 +27,7 @@ namespace generated
 {
     CPACSDoorCutOut::CPACSDoorCutOut(CTiglUIDManager* uidMgr)
         : m_uidMgr(uidMgr)
+        , m_dirty(true)
     {
     }
 
@@ -48,8 +49,7 @@ namespace generated
     void CPACSDoorCutOut::ReadCPACS(const TixiDocumentHandle& tixiHandle, const std::string& xpath)
     {
         // read attribute uID
-        if (tixi::TixiCheckAttribute(tixiHandle, xpath, "uID")) {
-            m_uID = tixi::TixiGetAttribute<std::string>(tixiHandle, xpath, "uID");
+        if (tixi::TixiTryGetAttribute(tixiHandle, xpath, "uID", m_uID)) {
             if (m_uID.empty()) {
                 LOG(WARNING) << "Required attribute uID is empty at xpath " << xpath;
             }
@@ -59,29 +59,24 @@ namespace generated
         }
 
         // read element name
-        if (tixi::TixiCheckElement(tixiHandle, xpath + "/name")) {
-            m_name = tixi::TixiGetElement<std::string>(tixiHandle, xpath + "/name");
+        if (tixi::TixiTryGetElement(tixiHandle, xpath + "/name", m_name)) {
             if (m_name->empty()) {
                 LOG(WARNING) << "Optional element name is present but empty at xpath " << xpath;
             }
         }
 
         // read element description
-        if (tixi::TixiCheckElement(tixiHandle, xpath + "/description")) {
-            m_description = tixi::TixiGetElement<std::string>(tixiHandle, xpath + "/description");
+        if (tixi::TixiTryGetElement(tixiHandle, xpath + "/description", m_description)) {
             if (m_description->empty()) {
                 LOG(WARNING) << "Optional element description is present but empty at xpath " << xpath;
             }
         }
 
         // read element filletRadius
-        if (tixi::TixiCheckElement(tixiHandle, xpath + "/filletRadius")) {
-            m_filletRadius = tixi::TixiGetElement<double>(tixiHandle, xpath + "/filletRadius");
-        }
+        tixi::TixiTryGetElement(tixiHandle, xpath + "/filletRadius", m_filletRadius);
 
         // read element dssDesignUID
-        if (tixi::TixiCheckElement(tixiHandle, xpath + "/dssDesignUID")) {
-            m_dssDesignUID = tixi::TixiGetElement<std::string>(tixiHandle, xpath + "/dssDesignUID");
+        if (tixi::TixiTryGetElement(tixiHandle, xpath + "/dssDesignUID", m_dssDesignUID)) {
             if (m_dssDesignUID->empty()) {
                 LOG(WARNING) << "Optional element dssDesignUID is present but empty at xpath " << xpath;
             }
@@ -141,6 +136,23 @@ namespace generated
 
     }
 
+    bool CPACSDoorCutOut::IsDirty() const
+    {
+        return m_dirty;
+    }
+
+    void CPACSDoorCutOut::ClearDirty()
+    {
+        m_dirty = false;
+    }
+
+    void CPACSDoorCutOut::WriteDirtyCPACS(const TixiDocumentHandle& tixiHandle, const std::string& xpath) const
+    {
+        if (m_dirty) {
+            WriteCPACS(tixiHandle, xpath);
+        }
+    }
+
     const std::string& CPACSDoorCutOut::GetUID() const
     {
         return m_uID;
@@ -148,6 +160,7 @@ namespace generated
 
     void CPACSDoorCutOut::SetUID(const std::string& value)
     {
+        m_dirty = true;
         if (m_uidMgr) {
             m_uidMgr->TryUnregisterObject(m_uID);
             m_uidMgr->RegisterObject(value, *this);
@@ -162,6 +175,7 @@ namespace generated
 
     void CPACSDoorCutOut::SetName(const boost::optional<std::string>& value)
     {
+        m_dirty = true;
         m_name = value;
     }
 
@@ -172,6 +186,7 @@ namespace generated
 
     void CPACSDoorCutOut::SetDescription(const boost::optional<std::string>& value)
     {
+        m_dirty = true;
         m_description = value;
     }
 
@@ -182,6 +197,7 @@ namespace generated
 
     void CPACSDoorCutOut::SetFilletRadius(const boost::optional<double>& value)
     {
+        m_dirty = true;
         m_filletRadius = value;
     }
 
@@ -192,6 +208,7 @@ namespace generated
 
     void CPACSDoorCutOut::SetDssDesignUID(const boost::optional<std::string>& value)
     {
+        m_dirty = true;
         m_dssDesignUID = value;
     }
 
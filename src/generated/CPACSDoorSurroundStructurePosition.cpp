@@ -31,6 +31,7 @@ namespace generated
         , m_framesGapRear(0)
         , m_stringersGapPrimary(0)
         , m_stringersGapSecondary(0)
+        , m_dirty(true)
     {
     }
 
@@ -52,8 +53,7 @@ namespace generated
     void CPACSDoorSurroundStructurePosition::ReadCPACS(const TixiDocumentHandle& tixiHandle, const std::string& xpath)
     {
         // read attribute uID
-        if (tixi::TixiCheckAttribute(tixiHandle, xpath, "uID")) {
-            m_uID = tixi::TixiGetAttribute<std::string>(tixiHandle, xpath, "uID");
+        if (tixi::TixiTryGetAttribute(tixiHandle, xpath, "uID", m_uID)) {
             if (m_uID.empty()) {
                 LOG(WARNING) << "Required attribute uID is empty at xpath " << xpath;
             }
@@ -63,50 +63,36 @@ namespace generated
         }
 
         // read element name
-        if (tixi::TixiCheckElement(tixiHandle, xpath + "/name")) {
-            m_name = tixi::TixiGetElement<std::string>(tixiHandle, xpath + "/name");
+        if (tixi::TixiTryGetElement(tixiHandle, xpath + "/name", m_name)) {
             if (m_name->empty()) {
                 LOG(WARNING) << "Optional element name is present but empty at xpath " << xpath;
             }
         }
 
         // read element description
-        if (tixi::TixiCheckElement(tixiHandle, xpath + "/description")) {
-            m_description = tixi::TixiGetElement<std::string>(tixiHandle, xpath + "/description");
+        if (tixi::TixiTryGetElement(tixiHandle, xpath + "/description", m_description)) {
             if (m_description->empty()) {
                 LOG(WARNING) << "Optional element description is present but empty at xpath " << xpath;
             }
         }
 
         // read element framesGapFront
-        if (tixi::TixiCheckElement(tixiHandle, xpath + "/framesGapFront")) {
-            m_framesGapFront = tixi::TixiGetElement<int>(tixiHandle, xpath + "/framesGapFront");
-        }
-        else {
+        if (!tixi::TixiTryGetElement(tixiHandle, xpath + "/framesGapFront", m_framesGapFront)) {
             LOG(ERROR) << "Required element framesGapFront is missing at xpath " << xpath;
         }
 
         // read element framesGapRear
-        if (tixi::TixiCheckElement(tixiHandle, xpath + "/framesGapRear")) {
-            m_framesGapRear = tixi::TixiGetElement<int>(tixiHandle, xpath + "/framesGapRear");
-        }
-        else {
+        if (!tixi::TixiTryGetElement(tixiHandle, xpath + "/framesGapRear", m_framesGapRear)) {
             LOG(ERROR) << "Required element framesGapRear is missing at xpath " << xpath;
         }
 
         // read element stringersGapPrimary
-        if (tixi::TixiCheckElement(tixiHandle, xpath + "/stringersGapPrimary")) {
-            m_stringersGapPrimary = tixi::TixiGetElement<int>(tixiHandle, xpath + "/stringersGapPrimary");
-        }
-        else {
+        if (!tixi::TixiTryGetElement(tixiHandle, xpath + "/stringersGapPrimary", m_stringersGapPrimary)) {
             LOG(ERROR) << "Required element stringersGapPrimary is missing at xpath " << xpath;
         }
 
         // read element stringersGapSecondary
-        if (tixi::TixiCheckElement(tixiHandle, xpath + "/stringersGapSecondary")) {
-            m_stringersGapSecondary = tixi::TixiGetElement<int>(tixiHandle, xpath + "/stringersGapSecondary");
-        }
-        else {
+        if (!tixi::TixiTryGetElement(tixiHandle, xpath + "/stringersGapSecondary", m_stringersGapSecondary)) {
             LOG(ERROR) << "Required element stringersGapSecondary is missing at xpath " << xpath;
         }
 
@@ -158,6 +144,23 @@ namespace generated
 
     }
 
+    bool CPACSDoorSurroundStructurePosition::IsDirty() const
+    {
+        return m_dirty;
+    }
+
+    void CPACSDoorSurroundStructurePosition::ClearDirty()
+    {
+        m_dirty = false;
+    }
+
+    void CPACSDoorSurroundStructurePosition::WriteDirtyCPACS(const TixiDocumentHandle& tixiHandle, const std::string& xpath) const
+    {
+        if (m_dirty) {
+            WriteCPACS(tixiHandle, xpath);
+        }
+    }
+
     const std::string& CPACSDoorSurroundStructurePosition::GetUID() const
     {
         return m_uID;
@@ -165,6 +168,7 @@ namespace generated
 
     void CPACSDoorSurroundStructurePosition::SetUID(const std::string& value)
     {
+        m_dirty = true;
         if (m_uidMgr) {
             m_uidMgr->TryUnregisterObject(m_uID);
             m_uidMgr->RegisterObject(value, *this);
@@ -179,6 +183,7 @@ namespace generated
 
     void CPACSDoorSurroundStructurePosition::SetName(const boost::optional<std::string>& value)
     {
+        m_dirty = true;
         m_name = value;
     }
 
@@ -189,6 +194,7 @@ namespace generated
 
     void CPACSDoorSurroundStructurePosition::SetDescription(const boost::optional<std::string>& value)
     {
+        m_dirty = true;
         m_description = value;
     }
 
@@ -199,6 +205,7 @@ namespace generated
 
     void CPACSDoorSurroundStructurePosition::SetFramesGapFront(const int& value)
     {
+        m_dirty = true;
         m_framesGapFront = value;
     }
 
@@ -209,6 +216,7 @@ namespace generated
 
     void CPACSDoorSurroundStructurePosition::SetFramesGapRear(const int& value)
     {
+        m_dirty = true;
         m_framesGapRear = value;
     }
 
@@ -219,6 +227,7 @@ namespace generated
 
     void CPACSDoorSurroundStructurePosition::SetStringersGapPrimary(const int& value)
     {
+        m_dirty = true;
         m_stringersGapPrimary = value;
     }
 
@@ -229,6 +238,7 @@ namespace generated
 
     void CPACSDoorSurroundStructurePosition::SetStringersGapSecondary(const int& value)
     {
+        m_dirty = true;
         m_stringersGapSecondary = value;
     }
 
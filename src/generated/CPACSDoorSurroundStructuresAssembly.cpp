@@ -28,6 +28,7 @@ namespace generated
 {
     CPACSDoorSurroundStructuresAssembly::CPACSDoorSurroundStructuresAssembly(CTiglUIDManager* uidMgr)
         : m_uidMgr(uidMgr)
+        , m_dirty(true)
     {
     }
 
@@ -61,6 +62,43 @@ namespace generated
 
     }
 
+    bool CPACSDoorSurroundStructuresAssembly::IsDirty() const
+    {
+        if (m_dirty) {
+            return true;
+        }
+        if (m_doorSurroundStructures.size() != m_doorSurroundStructuresClean.size()) {
+            return true;
+        }
+        for (std::size_t i = 0; i < m_doorSurroundStructures.size(); i++) {
+            if (m_doorSurroundStructures[i].get() != m_doorSurroundStructuresClean[i] || m_doorSurroundStructures[i]->IsDirty()) {
+                return true;
+            }
+        }
+        return false;
+    }
+
+    void CPACSDoorSurroundStructuresAssembly::ClearDirty()
+    {
+        m_dirty = false;
+        m_doorSurroundStructuresClean.clear();
+        for (std::size_t i = 0; i < m_doorSurroundStructures.size(); i++) {
+            m_doorSurroundStructuresClean.push_back(m_doorSurroundStructures[i].get());
+            m_doorSurroundStructures[i]->ClearDirty();
+        }
+    }
+
+    void CPACSDoorSurroundStructuresAssembly::WriteDirtyCPACS(const TixiDocumentHandle& tixiHandle, const std::string& xpath) const
+    {
+        if (m_dirty) {
+            WriteCPACS(tixiHandle, xpath);
+            return;
+        }
+
+        // write modified elements doorSurroundStructure
+        tixi::TixiSaveDirtyElements(tixiHandle, xpath + "/doorSurroundStructure", m_doorSurroundStructures, m_doorSurroundStructuresClean);
+    }
+
     const std::vector<unique_ptr<CPACSDoorSurroundStructurePosition> >& CPACSDoorSurroundStructuresAssembly::GetDoorSurroundStructures() const
     {
         return m_doorSurroundStructures;
@@ -79,6 +117,7 @@ namespace generated
 
     void CPACSDoorSurroundStructuresAssembly::RemoveDoorSurroundStructure(CPACSDoorSurroundStructurePosition& ref)
     {
+        m_dirty = true;
         for (std::size_t i = 0; i < m_doorSurroundStructures.size(); i++) {
             if (m_doorSurroundStructures[i].get() == &ref) {
                 m_doorSurroundStructures.erase(m_doorSurroundStructures.begin() + i);
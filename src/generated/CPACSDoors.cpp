@@ -28,6 +28,7 @@ namespace generated
 {
     CPACSDoors::CPACSDoors(CTiglUIDManager* uidMgr)
         : m_uidMgr(uidMgr)
+        , m_dirty(true)
     {
     }
 
@@ -61,6 +62,43 @@ namespace generated
 
     }
 
+    bool CPACSDoors::IsDirty() const
+    {
+        if (m_dirty) {
+            return true;
+        }
+        if (m_doors.size() != m_doorsClean.size()) {
+            return true;
+        }
+        for (std::size_t i = 0; i < m_doors.size(); i++) {
+            if (m_doors[i].get() != m_doorsClean[i] || m_doors[i]->IsDirty()) {
+                return true;
+            }
+        }
+        return false;
+    }
+
+    void CPACSDoors::ClearDirty()
+    {
+        m_dirty = false;
+        m_doorsClean.clear();
+        for (std::size_t i = 0; i < m_doors.size(); i++) {
+            m_doorsClean.push_back(m_doors[i].get());
+            m_doors[i]->ClearDirty();
+        }
+    }
+
+    void CPACSDoors::WriteDirtyCPACS(const TixiDocumentHandle& tixiHandle, const std::string& xpath) const
+    {
+        if (m_dirty) {
+            WriteCPACS(tixiHandle, xpath);
+            return;
+        }
+
+        // write modified elements door
+        tixi::TixiSaveDirtyElements(tixiHandle, xpath + "/door", m_doors, m_doorsClean);
+    }
+
     const std::vector<unique_ptr<CPACSDoorCutOut> >& CPACSDoors::GetDoors() const
     {
         return m_doors;
@@ -79,6 +117,7 @@ namespace generated
 
     void CPACSDoors::RemoveDoor(CPACSDoorCutOut& ref)
     {
+        m_dirty = true;
         for (std::size_t i = 0; i < m_doors.size(); i++) {
             if (m_doors[i].get() == &ref) {
                 m_doors.erase(m_doors.begin() + i);
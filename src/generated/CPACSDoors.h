@@ -51,6 +51,10 @@ namespace generated
         TIGL_EXPORT virtual void ReadCPACS(const TixiDocumentHandle& tixiHandle, const std::string& xpath);
         TIGL_EXPORT virtual void WriteCPACS(const TixiDocumentHandle& tixiHandle, const std::string& xpath) const;
 
+        TIGL_EXPORT virtual bool IsDirty() const;
+        TIGL_EXPORT virtual void ClearDirty();
+        TIGL_EXPORT virtual void WriteDirtyCPACS(const TixiDocumentHandle& tixiHandle, const std::string& xpath) const;
+
         TIGL_EXPORT virtual const std::vector<unique_ptr<CPACSDoorCutOut> >& GetDoors() const;
         TIGL_EXPORT virtual std::vector<unique_ptr<CPACSDoorCutOut> >& GetDoors();
 
@@ -62,6 +66,12 @@ namespace generated
 
         std::vector<unique_ptr<CPACSDoorCutOut> > m_doors;
 
+        /// Set by the setters, cleared after the object has been read or written
+        bool m_dirty;
+
+        /// List elements at the last call of ClearDirty
+        std::vector<const CPACSDoorCutOut*> m_doorsClean;
+
     private:
 #ifdef HAVE_CPP11
         CPACSDoors(const CPACSDoors&) = delete;
@@ -25,6 +25,7 @@ namespace tigl
 namespace generated
 {
     CPACSEmissivityMap::CPACSEmissivityMap()
+        : m_dirty(true)
     {
     }
 
@@ -64,6 +65,47 @@ namespace generated
 
     }
 
+    bool CPACSEmissivityMap::IsDirty() const
+    {
+        if (m_dirty) {
+            return true;
+        }
+        if (m_waveLength.IsDirty()) {
+            return true;
+        }
+        if (m_diffuseEmissivity.IsDirty()) {
+            return true;
+        }
+        return false;
+    }
+
+    void CPACSEmissivityMap::ClearDirty()
+    {
+        m_dirty = false;
+        m_waveLength.ClearDirty();
+        m_diffuseEmissivity.ClearDirty();
+    }
+
+    void CPACSEmissivityMap::WriteDirtyCPACS(const TixiDocumentHandle& tixiHandle, const std::string& xpath) const
+    {
+        if (m_dirty) {
+            WriteCPACS(tixiHandle, xpath);
+            return;
+        }
+
+        // write modified element waveLength
+        if (m_waveLength.IsDirty()) {
+            tixi::TixiCreateElementIfNotExists(tixiHandle, xpath + "/waveLength");
+            m_waveLength.WriteDirtyCPACS(tixiHandle, xpath + "/waveLength");
+        }
+
+        // write modified element diffuseEmissivity
+        if (m_diffuseEmissivity.IsDirty()) {
+            tixi::TixiCreateElementIfNotExists(tixiHandle, xpath + "/diffuseEmissivity");
+            m_diffuseEmissivity.WriteDirtyCPACS(tixiHandle, xpath + "/diffuseEmissivity");
+        }
+    }
+
     const CCPACSStringVector& CPACSEmissivityMap::GetWaveLength() const
     {
         return m_waveLength;
@@ -45,6 +45,10 @@ namespace generated
         TIGL_EXPORT virtual void ReadCPACS(const TixiDocumentHandle& tixiHandle, const std::string& xpath);
         TIGL_EXPORT virtual void WriteCPACS(const TixiDocumentHandle& tixiHandle, const std::string& xpath) const;
 
+        TIGL_EXPORT virtual bool IsDirty() const;
+        TIGL_EXPORT virtual void ClearDirty();
+        TIGL_EXPORT virtual void WriteDirtyCPACS(const TixiDocumentHandle& tixiHandle, const std::string& xpath) const;
+
         TIGL_EXPORT virtual const CCPACSStringVector& GetWaveLength() const;
         TIGL_EXPORT virtual CCPACSStringVector& GetWaveLength();
 
@@ -58,6 +62,9 @@ namespace generated
         /// Diffuse emissivity of the material
         CCPACSStringVector m_diffuseEmissivity;
 
+        /// Set by the setters, cleared after the object has been read or written
+        bool m_dirty;
+
     private:
 #ifdef HAVE_CPP11
         CPACSEmissivityMap(const CPACSEmissivityMap&) = delete;
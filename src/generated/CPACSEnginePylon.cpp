@@ -30,6 +30,7 @@ namespace generated
     CPACSEnginePylon::CPACSEnginePylon(CCPACSEnginePylons* parent, CTiglUIDManager* uidMgr)
         : m_uidMgr(uidMgr)
         , m_transformation(m_uidMgr)
+        , m_dirty(true)
     {
         //assert(parent != NULL);
         m_parent = parent;
@@ -63,8 +64,7 @@ namespace generated
     void CPACSEnginePylon::ReadCPACS(const TixiDocumentHandle& tixiHandle, const std::string& xpath)
     {
         // read attribute uID
-        if (tixi::TixiCheckAttribute(tixiHandle, xpath, "uID")) {
-            m_uID = tixi::TixiGetAttribute<std::string>(tixiHandle, xpath, "uID");
+        if (tixi::TixiTryGetAttribute(tixiHandle, xpath, "uID", m_uID)) {
             if (m_uID.empty()) {
                 LOG(WARNING) << "Required attribute uID is empty at xpath " << xpath;
             }
@@ -74,24 +74,21 @@ namespace generated
         }
 
         // read element name
-        if (tixi::TixiCheckElement(tixiHandle, xpath + "/name")) {
-            m_name = tixi::TixiGetElement<std::string>(tixiHandle, xpath + "/name");
+        if (tixi::TixiTryGetElement(tixiHandle, xpath + "/name", m_name)) {
             if (m_name->empty()) {
                 LOG(WARNING) << "Optional element name is present but empty at xpath " << xpath;
             }
         }
 
         // read element description
-        if (tixi::TixiCheckElement(tixiHandle, xpath + "/description")) {
-            m_description = tixi::TixiGetElement<std::string>(tixiHandle, xpath + "/description");
+        if (tixi::TixiTryGetElement(tixiHandle, xpath + "/description", m_description)) {
             if (m_description->empty()) {
                 LOG(WARNING) << "Optional element description is present but empty at xpath " << xpath;
             }
         }
 
         // read element parentUID
-        if (tixi::TixiCheckElement(tixiHandle, xpath + "/parentUID")) {
-            m_parentUID = tixi::TixiGetElement<std::string>(tixiHandle, xpath + "/parentUID");
+        if (tixi::TixiTryGetElement(tixiHandle, xpath + "/parentUID", m_parentUID)) {
             if (m_parentUID.empty()) {
                 LOG(WARNING) << "Required element parentUID is empty at xpath " << xpath;
             }
@@ -214,6 +211,73 @@ namespace generated
 
     }
 
+    bool CPACSEnginePylon::IsDirty() const
+    {
+        if (m_dirty) {
+            return true;
+        }
+        if (m_transformation.IsDirty()) {
+            return true;
+        }
+        if (m_sections && m_sections->IsDirty()) {
+            return true;
+        }
+        if (m_segments && m_segments->IsDirty()) {
+            return true;
+        }
+        if (m_positionings && m_positionings->IsDirty()) {
+            return true;
+        }
+        return false;
+    }
+
+    void CPACSEnginePylon::ClearDirty()
+    {
+        m_dirty = false;
+        m_transformation.ClearDirty();
+        if (m_sections) {
+            m_sections->ClearDirty();
+        }
+        if (m_segments) {
+            m_segments->ClearDirty();
+        }
+        if (m_positionings) {
+            m_positionings->ClearDirty();
+        }
+    }
+
+    void CPACSEnginePylon::WriteDirtyCPACS(const TixiDocumentHandle& tixiHandle, const std::string& xpath) const
+    {
+        if (m_dirty) {
+            WriteCPACS(tixiHandle, xpath);
+            return;
+        }
+
+        // write modified element transformation
+        if (m_transformation.IsDirty()) {
+            tixi::TixiCreateElementIfNotExists(tixiHandle, xpath + "/transformation");
+            m_transformation.WriteDirtyCPACS(tixiHandle, xpath + "/transformation");
+        }
+
+        // write modified element sections
+        if (m_sections && m_sections->IsDirty()) {
+            tixi::TixiCreateElementIfNotExists(tixiHandle, xpath + "/sections");
+            m_sections->WriteDirtyCPACS(tixiHandle, xpath + "/sections");
+        }
+
+        // write modified element segments
+        if (m_segments && m_segments->IsDirty()) {
+            tixi::TixiCreateElementIfNotExists(tixiHandle, xpath + "/segments");
+            m_segments->WriteDirtyCPACS(tixiHandle, xpath + "/segments");
+        }
+
+        // write modified element positionings
+        if (m_positionings && m_positionings->IsDirty()) {
+            tixi::TixiCreateElementIfNotExists(tixiHandle, xpath + "/positionings");
+            m_positionings->WriteDirtyCPACS(tixiHandle, xpath + "/positionings");
+        }
+    }
+
     const std::string& CPACSEnginePylon::GetUID() const
     {
         return m_uID;
@@ -221,6 +285,7 @@ namespace generated
 
     void CPACSEnginePylon::SetUID(const std::string& value)
     {
+        m_dirty = true;
         if (m_uidMgr) {
             m_uidMgr->TryUnregisterObject(m_uID);
             m_uidMgr->RegisterObject(value, *this);
@@ -235,6 +300,7 @@ namespace generated
 
     void CPACSEnginePylon::SetName(const boost::optional<std::string>& value)
     {
+        m_dirty = true;
         m_name = value;
     }
 
@@ -245,6 +311,7 @@ namespace generated
 
     void CPACSEnginePylon::SetDescription(const boost::optional<std::string>& value)
     {
+        m_dirty = true;
         m_description = value;
     }
 
@@ -255,6 +322,7 @@ namespace generated
 
     void CPACSEnginePylon::SetParentUID(const std::string& value)
     {
+        m_dirty = true;
         m_parentUID = value;
     }
 
@@ -307,6 +375,7 @@ namespace generated
 
     void CPACSEnginePylon::RemoveSections()
     {
+        m_dirty = true;
         m_sections = boost::none;
     }
 
@@ -319,6 +388,7 @@ namespace generated
 
     void CPACSEnginePylon::RemoveSegments()
     {
+        m_dirty = true;
         m_segments = boost::none;
     }
 
@@ -331,6 +401,7 @@ namespace generated
 
     void CPACSEnginePylon::RemovePositionings()
     {
+        m_dirty = true;
         m_positionings = boost::none;
     }
 
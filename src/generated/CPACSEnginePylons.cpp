@@ -30,6 +30,7 @@ namespace generated
 {
     CPACSEnginePylons::CPACSEnginePylons(CCPACSAircraftModel* parent, CTiglUIDManager* uidMgr)
         : m_uidMgr(uidMgr)
+        , m_dirty(true)
     {
         //assert(parent != NULL);
         m_parent = parent;
@@ -75,6 +76,43 @@ namespace generated
 
     }
 
+    bool CPACSEnginePylons::IsDirty() const
+    {
+        if (m_dirty) {
+            return true;
+        }
+        if (m_enginePylons.size() != m_enginePylonsClean.size()) {
+            return true;
+        }
+        for (std::size_t i = 0; i < m_enginePylons.size(); i++) {
+            if (m_enginePylons[i].get() != m_enginePylonsClean[i] || m_enginePylons[i]->IsDirty()) {
+                return true;
+            }
+        }
+        return false;
+    }
+
+    void CPACSEnginePylons::ClearDirty()
+    {
+        m_dirty = false;
+        m_enginePylonsClean.clear();
+        for (std::size_t i = 0; i < m_enginePylons.size(); i++) {
+            m_enginePylonsClean.push_back(m_enginePylons[i].get());
+            m_enginePylons[i]->ClearDirty();
+        }
+    }
+
+    void CPACSEnginePylons::WriteDirtyCPACS(const TixiDocumentHandle& tixiHandle, const std::string& xpath) const
+    {
+        if (m_dirty) {
+            WriteCPACS(tixiHandle, xpath);
+            return;
+        }
+
+        // write modified elements enginePylon
+        tixi::TixiSaveDirtyElements(tixiHandle, xpath + "/enginePylon", m_enginePylons, m_enginePylonsClean);
+    }
+
     const std::vector<unique_ptr<CCPACSEnginePylon> >& CPACSEnginePylons::GetEnginePylons() const
     {
         return m_enginePylons;
@@ -93,6 +131,7 @@ namespace generated
 
     void CPACSEnginePylons::RemoveEnginePylon(CCPACSEnginePylon& ref)
     {
+        m_dirty = true;
         for (std::size_t i = 0; i < m_enginePylons.size(); i++) {
             if (m_enginePylons[i].get() == &ref) {
                 m_enginePylons.erase(m_enginePylons.begin() + i);
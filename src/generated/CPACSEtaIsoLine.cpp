@@ -26,6 +26,7 @@ namespace generated
 {
     CPACSEtaIsoLine::CPACSEtaIsoLine()
         : m_eta(0)
+        , m_dirty(true)
     {
     }
 
@@ -36,16 +37,12 @@ namespace generated
     void CPACSEtaIsoLine::ReadCPACS(const TixiDocumentHandle& tixiHandle, const std::string& xpath)
     {
         // read element eta
-        if (tixi::TixiCheckElement(tixiHandle, xpath + "/eta")) {
-            m_eta = tixi::TixiGetElement<double>(tixiHandle, xpath + "/eta");
-        }
-        else {
+        if (!tixi::TixiTryGetElement(tixiHandle, xpath + "/eta", m_eta)) {
             LOG(ERROR) << "Required element eta is missing at xpath " << xpath;
         }
 
         // read element referenceUID
-        if (tixi::TixiCheckElement(tixiHandle, xpath + "/referenceUID")) {
-            m_referenceUID = tixi::TixiGetElement<std::string>(tixiHandle, xpath + "/referenceUID");
+        if (tixi::TixiTryGetElement(tixiHandle, xpath + "/referenceUID", m_referenceUID)) {
             if (m_referenceUID.empty()) {
                 LOG(WARNING) << "Required element referenceUID is empty at xpath " << xpath;
             }
@@ -68,6 +65,23 @@ namespace generated
 
     }
 
+    bool CPACSEtaIsoLine::IsDirty() const
+    {
+        return m_dirty;
+    }
+
+    void CPACSEtaIsoLine::ClearDirty()
+    {
+        m_dirty = false;
+    }
+
+    void CPACSEtaIsoLine::WriteDirtyCPACS(const TixiDocumentHandle& tixiHandle, const std::string& xpath) const
+    {
+        if (m_dirty) {
+            WriteCPACS(tixiHandle, xpath);
+        }
+    }
+
     const double& CPACSEtaIsoLine::GetEta() const
     {
         return m_eta;
@@ -75,6 +89,7 @@ namespace generated
 
     void CPACSEtaIsoLine::SetEta(const double& value)
     {
+        m_dirty = true;
         m_eta = value;
     }
 
@@ -85,6 +100,7 @@ namespace generated
 
     void CPACSEtaIsoLine::SetReferenceUID(const std::string& value)
     {
+        m_dirty = true;
         m_referenceUID = value;
     }
 
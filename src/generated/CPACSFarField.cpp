@@ -27,6 +27,7 @@ namespace generated
     CPACSFarField::CPACSFarField()
         : m_referenceLength(0)
         , m_multiplier(0)
+        , m_dirty(true)
     {
     }
 
@@ -45,18 +46,12 @@ namespace generated
         }
 
         // read element referenceLength
-        if (tixi::TixiCheckElement(tixiHandle, xpath + "/referenceLength")) {
-            m_referenceLength = tixi::TixiGetElement<double>(tixiHandle, xpath + "/referenceLength");
-        }
-        else {
+        if (!tixi::TixiTryGetElement(tixiHandle, xpath + "/referenceLength", m_referenceLength)) {
             LOG(ERROR) << "Required element referenceLength is missing at xpath " << xpath;
         }
 
         // read element multiplier
-        if (tixi::TixiCheckElement(tixiHandle, xpath + "/multiplier")) {
-            m_multiplier = tixi::TixiGetElement<double>(tixiHandle, xpath + "/multiplier");
-        }
-        else {
+        if (!tixi::TixiTryGetElement(tixiHandle, xpath + "/multiplier", m_multiplier)) {
             LOG(ERROR) << "Required element multiplier is missing at xpath " << xpath;
         }
 
@@ -78,6 +73,23 @@ namespace generated
 
     }
 
+    bool CPACSFarField::IsDirty() const
+    {
+        return m_dirty;
+    }
+
+    void CPACSFarField::ClearDirty()
+    {
+        m_dirty = false;
+    }
+
+    void CPACSFarField::WriteDirtyCPACS(const TixiDocumentHandle& tixiHandle, const std::string& xpath) const
+    {
+        if (m_dirty) {
+            WriteCPACS(tixiHandle, xpath);
+        }
+    }
+
     const TiglFarFieldType& CPACSFarField::GetType() const
     {
         return m_type;
@@ -85,6 +97,7 @@ namespace generated
 
     void CPACSFarField::SetType(const TiglFarFieldType& value)
     {
+        m_dirty = true;
         m_type = value;
     }
 
@@ -95,6 +108,7 @@ namespace generated
 
     void CPACSFarField::SetReferenceLength(const double& value)
     {
+        m_dirty = true;
         m_referenceLength = value;
     }
 
@@ -105,6 +119,7 @@ namespace generated
 
     void CPACSFarField::SetMultiplier(const double& value)
     {
+        m_dirty = true;
         m_multiplier = value;
     }
 
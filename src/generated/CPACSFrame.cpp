@@ -30,6 +30,7 @@ namespace generated
 {
     CPACSFrame::CPACSFrame(CCPACSFramesAssembly* parent, CTiglUIDManager* uidMgr)
         : m_uidMgr(uidMgr)
+        , m_dirty(true)
     {
         //assert(parent != NULL);
         m_parent = parent;
@@ -63,8 +64,7 @@ namespace generated
     void CPACSFrame::ReadCPACS(const TixiDocumentHandle& tixiHandle, const std::string& xpath)
     {
         // read attribute uID
-        if (tixi::TixiCheckAttribute(tixiHandle, xpath, "uID")) {
-            m_uID = tixi::TixiGetAttribute<std::string>(tixiHandle, xpath, "uID");
+        if (tixi::TixiTryGetAttribute(tixiHandle, xpath, "uID", m_uID)) {
             if (m_uID.empty()) {
                 LOG(WARNING) << "Required attribute uID is empty at xpath " << xpath;
             }
@@ -91,6 +91,43 @@ namespace generated
 
     }
 
+    bool CPACSFrame::IsDirty() const
+    {
+        if (m_dirty) {
+            return true;
+        }
+        if (m_framePositions.size() != m_framePositionsClean.size()) {
+            return true;
+        }
+        for (std::size_t i = 0; i < m_framePositions.size(); i++) {
+            if (m_framePositions[i].get() != m_framePositionsClean[i] || m_framePositions[i]->IsDirty()) {
+                return true;
+            }
+        }
+        return false;
+    }
+
+    void CPACSFrame::ClearDirty()
+    {
+        m_dirty = false;
+        m_framePositionsClean.clear();
+        for (std::size_t i = 0; i < m_framePositions.size(); i++) {
+            m_framePositionsClean.push_back(m_framePositions[i].get());
+            m_framePositions[i]->ClearDirty();
+        }
+    }
+
+    void CPACSFrame::WriteDirtyCPACS(const TixiDocumentHandle& tixiHandle, const std::string& xpath) const
+    {
+        if (m_dirty) {
+            WriteCPACS(tixiHandle, xpath);
+            return;
+        }
+
+        // write modified elements framePosition
+        tixi::TixiSaveDirtyElements(tixiHandle, xpath + "/framePosition", m_framePositions, m_framePositionsClean);
+    }
+
     const std::string& CPACSFrame::GetUID() const
     {
         return m_uID;
@@ -98,6 +135,7 @@ namespace generated
 
     void CPACSFrame::SetUID(const std::string& value)
     {
+        m_dirty = true;
         if (m_uidMgr) {
             m_uidMgr->TryUnregisterObject(m_uID);
             m_uidMgr->RegisterObject(value, *this);
@@ -123,6 +161,7 @@ namespace generated
 
     void CPACSFrame::RemoveFramePosition(CCPACSFuselageStringerFramePosition& ref)
     {
+        m_dirty = true;
         for (std::size_t i = 0; i < m_framePositions.size(); i++) {
             if (m_framePositions[i].get() == &ref) {
                 m_framePositions.erase(m_framePositions.begin() + i);
@@ -30,6 +30,7 @@ namespace generated
 {
     CPACSFramesAssembly::CPACSFramesAssembly(CCPACSFuselageStructure* parent, CTiglUIDManager* uidMgr)
         : m_uidMgr(uidMgr)
+        , m_dirty(true)
     {
         //assert(parent != NULL);
         m_parent = parent;
@@ -75,6 +76,43 @@ namespace generated
 
     }
 
+    bool CPACSFramesAssembly::IsDirty() const
+    {
+        if (m_dirty) {
+            return true;
+        }
+        if (m_frames.size() != m_framesClean.size()) {
+            return true;
+        }
+        for (std::size_t i = 0; i < m_frames.size(); i++) {
+            if (m_frames[i].get() != m_framesClean[i] || m_frames[i]->IsDirty()) {
+                return true;
+            }
+        }
+        return false;
+    }
+
+    void CPACSFramesAssembly::ClearDirty()
+    {
+        m_dirty = false;
+        m_framesClean.clear();
+        for (std::size_t i = 0; i < m_frames.size(); i++) {
+            m_framesClean.push_back(m_frames[i].get());
+            m_frames[i]->ClearDirty();
+        }
+    }
+
+    void CPACSFramesAssembly::WriteDirtyCPACS(const TixiDocumentHandle& tixiHandle, const std::string& xpath) const
+    {
+        if (m_dirty) {
+            WriteCPACS(tixiHandle, xpath);
+            return;
+        }
+
+        // write modified elements frame
+        tixi::TixiSaveDirtyElements(tixiHandle, xpath + "/frame", m_frames, m_framesClean);
+    }
+
     const std::vector<unique_ptr<CCPACSFrame> >& CPACSFramesAssembly::GetFrames() const
     {
         return m_frames;
@@ -93,6 +131,7 @@ namespace generated
 
     void CPACSFramesAssembly::RemoveFrame(CCPACSFrame& ref)
     {
+        m_dirty = true;
         for (std::size_t i = 0; i < m_frames.size(); i++) {
             if (m_frames[i].get() == &ref) {
                 m_frames.erase(m_frames.begin() + i);
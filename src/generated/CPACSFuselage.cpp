@@ -32,6 +32,7 @@ namespace generated
         , m_transformation(m_uidMgr)
         , m_sections(reinterpret_cast<CCPACSFuselage*>(this), m_uidMgr)
         , m_segments(reinterpret_cast<CCPACSFuselage*>(this), m_uidMgr)
+        , m_dirty(true)
     {
         //assert(parent != NULL);
         m_parent = parent;
@@ -65,8 +66,7 @@ namespace generated
     void CPACSFuselage::ReadCPACS(const TixiDocumentHandle& tixiHandle, const std::string& xpath)
     {
         // read attribute uID
-        if (tixi::TixiCheckAttribute(tixiHandle, xpath, "uID")) {
-            m_uID = tixi::TixiGetAttribute<std::string>(tixiHandle, xpath, "uID");
+        if (tixi::TixiTryGetAttribute(tixiHandle, xpath, "uID", m_uID)) {
             if (m_uID.empty()) {
                 LOG(WARNING) << "Required attribute uID is empty at xpath " << xpath;
             }
@@ -81,8 +81,7 @@ namespace generated
         }
 
         // read element name
-        if (tixi::TixiCheckElement(tixiHandle, xpath + "/name")) {
-            m_name = tixi::TixiGetElement<std::string>(tixiHandle, xpath + "/name");
+        if (tixi::TixiTryGetElement(tixiHandle, xpath + "/name", m_name)) {
             if (m_name.empty()) {
                 LOG(WARNING) << "Required element name is empty at xpath " << xpath;
             }
@@ -92,16 +91,14 @@ namespace generated
         }
 
         // read element description
-        if (tixi::TixiCheckElement(tixiHandle, xpath + "/description")) {
-            m_description = tixi::TixiGetElement<std::string>(tixiHandle, xpath + "/description");
+        if (tixi::TixiTryGetElement(tixiHandle, xpath + "/description", m_description)) {
             if (m_description->empty()) {
                 LOG(WARNING) << "Optional element description is present but empty at xpath " << xpath;
             }
         }
 
         // read element parentUID
-        if (tixi::TixiCheckElement(tixiHandle, xpath + "/parentUID")) {
-            m_parentUID = tixi::TixiGetElement<std::string>(tixiHandle, xpath + "/parentUID");
+        if (tixi::TixiTryGetElement(tixiHandle, xpath + "/parentUID", m_parentUID)) {
             if (m_parentUID->empty()) {
                 LOG(WARNING) << "Optional element parentUID is present but empty at xpath " << xpath;
             }
@@ -233,6 +230,81 @@ namespace generated
 
     }
 
+    bool CPACSFuselage::IsDirty() const
+    {
+        if (m_dirty) {
+            return true;
+        }
+        if (m_transformation.IsDirty()) {
+            return true;
+        }
+        if (m_sections.IsDirty()) {
+            return true;
+        }
+        if (m_positionings && m_positionings->IsDirty()) {
+            return true;
+        }
+        if (m_segments.IsDirty()) {
+            return true;
+        }
+        if (m_structure && m_structure->IsDirty()) {
+            return true;
+        }
+        return false;
+    }
+
+    void CPACSFuselage::ClearDirty()
+    {
+        m_dirty = false;
+        m_transformation.ClearDirty();
+        m_sections.ClearDirty();
+        if (m_positionings) {
+            m_positionings->ClearDirty();
+        }
+        m_segments.ClearDirty();
+        if (m_structure) {
+            m_structure->ClearDirty();
+        }
+    }
+
+    void CPACSFuselage::WriteDirtyCPACS(const TixiDocumentHandle& tixiHandle, const std::string& xpath) const
+    {
+        if (m_dirty) {
+            WriteCPACS(tixiHandle, xpath);
+            return;
+        }
+
+        // write modified element transformation
+        if (m_transformation.IsDirty()) {
+            tixi::TixiCreateElementIfNotExists(tixiHandle, xpath + "/transformation");
+            m_transformation.WriteDirtyCPACS(tixiHandle, xpath + "/transformation");
+        }
+
+        // write modified element sections
+        if (m_sections.IsDirty()) {
+            tixi::TixiCreateElementIfNotExists(tixiHandle, xpath + "/sections");
+            m_sections.WriteDirtyCPACS(tixiHandle, xpath + "/sections");
+        }
+
+        // write modified element positionings
+        if (m_positionings && m_positionings->IsDirty()) {
+            tixi::TixiCreateElementIfNotExists(tixiHandle, xpath + "/positionings");
+            m_positionings->WriteDirtyCPACS(tixiHandle, xpath + "/positionings");
+        }
+
+        // write modified element segments
+        if (m_segments.IsDirty()) {
+            tixi::TixiCreateElementIfNotExists(tixiHandle, xpath + "/segments");
+            m_segments.WriteDirtyCPACS(tixiHandle, xpath + "/segments");
+        }
+
+        // write modified element structure
+        if (m_structure && m_structure->IsDirty()) {
+            tixi::TixiCreateElementIfNotExists(tixiHandle, xpath + "/structure");
+            m_structure->WriteDirtyCPACS(tixiHandle, xpath + "/structure");
+        }
+    }
+
     const std::string& CPACSFuselage::GetUID() const
     {
         return m_uID;
@@ -240,6 +312,7 @@ namespace generated
 
     void CPACSFuselage::SetUID(const std::string& value)
     {
+        m_dirty = true;
         if (m_uidMgr) {
             m_uidMgr->TryUnregisterObject(m_uID);
             m_uidMgr->RegisterObject(value, *this);
@@ -254,6 +327,7 @@ namespace generated
 
     void CPACSFuselage::SetSymmetry(const boost::optional<TiglSymmetryAxis>& value)
     {
+        m_dirty = true;
         m_symmetry = value;
     }
 
@@ -264,6 +338,7 @@ namespace generated
 
     void CPACSFuselage::SetName(const std::string& value)
     {
+        m_dirty = true;
         m_name = value;
     }
 
@@ -274,6 +349,7 @@ namespace generated
 
     void CPACSFuselage::SetDescription(const boost::optional<std::string>& value)
     {
+        m_dirty = true;
         m_description = value;
     }
 
@@ -284,6 +360,7 @@ namespace generated
 
     void CPACSFuselage::SetParentUID(const boost::optional<std::string>& value)
     {
+        m_dirty = true;
         m_parentUID = value;
     }
 
@@ -346,6 +423,7 @@ namespace generated
 
     void CPACSFuselage::RemovePositionings()
     {
+        m_dirty = true;
         m_positionings = boost::none;
     }
 
@@ -358,6 +436,7 @@ namespace generated
 
     void CPACSFuselage::RemoveStructure()
     {
+        m_dirty = true;
         m_structure = boost::none;
     }
 
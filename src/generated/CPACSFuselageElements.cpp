@@ -30,6 +30,7 @@ namespace generated
 {
     CPACSFuselageElements::CPACSFuselageElements(CCPACSFuselageSection* parent, CTiglUIDManager* uidMgr)
         : m_uidMgr(uidMgr)
+        , m_dirty(true)
     {
         //assert(parent != NULL);
         m_parent = parent;
@@ -75,6 +76,43 @@ namespace generated
 
     }
 
+    bool CPACSFuselageElements::IsDirty() const
+    {
+        if (m_dirty) {
+            return true;
+        }
+        if (m_elements.size() != m_elementsClean.size()) {
+            return true;
+        }
+        for (std::size_t i = 0; i < m_elements.size(); i++) {
+            if (m_elements[i].get() != m_elementsClean[i] || m_elements[i]->IsDirty()) {
+                return true;
+            }
+        }
+        return false;
+    }
+
+    void CPACSFuselageElements::ClearDirty()
+    {
+        m_dirty = false;
+        m_elementsClean.clear();
+        for (std::size_t i = 0; i < m_elements.size(); i++) {
+            m_elementsClean.push_back(m_elements[i].get());
+            m_elements[i]->ClearDirty();
+        }
+    }
+
+    void CPACSFuselageElements::WriteDirtyCPACS(const TixiDocumentHandle& tixiHandle, const std::string& xpath) const
+    {
+        if (m_dirty) {
+            WriteCPACS(tixiHandle, xpath);
+            return;
+        }
+
+        // write modified elements element
+        tixi::TixiSaveDirtyElements(tixiHandle, xpath + "/element", m_elements, m_elementsClean);
+    }
+
     const std::vector<unique_ptr<CCPACSFuselageSectionElement> >& CPACSFuselageElements::GetElements() const
     {
         return m_elements;
@@ -93,6 +131,7 @@ namespace generated
 
     void CPACSFuselageElements::RemoveElement(CCPACSFuselageSectionElement& ref)
     {
+        m_dirty = true;
         for (std::size_t i = 0; i < m_elements.size(); i++) {
             if (m_elements[i].get() == &ref) {
                 m_elements.erase(m_elements.begin() + i);
@@ -28,6 +28,7 @@ namespace generated
 {
     CPACSFuselageProfiles::CPACSFuselageProfiles(CTiglUIDManager* uidMgr)
         : m_uidMgr(uidMgr)
+        , m_dirty(true)
     {
     }
 
@@ -61,6 +62,43 @@ namespace generated
 
     }
 
+    bool CPACSFuselageProfiles::IsDirty() const
+    {
+        if (m_dirty) {
+            return true;
+        }
+        if (m_fuselageProfiles.size() != m_fuselageProfilesClean.size()) {
+            return true;
+        }
+        for (std::size_t i = 0; i < m_fuselageProfiles.size(); i++) {
+            if (m_fuselageProfiles[i].get() != m_fuselageProfilesClean[i] || m_fuselageProfiles[i]->IsDirty()) {
+                return true;
+            }
+        }
+        return false;
+    }
+
+    void CPACSFuselageProfiles::ClearDirty()
+    {
+        m_dirty = false;
+        m_fuselageProfilesClean.clear();
+        for (std::size_t i = 0; i < m_fuselageProfiles.size(); i++) {
+            m_fuselageProfilesClean.push_back(m_fuselageProfiles[i].get());
+            m_fuselageProfiles[i]->ClearDirty();
+        }
+    }
+
+    void CPACSFuselageProfiles::WriteDirtyCPACS(const TixiDocumentHandle& tixiHandle, const std::string& xpath) const
+    {
+        if (m_dirty) {
+            WriteCPACS(tixiHandle, xpath);
+            return;
+        }
+
+        // write modified elements fuselageProfile
+        tixi::TixiSaveDirtyElements(tixiHandle, xpath + "/fuselageProfile", m_fuselageProfiles, m_fuselageProfilesClean);
+    }
+
     const std::vector<unique_ptr<CPACSProfileGeometry> >& CPACSFuselageProfiles::GetFuselageProfiles() const
     {
         return m_fuselageProfiles;
@@ -79,6 +117,7 @@ namespace generated
 
     void CPACSFuselageProfiles::RemoveFuselageProfile(CPACSProfileGeometry& ref)
     {
+        m_dirty = true;
         for (std::size_t i = 0; i < m_fuselageProfiles.size(); i++) {
             if (m_fuselageProfiles[i].get() == &ref) {
                 m_fuselageProfiles.erase(m_fuselageProfiles.begin() + i);
@@ -29,6 +29,7 @@ namespace generated
 {
     CPACSFuselageSegment::CPACSFuselageSegment(CCPACSFuselageSegments* parent, CTiglUIDManager* uidMgr)
         : m_uidMgr(uidMgr)
+        , m_dirty(true)
     {
         //assert(parent != NULL);
         m_parent = parent;
@@ -62,8 +63,7 @@ namespace generated
     void CPACSFuselageSegment::ReadCPACS(const TixiDocumentHandle& tixiHandle, const std::string& xpath)
     {
         // read attribute uID
-        if (tixi::TixiCheckAttribute(tixiHandle, xpath, "uID")) {
-            m_uID = tixi::TixiGetAttribute<std::string>(tixiHandle, xpath, "uID");
+        if (tixi::TixiTryGetAttribute(tixiHandle, xpath, "uID", m_uID)) {
             if (m_uID.empty()) {
                 LOG(WARNING) << "Required attribute uID is empty at xpath " << xpath;
             }
@@ -73,8 +73,7 @@ namespace generated
         }
 
         // read element name
-        if (tixi::TixiCheckElement(tixiHandle, xpath + "/name")) {
-            m_name = tixi::TixiGetElement<std::string>(tixiHandle, xpath + "/name");
+        if (tixi::TixiTryGetElement(tixiHandle, xpath + "/name", m_name)) {
             if (m_name.empty()) {
                 LOG(WARNING) << "Required element name is empty at xpath " << xpath;
             }
@@ -84,16 +83,14 @@ namespace generated
         }
 
         // read element description
-        if (tixi::TixiCheckElement(tixiHandle, xpath + "/description")) {
-            m_description = tixi::TixiGetElement<std::string>(tixiHandle, xpath + "/description");
+        if (tixi::TixiTryGetElement(tixiHandle, xpath + "/description", m_description)) {
             if (m_description->empty()) {
                 LOG(WARNING) << "Optional element description is present but empty at xpath " << xpath;
             }
         }
 
         // read element fromElementUID
-        if (tixi::TixiCheckElement(tixiHandle, xpath + "/fromElementUID")) {
-            m_fromElementUID = tixi::TixiGetElement<std::string>(tixiHandle, xpath + "/fromElementUID");
+        if (tixi::TixiTryGetElement(tixiHandle, xpath + "/fromElementUID", m_fromElementUID)) {
             if (m_fromElementUID.empty()) {
                 LOG(WARNING) << "Required element fromElementUID is empty at xpath " << xpath;
             }
@@ -103,8 +100,7 @@ namespace generated
         }
 
         // read element toElementUID
-        if (tixi::TixiCheckElement(tixiHandle, xpath + "/toElementUID")) {
-            m_toElementUID = tixi::TixiGetElement<std::string>(tixiHandle, xpath + "/toElementUID");
+        if (tixi::TixiTryGetElement(tixiHandle, xpath + "/toElementUID", m_toElementUID)) {
             if (m_toElementUID.empty()) {
                 LOG(WARNING) << "Required element toElementUID is empty at xpath " << xpath;
             }
@@ -168,6 +164,39 @@ namespace generated
 
     }
 
+    bool CPACSFuselageSegment::IsDirty() const
+    {
+        if (m_dirty) {
+            return true;
+        }
+        if (m_guideCurves && m_guideCurves->IsDirty()) {
+            return true;
+        }
+        return false;
+    }
+
+    void CPACSFuselageSegment::ClearDirty()
+    {
+        m_dirty = false;
+        if (m_guideCurves) {
+            m_guideCurves->ClearDirty();
+        }
+    }
+
+    void CPACSFuselageSegment::WriteDirtyCPACS(const TixiDocumentHandle& tixiHandle, const std::string& xpath) const
+    {
+        if (m_dirty) {
+            WriteCPACS(tixiHandle, xpath);
+            return;
+        }
+
+        // write modified element guideCurves
+        if (m_guideCurves && m_guideCurves->IsDirty()) {
+            tixi::TixiCreateElementIfNotExists(tixiHandle, xpath + "/guideCurves");
+            m_guideCurves->WriteDirtyCPACS(tixiHandle, xpath + "/guideCurves");
+        }
+    }
+
     const std::string& CPACSFuselageSegment::GetUID() const
     {
         return m_uID;
@@ -175,6 +204,7 @@ namespace generated
 
     void CPACSFuselageSegment::SetUID(const std::string& value)
     {
+        m_dirty = true;
         if (m_uidMgr) {
             m_uidMgr->TryUnregisterObject(m_uID);
             m_uidMgr->RegisterObject(value, *this);
@@ -189,6 +219,7 @@ namespace generated
 
     void CPACSFuselageSegment::SetName(const std::string& value)
     {
+        m_dirty = true;
         m_name = value;
     }
 
@@ -199,6 +230,7 @@ namespace generated
 
     void CPACSFuselageSegment::SetDescription(const boost::optional<std::string>& value)
     {
+        m_dirty = true;
         m_description = value;
     }
 
@@ -209,6 +241,7 @@ namespace generated
 
     void CPACSFuselageSegment::SetFromElementUID(const std::string& value)
     {
+        m_dirty = true;
         m_fromElementUID = value;
     }
 
@@ -219,6 +252,7 @@ namespace generated
 
     void CPACSFuselageSegment::SetToElementUID(const std::string& value)
     {
+        m_dirty = true;
         m_toElementUID = value;
     }
 
@@ -241,6 +275,7 @@ namespace generated
 
     void CPACSFuselageSegment::RemoveGuideCurves()
     {
+        m_dirty = true;
         m_guideCurves = boost::none;
     }
 
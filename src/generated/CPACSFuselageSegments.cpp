@@ -30,6 +30,7 @@ namespace generated
 {
     CPACSFuselageSegments::CPACSFuselageSegments(CCPACSFuselage* parent, CTiglUIDManager* uidMgr)
         : m_uidMgr(uidMgr)
+        , m_dirty(true)
     {
         //assert(parent != NULL);
         m_parent = parent;
@@ -75,6 +76,43 @@ namespace generated
 
     }
 
+    bool CPACSFuselageSegments::IsDirty() const
+    {
+        if (m_dirty) {
+            return true;
+        }
+        if (m_segments.size() != m_segmentsClean.size()) {
+            return true;
+        }
+        for (std::size_t i = 0; i < m_segments.size(); i++) {
+            if (m_segments[i].get() != m_segmentsClean[i] || m_segments[i]->IsDirty()) {
+                return true;
+            }
+        }
+        return false;
+    }
+
+    void CPACSFuselageSegments::ClearDirty()
+    {
+        m_dirty = false;
+        m_segmentsClean.clear();
+        for (std::size_t i = 0; i < m_segments.size(); i++) {
+            m_segmentsClean.push_back(m_segments[i].get());
+            m_segments[i]->ClearDirty();
+        }
+    }
+
+    void CPACSFuselageSegments::WriteDirtyCPACS(const TixiDocumentHandle& tixiHandle, const std::string& xpath) const
+    {
+        if (m_dirty) {
+            WriteCPACS(tixiHandle, xpath);
+            return;
+        }
+
+        // write modified elements segment
+        tixi::TixiSaveDirtyElements(tixiHandle, xpath + "/segment", m_segments, m_segmentsClean);
+    }
+
     const std::vector<unique_ptr<CCPACSFuselageSegment> >& CPACSFuselageSegments::GetSegments() const
     {
         return m_segments;
@@ -93,6 +131,7 @@ namespace generated
 
     void CPACSFuselageSegments::RemoveSegment(CCPACSFuselageSegment& ref)
     {
+        m_dirty = true;
         for (std::size_t i = 0; i < m_segments.size(); i++) {
             if (m_segments[i].get() == &ref) {
                 m_segments.erase(m_segments.begin() + i);
@@ -29,6 +29,7 @@ namespace generated
 {
     CPACSFuselageStructure::CPACSFuselageStructure(CCPACSFuselage* parent, CTiglUIDManager* uidMgr)
         : m_uidMgr(uidMgr)
+        , m_dirty(true)
     {
         //assert(parent != NULL);
         m_parent = parent;
@@ -242,6 +243,123 @@ namespace generated
 
     }
 
+    bool CPACSFuselageStructure::IsDirty() const
+    {
+        if (m_dirty) {
+            return true;
+        }
+        if (m_skin && m_skin->IsDirty()) {
+            return true;
+        }
+        if (m_stringers && m_stringers->IsDirty()) {
+            return true;
+        }
+        if (m_frames && m_frames->IsDirty()) {
+            return true;
+        }
+        if (m_cargoCrossBeams && m_cargoCrossBeams->IsDirty()) {
+            return true;
+        }
+        if (m_cargoCrossBeamStruts && m_cargoCrossBeamStruts->IsDirty()) {
+            return true;
+        }
+        if (m_longFloorBeams && m_longFloorBeams->IsDirty()) {
+            return true;
+        }
+        if (m_pressureBulkheads && m_pressureBulkheads->IsDirty()) {
+            return true;
+        }
+        if (m_cargoDoors && m_cargoDoors->IsDirty()) {
+            return true;
+        }
+        return false;
+    }
+
+    void CPACSFuselageStructure::ClearDirty()
+    {
+        m_dirty = false;
+        if (m_skin) {
+            m_skin->ClearDirty();
+        }
+        if (m_stringers) {
+            m_stringers->ClearDirty();
+        }
+        if (m_frames) {
+            m_frames->ClearDirty();
+        }
+        if (m_cargoCrossBeams) {
+            m_cargoCrossBeams->ClearDirty();
+        }
+        if (m_cargoCrossBeamStruts) {
+            m_cargoCrossBeamStruts->ClearDirty();
+        }
+        if (m_longFloorBeams) {
+            m_longFloorBeams->ClearDirty();
+        }
+        if (m_pressureBulkheads) {
+            m_pressureBulkheads->ClearDirty();
+        }
+        if (m_cargoDoors) {
+            m_cargoDoors->ClearDirty();
+        }
+    }
+
+    void CPACSFuselageStructure::WriteDirtyCPACS(const TixiDocumentHandle& tixiHandle, const std::string& xpath) const
+    {
+        if (m_dirty) {
+            WriteCPACS(tixiHandle, xpath);
+            return;
+        }
+
+        // write modified element skin
+        if (m_skin && m_skin->IsDirty()) {
+            tixi::TixiCreateElementIfNotExists(tixiHandle, xpath + "/skin");
+            m_skin->WriteDirtyCPACS(tixiHandle, xpath + "/skin");
+        }
+
+        // write modified element stringers
+        if (m_stringers && m_stringers->IsDirty()) {
+            tixi::TixiCreateElementIfNotExists(tixiHandle, xpath + "/stringers");
+            m_stringers->WriteDirtyCPACS(tixiHandle, xpath + "/stringers");
+        }
+
+        // write modified element frames
+        if (m_frames && m_frames->IsDirty()) {
+            tixi::TixiCreateElementIfNotExists(tixiHandle, xpath + "/frames");
+            m_frames->WriteDirtyCPACS(tixiHandle, xpath + "/frames");
+        }
+
+        // write modified element cargoCrossBeams
+        if (m_cargoCrossBeams && m_cargoCrossBeams->IsDirty()) {
+            tixi::TixiCreateElementIfNotExists(tixiHandle, xpath + "/cargoCrossBeams");
+            m_cargoCrossBeams->WriteDirtyCPACS(tixiHandle, xpath + "/cargoCrossBeams");
+        }
+
+        // write modified element cargoCrossBeamStruts
+        if (m_cargoCrossBeamStruts && m_cargoCrossBeamStruts->IsDirty()) {
+            tixi::TixiCreateElementIfNotExists(tixiHandle, xpath + "/cargoCrossBeamStruts");
+            m_cargoCrossBeamStruts->WriteDirtyCPACS(tixiHandle, xpath + "/cargoCrossBeamStruts");
+        }
+
+        // write modified element longFloorBeams
+        if (m_longFloorBeams && m_longFloorBeams->IsDirty()) {
+            tixi::TixiCreateElementIfNotExists(tixiHandle, xpath + "/longFloorBeams");
+            m_longFloorBeams->WriteDirtyCPACS(tixiHandle, xpath + "/longFloorBeams");
+        }
+
+        // write modified element pressureBulkheads
+        if (m_pressureBulkheads && m_pressureBulkheads->IsDirty()) {
+            tixi::TixiCreateElementIfNotExists(tixiHandle, xpath + "/pressureBulkheads");
+            m_pressureBulkheads->WriteDirtyCPACS(tixiHandle, xpath + "/pressureBulkheads");
+        }
+
+        // write modified element cargoDoors
+        if (m_cargoDoors && m_cargoDoors->IsDirty()) {
+            tixi::TixiCreateElementIfNotExists(tixiHandle, xpath + "/cargoDoors");
+            m_cargoDoors->WriteDirtyCPACS(tixiHandle, xpath + "/cargoDoors");
+        }
+    }
+
     const boost::optional<CPACSSkin>& CPACSFuselageStructure::GetSkin() const
     {
         return m_skin;
@@ -331,6 +449,7 @@ namespace generated
 
     void CPACSFuselageStructure::RemoveSkin()
     {
+        m_dirty = true;
         m_skin = boost::none;
     }
 
@@ -343,6 +462,7 @@ namespace generated
 
     void CPACSFuselageStructure::RemoveStringers()
     {
+        m_dirty = true;
         m_stringers = boost::none;
     }
 
@@ -355,6 +475,7 @@ namespace generated
 
     void CPACSFuselageStructure::RemoveFrames()
     {
+        m_dirty = true;
         m_frames = boost::none;
     }
 
@@ -367,6 +488,7 @@ namespace generated
 
     void CPACSFuselageStructure::RemoveCargoCrossBeams()
     {
+        m_dirty = true;
         m_cargoCrossBeams = boost::none;
     }
 
@@ -379,6 +501,7 @@ namespace generated
 
     void CPACSFuselageStructure::RemoveCargoCrossBeamStruts()
     {
+        m_dirty = true;
         m_cargoCrossBeamStruts = boost::none;
     }
 
@@ -391,6 +514,7 @@ namespace generated
 
     void CPACSFuselageStructure::RemoveLongFloorBeams()
     {
+        m_dirty = true;
         m_longFloorBeams = boost::none;
     }
 
@@ -403,6 +527,7 @@ namespace generated
 
     void CPACSFuselageStructure::RemovePressureBulkheads()
     {
+        m_dirty = true;
         m_pressureBulkheads = boost::none;
     }
 
@@ -415,6 +540,7 @@ namespace generated
 
     void CPACSFuselageStructure::RemoveCargoDoors()
     {
+        m_dirty = true;
         m_cargoDoors = boost::none;
     }
 
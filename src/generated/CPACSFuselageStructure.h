@@ -65,6 +65,10 @@ namespace generated
         TIGL_EXPORT virtual void ReadCPACS(const TixiDocumentHandle& tixiHandle, const std::string& xpath);
         TIGL_EXPORT virtual void WriteCPACS(const TixiDocumentHandle& tixiHandle, const std::string& xpath) const;
 
+        TIGL_EXPORT virtual bool IsDirty() const;
+        TIGL_EXPORT virtual void ClearDirty();
+        TIGL_EXPORT virtual void WriteDirtyCPACS(const TixiDocumentHandle& tixiHandle, const std::string& xpath) const;
+
         TIGL_EXPORT virtual const boost::optional<CPACSSkin>& GetSkin() const;
         TIGL_EXPORT virtual boost::optional<CPACSSkin>& GetSkin();
 
@@ -127,6 +131,9 @@ namespace generated
         boost::optional<CCPACSPressureBulkheadAssembly>     m_pressureBulkheads;
         boost::optional<CPACSCargoDoorsAssembly>            m_cargoDoors;
 
+        /// Set by the setters, cleared after the object has been read or written
+        bool m_dirty;
+
     private:
 #ifdef HAVE_CPP11
         CPACSFuselageStructure(const CPACSFuselageStructure&) = delete;
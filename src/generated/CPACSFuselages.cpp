@@ -31,6 +31,7 @@ namespace generated
 {
     CPACSFuselages::CPACSFuselages(CCPACSAircraftModel* parent, CTiglUIDManager* uidMgr)
         : m_uidMgr(uidMgr)
+        , m_dirty(true)
     {
         //assert(parent != NULL);
         m_parent = parent;
@@ -39,6 +40,7 @@ namespace generated
 
     CPACSFuselages::CPACSFuselages(CCPACSRotorcraftModel* parent, CTiglUIDManager* uidMgr)
         : m_uidMgr(uidMgr)
+        , m_dirty(true)
     {
         //assert(parent != NULL);
         m_parent = parent;
@@ -75,6 +77,43 @@ namespace generated
 
     }
 
+    bool CPACSFuselages::IsDirty() const
+    {
+        if (m_dirty) {
+            return true;
+        }
+        if (m_fuselages.size() != m_fuselagesClean.size()) {
+            return true;
+        }
+        for (std::size_t i = 0; i < m_fuselages.size(); i++) {
+            if (m_fuselages[i].get() != m_fuselagesClean[i] || m_fuselages[i]->IsDirty()) {
+                return true;
+            }
+        }
+        return false;
+    }
+
+    void CPACSFuselages::ClearDirty()
+    {
+        m_dirty = false;
+        m_fuselagesClean.clear();
+        for (std::size_t i = 0; i < m_fuselages.size(); i++) {
+            m_fuselagesClean.push_back(m_fuselages[i].get());
+            m_fuselages[i]->ClearDirty();
+        }
+    }
+
+    void CPACSFuselages::WriteDirtyCPACS(const TixiDocumentHandle& tixiHandle, const std::string& xpath) const
+    {
+        if (m_dirty) {
+            WriteCPACS(tixiHandle, xpath);
+            return;
+        }
+
+        // write modified elements fuselage
+        tixi::TixiSaveDirtyElements(tixiHandle, xpath + "/fuselage", m_fuselages, m_fuselagesClean);
+    }
+
     const std::vector<unique_ptr<CCPACSFuselage> >& CPACSFuselages::GetFuselages() const
     {
         return m_fuselages;
@@ -93,6 +132,7 @@ namespace generated
 
     void CPACSFuselages::RemoveFuselage(CCPACSFuselage& ref)
     {
+        m_dirty = true;
         for (std::size_t i = 0; i < m_fuselages.size(); i++) {
             if (m_fuselages[i].get() == &ref) {
                 m_fuselages.erase(m_fuselages.begin() + i);
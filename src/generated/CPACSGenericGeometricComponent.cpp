@@ -30,6 +30,7 @@ namespace generated
     CPACSGenericGeometricComponent::CPACSGenericGeometricComponent(CCPACSExternalObjects* parent, CTiglUIDManager* uidMgr)
         : m_uidMgr(uidMgr)
         , m_transformation(m_uidMgr)
+        , m_dirty(true)
     {
         //assert(parent != NULL);
         m_parent = parent;
@@ -63,8 +64,7 @@ namespace generated
     void CPACSGenericGeometricComponent::ReadCPACS(const TixiDocumentHandle& tixiHandle, const std::string& xpath)
     {
         // read attribute uID
-        if (tixi::TixiCheckAttribute(tixiHandle, xpath, "uID")) {
-            m_uID = tixi::TixiGetAttribute<std::string>(tixiHandle, xpath, "uID");
+        if (tixi::TixiTryGetAttribute(tixiHandle, xpath, "uID", m_uID)) {
             if (m_uID.empty()) {
                 LOG(WARNING) << "Required attribute uID is empty at xpath " << xpath;
             }
@@ -79,8 +79,7 @@ namespace generated
         }
 
         // read element name
-        if (tixi::TixiCheckElement(tixiHandle, xpath + "/name")) {
-            m_name = tixi::TixiGetElement<std::string>(tixiHandle, xpath + "/name");
+        if (tixi::TixiTryGetElement(tixiHandle, xpath + "/name", m_name)) {
             if (m_name.empty()) {
                 LOG(WARNING) << "Required element name is empty at xpath " << xpath;
             }
@@ -90,16 +89,14 @@ namespace generated
         }
 
         // read element description
-        if (tixi::TixiCheckElement(tixiHandle, xpath + "/description")) {
-            m_description = tixi::TixiGetElement<std::string>(tixiHandle, xpath + "/description");
+        if (tixi::TixiTryGetElement(tixiHandle, xpath + "/description", m_description)) {
             if (m_description->empty()) {
                 LOG(WARNING) << "Optional element description is present but empty at xpath " << xpath;
             }
         }
 
         // read element parentUID
-        if (tixi::TixiCheckElement(tixiHandle, xpath + "/parentUID")) {
-            m_parentUID = tixi::TixiGetElement<std::string>(tixiHandle, xpath + "/parentUID");
+        if (tixi::TixiTryGetElement(tixiHandle, xpath + "/parentUID", m_parentUID)) {
             if (m_parentUID->empty()) {
                 LOG(WARNING) << "Optional element parentUID is present but empty at xpath " << xpath;
             }
@@ -175,6 +172,47 @@ namespace generated
 
     }
 
+    bool CPACSGenericGeometricComponent::IsDirty() const
+    {
+        if (m_dirty) {
+            return true;
+        }
+        if (m_transformation.IsDirty()) {
+            return true;
+        }
+        if (m_linkToFile.IsDirty()) {
+            return true;
+        }
+        return false;
+    }
+
+    void CPACSGenericGeometricComponent::ClearDirty()
+    {
+        m_dirty = false;
+        m_transformation.ClearDirty();
+        m_linkToFile.ClearDirty();
+    }
+
+    void CPACSGenericGeometricComponent::WriteDirtyCPACS(const TixiDocumentHandle& tixiHandle, const std::string& xpath) const
+    {
+        if (m_dirty) {
+            WriteCPACS(tixiHandle, xpath);
+            return;
+        }
+
+        // write modified element transformation
+        if (m_transformation.IsDirty()) {
+            tixi::TixiCreateElementIfNotExists(tixiHandle, xpath + "/transformation");
+            m_transformation.WriteDirtyCPACS(tixiHandle, xpath + "/transformation");
+        }
+
+        // write modified element linkToFile
+        if (m_linkToFile.IsDirty()) {
+            tixi::TixiCreateElementIfNotExists(tixiHandle, xpath + "/linkToFile");
+            m_linkToFile.WriteDirtyCPACS(tixiHandle, xpath + "/linkToFile");
+        }
+    }
+
     const std::string& CPACSGenericGeometricComponent::GetUID() const
     {
         return m_uID;
@@ -182,6 +220,7 @@ namespace generated
 
     void CPACSGenericGeometricComponent::SetUID(const std::string& value)
     {
+        m_dirty = true;
         if (m_uidMgr) {
             m_uidMgr->TryUnregisterObject(m_uID);
             m_uidMgr->RegisterObject(value, *this);
@@ -196,6 +235,7 @@ namespace generated
 
     void CPACSGenericGeometricComponent::SetSymmetry(const boost::optional<TiglSymmetryAxis>& value)
     {
+        m_dirty = true;
         m_symmetry = value;
     }
 
@@ -206,6 +246,7 @@ namespace generated
 
     void CPACSGenericGeometricComponent::SetName(const std::string& value)
     {
+        m_dirty = true;
         m_name = value;
     }
 
@@ -216,6 +257,7 @@ namespace generated
 
     void CPACSGenericGeometricComponent::SetDescription(const boost::optional<std::string>& value)
     {
+        m_dirty = true;
         m_description = value;
     }
 
@@ -226,6 +268,7 @@ namespace generated
 
     void CPACSGenericGeometricComponent::SetParentUID(const boost::optional<std::string>& value)
     {
+        m_dirty = true;
         m_parentUID = value;
     }
 
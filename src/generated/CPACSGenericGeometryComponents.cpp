@@ -30,6 +30,7 @@ namespace generated
 {
     CPACSGenericGeometryComponents::CPACSGenericGeometryComponents(CCPACSAircraftModel* parent, CTiglUIDManager* uidMgr)
         : m_uidMgr(uidMgr)
+        , m_dirty(true)
     {
         //assert(parent != NULL);
         m_parent = parent;
@@ -75,6 +76,43 @@ namespace generated
 
     }
 
+    bool CPACSGenericGeometryComponents::IsDirty() const
+    {
+        if (m_dirty) {
+            return true;
+        }
+        if (m_genericGeometryComponents.size() != m_genericGeometryComponentsClean.size()) {
+            return true;
+        }
+        for (std::size_t i = 0; i < m_genericGeometryComponents.size(); i++) {
+            if (m_genericGeometryComponents[i].get() != m_genericGeometryComponentsClean[i] || m_genericGeometryComponents[i]->IsDirty()) {
+                return true;
+            }
+        }
+        return false;
+    }
+
+    void CPACSGenericGeometryComponents::ClearDirty()
+    {
+        m_dirty = false;
+        m_genericGeometryComponentsClean.clear();
+        for (std::size_t i = 0; i < m_genericGeometryComponents.size(); i++) {
+            m_genericGeometryComponentsClean.push_back(m_genericGeometryComponents[i].get());
+            m_genericGeometryComponents[i]->ClearDirty();
+        }
+    }
+
+    void CPACSGenericGeometryComponents::WriteDirtyCPACS(const TixiDocumentHandle& tixiHandle, const std::string& xpath) const
+    {
+        if (m_dirty) {
+            WriteCPACS(tixiHandle, xpath);
+            return;
+        }
+
+        // write modified elements genericGeometryComponent
+        tixi::TixiSaveDirtyElements(tixiHandle, xpath + "/genericGeometryComponent", m_genericGeometryComponents, m_genericGeometryComponentsClean);
+    }
+
     const std::vector<unique_ptr<CCPACSExternalObject> >& CPACSGenericGeometryComponents::GetGenericGeometryComponents() const
     {
         return m_genericGeometryComponents;
@@ -93,6 +131,7 @@ namespace generated
 
     void CPACSGenericGeometryComponents::RemoveGenericGeometryComponent(CCPACSExternalObject& ref)
     {
+        m_dirty = true;
         for (std::size_t i = 0; i < m_genericGeometryComponents.size(); i++) {
             if (m_genericGeometryComponents[i].get() == &ref) {
                 m_genericGeometryComponents.erase(m_genericGeometryComponents.begin() + i);
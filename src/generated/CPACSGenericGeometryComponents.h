@@ -56,6 +56,10 @@ namespace generated
         TIGL_EXPORT virtual void ReadCPACS(const TixiDocumentHandle& tixiHandle, const std::string& xpath);
         TIGL_EXPORT virtual void WriteCPACS(const TixiDocumentHandle& tixiHandle, const std::string& xpath) const;
 
+        TIGL_EXPORT virtual bool IsDirty() const;
+        TIGL_EXPORT virtual void ClearDirty();
+        TIGL_EXPORT virtual void WriteDirtyCPACS(const TixiDocumentHandle& tixiHandle, const std::string& xpath) const;
+
         TIGL_EXPORT virtual const std::vector<unique_ptr<CCPACSExternalObject> >& GetGenericGeometryComponents() const;
         TIGL_EXPORT virtual std::vector<unique_ptr<CCPACSExternalObject> >& GetGenericGeometryComponents();
 
@@ -69,6 +73,12 @@ namespace generated
 
         std::vector<unique_ptr<CCPACSExternalObject> > m_genericGeometryComponents;
 
+        /// Set by the setters, cleared after the object has been read or written
+        bool m_dirty;
+
+        /// List elements at the last call of ClearDirty
+        std::vector<const CCPACSExternalObject*> m_genericGeometryComponentsClean;
+
     private:
 #ifdef HAVE_CPP11
         CPACSGenericGeometryComponents(const CPACSGenericGeometryComponents&) = delete;
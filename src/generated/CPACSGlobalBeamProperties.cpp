@@ -30,6 +30,7 @@ namespace generated
         , m_consistancy(0)
         , m_beamCrossSection(m_uidMgr)
         , m_beamCOG(m_uidMgr)
+        , m_dirty(true)
     {
     }
 
@@ -51,8 +52,7 @@ namespace generated
     void CPACSGlobalBeamProperties::ReadCPACS(const TixiDocumentHandle& tixiHandle, const std::string& xpath)
     {
         // read attribute uID
-        if (tixi::TixiCheckAttribute(tixiHandle, xpath, "uID")) {
-            m_uID = tixi::TixiGetAttribute<std::string>(tixiHandle, xpath, "uID");
+        if (tixi::TixiTryGetAttribute(tixiHandle, xpath, "uID", m_uID)) {
             if (m_uID.empty()) {
                 LOG(WARNING) << "Required attribute uID is empty at xpath " << xpath;
             }
@@ -62,8 +62,7 @@ namespace generated
         }
 
         // read element source
-        if (tixi::TixiCheckElement(tixiHandle, xpath + "/source")) {
-            m_source = tixi::TixiGetElement<std::string>(tixiHandle, xpath + "/source");
+        if (tixi::TixiTryGetElement(tixiHandle, xpath + "/source", m_source)) {
             if (m_source.empty()) {
                 LOG(WARNING) << "Required element source is empty at xpath " << xpath;
             }
@@ -73,10 +72,7 @@ namespace generated
         }
 
         // read element consistancy
-        if (tixi::TixiCheckElement(tixiHandle, xpath + "/consistancy")) {
-            m_consistancy = tixi::TixiGetElement<bool>(tixiHandle, xpath + "/consistancy");
-        }
-        else {
+        if (!tixi::TixiTryGetElement(tixiHandle, xpath + "/consistancy", m_consistancy)) {
             LOG(ERROR) << "Required element consistancy is missing at xpath " << xpath;
         }
 
@@ -119,9 +115,7 @@ namespace generated
         }
 
         // read element beamSpecificMass
-        if (tixi::TixiCheckElement(tixiHandle, xpath + "/beamSpecificMass")) {
-            m_beamSpecificMass = tixi::TixiGetElement<double>(tixiHandle, xpath + "/beamSpecificMass");
-        }
+        tixi::TixiTryGetElement(tixiHandle, xpath + "/beamSpecificMass", m_beamSpecificMass);
 
         if (m_uidMgr && !m_uID.empty()) m_uidMgr->RegisterObject(m_uID, *this);
     }
@@ -182,6 +176,71 @@ namespace generated
 
     }
 
+    bool CPACSGlobalBeamProperties::IsDirty() const
+    {
+        if (m_dirty) {
+            return true;
+        }
+        if (m_beamCrossSection.IsDirty()) {
+            return true;
+        }
+        if (m_beamCOG.IsDirty()) {
+            return true;
+        }
+        if (m_beamShearCenter && m_beamShearCenter->IsDirty()) {
+            return true;
+        }
+        if (m_beamStiffness && m_beamStiffness->IsDirty()) {
+            return true;
+        }
+        return false;
+    }
+
+    void CPACSGlobalBeamProperties::ClearDirty()
+    {
+        m_dirty = false;
+        m_beamCrossSection.ClearDirty();
+        m_beamCOG.ClearDirty();
+        if (m_beamShearCenter) {
+            m_beamShearCenter->ClearDirty();
+        }
+        if (m_beamStiffness) {
+            m_beamStiffness->ClearDirty();
+        }
+    }
+
+    void CPACSGlobalBeamProperties::WriteDirtyCPACS(const TixiDocumentHandle& tixiHandle, const std::string& xpath) const
+    {
+        if (m_dirty) {
+            WriteCPACS(tixiHandle, xpath);
+            return;
+        }
+
+        // write modified element beamCrossSection
+        if (m_beamCrossSection.IsDirty()) {
+            tixi::TixiCreateElementIfNotExists(tixiHandle, xpath + "/beamCrossSection");
+            m_beamCrossSection.WriteDirtyCPACS(tixiHandle, xpath + "/beamCrossSection");
+        }
+
+        // write modified element beamCOG
+        if (m_beamCOG.IsDirty()) {
+            tixi::TixiCreateElementIfNotExists(tixiHandle, xpath + "/beamCOG");
+            m_beamCOG.WriteDirtyCPACS(tixiHandle, xpath + "/beamCOG");
+        }
+
+        // write modified element beamShearCenter
+        if (m_beamShearCenter && m_beamShearCenter->IsDirty()) {
+            tixi::TixiCreateElementIfNotExists(tixiHandle, xpath + "/beamShearCenter");
+            m_beamShearCenter->WriteDirtyCPACS(tixiHandle, xpath + "/beamShearCenter");
+        }
+
+        // write modified element beamStiffness
+        if (m_beamStiffness && m_beamStiffness->IsDirty()) {
+            tixi::TixiCreateElementIfNotExists(tixiHandle, xpath + "/beamStiffness");
+            m_beamStiffness->WriteDirtyCPACS(tixiHandle, xpath + "/beamStiffness");
+        }
+    }
+
     const std::string& CPACSGlobalBeamProperties::GetUID() const
     {
         return m_uID;
@@ -189,6 +248,7 @@ namespace generated
 
     void CPACSGlobalBeamProperties::SetUID(const std::string& value)
     {
+        m_dirty = true;
         if (m_uidMgr) {
             m_uidMgr->TryUnregisterObject(m_uID);
             m_uidMgr->RegisterObject(value, *this);
@@ -203,6 +263,7 @@ namespace generated
 
     void CPACSGlobalBeamProperties::SetSource(const std::string& value)
     {
+        m_dirty = true;
         m_source = value;
     }
 
@@ -213,6 +274,7 @@ namespace generated
 
     void CPACSGlobalBeamProperties::SetConsistancy(const bool& value)
     {
+        m_dirty = true;
         m_consistancy = value;
     }
 
@@ -263,6 +325,7 @@ namespace generated
 
     void CPACSGlobalBeamProperties::SetBeamSpecificMass(const boost::optional<double>& value)
     {
+        m_dirty = true;
         m_beamSpecificMass = value;
     }
 
@@ -275,6 +338,7 @@ namespace generated
 
     void CPACSGlobalBeamProperties::RemoveBeamShearCenter()
     {
+        m_dirty = true;
         m_beamShearCenter = boost::none;
     }
 
@@ -287,6 +351,7 @@ namespace generated
 
     void CPACSGlobalBeamProperties::RemoveBeamStiffness()
     {
+        m_dirty = true;
         m_beamStiffness = boost::none;
     }
 
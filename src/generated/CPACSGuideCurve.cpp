@@ -28,6 +28,7 @@ namespace generated
     CPACSGuideCurve::CPACSGuideCurve(CTiglUIDManager* uidMgr)
         : m_uidMgr(uidMgr)
         , m_toRelativeCircumference(0)
+        , m_dirty(true)
     {
     }
 
@@ -49,8 +50,7 @@ namespace generated
     void CPACSGuideCurve::ReadCPACS(const TixiDocumentHandle& tixiHandle, const std::string& xpath)
     {
         // read attribute uID
-        if (tixi::TixiCheckAttribute(tixiHandle, xpath, "uID")) {
-            m_uID = tixi::TixiGetAttribute<std::string>(tixiHandle, xpath, "uID");
+        if (tixi::TixiTryGetAttribute(tixiHandle, xpath, "uID", m_uID)) {
             if (m_uID.empty()) {
                 LOG(WARNING) << "Required attribute uID is empty at xpath " << xpath;
             }
@@ -60,8 +60,7 @@ namespace generated
         }
 
         // read element name
-        if (tixi::TixiCheckElement(tixiHandle, xpath + "/name")) {
-            m_name = tixi::TixiGetElement<std::string>(tixiHandle, xpath + "/name");
+        if (tixi::TixiTryGetElement(tixiHandle, xpath + "/name", m_name)) {
             if (m_name.empty()) {
                 LOG(WARNING) << "Required element name is empty at xpath " << xpath;
             }
@@ -71,16 +70,14 @@ namespace generated
         }
 
         // read element description
-        if (tixi::TixiCheckElement(tixiHandle, xpath + "/description")) {
-            m_description = tixi::TixiGetElement<std::string>(tixiHandle, xpath + "/description");
+        if (tixi::TixiTryGetElement(tixiHandle, xpath + "/description", m_description)) {
             if (m_description->empty()) {
                 LOG(WARNING) << "Optional element description is present but empty at xpath " << xpath;
             }
         }
 
         // read element guideCurveProfileUID
-        if (tixi::TixiCheckElement(tixiHandle, xpath + "/guideCurveProfileUID")) {
-            m_guideCurveProfileUID = tixi::TixiGetElement<std::string>(tixiHandle, xpath + "/guideCurveProfileUID");
+        if (tixi::TixiTryGetElement(tixiHandle, xpath + "/guideCurveProfileUID", m_guideCurveProfileUID)) {
             if (m_guideCurveProfileUID.empty()) {
                 LOG(WARNING) << "Required element guideCurveProfileUID is empty at xpath " << xpath;
             }
@@ -101,8 +98,7 @@ namespace generated
         }
 
         // read element fromGuideCurveUID
-        if (tixi::TixiCheckElement(tixiHandle, xpath + "/fromGuideCurveUID")) {
-            m_fromGuideCurveUID_choice1 = tixi::TixiGetElement<std::string>(tixiHandle, xpath + "/fromGuideCurveUID");
+        if (tixi::TixiTryGetElement(tixiHandle, xpath + "/fromGuideCurveUID", m_fromGuideCurveUID_choice1)) {
             if (m_fromGuideCurveUID_choice1->empty()) {
                 LOG(WARNING) << "Optional element fromGuideCurveUID is present but empty at xpath " << xpath;
             }
@@ -114,9 +110,7 @@ namespace generated
         }
 
         // read element fromRelativeCircumference
-        if (tixi::TixiCheckElement(tixiHandle, xpath + "/fromRelativeCircumference")) {
-            m_fromRelativeCircumference_choice2 = tixi::TixiGetElement<double>(tixiHandle, xpath + "/fromRelativeCircumference");
-        }
+        tixi::TixiTryGetElement(tixiHandle, xpath + "/fromRelativeCircumference", m_fromRelativeCircumference_choice2);
 
         // read element tangent
         if (tixi::TixiCheckElement(tixiHandle, xpath + "/tangent")) {
@@ -130,10 +124,7 @@ namespace generated
         }
 
         // read element toRelativeCircumference
-        if (tixi::TixiCheckElement(tixiHandle, xpath + "/toRelativeCircumference")) {
-            m_toRelativeCircumference = tixi::TixiGetElement<double>(tixiHandle, xpath + "/toRelativeCircumference");
-        }
-        else {
+        if (!tixi::TixiTryGetElement(tixiHandle, xpath + "/toRelativeCircumference", m_toRelativeCircumference)) {
             LOG(ERROR) << "Required element toRelativeCircumference is missing at xpath " << xpath;
         }
 
@@ -250,6 +241,63 @@ namespace generated
 
     }
 
+    bool CPACSGuideCurve::IsDirty() const
+    {
+        if (m_dirty) {
+            return true;
+        }
+        if (m_rXDirection && m_rXDirection->IsDirty()) {
+            return true;
+        }
+        if (m_tangent_choice2 && m_tangent_choice2->IsDirty()) {
+            return true;
+        }
+        if (m_tangent && m_tangent->IsDirty()) {
+            return true;
+        }
+        return false;
+    }
+
+    void CPACSGuideCurve::ClearDirty()
+    {
+        m_dirty = false;
+        if (m_rXDirection) {
+            m_rXDirection->ClearDirty();
+        }
+        if (m_tangent_choice2) {
+            m_tangent_choice2->ClearDirty();
+        }
+        if (m_tangent) {
+            m_tangent->ClearDirty();
+        }
+    }
+
+    void CPACSGuideCurve::WriteDirtyCPACS(const TixiDocumentHandle& tixiHandle, const std::string& xpath) const
+    {
+        if (m_dirty) {
+            WriteCPACS(tixiHandle, xpath);
+            return;
+        }
+
+        // write modified element rXDirection
+        if (m_rXDirection && m_rXDirection->IsDirty()) {
+            tixi::TixiCreateElementIfNotExists(tixiHandle, xpath + "/rXDirection");
+            m_rXDirection->WriteDirtyCPACS(tixiHandle, xpath + "/rXDirection");
+        }
+
+        // write modified element tangent
+        if (m_tangent_choice2 && m_tangent_choice2->IsDirty()) {
+            tixi::TixiCreateElementIfNotExists(tixiHandle, xpath + "/tangent");
+            m_tangent_choice2->WriteDirtyCPACS(tixiHandle, xpath + "/tangent");
+        }
+
+        // write modified element tangent
+        if (m_tangent && m_tangent->IsDirty()) {
+            tixi::TixiCreateElementIfNotExists(tixiHandle, xpath + "/tangent");
+            m_tangent->WriteDirtyCPACS(tixiHandle, xpath + "/tangent");
+        }
+    }
+
     bool CPACSGuideCurve::ValidateChoices() const
     {
         return
@@ -295,6 +343,7 @@ namespace generated
 
     void CPACSGuideCurve::SetUID(const std::string& value)
     {
+        m_dirty = true;
         if (m_uidMgr) {
             m_uidMgr->TryUnregisterObject(m_uID);
             m_uidMgr->RegisterObject(value, *this);
@@ -309,6 +358,7 @@ namespace generated
 
     void CPACSGuideCurve::SetName(const std::string& value)
     {
+        m_dirty = true;
         m_name = value;
     }
 
@@ -319,6 +369,7 @@ namespace generated
 
     void CPACSGuideCurve::SetDescription(const boost::optional<std::string>& value)
     {
+        m_dirty = true;
         m_description = value;
     }
 
@@ -329,6 +380,7 @@ namespace generated
 
     void CPACSGuideCurve::SetGuideCurveProfileUID(const std::string& value)
     {
+        m_dirty = true;
         m_guideCurveProfileUID = value;
     }
 
@@ -349,6 +401,7 @@ namespace generated
 
     void CPACSGuideCurve::SetFromGuideCurveUID_choice1(const boost::optional<std::string>& value)
     {
+        m_dirty = true;
         m_fromGuideCurveUID_choice1 = value;
     }
 
@@ -359,6 +412,7 @@ namespace generated
 
     void CPACSGuideCurve::SetContinuity_choice1(const boost::optional<CPACSGuideCurve_continuity>& value)
     {
+        m_dirty = true;
         m_continuity_choice1 = value;
     }
 
@@ -369,6 +423,7 @@ namespace generated
 
     void CPACSGuideCurve::SetFromRelativeCircumference_choice2(const boost::optional<double>& value)
     {
+        m_dirty = true;
         m_fromRelativeCircumference_choice2 = value;
     }
 
@@ -389,6 +444,7 @@ namespace generated
 
     void CPACSGuideCurve::SetToRelativeCircumference(const double& value)
     {
+        m_dirty = true;
         m_toRelativeCircumference = value;
     }
 
@@ -411,6 +467,7 @@ namespace generated
 
     void CPACSGuideCurve::RemoveRXDirection()
     {
+        m_dirty = true;
         m_rXDirection = boost::none;
     }
 
@@ -423,6 +480,7 @@ namespace generated
 
     void CPACSGuideCurve::RemoveTangent_choice2()
     {
+        m_dirty = true;
         m_tangent_choice2 = boost::none;
     }
 
@@ -435,6 +493,7 @@ namespace generated
 
     void CPACSGuideCurve::RemoveTangent()
     {
+        m_dirty = true;
         m_tangent = boost::none;
     }
 
@@ -27,6 +27,7 @@ namespace generated
 {
     CPACSGuideCurveProfileGeometry::CPACSGuideCurveProfileGeometry(CTiglUIDManager* uidMgr)
         : m_uidMgr(uidMgr)
+        , m_dirty(true)
     {
     }
 
@@ -53,8 +54,7 @@ namespace generated
         }
 
         // read attribute uID
-        if (tixi::TixiCheckAttribute(tixiHandle, xpath, "uID")) {
-            m_uID = tixi::TixiGetAttribute<std::string>(tixiHandle, xpath, "uID");
+        if (tixi::TixiTryGetAttribute(tixiHandle, xpath, "uID", m_uID)) {
             if (m_uID.empty()) {
                 LOG(WARNING) << "Required attribute uID is empty at xpath " << xpath;
             }
@@ -64,8 +64,7 @@ namespace generated
         }
 
         // read element name
-        if (tixi::TixiCheckElement(tixiHandle, xpath + "/name")) {
-            m_name = tixi::TixiGetElement<std::string>(tixiHandle, xpath + "/name");
+        if (tixi::TixiTryGetElement(tixiHandle, xpath + "/name", m_name)) {
             if (m_name.empty()) {
                 LOG(WARNING) << "Required element name is empty at xpath " << xpath;
             }
@@ -75,8 +74,7 @@ namespace generated
         }
 
         // read element description
-        if (tixi::TixiCheckElement(tixiHandle, xpath + "/description")) {
-            m_description = tixi::TixiGetElement<std::string>(tixiHandle, xpath + "/description");
+        if (tixi::TixiTryGetElement(tixiHandle, xpath + "/description", m_description)) {
             if (m_description->empty()) {
                 LOG(WARNING) << "Optional element description is present but empty at xpath " << xpath;
             }
@@ -129,6 +127,37 @@ namespace generated
 
     }
 
+    bool CPACSGuideCurveProfileGeometry::IsDirty() const
+    {
+        if (m_dirty) {
+            return true;
+        }
+        if (m_pointList.IsDirty()) {
+            return true;
+        }
+        return false;
+    }
+
+    void CPACSGuideCurveProfileGeometry::ClearDirty()
+    {
+        m_dirty = false;
+        m_pointList.ClearDirty();
+    }
+
+    void CPACSGuideCurveProfileGeometry::WriteDirtyCPACS(const TixiDocumentHandle& tixiHandle, const std::string& xpath) const
+    {
+        if (m_dirty) {
+            WriteCPACS(tixiHandle, xpath);
+            return;
+        }
+
+        // write modified element pointList
+        if (m_pointList.IsDirty()) {
+            tixi::TixiCreateElementIfNotExists(tixiHandle, xpath + "/pointList");
+            m_pointList.WriteDirtyCPACS(tixiHandle, xpath + "/pointList");
+        }
+    }
+
     const boost::optional<TiglSymmetryAxis>& CPACSGuideCurveProfileGeometry::GetSymmetry() const
     {
         return m_symmetry;
@@ -136,6 +165,7 @@ namespace generated
 
     void CPACSGuideCurveProfileGeometry::SetSymmetry(const boost::optional<TiglSymmetryAxis>& value)
     {
+        m_dirty = true;
         m_symmetry = value;
     }
 
@@ -146,6 +176,7 @@ namespace generated
 
     void CPACSGuideCurveProfileGeometry::SetUID(const std::string& value)
     {
+        m_dirty = true;
         if (m_uidMgr) {
             m_uidMgr->TryUnregisterObject(m_uID);
             m_uidMgr->RegisterObject(value, *this);
@@ -160,6 +191,7 @@ namespace generated
 
     void CPACSGuideCurveProfileGeometry::SetName(const std::string& value)
     {
+        m_dirty = true;
         m_name = value;
     }
 
@@ -170,6 +202,7 @@ namespace generated
 
     void CPACSGuideCurveProfileGeometry::SetDescription(const boost::optional<std::string>& value)
     {
+        m_dirty = true;
         m_description = value;
     }
 
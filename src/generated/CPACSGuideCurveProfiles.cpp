@@ -28,6 +28,7 @@ namespace generated
 {
     CPACSGuideCurveProfiles::CPACSGuideCurveProfiles(CTiglUIDManager* uidMgr)
         : m_uidMgr(uidMgr)
+        , m_dirty(true)
     {
     }
 
@@ -61,6 +62,43 @@ namespace generated
 
     }
 
+    bool CPACSGuideCurveProfiles::IsDirty() const
+    {
+        if (m_dirty) {
+            return true;
+        }
+        if (m_guideCurveProfiles.size() != m_guideCurveProfilesClean.size()) {
+            return true;
+        }
+        for (std::size_t i = 0; i < m_guideCurveProfiles.size(); i++) {
+            if (m_guideCurveProfiles[i].get() != m_guideCurveProfilesClean[i] || m_guideCurveProfiles[i]->IsDirty()) {
+                return true;
+            }
+        }
+        return false;
+    }
+
+    void CPACSGuideCurveProfiles::ClearDirty()
+    {
+        m_dirty = false;
+        m_guideCurveProfilesClean.clear();
+        for (std::size_t i = 0; i < m_guideCurveProfiles.size(); i++) {
+            m_guideCurveProfilesClean.push_back(m_guideCurveProfiles[i].get());
+            m_guideCurveProfiles[i]->ClearDirty();
+        }
+    }
+
+    void CPACSGuideCurveProfiles::WriteDirtyCPACS(const TixiDocumentHandle& tixiHandle, const std::string& xpath) const
+    {
+        if (m_dirty) {
+            WriteCPACS(tixiHandle, xpath);
+            return;
+        }
+
+        // write modified elements guideCurveProfile
+        tixi::TixiSaveDirtyElements(tixiHandle, xpath + "/guideCurveProfile", m_guideCurveProfiles, m_guideCurveProfilesClean);
+    }
+
     const std::vector<unique_ptr<CCPACSGuideCurveProfile> >& CPACSGuideCurveProfiles::GetGuideCurveProfiles() const
     {
         return m_guideCurveProfiles;
@@ -79,6 +117,7 @@ namespace generated
 
     void CPACSGuideCurveProfiles::RemoveGuideCurveProfile(CCPACSGuideCurveProfile& ref)
     {
+        m_dirty = true;
         for (std::size_t i = 0; i < m_guideCurveProfiles.size(); i++) {
             if (m_guideCurveProfiles[i].get() == &ref) {
                 m_guideCurveProfiles.erase(m_guideCurveProfiles.begin() + i);
@@ -28,6 +28,7 @@ namespace generated
 {
     CPACSGuideCurves::CPACSGuideCurves(CTiglUIDManager* uidMgr)
         : m_uidMgr(uidMgr)
+        , m_dirty(true)
     {
     }
 
@@ -61,6 +62,43 @@ namespace generated
 
     }
 
+    bool CPACSGuideCurves::IsDirty() const
+    {
+        if (m_dirty) {
+            return true;
+        }
+        if (m_guideCurves.size() != m_guideCurvesClean.size()) {
+            return true;
+        }
+        for (std::size_t i = 0; i < m_guideCurves.size(); i++) {
+            if (m_guideCurves[i].get() != m_guideCurvesClean[i] || m_guideCurves[i]->IsDirty()) {
+                return true;
+            }
+        }
+        return false;
+    }
+
+    void CPACSGuideCurves::ClearDirty()
+    {
+        m_dirty = false;
+        m_guideCurvesClean.clear();
+        for (std::size_t i = 0; i < m_guideCurves.size(); i++) {
+            m_guideCurvesClean.push_back(m_guideCurves[i].get());
+            m_guideCurves[i]->ClearDirty();
+        }
+    }
+
+    void CPACSGuideCurves::WriteDirtyCPACS(const TixiDocumentHandle& tixiHandle, const std::string& xpath) const
+    {
+        if (m_dirty) {
+            WriteCPACS(tixiHandle, xpath);
+            return;
+        }
+
+        // write modified elements guideCurve
+        tixi::TixiSaveDirtyElements(tixiHandle, xpath + "/guideCurve", m_guideCurves, m_guideCurvesClean);
+    }
+
     const std::vector<unique_ptr<CCPACSGuideCurve> >& CPACSGuideCurves::GetGuideCurves() const
     {
         return m_guideCurves;
@@ -79,6 +117,7 @@ namespace generated
 
     void CPACSGuideCurves::RemoveGuideCurve(CCPACSGuideCurve& ref)
     {
+        m_dirty = true;
         for (std::size_t i = 0; i < m_guideCurves.size(); i++) {
             if (m_guideCurves[i].get() == &ref) {
                 m_guideCurves.erase(m_guideCurves.begin() + i);
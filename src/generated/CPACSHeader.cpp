@@ -26,6 +26,7 @@ namespace generated
 {
     CPACSHeader::CPACSHeader()
         : m_timestamp(0)
+        , m_dirty(true)
     {
     }
 
@@ -36,8 +37,7 @@ namespace generated
     void CPACSHeader::ReadCPACS(const TixiDocumentHandle& tixiHandle, const std::string& xpath)
     {
         // read element name
-        if (tixi::TixiCheckElement(tixiHandle, xpath + "/name")) {
-            m_name = tixi::TixiGetElement<std::string>(tixiHandle, xpath + "/name");
+        if (tixi::TixiTryGetElement(tixiHandle, xpath + "/name", m_name)) {
             if (m_name.empty()) {
                 LOG(WARNING) << "Required element name is empty at xpath " << xpath;
             }
@@ -47,16 +47,14 @@ namespace generated
         }
 
         // read element description
-        if (tixi::TixiCheckElement(tixiHandle, xpath + "/description")) {
-            m_description = tixi::TixiGetElement<std::string>(tixiHandle, xpath + "/description");
+        if (tixi::TixiTryGetElement(tixiHandle, xpath + "/description", m_description)) {
             if (m_description->empty()) {
                 LOG(WARNING) << "Optional element description is present but empty at xpath " << xpath;
             }
         }
 
         // read element creator
-        if (tixi::TixiCheckElement(tixiHandle, xpath + "/creator")) {
-            m_creator = tixi::TixiGetElement<std::string>(tixiHandle, xpath + "/creator");
+        if (tixi::TixiTryGetElement(tixiHandle, xpath + "/creator", m_creator)) {
             if (m_creator.empty()) {
                 LOG(WARNING) << "Required element creator is empty at xpath " << xpath;
             }
@@ -66,16 +64,12 @@ namespace generated
         }
 
         // read element timestamp
-        if (tixi::TixiCheckElement(tixiHandle, xpath + "/timestamp")) {
-            m_timestamp = tixi::TixiGetElement<std::time_t>(tixiHandle, xpath + "/timestamp");
-        }
-        else {
+        if (!tixi::TixiTryGetElement(tixiHandle, xpath + "/timestamp", m_timestamp)) {
             LOG(ERROR) << "Required element timestamp is missing at xpath " << xpath;
         }
 
         // read element version
-        if (tixi::TixiCheckElement(tixiHandle, xpath + "/version")) {
-            m_version = tixi::TixiGetElement<std::string>(tixiHandle, xpath + "/version");
+        if (tixi::TixiTryGetElement(tixiHandle, xpath + "/version", m_version)) {
             if (m_version.empty()) {
                 LOG(WARNING) << "Required element version is empty at xpath " << xpath;
             }
@@ -85,8 +79,7 @@ namespace generated
         }
 
         // read element cpacsVersion
-        if (tixi::TixiCheckElement(tixiHandle, xpath + "/cpacsVersion")) {
-            m_cpacsVersion = tixi::TixiGetElement<std::string>(tixiHandle, xpath + "/cpacsVersion");
+        if (tixi::TixiTryGetElement(tixiHandle, xpath + "/cpacsVersion", m_cpacsVersion)) {
             if (m_cpacsVersion.empty()) {
                 LOG(WARNING) << "Required element cpacsVersion is empty at xpath " << xpath;
             }
@@ -154,6 +147,39 @@ namespace generated
 
     }
 
+    bool CPACSHeader::IsDirty() const
+    {
+        if (m_dirty) {
+            return true;
+        }
+        if (m_updates && m_updates->IsDirty()) {
+            return true;
+        }
+        return false;
+    }
+
+    void CPACSHeader::ClearDirty()
+    {
+        m_dirty = false;
+        if (m_updates) {
+            m_updates->ClearDirty();
+        }
+    }
+
+    void CPACSHeader::WriteDirtyCPACS(const TixiDocumentHandle& tixiHandle, const std::string& xpath) const
+    {
+        if (m_dirty) {
+            WriteCPACS(tixiHandle, xpath);
+            return;
+        }
+
+        // write modified element updates
+        if (m_updates && m_updates->IsDirty()) {
+            tixi::TixiCreateElementIfNotExists(tixiHandle, xpath + "/updates");
+            m_updates->WriteDirtyCPACS(tixiHandle, xpath + "/updates");
+        }
+    }
+
     const std::string& CPACSHeader::GetName() const
     {
         return m_name;
@@ -161,6 +187,7 @@ namespace generated
 
     void CPACSHeader::SetName(const std::string& value)
     {
+        m_dirty = true;
         m_name = value;
     }
 
@@ -171,6 +198,7 @@ namespace generated
 
     void CPACSHeader::SetDescription(const boost::optional<std::string>& value)
     {
+        m_dirty = true;
         m_description = value;
     }
 
@@ -181,6 +209,7 @@ namespace generated
 
     void CPACSHeader::SetCreator(const std::string& value)
     {
+        m_dirty = true;
         m_creator = value;
     }
 
@@ -191,6 +220,7 @@ namespace generated
 
     void CPACSHeader::SetTimestamp(const std::time_t& value)
     {
+        m_dirty = true;
         m_timestamp = value;
     }
 
@@ -201,6 +231,7 @@ namespace generated
 
     void CPACSHeader::SetVersion(const std::string& value)
     {
+        m_dirty = true;
         m_version = value;
     }
 
@@ -211,6 +242,7 @@ namespace generated
 
     void CPACSHeader::SetCpacsVersion(const std::string& value)
     {
+        m_dirty = true;
         m_cpacsVersion = value;
     }
 
@@ -233,6 +265,7 @@ namespace generated
 
     void CPACSHeader::RemoveUpdates()
     {
+        m_dirty = true;
         m_updates = boost::none;
     }
 
@@ -27,6 +27,7 @@ namespace generated
     CPACSLeadingEdgeHollow::CPACSLeadingEdgeHollow()
         : m_relHeightTE(0)
         , m_xsiTE(0)
+        , m_dirty(true)
     {
     }
 
@@ -37,18 +38,12 @@ namespace generated
     void CPACSLeadingEdgeHollow::ReadCPACS(const TixiDocumentHandle& tixiHandle, const std::string& xpath)
     {
         // read element relHeightTE
-        if (tixi::TixiCheckElement(tixiHandle, xpath + "/relHeightTE")) {
-            m_relHeightTE = tixi::TixiGetElement<double>(tixiHandle, xpath + "/relHeightTE");
-        }
-        else {
+        if (!tixi::TixiTryGetElement(tixiHandle, xpath + "/relHeightTE", m_relHeightTE)) {
             LOG(ERROR) << "Required element relHeightTE is missing at xpath " << xpath;
         }
 
         // read element xsiTE
-        if (tixi::TixiCheckElement(tixiHandle, xpath + "/xsiTE")) {
-            m_xsiTE = tixi::TixiGetElement<double>(tixiHandle, xpath + "/xsiTE");
-        }
-        else {
+        if (!tixi::TixiTryGetElement(tixiHandle, xpath + "/xsiTE", m_xsiTE)) {
             LOG(ERROR) << "Required element xsiTE is missing at xpath " << xpath;
         }
 
@@ -66,6 +61,23 @@ namespace generated
 
     }
 
+    bool CPACSLeadingEdgeHollow::IsDirty() const
+    {
+        return m_dirty;
+    }
+
+    void CPACSLeadingEdgeHollow::ClearDirty()
+    {
+        m_dirty = false;
+    }
+
+    void CPACSLeadingEdgeHollow::WriteDirtyCPACS(const TixiDocumentHandle& tixiHandle, const std::string& xpath) const
+    {
+        if (m_dirty) {
+            WriteCPACS(tixiHandle, xpath);
+        }
+    }
+
     const double& CPACSLeadingEdgeHollow::GetRelHeightTE() const
     {
         return m_relHeightTE;
@@ -73,6 +85,7 @@ namespace generated
 
     void CPACSLeadingEdgeHollow::SetRelHeightTE(const double& value)
     {
+        m_dirty = true;
         m_relHeightTE = value;
     }
 
@@ -83,6 +96,7 @@ namespace generated
 
     void CPACSLeadingEdgeHollow::SetXsiTE(const double& value)
     {
+        m_dirty = true;
         m_xsiTE = value;
     }
 
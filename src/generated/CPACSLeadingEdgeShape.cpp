@@ -28,6 +28,7 @@ namespace generated
         : m_relHeightLE(0)
         , m_xsiUpperSkin(0)
         , m_xsiLowerSkin(0)
+        , m_dirty(true)
     {
     }
 
@@ -38,26 +39,17 @@ namespace generated
     void CPACSLeadingEdgeShape::ReadCPACS(const TixiDocumentHandle& tixiHandle, const std::string& xpath)
     {
         // read element relHeightLE
-        if (tixi::TixiCheckElement(tixiHandle, xpath + "/relHeightLE")) {
-            m_relHeightLE = tixi::TixiGetElement<double>(tixiHandle, xpath + "/relHeightLE");
-        }
-        else {
+        if (!tixi::TixiTryGetElement(tixiHandle, xpath + "/relHeightLE", m_relHeightLE)) {
             LOG(ERROR) << "Required element relHeightLE is missing at xpath " << xpath;
         }
 
         // read element xsiUpperSkin
-        if (tixi::TixiCheckElement(tixiHandle, xpath + "/xsiUpperSkin")) {
-            m_xsiUpperSkin = tixi::TixiGetElement<double>(tixiHandle, xpath + "/xsiUpperSkin");
-        }
-        else {
+        if (!tixi::TixiTryGetElement(tixiHandle, xpath + "/xsiUpperSkin", m_xsiUpperSkin)) {
             LOG(ERROR) << "Required element xsiUpperSkin is missing at xpath " << xpath;
         }
 
         // read element xsiLowerSkin
-        if (tixi::TixiCheckElement(tixiHandle, xpath + "/xsiLowerSkin")) {
-            m_xsiLowerSkin = tixi::TixiGetElement<double>(tixiHandle, xpath + "/xsiLowerSkin");
-        }
-        else {
+        if (!tixi::TixiTryGetElement(tixiHandle, xpath + "/xsiLowerSkin", m_xsiLowerSkin)) {
             LOG(ERROR) << "Required element xsiLowerSkin is missing at xpath " << xpath;
         }
 
@@ -79,6 +71,23 @@ namespace generated
 
     }
 
+    bool CPACSLeadingEdgeShape::IsDirty() const
+    {
+        return m_dirty;
+    }
+
+    void CPACSLeadingEdgeShape::ClearDirty()
+    {
+        m_dirty = false;
+    }
+
+    void CPACSLeadingEdgeShape::WriteDirtyCPACS(const TixiDocumentHandle& tixiHandle, const std::string& xpath) const
+    {
+        if (m_dirty) {
+            WriteCPACS(tixiHandle, xpath);
+        }
+    }
+
     const double& CPACSLeadingEdgeShape::GetRelHeightLE() const
     {
         return m_relHeightLE;
@@ -86,6 +95,7 @@ namespace generated
 
     void CPACSLeadingEdgeShape::SetRelHeightLE(const double& value)
     {
+        m_dirty = true;
         m_relHeightLE = value;
     }
 
@@ -96,6 +106,7 @@ namespace generated
 
     void CPACSLeadingEdgeShape::SetXsiUpperSkin(const double& value)
     {
+        m_dirty = true;
         m_xsiUpperSkin = value;
     }
 
@@ -106,6 +117,7 @@ namespace generated
 
     void CPACSLeadingEdgeShape::SetXsiLowerSkin(const double& value)
     {
+        m_dirty = true;
         m_xsiLowerSkin = value;
     }
 
@@ -46,6 +46,10 @@ namespace generated
         TIGL_EXPORT virtual void ReadCPACS(const TixiDocumentHandle& tixiHandle, const std::string& xpath);
         TIGL_EXPORT virtual void WriteCPACS(const TixiDocumentHandle& tixiHandle, const std::string& xpath) const;
 
+        TIGL_EXPORT virtual bool IsDirty() const;
+        TIGL_EXPORT virtual void ClearDirty();
+        TIGL_EXPORT virtual void WriteDirtyCPACS(const TixiDocumentHandle& tixiHandle, const std::string& xpath) const;
+
         TIGL_EXPORT virtual const double& GetRelHeightLE() const;
         TIGL_EXPORT virtual void SetRelHeightLE(const double& value);
 
@@ -75,6 +79,9 @@ namespace generated
         /// outer border default to the value of the inner border. Optional.
         double m_xsiLowerSkin;
 
+        /// Set by the setters, cleared after the object has been read or written
+        bool m_dirty;
+
     private:
 #ifdef HAVE_CPP11
         CPACSLeadingEdgeShape(const CPACSLeadingEdgeShape&) = delete;
@@ -25,6 +25,7 @@ namespace tigl
 namespace generated
 {
     CPACSLinkToFile::CPACSLinkToFile()
+        : m_dirty(true)
     {
     }
 
@@ -69,6 +70,23 @@ namespace generated
 
     }
 
+    bool CPACSLinkToFile::IsDirty() const
+    {
+        return m_dirty;
+    }
+
+    void CPACSLinkToFile::ClearDirty()
+    {
+        m_dirty = false;
+    }
+
+    void CPACSLinkToFile::WriteDirtyCPACS(const TixiDocumentHandle& tixiHandle, const std::string& xpath) const
+    {
+        if (m_dirty) {
+            WriteCPACS(tixiHandle, xpath);
+        }
+    }
+
     const std::string& CPACSLinkToFile::GetBase() const
     {
         return m_base;
@@ -76,6 +94,7 @@ namespace generated
 
     void CPACSLinkToFile::SetBase(const std::string& value)
     {
+        m_dirty = true;
         m_base = value;
     }
 
@@ -86,6 +105,7 @@ namespace generated
 
     void CPACSLinkToFile::SetFormat(const boost::optional<CPACSLinkToFileType_format>& value)
     {
+        m_dirty = true;
         m_format = value;
     }
 
@@ -30,6 +30,7 @@ namespace generated
 {
     CPACSLongFloorBeam::CPACSLongFloorBeam(CCPACSLongFloorBeamsAssembly* parent, CTiglUIDManager* uidMgr)
         : m_uidMgr(uidMgr)
+        , m_dirty(true)
     {
         //assert(parent != NULL);
         m_parent = parent;
@@ -63,8 +64,7 @@ namespace generated
     void CPACSLongFloorBeam::ReadCPACS(const TixiDocumentHandle& tixiHandle, const std::string& xpath)
     {
         // read attribute uID
-        if (tixi::TixiCheckAttribute(tixiHandle, xpath, "uID")) {
-            m_uID = tixi::TixiGetAttribute<std::string>(tixiHandle, xpath, "uID");
+        if (tixi::TixiTryGetAttribute(tixiHandle, xpath, "uID", m_uID)) {
             if (m_uID.empty()) {
                 LOG(WARNING) << "Required attribute uID is empty at xpath " << xpath;
             }
@@ -91,6 +91,43 @@ namespace generated
 
     }
 
+    bool CPACSLongFloorBeam::IsDirty() const
+    {
+        if (m_dirty) {
+            return true;
+        }
+        if (m_longFloorBeamPositions.size() != m_longFloorBeamPositionsClean.size()) {
+            return true;
+        }
+        for (std::size_t i = 0; i < m_longFloorBeamPositions.size(); i++) {
+            if (m_longFloorBeamPositions[i].get() != m_longFloorBeamPositionsClean[i] || m_longFloorBeamPositions[i]->IsDirty()) {
+                return true;
+            }
+        }
+        return false;
+    }
+
+    void CPACSLongFloorBeam::ClearDirty()
+    {
+        m_dirty = false;
+        m_longFloorBeamPositionsClean.clear();
+        for (std::size_t i = 0; i < m_longFloorBeamPositions.size(); i++) {
+            m_longFloorBeamPositionsClean.push_back(m_longFloorBeamPositions[i].get());
+            m_longFloorBeamPositions[i]->ClearDirty();
+        }
+    }
+
+    void CPACSLongFloorBeam::WriteDirtyCPACS(const TixiDocumentHandle& tixiHandle, const std::string& xpath) const
+    {
+        if (m_dirty) {
+            WriteCPACS(tixiHandle, xpath);
+            return;
+        }
+
+        // write modified elements longFloorBeamPosition
+        tixi::TixiSaveDirtyElements(tixiHandle, xpath + "/longFloorBeamPosition", m_longFloorBeamPositions, m_longFloorBeamPositionsClean);
+    }
+
     const std::string& CPACSLongFloorBeam::GetUID() const
     {
         return m_uID;
@@ -98,6 +135,7 @@ namespace generated
 
     void CPACSLongFloorBeam::SetUID(const std::string& value)
     {
+        m_dirty = true;
         if (m_uidMgr) {
             m_uidMgr->TryUnregisterObject(m_uID);
             m_uidMgr->RegisterObject(value, *this);
@@ -123,6 +161,7 @@ namespace generated
 
     void CPACSLongFloorBeam::RemoveLongFloorBeamPosition(CCPACSLongFloorBeamPosition& ref)
     {
+        m_dirty = true;
         for (std::size_t i = 0; i < m_longFloorBeamPositions.size(); i++) {
             if (m_longFloorBeamPositions[i].get() == &ref) {
                 m_longFloorBeamPositions.erase(m_longFloorBeamPositions.begin() + i);
@@ -30,6 +30,7 @@ namespace generated
     CPACSLongFloorBeamPosition::CPACSLongFloorBeamPosition(CCPACSLongFloorBeam* parent, CTiglUIDManager* uidMgr)
         : m_uidMgr(uidMgr)
         , m_positionY(0)
+        , m_dirty(true)
     {
         //assert(parent != NULL);
         m_parent = parent;
@@ -63,8 +64,7 @@ namespace generated
     void CPACSLongFloorBeamPosition::ReadCPACS(const TixiDocumentHandle& tixiHandle, const std::string& xpath)
     {
         // read attribute uID
-        if (tixi::TixiCheckAttribute(tixiHandle, xpath, "uID")) {
-            m_uID = tixi::TixiGetAttribute<std::string>(tixiHandle, xpath, "uID");
+        if (tixi::TixiTryGetAttribute(tixiHandle, xpath, "uID", m_uID)) {
             if (m_uID.empty()) {
                 LOG(WARNING) << "Required attribute uID is empty at xpath " << xpath;
             }
@@ -74,8 +74,7 @@ namespace generated
         }
 
         // read element structuralElementUID
-        if (tixi::TixiCheckElement(tixiHandle, xpath + "/structuralElementUID")) {
-            m_structuralElementUID = tixi::TixiGetElement<std::string>(tixiHandle, xpath + "/structuralElementUID");
+        if (tixi::TixiTryGetElement(tixiHandle, xpath + "/structuralElementUID", m_structuralElementUID)) {
             if (m_structuralElementUID.empty()) {
                 LOG(WARNING) << "Required element structuralElementUID is empty at xpath " << xpath;
             }
@@ -85,8 +84,7 @@ namespace generated
         }
 
         // read element crossBeamUID
-        if (tixi::TixiCheckElement(tixiHandle, xpath + "/crossBeamUID")) {
-            m_crossBeamUID = tixi::TixiGetElement<std::string>(tixiHandle, xpath + "/crossBeamUID");
+        if (tixi::TixiTryGetElement(tixiHandle, xpath + "/crossBeamUID", m_crossBeamUID)) {
             if (m_crossBeamUID.empty()) {
                 LOG(WARNING) << "Required element crossBeamUID is empty at xpath " << xpath;
             }
@@ -96,10 +94,7 @@ namespace generated
         }
 
         // read element positionY
-        if (tixi::TixiCheckElement(tixiHandle, xpath + "/positionY")) {
-            m_positionY = tixi::TixiGetElement<double>(tixiHandle, xpath + "/positionY");
-        }
-        else {
+        if (!tixi::TixiTryGetElement(tixiHandle, xpath + "/positionY", m_positionY)) {
             LOG(ERROR) << "Required element positionY is missing at xpath " << xpath;
         }
 
@@ -179,6 +174,39 @@ namespace generated
 
     }
 
+    bool CPACSLongFloorBeamPosition::IsDirty() const
+    {
+        if (m_dirty) {
+            return true;
+        }
+        if (m_alignment && m_alignment->IsDirty()) {
+            return true;
+        }
+        return false;
+    }
+
+    void CPACSLongFloorBeamPosition::ClearDirty()
+    {
+        m_dirty = false;
+        if (m_alignment) {
+            m_alignment->ClearDirty();
+        }
+    }
+
+    void CPACSLongFloorBeamPosition::WriteDirtyCPACS(const TixiDocumentHandle& tixiHandle, const std::string& xpath) const
+    {
+        if (m_dirty) {
+            WriteCPACS(tixiHandle, xpath);
+            return;
+        }
+
+        // write modified element alignment
+        if (m_alignment && m_alignment->IsDirty()) {
+            tixi::TixiCreateElementIfNotExists(tixiHandle, xpath + "/alignment");
+            m_alignment->WriteDirtyCPACS(tixiHandle, xpath + "/alignment");
+        }
+    }
+
     const std::string& CPACSLongFloorBeamPosition::GetUID() const
     {
         return m_uID;
@@ -186,6 +214,7 @@ namespace generated
 
     void CPACSLongFloorBeamPosition::SetUID(const std::string& value)
     {
+        m_dirty = true;
         if (m_uidMgr) {
             m_uidMgr->TryUnregisterObject(m_uID);
             m_uidMgr->RegisterObject(value, *this);
@@ -200,6 +229,7 @@ namespace generated
 
     void CPACSLongFloorBeamPosition::SetStructuralElementUID(const std::string& value)
     {
+        m_dirty = true;
         m_structuralElementUID = value;
     }
 
@@ -210,6 +240,7 @@ namespace generated
 
     void CPACSLongFloorBeamPosition::SetCrossBeamUID(const std::string& value)
     {
+        m_dirty = true;
         m_crossBeamUID = value;
     }
 
@@ -220,6 +251,7 @@ namespace generated
 
     void CPACSLongFloorBeamPosition::SetPositionY(const double& value)
     {
+        m_dirty = true;
         m_positionY = value;
     }
 
@@ -240,6 +272,7 @@ namespace generated
 
     void CPACSLongFloorBeamPosition::SetContinuity(const boost::optional<CPACSContinuity>& value)
     {
+        m_dirty = true;
         m_continuity = value;
     }
 
@@ -250,6 +283,7 @@ namespace generated
 
     void CPACSLongFloorBeamPosition::SetInterpolation(const boost::optional<CPACSInterpolation>& value)
     {
+        m_dirty = true;
         m_interpolation = value;
     }
 
@@ -262,6 +296,7 @@ namespace generated
 
     void CPACSLongFloorBeamPosition::RemoveAlignment()
     {
+        m_dirty = true;
         m_alignment = boost::none;
     }
 
@@ -30,6 +30,7 @@ namespace generated
 {
     CPACSLongFloorBeamsAssembly::CPACSLongFloorBeamsAssembly(CCPACSFuselageStructure* parent, CTiglUIDManager* uidMgr)
         : m_uidMgr(uidMgr)
+        , m_dirty(true)
     {
         //assert(parent != NULL);
         m_parent = parent;
@@ -75,6 +76,43 @@ namespace generated
 
     }
 
+    bool CPACSLongFloorBeamsAssembly::IsDirty() const
+    {
+        if (m_dirty) {
+            return true;
+        }
+        if (m_longFloorBeams.size() != m_longFloorBeamsClean.size()) {
+            return true;
+        }
+        for (std::size_t i = 0; i < m_longFloorBeams.size(); i++) {
+            if (m_longFloorBeams[i].get() != m_longFloorBeamsClean[i] || m_longFloorBeams[i]->IsDirty()) {
+                return true;
+            }
+        }
+        return false;
+    }
+
+    void CPACSLongFloorBeamsAssembly::ClearDirty()
+    {
+        m_dirty = false;
+        m_longFloorBeamsClean.clear();
+        for (std::size_t i = 0; i < m_longFloorBeams.size(); i++) {
+            m_longFloorBeamsClean.push_back(m_longFloorBeams[i].get());
+            m_longFloorBeams[i]->ClearDirty();
+        }
+    }
+
+    void CPACSLongFloorBeamsAssembly::WriteDirtyCPACS(const TixiDocumentHandle& tixiHandle, const std::string& xpath) const
+    {
+        if (m_dirty) {
+            WriteCPACS(tixiHandle, xpath);
+            return;
+        }
+
+        // write modified elements longFloorBeam
+        tixi::TixiSaveDirtyElements(tixiHandle, xpath + "/longFloorBeam", m_longFloorBeams, m_longFloorBeamsClean);
+    }
+
     const std::vector<unique_ptr<CCPACSLongFloorBeam> >& CPACSLongFloorBeamsAssembly::GetLongFloorBeams() const
     {
         return m_longFloorBeams;
@@ -93,6 +131,7 @@ namespace generated
 
     void CPACSLongFloorBeamsAssembly::RemoveLongFloorBeam(CCPACSLongFloorBeam& ref)
     {
+        m_dirty = true;
         for (std::size_t i = 0; i < m_longFloorBeams.size(); i++) {
             if (m_longFloorBeams[i].get() == &ref) {
                 m_longFloorBeams.erase(m_longFloorBeams.begin() + i);
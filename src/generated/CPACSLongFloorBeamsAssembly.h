@@ -57,6 +57,10 @@ namespace generated
         TIGL_EXPORT virtual void ReadCPACS(const TixiDocumentHandle& tixiHandle, const std::string& xpath);
         TIGL_EXPORT virtual void WriteCPACS(const TixiDocumentHandle& tixiHandle, const std::string& xpath) const;
 
+        TIGL_EXPORT virtual bool IsDirty() const;
+        TIGL_EXPORT virtual void ClearDirty();
+        TIGL_EXPORT virtual void WriteDirtyCPACS(const TixiDocumentHandle& tixiHandle, const std::string& xpath) const;
+
         TIGL_EXPORT virtual const std::vector<unique_ptr<CCPACSLongFloorBeam> >& GetLongFloorBeams() const;
         TIGL_EXPORT virtual std::vector<unique_ptr<CCPACSLongFloorBeam> >& GetLongFloorBeams();
 
@@ -70,6 +74,12 @@ namespace generated
 
         std::vector<unique_ptr<CCPACSLongFloorBeam> > m_longFloorBeams;
 
+        /// Set by the setters, cleared after the object has been read or written
+        bool m_dirty;
+
+        /// List elements at the last call of ClearDirty
+        std::vector<const CCPACSLongFloorBeam*> m_longFloorBeamsClean;
+
     private:
 #ifdef HAVE_CPP11
         CPACSLongFloorBeamsAssembly(const CPACSLongFloorBeamsAssembly&) = delete;
@@ -31,6 +31,7 @@ namespace generated
         , m_rho(0)
         , m_k11(0)
         , m_k12(0)
+        , m_dirty(true)
     {
     }
 
@@ -52,8 +53,7 @@ namespace generated
     void CPACSMaterial::ReadCPACS(const TixiDocumentHandle& tixiHandle, const std::string& xpath)
     {
         // read attribute uID
-        if (tixi::TixiCheckAttribute(tixiHandle, xpath, "uID")) {
-            m_uID = tixi::TixiGetAttribute<std::string>(tixiHandle, xpath, "uID");
+        if (tixi::TixiTryGetAttribute(tixiHandle, xpath, "uID", m_uID)) {
             if (m_uID.empty()) {
                 LOG(WARNING) << "Required attribute uID is empty at xpath " << xpath;
             }
@@ -63,8 +63,7 @@ namespace generated
         }
 
         // read element name
-        if (tixi::TixiCheckElement(tixiHandle, xpath + "/name")) {
-            m_name = tixi::TixiGetElement<std::string>(tixiHandle, xpath + "/name");
+        if (tixi::TixiTryGetElement(tixiHandle, xpath + "/name", m_name)) {
             if (m_name.empty()) {
                 LOG(WARNING) << "Required element name is empty at xpath " << xpath;
             }
@@ -74,46 +73,32 @@ namespace generated
         }
 
         // read element description
-        if (tixi::TixiCheckElement(tixiHandle, xpath + "/description")) {
-            m_description = tixi::TixiGetElement<std::string>(tixiHandle, xpath + "/description");
+        if (tixi::TixiTryGetElement(tixiHandle, xpath + "/description", m_description)) {
             if (m_description->empty()) {
                 LOG(WARNING) << "Optional element description is present but empty at xpath " << xpath;
             }
         }
 
         // read element rho
-        if (tixi::TixiCheckElement(tixiHandle, xpath + "/rho")) {
-            m_rho = tixi::TixiGetElement<double>(tixiHandle, xpath + "/rho");
-        }
-        else {
+        if (!tixi::TixiTryGetElement(tixiHandle, xpath + "/rho", m_rho)) {
             LOG(ERROR) << "Required element rho is missing at xpath " << xpath;
         }
 
         // read element k11
-        if (tixi::TixiCheckElement(tixiHandle, xpath + "/k11")) {
-            m_k11 = tixi::TixiGetElement<double>(tixiHandle, xpath + "/k11");
-        }
-        else {
+        if (!tixi::TixiTryGetElement(tixiHandle, xpath + "/k11", m_k11)) {
             LOG(ERROR) << "Required element k11 is missing at xpath " << xpath;
         }
 
         // read element k12
-        if (tixi::TixiCheckElement(tixiHandle, xpath + "/k12")) {
-            m_k12 = tixi::TixiGetElement<double>(tixiHandle, xpath + "/k12");
-        }
-        else {
+        if (!tixi::TixiTryGetElement(tixiHandle, xpath + "/k12", m_k12)) {
             LOG(ERROR) << "Required element k12 is missing at xpath " << xpath;
         }
 
         // read element maxStrain
-        if (tixi::TixiCheckElement(tixiHandle, xpath + "/maxStrain")) {
-            m_maxStrain = tixi::TixiGetElement<double>(tixiHandle, xpath + "/maxStrain");
-        }
+        tixi::TixiTryGetElement(tixiHandle, xpath + "/maxStrain", m_maxStrain);
 
         // read element fatigueFactor
-        if (tixi::TixiCheckElement(tixiHandle, xpath + "/fatigueFactor")) {
-            m_fatigueFactor = tixi::TixiGetElement<double>(tixiHandle, xpath + "/fatigueFactor");
-        }
+        tixi::TixiTryGetElement(tixiHandle, xpath + "/fatigueFactor", m_fatigueFactor);
 
         // read element postFailure
         if (tixi::TixiCheckElement(tixiHandle, xpath + "/postFailure")) {
@@ -121,9 +106,7 @@ namespace generated
         }
 
         // read element thermalConductivity
-        if (tixi::TixiCheckElement(tixiHandle, xpath + "/thermalConductivity")) {
-            m_thermalConductivity = tixi::TixiGetElement<double>(tixiHandle, xpath + "/thermalConductivity");
-        }
+        tixi::TixiTryGetElement(tixiHandle, xpath + "/thermalConductivity", m_thermalConductivity);
 
         // read element specificHeatMap
         if (tixi::TixiCheckElement(tixiHandle, xpath + "/specificHeatMap")) {
@@ -148,149 +131,91 @@ namespace generated
         }
 
         // read element sig11
-        if (tixi::TixiCheckElement(tixiHandle, xpath + "/sig11")) {
-            m_sig11_choice1 = tixi::TixiGetElement<double>(tixiHandle, xpath + "/sig11");
-        }
+        tixi::TixiTryGetElement(tixiHandle, xpath + "/sig11", m_sig11_choice1);
 
         // read element tau12
-        if (tixi::TixiCheckElement(tixiHandle, xpath + "/tau12")) {
-            m_tau12_choice1 = tixi::TixiGetElement<double>(tixiHandle, xpath + "/tau12");
-        }
+        tixi::TixiTryGetElement(tixiHandle, xpath + "/tau12", m_tau12_choice1);
 
         // read element sig11yieldT
-        if (tixi::TixiCheckElement(tixiHandle, xpath + "/sig11yieldT")) {
-            m_sig11yieldT_choice1 = tixi::TixiGetElement<double>(tixiHandle, xpath + "/sig11yieldT");
-        }
+        tixi::TixiTryGetElement(tixiHandle, xpath + "/sig11yieldT", m_sig11yieldT_choice1);
 
         // read element sig11yieldC
-        if (tixi::TixiCheckElement(tixiHandle, xpath + "/sig11yieldC")) {
-            m_sig11yieldC_choice1 = tixi::TixiGetElement<double>(tixiHandle, xpath + "/sig11yieldC");
-        }
+        tixi::TixiTryGetElement(tixiHandle, xpath + "/sig11yieldC", m_sig11yieldC_choice1);
 
         // read element k22
-        if (tixi::TixiCheckElement(tixiHandle, xpath + "/k22")) {
-            m_k22_choice2 = tixi::TixiGetElement<double>(tixiHandle, xpath + "/k22");
-        }
+        tixi::TixiTryGetElement(tixiHandle, xpath + "/k22", m_k22_choice2);
 
         // read element k23
-        if (tixi::TixiCheckElement(tixiHandle, xpath + "/k23")) {
-            m_k23_choice2 = tixi::TixiGetElement<double>(tixiHandle, xpath + "/k23");
-        }
+        tixi::TixiTryGetElement(tixiHandle, xpath + "/k23", m_k23_choice2);
 
         // read element k66
-        if (tixi::TixiCheckElement(tixiHandle, xpath + "/k66")) {
-            m_k66_choice2 = tixi::TixiGetElement<double>(tixiHandle, xpath + "/k66");
-        }
+        tixi::TixiTryGetElement(tixiHandle, xpath + "/k66", m_k66_choice2);
 
         // read element sig11t
-        if (tixi::TixiCheckElement(tixiHandle, xpath + "/sig11t")) {
-            m_sig11t_choice2 = tixi::TixiGetElement<double>(tixiHandle, xpath + "/sig11t");
-        }
+        tixi::TixiTryGetElement(tixiHandle, xpath + "/sig11t", m_sig11t_choice2);
 
         // read element sig11c
-        if (tixi::TixiCheckElement(tixiHandle, xpath + "/sig11c")) {
-            m_sig11c_choice2 = tixi::TixiGetElement<double>(tixiHandle, xpath + "/sig11c");
-        }
+        tixi::TixiTryGetElement(tixiHandle, xpath + "/sig11c", m_sig11c_choice2);
 
         // read element sig22t
-        if (tixi::TixiCheckElement(tixiHandle, xpath + "/sig22t")) {
-            m_sig22t_choice2 = tixi::TixiGetElement<double>(tixiHandle, xpath + "/sig22t");
-        }
+        tixi::TixiTryGetElement(tixiHandle, xpath + "/sig22t", m_sig22t_choice2);
 
         // read element sig22c
-        if (tixi::TixiCheckElement(tixiHandle, xpath + "/sig22c")) {
-            m_sig22c_choice2 = tixi::TixiGetElement<double>(tixiHandle, xpath + "/sig22c");
-        }
+        tixi::TixiTryGetElement(tixiHandle, xpath + "/sig22c", m_sig22c_choice2);
 
         // read element tau12
-        if (tixi::TixiCheckElement(tixiHandle, xpath + "/tau12")) {
-            m_tau12_choice2 = tixi::TixiGetElement<double>(tixiHandle, xpath + "/tau12");
-        }
+        tixi::TixiTryGetElement(tixiHandle, xpath + "/tau12", m_tau12_choice2);
 
         // read element tau23
-        if (tixi::TixiCheckElement(tixiHandle, xpath + "/tau23")) {
-            m_tau23_choice2 = tixi::TixiGetElement<double>(tixiHandle, xpath + "/tau23");
-        }
+        tixi::TixiTryGetElement(tixiHandle, xpath + "/tau23", m_tau23_choice2);
 
         // read element k13
-        if (tixi::TixiCheckElement(tixiHandle, xpath + "/k13")) {
-            m_k13_choice3 = tixi::TixiGetElement<double>(tixiHandle, xpath + "/k13");
-        }
+        tixi::TixiTryGetElement(tixiHandle, xpath + "/k13", m_k13_choice3);
 
         // read element k22
-        if (tixi::TixiCheckElement(tixiHandle, xpath + "/k22")) {
-            m_k22_choice3 = tixi::TixiGetElement<double>(tixiHandle, xpath + "/k22");
-        }
+        tixi::TixiTryGetElement(tixiHandle, xpath + "/k22", m_k22_choice3);
 
         // read element k23
-        if (tixi::TixiCheckElement(tixiHandle, xpath + "/k23")) {
-            m_k23_choice3 = tixi::TixiGetElement<double>(tixiHandle, xpath + "/k23");
-        }
+        tixi::TixiTryGetElement(tixiHandle, xpath + "/k23", m_k23_choice3);
 
         // read element k33
-        if (tixi::TixiCheckElement(tixiHandle, xpath + "/k33")) {
-            m_k33_choice3 = tixi::TixiGetElement<double>(tixiHandle, xpath + "/k33");
-        }
+        tixi::TixiTryGetElement(tixiHandle, xpath + "/k33", m_k33_choice3);
 
         // read element k44
-        if (tixi::TixiCheckElement(tixiHandle, xpath + "/k44")) {
-            m_k44_choice3 = tixi::TixiGetElement<double>(tixiHandle, xpath + "/k44");
-        }
+        tixi::TixiTryGetElement(tixiHandle, xpath + "/k44", m_k44_choice3);
 
         // read element k55
-        if (tixi::TixiCheckElement(tixiHandle, xpath + "/k55")) {
-            m_k55_choice3 = tixi::TixiGetElement<double>(tixiHandle, xpath + "/k55");
-        }
+        tixi::TixiTryGetElement(tixiHandle, xpath + "/k55", m_k55_choice3);
 
         // read element k66
-        if (tixi::TixiCheckElement(tixiHandle, xpath + "/k66")) {
-            m_k66_choice3 = tixi::TixiGetElement<double>(tixiHandle, xpath + "/k66");
-        }
+        tixi::TixiTryGetElement(tixiHandle, xpath + "/k66", m_k66_choice3);
 
         // read element sig11t
-        if (tixi::TixiCheckElement(tixiHandle, xpath + "/sig11t")) {
-            m_sig11t_choice3 = tixi::TixiGetElement<double>(tixiHandle, xpath + "/sig11t");
-        }
+        tixi::TixiTryGetElement(tixiHandle, xpath + "/sig11t", m_sig11t_choice3);
 
         // read element sig11c
-        if (tixi::TixiCheckElement(tixiHandle, xpath + "/sig11c")) {
-            m_sig11c_choice3 = tixi::TixiGetElement<double>(tixiHandle, xpath + "/sig11c");
-        }
+        tixi::TixiTryGetElement(tixiHandle, xpath + "/sig11c", m_sig11c_choice3);
 
         // read element sig22t
-        if (tixi::TixiCheckElement(tixiHandle, xpath + "/sig22t")) {
-            m_sig22t_choice3 = tixi::TixiGetElement<double>(tixiHandle, xpath + "/sig22t");
-        }
+        tixi::TixiTryGetElement(tixiHandle, xpath + "/sig22t", m_sig22t_choice3);
 
         // read element sig22c
-        if (tixi::TixiCheckElement(tixiHandle, xpath + "/sig22c")) {
-            m_sig22c_choice3 = tixi::TixiGetElement<double>(tixiHandle, xpath + "/sig22c");
-        }
+        tixi::TixiTryGetElement(tixiHandle, xpath + "/sig22c", m_sig22c_choice3);
 
         // read element sig33t
-        if (tixi::TixiCheckElement(tixiHandle, xpath + "/sig33t")) {
-            m_sig33t_choice3 = tixi::TixiGetElement<double>(tixiHandle, xpath + "/sig33t");
-        }
+        tixi::TixiTryGetElement(tixiHandle, xpath + "/sig33t", m_sig33t_choice3);
 
         // read element sig33c
-        if (tixi::TixiCheckElement(tixiHandle, xpath + "/sig33c")) {
-            m_sig33c_choice3 = tixi::TixiGetElement<double>(tixiHandle, xpath + "/sig33c");
-        }
+        tixi::TixiTryGetElement(tixiHandle, xpath + "/sig33c", m_sig33c_choice3);
 
         // read element tau12
-        if (tixi::TixiCheckElement(tixiHandle, xpath + "/tau12")) {
-            m_tau12_choice3 = tixi::TixiGetElement<double>(tixiHandle, xpath + "/tau12");
-        }
+        tixi::TixiTryGetElement(tixiHandle, xpath + "/tau12", m_tau12_choice3);
 
         // read element tau13
-        if (tixi::TixiCheckElement(tixiHandle, xpath + "/tau13")) {
-            m_tau13_choice3 = tixi::TixiGetElement<double>(tixiHandle, xpath + "/tau13");
-        }
+        tixi::TixiTryGetElement(tixiHandle, xpath + "/tau13", m_tau13_choice3);
 
         // read element tau23
-        if (tixi::TixiCheckElement(tixiHandle, xpath + "/tau23")) {
-            m_tau23_choice3 = tixi::TixiGetElement<double>(tixiHandle, xpath + "/tau23");
-        }
+        tixi::TixiTryGetElement(tixiHandle, xpath + "/tau23", m_tau23_choice3);
 
         if (m_uidMgr && !m_uID.empty()) m_uidMgr->RegisterObject(m_uID, *this);
         if (!ValidateChoices()) {
@@ -709,6 +634,67 @@ namespace generated
 
     }
 
+    bool CPACSMaterial::IsDirty() const
+    {
+        if (m_dirty) {
+            return true;
+        }
+        if (m_postFailures.size() != m_postFailuresClean.size()) {
+            return true;
+        }
+        for (std::size_t i = 0; i < m_postFailures.size(); i++) {
+            if (m_postFailures[i].get() != m_postFailuresClean[i] || m_postFailures[i]->IsDirty()) {
+                return true;
+            }
+        }
+        if (m_specificHeatMap && m_specificHeatMap->IsDirty()) {
+            return true;
+        }
+        if (m_emissivityMap && m_emissivityMap->IsDirty()) {
+            return true;
+        }
+        return false;
+    }
+
+    void CPACSMaterial::ClearDirty()
+    {
+        m_dirty = false;
+        m_postFailuresClean.clear();
+        for (std::size_t i = 0; i < m_postFailures.size(); i++) {
+            m_postFailuresClean.push_back(m_postFailures[i].get());
+            m_postFailures[i]->ClearDirty();
+        }
+        if (m_specificHeatMap) {
+            m_specificHeatMap->ClearDirty();
+        }
+        if (m_emissivityMap) {
+            m_emissivityMap->ClearDirty();
+        }
+    }
+
+    void CPACSMaterial::WriteDirtyCPACS(const TixiDocumentHandle& tixiHandle, const std::string& xpath) const
+    {
+        if (m_dirty) {
+            WriteCPACS(tixiHandle, xpath);
+            return;
+        }
+
+        // write modified elements postFailure
+        tixi::TixiSaveDirtyElements(tixiHandle, xpath + "/postFailure", m_postFailures, m_postFailuresClean);
+
+        // write modified element specificHeatMap
+        if (m_specificHeatMap && m_specificHeatMap->IsDirty()) {
+            tixi::TixiCreateElementIfNotExists(tixiHandle, xpath + "/specificHeatMap");
+            m_specificHeatMap->WriteDirtyCPACS(tixiHandle, xpath + "/specificHeatMap");
+        }
+
+        // write modified element emissivityMap
+        if (m_emissivityMap && m_emissivityMap->IsDirty()) {
+            tixi::TixiCreateElementIfNotExists(tixiHandle, xpath + "/emissivityMap");
+            m_emissivityMap->WriteDirtyCPACS(tixiHandle, xpath + "/emissivityMap");
+        }
+    }
+
     bool CPACSMaterial::ValidateChoices() const
     {
         return
@@ -874,6 +860,7 @@ namespace generated
 
     void CPACSMaterial::SetUID(const std::string& value)
     {
+        m_dirty = true;
         if (m_uidMgr) {
             m_uidMgr->TryUnregisterObject(m_uID);
             m_uidMgr->RegisterObject(value, *this);
@@ -888,6 +875,7 @@ namespace generated
 
     void CPACSMaterial::SetName(const std::string& value)
     {
+        m_dirty = true;
         m_name = value;
     }
 
@@ -898,6 +886,7 @@ namespace generated
 
     void CPACSMaterial::SetDescription(const boost::optional<std::string>& value)
     {
+        m_dirty = true;
         m_description = value;
     }
 
@@ -908,6 +897,7 @@ namespace generated
 
     void CPACSMaterial::SetRho(const double& value)
     {
+        m_dirty = true;
         m_rho = value;
     }
 
@@ -918,6 +908,7 @@ namespace generated
 
     void CPACSMaterial::SetK11(const double& value)
     {
+        m_dirty = true;
         m_k11 = value;
     }
 
@@ -928,6 +919,7 @@ namespace generated
 
     void CPACSMaterial::SetK12(const double& value)
     {
+        m_dirty = true;
         m_k12 = value;
     }
 
@@ -938,6 +930,7 @@ namespace generated
 
     void CPACSMaterial::SetMaxStrain(const boost::optional<double>& value)
     {
+        m_dirty = true;
         m_maxStrain = value;
     }
 
@@ -948,6 +941,7 @@ namespace generated
 
     void CPACSMaterial::SetFatigueFactor(const boost::optional<double>& value)
     {
+        m_dirty = true;
         m_fatigueFactor = value;
     }
 
@@ -968,6 +962,7 @@ namespace generated
 
     void CPACSMaterial::SetThermalConductivity(const boost::optional<double>& value)
     {
+        m_dirty = true;
         m_thermalConductivity = value;
     }
 
@@ -998,6 +993,7 @@ namespace generated
 
     void CPACSMaterial::SetSig11_choice1(const boost::optional<double>& value)
     {
+        m_dirty = true;
         m_sig11_choice1 = value;
     }
 
@@ -1008,6 +1004,7 @@ namespace generated
 
     void CPACSMaterial::SetTau12_choice1(const boost::optional<double>& value)
     {
+        m_dirty = true;
         m_tau12_choice1 = value;
     }
 
@@ -1018,6 +1015,7 @@ namespace generated
 
     void CPACSMaterial::SetSig11yieldT_choice1(const boost::optional<double>& value)
     {
+        m_dirty = true;
         m_sig11yieldT_choice1 = value;
     }
 
@@ -1028,6 +1026,7 @@ namespace generated
 
     void CPACSMaterial::SetSig11yieldC_choice1(const boost::optional<double>& value)
     {
+        m_dirty = true;
         m_sig11yieldC_choice1 = value;
     }
 
@@ -1038,6 +1037,7 @@ namespace generated
 
     void CPACSMaterial::SetK22_choice2(const boost::optional<double>& value)
     {
+        m_dirty = true;
         m_k22_choice2 = value;
     }
 
@@ -1048,6 +1048,7 @@ namespace generated
 
     void CPACSMaterial::SetK23_choice2(const boost::optional<double>& value)
     {
+        m_dirty = true;
         m_k23_choice2 = value;
     }
 
@@ -1058,6 +1059,7 @@ namespace generated
 
     void CPACSMaterial::SetK66_choice2(const boost::optional<double>& value)
     {
+        m_dirty = true;
         m_k66_choice2 = value;
     }
 
@@ -1068,6 +1070,7 @@ namespace generated
 
     void CPACSMaterial::SetSig11t_choice2(const boost::optional<double>& value)
     {
+        m_dirty = true;
         m_sig11t_choice2 = value;
     }
 
@@ -1078,6 +1081,7 @@ namespace generated
 
     void CPACSMaterial::SetSig11c_choice2(const boost::optional<double>& value)
     {
+        m_dirty = true;
         m_sig11c_choice2 = value;
     }
 
@@ -1088,6 +1092,7 @@ namespace generated
 
     void CPACSMaterial::SetSig22t_choice2(const boost::optional<double>& value)
     {
+        m_dirty = true;
         m_sig22t_choice2 = value;
     }
 
@@ -1098,6 +1103,7 @@ namespace generated
 
     void CPACSMaterial::SetSig22c_choice2(const boost::optional<double>& value)
     {
+        m_dirty = true;
         m_sig22c_choice2 = value;
     }
 
@@ -1108,6 +1114,7 @@ namespace generated
 
     void CPACSMaterial::SetTau12_choice2(const boost::optional<double>& value)
     {
+        m_dirty = true;
         m_tau12_choice2 = value;
     }
 
@@ -1118,6 +1125,7 @@ namespace generated
 
     void CPACSMaterial::SetTau23_choice2(const boost::optional<double>& value)
     {
+        m_dirty = true;
         m_tau23_choice2 = value;
     }
 
@@ -1128,6 +1136,7 @@ namespace generated
 
     void CPACSMaterial::SetK13_choice3(const boost::optional<double>& value)
     {
+        m_dirty = true;
         m_k13_choice3 = value;
     }
 
@@ -1138,6 +1147,7 @@ namespace generated
 
     void CPACSMaterial::SetK22_choice3(const boost::optional<double>& value)
     {
+        m_dirty = true;
         m_k22_choice3 = value;
     }
 
@@ -1148,6 +1158,7 @@ namespace generated
 
     void CPACSMaterial::SetK23_choice3(const boost::optional<double>& value)
     {
+        m_dirty = true;
         m_k23_choice3 = value;
     }
 
@@ -1158,6 +1169,7 @@ namespace generated
 
     void CPACSMaterial::SetK33_choice3(const boost::optional<double>& value)
     {
+        m_dirty = true;
         m_k33_choice3 = value;
     }
 
@@ -1168,6 +1180,7 @@ namespace generated
 
     void CPACSMaterial::SetK44_choice3(const boost::optional<double>& value)
     {
+        m_dirty = true;
         m_k44_choice3 = value;
     }
 
@@ -1178,6 +1191,7 @@ namespace generated
 
     void CPACSMaterial::SetK55_choice3(const boost::optional<double>& value)
     {
+        m_dirty = true;
         m_k55_choice3 = value;
     }
 
@@ -1188,6 +1202,7 @@ namespace generated
 
     void CPACSMaterial::SetK66_choice3(const boost::optional<double>& value)
     {
+        m_dirty = true;
         m_k66_choice3 = value;
     }
 
@@ -1198,6 +1213,7 @@ namespace generated
 
     void CPACSMaterial::SetSig11t_choice3(const boost::optional<double>& value)
     {
+        m_dirty = true;
         m_sig11t_choice3 = value;
     }
 
@@ -1208,6 +1224,7 @@ namespace generated
 
     void CPACSMaterial::SetSig11c_choice3(const boost::optional<double>& value)
     {
+        m_dirty = true;
         m_sig11c_choice3 = value;
     }
 
@@ -1218,6 +1235,7 @@ namespace generated
 
     void CPACSMaterial::SetSig22t_choice3(const boost::optional<double>& value)
     {
+        m_dirty = true;
         m_sig22t_choice3 = value;
     }
 
@@ -1228,6 +1246,7 @@ namespace generated
 
     void CPACSMaterial::SetSig22c_choice3(const boost::optional<double>& value)
     {
+        m_dirty = true;
         m_sig22c_choice3 = value;
     }
 
@@ -1238,6 +1257,7 @@ namespace generated
 
     void CPACSMaterial::SetSig33t_choice3(const boost::optional<double>& value)
     {
+        m_dirty = true;
         m_sig33t_choice3 = value;
     }
 
@@ -1248,6 +1268,7 @@ namespace generated
 
     void CPACSMaterial::SetSig33c_choice3(const boost::optional<double>& value)
     {
+        m_dirty = true;
         m_sig33c_choice3 = value;
     }
 
@@ -1258,6 +1279,7 @@ namespace generated
 
     void CPACSMaterial::SetTau12_choice3(const boost::optional<double>& value)
     {
+        m_dirty = true;
         m_tau12_choice3 = value;
     }
 
@@ -1268,6 +1290,7 @@ namespace generated
 
     void CPACSMaterial::SetTau13_choice3(const boost::optional<double>& value)
     {
+        m_dirty = true;
         m_tau13_choice3 = value;
     }
 
@@ -1278,6 +1301,7 @@ namespace generated
 
     void CPACSMaterial::SetTau23_choice3(const boost::optional<double>& value)
     {
+        m_dirty = true;
         m_tau23_choice3 = value;
     }
 
@@ -1289,6 +1313,7 @@ namespace generated
 
     void CPACSMaterial::RemovePostFailure(CPACSPostFailure& ref)
     {
+        m_dirty = true;
         for (std::size_t i = 0; i < m_postFailures.size(); i++) {
             if (m_postFailures[i].get() == &ref) {
                 m_postFailures.erase(m_postFailures.begin() + i);
@@ -1307,6 +1332,7 @@ namespace generated
 
     void CPACSMaterial::RemoveSpecificHeatMap()
     {
+        m_dirty = true;
         m_specificHeatMap = boost::none;
     }
 
@@ -1319,6 +1345,7 @@ namespace generated
 
     void CPACSMaterial::RemoveEmissivityMap()
     {
+        m_dirty = true;
         m_emissivityMap = boost::none;
     }
 
@@ -68,6 +68,10 @@ namespace generated
         TIGL_EXPORT virtual void ReadCPACS(const TixiDocumentHandle& tixiHandle, const std::string& xpath);
         TIGL_EXPORT virtual void WriteCPACS(const TixiDocumentHandle& tixiHandle, const std::string& xpath) const;
 
+        TIGL_EXPORT virtual bool IsDirty() const;
+        TIGL_EXPORT virtual void ClearDirty();
+        TIGL_EXPORT virtual void WriteDirtyCPACS(const TixiDocumentHandle& tixiHandle, const std::string& xpath) const;
+
         TIGL_EXPORT bool ValidateChoices() const;
 
         TIGL_EXPORT virtual const std::string& GetUID() const;
@@ -333,6 +337,12 @@ namespace generated
         /// shear strength in 23 direction in [N/m^2]
         boost::optional<double>                    m_tau23_choice3;
 
+        /// Set by the setters, cleared after the object has been read or written
+        bool m_dirty;
+
+        /// List elements at the last call of ClearDirty
+        std::vector<const CPACSPostFailure*> m_postFailuresClean;
+
     private:
 #ifdef HAVE_CPP11
         CPACSMaterial(const CPACSMaterial&) = delete;
@@ -25,6 +25,7 @@ namespace tigl
 namespace generated
 {
     CPACSMaterialDefinition::CPACSMaterialDefinition()
+        : m_dirty(true)
     {
     }
 
@@ -35,35 +36,27 @@ namespace generated
     void CPACSMaterialDefinition::ReadCPACS(const TixiDocumentHandle& tixiHandle, const std::string& xpath)
     {
         // read element compositeUID
-        if (tixi::TixiCheckElement(tixiHandle, xpath + "/compositeUID")) {
-            m_compositeUID_choice1 = tixi::TixiGetElement<std::string>(tixiHandle, xpath + "/compositeUID");
+        if (tixi::TixiTryGetElement(tixiHandle, xpath + "/compositeUID", m_compositeUID_choice1)) {
             if (m_compositeUID_choice1->empty()) {
                 LOG(WARNING) << "Optional element compositeUID is present but empty at xpath " << xpath;
             }
         }
 
         // read element orthotropyDirection
-        if (tixi::TixiCheckElement(tixiHandle, xpath + "/orthotropyDirection")) {
-            m_orthotropyDirection_choice1 = tixi::TixiGetElement<double>(tixiHandle, xpath + "/orthotropyDirection");
-        }
+        tixi::TixiTryGetElement(tixiHandle, xpath + "/orthotropyDirection", m_orthotropyDirection_choice1);
 
         // read element thicknessScaling
-        if (tixi::TixiCheckElement(tixiHandle, xpath + "/thicknessScaling")) {
-            m_thicknessScaling_choice1 = tixi::TixiGetElement<double>(tixiHandle, xpath + "/thicknessScaling");
-        }
+        tixi::TixiTryGetElement(tixiHandle, xpath + "/thicknessScaling", m_thicknessScaling_choice1);
 
         // read element materialUID
-        if (tixi::TixiCheckElement(tixiHandle, xpath + "/materialUID")) {
-            m_materialUID_choice2 = tixi::TixiGetElement<std::string>(tixiHandle, xpath + "/materialUID");
+        if (tixi::TixiTryGetElement(tixiHandle, xpath + "/materialUID", m_materialUID_choice2)) {
             if (m_materialUID_choice2->empty()) {
                 LOG(WARNING) << "Optional element materialUID is present but empty at xpath " << xpath;
             }
         }
 
         // read element thickness
-        if (tixi::TixiCheckElement(tixiHandle, xpath + "/thickness")) {
-            m_thickness_choice2 = tixi::TixiGetElement<double>(tixiHandle, xpath + "/thickness");
-        }
+        tixi::TixiTryGetElement(tixiHandle, xpath + "/thickness", m_thickness_choice2);
 
         if (!ValidateChoices()) {
             LOG(ERROR) << "Invalid choice configuration at xpath " << xpath;
@@ -129,6 +122,23 @@ namespace generated
 
     }
 
+    bool CPACSMaterialDefinition::IsDirty() const
+    {
+        return m_dirty;
+    }
+
+    void CPACSMaterialDefinition::ClearDirty()
+    {
+        m_dirty = false;
+    }
+
+    void CPACSMaterialDefinition::WriteDirtyCPACS(const TixiDocumentHandle& tixiHandle, const std::string& xpath) const
+    {
+        if (m_dirty) {
+            WriteCPACS(tixiHandle, xpath);
+        }
+    }
+
     bool CPACSMaterialDefinition::ValidateChoices() const
     {
         return
@@ -178,6 +188,7 @@ namespace generated
 
     void CPACSMaterialDefinition::SetCompositeUID_choice1(const boost::optional<std::string>& value)
     {
+        m_dirty = true;
         m_compositeUID_choice1 = value;
     }
 
@@ -188,6 +199,7 @@ namespace generated
 
     void CPACSMaterialDefinition::SetOrthotropyDirection_choice1(const boost::optional<double>& value)
     {
+        m_dirty = true;
         m_orthotropyDirection_choice1 = value;
     }
 
@@ -198,6 +210,7 @@ namespace generated
 
     void CPACSMaterialDefinition::SetThicknessScaling_choice1(const boost::optional<double>& value)
     {
+        m_dirty = true;
         m_thicknessScaling_choice1 = value;
     }
 
@@ -208,6 +221,7 @@ namespace generated
 
     void CPACSMaterialDefinition::SetMaterialUID_choice2(const boost::optional<std::string>& value)
     {
+        m_dirty = true;
         m_materialUID_choice2 = value;
     }
 
@@ -218,6 +232,7 @@ namespace generated
 
     void CPACSMaterialDefinition::SetThickness_choice2(const boost::optional<double>& value)
     {
+        m_dirty = true;
         m_thickness_choice2 = value;
     }
 
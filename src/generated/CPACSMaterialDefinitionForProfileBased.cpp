@@ -25,6 +25,7 @@ namespace tigl
 namespace generated
 {
     CPACSMaterialDefinitionForProfileBased::CPACSMaterialDefinitionForProfileBased()
+        : m_dirty(true)
     {
     }
 
@@ -35,8 +36,7 @@ namespace generated
     void CPACSMaterialDefinitionForProfileBased::ReadCPACS(const TixiDocumentHandle& tixiHandle, const std::string& xpath)
     {
         // read element sheetUID
-        if (tixi::TixiCheckElement(tixiHandle, xpath + "/sheetUID")) {
-            m_sheetUID = tixi::TixiGetElement<std::string>(tixiHandle, xpath + "/sheetUID");
+        if (tixi::TixiTryGetElement(tixiHandle, xpath + "/sheetUID", m_sheetUID)) {
             if (m_sheetUID.empty()) {
                 LOG(WARNING) << "Required element sheetUID is empty at xpath " << xpath;
             }
@@ -46,35 +46,27 @@ namespace generated
         }
 
         // read element compositeUID
-        if (tixi::TixiCheckElement(tixiHandle, xpath + "/compositeUID")) {
-            m_compositeUID_choice1 = tixi::TixiGetElement<std::string>(tixiHandle, xpath + "/compositeUID");
+        if (tixi::TixiTryGetElement(tixiHandle, xpath + "/compositeUID", m_compositeUID_choice1)) {
             if (m_compositeUID_choice1->empty()) {
                 LOG(WARNING) << "Optional element compositeUID is present but empty at xpath " << xpath;
             }
         }
 
         // read element orthotropyDirection
-        if (tixi::TixiCheckElement(tixiHandle, xpath + "/orthotropyDirection")) {
-            m_orthotropyDirection_choice1 = tixi::TixiGetElement<double>(tixiHandle, xpath + "/orthotropyDirection");
-        }
+        tixi::TixiTryGetElement(tixiHandle, xpath + "/orthotropyDirection", m_orthotropyDirection_choice1);
 
         // read element thicknessScaling
-        if (tixi::TixiCheckElement(tixiHandle, xpath + "/thicknessScaling")) {
-            m_thicknessScaling_choice1 = tixi::TixiGetElement<double>(tixiHandle, xpath + "/thicknessScaling");
-        }
+        tixi::TixiTryGetElement(tixiHandle, xpath + "/thicknessScaling", m_thicknessScaling_choice1);
 
         // read element materialUID
-        if (tixi::TixiCheckElement(tixiHandle, xpath + "/materialUID")) {
-            m_materialUID_choice2 = tixi::TixiGetElement<std::string>(tixiHandle, xpath + "/materialUID");
+        if (tixi::TixiTryGetElement(tixiHandle, xpath + "/materialUID", m_materialUID_choice2)) {
             if (m_materialUID_choice2->empty()) {
                 LOG(WARNING) << "Optional element materialUID is present but empty at xpath " << xpath;
             }
         }
 
         // read element thickness
-        if (tixi::TixiCheckElement(tixiHandle, xpath + "/thickness")) {
-            m_thickness_choice2 = tixi::TixiGetElement<double>(tixiHandle, xpath + "/thickness");
-        }
+        tixi::TixiTryGetElement(tixiHandle, xpath + "/thickness", m_thickness_choice2);
 
         if (!ValidateChoices()) {
             LOG(ERROR) << "Invalid choice configuration at xpath " << xpath;
@@ -144,6 +136,23 @@ namespace generated
 
     }
 
+    bool CPACSMaterialDefinitionForProfileBased::IsDirty() const
+    {
+        return m_dirty;
+    }
+
+    void CPACSMaterialDefinitionForProfileBased::ClearDirty()
+    {
+        m_dirty = false;
+    }
+
+    void CPACSMaterialDefinitionForProfileBased::WriteDirtyCPACS(const TixiDocumentHandle& tixiHandle, const std::string& xpath) const
+    {
+        if (m_dirty) {
+            WriteCPACS(tixiHandle, xpath);
+        }
+    }
+
     bool CPACSMaterialDefinitionForProfileBased::ValidateChoices() const
     {
         return
@@ -193,6 +202,7 @@ namespace generated
 
     void CPACSMaterialDefinitionForProfileBased::SetSheetUID(const std::string& value)
     {
+        m_dirty = true;
         m_sheetUID = value;
     }
 
@@ -203,6 +213,7 @@ namespace generated
 
     void CPACSMaterialDefinitionForProfileBased::SetCompositeUID_choice1(const boost::optional<std::string>& value)
     {
+        m_dirty = true;
         m_compositeUID_choice1 = value;
     }
 
@@ -213,6 +224,7 @@ namespace generated
 
     void CPACSMaterialDefinitionForProfileBased::SetOrthotropyDirection_choice1(const boost::optional<double>& value)
     {
+        m_dirty = true;
         m_orthotropyDirection_choice1 = value;
     }
 
@@ -223,6 +235,7 @@ namespace generated
 
     void CPACSMaterialDefinitionForProfileBased::SetThicknessScaling_choice1(const boost::optional<double>& value)
     {
+        m_dirty = true;
         m_thicknessScaling_choice1 = value;
     }
 
@@ -233,6 +246,7 @@ namespace generated
 
     void CPACSMaterialDefinitionForProfileBased::SetMaterialUID_choice2(const boost::optional<std::string>& value)
     {
+        m_dirty = true;
         m_materialUID_choice2 = value;
     }
 
@@ -243,6 +257,7 @@ namespace generated
 
     void CPACSMaterialDefinitionForProfileBased::SetThickness_choice2(const boost::optional<double>& value)
     {
+        m_dirty = true;
         m_thickness_choice2 = value;
     }
 
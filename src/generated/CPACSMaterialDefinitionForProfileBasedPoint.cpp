@@ -26,6 +26,7 @@ namespace generated
 {
     CPACSMaterialDefinitionForProfileBasedPoint::CPACSMaterialDefinitionForProfileBasedPoint()
         : m_crossSectionArea(0)
+        , m_dirty(true)
     {
     }
 
@@ -36,16 +37,14 @@ namespace generated
     void CPACSMaterialDefinitionForProfileBasedPoint::ReadCPACS(const TixiDocumentHandle& tixiHandle, const std::string& xpath)
     {
         // read element pointUID
-        if (tixi::TixiCheckElement(tixiHandle, xpath + "/pointUID")) {
-            m_pointUID = tixi::TixiGetElement<std::string>(tixiHandle, xpath + "/pointUID");
+        if (tixi::TixiTryGetElement(tixiHandle, xpath + "/pointUID", m_pointUID)) {
             if (m_pointUID->empty()) {
                 LOG(WARNING) << "Optional element pointUID is present but empty at xpath " << xpath;
             }
         }
 
         // read element materialUID
-        if (tixi::TixiCheckElement(tixiHandle, xpath + "/materialUID")) {
-            m_materialUID = tixi::TixiGetElement<std::string>(tixiHandle, xpath + "/materialUID");
+        if (tixi::TixiTryGetElement(tixiHandle, xpath + "/materialUID", m_materialUID)) {
             if (m_materialUID.empty()) {
                 LOG(WARNING) << "Required element materialUID is empty at xpath " << xpath;
             }
@@ -55,22 +54,15 @@ namespace generated
         }
 
         // read element crossSectionArea
-        if (tixi::TixiCheckElement(tixiHandle, xpath + "/crossSectionArea")) {
-            m_crossSectionArea = tixi::TixiGetElement<double>(tixiHandle, xpath + "/crossSectionArea");
-        }
-        else {
+        if (!tixi::TixiTryGetElement(tixiHandle, xpath + "/crossSectionArea", m_crossSectionArea)) {
             LOG(ERROR) << "Required element crossSectionArea is missing at xpath " << xpath;
         }
 
         // read element optionalAux1
-        if (tixi::TixiCheckElement(tixiHandle, xpath + "/optionalAux1")) {
-            m_optionalAux1 = tixi::TixiGetElement<double>(tixiHandle, xpath + "/optionalAux1");
-        }
+        tixi::TixiTryGetElement(tixiHandle, xpath + "/optionalAux1", m_optionalAux1);
 
         // read element optionalAux2
-        if (tixi::TixiCheckElement(tixiHandle, xpath + "/optionalAux2")) {
-            m_optionalAux2 = tixi::TixiGetElement<double>(tixiHandle, xpath + "/optionalAux2");
-        }
+        tixi::TixiTryGetElement(tixiHandle, xpath + "/optionalAux2", m_optionalAux2);
 
     }
 
@@ -119,6 +111,23 @@ namespace generated
 
     }
 
+    bool CPACSMaterialDefinitionForProfileBasedPoint::IsDirty() const
+    {
+        return m_dirty;
+    }
+
+    void CPACSMaterialDefinitionForProfileBasedPoint::ClearDirty()
+    {
+        m_dirty = false;
+    }
+
+    void CPACSMaterialDefinitionForProfileBasedPoint::WriteDirtyCPACS(const TixiDocumentHandle& tixiHandle, const std::string& xpath) const
+    {
+        if (m_dirty) {
+            WriteCPACS(tixiHandle, xpath);
+        }
+    }
+
     const boost::optional<std::string>& CPACSMaterialDefinitionForProfileBasedPoint::GetPointUID() const
     {
         return m_pointUID;
@@ -126,6 +135,7 @@ namespace generated
 
     void CPACSMaterialDefinitionForProfileBasedPoint::SetPointUID(const boost::optional<std::string>& value)
     {
+        m_dirty = true;
         m_pointUID = value;
     }
 
@@ -136,6 +146,7 @@ namespace generated
 
     void CPACSMaterialDefinitionForProfileBasedPoint::SetMaterialUID(const std::string& value)
     {
+        m_dirty = true;
         m_materialUID = value;
     }
 
@@ -146,6 +157,7 @@ namespace generated
 
     void CPACSMaterialDefinitionForProfileBasedPoint::SetCrossSectionArea(const double& value)
     {
+        m_dirty = true;
         m_crossSectionArea = value;
     }
 
@@ -156,6 +168,7 @@ namespace generated
 
     void CPACSMaterialDefinitionForProfileBasedPoint::SetOptionalAux1(const boost::optional<double>& value)
     {
+        m_dirty = true;
         m_optionalAux1 = value;
     }
 
@@ -166,6 +179,7 @@ namespace generated
 
     void CPACSMaterialDefinitionForProfileBasedPoint::SetOptionalAux2(const boost::optional<double>& value)
     {
+        m_dirty = true;
         m_optionalAux2 = value;
     }
 
@@ -28,6 +28,7 @@ namespace generated
 {
     CPACSMaterials::CPACSMaterials(CTiglUIDManager* uidMgr)
         : m_uidMgr(uidMgr)
+        , m_dirty(true)
     {
     }
 
@@ -83,6 +84,55 @@ namespace generated
 
     }
 
+    bool CPACSMaterials::IsDirty() const
+    {
+        if (m_dirty) {
+            return true;
+        }
+        if (m_materials.size() != m_materialsClean.size()) {
+            return true;
+        }
+        for (std::size_t i = 0; i < m_materials.size(); i++) {
+            if (m_materials[i].get() != m_materialsClean[i] || m_materials[i]->IsDirty()) {
+                return true;
+            }
+        }
+        if (m_composites && m_composites->IsDirty()) {
+            return true;
+        }
+        return false;
+    }
+
+    void CPACSMaterials::ClearDirty()
+    {
+        m_dirty = false;
+        m_materialsClean.clear();
+        for (std::size_t i = 0; i < m_materials.size(); i++) {
+            m_materialsClean.push_back(m_materials[i].get());
+            m_materials[i]->ClearDirty();
+        }
+        if (m_composites) {
+            m_composites->ClearDirty();
+        }
+    }
+
+    void CPACSMaterials::WriteDirtyCPACS(const TixiDocumentHandle& tixiHandle, const std::string& xpath) const
+    {
+        if (m_dirty) {
+            WriteCPACS(tixiHandle, xpath);
+            return;
+        }
+
+        // write modified elements material
+        tixi::TixiSaveDirtyElements(tixiHandle, xpath + "/material", m_materials, m_materialsClean);
+
+        // write modified element composites
+        if (m_composites && m_composites->IsDirty()) {
+            tixi::TixiCreateElementIfNotExists(tixiHandle, xpath + "/composites");
+            m_composites->WriteDirtyCPACS(tixiHandle, xpath + "/composites");
+        }
+    }
+
     const std::vector<unique_ptr<CPACSMaterial> >& CPACSMaterials::GetMaterials() const
     {
         return m_materials;
@@ -111,6 +161,7 @@ namespace generated
 
     void CPACSMaterials::RemoveMaterial(CPACSMaterial& ref)
     {
+        m_dirty = true;
         for (std::size_t i = 0; i < m_materials.size(); i++) {
             if (m_materials[i].get() == &ref) {
                 m_materials.erase(m_materials.begin() + i);
@@ -129,6 +180,7 @@ namespace generated
 
     void CPACSMaterials::RemoveComposites()
     {
+        m_dirty = true;
         m_composites = boost::none;
     }
 
@@ -26,6 +26,7 @@ namespace generated
 {
     CPACSOuterCutOutProfile::CPACSOuterCutOutProfile()
         : m_rotZ(0)
+        , m_dirty(true)
     {
     }
 
@@ -36,8 +37,7 @@ namespace generated
     void CPACSOuterCutOutProfile::ReadCPACS(const TixiDocumentHandle& tixiHandle, const std::string& xpath)
     {
         // read element profileUID
-        if (tixi::TixiCheckElement(tixiHandle, xpath + "/profileUID")) {
-            m_profileUID = tixi::TixiGetElement<std::string>(tixiHandle, xpath + "/profileUID");
+        if (tixi::TixiTryGetElement(tixiHandle, xpath + "/profileUID", m_profileUID)) {
             if (m_profileUID.empty()) {
                 LOG(WARNING) << "Required element profileUID is empty at xpath " << xpath;
             }
@@ -47,10 +47,7 @@ namespace generated
         }
 
         // read element rotZ
-        if (tixi::TixiCheckElement(tixiHandle, xpath + "/rotZ")) {
-            m_rotZ = tixi::TixiGetElement<double>(tixiHandle, xpath + "/rotZ");
-        }
-        else {
+        if (!tixi::TixiTryGetElement(tixiHandle, xpath + "/rotZ", m_rotZ)) {
             LOG(ERROR) << "Required element rotZ is missing at xpath " << xpath;
         }
 
@@ -68,6 +65,23 @@ namespace generated
 
     }
 
+    bool CPACSOuterCutOutProfile::IsDirty() const
+    {
+        return m_dirty;
+    }
+
+    void CPACSOuterCutOutProfile::ClearDirty()
+    {
+        m_dirty = false;
+    }
+
+    void CPACSOuterCutOutProfile::WriteDirtyCPACS(const TixiDocumentHandle& tixiHandle, const std::string& xpath) const
+    {
+        if (m_dirty) {
+            WriteCPACS(tixiHandle, xpath);
+        }
+    }
+
     const std::string& CPACSOuterCutOutProfile::GetProfileUID() const
     {
         return m_profileUID;
@@ -75,6 +89,7 @@ namespace generated
 
     void CPACSOuterCutOutProfile::SetProfileUID(const std::string& value)
     {
+        m_dirty = true;
         m_profileUID = value;
     }
 
@@ -85,6 +100,7 @@ namespace generated
 
     void CPACSOuterCutOutProfile::SetRotZ(const double& value)
     {
+        m_dirty = true;
         m_rotZ = value;
     }
 
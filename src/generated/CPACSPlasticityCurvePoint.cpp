@@ -27,6 +27,7 @@ namespace generated
     CPACSPlasticityCurvePoint::CPACSPlasticityCurvePoint()
         : m_tangentModulus(0)
         , m_trueStress(0)
+        , m_dirty(true)
     {
     }
 
@@ -37,18 +38,12 @@ namespace generated
     void CPACSPlasticityCurvePoint::ReadCPACS(const TixiDocumentHandle& tixiHandle, const std::string& xpath)
     {
         // read element tangentModulus
-        if (tixi::TixiCheckElement(tixiHandle, xpath + "/tangentModulus")) {
-            m_tangentModulus = tixi::TixiGetElement<double>(tixiHandle, xpath + "/tangentModulus");
-        }
-        else {
+        if (!tixi::TixiTryGetElement(tixiHandle, xpath + "/tangentModulus", m_tangentModulus)) {
             LOG(ERROR) << "Required element tangentModulus is missing at xpath " << xpath;
         }
 
         // read element trueStress
-        if (tixi::TixiCheckElement(tixiHandle, xpath + "/trueStress")) {
-            m_trueStress = tixi::TixiGetElement<double>(tixiHandle, xpath + "/trueStress");
-        }
-        else {
+        if (!tixi::TixiTryGetElement(tixiHandle, xpath + "/trueStress", m_trueStress)) {
             LOG(ERROR) << "Required element trueStress is missing at xpath " << xpath;
         }
 
@@ -66,6 +61,23 @@ namespace generated
 
     }
 
+    bool CPACSPlasticityCurvePoint::IsDirty() const
+    {
+        return m_dirty;
+    }
+
+    void CPACSPlasticityCurvePoint::ClearDirty()
+    {
+        m_dirty = false;
+    }
+
+    void CPACSPlasticityCurvePoint::WriteDirtyCPACS(const TixiDocumentHandle& tixiHandle, const std::string& xpath) const
+    {
+        if (m_dirty) {
+            WriteCPACS(tixiHandle, xpath);
+        }
+    }
+
     const double& CPACSPlasticityCurvePoint::GetTangentModulus() const
     {
         return m_tangentModulus;
@@ -73,6 +85,7 @@ namespace generated
 
     void CPACSPlasticityCurvePoint::SetTangentModulus(const double& value)
     {
+        m_dirty = true;
         m_tangentModulus = value;
     }
 
@@ -83,6 +96,7 @@ namespace generated
 
     void CPACSPlasticityCurvePoint::SetTrueStress(const double& value)
     {
+        m_dirty = true;
         m_trueStress = value;
     }
 
@@ -27,6 +27,7 @@ namespace generated
 {
     CPACSPoint::CPACSPoint(CTiglUIDManager* uidMgr)
         : m_uidMgr(uidMgr)
+        , m_dirty(true)
     {
     }
 
@@ -48,8 +49,7 @@ namespace generated
     void CPACSPoint::ReadCPACS(const TixiDocumentHandle& tixiHandle, const std::string& xpath)
     {
         // read attribute uID
-        if (tixi::TixiCheckAttribute(tixiHandle, xpath, "uID")) {
-            m_uID = tixi::TixiGetAttribute<std::string>(tixiHandle, xpath, "uID");
+        if (tixi::TixiTryGetAttribute(tixiHandle, xpath, "uID", m_uID)) {
             if (m_uID.empty()) {
                 LOG(WARNING) << "Required attribute uID is empty at xpath " << xpath;
             }
@@ -59,19 +59,13 @@ namespace generated
         }
 
         // read element x
-        if (tixi::TixiCheckElement(tixiHandle, xpath + "/x")) {
-            m_x = tixi::TixiGetElement<double>(tixiHandle, xpath + "/x");
-        }
+        tixi::TixiTryGetElement(tixiHandle, xpath + "/x", m_x);
 
         // read element y
-        if (tixi::TixiCheckElement(tixiHandle, xpath + "/y")) {
-            m_y = tixi::TixiGetElement<double>(tixiHandle, xpath + "/y");
-        }
+        tixi::TixiTryGetElement(tixiHandle, xpath + "/y", m_y);
 
         // read element z
-        if (tixi::TixiCheckElement(tixiHandle, xpath + "/z")) {
-            m_z = tixi::TixiGetElement<double>(tixiHandle, xpath + "/z");
-        }
+        tixi::TixiTryGetElement(tixiHandle, xpath + "/z", m_z);
 
         if (m_uidMgr && !m_uID.empty()) m_uidMgr->RegisterObject(m_uID, *this);
     }
@@ -116,6 +110,23 @@ namespace generated
 
     }
 
+    bool CPACSPoint::IsDirty() const
+    {
+        return m_dirty;
+    }
+
+    void CPACSPoint::ClearDirty()
+    {
+        m_dirty = false;
+    }
+
+    void CPACSPoint::WriteDirtyCPACS(const TixiDocumentHandle& tixiHandle, const std::string& xpath) const
+    {
+        if (m_dirty) {
+            WriteCPACS(tixiHandle, xpath);
+        }
+    }
+
     const std::string& CPACSPoint::GetUID() const
     {
         return m_uID;
@@ -123,6 +134,7 @@ namespace generated
 
     void CPACSPoint::SetUID(const std::string& value)
     {
+        m_dirty = true;
         if (m_uidMgr) {
             m_uidMgr->TryUnregisterObject(m_uID);
             m_uidMgr->RegisterObject(value, *this);
@@ -137,6 +149,7 @@ namespace generated
 
     void CPACSPoint::SetX(const boost::optional<double>& value)
     {
+        m_dirty = true;
         m_x = value;
     }
 
@@ -147,6 +160,7 @@ namespace generated
 
     void CPACSPoint::SetY(const boost::optional<double>& value)
     {
+        m_dirty = true;
         m_y = value;
     }
 
@@ -157,6 +171,7 @@ namespace generated
 
     void CPACSPoint::SetZ(const boost::optional<double>& value)
     {
+        m_dirty = true;
         m_z = value;
     }
 
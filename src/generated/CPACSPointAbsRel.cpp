@@ -27,6 +27,7 @@ namespace generated
 {
     CPACSPointAbsRel::CPACSPointAbsRel(CTiglUIDManager* uidMgr)
         : m_uidMgr(uidMgr)
+        , m_dirty(true)
     {
     }
 
@@ -48,8 +49,7 @@ namespace generated
     void CPACSPointAbsRel::ReadCPACS(const TixiDocumentHandle& tixiHandle, const std::string& xpath)
     {
         // read attribute uID
-        if (tixi::TixiCheckAttribute(tixiHandle, xpath, "uID")) {
-            m_uID = tixi::TixiGetAttribute<std::string>(tixiHandle, xpath, "uID");
+        if (tixi::TixiTryGetAttribute(tixiHandle, xpath, "uID", m_uID)) {
             if (m_uID.empty()) {
                 LOG(WARNING) << "Required attribute uID is empty at xpath " << xpath;
             }
@@ -64,19 +64,13 @@ namespace generated
         }
 
         // read element x
-        if (tixi::TixiCheckElement(tixiHandle, xpath + "/x")) {
-            m_x = tixi::TixiGetElement<double>(tixiHandle, xpath + "/x");
-        }
+        tixi::TixiTryGetElement(tixiHandle, xpath + "/x", m_x);
 
         // read element y
-        if (tixi::TixiCheckElement(tixiHandle, xpath + "/y")) {
-            m_y = tixi::TixiGetElement<double>(tixiHandle, xpath + "/y");
-        }
+        tixi::TixiTryGetElement(tixiHandle, xpath + "/y", m_y);
 
         // read element z
-        if (tixi::TixiCheckElement(tixiHandle, xpath + "/z")) {
-            m_z = tixi::TixiGetElement<double>(tixiHandle, xpath + "/z");
-        }
+        tixi::TixiTryGetElement(tixiHandle, xpath + "/z", m_z);
 
         if (m_uidMgr && !m_uID.empty()) m_uidMgr->RegisterObject(m_uID, *this);
     }
@@ -131,6 +125,23 @@ namespace generated
 
     }
 
+    bool CPACSPointAbsRel::IsDirty() const
+    {
+        return m_dirty;
+    }
+
+    void CPACSPointAbsRel::ClearDirty()
+    {
+        m_dirty = false;
+    }
+
+    void CPACSPointAbsRel::WriteDirtyCPACS(const TixiDocumentHandle& tixiHandle, const std::string& xpath) const
+    {
+        if (m_dirty) {
+            WriteCPACS(tixiHandle, xpath);
+        }
+    }
+
     const std::string& CPACSPointAbsRel::GetUID() const
     {
         return m_uID;
@@ -138,6 +149,7 @@ namespace generated
 
     void CPACSPointAbsRel::SetUID(const std::string& value)
     {
+        m_dirty = true;
         if (m_uidMgr) {
             m_uidMgr->TryUnregisterObject(m_uID);
             m_uidMgr->RegisterObject(value, *this);
@@ -152,6 +164,7 @@ namespace generated
 
     void CPACSPointAbsRel::SetRefType(const boost::optional<ECPACSTranslationType>& value)
     {
+        m_dirty = true;
         m_refType = value;
     }
 
@@ -162,6 +175,7 @@ namespace generated
 
     void CPACSPointAbsRel::SetX(const boost::optional<double>& value)
     {
+        m_dirty = true;
         m_x = value;
     }
 
@@ -172,6 +186,7 @@ namespace generated
 
     void CPACSPointAbsRel::SetY(const boost::optional<double>& value)
     {
+        m_dirty = true;
         m_y = value;
     }
 
@@ -182,6 +197,7 @@ namespace generated
 
     void CPACSPointAbsRel::SetZ(const boost::optional<double>& value)
     {
+        m_dirty = true;
         m_z = value;
     }
 
@@ -28,6 +28,7 @@ namespace generated
 {
     CPACSPointList::CPACSPointList(CTiglUIDManager* uidMgr)
         : m_uidMgr(uidMgr)
+        , m_dirty(true)
     {
     }
 
@@ -61,6 +62,43 @@ namespace generated
 
     }
 
+    bool CPACSPointList::IsDirty() const
+    {
+        if (m_dirty) {
+            return true;
+        }
+        if (m_points.size() != m_pointsClean.size()) {
+            return true;
+        }
+        for (std::size_t i = 0; i < m_points.size(); i++) {
+            if (m_points[i].get() != m_pointsClean[i] || m_points[i]->IsDirty()) {
+                return true;
+            }
+        }
+        return false;
+    }
+
+    void CPACSPointList::ClearDirty()
+    {
+        m_dirty = false;
+        m_pointsClean.clear();
+        for (std::size_t i = 0; i < m_points.size(); i++) {
+            m_pointsClean.push_back(m_points[i].get());
+            m_points[i]->ClearDirty();
+        }
+    }
+
+    void CPACSPointList::WriteDirtyCPACS(const TixiDocumentHandle& tixiHandle, const std::string& xpath) const
+    {
+        if (m_dirty) {
+            WriteCPACS(tixiHandle, xpath);
+            return;
+        }
+
+        // write modified elements point
+        tixi::TixiSaveDirtyElements(tixiHandle, xpath + "/point", m_points, m_pointsClean);
+    }
+
     const std::vector<unique_ptr<CCPACSPoint> >& CPACSPointList::GetPoints() const
     {
         return m_points;
@@ -79,6 +117,7 @@ namespace generated
 
     void CPACSPointList::RemovePoint(CCPACSPoint& ref)
     {
+        m_dirty = true;
         for (std::size_t i = 0; i < m_points.size(); i++) {
             if (m_points[i].get() == &ref) {
                 m_points.erase(m_points.begin() + i);
@@ -25,6 +25,7 @@ namespace tigl
 namespace generated
 {
     CPACSPointListRelXYZVector::CPACSPointListRelXYZVector()
+        : m_dirty(true)
     {
     }
 
@@ -76,6 +77,57 @@ namespace generated
 
     }
 
+    bool CPACSPointListRelXYZVector::IsDirty() const
+    {
+        if (m_dirty) {
+            return true;
+        }
+        if (m_rX.IsDirty()) {
+            return true;
+        }
+        if (m_rY.IsDirty()) {
+            return true;
+        }
+        if (m_rZ.IsDirty()) {
+            return true;
+        }
+        return false;
+    }
+
+    void CPACSPointListRelXYZVector::ClearDirty()
+    {
+        m_dirty = false;
+        m_rX.ClearDirty();
+        m_rY.ClearDirty();
+        m_rZ.ClearDirty();
+    }
+
+    void CPACSPointListRelXYZVector::WriteDirtyCPACS(const TixiDocumentHandle& tixiHandle, const std::string& xpath) const
+    {
+        if (m_dirty) {
+            WriteCPACS(tixiHandle, xpath);
+            return;
+        }
+
+        // write modified element rX
+        if (m_rX.IsDirty()) {
+            tixi::TixiCreateElementIfNotExists(tixiHandle, xpath + "/rX");
+            m_rX.WriteDirtyCPACS(tixiHandle, xpath + "/rX");
+        }
+
+        // write modified element rY
+        if (m_rY.IsDirty()) {
+            tixi::TixiCreateElementIfNotExists(tixiHandle, xpath + "/rY");
+            m_rY.WriteDirtyCPACS(tixiHandle, xpath + "/rY");
+        }
+
+        // write modified element rZ
+        if (m_rZ.IsDirty()) {
+            tixi::TixiCreateElementIfNotExists(tixiHandle, xpath + "/rZ");
+            m_rZ.WriteDirtyCPACS(tixiHandle, xpath + "/rZ");
+        }
+    }
+
     const CCPACSStringVector& CPACSPointListRelXYZVector::GetRX() const
     {
         return m_rX;
@@ -25,6 +25,7 @@ namespace tigl
 namespace generated
 {
     CPACSPointListXYZVector::CPACSPointListXYZVector()
+        : m_dirty(true)
     {
     }
 
@@ -76,6 +77,57 @@ namespace generated
 
     }
 
+    bool CPACSPointListXYZVector::IsDirty() const
+    {
+        if (m_dirty) {
+            return true;
+        }
+        if (m_x.IsDirty()) {
+            return true;
+        }
+        if (m_y.IsDirty()) {
+            return true;
+        }
+        if (m_z.IsDirty()) {
+            return true;
+        }
+        return false;
+    }
+
+    void CPACSPointListXYZVector::ClearDirty()
+    {
+        m_dirty = false;
+        m_x.ClearDirty();
+        m_y.ClearDirty();
+        m_z.ClearDirty();
+    }
+
+    void CPACSPointListXYZVector::WriteDirtyCPACS(const TixiDocumentHandle& tixiHandle, const std::string& xpath) const
+    {
+        if (m_dirty) {
+            WriteCPACS(tixiHandle, xpath);
+            return;
+        }
+
+        // write modified element x
+        if (m_x.IsDirty()) {
+            tixi::TixiCreateElementIfNotExists(tixiHandle, xpath + "/x");
+            m_x.WriteDirtyCPACS(tixiHandle, xpath + "/x");
+        }
+
+        // write modified element y
+        if (m_y.IsDirty()) {
+            tixi::TixiCreateElementIfNotExists(tixiHandle, xpath + "/y");
+            m_y.WriteDirtyCPACS(tixiHandle, xpath + "/y");
+        }
+
+        // write modified element z
+        if (m_z.IsDirty()) {
+            tixi::TixiCreateElementIfNotExists(tixiHandle, xpath + "/z");
+            m_z.WriteDirtyCPACS(tixiHandle, xpath + "/z");
+        }
+    }
+
     const CCPACSStringVector& CPACSPointListXYZVector::GetX() const
     {
         return m_x;
@@ -28,6 +28,7 @@ namespace generated
     CPACSPointX::CPACSPointX(CTiglUIDManager* uidMgr)
         : m_uidMgr(uidMgr)
         , m_x(0)
+        , m_dirty(true)
     {
     }
 
@@ -49,8 +50,7 @@ namespace generated
     void CPACSPointX::ReadCPACS(const TixiDocumentHandle& tixiHandle, const std::string& xpath)
     {
         // read attribute uID
-        if (tixi::TixiCheckAttribute(tixiHandle, xpath, "uID")) {
-            m_uID = tixi::TixiGetAttribute<std::string>(tixiHandle, xpath, "uID");
+        if (tixi::TixiTryGetAttribute(tixiHandle, xpath, "uID", m_uID)) {
             if (m_uID.empty()) {
                 LOG(WARNING) << "Required attribute uID is empty at xpath " << xpath;
             }
@@ -60,10 +60,7 @@ namespace generated
         }
 
         // read element x
-        if (tixi::TixiCheckElement(tixiHandle, xpath + "/x")) {
-            m_x = tixi::TixiGetElement<double>(tixiHandle, xpath + "/x");
-        }
-        else {
+        if (!tixi::TixiTryGetElement(tixiHandle, xpath + "/x", m_x)) {
             LOG(ERROR) << "Required element x is missing at xpath " << xpath;
         }
 
@@ -81,6 +78,23 @@ namespace generated
 
     }
 
+    bool CPACSPointX::IsDirty() const
+    {
+        return m_dirty;
+    }
+
+    void CPACSPointX::ClearDirty()
+    {
+        m_dirty = false;
+    }
+
+    void CPACSPointX::WriteDirtyCPACS(const TixiDocumentHandle& tixiHandle, const std::string& xpath) const
+    {
+        if (m_dirty) {
+            WriteCPACS(tixiHandle, xpath);
+        }
+    }
+
     const std::string& CPACSPointX::GetUID() const
     {
         return m_uID;
@@ -88,6 +102,7 @@ namespace generated
 
     void CPACSPointX::SetUID(const std::string& value)
     {
+        m_dirty = true;
         if (m_uidMgr) {
             m_uidMgr->TryUnregisterObject(m_uID);
             m_uidMgr->RegisterObject(value, *this);
@@ -102,6 +117,7 @@ namespace generated
 
     void CPACSPointX::SetX(const double& value)
     {
+        m_dirty = true;
         m_x = value;
     }
 
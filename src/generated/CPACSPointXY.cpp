@@ -29,6 +29,7 @@ namespace generated
         : m_uidMgr(uidMgr)
         , m_x(0)
         , m_y(0)
+        , m_dirty(true)
     {
     }
 
@@ -50,8 +51,7 @@ namespace generated
     void CPACSPointXY::ReadCPACS(const TixiDocumentHandle& tixiHandle, const std::string& xpath)
     {
         // read attribute uID
-        if (tixi::TixiCheckAttribute(tixiHandle, xpath, "uID")) {
-            m_uID = tixi::TixiGetAttribute<std::string>(tixiHandle, xpath, "uID");
+        if (tixi::TixiTryGetAttribute(tixiHandle, xpath, "uID", m_uID)) {
             if (m_uID.empty()) {
                 LOG(WARNING) << "Required attribute uID is empty at xpath " << xpath;
             }
@@ -61,18 +61,12 @@ namespace generated
         }
 
         // read element x
-        if (tixi::TixiCheckElement(tixiHandle, xpath + "/x")) {
-            m_x = tixi::TixiGetElement<double>(tixiHandle, xpath + "/x");
-        }
-        else {
+        if (!tixi::TixiTryGetElement(tixiHandle, xpath + "/x", m_x)) {
             LOG(ERROR) << "Required element x is missing at xpath " << xpath;
         }
 
         // read element y
-        if (tixi::TixiCheckElement(tixiHandle, xpath + "/y")) {
-            m_y = tixi::TixiGetElement<double>(tixiHandle, xpath + "/y");
-        }
-        else {
+        if (!tixi::TixiTryGetElement(tixiHandle, xpath + "/y", m_y)) {
             LOG(ERROR) << "Required element y is missing at xpath " << xpath;
         }
 
@@ -94,6 +88,23 @@ namespace generated
 
     }
 
+    bool CPACSPointXY::IsDirty() const
+    {
+        return m_dirty;
+    }
+
+    void CPACSPointXY::ClearDirty()
+    {
+        m_dirty = false;
+    }
+
+    void CPACSPointXY::WriteDirtyCPACS(const TixiDocumentHandle& tixiHandle, const std::string& xpath) const
+    {
+        if (m_dirty) {
+            WriteCPACS(tixiHandle, xpath);
+        }
+    }
+
     const std::string& CPACSPointXY::GetUID() const
     {
         return m_uID;
@@ -101,6 +112,7 @@ namespace generated
 
     void CPACSPointXY::SetUID(const std::string& value)
     {
+        m_dirty = true;
         if (m_uidMgr) {
             m_uidMgr->TryUnregisterObject(m_uID);
             m_uidMgr->RegisterObject(value, *this);
@@ -115,6 +127,7 @@ namespace generated
 
     void CPACSPointXY::SetX(const double& value)
     {
+        m_dirty = true;
         m_x = value;
     }
 
@@ -125,6 +138,7 @@ namespace generated
 
     void CPACSPointXY::SetY(const double& value)
     {
+        m_dirty = true;
         m_y = value;
     }
 
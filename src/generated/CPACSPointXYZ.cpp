@@ -30,6 +30,7 @@ namespace generated
         , m_x(0)
         , m_y(0)
         , m_z(0)
+        , m_dirty(true)
     {
     }
 
@@ -51,8 +52,7 @@ namespace generated
     void CPACSPointXYZ::ReadCPACS(const TixiDocumentHandle& tixiHandle, const std::string& xpath)
     {
         // read attribute uID
-        if (tixi::TixiCheckAttribute(tixiHandle, xpath, "uID")) {
-            m_uID = tixi::TixiGetAttribute<std::string>(tixiHandle, xpath, "uID");
+        if (tixi::TixiTryGetAttribute(tixiHandle, xpath, "uID", m_uID)) {
             if (m_uID.empty()) {
                 LOG(WARNING) << "Required attribute uID is empty at xpath " << xpath;
             }
@@ -62,26 +62,17 @@ namespace generated
         }
 
         // read element x
-        if (tixi::TixiCheckElement(tixiHandle, xpath + "/x")) {
-            m_x = tixi::TixiGetElement<double>(tixiHandle, xpath + "/x");
-        }
-        else {
+        if (!tixi::TixiTryGetElement(tixiHandle, xpath + "/x", m_x)) {
             LOG(ERROR) << "Required element x is missing at xpath " << xpath;
         }
 
         // read element y
-        if (tixi::TixiCheckElement(tixiHandle, xpath + "/y")) {
-            m_y = tixi::TixiGetElement<double>(tixiHandle, xpath + "/y");
-        }
-        else {
+        if (!tixi::TixiTryGetElement(tixiHandle, xpath + "/y", m_y)) {
             LOG(ERROR) << "Required element y is missing at xpath " << xpath;
         }
 
         // read element z
-        if (tixi::TixiCheckElement(tixiHandle, xpath + "/z")) {
-            m_z = tixi::TixiGetElement<double>(tixiHandle, xpath + "/z");
-        }
-        else {
+        if (!tixi::TixiTryGetElement(tixiHandle, xpath + "/z", m_z)) {
             LOG(ERROR) << "Required element z is missing at xpath " << xpath;
         }
 
@@ -107,6 +98,23 @@ namespace generated
 
     }
 
+    bool CPACSPointXYZ::IsDirty() const
+    {
+        return m_dirty;
+    }
+
+    void CPACSPointXYZ::ClearDirty()
+    {
+        m_dirty = false;
+    }
+
+    void CPACSPointXYZ::WriteDirtyCPACS(const TixiDocumentHandle& tixiHandle, const std::string& xpath) const
+    {
+        if (m_dirty) {
+            WriteCPACS(tixiHandle, xpath);
+        }
+    }
+
     const std::string& CPACSPointXYZ::GetUID() const
     {
         return m_uID;
@@ -114,6 +122,7 @@ namespace generated
 
     void CPACSPointXYZ::SetUID(const std::string& value)
     {
+        m_dirty = true;
         if (m_uidMgr) {
             m_uidMgr->TryUnregisterObject(m_uID);
             m_uidMgr->RegisterObject(value, *this);
@@ -128,6 +137,7 @@ namespace generated
 
     void CPACSPointXYZ::SetX(const double& value)
     {
+        m_dirty = true;
         m_x = value;
     }
 
@@ -138,6 +148,7 @@ namespace generated
 
     void CPACSPointXYZ::SetY(const double& value)
     {
+        m_dirty = true;
         m_y = value;
     }
 
@@ -148,6 +159,7 @@ namespace generated
 
     void CPACSPointXYZ::SetZ(const double& value)
     {
+        m_dirty = true;
         m_z = value;
     }
 
@@ -29,6 +29,7 @@ namespace generated
         : m_uidMgr(uidMgr)
         , m_x(0)
         , m_z(0)
+        , m_dirty(true)
     {
     }
 
@@ -50,8 +51,7 @@ namespace generated
     void CPACSPointXZ::ReadCPACS(const TixiDocumentHandle& tixiHandle, const std::string& xpath)
     {
         // read attribute uID
-        if (tixi::TixiCheckAttribute(tixiHandle, xpath, "uID")) {
-            m_uID = tixi::TixiGetAttribute<std::string>(tixiHandle, xpath, "uID");
+        if (tixi::TixiTryGetAttribute(tixiHandle, xpath, "uID", m_uID)) {
             if (m_uID.empty()) {
                 LOG(WARNING) << "Required attribute uID is empty at xpath " << xpath;
             }
@@ -61,18 +61,12 @@ namespace generated
         }
 
         // read element x
-        if (tixi::TixiCheckElement(tixiHandle, xpath + "/x")) {
-            m_x = tixi::TixiGetElement<double>(tixiHandle, xpath + "/x");
-        }
-        else {
+        if (!tixi::TixiTryGetElement(tixiHandle, xpath + "/x", m_x)) {
             LOG(ERROR) << "Required element x is missing at xpath " << xpath;
         }
 
         // read element z
-        if (tixi::TixiCheckElement(tixiHandle, xpath + "/z")) {
-            m_z = tixi::TixiGetElement<double>(tixiHandle, xpath + "/z");
-        }
-        else {
+        if (!tixi::TixiTryGetElement(tixiHandle, xpath + "/z", m_z)) {
             LOG(ERROR) << "Required element z is missing at xpath " << xpath;
         }
 
@@ -94,6 +88,23 @@ namespace generated
 
     }
 
+    bool CPACSPointXZ::IsDirty() const
+    {
+        return m_dirty;
+    }
+
+    void CPACSPointXZ::ClearDirty()
+    {
+        m_dirty = false;
+    }
+
+    void CPACSPointXZ::WriteDirtyCPACS(const TixiDocumentHandle& tixiHandle, const std::string& xpath) const
+    {
+        if (m_dirty) {
+            WriteCPACS(tixiHandle, xpath);
+        }
+    }
+
     const std::string& CPACSPointXZ::GetUID() const
     {
         return m_uID;
@@ -101,6 +112,7 @@ namespace generated
 
     void CPACSPointXZ::SetUID(const std::string& value)
     {
+        m_dirty = true;
         if (m_uidMgr) {
             m_uidMgr->TryUnregisterObject(m_uID);
             m_uidMgr->RegisterObject(value, *this);
@@ -115,6 +127,7 @@ namespace generated
 
     void CPACSPointXZ::SetX(const double& value)
     {
+        m_dirty = true;
         m_x = value;
     }
 
@@ -125,6 +138,7 @@ namespace generated
 
     void CPACSPointXZ::SetZ(const double& value)
     {
+        m_dirty = true;
         m_z = value;
     }
 
@@ -28,6 +28,7 @@ namespace generated
     CPACSPointZ::CPACSPointZ(CTiglUIDManager* uidMgr)
         : m_uidMgr(uidMgr)
         , m_z(0)
+        , m_dirty(true)
     {
     }
 
@@ -49,8 +50,7 @@ namespace generated
     void CPACSPointZ::ReadCPACS(const TixiDocumentHandle& tixiHandle, const std::string& xpath)
     {
         // read attribute uID
-        if (tixi::TixiCheckAttribute(tixiHandle, xpath, "uID")) {
-            m_uID = tixi::TixiGetAttribute<std::string>(tixiHandle, xpath, "uID");
+        if (tixi::TixiTryGetAttribute(tixiHandle, xpath, "uID", m_uID)) {
             if (m_uID.empty()) {
                 LOG(WARNING) << "Required attribute uID is empty at xpath " << xpath;
             }
@@ -60,10 +60,7 @@ namespace generated
         }
 
         // read element z
-        if (tixi::TixiCheckElement(tixiHandle, xpath + "/z")) {
-            m_z = tixi::TixiGetElement<double>(tixiHandle, xpath + "/z");
-        }
-        else {
+        if (!tixi::TixiTryGetElement(tixiHandle, xpath + "/z", m_z)) {
             LOG(ERROR) << "Required element z is missing at xpath " << xpath;
         }
 
@@ -81,6 +78,23 @@ namespace generated
 
     }
 
+    bool CPACSPointZ::IsDirty() const
+    {
+        return m_dirty;
+    }
+
+    void CPACSPointZ::ClearDirty()
+    {
+        m_dirty = false;
+    }
+
+    void CPACSPointZ::WriteDirtyCPACS(const TixiDocumentHandle& tixiHandle, const std::string& xpath) const
+    {
+        if (m_dirty) {
+            WriteCPACS(tixiHandle, xpath);
+        }
+    }
+
     const std::string& CPACSPointZ::GetUID() const
     {
         return m_uID;
@@ -88,6 +102,7 @@ namespace generated
 
     void CPACSPointZ::SetUID(const std::string& value)
     {
+        m_dirty = true;
         if (m_uidMgr) {
             m_uidMgr->TryUnregisterObject(m_uID);
             m_uidMgr->RegisterObject(value, *this);
@@ -102,6 +117,7 @@ namespace generated
 
     void CPACSPointZ::SetZ(const double& value)
     {
+        m_dirty = true;
         m_z = value;
     }
 
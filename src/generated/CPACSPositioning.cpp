@@ -30,6 +30,7 @@ namespace generated
         , m_length(0)
         , m_sweepAngle(0)
         , m_dihedralAngle(0)
+        , m_dirty(true)
     {
     }
 
@@ -51,8 +52,7 @@ namespace generated
     void CPACSPositioning::ReadCPACS(const TixiDocumentHandle& tixiHandle, const std::string& xpath)
     {
         // read attribute uID
-        if (tixi::TixiCheckAttribute(tixiHandle, xpath, "uID")) {
-            m_uID = tixi::TixiGetAttribute<std::string>(tixiHandle, xpath, "uID");
+        if (tixi::TixiTryGetAttribute(tixiHandle, xpath, "uID", m_uID)) {
             if (m_uID.empty()) {
                 LOG(WARNING) << "Required attribute uID is empty at xpath " << xpath;
             }
@@ -62,8 +62,7 @@ namespace generated
         }
 
         // read element name
-        if (tixi::TixiCheckElement(tixiHandle, xpath + "/name")) {
-            m_name = tixi::TixiGetElement<std::string>(tixiHandle, xpath + "/name");
+        if (tixi::TixiTryGetElement(tixiHandle, xpath + "/name", m_name)) {
             if (m_name.empty()) {
                 LOG(WARNING) << "Required element name is empty at xpath " << xpath;
             }
@@ -73,48 +72,36 @@ namespace generated
         }
 
         // read element description
-        if (tixi::TixiCheckElement(tixiHandle, xpath + "/description")) {
-            m_description = tixi::TixiGetElement<std::string>(tixiHandle, xpath + "/description");
+        if (tixi::TixiTryGetElement(tixiHandle, xpath + "/description", m_description)) {
             if (m_description->empty()) {
                 LOG(WARNING) << "Optional element description is present but empty at xpath " << xpath;
             }
         }
 
         // read element length
-        if (tixi::TixiCheckElement(tixiHandle, xpath + "/length")) {
-            m_length = tixi::TixiGetElement<double>(tixiHandle, xpath + "/length");
-        }
-        else {
+        if (!tixi::TixiTryGetElement(tixiHandle, xpath + "/length", m_length)) {
             LOG(ERROR) << "Required element length is missing at xpath " << xpath;
         }
 
         // read element sweepAngle
-        if (tixi::TixiCheckElement(tixiHandle, xpath + "/sweepAngle")) {
-            m_sweepAngle = tixi::TixiGetElement<double>(tixiHandle, xpath + "/sweepAngle");
-        }
-        else {
+        if (!tixi::TixiTryGetElement(tixiHandle, xpath + "/sweepAngle", m_sweepAngle)) {
             LOG(ERROR) << "Required element sweepAngle is missing at xpath " << xpath;
         }
 
         // read element dihedralAngle
-        if (tixi::TixiCheckElement(tixiHandle, xpath + "/dihedralAngle")) {
-            m_dihedralAngle = tixi::TixiGetElement<double>(tixiHandle, xpath + "/dihedralAngle");
-        }
-        else {
+        if (!tixi::TixiTryGetElement(tixiHandle, xpath + "/dihedralAngle", m_dihedralAngle)) {
             LOG(ERROR) << "Required element dihedralAngle is missing at xpath " << xpath;
         }
 
         // read element fromSectionUID
-        if (tixi::TixiCheckElement(tixiHandle, xpath + "/fromSectionUID")) {
-            m_fromSectionUID = tixi::TixiGetElement<std::string>(tixiHandle, xpath + "/fromSectionUID");
+        if (tixi::TixiTryGetElement(tixiHandle, xpath + "/fromSectionUID", m_fromSectionUID)) {
             if (m_fromSectionUID->empty()) {
                 LOG(WARNING) << "Optional element fromSectionUID is present but empty at xpath " << xpath;
             }
         }
 
         // read element toSectionUID
-        if (tixi::TixiCheckElement(tixiHandle, xpath + "/toSectionUID")) {
-            m_toSectionUID = tixi::TixiGetElement<std::string>(tixiHandle, xpath + "/toSectionUID");
+        if (tixi::TixiTryGetElement(tixiHandle, xpath + "/toSectionUID", m_toSectionUID)) {
             if (m_toSectionUID.empty()) {
                 LOG(WARNING) << "Required element toSectionUID is empty at xpath " << xpath;
             }
@@ -175,6 +162,23 @@ namespace generated
 
     }
 
+    bool CPACSPositioning::IsDirty() const
+    {
+        return m_dirty;
+    }
+
+    void CPACSPositioning::ClearDirty()
+    {
+        m_dirty = false;
+    }
+
+    void CPACSPositioning::WriteDirtyCPACS(const TixiDocumentHandle& tixiHandle, const std::string& xpath) const
+    {
+        if (m_dirty) {
+            WriteCPACS(tixiHandle, xpath);
+        }
+    }
+
     const std::string& CPACSPositioning::GetUID() const
     {
         return m_uID;
@@ -182,6 +186,7 @@ namespace generated
 
     void CPACSPositioning::SetUID(const std::string& value)
     {
+        m_dirty = true;
         if (m_uidMgr) {
             m_uidMgr->TryUnregisterObject(m_uID);
             m_uidMgr->RegisterObject(value, *this);
@@ -196,6 +201,7 @@ namespace generated
 
     void CPACSPositioning::SetName(const std::string& value)
     {
+        m_dirty = true;
         m_name = value;
     }
 
@@ -206,6 +212,7 @@ namespace generated
 
     void CPACSPositioning::SetDescription(const boost::optional<std::string>& value)
     {
+        m_dirty = true;
         m_description = value;
     }
 
@@ -216,6 +223,7 @@ namespace generated
 
     void CPACSPositioning::SetLength(const double& value)
     {
+        m_dirty = true;
         m_length = value;
     }
 
@@ -226,6 +234,7 @@ namespace generated
 
     void CPACSPositioning::SetSweepAngle(const double& value)
     {
+        m_dirty = true;
         m_sweepAngle = value;
     }
 
@@ -236,6 +245,7 @@ namespace generated
 
     void CPACSPositioning::SetDihedralAngle(const double& value)
     {
+        m_dirty = true;
         m_dihedralAngle = value;
     }
 
@@ -246,6 +256,7 @@ namespace generated
 
     void CPACSPositioning::SetFromSectionUID(const boost::optional<std::string>& value)
     {
+        m_dirty = true;
         m_fromSectionUID = value;
     }
 
@@ -256,6 +267,7 @@ namespace generated
 
     void CPACSPositioning::SetToSectionUID(const std::string& value)
     {
+        m_dirty = true;
         m_toSectionUID = value;
     }
 
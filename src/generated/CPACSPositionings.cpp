@@ -28,6 +28,7 @@ namespace generated
 {
     CPACSPositionings::CPACSPositionings(CTiglUIDManager* uidMgr)
         : m_uidMgr(uidMgr)
+        , m_dirty(true)
     {
     }
 
@@ -61,6 +62,43 @@ namespace generated
 
     }
 
+    bool CPACSPositionings::IsDirty() const
+    {
+        if (m_dirty) {
+            return true;
+        }
+        if (m_positionings.size() != m_positioningsClean.size()) {
+            return true;
+        }
+        for (std::size_t i = 0; i < m_positionings.size(); i++) {
+            if (m_positionings[i].get() != m_positioningsClean[i] || m_positionings[i]->IsDirty()) {
+                return true;
+            }
+        }
+        return false;
+    }
+
+    void CPACSPositionings::ClearDirty()
+    {
+        m_dirty = false;
+        m_positioningsClean.clear();
+        for (std::size_t i = 0; i < m_positionings.size(); i++) {
+            m_positioningsClean.push_back(m_positionings[i].get());
+            m_positionings[i]->ClearDirty();
+        }
+    }
+
+    void CPACSPositionings::WriteDirtyCPACS(const TixiDocumentHandle& tixiHandle, const std::string& xpath) const
+    {
+        if (m_dirty) {
+            WriteCPACS(tixiHandle, xpath);
+            return;
+        }
+
+        // write modified elements positioning
+        tixi::TixiSaveDirtyElements(tixiHandle, xpath + "/positioning", m_positionings, m_positioningsClean);
+    }
+
     const std::vector<unique_ptr<CCPACSPositioning> >& CPACSPositionings::GetPositionings() const
     {
         return m_positionings;
@@ -79,6 +117,7 @@ namespace generated
 
     void CPACSPositionings::RemovePositioning(CCPACSPositioning& ref)
     {
+        m_dirty = true;
         for (std::size_t i = 0; i < m_positionings.size(); i++) {
             if (m_positionings[i].get() == &ref) {
                 m_positionings.erase(m_positionings.begin() + i);
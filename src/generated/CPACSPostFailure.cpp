@@ -26,6 +26,7 @@ namespace tigl
 namespace generated
 {
     CPACSPostFailure::CPACSPostFailure()
+        : m_dirty(true)
     {
     }
 
@@ -36,33 +37,28 @@ namespace generated
     void CPACSPostFailure::ReadCPACS(const TixiDocumentHandle& tixiHandle, const std::string& xpath)
     {
         // read element name
-        if (tixi::TixiCheckElement(tixiHandle, xpath + "/name")) {
-            m_name = tixi::TixiGetElement<std::string>(tixiHandle, xpath + "/name");
+        if (tixi::TixiTryGetElement(tixiHandle, xpath + "/name", m_name)) {
             if (m_name->empty()) {
                 LOG(WARNING) << "Optional element name is present but empty at xpath " << xpath;
             }
         }
 
         // read element description
-        if (tixi::TixiCheckElement(tixiHandle, xpath + "/description")) {
-            m_description = tixi::TixiGetElement<std::string>(tixiHandle, xpath + "/description");
+        if (tixi::TixiTryGetElement(tixiHandle, xpath + "/description", m_description)) {
             if (m_description->empty()) {
                 LOG(WARNING) << "Optional element description is present but empty at xpath " << xpath;
             }
         }
 
         // read element materialLaw
-        if (tixi::TixiCheckElement(tixiHandle, xpath + "/materialLaw")) {
-            m_materialLaw = tixi::TixiGetElement<std::string>(tixiHandle, xpath + "/materialLaw");
+        if (tixi::TixiTryGetElement(tixiHandle, xpath + "/materialLaw", m_materialLaw)) {
             if (m_materialLaw->empty()) {
                 LOG(WARNING) << "Optional element materialLaw is present but empty at xpath " << xpath;
             }
         }
 
         // read element plasticEliminationStrain
-        if (tixi::TixiCheckElement(tixiHandle, xpath + "/plasticEliminationStrain")) {
-            m_plasticEliminationStrain_choice1 = tixi::TixiGetElement<double>(tixiHandle, xpath + "/plasticEliminationStrain");
-        }
+        tixi::TixiTryGetElement(tixiHandle, xpath + "/plasticEliminationStrain", m_plasticEliminationStrain_choice1);
 
         // read element plasticityCurvePoint
         if (tixi::TixiCheckElement(tixiHandle, xpath + "/plasticityCurvePoint")) {
@@ -70,29 +66,19 @@ namespace generated
         }
 
         // read element initialEquivalentShearStrain
-        if (tixi::TixiCheckElement(tixiHandle, xpath + "/initialEquivalentShearStrain")) {
-            m_initialEquivalentShearStrain_choice2 = tixi::TixiGetElement<double>(tixiHandle, xpath + "/initialEquivalentShearStrain");
-        }
+        tixi::TixiTryGetElement(tixiHandle, xpath + "/initialEquivalentShearStrain", m_initialEquivalentShearStrain_choice2);
 
         // read element intermediateEquivalentShearStrain
-        if (tixi::TixiCheckElement(tixiHandle, xpath + "/intermediateEquivalentShearStrain")) {
-            m_intermediateEquivalentShearStrain_choice2 = tixi::TixiGetElement<double>(tixiHandle, xpath + "/intermediateEquivalentShearStrain");
-        }
+        tixi::TixiTryGetElement(tixiHandle, xpath + "/intermediateEquivalentShearStrain", m_intermediateEquivalentShearStrain_choice2);
 
         // read element ultimateEquivalentShearStrain
-        if (tixi::TixiCheckElement(tixiHandle, xpath + "/ultimateEquivalentShearStrain")) {
-            m_ultimateEquivalentShearStrain_choice2 = tixi::TixiGetElement<double>(tixiHandle, xpath + "/ultimateEquivalentShearStrain");
-        }
+        tixi::TixiTryGetElement(tixiHandle, xpath + "/ultimateEquivalentShearStrain", m_ultimateEquivalentShearStrain_choice2);
 
         // read element intermediateDamage
-        if (tixi::TixiCheckElement(tixiHandle, xpath + "/intermediateDamage")) {
-            m_intermediateDamage_choice2 = tixi::TixiGetElement<double>(tixiHandle, xpath + "/intermediateDamage");
-        }
+        tixi::TixiTryGetElement(tixiHandle, xpath + "/intermediateDamage", m_intermediateDamage_choice2);
 
         // read element ultimateDamage
-        if (tixi::TixiCheckElement(tixiHandle, xpath + "/ultimateDamage")) {
-            m_ultimateDamage_choice2 = tixi::TixiGetElement<double>(tixiHandle, xpath + "/ultimateDamage");
-        }
+        tixi::TixiTryGetElement(tixiHandle, xpath + "/ultimateDamage", m_ultimateDamage_choice2);
 
         if (!ValidateChoices()) {
             LOG(ERROR) << "Invalid choice configuration at xpath " << xpath;
@@ -205,6 +191,43 @@ namespace generated
 
     }
 
+    bool CPACSPostFailure::IsDirty() const
+    {
+        if (m_dirty) {
+            return true;
+        }
+        if (m_plasticityCurvePoints_choice1.size() != m_plasticityCurvePoints_choice1Clean.size()) {
+            return true;
+        }
+        for (std::size_t i = 0; i < m_plasticityCurvePoints_choice1.size(); i++) {
+            if (m_plasticityCurvePoints_choice1[i].get() != m_plasticityCurvePoints_choice1Clean[i] || m_plasticityCurvePoints_choice1[i]->IsDirty()) {
+                return true;
+            }
+        }
+        return false;
+    }
+
+    void CPACSPostFailure::ClearDirty()
+    {
+        m_dirty = false;
+        m_plasticityCurvePoints_choice1Clean.clear();
+        for (std::size_t i = 0; i < m_plasticityCurvePoints_choice1.size(); i++) {
+            m_plasticityCurvePoints_choice1Clean.push_back(m_plasticityCurvePoints_choice1[i].get());
+            m_plasticityCurvePoints_choice1[i]->ClearDirty();
+        }
+    }
+
+    void CPACSPostFailure::WriteDirtyCPACS(const TixiDocumentHandle& tixiHandle, const std::string& xpath) const
+    {
+        if (m_dirty) {
+            WriteCPACS(tixiHandle, xpath);
+            return;
+        }
+
+        // write modified elements plasticityCurvePoint
+        tixi::TixiSaveDirtyElements(tixiHandle, xpath + "/plasticityCurvePoint", m_plasticityCurvePoints_choice1, m_plasticityCurvePoints_choice1Clean);
+    }
+
     bool CPACSPostFailure::ValidateChoices() const
     {
         return
@@ -262,6 +285,7 @@ namespace generated
 
     void CPACSPostFailure::SetName(const boost::optional<std::string>& value)
     {
+        m_dirty = true;
         m_name = value;
     }
 
@@ -272,6 +296,7 @@ namespace generated
 
     void CPACSPostFailure::SetDescription(const boost::optional<std::string>& value)
     {
+        m_dirty = true;
         m_description = value;
     }
 
@@ -282,6 +307,7 @@ namespace generated
 
     void CPACSPostFailure::SetMaterialLaw(const boost::optional<std::string>& value)
     {
+        m_dirty = true;
         m_materialLaw = value;
     }
 
@@ -292,6 +318,7 @@ namespace generated
 
     void CPACSPostFailure::SetPlasticEliminationStrain_choice1(const boost::optional<double>& value)
     {
+        m_dirty = true;
         m_plasticEliminationStrain_choice1 = value;
     }
 
@@ -312,6 +339,7 @@ namespace generated
 
     void CPACSPostFailure::SetInitialEquivalentShearStrain_choice2(const boost::optional<double>& value)
     {
+        m_dirty = true;
         m_initialEquivalentShearStrain_choice2 = value;
     }
 
@@ -322,6 +350,7 @@ namespace generated
 
     void CPACSPostFailure::SetIntermediateEquivalentShearStrain_choice2(const boost::optional<double>& value)
     {
+        m_dirty = true;
         m_intermediateEquivalentShearStrain_choice2 = value;
     }
 
@@ -332,6 +361,7 @@ namespace generated
 
     void CPACSPostFailure::SetUltimateEquivalentShearStrain_choice2(const boost::optional<double>& value)
     {
+        m_dirty = true;
         m_ultimateEquivalentShearStrain_choice2 = value;
     }
 
@@ -342,6 +372,7 @@ namespace generated
 
     void CPACSPostFailure::SetIntermediateDamage_choice2(const boost::optional<double>& value)
     {
+        m_dirty = true;
         m_intermediateDamage_choice2 = value;
     }
 
@@ -352,6 +383,7 @@ namespace generated
 
     void CPACSPostFailure::SetUltimateDamage_choice2(const boost::optional<double>& value)
     {
+        m_dirty = true;
         m_ultimateDamage_choice2 = value;
     }
 
@@ -363,6 +395,7 @@ namespace generated
 
     void CPACSPostFailure::RemovePlasticityCurvePoint_choice1(CPACSPlasticityCurvePoint& ref)
     {
+        m_dirty = true;
         for (std::size_t i = 0; i < m_plasticityCurvePoints_choice1.size(); i++) {
             if (m_plasticityCurvePoints_choice1[i].get() == &ref) {
                 m_plasticityCurvePoints_choice1.erase(m_plasticityCurvePoints_choice1.begin() + i);
@@ -71,6 +71,10 @@ namespace generated
         TIGL_EXPORT virtual void ReadCPACS(const TixiDocumentHandle& tixiHandle, const std::string& xpath);
         TIGL_EXPORT virtual void WriteCPACS(const TixiDocumentHandle& tixiHandle, const std::string& xpath) const;
 
+        TIGL_EXPORT virtual bool IsDirty() const;
+        TIGL_EXPORT virtual void ClearDirty();
+        TIGL_EXPORT virtual void WriteDirtyCPACS(const TixiDocumentHandle& tixiHandle, const std::string& xpath) const;
+
         TIGL_EXPORT bool ValidateChoices() const;
 
         TIGL_EXPORT virtual const boost::optional<std::string>& GetName() const;
@@ -132,6 +136,12 @@ namespace generated
 
         boost::optional<double>                             m_ultimateDamage_choice2;
 
+        /// Set by the setters, cleared after the object has been read or written
+        bool m_dirty;
+
+        /// List elements at the last call of ClearDirty
+        std::vector<const CPACSPlasticityCurvePoint*> m_plasticityCurvePoints_choice1Clean;
+
     private:
 #ifdef HAVE_CPP11
         CPACSPostFailure(const CPACSPostFailure&) = delete;
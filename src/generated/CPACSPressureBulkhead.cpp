@@ -29,6 +29,7 @@ namespace generated
 {
     CPACSPressureBulkhead::CPACSPressureBulkhead(CCPACSPressureBulkheads* parent, CTiglUIDManager* uidMgr)
         : m_uidMgr(uidMgr)
+        , m_dirty(true)
     {
         //assert(parent != NULL);
         m_parent = parent;
@@ -62,8 +63,7 @@ namespace generated
     void CPACSPressureBulkhead::ReadCPACS(const TixiDocumentHandle& tixiHandle, const std::string& xpath)
     {
         // read attribute uID
-        if (tixi::TixiCheckAttribute(tixiHandle, xpath, "uID")) {
-            m_uID = tixi::TixiGetAttribute<std::string>(tixiHandle, xpath, "uID");
+        if (tixi::TixiTryGetAttribute(tixiHandle, xpath, "uID", m_uID)) {
             if (m_uID.empty()) {
                 LOG(WARNING) << "Required attribute uID is empty at xpath " << xpath;
             }
@@ -73,24 +73,21 @@ namespace generated
         }
 
         // read element name
-        if (tixi::TixiCheckElement(tixiHandle, xpath + "/name")) {
-            m_name = tixi::TixiGetElement<std::string>(tixiHandle, xpath + "/name");
+        if (tixi::TixiTryGetElement(tixiHandle, xpath + "/name", m_name)) {
             if (m_name->empty()) {
                 LOG(WARNING) << "Optional element name is present but empty at xpath " << xpath;
             }
         }
 
         // read element description
-        if (tixi::TixiCheckElement(tixiHandle, xpath + "/description")) {
-            m_description = tixi::TixiGetElement<std::string>(tixiHandle, xpath + "/description");
+        if (tixi::TixiTryGetElement(tixiHandle, xpath + "/description", m_description)) {
             if (m_description->empty()) {
                 LOG(WARNING) << "Optional element description is present but empty at xpath " << xpath;
             }
         }
 
         // read element sheetElementUID
-        if (tixi::TixiCheckElement(tixiHandle, xpath + "/sheetElementUID")) {
-            m_sheetElementUID = tixi::TixiGetElement<std::string>(tixiHandle, xpath + "/sheetElementUID");
+        if (tixi::TixiTryGetElement(tixiHandle, xpath + "/sheetElementUID", m_sheetElementUID)) {
             if (m_sheetElementUID.empty()) {
                 LOG(WARNING) << "Required element sheetElementUID is empty at xpath " << xpath;
             }
@@ -100,49 +97,36 @@ namespace generated
         }
 
         // read element reinforcementNumberVertical
-        if (tixi::TixiCheckElement(tixiHandle, xpath + "/reinforcementNumberVertical")) {
-            m_reinforcementNumberVertical_choice1 = tixi::TixiGetElement<int>(tixiHandle, xpath + "/reinforcementNumberVertical");
-        }
+        tixi::TixiTryGetElement(tixiHandle, xpath + "/reinforcementNumberVertical", m_reinforcementNumberVertical_choice1);
 
         // read element structuralElementVerticalUID
-        if (tixi::TixiCheckElement(tixiHandle, xpath + "/structuralElementVerticalUID")) {
-            m_structuralElementVerticalUID_choice1 = tixi::TixiGetElement<std::string>(tixiHandle, xpath + "/structuralElementVerticalUID");
+        if (tixi::TixiTryGetElement(tixiHandle, xpath + "/structuralElementVerticalUID", m_structuralElementVerticalUID_choice1)) {
             if (m_structuralElementVerticalUID_choice1->empty()) {
                 LOG(WARNING) << "Optional element structuralElementVerticalUID is present but empty at xpath " << xpath;
             }
         }
 
         // read element reinforcementNumberHorizontal
-        if (tixi::TixiCheckElement(tixiHandle, xpath + "/reinforcementNumberHorizontal")) {
-            m_reinforcementNumberHorizontal_choice1 = tixi::TixiGetElement<int>(tixiHandle, xpath + "/reinforcementNumberHorizontal");
-        }
+        tixi::TixiTryGetElement(tixiHandle, xpath + "/reinforcementNumberHorizontal", m_reinforcementNumberHorizontal_choice1);
 
         // read element structuralElementHorizontalUID
-        if (tixi::TixiCheckElement(tixiHandle, xpath + "/structuralElementHorizontalUID")) {
-            m_structuralElementHorizontalUID_choice1 = tixi::TixiGetElement<std::string>(tixiHandle, xpath + "/structuralElementHorizontalUID");
+        if (tixi::TixiTryGetElement(tixiHandle, xpath + "/structuralElementHorizontalUID", m_structuralElementHorizontalUID_choice1)) {
             if (m_structuralElementHorizontalUID_choice1->empty()) {
                 LOG(WARNING) << "Optional element structuralElementHorizontalUID is present but empty at xpath " << xpath;
             }
         }
 
         // read element bulkheadCalotteRadiusAtFrame
-        if (tixi::TixiCheckElement(tixiHandle, xpath + "/bulkheadCalotteRadiusAtFrame")) {
-            m_bulkheadCalotteRadiusAtFrame_choice2 = tixi::TixiGetElement<double>(tixiHandle, xpath + "/bulkheadCalotteRadiusAtFrame");
-        }
+        tixi::TixiTryGetElement(tixiHandle, xpath + "/bulkheadCalotteRadiusAtFrame", m_bulkheadCalotteRadiusAtFrame_choice2);
 
         // read element maxFlectionDepth
-        if (tixi::TixiCheckElement(tixiHandle, xpath + "/maxFlectionDepth")) {
-            m_maxFlectionDepth_choice2 = tixi::TixiGetElement<double>(tixiHandle, xpath + "/maxFlectionDepth");
-        }
+        tixi::TixiTryGetElement(tixiHandle, xpath + "/maxFlectionDepth", m_maxFlectionDepth_choice2);
 
         // read element reinforcementNumberRadial
-        if (tixi::TixiCheckElement(tixiHandle, xpath + "/reinforcementNumberRadial")) {
-            m_reinforcementNumberRadial_choice2 = tixi::TixiGetElement<int>(tixiHandle, xpath + "/reinforcementNumberRadial");
-        }
+        tixi::TixiTryGetElement(tixiHandle, xpath + "/reinforcementNumberRadial", m_reinforcementNumberRadial_choice2);
 
         // read element structuralElementRadialUID
-        if (tixi::TixiCheckElement(tixiHandle, xpath + "/structuralElementRadialUID")) {
-            m_structuralElementRadialUID_choice2 = tixi::TixiGetElement<std::string>(tixiHandle, xpath + "/structuralElementRadialUID");
+        if (tixi::TixiTryGetElement(tixiHandle, xpath + "/structuralElementRadialUID", m_structuralElementRadialUID_choice2)) {
             if (m_structuralElementRadialUID_choice2->empty()) {
                 LOG(WARNING) << "Optional element structuralElementRadialUID is present but empty at xpath " << xpath;
             }
@@ -275,6 +259,23 @@ namespace generated
 
     }
 
+    bool CPACSPressureBulkhead::IsDirty() const
+    {
+        return m_dirty;
+    }
+
+    void CPACSPressureBulkhead::ClearDirty()
+    {
+        m_dirty = false;
+    }
+
+    void CPACSPressureBulkhead::WriteDirtyCPACS(const TixiDocumentHandle& tixiHandle, const std::string& xpath) const
+    {
+        if (m_dirty) {
+            WriteCPACS(tixiHandle, xpath);
+        }
+    }
+
     bool CPACSPressureBulkhead::ValidateChoices() const
     {
         return
@@ -336,6 +337,7 @@ namespace generated
 
     void CPACSPressureBulkhead::SetUID(const std::string& value)
     {
+        m_dirty = true;
         if (m_uidMgr) {
             m_uidMgr->TryUnregisterObject(m_uID);
             m_uidMgr->RegisterObject(value, *this);
@@ -350,6 +352,7 @@ namespace generated
 
     void CPACSPressureBulkhead::SetName(const boost::optional<std::string>& value)
     {
+        m_dirty = true;
         m_name = value;
     }
 
@@ -360,6 +363,7 @@ namespace generated
 
     void CPACSPressureBulkhead::SetDescription(const boost::optional<std::string>& value)
     {
+        m_dirty = true;
         m_description = value;
     }
 
@@ -370,6 +374,7 @@ namespace generated
 
     void CPACSPressureBulkhead::SetSheetElementUID(const std::string& value)
     {
+        m_dirty = true;
         m_sheetElementUID = value;
     }
 
@@ -380,6 +385,7 @@ namespace generated
 
     void CPACSPressureBulkhead::SetReinforcementNumberVertical_choice1(const boost::optional<int>& value)
     {
+        m_dirty = true;
         m_reinforcementNumberVertical_choice1 = value;
     }
 
@@ -390,6 +396,7 @@ namespace generated
 
     void CPACSPressureBulkhead::SetStructuralElementVerticalUID_choice1(const boost::optional<std::string>& value)
     {
+        m_dirty = true;
         m_structuralElementVerticalUID_choice1 = value;
     }
 
@@ -400,6 +407,7 @@ namespace generated
 
     void CPACSPressureBulkhead::SetReinforcementNumberHorizontal_choice1(const boost::optional<int>& value)
     {
+        m_dirty = true;
         m_reinforcementNumberHorizontal_choice1 = value;
     }
 
@@ -410,6 +418,7 @@ namespace generated
 
     void CPACSPressureBulkhead::SetStructuralElementHorizontalUID_choice1(const boost::optional<std::string>& value)
     {
+        m_dirty = true;
         m_structuralElementHorizontalUID_choice1 = value;
     }
 
@@ -420,6 +429,7 @@ namespace generated
 
     void CPACSPressureBulkhead::SetBulkheadCalotteRadiusAtFrame_choice2(const boost::optional<double>& value)
     {
+        m_dirty = true;
         m_bulkheadCalotteRadiusAtFrame_choice2 = value;
     }
 
@@ -430,6 +440,7 @@ namespace generated
 
     void CPACSPressureBulkhead::SetMaxFlectionDepth_choice2(const boost::optional<double>& value)
     {
+        m_dirty = true;
         m_maxFlectionDepth_choice2 = value;
     }
 
@@ -440,6 +451,7 @@ namespace generated
 
     void CPACSPressureBulkhead::SetReinforcementNumberRadial_choice2(const boost::optional<int>& value)
     {
+        m_dirty = true;
         m_reinforcementNumberRadial_choice2 = value;
     }
 
@@ -450,6 +462,7 @@ namespace generated
 
     void CPACSPressureBulkhead::SetStructuralElementRadialUID_choice2(const boost::optional<std::string>& value)
     {
+        m_dirty = true;
         m_structuralElementRadialUID_choice2 = value;
     }
 
@@ -30,6 +30,7 @@ namespace generated
 {
     CPACSPressureBulkheadAssembly::CPACSPressureBulkheadAssembly(CCPACSFuselageStructure* parent, CTiglUIDManager* uidMgr)
         : m_uidMgr(uidMgr)
+        , m_dirty(true)
     {
         //assert(parent != NULL);
         m_parent = parent;
@@ -75,6 +76,43 @@ namespace generated
 
     }
 
+    bool CPACSPressureBulkheadAssembly::IsDirty() const
+    {
+        if (m_dirty) {
+            return true;
+        }
+        if (m_pressureBulkheads.size() != m_pressureBulkheadsClean.size()) {
+            return true;
+        }
+        for (std::size_t i = 0; i < m_pressureBulkheads.size(); i++) {
+            if (m_pressureBulkheads[i].get() != m_pressureBulkheadsClean[i] || m_pressureBulkheads[i]->IsDirty()) {
+                return true;
+            }
+        }
+        return false;
+    }
+
+    void CPACSPressureBulkheadAssembly::ClearDirty()
+    {
+        m_dirty = false;
+        m_pressureBulkheadsClean.clear();
+        for (std::size_t i = 0; i < m_pressureBulkheads.size(); i++) {
+            m_pressureBulkheadsClean.push_back(m_pressureBulkheads[i].get());
+            m_pressureBulkheads[i]->ClearDirty();
+        }
+    }
+
+    void CPACSPressureBulkheadAssembly::WriteDirtyCPACS(const TixiDocumentHandle& tixiHandle, const std::string& xpath) const
+    {
+        if (m_dirty) {
+            WriteCPACS(tixiHandle, xpath);
+            return;
+        }
+
+        // write modified elements pressureBulkhead
+        tixi::TixiSaveDirtyElements(tixiHandle, xpath + "/pressureBulkhead", m_pressureBulkheads, m_pressureBulkheadsClean);
+    }
+
     const std::vector<unique_ptr<CCPACSPressureBulkheadAssemblyPosition> >& CPACSPressureBulkheadAssembly::GetPressureBulkheads() const
     {
         return m_pressureBulkheads;
@@ -93,6 +131,7 @@ namespace generated
 
     void CPACSPressureBulkheadAssembly::RemovePressureBulkhead(CCPACSPressureBulkheadAssemblyPosition& ref)
     {
+        m_dirty = true;
         for (std::size_t i = 0; i < m_pressureBulkheads.size(); i++) {
             if (m_pressureBulkheads[i].get() == &ref) {
                 m_pressureBulkheads.erase(m_pressureBulkheads.begin() + i);
@@ -29,6 +29,7 @@ namespace generated
 {
     CPACSPressureBulkheadAssemblyPosition::CPACSPressureBulkheadAssemblyPosition(CCPACSPressureBulkheadAssembly* parent, CTiglUIDManager* uidMgr)
         : m_uidMgr(uidMgr)
+        , m_dirty(true)
     {
         //assert(parent != NULL);
         m_parent = parent;
@@ -62,8 +63,7 @@ namespace generated
     void CPACSPressureBulkheadAssemblyPosition::ReadCPACS(const TixiDocumentHandle& tixiHandle, const std::string& xpath)
     {
         // read attribute uID
-        if (tixi::TixiCheckAttribute(tixiHandle, xpath, "uID")) {
-            m_uID = tixi::TixiGetAttribute<std::string>(tixiHandle, xpath, "uID");
+        if (tixi::TixiTryGetAttribute(tixiHandle, xpath, "uID", m_uID)) {
             if (m_uID.empty()) {
                 LOG(WARNING) << "Required attribute uID is empty at xpath " << xpath;
             }
@@ -73,8 +73,7 @@ namespace generated
         }
 
         // read element frameUID
-        if (tixi::TixiCheckElement(tixiHandle, xpath + "/frameUID")) {
-            m_frameUID = tixi::TixiGetElement<std::string>(tixiHandle, xpath + "/frameUID");
+        if (tixi::TixiTryGetElement(tixiHandle, xpath + "/frameUID", m_frameUID)) {
             if (m_frameUID.empty()) {
                 LOG(WARNING) << "Required element frameUID is empty at xpath " << xpath;
             }
@@ -84,8 +83,7 @@ namespace generated
         }
 
         // read element pressureBulkheadElementUID
-        if (tixi::TixiCheckElement(tixiHandle, xpath + "/pressureBulkheadElementUID")) {
-            m_pressureBulkheadElementUID = tixi::TixiGetElement<std::string>(tixiHandle, xpath + "/pressureBulkheadElementUID");
+        if (tixi::TixiTryGetElement(tixiHandle, xpath + "/pressureBulkheadElementUID", m_pressureBulkheadElementUID)) {
             if (m_pressureBulkheadElementUID.empty()) {
                 LOG(WARNING) << "Required element pressureBulkheadElementUID is empty at xpath " << xpath;
             }
@@ -112,6 +110,23 @@ namespace generated
 
     }
 
+    bool CPACSPressureBulkheadAssemblyPosition::IsDirty() const
+    {
+        return m_dirty;
+    }
+
+    void CPACSPressureBulkheadAssemblyPosition::ClearDirty()
+    {
+        m_dirty = false;
+    }
+
+    void CPACSPressureBulkheadAssemblyPosition::WriteDirtyCPACS(const TixiDocumentHandle& tixiHandle, const std::string& xpath) const
+    {
+        if (m_dirty) {
+            WriteCPACS(tixiHandle, xpath);
+        }
+    }
+
     const std::string& CPACSPressureBulkheadAssemblyPosition::GetUID() const
     {
         return m_uID;
@@ -119,6 +134,7 @@ namespace generated
 
     void CPACSPressureBulkheadAssemblyPosition::SetUID(const std::string& value)
     {
+        m_dirty = true;
         if (m_uidMgr) {
             m_uidMgr->TryUnregisterObject(m_uID);
             m_uidMgr->RegisterObject(value, *this);
@@ -133,6 +149,7 @@ namespace generated
 
     void CPACSPressureBulkheadAssemblyPosition::SetFrameUID(const std::string& value)
     {
+        m_dirty = true;
         m_frameUID = value;
     }
 
@@ -143,6 +160,7 @@ namespace generated
 
     void CPACSPressureBulkheadAssemblyPosition::SetPressureBulkheadElementUID(const std::string& value)
     {
+        m_dirty = true;
         m_pressureBulkheadElementUID = value;
     }
 
@@ -28,6 +28,7 @@ namespace generated
 {
     CPACSPressureBulkheads::CPACSPressureBulkheads(CTiglUIDManager* uidMgr)
         : m_uidMgr(uidMgr)
+        , m_dirty(true)
     {
     }
 
@@ -61,6 +62,43 @@ namespace generated
 
     }
 
+    bool CPACSPressureBulkheads::IsDirty() const
+    {
+        if (m_dirty) {
+            return true;
+        }
+        if (m_pressureBulkheads.size() != m_pressureBulkheadsClean.size()) {
+            return true;
+        }
+        for (std::size_t i = 0; i < m_pressureBulkheads.size(); i++) {
+            if (m_pressureBulkheads[i].get() != m_pressureBulkheadsClean[i] || m_pressureBulkheads[i]->IsDirty()) {
+                return true;
+            }
+        }
+        return false;
+    }
+
+    void CPACSPressureBulkheads::ClearDirty()
+    {
+        m_dirty = false;
+        m_pressureBulkheadsClean.clear();
+        for (std::size_t i = 0; i < m_pressureBulkheads.size(); i++) {
+            m_pressureBulkheadsClean.push_back(m_pressureBulkheads[i].get());
+            m_pressureBulkheads[i]->ClearDirty();
+        }
+    }
+
+    void CPACSPressureBulkheads::WriteDirtyCPACS(const TixiDocumentHandle& tixiHandle, const std::string& xpath) const
+    {
+        if (m_dirty) {
+            WriteCPACS(tixiHandle, xpath);
+            return;
+        }
+
+        // write modified elements pressureBulkhead
+        tixi::TixiSaveDirtyElements(tixiHandle, xpath + "/pressureBulkhead", m_pressureBulkheads, m_pressureBulkheadsClean);
+    }
+
     const std::vector<unique_ptr<CCPACSPressureBulkhead> >& CPACSPressureBulkheads::GetPressureBulkheads() const
     {
         return m_pressureBulkheads;
@@ -79,6 +117,7 @@ namespace generated
 
     void CPACSPressureBulkheads::RemovePressureBulkhead(CCPACSPressureBulkhead& ref)
     {
+        m_dirty = true;
         for (std::size_t i = 0; i < m_pressureBulkheads.size(); i++) {
             if (m_pressureBulkheads[i].get() == &ref) {
                 m_pressureBulkheads.erase(m_pressureBulkheads.begin() + i);
@@ -29,6 +29,7 @@ namespace generated
 {
     CPACSProfileBasedStructuralElement::CPACSProfileBasedStructuralElement(CTiglUIDManager* uidMgr)
         : m_uidMgr(uidMgr)
+        , m_dirty(true)
     {
     }
 
@@ -50,8 +51,7 @@ namespace generated
     void CPACSProfileBasedStructuralElement::ReadCPACS(const TixiDocumentHandle& tixiHandle, const std::string& xpath)
     {
         // read attribute uID
-        if (tixi::TixiCheckAttribute(tixiHandle, xpath, "uID")) {
-            m_uID = tixi::TixiGetAttribute<std::string>(tixiHandle, xpath, "uID");
+        if (tixi::TixiTryGetAttribute(tixiHandle, xpath, "uID", m_uID)) {
             if (m_uID.empty()) {
                 LOG(WARNING) << "Required attribute uID is empty at xpath " << xpath;
             }
@@ -61,16 +61,14 @@ namespace generated
         }
 
         // read element name
-        if (tixi::TixiCheckElement(tixiHandle, xpath + "/name")) {
-            m_name = tixi::TixiGetElement<std::string>(tixiHandle, xpath + "/name");
+        if (tixi::TixiTryGetElement(tixiHandle, xpath + "/name", m_name)) {
             if (m_name->empty()) {
                 LOG(WARNING) << "Optional element name is present but empty at xpath " << xpath;
             }
         }
 
         // read element description
-        if (tixi::TixiCheckElement(tixiHandle, xpath + "/description")) {
-            m_description = tixi::TixiGetElement<std::string>(tixiHandle, xpath + "/description");
+        if (tixi::TixiTryGetElement(tixiHandle, xpath + "/description", m_description)) {
             if (m_description->empty()) {
                 LOG(WARNING) << "Optional element description is present but empty at xpath " << xpath;
             }
@@ -104,8 +102,7 @@ namespace generated
         }
 
         // read element structuralProfileUID
-        if (tixi::TixiCheckElement(tixiHandle, xpath + "/structuralProfileUID")) {
-            m_structuralProfileUID_choice1 = tixi::TixiGetElement<std::string>(tixiHandle, xpath + "/structuralProfileUID");
+        if (tixi::TixiTryGetElement(tixiHandle, xpath + "/structuralProfileUID", m_structuralProfileUID_choice1)) {
             if (m_structuralProfileUID_choice1->empty()) {
                 LOG(WARNING) << "Optional element structuralProfileUID is present but empty at xpath " << xpath;
             }
@@ -117,8 +114,7 @@ namespace generated
         }
 
         // read element referencePointUID
-        if (tixi::TixiCheckElement(tixiHandle, xpath + "/referencePointUID")) {
-            m_referencePointUID_choice1 = tixi::TixiGetElement<std::string>(tixiHandle, xpath + "/referencePointUID");
+        if (tixi::TixiTryGetElement(tixiHandle, xpath + "/referencePointUID", m_referencePointUID_choice1)) {
             if (m_referencePointUID_choice1->empty()) {
                 LOG(WARNING) << "Optional element referencePointUID is present but empty at xpath " << xpath;
             }
@@ -225,6 +221,83 @@ namespace generated
 
     }
 
+    bool CPACSProfileBasedStructuralElement::IsDirty() const
+    {
+        if (m_dirty) {
+            return true;
+        }
+        if (m_sheetProperties.size() != m_sheetPropertiesClean.size()) {
+            return true;
+        }
+        for (std::size_t i = 0; i < m_sheetProperties.size(); i++) {
+            if (m_sheetProperties[i].get() != m_sheetPropertiesClean[i] || m_sheetProperties[i]->IsDirty()) {
+                return true;
+            }
+        }
+        if (m_transformation && m_transformation->IsDirty()) {
+            return true;
+        }
+        if (m_globalBeamProperties && m_globalBeamProperties->IsDirty()) {
+            return true;
+        }
+        if (m_pointProperties_choice1.size() != m_pointProperties_choice1Clean.size()) {
+            return true;
+        }
+        for (std::size_t i = 0; i < m_pointProperties_choice1.size(); i++) {
+            if (m_pointProperties_choice1[i].get() != m_pointProperties_choice1Clean[i] || m_pointProperties_choice1[i]->IsDirty()) {
+                return true;
+            }
+        }
+        return false;
+    }
+
+    void CPACSProfileBasedStructuralElement::ClearDirty()
+    {
+        m_dirty = false;
+        m_sheetPropertiesClean.clear();
+        for (std::size_t i = 0; i < m_sheetProperties.size(); i++) {
+            m_sheetPropertiesClean.push_back(m_sheetProperties[i].get());
+            m_sheetProperties[i]->ClearDirty();
+        }
+        if (m_transformation) {
+            m_transformation->ClearDirty();
+        }
+        if (m_globalBeamProperties) {
+            m_globalBeamProperties->ClearDirty();
+        }
+        m_pointProperties_choice1Clean.clear();
+        for (std::size_t i = 0; i < m_pointProperties_choice1.size(); i++) {
+            m_pointProperties_choice1Clean.push_back(m_pointProperties_choice1[i].get());
+            m_pointProperties_choice1[i]->ClearDirty();
+        }
+    }
+
+    void CPACSProfileBasedStructuralElement::WriteDirtyCPACS(const TixiDocumentHandle& tixiHandle, const std::string& xpath) const
+    {
+        if (m_dirty) {
+            WriteCPACS(tixiHandle, xpath);
+            return;
+        }
+
+        // write modified elements sheetProperties
+        tixi::TixiSaveDirtyElements(tixiHandle, xpath + "/sheetProperties", m_sheetProperties, m_sheetPropertiesClean);
+
+        // write modified element transformation
+        if (m_transformation && m_transformation->IsDirty()) {
+            tixi::TixiCreateElementIfNotExists(tixiHandle, xpath + "/transformation");
+            m_transformation->WriteDirtyCPACS(tixiHandle, xpath + "/transformation");
+        }
+
+        // write modified element globalBeamProperties
+        if (m_globalBeamProperties && m_globalBeamProperties->IsDirty()) {
+            tixi::TixiCreateElementIfNotExists(tixiHandle, xpath + "/globalBeamProperties");
+            m_globalBeamProperties->WriteDirtyCPACS(tixiHandle, xpath + "/globalBeamProperties");
+        }
+
+        // write modified elements pointProperties
+        tixi::TixiSaveDirtyElements(tixiHandle, xpath + "/pointProperties", m_pointProperties_choice1, m_pointProperties_choice1Clean);
+    }
+
     bool CPACSProfileBasedStructuralElement::ValidateChoices() const
     {
         return
@@ -270,6 +343,7 @@ namespace generated
 
     void CPACSProfileBasedStructuralElement::SetUID(const std::string& value)
     {
+        m_dirty = true;
         if (m_uidMgr) {
             m_uidMgr->TryUnregisterObject(m_uID);
             m_uidMgr->RegisterObject(value, *this);
@@ -284,6 +358,7 @@ namespace generated
 
     void CPACSProfileBasedStructuralElement::SetName(const boost::optional<std::string>& value)
     {
+        m_dirty = true;
         m_name = value;
     }
 
@@ -294,6 +369,7 @@ namespace generated
 
     void CPACSProfileBasedStructuralElement::SetDescription(const boost::optional<std::string>& value)
     {
+        m_dirty = true;
         m_description = value;
     }
 
@@ -334,6 +410,7 @@ namespace generated
 
     void CPACSProfileBasedStructuralElement::SetStructuralProfileUID_choice1(const boost::optional<std::string>& value)
     {
+        m_dirty = true;
         m_structuralProfileUID_choice1 = value;
     }
 
@@ -354,6 +431,7 @@ namespace generated
 
     void CPACSProfileBasedStructuralElement::SetReferencePointUID_choice1(const boost::optional<std::string>& value)
     {
+        m_dirty = true;
         m_referencePointUID_choice1 = value;
     }
 
@@ -364,6 +442,7 @@ namespace generated
 
     void CPACSProfileBasedStructuralElement::SetStandardProfileType_choice2(const boost::optional<CPACSProfileBasedStructuralElement_standardProfileType>& value)
     {
+        m_dirty = true;
         m_standardProfileType_choice2 = value;
     }
 
@@ -375,6 +454,7 @@ namespace generated
 
     void CPACSProfileBasedStructuralElement::RemoveSheetProperties(CPACSMaterialDefinitionForProfileBased& ref)
     {
+        m_dirty = true;
         for (std::size_t i = 0; i < m_sheetProperties.size(); i++) {
             if (m_sheetProperties[i].get() == &ref) {
                 m_sheetProperties.erase(m_sheetProperties.begin() + i);
@@ -393,6 +473,7 @@ namespace generated
 
     void CPACSProfileBasedStructuralElement::RemoveTransformation()
     {
+        m_dirty = true;
         m_transformation = boost::none;
     }
 
@@ -405,6 +486,7 @@ namespace generated
 
     void CPACSProfileBasedStructuralElement::RemoveGlobalBeamProperties()
     {
+        m_dirty = true;
         m_globalBeamProperties = boost::none;
     }
 
@@ -416,6 +498,7 @@ namespace generated
 
     void CPACSProfileBasedStructuralElement::RemovePointProperties_choice1(CPACSMaterialDefinitionForProfileBasedPoint& ref)
     {
+        m_dirty = true;
         for (std::size_t i = 0; i < m_pointProperties_choice1.size(); i++) {
             if (m_pointProperties_choice1[i].get() == &ref) {
                 m_pointProperties_choice1.erase(m_pointProperties_choice1.begin() + i);
@@ -75,6 +75,10 @@ namespace generated
         TIGL_EXPORT virtual void ReadCPACS(const TixiDocumentHandle& tixiHandle, const std::string& xpath);
         TIGL_EXPORT virtual void WriteCPACS(const TixiDocumentHandle& tixiHandle, const std::string& xpath) const;
 
+        TIGL_EXPORT virtual bool IsDirty() const;
+        TIGL_EXPORT virtual void ClearDirty();
+        TIGL_EXPORT virtual void WriteDirtyCPACS(const TixiDocumentHandle& tixiHandle, const std::string& xpath) const;
+
         TIGL_EXPORT bool ValidateChoices() const;
 
         TIGL_EXPORT virtual const std::string& GetUID() const;
@@ -151,6 +155,13 @@ namespace generated
         /// further information.
         boost::optional<CPACSProfileBasedStructuralElement_standardProfileType> m_standardProfileType_choice2;
 
+        /// Set by the setters, cleared after the object has been read or written
+        bool m_dirty;
+
+        /// List elements at the last call of ClearDirty
+        std::vector<const CPACSMaterialDefinitionForProfileBased*> m_sheetPropertiesClean;
+        std::vector<const CPACSMaterialDefinitionForProfileBasedPoint*> m_pointProperties_choice1Clean;
+
     private:
 #ifdef HAVE_CPP11
         CPACSProfileBasedStructuralElement(const CPACSProfileBasedStructuralElement&) = delete;
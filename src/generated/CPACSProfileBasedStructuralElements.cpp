@@ -28,6 +28,7 @@ namespace generated
 {
     CPACSProfileBasedStructuralElements::CPACSProfileBasedStructuralElements(CTiglUIDManager* uidMgr)
         : m_uidMgr(uidMgr)
+        , m_dirty(true)
     {
     }
 
@@ -61,6 +62,43 @@ namespace generated
 
     }
 
+    bool CPACSProfileBasedStructuralElements::IsDirty() const
+    {
+        if (m_dirty) {
+            return true;
+        }
+        if (m_profileBasedStructuralElements.size() != m_profileBasedStructuralElementsClean.size()) {
+            return true;
+        }
+        for (std::size_t i = 0; i < m_profileBasedStructuralElements.size(); i++) {
+            if (m_profileBasedStructuralElements[i].get() != m_profileBasedStructuralElementsClean[i] || m_profileBasedStructuralElements[i]->IsDirty()) {
+                return true;
+            }
+        }
+        return false;
+    }
+
+    void CPACSProfileBasedStructuralElements::ClearDirty()
+    {
+        m_dirty = false;
+        m_profileBasedStructuralElementsClean.clear();
+        for (std::size_t i = 0; i < m_profileBasedStructuralElements.size(); i++) {
+            m_profileBasedStructuralElementsClean.push_back(m_profileBasedStructuralElements[i].get());
+            m_profileBasedStructuralElements[i]->ClearDirty();
+        }
+    }
+
+    void CPACSProfileBasedStructuralElements::WriteDirtyCPACS(const TixiDocumentHandle& tixiHandle, const std::string& xpath) const
+    {
+        if (m_dirty) {
+            WriteCPACS(tixiHandle, xpath);
+            return;
+        }
+
+        // write modified elements profileBasedStructuralElement
+        tixi::TixiSaveDirtyElements(tixiHandle, xpath + "/profileBasedStructuralElement", m_profileBasedStructuralElements, m_profileBasedStructuralElementsClean);
+    }
+
     const std::vector<unique_ptr<CCPACSProfileBasedStructuralElement> >& CPACSProfileBasedStructuralElements::GetProfileBasedStructuralElements() const
     {
         return m_profileBasedStructuralElements;
@@ -79,6 +117,7 @@ namespace generated
 
     void CPACSProfileBasedStructuralElements::RemoveProfileBasedStructuralElement(CCPACSProfileBasedStructuralElement& ref)
     {
+        m_dirty = true;
         for (std::size_t i = 0; i < m_profileBasedStructuralElements.size(); i++) {
             if (m_profileBasedStructuralElements[i].get() == &ref) {
                 m_profileBasedStructuralElements.erase(m_profileBasedStructuralElements.begin() + i);
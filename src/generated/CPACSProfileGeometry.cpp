@@ -27,6 +27,7 @@ namespace generated
 {
     CPACSProfileGeometry::CPACSProfileGeometry(CTiglUIDManager* uidMgr)
         : m_uidMgr(uidMgr)
+        , m_dirty(true)
     {
     }
 
@@ -53,8 +54,7 @@ namespace generated
         }
 
         // read attribute uID
-        if (tixi::TixiCheckAttribute(tixiHandle, xpath, "uID")) {
-            m_uID = tixi::TixiGetAttribute<std::string>(tixiHandle, xpath, "uID");
+        if (tixi::TixiTryGetAttribute(tixiHandle, xpath, "uID", m_uID)) {
             if (m_uID.empty()) {
                 LOG(WARNING) << "Required attribute uID is empty at xpath " << xpath;
             }
@@ -64,8 +64,7 @@ namespace generated
         }
 
         // read element name
-        if (tixi::TixiCheckElement(tixiHandle, xpath + "/name")) {
-            m_name = tixi::TixiGetElement<std::string>(tixiHandle, xpath + "/name");
+        if (tixi::TixiTryGetElement(tixiHandle, xpath + "/name", m_name)) {
             if (m_name.empty()) {
                 LOG(WARNING) << "Required element name is empty at xpath " << xpath;
             }
@@ -75,8 +74,7 @@ namespace generated
         }
 
         // read element description
-        if (tixi::TixiCheckElement(tixiHandle, xpath + "/description")) {
-            m_description = tixi::TixiGetElement<std::string>(tixiHandle, xpath + "/description");
+        if (tixi::TixiTryGetElement(tixiHandle, xpath + "/description", m_description)) {
             if (m_description->empty()) {
                 LOG(WARNING) << "Optional element description is present but empty at xpath " << xpath;
             }
@@ -164,6 +162,51 @@ namespace generated
 
     }
 
+    bool CPACSProfileGeometry::IsDirty() const
+    {
+        if (m_dirty) {
+            return true;
+        }
+        if (m_pointList_choice1 && m_pointList_choice1->IsDirty()) {
+            return true;
+        }
+        if (m_cst2D_choice2 && m_cst2D_choice2->IsDirty()) {
+            return true;
+        }
+        return false;
+    }
+
+    void CPACSProfileGeometry::ClearDirty()
+    {
+        m_dirty = false;
+        if (m_pointList_choice1) {
+            m_pointList_choice1->ClearDirty();
+        }
+        if (m_cst2D_choice2) {
+            m_cst2D_choice2->ClearDirty();
+        }
+    }
+
+    void CPACSProfileGeometry::WriteDirtyCPACS(const TixiDocumentHandle& tixiHandle, const std::string& xpath) const
+    {
+        if (m_dirty) {
+            WriteCPACS(tixiHandle, xpath);
+            return;
+        }
+
+        // write modified element pointList
+        if (m_pointList_choice1 && m_pointList_choice1->IsDirty()) {
+            tixi::TixiCreateElementIfNotExists(tixiHandle, xpath + "/pointList");
+            m_pointList_choice1->WriteDirtyCPACS(tixiHandle, xpath + "/pointList");
+        }
+
+        // write modified element cst2D
+        if (m_cst2D_choice2 && m_cst2D_choice2->IsDirty()) {
+            tixi::TixiCreateElementIfNotExists(tixiHandle, xpath + "/cst2D");
+            m_cst2D_choice2->WriteDirtyCPACS(tixiHandle, xpath + "/cst2D");
+        }
+    }
+
     bool CPACSProfileGeometry::ValidateChoices() const
     {
         return
@@ -201,6 +244,7 @@ namespace generated
 
     void CPACSProfileGeometry::SetSymmetry(const boost::optional<TiglSymmetryAxis>& value)
     {
+        m_dirty = true;
         m_symmetry = value;
     }
 
@@ -211,6 +255,7 @@ namespace generated
 
     void CPACSProfileGeometry::SetUID(const std::string& value)
     {
+        m_dirty = true;
         if (m_uidMgr) {
             m_uidMgr->TryUnregisterObject(m_uID);
             m_uidMgr->RegisterObject(value, *this);
@@ -225,6 +270,7 @@ namespace generated
 
     void CPACSProfileGeometry::SetName(const std::string& value)
     {
+        m_dirty = true;
         m_name = value;
     }
 
@@ -235,6 +281,7 @@ namespace generated
 
     void CPACSProfileGeometry::SetDescription(const boost::optional<std::string>& value)
     {
+        m_dirty = true;
         m_description = value;
     }
 
@@ -267,6 +314,7 @@ namespace generated
 
     void CPACSProfileGeometry::RemovePointList_choice1()
     {
+        m_dirty = true;
         m_pointList_choice1 = boost::none;
     }
 
@@ -279,6 +327,7 @@ namespace generated
 
     void CPACSProfileGeometry::RemoveCst2D_choice2()
     {
+        m_dirty = true;
         m_cst2D_choice2 = boost::none;
     }
 
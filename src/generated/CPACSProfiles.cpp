@@ -27,6 +27,7 @@ namespace generated
 {
     CPACSProfiles::CPACSProfiles(CTiglUIDManager* uidMgr)
         : m_uidMgr(uidMgr)
+        , m_dirty(true)
     {
     }
 
@@ -162,6 +163,87 @@ namespace generated
 
     }
 
+    bool CPACSProfiles::IsDirty() const
+    {
+        if (m_dirty) {
+            return true;
+        }
+        if (m_fuselageProfiles && m_fuselageProfiles->IsDirty()) {
+            return true;
+        }
+        if (m_wingAirfoils && m_wingAirfoils->IsDirty()) {
+            return true;
+        }
+        if (m_guideCurves && m_guideCurves->IsDirty()) {
+            return true;
+        }
+        if (m_rotorAirfoils && m_rotorAirfoils->IsDirty()) {
+            return true;
+        }
+        if (m_structuralProfiles && m_structuralProfiles->IsDirty()) {
+            return true;
+        }
+        return false;
+    }
+
+    void CPACSProfiles::ClearDirty()
+    {
+        m_dirty = false;
+        if (m_fuselageProfiles) {
+            m_fuselageProfiles->ClearDirty();
+        }
+        if (m_wingAirfoils) {
+            m_wingAirfoils->ClearDirty();
+        }
+        if (m_guideCurves) {
+            m_guideCurves->ClearDirty();
+        }
+        if (m_rotorAirfoils) {
+            m_rotorAirfoils->ClearDirty();
+        }
+        if (m_structuralProfiles) {
+            m_structuralProfiles->ClearDirty();
+        }
+    }
+
+    void CPACSProfiles::WriteDirtyCPACS(const TixiDocumentHandle& tixiHandle, const std::string& xpath) const
+    {
+        if (m_dirty) {
+            WriteCPACS(tixiHandle, xpath);
+            return;
+        }
+
+        // write modified element fuselageProfiles
+        if (m_fuselageProfiles && m_fuselageProfiles->IsDirty()) {
+            tixi::TixiCreateElementIfNotExists(tixiHandle, xpath + "/fuselageProfiles");
+            m_fuselageProfiles->WriteDirtyCPACS(tixiHandle, xpath + "/fuselageProfiles");
+        }
+
+        // write modified element wingAirfoils
+        if (m_wingAirfoils && m_wingAirfoils->IsDirty()) {
+            tixi::TixiCreateElementIfNotExists(tixiHandle, xpath + "/wingAirfoils");
+            m_wingAirfoils->WriteDirtyCPACS(tixiHandle, xpath + "/wingAirfoils");
+        }
+
+        // write modified element guideCurves
+        if (m_guideCurves && m_guideCurves->IsDirty()) {
+            tixi::TixiCreateElementIfNotExists(tixiHandle, xpath + "/guideCurves");
+            m_guideCurves->WriteDirtyCPACS(tixiHandle, xpath + "/guideCurves");
+        }
+
+        // write modified element rotorAirfoils
+        if (m_rotorAirfoils && m_rotorAirfoils->IsDirty()) {
+            tixi::TixiCreateElementIfNotExists(tixiHandle, xpath + "/rotorAirfoils");
+            m_rotorAirfoils->WriteDirtyCPACS(tixiHandle, xpath + "/rotorAirfoils");
+        }
+
+        // write modified element structuralProfiles
+        if (m_structuralProfiles && m_structuralProfiles->IsDirty()) {
+            tixi::TixiCreateElementIfNotExists(tixiHandle, xpath + "/structuralProfiles");
+            m_structuralProfiles->WriteDirtyCPACS(tixiHandle, xpath + "/structuralProfiles");
+        }
+    }
+
     const boost::optional<CCPACSFuselageProfiles>& CPACSProfiles::GetFuselageProfiles() const
     {
         return m_fuselageProfiles;
@@ -221,6 +303,7 @@ namespace generated
 
     void CPACSProfiles::RemoveFuselageProfiles()
     {
+        m_dirty = true;
         m_fuselageProfiles = boost::none;
     }
 
@@ -233,6 +316,7 @@ namespace generated
 
     void CPACSProfiles::RemoveWingAirfoils()
     {
+        m_dirty = true;
         m_wingAirfoils = boost::none;
     }
 
@@ -245,6 +329,7 @@ namespace generated
 
     void CPACSProfiles::RemoveGuideCurves()
     {
+        m_dirty = true;
         m_guideCurves = boost::none;
     }
 
@@ -257,6 +342,7 @@ namespace generated
 
     void CPACSProfiles::RemoveRotorAirfoils()
     {
+        m_dirty = true;
         m_rotorAirfoils = boost::none;
     }
 
@@ -269,6 +355,7 @@ namespace generated
 
     void CPACSProfiles::RemoveStructuralProfiles()
     {
+        m_dirty = true;
         m_structuralProfiles = boost::none;
     }
 
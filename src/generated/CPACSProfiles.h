@@ -55,6 +55,10 @@ namespace generated
         TIGL_EXPORT virtual void ReadCPACS(const TixiDocumentHandle& tixiHandle, const std::string& xpath);
         TIGL_EXPORT virtual void WriteCPACS(const TixiDocumentHandle& tixiHandle, const std::string& xpath) const;
 
+        TIGL_EXPORT virtual bool IsDirty() const;
+        TIGL_EXPORT virtual void ClearDirty();
+        TIGL_EXPORT virtual void WriteDirtyCPACS(const TixiDocumentHandle& tixiHandle, const std::string& xpath) const;
+
         TIGL_EXPORT virtual const boost::optional<CCPACSFuselageProfiles>& GetFuselageProfiles() const;
         TIGL_EXPORT virtual boost::optional<CCPACSFuselageProfiles>& GetFuselageProfiles();
 
@@ -94,6 +98,9 @@ namespace generated
         boost::optional<CCPACSRotorProfiles>      m_rotorAirfoils;
         boost::optional<CCPACSStructuralProfiles> m_structuralProfiles;
 
+        /// Set by the setters, cleared after the object has been read or written
+        bool m_dirty;
+
     private:
 #ifdef HAVE_CPP11
         CPACSProfiles(const CPACSProfiles&) = delete;
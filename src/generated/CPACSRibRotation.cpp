@@ -28,6 +28,7 @@ namespace generated
 {
     CPACSRibRotation::CPACSRibRotation(CCPACSWingRibsPositioning* parent)
         : m_z(0)
+        , m_dirty(true)
     {
         //assert(parent != NULL);
         m_parent = parent;
@@ -55,10 +56,7 @@ namespace generated
         }
 
         // read element z
-        if (tixi::TixiCheckElement(tixiHandle, xpath + "/z")) {
-            m_z = tixi::TixiGetElement<double>(tixiHandle, xpath + "/z");
-        }
-        else {
+        if (!tixi::TixiTryGetElement(tixiHandle, xpath + "/z", m_z)) {
             LOG(ERROR) << "Required element z is missing at xpath " << xpath;
         }
 
@@ -83,6 +81,23 @@ namespace generated
 
     }
 
+    bool CPACSRibRotation::IsDirty() const
+    {
+        return m_dirty;
+    }
+
+    void CPACSRibRotation::ClearDirty()
+    {
+        m_dirty = false;
+    }
+
+    void CPACSRibRotation::WriteDirtyCPACS(const TixiDocumentHandle& tixiHandle, const std::string& xpath) const
+    {
+        if (m_dirty) {
+            WriteCPACS(tixiHandle, xpath);
+        }
+    }
+
     const boost::optional<CPACSRibRotation_ribRotationReference>& CPACSRibRotation::GetRibRotationReference() const
     {
         return m_ribRotationReference;
@@ -90,6 +105,7 @@ namespace generated
 
     void CPACSRibRotation::SetRibRotationReference(const boost::optional<CPACSRibRotation_ribRotationReference>& value)
     {
+        m_dirty = true;
         m_ribRotationReference = value;
     }
 
@@ -100,6 +116,7 @@ namespace generated
 
     void CPACSRibRotation::SetZ(const double& value)
     {
+        m_dirty = true;
         m_z = value;
     }
 
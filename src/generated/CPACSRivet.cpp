@@ -29,6 +29,7 @@ namespace generated
         : m_uidMgr(uidMgr)
         , m_tensileStrength(0)
         , m_shearStrength(0)
+        , m_dirty(true)
     {
     }
 
@@ -50,8 +51,7 @@ namespace generated
     void CPACSRivet::ReadCPACS(const TixiDocumentHandle& tixiHandle, const std::string& xpath)
     {
         // read attribute uID
-        if (tixi::TixiCheckAttribute(tixiHandle, xpath, "uID")) {
-            m_uID = tixi::TixiGetAttribute<std::string>(tixiHandle, xpath, "uID");
+        if (tixi::TixiTryGetAttribute(tixiHandle, xpath, "uID", m_uID)) {
             if (m_uID.empty()) {
                 LOG(WARNING) << "Required attribute uID is empty at xpath " << xpath;
             }
@@ -61,34 +61,26 @@ namespace generated
         }
 
         // read element name
-        if (tixi::TixiCheckElement(tixiHandle, xpath + "/name")) {
-            m_name = tixi::TixiGetElement<std::string>(tixiHandle, xpath + "/name");
+        if (tixi::TixiTryGetElement(tixiHandle, xpath + "/name", m_name)) {
             if (m_name->empty()) {
                 LOG(WARNING) << "Optional element name is present but empty at xpath " << xpath;
             }
         }
 
         // read element description
-        if (tixi::TixiCheckElement(tixiHandle, xpath + "/description")) {
-            m_description = tixi::TixiGetElement<std::string>(tixiHandle, xpath + "/description");
+        if (tixi::TixiTryGetElement(tixiHandle, xpath + "/description", m_description)) {
             if (m_description->empty()) {
                 LOG(WARNING) << "Optional element description is present but empty at xpath " << xpath;
             }
         }
 
         // read element tensileStrength
-        if (tixi::TixiCheckElement(tixiHandle, xpath + "/tensileStrength")) {
-            m_tensileStrength = tixi::TixiGetElement<double>(tixiHandle, xpath + "/tensileStrength");
-        }
-        else {
+        if (!tixi::TixiTryGetElement(tixiHandle, xpath + "/tensileStrength", m_tensileStrength)) {
             LOG(ERROR) << "Required element tensileStrength is missing at xpath " << xpath;
         }
 
         // read element shearStrength
-        if (tixi::TixiCheckElement(tixiHandle, xpath + "/shearStrength")) {
-            m_shearStrength = tixi::TixiGetElement<double>(tixiHandle, xpath + "/shearStrength");
-        }
-        else {
+        if (!tixi::TixiTryGetElement(tixiHandle, xpath + "/shearStrength", m_shearStrength)) {
             LOG(ERROR) << "Required element shearStrength is missing at xpath " << xpath;
         }
 
@@ -132,6 +124,23 @@ namespace generated
 
     }
 
+    bool CPACSRivet::IsDirty() const
+    {
+        return m_dirty;
+    }
+
+    void CPACSRivet::ClearDirty()
+    {
+        m_dirty = false;
+    }
+
+    void CPACSRivet::WriteDirtyCPACS(const TixiDocumentHandle& tixiHandle, const std::string& xpath) const
+    {
+        if (m_dirty) {
+            WriteCPACS(tixiHandle, xpath);
+        }
+    }
+
     const std::string& CPACSRivet::GetUID() const
     {
         return m_uID;
@@ -139,6 +148,7 @@ namespace generated
 
     void CPACSRivet::SetUID(const std::string& value)
     {
+        m_dirty = true;
         if (m_uidMgr) {
             m_uidMgr->TryUnregisterObject(m_uID);
             m_uidMgr->RegisterObject(value, *this);
@@ -153,6 +163,7 @@ namespace generated
 
     void CPACSRivet::SetName(const boost::optional<std::string>& value)
     {
+        m_dirty = true;
         m_name = value;
     }
 
@@ -163,6 +174,7 @@ namespace generated
 
     void CPACSRivet::SetDescription(const boost::optional<std::string>& value)
     {
+        m_dirty = true;
         m_description = value;
     }
 
@@ -173,6 +185,7 @@ namespace generated
 
     void CPACSRivet::SetTensileStrength(const double& value)
     {
+        m_dirty = true;
         m_tensileStrength = value;
     }
 
@@ -183,6 +196,7 @@ namespace generated
 
     void CPACSRivet::SetShearStrength(const double& value)
     {
+        m_dirty = true;
         m_shearStrength = value;
     }
 
@@ -28,6 +28,7 @@ namespace generated
 {
     CPACSRivets::CPACSRivets(CTiglUIDManager* uidMgr)
         : m_uidMgr(uidMgr)
+        , m_dirty(true)
     {
     }
 
@@ -61,6 +62,43 @@ namespace generated
 
     }
 
+    bool CPACSRivets::IsDirty() const
+    {
+        if (m_dirty) {
+            return true;
+        }
+        if (m_rivets.size() != m_rivetsClean.size()) {
+            return true;
+        }
+        for (std::size_t i = 0; i < m_rivets.size(); i++) {
+            if (m_rivets[i].get() != m_rivetsClean[i] || m_rivets[i]->IsDirty()) {
+                return true;
+            }
+        }
+        return false;
+    }
+
+    void CPACSRivets::ClearDirty()
+    {
+        m_dirty = false;
+        m_rivetsClean.clear();
+        for (std::size_t i = 0; i < m_rivets.size(); i++) {
+            m_rivetsClean.push_back(m_rivets[i].get());
+            m_rivets[i]->ClearDirty();
+        }
+    }
+
+    void CPACSRivets::WriteDirtyCPACS(const TixiDocumentHandle& tixiHandle, const std::string& xpath) const
+    {
+        if (m_dirty) {
+            WriteCPACS(tixiHandle, xpath);
+            return;
+        }
+
+        // write modified elements rivet
+        tixi::TixiSaveDirtyElements(tixiHandle, xpath + "/rivet", m_rivets, m_rivetsClean);
+    }
+
     const std::vector<unique_ptr<CPACSRivet> >& CPACSRivets::GetRivets() const
     {
         return m_rivets;
@@ -79,6 +117,7 @@ namespace generated
 
     void CPACSRivets::RemoveRivet(CPACSRivet& ref)
     {
+        m_dirty = true;
         for (std::size_t i = 0; i < m_rivets.size(); i++) {
             if (m_rivets[i].get() == &ref) {
                 m_rivets.erase(m_rivets.begin() + i);
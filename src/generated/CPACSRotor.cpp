@@ -31,6 +31,7 @@ namespace generated
         : m_uidMgr(uidMgr)
         , m_transformation(m_uidMgr)
         , m_rotorHub(reinterpret_cast<CCPACSRotor*>(this), m_uidMgr)
+        , m_dirty(true)
     {
         //assert(parent != NULL);
         m_parent = parent;
@@ -64,8 +65,7 @@ namespace generated
     void CPACSRotor::ReadCPACS(const TixiDocumentHandle& tixiHandle, const std::string& xpath)
     {
         // read attribute uID
-        if (tixi::TixiCheckAttribute(tixiHandle, xpath, "uID")) {
-            m_uID = tixi::TixiGetAttribute<std::string>(tixiHandle, xpath, "uID");
+        if (tixi::TixiTryGetAttribute(tixiHandle, xpath, "uID", m_uID)) {
             if (m_uID.empty()) {
                 LOG(WARNING) << "Required attribute uID is empty at xpath " << xpath;
             }
@@ -80,8 +80,7 @@ namespace generated
         }
 
         // read element name
-        if (tixi::TixiCheckElement(tixiHandle, xpath + "/name")) {
-            m_name = tixi::TixiGetElement<std::string>(tixiHandle, xpath + "/name");
+        if (tixi::TixiTryGetElement(tixiHandle, xpath + "/name", m_name)) {
             if (m_name.empty()) {
                 LOG(WARNING) << "Required element name is empty at xpath " << xpath;
             }
@@ -91,16 +90,14 @@ namespace generated
         }
 
         // read element description
-        if (tixi::TixiCheckElement(tixiHandle, xpath + "/description")) {
-            m_description = tixi::TixiGetElement<std::string>(tixiHandle, xpath + "/description");
+        if (tixi::TixiTryGetElement(tixiHandle, xpath + "/description", m_description)) {
             if (m_description->empty()) {
                 LOG(WARNING) << "Optional element description is present but empty at xpath " << xpath;
             }
         }
 
         // read element parentUID
-        if (tixi::TixiCheckElement(tixiHandle, xpath + "/parentUID")) {
-            m_parentUID = tixi::TixiGetElement<std::string>(tixiHandle, xpath + "/parentUID");
+        if (tixi::TixiTryGetElement(tixiHandle, xpath + "/parentUID", m_parentUID)) {
             if (m_parentUID->empty()) {
                 LOG(WARNING) << "Optional element parentUID is present but empty at xpath " << xpath;
             }
@@ -112,9 +109,7 @@ namespace generated
         }
 
         // read element nominalRotationsPerMinute
-        if (tixi::TixiCheckElement(tixiHandle, xpath + "/nominalRotationsPerMinute")) {
-            m_nominalRotationsPerMinute = tixi::TixiGetElement<double>(tixiHandle, xpath + "/nominalRotationsPerMinute");
-        }
+        tixi::TixiTryGetElement(tixiHandle, xpath + "/nominalRotationsPerMinute", m_nominalRotationsPerMinute);
 
         // read element transformation
         if (tixi::TixiCheckElement(tixiHandle, xpath + "/transformation")) {
@@ -208,6 +203,47 @@ namespace generated
 
     }
 
+    bool CPACSRotor::IsDirty() const
+    {
+        if (m_dirty) {
+            return true;
+        }
+        if (m_transformation.IsDirty()) {
+            return true;
+        }
+        if (m_rotorHub.IsDirty()) {
+            return true;
+        }
+        return false;
+    }
+
+    void CPACSRotor::ClearDirty()
+    {
+        m_dirty = false;
+        m_transformation.ClearDirty();
+        m_rotorHub.ClearDirty();
+    }
+
+    void CPACSRotor::WriteDirtyCPACS(const TixiDocumentHandle& tixiHandle, const std::string& xpath) const
+    {
+        if (m_dirty) {
+            WriteCPACS(tixiHandle, xpath);
+            return;
+        }
+
+        // write modified element transformation
+        if (m_transformation.IsDirty()) {
+            tixi::TixiCreateElementIfNotExists(tixiHandle, xpath + "/transformation");
+            m_transformation.WriteDirtyCPACS(tixiHandle, xpath + "/transformation");
+        }
+
+        // write modified element rotorHub
+        if (m_rotorHub.IsDirty()) {
+            tixi::TixiCreateElementIfNotExists(tixiHandle, xpath + "/rotorHub");
+            m_rotorHub.WriteDirtyCPACS(tixiHandle, xpath + "/rotorHub");
+        }
+    }
+
     const std::string& CPACSRotor::GetUID() const
     {
         return m_uID;
@@ -215,6 +251,7 @@ namespace generated
 
     void CPACSRotor::SetUID(const std::string& value)
     {
+        m_dirty = true;
         if (m_uidMgr) {
             m_uidMgr->TryUnregisterObject(m_uID);
             m_uidMgr->RegisterObject(value, *this);
@@ -229,6 +266,7 @@ namespace generated
 
     void CPACSRotor::SetSymmetry(const boost::optional<TiglSymmetryAxis>& value)
     {
+        m_dirty = true;
         m_symmetry = value;
     }
 
@@ -239,6 +277,7 @@ namespace generated
 
     void CPACSRotor::SetName(const std::string& value)
     {
+        m_dirty = true;
         m_name = value;
     }
 
@@ -249,6 +288,7 @@ namespace generated
 
     void CPACSRotor::SetDescription(const boost::optional<std::string>& value)
     {
+        m_dirty = true;
         m_description = value;
     }
 
@@ -259,6 +299,7 @@ namespace generated
 
     void CPACSRotor::SetParentUID(const boost::optional<std::string>& value)
     {
+        m_dirty = true;
         m_parentUID = value;
     }
 
@@ -269,6 +310,7 @@ namespace generated
 
     void CPACSRotor::SetType(const boost::optional<CPACSRotor_type>& value)
     {
+        m_dirty = true;
         m_type = value;
     }
 
@@ -279,6 +321,7 @@ namespace generated
 
     void CPACSRotor::SetNominalRotationsPerMinute(const boost::optional<double>& value)
     {
+        m_dirty = true;
         m_nominalRotationsPerMinute = value;
     }
 
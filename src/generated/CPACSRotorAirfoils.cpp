@@ -28,6 +28,7 @@ namespace generated
 {
     CPACSRotorAirfoils::CPACSRotorAirfoils(CTiglUIDManager* uidMgr)
         : m_uidMgr(uidMgr)
+        , m_dirty(true)
     {
     }
 
@@ -61,6 +62,43 @@ namespace generated
 
     }
 
+    bool CPACSRotorAirfoils::IsDirty() const
+    {
+        if (m_dirty) {
+            return true;
+        }
+        if (m_rotorAirfoils.size() != m_rotorAirfoilsClean.size()) {
+            return true;
+        }
+        for (std::size_t i = 0; i < m_rotorAirfoils.size(); i++) {
+            if (m_rotorAirfoils[i].get() != m_rotorAirfoilsClean[i] || m_rotorAirfoils[i]->IsDirty()) {
+                return true;
+            }
+        }
+        return false;
+    }
+
+    void CPACSRotorAirfoils::ClearDirty()
+    {
+        m_dirty = false;
+        m_rotorAirfoilsClean.clear();
+        for (std::size_t i = 0; i < m_rotorAirfoils.size(); i++) {
+            m_rotorAirfoilsClean.push_back(m_rotorAirfoils[i].get());
+            m_rotorAirfoils[i]->ClearDirty();
+        }
+    }
+
+    void CPACSRotorAirfoils::WriteDirtyCPACS(const TixiDocumentHandle& tixiHandle, const std::string& xpath) const
+    {
+        if (m_dirty) {
+            WriteCPACS(tixiHandle, xpath);
+            return;
+        }
+
+        // write modified elements rotorAirfoil
+        tixi::TixiSaveDirtyElements(tixiHandle, xpath + "/rotorAirfoil", m_rotorAirfoils, m_rotorAirfoilsClean);
+    }
+
     const std::vector<unique_ptr<CPACSProfileGeometry> >& CPACSRotorAirfoils::GetRotorAirfoils() const
     {
         return m_rotorAirfoils;
@@ -79,6 +117,7 @@ namespace generated
 
     void CPACSRotorAirfoils::RemoveRotorAirfoil(CPACSProfileGeometry& ref)
     {
+        m_dirty = true;
         for (std::size_t i = 0; i < m_rotorAirfoils.size(); i++) {
             if (m_rotorAirfoils[i].get() == &ref) {
                 m_rotorAirfoils.erase(m_rotorAirfoils.begin() + i);
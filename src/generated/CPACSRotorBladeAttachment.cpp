@@ -29,6 +29,7 @@ namespace generated
 {
     CPACSRotorBladeAttachment::CPACSRotorBladeAttachment(CCPACSRotorBladeAttachments* parent, CTiglUIDManager* uidMgr)
         : m_uidMgr(uidMgr)
+        , m_dirty(true)
     {
         //assert(parent != NULL);
         m_parent = parent;
@@ -62,8 +63,7 @@ namespace generated
     void CPACSRotorBladeAttachment::ReadCPACS(const TixiDocumentHandle& tixiHandle, const std::string& xpath)
     {
         // read attribute uID
-        if (tixi::TixiCheckAttribute(tixiHandle, xpath, "uID")) {
-            m_uID = tixi::TixiGetAttribute<std::string>(tixiHandle, xpath, "uID");
+        if (tixi::TixiTryGetAttribute(tixiHandle, xpath, "uID", m_uID)) {
             if (m_uID.empty()) {
                 LOG(WARNING) << "Required attribute uID is empty at xpath " << xpath;
             }
@@ -73,16 +73,14 @@ namespace generated
         }
 
         // read element name
-        if (tixi::TixiCheckElement(tixiHandle, xpath + "/name")) {
-            m_name = tixi::TixiGetElement<std::string>(tixiHandle, xpath + "/name");
+        if (tixi::TixiTryGetElement(tixiHandle, xpath + "/name", m_name)) {
             if (m_name->empty()) {
                 LOG(WARNING) << "Optional element name is present but empty at xpath " << xpath;
             }
         }
 
         // read element description
-        if (tixi::TixiCheckElement(tixiHandle, xpath + "/description")) {
-            m_description = tixi::TixiGetElement<std::string>(tixiHandle, xpath + "/description");
+        if (tixi::TixiTryGetElement(tixiHandle, xpath + "/description", m_description)) {
             if (m_description->empty()) {
                 LOG(WARNING) << "Optional element description is present but empty at xpath " << xpath;
             }
@@ -100,8 +98,7 @@ namespace generated
         }
 
         // read element rotorBladeUID
-        if (tixi::TixiCheckElement(tixiHandle, xpath + "/rotorBladeUID")) {
-            m_rotorBladeUID = tixi::TixiGetElement<std::string>(tixiHandle, xpath + "/rotorBladeUID");
+        if (tixi::TixiTryGetElement(tixiHandle, xpath + "/rotorBladeUID", m_rotorBladeUID)) {
             if (m_rotorBladeUID.empty()) {
                 LOG(WARNING) << "Required element rotorBladeUID is empty at xpath " << xpath;
             }
@@ -122,9 +119,7 @@ namespace generated
         }
 
         // read element numberOfBlades
-        if (tixi::TixiCheckElement(tixiHandle, xpath + "/numberOfBlades")) {
-            m_numberOfBlades_choice2 = tixi::TixiGetElement<int>(tixiHandle, xpath + "/numberOfBlades");
-        }
+        tixi::TixiTryGetElement(tixiHandle, xpath + "/numberOfBlades", m_numberOfBlades_choice2);
 
         if (m_uidMgr && !m_uID.empty()) m_uidMgr->RegisterObject(m_uID, *this);
         if (!ValidateChoices()) {
@@ -198,6 +193,51 @@ namespace generated
 
     }
 
+    bool CPACSRotorBladeAttachment::IsDirty() const
+    {
+        if (m_dirty) {
+            return true;
+        }
+        if (m_hinges && m_hinges->IsDirty()) {
+            return true;
+        }
+        if (m_azimuthAngles_choice1 && m_azimuthAngles_choice1->IsDirty()) {
+            return true;
+        }
+        return false;
+    }
+
+    void CPACSRotorBladeAttachment::ClearDirty()
+    {
+        m_dirty = false;
+        if (m_hinges) {
+            m_hinges->ClearDirty();
+        }
+        if (m_azimuthAngles_choice1) {
+            m_azimuthAngles_choice1->ClearDirty();
+        }
+    }
+
+    void CPACSRotorBladeAttachment::WriteDirtyCPACS(const TixiDocumentHandle& tixiHandle, const std::string& xpath) const
+    {
+        if (m_dirty) {
+            WriteCPACS(tixiHandle, xpath);
+            return;
+        }
+
+        // write modified element hinges
+        if (m_hinges && m_hinges->IsDirty()) {
+            tixi::TixiCreateElementIfNotExists(tixiHandle, xpath + "/hinges");
+            m_hinges->WriteDirtyCPACS(tixiHandle, xpath + "/hinges");
+        }
+
+        // write modified element azimuthAngles
+        if (m_azimuthAngles_choice1 && m_azimuthAngles_choice1->IsDirty()) {
+            tixi::TixiCreateElementIfNotExists(tixiHandle, xpath + "/azimuthAngles");
+            m_azimuthAngles_choice1->WriteDirtyCPACS(tixiHandle, xpath + "/azimuthAngles");
+        }
+    }
+
     bool CPACSRotorBladeAttachment::ValidateChoices() const
     {
         return
@@ -235,6 +275,7 @@ namespace generated
 
     void CPACSRotorBladeAttachment::SetUID(const std::string& value)
     {
+        m_dirty = true;
         if (m_uidMgr) {
             m_uidMgr->TryUnregisterObject(m_uID);
             m_uidMgr->RegisterObject(value, *this);
@@ -249,6 +290,7 @@ namespace generated
 
     void CPACSRotorBladeAttachment::SetName(const boost::optional<std::string>& value)
     {
+        m_dirty = true;
         m_name = value;
     }
 
@@ -259,6 +301,7 @@ namespace generated
 
     void CPACSRotorBladeAttachment::SetDescription(const boost::optional<std::string>& value)
     {
+        m_dirty = true;
         m_description = value;
     }
 
@@ -279,6 +322,7 @@ namespace generated
 
     void CPACSRotorBladeAttachment::SetRotorBladeUID(const std::string& value)
     {
+        m_dirty = true;
         m_rotorBladeUID = value;
     }
 
@@ -299,6 +343,7 @@ namespace generated
 
     void CPACSRotorBladeAttachment::SetNumberOfBlades_choice2(const boost::optional<int>& value)
     {
+        m_dirty = true;
         m_numberOfBlades_choice2 = value;
     }
 
@@ -311,6 +356,7 @@ namespace generated
 
     void CPACSRotorBladeAttachment::RemoveHinges()
     {
+        m_dirty = true;
         m_hinges = boost::none;
     }
 
@@ -323,6 +369,7 @@ namespace generated
 
     void CPACSRotorBladeAttachment::RemoveAzimuthAngles_choice1()
     {
+        m_dirty = true;
         m_azimuthAngles_choice1 = boost::none;
     }
 
@@ -30,6 +30,7 @@ namespace generated
 {
     CPACSRotorBladeAttachments::CPACSRotorBladeAttachments(CCPACSRotorHub* parent, CTiglUIDManager* uidMgr)
         : m_uidMgr(uidMgr)
+        , m_dirty(true)
     {
         //assert(parent != NULL);
         m_parent = parent;
@@ -75,6 +76,43 @@ namespace generated
 
     }
 
+    bool CPACSRotorBladeAttachments::IsDirty() const
+    {
+        if (m_dirty) {
+            return true;
+        }
+        if (m_rotorBladeAttachments.size() != m_rotorBladeAttachmentsClean.size()) {
+            return true;
+        }
+        for (std::size_t i = 0; i < m_rotorBladeAttachments.size(); i++) {
+            if (m_rotorBladeAttachments[i].get() != m_rotorBladeAttachmentsClean[i] || m_rotorBladeAttachments[i]->IsDirty()) {
+                return true;
+            }
+        }
+        return false;
+    }
+
+    void CPACSRotorBladeAttachments::ClearDirty()
+    {
+        m_dirty = false;
+        m_rotorBladeAttachmentsClean.clear();
+        for (std::size_t i = 0; i < m_rotorBladeAttachments.size(); i++) {
+            m_rotorBladeAttachmentsClean.push_back(m_rotorBladeAttachments[i].get());
+            m_rotorBladeAttachments[i]->ClearDirty();
+        }
+    }
+
+    void CPACSRotorBladeAttachments::WriteDirtyCPACS(const TixiDocumentHandle& tixiHandle, const std::string& xpath) const
+    {
+        if (m_dirty) {
+            WriteCPACS(tixiHandle, xpath);
+            return;
+        }
+
+        // write modified elements rotorBladeAttachment
+        tixi::TixiSaveDirtyElements(tixiHandle, xpath + "/rotorBladeAttachment", m_rotorBladeAttachments, m_rotorBladeAttachmentsClean);
+    }
+
     const std::vector<unique_ptr<CCPACSRotorBladeAttachment> >& CPACSRotorBladeAttachments::GetRotorBladeAttachments() const
     {
         return m_rotorBladeAttachments;
@@ -93,6 +131,7 @@ namespace generated
 
     void CPACSRotorBladeAttachments::RemoveRotorBladeAttachment(CCPACSRotorBladeAttachment& ref)
     {
+        m_dirty = true;
         for (std::size_t i = 0; i < m_rotorBladeAttachments.size(); i++) {
             if (m_rotorBladeAttachments[i].get() == &ref) {
                 m_rotorBladeAttachments.erase(m_rotorBladeAttachments.begin() + i);
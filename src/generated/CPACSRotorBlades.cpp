@@ -30,6 +30,7 @@ namespace generated
 {
     CPACSRotorBlades::CPACSRotorBlades(CCPACSRotorcraftModel* parent, CTiglUIDManager* uidMgr)
         : m_uidMgr(uidMgr)
+        , m_dirty(true)
     {
         //assert(parent != NULL);
         m_parent = parent;
@@ -75,6 +76,43 @@ namespace generated
 
     }
 
+    bool CPACSRotorBlades::IsDirty() const
+    {
+        if (m_dirty) {
+            return true;
+        }
+        if (m_rotorBlades.size() != m_rotorBladesClean.size()) {
+            return true;
+        }
+        for (std::size_t i = 0; i < m_rotorBlades.size(); i++) {
+            if (m_rotorBlades[i].get() != m_rotorBladesClean[i] || m_rotorBlades[i]->IsDirty()) {
+                return true;
+            }
+        }
+        return false;
+    }
+
+    void CPACSRotorBlades::ClearDirty()
+    {
+        m_dirty = false;
+        m_rotorBladesClean.clear();
+        for (std::size_t i = 0; i < m_rotorBlades.size(); i++) {
+            m_rotorBladesClean.push_back(m_rotorBlades[i].get());
+            m_rotorBlades[i]->ClearDirty();
+        }
+    }
+
+    void CPACSRotorBlades::WriteDirtyCPACS(const TixiDocumentHandle& tixiHandle, const std::string& xpath) const
+    {
+        if (m_dirty) {
+            WriteCPACS(tixiHandle, xpath);
+            return;
+        }
+
+        // write modified elements rotorBlade
+        tixi::TixiSaveDirtyElements(tixiHandle, xpath + "/rotorBlade", m_rotorBlades, m_rotorBladesClean);
+    }
+
     const std::vector<unique_ptr<CCPACSWing> >& CPACSRotorBlades::GetRotorBlades() const
     {
         return m_rotorBlades;
@@ -93,6 +131,7 @@ namespace generated
 
     void CPACSRotorBlades::RemoveRotorBlade(CCPACSWing& ref)
     {
+        m_dirty = true;
         for (std::size_t i = 0; i < m_rotorBlades.size(); i++) {
             if (m_rotorBlades[i].get() == &ref) {
                 m_rotorBlades.erase(m_rotorBlades.begin() + i);
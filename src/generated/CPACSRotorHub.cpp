@@ -30,6 +30,7 @@ namespace generated
     CPACSRotorHub::CPACSRotorHub(CCPACSRotor* parent, CTiglUIDManager* uidMgr)
         : m_uidMgr(uidMgr)
         , m_rotorBladeAttachments(reinterpret_cast<CCPACSRotorHub*>(this), m_uidMgr)
+        , m_dirty(true)
     {
         //assert(parent != NULL);
         m_parent = parent;
@@ -63,8 +64,7 @@ namespace generated
     void CPACSRotorHub::ReadCPACS(const TixiDocumentHandle& tixiHandle, const std::string& xpath)
     {
         // read attribute uID
-        if (tixi::TixiCheckAttribute(tixiHandle, xpath, "uID")) {
-            m_uID = tixi::TixiGetAttribute<std::string>(tixiHandle, xpath, "uID");
+        if (tixi::TixiTryGetAttribute(tixiHandle, xpath, "uID", m_uID)) {
             if (m_uID.empty()) {
                 LOG(WARNING) << "Required attribute uID is empty at xpath " << xpath;
             }
@@ -74,16 +74,14 @@ namespace generated
         }
 
         // read element name
-        if (tixi::TixiCheckElement(tixiHandle, xpath + "/name")) {
-            m_name = tixi::TixiGetElement<std::string>(tixiHandle, xpath + "/name");
+        if (tixi::TixiTryGetElement(tixiHandle, xpath + "/name", m_name)) {
             if (m_name->empty()) {
                 LOG(WARNING) << "Optional element name is present but empty at xpath " << xpath;
             }
         }
 
         // read element description
-        if (tixi::TixiCheckElement(tixiHandle, xpath + "/description")) {
-            m_description = tixi::TixiGetElement<std::string>(tixiHandle, xpath + "/description");
+        if (tixi::TixiTryGetElement(tixiHandle, xpath + "/description", m_description)) {
             if (m_description->empty()) {
                 LOG(WARNING) << "Optional element description is present but empty at xpath " << xpath;
             }
@@ -149,6 +147,37 @@ namespace generated
 
     }
 
+    bool CPACSRotorHub::IsDirty() const
+    {
+        if (m_dirty) {
+            return true;
+        }
+        if (m_rotorBladeAttachments.IsDirty()) {
+            return true;
+        }
+        return false;
+    }
+
+    void CPACSRotorHub::ClearDirty()
+    {
+        m_dirty = false;
+        m_rotorBladeAttachments.ClearDirty();
+    }
+
+    void CPACSRotorHub::WriteDirtyCPACS(const TixiDocumentHandle& tixiHandle, const std::string& xpath) const
+    {
+        if (m_dirty) {
+            WriteCPACS(tixiHandle, xpath);
+            return;
+        }
+
+        // write modified element rotorBladeAttachments
+        if (m_rotorBladeAttachments.IsDirty()) {
+            tixi::TixiCreateElementIfNotExists(tixiHandle, xpath + "/rotorBladeAttachments");
+            m_rotorBladeAttachments.WriteDirtyCPACS(tixiHandle, xpath + "/rotorBladeAttachments");
+        }
+    }
+
     const std::string& CPACSRotorHub::GetUID() const
     {
         return m_uID;
@@ -156,6 +185,7 @@ namespace generated
 
     void CPACSRotorHub::SetUID(const std::string& value)
     {
+        m_dirty = true;
         if (m_uidMgr) {
             m_uidMgr->TryUnregisterObject(m_uID);
             m_uidMgr->RegisterObject(value, *this);
@@ -170,6 +200,7 @@ namespace generated
 
     void CPACSRotorHub::SetName(const boost::optional<std::string>& value)
     {
+        m_dirty = true;
         m_name = value;
     }
 
@@ -180,6 +211,7 @@ namespace generated
 
     void CPACSRotorHub::SetDescription(const boost::optional<std::string>& value)
     {
+        m_dirty = true;
         m_description = value;
     }
 
@@ -190,6 +222,7 @@ namespace generated
 
     void CPACSRotorHub::SetType(const boost::optional<TiglRotorHubType>& value)
     {
+        m_dirty = true;
         m_type = value;
     }
 
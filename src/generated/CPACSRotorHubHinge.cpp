@@ -30,6 +30,7 @@ namespace generated
     CPACSRotorHubHinge::CPACSRotorHubHinge(CCPACSRotorHinges* parent, CTiglUIDManager* uidMgr)
         : m_uidMgr(uidMgr)
         , m_transformation(m_uidMgr)
+        , m_dirty(true)
     {
         //assert(parent != NULL);
         m_parent = parent;
@@ -63,8 +64,7 @@ namespace generated
     void CPACSRotorHubHinge::ReadCPACS(const TixiDocumentHandle& tixiHandle, const std::string& xpath)
     {
         // read attribute uID
-        if (tixi::TixiCheckAttribute(tixiHandle, xpath, "uID")) {
-            m_uID = tixi::TixiGetAttribute<std::string>(tixiHandle, xpath, "uID");
+        if (tixi::TixiTryGetAttribute(tixiHandle, xpath, "uID", m_uID)) {
             if (m_uID.empty()) {
                 LOG(WARNING) << "Required attribute uID is empty at xpath " << xpath;
             }
@@ -74,16 +74,14 @@ namespace generated
         }
 
         // read element name
-        if (tixi::TixiCheckElement(tixiHandle, xpath + "/name")) {
-            m_name = tixi::TixiGetElement<std::string>(tixiHandle, xpath + "/name");
+        if (tixi::TixiTryGetElement(tixiHandle, xpath + "/name", m_name)) {
             if (m_name->empty()) {
                 LOG(WARNING) << "Optional element name is present but empty at xpath " << xpath;
             }
         }
 
         // read element description
-        if (tixi::TixiCheckElement(tixiHandle, xpath + "/description")) {
-            m_description = tixi::TixiGetElement<std::string>(tixiHandle, xpath + "/description");
+        if (tixi::TixiTryGetElement(tixiHandle, xpath + "/description", m_description)) {
             if (m_description->empty()) {
                 LOG(WARNING) << "Optional element description is present but empty at xpath " << xpath;
             }
@@ -106,24 +104,16 @@ namespace generated
         }
 
         // read element neutralPosition
-        if (tixi::TixiCheckElement(tixiHandle, xpath + "/neutralPosition")) {
-            m_neutralPosition = tixi::TixiGetElement<double>(tixiHandle, xpath + "/neutralPosition");
-        }
+        tixi::TixiTryGetElement(tixiHandle, xpath + "/neutralPosition", m_neutralPosition);
 
         // read element staticStiffness
-        if (tixi::TixiCheckElement(tixiHandle, xpath + "/staticStiffness")) {
-            m_staticStiffness = tixi::TixiGetElement<double>(tixiHandle, xpath + "/staticStiffness");
-        }
+        tixi::TixiTryGetElement(tixiHandle, xpath + "/staticStiffness", m_staticStiffness);
 
         // read element dynamicStiffness
-        if (tixi::TixiCheckElement(tixiHandle, xpath + "/dynamicStiffness")) {
-            m_dynamicStiffness = tixi::TixiGetElement<double>(tixiHandle, xpath + "/dynamicStiffness");
-        }
+        tixi::TixiTryGetElement(tixiHandle, xpath + "/dynamicStiffness", m_dynamicStiffness);
 
         // read element damping
-        if (tixi::TixiCheckElement(tixiHandle, xpath + "/damping")) {
-            m_damping = tixi::TixiGetElement<double>(tixiHandle, xpath + "/damping");
-        }
+        tixi::TixiTryGetElement(tixiHandle, xpath + "/damping", m_damping);
 
         if (m_uidMgr && !m_uID.empty()) m_uidMgr->RegisterObject(m_uID, *this);
     }
@@ -209,6 +199,37 @@ namespace generated
 
     }
 
+    bool CPACSRotorHubHinge::IsDirty() const
+    {
+        if (m_dirty) {
+            return true;
+        }
+        if (m_transformation.IsDirty()) {
+            return true;
+        }
+        return false;
+    }
+
+    void CPACSRotorHubHinge::ClearDirty()
+    {
+        m_dirty = false;
+        m_transformation.ClearDirty();
+    }
+
+    void CPACSRotorHubHinge::WriteDirtyCPACS(const TixiDocumentHandle& tixiHandle, const std::string& xpath) const
+    {
+        if (m_dirty) {
+            WriteCPACS(tixiHandle, xpath);
+            return;
+        }
+
+        // write modified element transformation
+        if (m_transformation.IsDirty()) {
+            tixi::TixiCreateElementIfNotExists(tixiHandle, xpath + "/transformation");
+            m_transformation.WriteDirtyCPACS(tixiHandle, xpath + "/transformation");
+        }
+    }
+
     const std::string& CPACSRotorHubHinge::GetUID() const
     {
         return m_uID;
@@ -216,6 +237,7 @@ namespace generated
 
     void CPACSRotorHubHinge::SetUID(const std::string& value)
     {
+        m_dirty = true;
         if (m_uidMgr) {
             m_uidMgr->TryUnregisterObject(m_uID);
             m_uidMgr->RegisterObject(value, *this);
@@ -230,6 +252,7 @@ namespace generated
 
     void CPACSRotorHubHinge::SetName(const boost::optional<std::string>& value)
     {
+        m_dirty = true;
         m_name = value;
     }
 
@@ -240,6 +263,7 @@ namespace generated
 
     void CPACSRotorHubHinge::SetDescription(const boost::optional<std::string>& value)
     {
+        m_dirty = true;
         m_description = value;
     }
 
@@ -260,6 +284,7 @@ namespace generated
 
     void CPACSRotorHubHinge::SetType(const CPACSRotorHubHinge_type& value)
     {
+        m_dirty = true;
         m_type = value;
     }
 
@@ -270,6 +295,7 @@ namespace generated
 
     void CPACSRotorHubHinge::SetNeutralPosition(const boost::optional<double>& value)
     {
+        m_dirty = true;
         m_neutralPosition = value;
     }
 
@@ -280,6 +306,7 @@ namespace generated
 
     void CPACSRotorHubHinge::SetStaticStiffness(const boost::optional<double>& value)
     {
+        m_dirty = true;
         m_staticStiffness = value;
     }
 
@@ -290,6 +317,7 @@ namespace generated
 
     void CPACSRotorHubHinge::SetDynamicStiffness(const boost::optional<double>& value)
     {
+        m_dirty = true;
         m_dynamicStiffness = value;
     }
 
@@ -300,6 +328,7 @@ namespace generated
 
     void CPACSRotorHubHinge::SetDamping(const boost::optional<double>& value)
     {
+        m_dirty = true;
         m_damping = value;
     }
 
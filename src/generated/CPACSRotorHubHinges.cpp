@@ -30,6 +30,7 @@ namespace generated
 {
     CPACSRotorHubHinges::CPACSRotorHubHinges(CCPACSRotorBladeAttachment* parent, CTiglUIDManager* uidMgr)
         : m_uidMgr(uidMgr)
+        , m_dirty(true)
     {
         //assert(parent != NULL);
         m_parent = parent;
@@ -75,6 +76,43 @@ namespace generated
 
     }
 
+    bool CPACSRotorHubHinges::IsDirty() const
+    {
+        if (m_dirty) {
+            return true;
+        }
+        if (m_hinges.size() != m_hingesClean.size()) {
+            return true;
+        }
+        for (std::size_t i = 0; i < m_hinges.size(); i++) {
+            if (m_hinges[i].get() != m_hingesClean[i] || m_hinges[i]->IsDirty()) {
+                return true;
+            }
+        }
+        return false;
+    }
+
+    void CPACSRotorHubHinges::ClearDirty()
+    {
+        m_dirty = false;
+        m_hingesClean.clear();
+        for (std::size_t i = 0; i < m_hinges.size(); i++) {
+            m_hingesClean.push_back(m_hinges[i].get());
+            m_hinges[i]->ClearDirty();
+        }
+    }
+
+    void CPACSRotorHubHinges::WriteDirtyCPACS(const TixiDocumentHandle& tixiHandle, const std::string& xpath) const
+    {
+        if (m_dirty) {
+            WriteCPACS(tixiHandle, xpath);
+            return;
+        }
+
+        // write modified elements hinge
+        tixi::TixiSaveDirtyElements(tixiHandle, xpath + "/hinge", m_hinges, m_hingesClean);
+    }
+
     const std::vector<unique_ptr<CCPACSRotorHinge> >& CPACSRotorHubHinges::GetHinges() const
     {
         return m_hinges;
@@ -93,6 +131,7 @@ namespace generated
 
     void CPACSRotorHubHinges::RemoveHinge(CCPACSRotorHinge& ref)
     {
+        m_dirty = true;
         for (std::size_t i = 0; i < m_hinges.size(); i++) {
             if (m_hinges[i].get() == &ref) {
                 m_hinges.erase(m_hinges.begin() + i);
@@ -27,6 +27,7 @@ namespace generated
 {
     CPACSRotorcraftModel::CPACSRotorcraftModel(CTiglUIDManager* uidMgr)
         : m_uidMgr(uidMgr)
+        , m_dirty(true)
     {
     }
 
@@ -48,8 +49,7 @@ namespace generated
     void CPACSRotorcraftModel::ReadCPACS(const TixiDocumentHandle& tixiHandle, const std::string& xpath)
     {
         // read attribute uID
-        if (tixi::TixiCheckAttribute(tixiHandle, xpath, "uID")) {
-            m_uID = tixi::TixiGetAttribute<std::string>(tixiHandle, xpath, "uID");
+        if (tixi::TixiTryGetAttribute(tixiHandle, xpath, "uID", m_uID)) {
             if (m_uID.empty()) {
                 LOG(WARNING) << "Required attribute uID is empty at xpath " << xpath;
             }
@@ -59,8 +59,7 @@ namespace generated
         }
 
         // read element name
-        if (tixi::TixiCheckElement(tixiHandle, xpath + "/name")) {
-            m_name = tixi::TixiGetElement<std::string>(tixiHandle, xpath + "/name");
+        if (tixi::TixiTryGetElement(tixiHandle, xpath + "/name", m_name)) {
             if (m_name.empty()) {
                 LOG(WARNING) << "Required element name is empty at xpath " << xpath;
             }
@@ -70,8 +69,7 @@ namespace generated
         }
 
         // read element description
-        if (tixi::TixiCheckElement(tixiHandle, xpath + "/description")) {
-            m_description = tixi::TixiGetElement<std::string>(tixiHandle, xpath + "/description");
+        if (tixi::TixiTryGetElement(tixiHandle, xpath + "/description", m_description)) {
             if (m_description->empty()) {
                 LOG(WARNING) << "Optional element description is present but empty at xpath " << xpath;
             }
@@ -190,6 +188,75 @@ namespace generated
 
     }
 
+    bool CPACSRotorcraftModel::IsDirty() const
+    {
+        if (m_dirty) {
+            return true;
+        }
+        if (m_fuselages && m_fuselages->IsDirty()) {
+            return true;
+        }
+        if (m_wings && m_wings->IsDirty()) {
+            return true;
+        }
+        if (m_rotors && m_rotors->IsDirty()) {
+            return true;
+        }
+        if (m_rotorBlades && m_rotorBlades->IsDirty()) {
+            return true;
+        }
+        return false;
+    }
+
+    void CPACSRotorcraftModel::ClearDirty()
+    {
+        m_dirty = false;
+        if (m_fuselages) {
+            m_fuselages->ClearDirty();
+        }
+        if (m_wings) {
+            m_wings->ClearDirty();
+        }
+        if (m_rotors) {
+            m_rotors->ClearDirty();
+        }
+        if (m_rotorBlades) {
+            m_rotorBlades->ClearDirty();
+        }
+    }
+
+    void CPACSRotorcraftModel::WriteDirtyCPACS(const TixiDocumentHandle& tixiHandle, const std::string& xpath) const
+    {
+        if (m_dirty) {
+            WriteCPACS(tixiHandle, xpath);
+            return;
+        }
+
+        // write modified element fuselages
+        if (m_fuselages && m_fuselages->IsDirty()) {
+            tixi::TixiCreateElementIfNotExists(tixiHandle, xpath + "/fuselages");
+            m_fuselages->WriteDirtyCPACS(tixiHandle, xpath + "/fuselages");
+        }
+
+        // write modified element wings
+        if (m_wings && m_wings->IsDirty()) {
+            tixi::TixiCreateElementIfNotExists(tixiHandle, xpath + "/wings");
+            m_wings->WriteDirtyCPACS(tixiHandle, xpath + "/wings");
+        }
+
+        // write modified element rotors
+        if (m_rotors && m_rotors->IsDirty()) {
+            tixi::TixiCreateElementIfNotExists(tixiHandle, xpath + "/rotors");
+            m_rotors->WriteDirtyCPACS(tixiHandle, xpath + "/rotors");
+        }
+
+        // write modified element rotorBlades
+        if (m_rotorBlades && m_rotorBlades->IsDirty()) {
+            tixi::TixiCreateElementIfNotExists(tixiHandle, xpath + "/rotorBlades");
+            m_rotorBlades->WriteDirtyCPACS(tixiHandle, xpath + "/rotorBlades");
+        }
+    }
+
     const std::string& CPACSRotorcraftModel::GetUID() const
     {
         return m_uID;
@@ -197,6 +264,7 @@ namespace generated
 
     void CPACSRotorcraftModel::SetUID(const std::string& value)
     {
+        m_dirty = true;
         if (m_uidMgr) {
             m_uidMgr->TryUnregisterObject(m_uID);
             m_uidMgr->RegisterObject(value, *this);
@@ -211,6 +279,7 @@ namespace generated
 
     void CPACSRotorcraftModel::SetName(const std::string& value)
     {
+        m_dirty = true;
         m_name = value;
     }
 
@@ -221,6 +290,7 @@ namespace generated
 
     void CPACSRotorcraftModel::SetDescription(const boost::optional<std::string>& value)
     {
+        m_dirty = true;
         m_description = value;
     }
 
@@ -273,6 +343,7 @@ namespace generated
 
     void CPACSRotorcraftModel::RemoveFuselages()
     {
+        m_dirty = true;
         m_fuselages = boost::none;
     }
 
@@ -285,6 +356,7 @@ namespace generated
 
     void CPACSRotorcraftModel::RemoveWings()
     {
+        m_dirty = true;
         m_wings = boost::none;
     }
 
@@ -297,6 +369,7 @@ namespace generated
 
     void CPACSRotorcraftModel::RemoveRotors()
     {
+        m_dirty = true;
         m_rotors = boost::none;
     }
 
@@ -309,6 +382,7 @@ namespace generated
 
     void CPACSRotorcraftModel::RemoveRotorBlades()
     {
+        m_dirty = true;
         m_rotorBlades = boost::none;
     }
 
@@ -30,6 +30,7 @@ namespace generated
 {
     CPACSRotors::CPACSRotors(CCPACSRotorcraftModel* parent, CTiglUIDManager* uidMgr)
         : m_uidMgr(uidMgr)
+        , m_dirty(true)
     {
         //assert(parent != NULL);
         m_parent = parent;
@@ -75,6 +76,43 @@ namespace generated
 
     }
 
+    bool CPACSRotors::IsDirty() const
+    {
+        if (m_dirty) {
+            return true;
+        }
+        if (m_rotors.size() != m_rotorsClean.size()) {
+            return true;
+        }
+        for (std::size_t i = 0; i < m_rotors.size(); i++) {
+            if (m_rotors[i].get() != m_rotorsClean[i] || m_rotors[i]->IsDirty()) {
+                return true;
+            }
+        }
+        return false;
+    }
+
+    void CPACSRotors::ClearDirty()
+    {
+        m_dirty = false;
+        m_rotorsClean.clear();
+        for (std::size_t i = 0; i < m_rotors.size(); i++) {
+            m_rotorsClean.push_back(m_rotors[i].get());
+            m_rotors[i]->ClearDirty();
+        }
+    }
+
+    void CPACSRotors::WriteDirtyCPACS(const TixiDocumentHandle& tixiHandle, const std::string& xpath) const
+    {
+        if (m_dirty) {
+            WriteCPACS(tixiHandle, xpath);
+            return;
+        }
+
+        // write modified elements rotor
+        tixi::TixiSaveDirtyElements(tixiHandle, xpath + "/rotor", m_rotors, m_rotorsClean);
+    }
+
     const std::vector<unique_ptr<CCPACSRotor> >& CPACSRotors::GetRotors() const
     {
         return m_rotors;
@@ -93,6 +131,7 @@ namespace generated
 
     void CPACSRotors::RemoveRotor(CCPACSRotor& ref)
     {
+        m_dirty = true;
         for (std::size_t i = 0; i < m_rotors.size(); i++) {
             if (m_rotors[i].get() == &ref) {
                 m_rotors.erase(m_rotors.begin() + i);
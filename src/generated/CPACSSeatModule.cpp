@@ -29,6 +29,7 @@ namespace generated
         : m_uidMgr(uidMgr)
         , m_numberOfSeats(0)
         , m_widthOfSeatModule(0)
+        , m_dirty(true)
     {
     }
 
@@ -50,8 +51,7 @@ namespace generated
     void CPACSSeatModule::ReadCPACS(const TixiDocumentHandle& tixiHandle, const std::string& xpath)
     {
         // read attribute uID
-        if (tixi::TixiCheckAttribute(tixiHandle, xpath, "uID")) {
-            m_uID = tixi::TixiGetAttribute<std::string>(tixiHandle, xpath, "uID");
+        if (tixi::TixiTryGetAttribute(tixiHandle, xpath, "uID", m_uID)) {
             if (m_uID.empty()) {
                 LOG(WARNING) << "Required attribute uID is empty at xpath " << xpath;
             }
@@ -61,41 +61,31 @@ namespace generated
         }
 
         // read element name
-        if (tixi::TixiCheckElement(tixiHandle, xpath + "/name")) {
-            m_name = tixi::TixiGetElement<std::string>(tixiHandle, xpath + "/name");
+        if (tixi::TixiTryGetElement(tixiHandle, xpath + "/name", m_name)) {
             if (m_name->empty()) {
                 LOG(WARNING) << "Optional element name is present but empty at xpath " << xpath;
             }
         }
 
         // read element description
-        if (tixi::TixiCheckElement(tixiHandle, xpath + "/description")) {
-            m_description = tixi::TixiGetElement<std::string>(tixiHandle, xpath + "/description");
+        if (tixi::TixiTryGetElement(tixiHandle, xpath + "/description", m_description)) {
             if (m_description->empty()) {
                 LOG(WARNING) << "Optional element description is present but empty at xpath " << xpath;
             }
         }
 
         // read element numberOfSeats
-        if (tixi::TixiCheckElement(tixiHandle, xpath + "/numberOfSeats")) {
-            m_numberOfSeats = tixi::TixiGetElement<int>(tixiHandle, xpath + "/numberOfSeats");
-        }
-        else {
+        if (!tixi::TixiTryGetElement(tixiHandle, xpath + "/numberOfSeats", m_numberOfSeats)) {
             LOG(ERROR) << "Required element numberOfSeats is missing at xpath " << xpath;
         }
 
         // read element widthOfSeatModule
-        if (tixi::TixiCheckElement(tixiHandle, xpath + "/widthOfSeatModule")) {
-            m_widthOfSeatModule = tixi::TixiGetElement<double>(tixiHandle, xpath + "/widthOfSeatModule");
-        }
-        else {
+        if (!tixi::TixiTryGetElement(tixiHandle, xpath + "/widthOfSeatModule", m_widthOfSeatModule)) {
             LOG(ERROR) << "Required element widthOfSeatModule is missing at xpath " << xpath;
         }
 
         // read element moduleMass
-        if (tixi::TixiCheckElement(tixiHandle, xpath + "/moduleMass")) {
-            m_moduleMass = tixi::TixiGetElement<double>(tixiHandle, xpath + "/moduleMass");
-        }
+        tixi::TixiTryGetElement(tixiHandle, xpath + "/moduleMass", m_moduleMass);
 
         // read element moduleCoG
         if (tixi::TixiCheckElement(tixiHandle, xpath + "/moduleCoG")) {
@@ -170,6 +160,39 @@ namespace generated
 
     }
 
+    bool CPACSSeatModule::IsDirty() const
+    {
+        if (m_dirty) {
+            return true;
+        }
+        if (m_moduleCoG && m_moduleCoG->IsDirty()) {
+            return true;
+        }
+        return false;
+    }
+
+    void CPACSSeatModule::ClearDirty()
+    {
+        m_dirty = false;
+        if (m_moduleCoG) {
+            m_moduleCoG->ClearDirty();
+        }
+    }
+
+    void CPACSSeatModule::WriteDirtyCPACS(const TixiDocumentHandle& tixiHandle, const std::string& xpath) const
+    {
+        if (m_dirty) {
+            WriteCPACS(tixiHandle, xpath);
+            return;
+        }
+
+        // write modified element moduleCoG
+        if (m_moduleCoG && m_moduleCoG->IsDirty()) {
+            tixi::TixiCreateElementIfNotExists(tixiHandle, xpath + "/moduleCoG");
+            m_moduleCoG->WriteDirtyCPACS(tixiHandle, xpath + "/moduleCoG");
+        }
+    }
+
     const std::string& CPACSSeatModule::GetUID() const
     {
         return m_uID;
@@ -177,6 +200,7 @@ namespace generated
 
     void CPACSSeatModule::SetUID(const std::string& value)
     {
+        m_dirty = true;
         if (m_uidMgr) {
             m_uidMgr->TryUnregisterObject(m_uID);
             m_uidMgr->RegisterObject(value, *this);
@@ -191,6 +215,7 @@ namespace generated
 
     void CPACSSeatModule::SetName(const boost::optional<std::string>& value)
     {
+        m_dirty = true;
         m_name = value;
     }
 
@@ -201,6 +226,7 @@ namespace generated
 
     void CPACSSeatModule::SetDescription(const boost::optional<std::string>& value)
     {
+        m_dirty = true;
         m_description = value;
     }
 
@@ -211,6 +237,7 @@ namespace generated
 
     void CPACSSeatModule::SetNumberOfSeats(const int& value)
     {
+        m_dirty = true;
         m_numberOfSeats = value;
     }
 
@@ -221,6 +248,7 @@ namespace generated
 
     void CPACSSeatModule::SetWidthOfSeatModule(const double& value)
     {
+        m_dirty = true;
         m_widthOfSeatModule = value;
     }
 
@@ -231,6 +259,7 @@ namespace generated
 
     void CPACSSeatModule::SetModuleMass(const boost::optional<double>& value)
     {
+        m_dirty = true;
         m_moduleMass = value;
     }
 
@@ -253,6 +282,7 @@ namespace generated
 
     void CPACSSeatModule::RemoveModuleCoG()
     {
+        m_dirty = true;
         m_moduleCoG = boost::none;
     }
 
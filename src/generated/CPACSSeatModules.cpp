@@ -28,6 +28,7 @@ namespace generated
 {
     CPACSSeatModules::CPACSSeatModules(CTiglUIDManager* uidMgr)
         : m_uidMgr(uidMgr)
+        , m_dirty(true)
     {
     }
 
@@ -61,6 +62,43 @@ namespace generated
 
     }
 
+    bool CPACSSeatModules::IsDirty() const
+    {
+        if (m_dirty) {
+            return true;
+        }
+        if (m_seatModules.size() != m_seatModulesClean.size()) {
+            return true;
+        }
+        for (std::size_t i = 0; i < m_seatModules.size(); i++) {
+            if (m_seatModules[i].get() != m_seatModulesClean[i] || m_seatModules[i]->IsDirty()) {
+                return true;
+            }
+        }
+        return false;
+    }
+
+    void CPACSSeatModules::ClearDirty()
+    {
+        m_dirty = false;
+        m_seatModulesClean.clear();
+        for (std::size_t i = 0; i < m_seatModules.size(); i++) {
+            m_seatModulesClean.push_back(m_seatModules[i].get());
+            m_seatModules[i]->ClearDirty();
+        }
+    }
+
+    void CPACSSeatModules::WriteDirtyCPACS(const TixiDocumentHandle& tixiHandle, const std::string& xpath) const
+    {
+        if (m_dirty) {
+            WriteCPACS(tixiHandle, xpath);
+            return;
+        }
+
+        // write modified elements seatModule
+        tixi::TixiSaveDirtyElements(tixiHandle, xpath + "/seatModule", m_seatModules, m_seatModulesClean);
+    }
+
     const std::vector<unique_ptr<CPACSSeatModule> >& CPACSSeatModules::GetSeatModules() const
     {
         return m_seatModules;
@@ -79,6 +117,7 @@ namespace generated
 
     void CPACSSeatModules::RemoveSeatModule(CPACSSeatModule& ref)
     {
+        m_dirty = true;
         for (std::size_t i = 0; i < m_seatModules.size(); i++) {
             if (m_seatModules[i].get() == &ref) {
                 m_seatModules.erase(m_seatModules.begin() + i);
@@ -27,6 +27,7 @@ namespace generated
 {
     CPACSSheet::CPACSSheet(CTiglUIDManager* uidMgr)
         : m_uidMgr(uidMgr)
+        , m_dirty(true)
     {
     }
 
@@ -48,8 +49,7 @@ namespace generated
     void CPACSSheet::ReadCPACS(const TixiDocumentHandle& tixiHandle, const std::string& xpath)
     {
         // read attribute uID
-        if (tixi::TixiCheckAttribute(tixiHandle, xpath, "uID")) {
-            m_uID = tixi::TixiGetAttribute<std::string>(tixiHandle, xpath, "uID");
+        if (tixi::TixiTryGetAttribute(tixiHandle, xpath, "uID", m_uID)) {
             if (m_uID.empty()) {
                 LOG(WARNING) << "Required attribute uID is empty at xpath " << xpath;
             }
@@ -59,24 +59,21 @@ namespace generated
         }
 
         // read element name
-        if (tixi::TixiCheckElement(tixiHandle, xpath + "/name")) {
-            m_name = tixi::TixiGetElement<std::string>(tixiHandle, xpath + "/name");
+        if (tixi::TixiTryGetElement(tixiHandle, xpath + "/name", m_name)) {
             if (m_name->empty()) {
                 LOG(WARNING) << "Optional element name is present but empty at xpath " << xpath;
             }
         }
 
         // read element description
-        if (tixi::TixiCheckElement(tixiHandle, xpath + "/description")) {
-            m_description = tixi::TixiGetElement<std::string>(tixiHandle, xpath + "/description");
+        if (tixi::TixiTryGetElement(tixiHandle, xpath + "/description", m_description)) {
             if (m_description->empty()) {
                 LOG(WARNING) << "Optional element description is present but empty at xpath " << xpath;
             }
         }
 
         // read element fromPointUID
-        if (tixi::TixiCheckElement(tixiHandle, xpath + "/fromPointUID")) {
-            m_fromPointUID = tixi::TixiGetElement<std::string>(tixiHandle, xpath + "/fromPointUID");
+        if (tixi::TixiTryGetElement(tixiHandle, xpath + "/fromPointUID", m_fromPointUID)) {
             if (m_fromPointUID.empty()) {
                 LOG(WARNING) << "Required element fromPointUID is empty at xpath " << xpath;
             }
@@ -102,8 +99,7 @@ namespace generated
         }
 
         // read element toPointUID
-        if (tixi::TixiCheckElement(tixiHandle, xpath + "/toPointUID")) {
-            m_toPointUID = tixi::TixiGetElement<std::string>(tixiHandle, xpath + "/toPointUID");
+        if (tixi::TixiTryGetElement(tixiHandle, xpath + "/toPointUID", m_toPointUID)) {
             if (m_toPointUID.empty()) {
                 LOG(WARNING) << "Required element toPointUID is empty at xpath " << xpath;
             }
@@ -212,6 +208,51 @@ namespace generated
 
     }
 
+    bool CPACSSheet::IsDirty() const
+    {
+        if (m_dirty) {
+            return true;
+        }
+        if (m_orientationAtP1 && m_orientationAtP1->IsDirty()) {
+            return true;
+        }
+        if (m_orientationAtP2 && m_orientationAtP2->IsDirty()) {
+            return true;
+        }
+        return false;
+    }
+
+    void CPACSSheet::ClearDirty()
+    {
+        m_dirty = false;
+        if (m_orientationAtP1) {
+            m_orientationAtP1->ClearDirty();
+        }
+        if (m_orientationAtP2) {
+            m_orientationAtP2->ClearDirty();
+        }
+    }
+
+    void CPACSSheet::WriteDirtyCPACS(const TixiDocumentHandle& tixiHandle, const std::string& xpath) const
+    {
+        if (m_dirty) {
+            WriteCPACS(tixiHandle, xpath);
+            return;
+        }
+
+        // write modified element orientationAtP1
+        if (m_orientationAtP1 && m_orientationAtP1->IsDirty()) {
+            tixi::TixiCreateElementIfNotExists(tixiHandle, xpath + "/orientationAtP1");
+            m_orientationAtP1->WriteDirtyCPACS(tixiHandle, xpath + "/orientationAtP1");
+        }
+
+        // write modified element orientationAtP2
+        if (m_orientationAtP2 && m_orientationAtP2->IsDirty()) {
+            tixi::TixiCreateElementIfNotExists(tixiHandle, xpath + "/orientationAtP2");
+            m_orientationAtP2->WriteDirtyCPACS(tixiHandle, xpath + "/orientationAtP2");
+        }
+    }
+
     const std::string& CPACSSheet::GetUID() const
     {
         return m_uID;
@@ -219,6 +260,7 @@ namespace generated
 
     void CPACSSheet::SetUID(const std::string& value)
     {
+        m_dirty = true;
         if (m_uidMgr) {
             m_uidMgr->TryUnregisterObject(m_uID);
             m_uidMgr->RegisterObject(value, *this);
@@ -233,6 +275,7 @@ namespace generated
 
     void CPACSSheet::SetName(const boost::optional<std::string>& value)
     {
+        m_dirty = true;
         m_name = value;
     }
 
@@ -243,6 +286,7 @@ namespace generated
 
     void CPACSSheet::SetDescription(const boost::optional<std::string>& value)
     {
+        m_dirty = true;
         m_description = value;
     }
 
@@ -253,6 +297,7 @@ namespace generated
 
     void CPACSSheet::SetFromPointUID(const std::string& value)
     {
+        m_dirty = true;
         m_fromPointUID = value;
     }
 
@@ -263,6 +308,7 @@ namespace generated
 
     void CPACSSheet::SetContinuityAtP1(const boost::optional<CPACSContinuityAtP>& value)
     {
+        m_dirty = true;
         m_continuityAtP1 = value;
     }
 
@@ -283,6 +329,7 @@ namespace generated
 
     void CPACSSheet::SetToPointUID(const std::string& value)
     {
+        m_dirty = true;
         m_toPointUID = value;
     }
 
@@ -293,6 +340,7 @@ namespace generated
 
     void CPACSSheet::SetContinuityAtP2(const boost::optional<CPACSContinuityAtP>& value)
     {
+        m_dirty = true;
         m_continuityAtP2 = value;
     }
 
@@ -315,6 +363,7 @@ namespace generated
 
     void CPACSSheet::RemoveOrientationAtP1()
     {
+        m_dirty = true;
         m_orientationAtP1 = boost::none;
     }
 
@@ -327,6 +376,7 @@ namespace generated
 
     void CPACSSheet::RemoveOrientationAtP2()
     {
+        m_dirty = true;
         m_orientationAtP2 = boost::none;
     }
 
@@ -27,6 +27,7 @@ namespace generated
 {
     CPACSSheet3D::CPACSSheet3D(CTiglUIDManager* uidMgr)
         : m_uidMgr(uidMgr)
+        , m_dirty(true)
     {
     }
 
@@ -48,8 +49,7 @@ namespace generated
     void CPACSSheet3D::ReadCPACS(const TixiDocumentHandle& tixiHandle, const std::string& xpath)
     {
         // read attribute uID
-        if (tixi::TixiCheckAttribute(tixiHandle, xpath, "uID")) {
-            m_uID = tixi::TixiGetAttribute<std::string>(tixiHandle, xpath, "uID");
+        if (tixi::TixiTryGetAttribute(tixiHandle, xpath, "uID", m_uID)) {
             if (m_uID.empty()) {
                 LOG(WARNING) << "Required attribute uID is empty at xpath " << xpath;
             }
@@ -59,8 +59,7 @@ namespace generated
         }
 
         // read element name
-        if (tixi::TixiCheckElement(tixiHandle, xpath + "/name")) {
-            m_name = tixi::TixiGetElement<std::string>(tixiHandle, xpath + "/name");
+        if (tixi::TixiTryGetElement(tixiHandle, xpath + "/name", m_name)) {
             if (m_name.empty()) {
                 LOG(WARNING) << "Required element name is empty at xpath " << xpath;
             }
@@ -70,8 +69,7 @@ namespace generated
         }
 
         // read element description
-        if (tixi::TixiCheckElement(tixiHandle, xpath + "/description")) {
-            m_description = tixi::TixiGetElement<std::string>(tixiHandle, xpath + "/description");
+        if (tixi::TixiTryGetElement(tixiHandle, xpath + "/description", m_description)) {
             if (m_description->empty()) {
                 LOG(WARNING) << "Optional element description is present but empty at xpath " << xpath;
             }
@@ -114,6 +112,37 @@ namespace generated
 
     }
 
+    bool CPACSSheet3D::IsDirty() const
+    {
+        if (m_dirty) {
+            return true;
+        }
+        if (m_sheetPoints.IsDirty()) {
+            return true;
+        }
+        return false;
+    }
+
+    void CPACSSheet3D::ClearDirty()
+    {
+        m_dirty = false;
+        m_sheetPoints.ClearDirty();
+    }
+
+    void CPACSSheet3D::WriteDirtyCPACS(const TixiDocumentHandle& tixiHandle, const std::string& xpath) const
+    {
+        if (m_dirty) {
+            WriteCPACS(tixiHandle, xpath);
+            return;
+        }
+
+        // write modified element sheetPoints
+        if (m_sheetPoints.IsDirty()) {
+            tixi::TixiCreateElementIfNotExists(tixiHandle, xpath + "/sheetPoints");
+            m_sheetPoints.WriteDirtyCPACS(tixiHandle, xpath + "/sheetPoints");
+        }
+    }
+
     const std::string& CPACSSheet3D::GetUID() const
     {
         return m_uID;
@@ -121,6 +150,7 @@ namespace generated
 
     void CPACSSheet3D::SetUID(const std::string& value)
     {
+        m_dirty = true;
         if (m_uidMgr) {
             m_uidMgr->TryUnregisterObject(m_uID);
             m_uidMgr->RegisterObject(value, *this);
@@ -135,6 +165,7 @@ namespace generated
 
     void CPACSSheet3D::SetName(const std::string& value)
     {
+        m_dirty = true;
         m_name = value;
     }
 
@@ -145,6 +176,7 @@ namespace generated
 
     void CPACSSheet3D::SetDescription(const boost::optional<std::string>& value)
     {
+        m_dirty = true;
         m_description = value;
     }
 
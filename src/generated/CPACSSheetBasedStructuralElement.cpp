@@ -27,6 +27,7 @@ namespace generated
 {
     CPACSSheetBasedStructuralElement::CPACSSheetBasedStructuralElement(CTiglUIDManager* uidMgr)
         : m_uidMgr(uidMgr)
+        , m_dirty(true)
     {
     }
 
@@ -48,8 +49,7 @@ namespace generated
     void CPACSSheetBasedStructuralElement::ReadCPACS(const TixiDocumentHandle& tixiHandle, const std::string& xpath)
     {
         // read attribute uID
-        if (tixi::TixiCheckAttribute(tixiHandle, xpath, "uID")) {
-            m_uID = tixi::TixiGetAttribute<std::string>(tixiHandle, xpath, "uID");
+        if (tixi::TixiTryGetAttribute(tixiHandle, xpath, "uID", m_uID)) {
             if (m_uID.empty()) {
                 LOG(WARNING) << "Required attribute uID is empty at xpath " << xpath;
             }
@@ -80,6 +80,37 @@ namespace generated
 
     }
 
+    bool CPACSSheetBasedStructuralElement::IsDirty() const
+    {
+        if (m_dirty) {
+            return true;
+        }
+        if (m_materialDefinition.IsDirty()) {
+            return true;
+        }
+        return false;
+    }
+
+    void CPACSSheetBasedStructuralElement::ClearDirty()
+    {
+        m_dirty = false;
+        m_materialDefinition.ClearDirty();
+    }
+
+    void CPACSSheetBasedStructuralElement::WriteDirtyCPACS(const TixiDocumentHandle& tixiHandle, const std::string& xpath) const
+    {
+        if (m_dirty) {
+            WriteCPACS(tixiHandle, xpath);
+            return;
+        }
+
+        // write modified element materialDefinition
+        if (m_materialDefinition.IsDirty()) {
+            tixi::TixiCreateElementIfNotExists(tixiHandle, xpath + "/materialDefinition");
+            m_materialDefinition.WriteDirtyCPACS(tixiHandle, xpath + "/materialDefinition");
+        }
+    }
+
     const std::string& CPACSSheetBasedStructuralElement::GetUID() const
     {
         return m_uID;
@@ -87,6 +118,7 @@ namespace generated
 
     void CPACSSheetBasedStructuralElement::SetUID(const std::string& value)
     {
+        m_dirty = true;
         if (m_uidMgr) {
             m_uidMgr->TryUnregisterObject(m_uID);
             m_uidMgr->RegisterObject(value, *this);
@@ -28,6 +28,7 @@ namespace generated
 {
     CPACSSheetBasedStructuralElements::CPACSSheetBasedStructuralElements(CTiglUIDManager* uidMgr)
         : m_uidMgr(uidMgr)
+        , m_dirty(true)
     {
     }
 
@@ -61,6 +62,43 @@ namespace generated
 
     }
 
+    bool CPACSSheetBasedStructuralElements::IsDirty() const
+    {
+        if (m_dirty) {
+            return true;
+        }
+        if (m_sheetBasedStructuralElements.size() != m_sheetBasedStructuralElementsClean.size()) {
+            return true;
+        }
+        for (std::size_t i = 0; i < m_sheetBasedStructuralElements.size(); i++) {
+            if (m_sheetBasedStructuralElements[i].get() != m_sheetBasedStructuralElementsClean[i] || m_sheetBasedStructuralElements[i]->IsDirty()) {
+                return true;
+            }
+        }
+        return false;
+    }
+
+    void CPACSSheetBasedStructuralElements::ClearDirty()
+    {
+        m_dirty = false;
+        m_sheetBasedStructuralElementsClean.clear();
+        for (std::size_t i = 0; i < m_sheetBasedStructuralElements.size(); i++) {
+            m_sheetBasedStructuralElementsClean.push_back(m_sheetBasedStructuralElements[i].get());
+            m_sheetBasedStructuralElements[i]->ClearDirty();
+        }
+    }
+
+    void CPACSSheetBasedStructuralElements::WriteDirtyCPACS(const TixiDocumentHandle& tixiHandle, const std::string& xpath) const
+    {
+        if (m_dirty) {
+            WriteCPACS(tixiHandle, xpath);
+            return;
+        }
+
+        // write modified elements sheetBasedStructuralElement
+        tixi::TixiSaveDirtyElements(tixiHandle, xpath + "/sheetBasedStructuralElement", m_sheetBasedStructuralElements, m_sheetBasedStructuralElementsClean);
+    }
+
     const std::vector<unique_ptr<CPACSSheetBasedStructuralElement> >& CPACSSheetBasedStructuralElements::GetSheetBasedStructuralElements() const
     {
         return m_sheetBasedStructuralElements;
@@ -79,6 +117,7 @@ namespace generated
 
     void CPACSSheetBasedStructuralElements::RemoveSheetBasedStructuralElement(CPACSSheetBasedStructuralElement& ref)
     {
+        m_dirty = true;
         for (std::size_t i = 0; i < m_sheetBasedStructuralElements.size(); i++) {
             if (m_sheetBasedStructuralElements[i].get() == &ref) {
                 m_sheetBasedStructuralElements.erase(m_sheetBasedStructuralElements.begin() + i);
@@ -30,6 +30,7 @@ namespace generated
 {
     CPACSSheetList::CPACSSheetList(CPACSStructuralProfile* parent, CTiglUIDManager* uidMgr)
         : m_uidMgr(uidMgr)
+        , m_dirty(true)
     {
         //assert(parent != NULL);
         m_parent = parent;
@@ -75,6 +76,43 @@ namespace generated
 
     }
 
+    bool CPACSSheetList::IsDirty() const
+    {
+        if (m_dirty) {
+            return true;
+        }
+        if (m_sheets.size() != m_sheetsClean.size()) {
+            return true;
+        }
+        for (std::size_t i = 0; i < m_sheets.size(); i++) {
+            if (m_sheets[i].get() != m_sheetsClean[i] || m_sheets[i]->IsDirty()) {
+                return true;
+            }
+        }
+        return false;
+    }
+
+    void CPACSSheetList::ClearDirty()
+    {
+        m_dirty = false;
+        m_sheetsClean.clear();
+        for (std::size_t i = 0; i < m_sheets.size(); i++) {
+            m_sheetsClean.push_back(m_sheets[i].get());
+            m_sheets[i]->ClearDirty();
+        }
+    }
+
+    void CPACSSheetList::WriteDirtyCPACS(const TixiDocumentHandle& tixiHandle, const std::string& xpath) const
+    {
+        if (m_dirty) {
+            WriteCPACS(tixiHandle, xpath);
+            return;
+        }
+
+        // write modified elements sheet
+        tixi::TixiSaveDirtyElements(tixiHandle, xpath + "/sheet", m_sheets, m_sheetsClean);
+    }
+
     const std::vector<unique_ptr<CPACSSheet> >& CPACSSheetList::GetSheets() const
     {
         return m_sheets;
@@ -93,6 +131,7 @@ namespace generated
 
     void CPACSSheetList::RemoveSheet(CPACSSheet& ref)
     {
+        m_dirty = true;
         for (std::size_t i = 0; i < m_sheets.size(); i++) {
             if (m_sheets[i].get() == &ref) {
                 m_sheets.erase(m_sheets.begin() + i);
@@ -59,6 +59,10 @@ namespace generated
         TIGL_EXPORT virtual void ReadCPACS(const TixiDocumentHandle& tixiHandle, const std::string& xpath);
         TIGL_EXPORT virtual void WriteCPACS(const TixiDocumentHandle& tixiHandle, const std::string& xpath) const;
 
+        TIGL_EXPORT virtual bool IsDirty() const;
+        TIGL_EXPORT virtual void ClearDirty();
+        TIGL_EXPORT virtual void WriteDirtyCPACS(const TixiDocumentHandle& tixiHandle, const std::string& xpath) const;
+
         TIGL_EXPORT virtual const std::vector<unique_ptr<CPACSSheet> >& GetSheets() const;
         TIGL_EXPORT virtual std::vector<unique_ptr<CPACSSheet> >& GetSheets();
 
@@ -72,6 +76,12 @@ namespace generated
 
         std::vector<unique_ptr<CPACSSheet> > m_sheets;
 
+        /// Set by the setters, cleared after the object has been read or written
+        bool m_dirty;
+
+        /// List elements at the last call of ClearDirty
+        std::vector<const CPACSSheet*> m_sheetsClean;
+
     private:
 #ifdef HAVE_CPP11
         CPACSSheetList(const CPACSSheetList&) = delete;
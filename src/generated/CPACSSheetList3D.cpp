@@ -28,6 +28,7 @@ namespace generated
 {
     CPACSSheetList3D::CPACSSheetList3D(CTiglUIDManager* uidMgr)
         : m_uidMgr(uidMgr)
+        , m_dirty(true)
     {
     }
 
@@ -61,6 +62,43 @@ namespace generated
 
     }
 
+    bool CPACSSheetList3D::IsDirty() const
+    {
+        if (m_dirty) {
+            return true;
+        }
+        if (m_sheet3Ds.size() != m_sheet3DsClean.size()) {
+            return true;
+        }
+        for (std::size_t i = 0; i < m_sheet3Ds.size(); i++) {
+            if (m_sheet3Ds[i].get() != m_sheet3DsClean[i] || m_sheet3Ds[i]->IsDirty()) {
+                return true;
+            }
+        }
+        return false;
+    }
+
+    void CPACSSheetList3D::ClearDirty()
+    {
+        m_dirty = false;
+        m_sheet3DsClean.clear();
+        for (std::size_t i = 0; i < m_sheet3Ds.size(); i++) {
+            m_sheet3DsClean.push_back(m_sheet3Ds[i].get());
+            m_sheet3Ds[i]->ClearDirty();
+        }
+    }
+
+    void CPACSSheetList3D::WriteDirtyCPACS(const TixiDocumentHandle& tixiHandle, const std::string& xpath) const
+    {
+        if (m_dirty) {
+            WriteCPACS(tixiHandle, xpath);
+            return;
+        }
+
+        // write modified elements sheet3D
+        tixi::TixiSaveDirtyElements(tixiHandle, xpath + "/sheet3D", m_sheet3Ds, m_sheet3DsClean);
+    }
+
     const std::vector<unique_ptr<CPACSSheet3D> >& CPACSSheetList3D::GetSheet3Ds() const
     {
         return m_sheet3Ds;
@@ -79,6 +117,7 @@ namespace generated
 
     void CPACSSheetList3D::RemoveSheet3D(CPACSSheet3D& ref)
     {
+        m_dirty = true;
         for (std::size_t i = 0; i < m_sheet3Ds.size(); i++) {
             if (m_sheet3Ds[i].get() == &ref) {
                 m_sheet3Ds.erase(m_sheet3Ds.begin() + i);
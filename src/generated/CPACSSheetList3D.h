@@ -51,6 +51,10 @@ namespace generated
         TIGL_EXPORT virtual void ReadCPACS(const TixiDocumentHandle& tixiHandle, const std::string& xpath);
         TIGL_EXPORT virtual void WriteCPACS(const TixiDocumentHandle& tixiHandle, const std::string& xpath) const;
 
+        TIGL_EXPORT virtual bool IsDirty() const;
+        TIGL_EXPORT virtual void ClearDirty();
+        TIGL_EXPORT virtual void WriteDirtyCPACS(const TixiDocumentHandle& tixiHandle, const std::string& xpath) const;
+
         TIGL_EXPORT virtual const std::vector<unique_ptr<CPACSSheet3D> >& GetSheet3Ds() const;
         TIGL_EXPORT virtual std::vector<unique_ptr<CPACSSheet3D> >& GetSheet3Ds();
 
@@ -62,6 +66,12 @@ namespace generated
 
         std::vector<unique_ptr<CPACSSheet3D> > m_sheet3Ds;
 
+        /// Set by the setters, cleared after the object has been read or written
+        bool m_dirty;
+
+        /// List elements at the last call of ClearDirty
+        std::vector<const CPACSSheet3D*> m_sheet3DsClean;
+
     private:
 #ifdef HAVE_CPP11
         CPACSSheetList3D(const CPACSSheetList3D&) = delete;
@@ -25,6 +25,7 @@ namespace tigl
 namespace generated
 {
     CPACSSheetPoints::CPACSSheetPoints()
+        : m_dirty(true)
     {
     }
 
@@ -48,6 +49,23 @@ namespace generated
 
     }
 
+    bool CPACSSheetPoints::IsDirty() const
+    {
+        return m_dirty;
+    }
+
+    void CPACSSheetPoints::ClearDirty()
+    {
+        m_dirty = false;
+    }
+
+    void CPACSSheetPoints::WriteDirtyCPACS(const TixiDocumentHandle& tixiHandle, const std::string& xpath) const
+    {
+        if (m_dirty) {
+            WriteCPACS(tixiHandle, xpath);
+        }
+    }
+
     const std::vector<std::string>& CPACSSheetPoints::GetSheetPointUIDs() const
     {
         return m_sheetPointUIDs;
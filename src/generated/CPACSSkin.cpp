@@ -29,6 +29,7 @@ namespace generated
 {
     CPACSSkin::CPACSSkin(CCPACSFuselageStructure* parent, CTiglUIDManager* uidMgr)
         : m_uidMgr(uidMgr)
+        , m_dirty(true)
     {
         //assert(parent != NULL);
         m_parent = parent;
@@ -61,8 +62,7 @@ namespace generated
     void CPACSSkin::ReadCPACS(const TixiDocumentHandle& tixiHandle, const std::string& xpath)
     {
         // read element standardSheetElementUID
-        if (tixi::TixiCheckElement(tixiHandle, xpath + "/standardSheetElementUID")) {
-            m_standardSheetElementUID = tixi::TixiGetElement<std::string>(tixiHandle, xpath + "/standardSheetElementUID");
+        if (tixi::TixiTryGetElement(tixiHandle, xpath + "/standardSheetElementUID", m_standardSheetElementUID)) {
             if (m_standardSheetElementUID->empty()) {
                 LOG(WARNING) << "Optional element standardSheetElementUID is present but empty at xpath " << xpath;
             }
@@ -107,6 +107,39 @@ namespace generated
 
     }
 
+    bool CPACSSkin::IsDirty() const
+    {
+        if (m_dirty) {
+            return true;
+        }
+        if (m_skinSegments && m_skinSegments->IsDirty()) {
+            return true;
+        }
+        return false;
+    }
+
+    void CPACSSkin::ClearDirty()
+    {
+        m_dirty = false;
+        if (m_skinSegments) {
+            m_skinSegments->ClearDirty();
+        }
+    }
+
+    void CPACSSkin::WriteDirtyCPACS(const TixiDocumentHandle& tixiHandle, const std::string& xpath) const
+    {
+        if (m_dirty) {
+            WriteCPACS(tixiHandle, xpath);
+            return;
+        }
+
+        // write modified element skinSegments
+        if (m_skinSegments && m_skinSegments->IsDirty()) {
+            tixi::TixiCreateElementIfNotExists(tixiHandle, xpath + "/skinSegments");
+            m_skinSegments->WriteDirtyCPACS(tixiHandle, xpath + "/skinSegments");
+        }
+    }
+
     const boost::optional<std::string>& CPACSSkin::GetStandardSheetElementUID() const
     {
         return m_standardSheetElementUID;
@@ -114,6 +147,7 @@ namespace generated
 
     void CPACSSkin::SetStandardSheetElementUID(const boost::optional<std::string>& value)
     {
+        m_dirty = true;
         m_standardSheetElementUID = value;
     }
 
@@ -136,6 +170,7 @@ namespace generated
 
     void CPACSSkin::RemoveSkinSegments()
     {
+        m_dirty = true;
         m_skinSegments = boost::none;
     }
 
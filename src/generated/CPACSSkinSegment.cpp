@@ -29,6 +29,7 @@ namespace generated
 {
     CPACSSkinSegment::CPACSSkinSegment(CPACSSkinSegments* parent, CTiglUIDManager* uidMgr)
         : m_uidMgr(uidMgr)
+        , m_dirty(true)
     {
         //assert(parent != NULL);
         m_parent = parent;
@@ -62,8 +63,7 @@ namespace generated
     void CPACSSkinSegment::ReadCPACS(const TixiDocumentHandle& tixiHandle, const std::string& xpath)
     {
         // read attribute uID
-        if (tixi::TixiCheckAttribute(tixiHandle, xpath, "uID")) {
-            m_uID = tixi::TixiGetAttribute<std::string>(tixiHandle, xpath, "uID");
+        if (tixi::TixiTryGetAttribute(tixiHandle, xpath, "uID", m_uID)) {
             if (m_uID.empty()) {
                 LOG(WARNING) << "Required attribute uID is empty at xpath " << xpath;
             }
@@ -73,8 +73,7 @@ namespace generated
         }
 
         // read element sheetElementUID
-        if (tixi::TixiCheckElement(tixiHandle, xpath + "/sheetElementUID")) {
-            m_sheetElementUID = tixi::TixiGetElement<std::string>(tixiHandle, xpath + "/sheetElementUID");
+        if (tixi::TixiTryGetElement(tixiHandle, xpath + "/sheetElementUID", m_sheetElementUID)) {
             if (m_sheetElementUID.empty()) {
                 LOG(WARNING) << "Required element sheetElementUID is empty at xpath " << xpath;
             }
@@ -84,8 +83,7 @@ namespace generated
         }
 
         // read element startFrameUID
-        if (tixi::TixiCheckElement(tixiHandle, xpath + "/startFrameUID")) {
-            m_startFrameUID = tixi::TixiGetElement<std::string>(tixiHandle, xpath + "/startFrameUID");
+        if (tixi::TixiTryGetElement(tixiHandle, xpath + "/startFrameUID", m_startFrameUID)) {
             if (m_startFrameUID.empty()) {
                 LOG(WARNING) << "Required element startFrameUID is empty at xpath " << xpath;
             }
@@ -95,8 +93,7 @@ namespace generated
         }
 
         // read element endFrameUID
-        if (tixi::TixiCheckElement(tixiHandle, xpath + "/endFrameUID")) {
-            m_endFrameUID = tixi::TixiGetElement<std::string>(tixiHandle, xpath + "/endFrameUID");
+        if (tixi::TixiTryGetElement(tixiHandle, xpath + "/endFrameUID", m_endFrameUID)) {
             if (m_endFrameUID.empty()) {
                 LOG(WARNING) << "Required element endFrameUID is empty at xpath " << xpath;
             }
@@ -106,8 +103,7 @@ namespace generated
         }
 
         // read element startStringerUID
-        if (tixi::TixiCheckElement(tixiHandle, xpath + "/startStringerUID")) {
-            m_startStringerUID = tixi::TixiGetElement<std::string>(tixiHandle, xpath + "/startStringerUID");
+        if (tixi::TixiTryGetElement(tixiHandle, xpath + "/startStringerUID", m_startStringerUID)) {
             if (m_startStringerUID.empty()) {
                 LOG(WARNING) << "Required element startStringerUID is empty at xpath " << xpath;
             }
@@ -117,8 +113,7 @@ namespace generated
         }
 
         // read element endStringerUID
-        if (tixi::TixiCheckElement(tixiHandle, xpath + "/endStringerUID")) {
-            m_endStringerUID = tixi::TixiGetElement<std::string>(tixiHandle, xpath + "/endStringerUID");
+        if (tixi::TixiTryGetElement(tixiHandle, xpath + "/endStringerUID", m_endStringerUID)) {
             if (m_endStringerUID->empty()) {
                 LOG(WARNING) << "Optional element endStringerUID is present but empty at xpath " << xpath;
             }
@@ -161,6 +156,23 @@ namespace generated
 
     }
 
+    bool CPACSSkinSegment::IsDirty() const
+    {
+        return m_dirty;
+    }
+
+    void CPACSSkinSegment::ClearDirty()
+    {
+        m_dirty = false;
+    }
+
+    void CPACSSkinSegment::WriteDirtyCPACS(const TixiDocumentHandle& tixiHandle, const std::string& xpath) const
+    {
+        if (m_dirty) {
+            WriteCPACS(tixiHandle, xpath);
+        }
+    }
+
     const std::string& CPACSSkinSegment::GetUID() const
     {
         return m_uID;
@@ -168,6 +180,7 @@ namespace generated
 
     void CPACSSkinSegment::SetUID(const std::string& value)
     {
+        m_dirty = true;
         if (m_uidMgr) {
             m_uidMgr->TryUnregisterObject(m_uID);
             m_uidMgr->RegisterObject(value, *this);
@@ -182,6 +195,7 @@ namespace generated
 
     void CPACSSkinSegment::SetSheetElementUID(const std::string& value)
     {
+        m_dirty = true;
         m_sheetElementUID = value;
     }
 
@@ -192,6 +206,7 @@ namespace generated
 
     void CPACSSkinSegment::SetStartFrameUID(const std::string& value)
     {
+        m_dirty = true;
         m_startFrameUID = value;
     }
 
@@ -202,6 +217,7 @@ namespace generated
 
     void CPACSSkinSegment::SetEndFrameUID(const std::string& value)
     {
+        m_dirty = true;
         m_endFrameUID = value;
     }
 
@@ -212,6 +228,7 @@ namespace generated
 
     void CPACSSkinSegment::SetStartStringerUID(const std::string& value)
     {
+        m_dirty = true;
         m_startStringerUID = value;
     }
 
@@ -222,6 +239,7 @@ namespace generated
 
     void CPACSSkinSegment::SetEndStringerUID(const boost::optional<std::string>& value)
     {
+        m_dirty = true;
         m_endStringerUID = value;
     }
 
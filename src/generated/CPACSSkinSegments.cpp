@@ -30,6 +30,7 @@ namespace generated
 {
     CPACSSkinSegments::CPACSSkinSegments(CPACSSkin* parent, CTiglUIDManager* uidMgr)
         : m_uidMgr(uidMgr)
+        , m_dirty(true)
     {
         //assert(parent != NULL);
         m_parent = parent;
@@ -75,6 +76,43 @@ namespace generated
 
     }
 
+    bool CPACSSkinSegments::IsDirty() const
+    {
+        if (m_dirty) {
+            return true;
+        }
+        if (m_skinSegments.size() != m_skinSegmentsClean.size()) {
+            return true;
+        }
+        for (std::size_t i = 0; i < m_skinSegments.size(); i++) {
+            if (m_skinSegments[i].get() != m_skinSegmentsClean[i] || m_skinSegments[i]->IsDirty()) {
+                return true;
+            }
+        }
+        return false;
+    }
+
+    void CPACSSkinSegments::ClearDirty()
+    {
+        m_dirty = false;
+        m_skinSegmentsClean.clear();
+        for (std::size_t i = 0; i < m_skinSegments.size(); i++) {
+            m_skinSegmentsClean.push_back(m_skinSegments[i].get());
+            m_skinSegments[i]->ClearDirty();
+        }
+    }
+
+    void CPACSSkinSegments::WriteDirtyCPACS(const TixiDocumentHandle& tixiHandle, const std::string& xpath) const
+    {
+        if (m_dirty) {
+            WriteCPACS(tixiHandle, xpath);
+            return;
+        }
+
+        // write modified elements skinSegment
+        tixi::TixiSaveDirtyElements(tixiHandle, xpath + "/skinSegment", m_skinSegments, m_skinSegmentsClean);
+    }
+
     const std::vector<unique_ptr<CCPACSSkinSegment> >& CPACSSkinSegments::GetSkinSegments() const
     {
         return m_skinSegments;
@@ -93,6 +131,7 @@ namespace generated
 
     void CPACSSkinSegments::RemoveSkinSegment(CCPACSSkinSegment& ref)
     {
+        m_dirty = true;
         for (std::size_t i = 0; i < m_skinSegments.size(); i++) {
             if (m_skinSegments[i].get() == &ref) {
                 m_skinSegments.erase(m_skinSegments.begin() + i);
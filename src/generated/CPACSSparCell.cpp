@@ -28,6 +28,7 @@ namespace generated
     CPACSSparCell::CPACSSparCell(CTiglUIDManager* uidMgr)
         : m_uidMgr(uidMgr)
         , m_rotation(0)
+        , m_dirty(true)
     {
     }
 
@@ -49,8 +50,7 @@ namespace generated
     void CPACSSparCell::ReadCPACS(const TixiDocumentHandle& tixiHandle, const std::string& xpath)
     {
         // read attribute uID
-        if (tixi::TixiCheckAttribute(tixiHandle, xpath, "uID")) {
-            m_uID = tixi::TixiGetAttribute<std::string>(tixiHandle, xpath, "uID");
+        if (tixi::TixiTryGetAttribute(tixiHandle, xpath, "uID", m_uID)) {
             if (m_uID.empty()) {
                 LOG(WARNING) << "Required attribute uID is empty at xpath " << xpath;
             }
@@ -111,10 +111,7 @@ namespace generated
         }
 
         // read element rotation
-        if (tixi::TixiCheckElement(tixiHandle, xpath + "/rotation")) {
-            m_rotation = tixi::TixiGetElement<double>(tixiHandle, xpath + "/rotation");
-        }
-        else {
+        if (!tixi::TixiTryGetElement(tixiHandle, xpath + "/rotation", m_rotation)) {
             LOG(ERROR) << "Required element rotation is missing at xpath " << xpath;
         }
 
@@ -163,6 +160,89 @@ namespace generated
 
     }
 
+    bool CPACSSparCell::IsDirty() const
+    {
+        if (m_dirty) {
+            return true;
+        }
+        if (m_fromEta.IsDirty()) {
+            return true;
+        }
+        if (m_toEta.IsDirty()) {
+            return true;
+        }
+        if (m_upperCap.IsDirty()) {
+            return true;
+        }
+        if (m_lowerCap.IsDirty()) {
+            return true;
+        }
+        if (m_web1.IsDirty()) {
+            return true;
+        }
+        if (m_web2 && m_web2->IsDirty()) {
+            return true;
+        }
+        return false;
+    }
+
+    void CPACSSparCell::ClearDirty()
+    {
+        m_dirty = false;
+        m_fromEta.ClearDirty();
+        m_toEta.ClearDirty();
+        m_upperCap.ClearDirty();
+        m_lowerCap.ClearDirty();
+        m_web1.ClearDirty();
+        if (m_web2) {
+            m_web2->ClearDirty();
+        }
+    }
+
+    void CPACSSparCell::WriteDirtyCPACS(const TixiDocumentHandle& tixiHandle, const std::string& xpath) const
+    {
+        if (m_dirty) {
+            WriteCPACS(tixiHandle, xpath);
+            return;
+        }
+
+        // write modified element fromEta
+        if (m_fromEta.IsDirty()) {
+            tixi::TixiCreateElementIfNotExists(tixiHandle, xpath + "/fromEta");
+            m_fromEta.WriteDirtyCPACS(tixiHandle, xpath + "/fromEta");
+        }
+
+        // write modified element toEta
+        if (m_toEta.IsDirty()) {
+            tixi::TixiCreateElementIfNotExists(tixiHandle, xpath + "/toEta");
+            m_toEta.WriteDirtyCPACS(tixiHandle, xpath + "/toEta");
+        }
+
+        // write modified element upperCap
+        if (m_upperCap.IsDirty()) {
+            tixi::TixiCreateElementIfNotExists(tixiHandle, xpath + "/upperCap");
+            m_upperCap.WriteDirtyCPACS(tixiHandle, xpath + "/upperCap");
+        }
+
+        // write modified element lowerCap
+        if (m_lowerCap.IsDirty()) {
+            tixi::TixiCreateElementIfNotExists(tixiHandle, xpath + "/lowerCap");
+            m_lowerCap.WriteDirtyCPACS(tixiHandle, xpath + "/lowerCap");
+        }
+
+        // write modified element web1
+        if (m_web1.IsDirty()) {
+            tixi::TixiCreateElementIfNotExists(tixiHandle, xpath + "/web1");
+            m_web1.WriteDirtyCPACS(tixiHandle, xpath + "/web1");
+        }
+
+        // write modified element web2
+        if (m_web2 && m_web2->IsDirty()) {
+            tixi::TixiCreateElementIfNotExists(tixiHandle, xpath + "/web2");
+            m_web2->WriteDirtyCPACS(tixiHandle, xpath + "/web2");
+        }
+    }
+
     const std::string& CPACSSparCell::GetUID() const
     {
         return m_uID;
@@ -170,6 +250,7 @@ namespace generated
 
     void CPACSSparCell::SetUID(const std::string& value)
     {
+        m_dirty = true;
         if (m_uidMgr) {
             m_uidMgr->TryUnregisterObject(m_uID);
             m_uidMgr->RegisterObject(value, *this);
@@ -244,6 +325,7 @@ namespace generated
 
     void CPACSSparCell::SetRotation(const double& value)
     {
+        m_dirty = true;
         m_rotation = value;
     }
 
@@ -256,6 +338,7 @@ namespace generated
 
     void CPACSSparCell::RemoveWeb2()
     {
+        m_dirty = true;
         m_web2 = boost::none;
     }
 
@@ -28,6 +28,7 @@ namespace generated
 {
     CPACSSparCells::CPACSSparCells(CTiglUIDManager* uidMgr)
         : m_uidMgr(uidMgr)
+        , m_dirty(true)
     {
     }
 
@@ -61,6 +62,43 @@ namespace generated
 
     }
 
+    bool CPACSSparCells::IsDirty() const
+    {
+        if (m_dirty) {
+            return true;
+        }
+        if (m_sparCells.size() != m_sparCellsClean.size()) {
+            return true;
+        }
+        for (std::size_t i = 0; i < m_sparCells.size(); i++) {
+            if (m_sparCells[i].get() != m_sparCellsClean[i] || m_sparCells[i]->IsDirty()) {
+                return true;
+            }
+        }
+        return false;
+    }
+
+    void CPACSSparCells::ClearDirty()
+    {
+        m_dirty = false;
+        m_sparCellsClean.clear();
+        for (std::size_t i = 0; i < m_sparCells.size(); i++) {
+            m_sparCellsClean.push_back(m_sparCells[i].get());
+            m_sparCells[i]->ClearDirty();
+        }
+    }
+
+    void CPACSSparCells::WriteDirtyCPACS(const TixiDocumentHandle& tixiHandle, const std::string& xpath) const
+    {
+        if (m_dirty) {
+            WriteCPACS(tixiHandle, xpath);
+            return;
+        }
+
+        // write modified elements sparCell
+        tixi::TixiSaveDirtyElements(tixiHandle, xpath + "/sparCell", m_sparCells, m_sparCellsClean);
+    }
+
     const std::vector<unique_ptr<CPACSSparCell> >& CPACSSparCells::GetSparCells() const
     {
         return m_sparCells;
@@ -79,6 +117,7 @@ namespace generated
 
     void CPACSSparCells::RemoveSparCell(CPACSSparCell& ref)
     {
+        m_dirty = true;
         for (std::size_t i = 0; i < m_sparCells.size(); i++) {
             if (m_sparCells[i].get() == &ref) {
                 m_sparCells.erase(m_sparCells.begin() + i);
@@ -53,6 +53,10 @@ namespace generated
         TIGL_EXPORT virtual void ReadCPACS(const TixiDocumentHandle& tixiHandle, const std::string& xpath);
         TIGL_EXPORT virtual void WriteCPACS(const TixiDocumentHandle& tixiHandle, const std::string& xpath) const;
 
+        TIGL_EXPORT virtual bool IsDirty() const;
+        TIGL_EXPORT virtual void ClearDirty();
+        TIGL_EXPORT virtual void WriteDirtyCPACS(const TixiDocumentHandle& tixiHandle, const std::string& xpath) const;
+
         TIGL_EXPORT virtual const std::vector<unique_ptr<CPACSSparCell> >& GetSparCells() const;
         TIGL_EXPORT virtual std::vector<unique_ptr<CPACSSparCell> >& GetSparCells();
 
@@ -64,6 +68,12 @@ namespace generated
 
         std::vector<unique_ptr<CPACSSparCell> > m_sparCells;
 
+        /// Set by the setters, cleared after the object has been read or written
+        bool m_dirty;
+
+        /// List elements at the last call of ClearDirty
+        std::vector<const CPACSSparCell*> m_sparCellsClean;
+
     private:
 #ifdef HAVE_CPP11
         CPACSSparCells(const CPACSSparCells&) = delete;
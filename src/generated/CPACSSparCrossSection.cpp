@@ -30,6 +30,7 @@ namespace generated
     CPACSSparCrossSection::CPACSSparCrossSection(CCPACSWingSparSegment* parent, CTiglUIDManager* uidMgr)
         : m_uidMgr(uidMgr)
         , m_rotation(0)
+        , m_dirty(true)
     {
         //assert(parent != NULL);
         m_parent = parent;
@@ -114,10 +115,7 @@ namespace generated
         }
 
         // read element rotation
-        if (tixi::TixiCheckElement(tixiHandle, xpath + "/rotation")) {
-            m_rotation = tixi::TixiGetElement<double>(tixiHandle, xpath + "/rotation");
-        }
-        else {
+        if (!tixi::TixiTryGetElement(tixiHandle, xpath + "/rotation", m_rotation)) {
             LOG(ERROR) << "Required element rotation is missing at xpath " << xpath;
         }
 
@@ -179,6 +177,85 @@ namespace generated
 
     }
 
+    bool CPACSSparCrossSection::IsDirty() const
+    {
+        if (m_dirty) {
+            return true;
+        }
+        if (m_upperCap && m_upperCap->IsDirty()) {
+            return true;
+        }
+        if (m_lowerCap && m_lowerCap->IsDirty()) {
+            return true;
+        }
+        if (m_web1.IsDirty()) {
+            return true;
+        }
+        if (m_web2 && m_web2->IsDirty()) {
+            return true;
+        }
+        if (m_sparCells && m_sparCells->IsDirty()) {
+            return true;
+        }
+        return false;
+    }
+
+    void CPACSSparCrossSection::ClearDirty()
+    {
+        m_dirty = false;
+        if (m_upperCap) {
+            m_upperCap->ClearDirty();
+        }
+        if (m_lowerCap) {
+            m_lowerCap->ClearDirty();
+        }
+        m_web1.ClearDirty();
+        if (m_web2) {
+            m_web2->ClearDirty();
+        }
+        if (m_sparCells) {
+            m_sparCells->ClearDirty();
+        }
+    }
+
+    void CPACSSparCrossSection::WriteDirtyCPACS(const TixiDocumentHandle& tixiHandle, const std::string& xpath) const
+    {
+        if (m_dirty) {
+            WriteCPACS(tixiHandle, xpath);
+            return;
+        }
+
+        // write modified element upperCap
+        if (m_upperCap && m_upperCap->IsDirty()) {
+            tixi::TixiCreateElementIfNotExists(tixiHandle, xpath + "/upperCap");
+            m_upperCap->WriteDirtyCPACS(tixiHandle, xpath + "/upperCap");
+        }
+
+        // write modified element lowerCap
+        if (m_lowerCap && m_lowerCap->IsDirty()) {
+            tixi::TixiCreateElementIfNotExists(tixiHandle, xpath + "/lowerCap");
+            m_lowerCap->WriteDirtyCPACS(tixiHandle, xpath + "/lowerCap");
+        }
+
+        // write modified element web1
+        if (m_web1.IsDirty()) {
+            tixi::TixiCreateElementIfNotExists(tixiHandle, xpath + "/web1");
+            m_web1.WriteDirtyCPACS(tixiHandle, xpath + "/web1");
+        }
+
+        // write modified element web2
+        if (m_web2 && m_web2->IsDirty()) {
+            tixi::TixiCreateElementIfNotExists(tixiHandle, xpath + "/web2");
+            m_web2->WriteDirtyCPACS(tixiHandle, xpath + "/web2");
+        }
+
+        // write modified element sparCells
+        if (m_sparCells && m_sparCells->IsDirty()) {
+            tixi::TixiCreateElementIfNotExists(tixiHandle, xpath + "/sparCells");
+            m_sparCells->WriteDirtyCPACS(tixiHandle, xpath + "/sparCells");
+        }
+    }
+
     const boost::optional<CPACSCap>& CPACSSparCrossSection::GetUpperCap() const
     {
         return m_upperCap;
@@ -236,6 +313,7 @@ namespace generated
 
     void CPACSSparCrossSection::SetRotation(const double& value)
     {
+        m_dirty = true;
         m_rotation = value;
     }
 
@@ -248,6 +326,7 @@ namespace generated
 
     void CPACSSparCrossSection::RemoveUpperCap()
     {
+        m_dirty = true;
         m_upperCap = boost::none;
     }
 
@@ -260,6 +339,7 @@ namespace generated
 
     void CPACSSparCrossSection::RemoveLowerCap()
     {
+        m_dirty = true;
         m_lowerCap = boost::none;
     }
 
@@ -272,6 +352,7 @@ namespace generated
 
     void CPACSSparCrossSection::RemoveWeb2()
     {
+        m_dirty = true;
         m_web2 = boost::none;
     }
 
@@ -284,6 +365,7 @@ namespace generated
 
     void CPACSSparCrossSection::RemoveSparCells()
     {
+        m_dirty = true;
         m_sparCells = boost::none;
     }
 
@@ -66,6 +66,10 @@ namespace generated
         TIGL_EXPORT virtual void ReadCPACS(const TixiDocumentHandle& tixiHandle, const std::string& xpath);
         TIGL_EXPORT virtual void WriteCPACS(const TixiDocumentHandle& tixiHandle, const std::string& xpath) const;
 
+        TIGL_EXPORT virtual bool IsDirty() const;
+        TIGL_EXPORT virtual void ClearDirty();
+        TIGL_EXPORT virtual void WriteDirtyCPACS(const TixiDocumentHandle& tixiHandle, const std::string& xpath) const;
+
         TIGL_EXPORT virtual const boost::optional<CPACSCap>& GetUpperCap() const;
         TIGL_EXPORT virtual boost::optional<CPACSCap>& GetUpperCap();
 
@@ -118,6 +122,9 @@ namespace generated
         /// heading of the componentSegment eta-axis.
         double                          m_rotation;
 
+        /// Set by the setters, cleared after the object has been read or written
+        bool m_dirty;
+
     private:
 #ifdef HAVE_CPP11
         CPACSSparCrossSection(const CPACSSparCrossSection&) = delete;
@@ -30,6 +30,7 @@ namespace generated
     CPACSSparPosition::CPACSSparPosition(CCPACSWingSparPositions* parent, CTiglUIDManager* uidMgr)
         : m_uidMgr(uidMgr)
         , m_xsi(0)
+        , m_dirty(true)
     {
         //assert(parent != NULL);
         m_parent = parent;
@@ -63,29 +64,22 @@ namespace generated
     void CPACSSparPosition::ReadCPACS(const TixiDocumentHandle& tixiHandle, const std::string& xpath)
     {
         // read attribute uID
-        if (tixi::TixiCheckAttribute(tixiHandle, xpath, "uID")) {
-            m_uID = tixi::TixiGetAttribute<std::string>(tixiHandle, xpath, "uID");
+        if (tixi::TixiTryGetAttribute(tixiHandle, xpath, "uID", m_uID)) {
             if (m_uID->empty()) {
                 LOG(WARNING) << "Optional attribute uID is present but empty at xpath " << xpath;
             }
         }
 
         // read element xsi
-        if (tixi::TixiCheckElement(tixiHandle, xpath + "/xsi")) {
-            m_xsi = tixi::TixiGetElement<double>(tixiHandle, xpath + "/xsi");
-        }
-        else {
+        if (!tixi::TixiTryGetElement(tixiHandle, xpath + "/xsi", m_xsi)) {
             LOG(ERROR) << "Required element xsi is missing at xpath " << xpath;
         }
 
         // read element eta
-        if (tixi::TixiCheckElement(tixiHandle, xpath + "/eta")) {
-            m_eta_choice1 = tixi::TixiGetElement<double>(tixiHandle, xpath + "/eta");
-        }
+        tixi::TixiTryGetElement(tixiHandle, xpath + "/eta", m_eta_choice1);
 
         // read element elementUID
-        if (tixi::TixiCheckElement(tixiHandle, xpath + "/elementUID")) {
-            m_elementUID_choice2 = tixi::TixiGetElement<std::string>(tixiHandle, xpath + "/elementUID");
+        if (tixi::TixiTryGetElement(tixiHandle, xpath + "/elementUID", m_elementUID_choice2)) {
             if (m_elementUID_choice2->empty()) {
                 LOG(WARNING) << "Optional element elementUID is present but empty at xpath " << xpath;
             }
@@ -137,6 +131,23 @@ namespace generated
 
     }
 
+    bool CPACSSparPosition::IsDirty() const
+    {
+        return m_dirty;
+    }
+
+    void CPACSSparPosition::ClearDirty()
+    {
+        m_dirty = false;
+    }
+
+    void CPACSSparPosition::WriteDirtyCPACS(const TixiDocumentHandle& tixiHandle, const std::string& xpath) const
+    {
+        if (m_dirty) {
+            WriteCPACS(tixiHandle, xpath);
+        }
+    }
+
     bool CPACSSparPosition::ValidateChoices() const
     {
         return
@@ -174,6 +185,7 @@ namespace generated
 
     void CPACSSparPosition::SetUID(const boost::optional<std::string>& value)
     {
+        m_dirty = true;
         if (m_uidMgr) {
             if (m_uID) m_uidMgr->TryUnregisterObject(*m_uID);
             if (value) m_uidMgr->RegisterObject(*value, *this);
@@ -188,6 +200,7 @@ namespace generated
 
     void CPACSSparPosition::SetXsi(const double& value)
     {
+        m_dirty = true;
         m_xsi = value;
     }
 
@@ -198,6 +211,7 @@ namespace generated
 
     void CPACSSparPosition::SetEta_choice1(const boost::optional<double>& value)
     {
+        m_dirty = true;
         m_eta_choice1 = value;
     }
 
@@ -208,6 +222,7 @@ namespace generated
 
     void CPACSSparPosition::SetElementUID_choice2(const boost::optional<std::string>& value)
     {
+        m_dirty = true;
         m_elementUID_choice2 = value;
     }
 
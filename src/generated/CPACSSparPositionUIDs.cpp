@@ -25,6 +25,7 @@ namespace tigl
 namespace generated
 {
     CPACSSparPositionUIDs::CPACSSparPositionUIDs()
+        : m_dirty(true)
     {
     }
 
@@ -48,6 +49,23 @@ namespace generated
 
     }
 
+    bool CPACSSparPositionUIDs::IsDirty() const
+    {
+        return m_dirty;
+    }
+
+    void CPACSSparPositionUIDs::ClearDirty()
+    {
+        m_dirty = false;
+    }
+
+    void CPACSSparPositionUIDs::WriteDirtyCPACS(const TixiDocumentHandle& tixiHandle, const std::string& xpath) const
+    {
+        if (m_dirty) {
+            WriteCPACS(tixiHandle, xpath);
+        }
+    }
+
     const std::vector<std::string>& CPACSSparPositionUIDs::GetSparPositionUIDs() const
     {
         return m_sparPositionUIDs;
@@ -56,6 +56,10 @@ namespace generated
         TIGL_EXPORT virtual void ReadCPACS(const TixiDocumentHandle& tixiHandle, const std::string& xpath);
         TIGL_EXPORT virtual void WriteCPACS(const TixiDocumentHandle& tixiHandle, const std::string& xpath) const;
 
+        TIGL_EXPORT virtual bool IsDirty() const;
+        TIGL_EXPORT virtual void ClearDirty();
+        TIGL_EXPORT virtual void WriteDirtyCPACS(const TixiDocumentHandle& tixiHandle, const std::string& xpath) const;
+
         TIGL_EXPORT virtual const std::vector<std::string>& GetSparPositionUIDs() const;
         TIGL_EXPORT virtual std::vector<std::string>& GetSparPositionUIDs();
 
@@ -63,6 +67,9 @@ namespace generated
         /// List of spar position uIDs.
         std::vector<std::string> m_sparPositionUIDs;
 
+        /// Set by the setters, cleared after the object has been read or written
+        bool m_dirty;
+
     private:
 #ifdef HAVE_CPP11
         CPACSSparPositionUIDs(const CPACSSparPositionUIDs&) = delete;
@@ -30,6 +30,7 @@ namespace generated
 {
     CPACSSparPositions::CPACSSparPositions(CCPACSWingSpars* parent, CTiglUIDManager* uidMgr)
         : m_uidMgr(uidMgr)
+        , m_dirty(true)
     {
         //assert(parent != NULL);
         m_parent = parent;
@@ -75,6 +76,43 @@ namespace generated
 
     }
 
+    bool CPACSSparPositions::IsDirty() const
+    {
+        if (m_dirty) {
+            return true;
+        }
+        if (m_sparPositions.size() != m_sparPositionsClean.size()) {
+            return true;
+        }
+        for (std::size_t i = 0; i < m_sparPositions.size(); i++) {
+            if (m_sparPositions[i].get() != m_sparPositionsClean[i] || m_sparPositions[i]->IsDirty()) {
+                return true;
+            }
+        }
+        return false;
+    }
+
+    void CPACSSparPositions::ClearDirty()
+    {
+        m_dirty = false;
+        m_sparPositionsClean.clear();
+        for (std::size_t i = 0; i < m_sparPositions.size(); i++) {
+            m_sparPositionsClean.push_back(m_sparPositions[i].get());
+            m_sparPositions[i]->ClearDirty();
+        }
+    }
+
+    void CPACSSparPositions::WriteDirtyCPACS(const TixiDocumentHandle& tixiHandle, const std::string& xpath) const
+    {
+        if (m_dirty) {
+            WriteCPACS(tixiHandle, xpath);
+            return;
+        }
+
+        // write modified elements sparPosition
+        tixi::TixiSaveDirtyElements(tixiHandle, xpath + "/sparPosition", m_sparPositions, m_sparPositionsClean);
+    }
+
     const std::vector<unique_ptr<CCPACSWingSparPosition> >& CPACSSparPositions::GetSparPositions() const
     {
         return m_sparPositions;
@@ -93,6 +131,7 @@ namespace generated
 
     void CPACSSparPositions::RemoveSparPosition(CCPACSWingSparPosition& ref)
     {
+        m_dirty = true;
         for (std::size_t i = 0; i < m_sparPositions.size(); i++) {
             if (m_sparPositions[i].get() == &ref) {
                 m_sparPositions.erase(m_sparPositions.begin() + i);
@@ -30,6 +30,7 @@ namespace generated
     CPACSSparSegment::CPACSSparSegment(CCPACSWingSparSegments* parent, CTiglUIDManager* uidMgr)
         : m_uidMgr(uidMgr)
         , m_sparCrossSection(reinterpret_cast<CCPACSWingSparSegment*>(this), m_uidMgr)
+        , m_dirty(true)
     {
         //assert(parent != NULL);
         m_parent = parent;
@@ -63,16 +64,14 @@ namespace generated
     void CPACSSparSegment::ReadCPACS(const TixiDocumentHandle& tixiHandle, const std::string& xpath)
     {
         // read attribute uID
-        if (tixi::TixiCheckAttribute(tixiHandle, xpath, "uID")) {
-            m_uID = tixi::TixiGetAttribute<std::string>(tixiHandle, xpath, "uID");
+        if (tixi::TixiTryGetAttribute(tixiHandle, xpath, "uID", m_uID)) {
             if (m_uID->empty()) {
                 LOG(WARNING) << "Optional attribute uID is present but empty at xpath " << xpath;
             }
         }
 
         // read element name
-        if (tixi::TixiCheckElement(tixiHandle, xpath + "/name")) {
-            m_name = tixi::TixiGetElement<std::string>(tixiHandle, xpath + "/name");
+        if (tixi::TixiTryGetElement(tixiHandle, xpath + "/name", m_name)) {
             if (m_name.empty()) {
                 LOG(WARNING) << "Required element name is empty at xpath " << xpath;
             }
@@ -82,8 +81,7 @@ namespace generated
         }
 
         // read element description
-        if (tixi::TixiCheckElement(tixiHandle, xpath + "/description")) {
-            m_description = tixi::TixiGetElement<std::string>(tixiHandle, xpath + "/description");
+        if (tixi::TixiTryGetElement(tixiHandle, xpath + "/description", m_description)) {
             if (m_description.empty()) {
                 LOG(WARNING) << "Required element description is empty at xpath " << xpath;
             }
@@ -141,6 +139,47 @@ namespace generated
 
     }
 
+    bool CPACSSparSegment::IsDirty() const
+    {
+        if (m_dirty) {
+            return true;
+        }
+        if (m_sparPositionUIDs.IsDirty()) {
+            return true;
+        }
+        if (m_sparCrossSection.IsDirty()) {
+            return true;
+        }
+        return false;
+    }
+
+    void CPACSSparSegment::ClearDirty()
+    {
+        m_dirty = false;
+        m_sparPositionUIDs.ClearDirty();
+        m_sparCrossSection.ClearDirty();
+    }
+
+    void CPACSSparSegment::WriteDirtyCPACS(const TixiDocumentHandle& tixiHandle, const std::string& xpath) const
+    {
+        if (m_dirty) {
+            WriteCPACS(tixiHandle, xpath);
+            return;
+        }
+
+        // write modified element sparPositionUIDs
+        if (m_sparPositionUIDs.IsDirty()) {
+            tixi::TixiCreateElementIfNotExists(tixiHandle, xpath + "/sparPositionUIDs");
+            m_sparPositionUIDs.WriteDirtyCPACS(tixiHandle, xpath + "/sparPositionUIDs");
+        }
+
+        // write modified element sparCrossSection
+        if (m_sparCrossSection.IsDirty()) {
+            tixi::TixiCreateElementIfNotExists(tixiHandle, xpath + "/sparCrossSection");
+            m_sparCrossSection.WriteDirtyCPACS(tixiHandle, xpath + "/sparCrossSection");
+        }
+    }
+
     const boost::optional<std::string>& CPACSSparSegment::GetUID() const
     {
         return m_uID;
@@ -148,6 +187,7 @@ namespace generated
 
     void CPACSSparSegment::SetUID(const boost::optional<std::string>& value)
     {
+        m_dirty = true;
         if (m_uidMgr) {
             if (m_uID) m_uidMgr->TryUnregisterObject(*m_uID);
             if (value) m_uidMgr->RegisterObject(*value, *this);
@@ -162,6 +202,7 @@ namespace generated
 
     void CPACSSparSegment::SetName(const std::string& value)
     {
+        m_dirty = true;
         m_name = value;
     }
 
@@ -172,6 +213,7 @@ namespace generated
 
     void CPACSSparSegment::SetDescription(const std::string& value)
     {
+        m_dirty = true;
         m_description = value;
     }
 
@@ -30,6 +30,7 @@ namespace generated
 {
     CPACSSparSegments::CPACSSparSegments(CCPACSWingSpars* parent, CTiglUIDManager* uidMgr)
         : m_uidMgr(uidMgr)
+        , m_dirty(true)
     {
         //assert(parent != NULL);
         m_parent = parent;
@@ -75,6 +76,43 @@ namespace generated
 
     }
 
+    bool CPACSSparSegments::IsDirty() const
+    {
+        if (m_dirty) {
+            return true;
+        }
+        if (m_sparSegments.size() != m_sparSegmentsClean.size()) {
+            return true;
+        }
+        for (std::size_t i = 0; i < m_sparSegments.size(); i++) {
+            if (m_sparSegments[i].get() != m_sparSegmentsClean[i] || m_sparSegments[i]->IsDirty()) {
+                return true;
+            }
+        }
+        return false;
+    }
+
+    void CPACSSparSegments::ClearDirty()
+    {
+        m_dirty = false;
+        m_sparSegmentsClean.clear();
+        for (std::size_t i = 0; i < m_sparSegments.size(); i++) {
+            m_sparSegmentsClean.push_back(m_sparSegments[i].get());
+            m_sparSegments[i]->ClearDirty();
+        }
+    }
+
+    void CPACSSparSegments::WriteDirtyCPACS(const TixiDocumentHandle& tixiHandle, const std::string& xpath) const
+    {
+        if (m_dirty) {
+            WriteCPACS(tixiHandle, xpath);
+            return;
+        }
+
+        // write modified elements sparSegment
+        tixi::TixiSaveDirtyElements(tixiHandle, xpath + "/sparSegment", m_sparSegments, m_sparSegmentsClean);
+    }
+
     const std::vector<unique_ptr<CCPACSWingSparSegment> >& CPACSSparSegments::GetSparSegments() const
     {
         return m_sparSegments;
@@ -93,6 +131,7 @@ namespace generated
 
     void CPACSSparSegments::RemoveSparSegment(CCPACSWingSparSegment& ref)
     {
+        m_dirty = true;
         for (std::size_t i = 0; i < m_sparSegments.size(); i++) {
             if (m_sparSegments[i].get() == &ref) {
                 m_sparSegments.erase(m_sparSegments.begin() + i);
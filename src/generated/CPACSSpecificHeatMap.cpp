@@ -25,6 +25,7 @@ namespace tigl
 namespace generated
 {
     CPACSSpecificHeatMap::CPACSSpecificHeatMap()
+        : m_dirty(true)
     {
     }
 
@@ -64,6 +65,47 @@ namespace generated
 
     }
 
+    bool CPACSSpecificHeatMap::IsDirty() const
+    {
+        if (m_dirty) {
+            return true;
+        }
+        if (m_temperature.IsDirty()) {
+            return true;
+        }
+        if (m_specificHeat.IsDirty()) {
+            return true;
+        }
+        return false;
+    }
+
+    void CPACSSpecificHeatMap::ClearDirty()
+    {
+        m_dirty = false;
+        m_temperature.ClearDirty();
+        m_specificHeat.ClearDirty();
+    }
+
+    void CPACSSpecificHeatMap::WriteDirtyCPACS(const TixiDocumentHandle& tixiHandle, const std::string& xpath) const
+    {
+        if (m_dirty) {
+            WriteCPACS(tixiHandle, xpath);
+            return;
+        }
+
+        // write modified element temperature
+        if (m_temperature.IsDirty()) {
+            tixi::TixiCreateElementIfNotExists(tixiHandle, xpath + "/temperature");
+            m_temperature.WriteDirtyCPACS(tixiHandle, xpath + "/temperature");
+        }
+
+        // write modified element specificHeat
+        if (m_specificHeat.IsDirty()) {
+            tixi::TixiCreateElementIfNotExists(tixiHandle, xpath + "/specificHeat");
+            m_specificHeat.WriteDirtyCPACS(tixiHandle, xpath + "/specificHeat");
+        }
+    }
+
     const CCPACSStringVector& CPACSSpecificHeatMap::GetTemperature() const
     {
         return m_temperature;
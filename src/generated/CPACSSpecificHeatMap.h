@@ -44,6 +44,10 @@ namespace generated
         TIGL_EXPORT virtual void ReadCPACS(const TixiDocumentHandle& tixiHandle, const std::string& xpath);
         TIGL_EXPORT virtual void WriteCPACS(const TixiDocumentHandle& tixiHandle, const std::string& xpath) const;
 
+        TIGL_EXPORT virtual bool IsDirty() const;
+        TIGL_EXPORT virtual void ClearDirty();
+        TIGL_EXPORT virtual void WriteDirtyCPACS(const TixiDocumentHandle& tixiHandle, const std::string& xpath) const;
+
         TIGL_EXPORT virtual const CCPACSStringVector& GetTemperature() const;
         TIGL_EXPORT virtual CCPACSStringVector& GetTemperature();
 
@@ -57,6 +61,9 @@ namespace generated
         /// specific heat capacity of the material in [J/(kg*K)]
         CCPACSStringVector m_specificHeat;
 
+        /// Set by the setters, cleared after the object has been read or written
+        bool m_dirty;
+
     private:
 #ifdef HAVE_CPP11
         CPACSSpecificHeatMap(const CPACSSpecificHeatMap&) = delete;
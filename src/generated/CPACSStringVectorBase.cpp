@@ -25,6 +25,7 @@ namespace tigl
 namespace generated
 {
     CPACSStringVectorBase::CPACSStringVectorBase()
+        : m_dirty(true)
     {
     }
 
@@ -35,8 +36,7 @@ namespace generated
     void CPACSStringVectorBase::ReadCPACS(const TixiDocumentHandle& tixiHandle, const std::string& xpath)
     {
         // read attribute mapType
-        if (tixi::TixiCheckAttribute(tixiHandle, xpath, "mapType")) {
-            m_mapType = tixi::TixiGetAttribute<std::string>(tixiHandle, xpath, "mapType");
+        if (tixi::TixiTryGetAttribute(tixiHandle, xpath, "mapType", m_mapType)) {
             if (m_mapType.empty()) {
                 LOG(WARNING) << "Required attribute mapType is empty at xpath " << xpath;
             }
@@ -46,56 +46,49 @@ namespace generated
         }
 
         // read attribute mu
-        if (tixi::TixiCheckAttribute(tixiHandle, xpath, "mu")) {
-            m_mu = tixi::TixiGetAttribute<std::string>(tixiHandle, xpath, "mu");
+        if (tixi::TixiTryGetAttribute(tixiHandle, xpath, "mu", m_mu)) {
             if (m_mu->empty()) {
                 LOG(WARNING) << "Optional attribute mu is present but empty at xpath " << xpath;
             }
         }
 
         // read attribute delta
-        if (tixi::TixiCheckAttribute(tixiHandle, xpath, "delta")) {
-            m_delta = tixi::TixiGetAttribute<std::string>(tixiHandle, xpath, "delta");
+        if (tixi::TixiTryGetAttribute(tixiHandle, xpath, "delta", m_delta)) {
             if (m_delta->empty()) {
                 LOG(WARNING) << "Optional attribute delta is present but empty at xpath " << xpath;
             }
         }
 
         // read attribute a
-        if (tixi::TixiCheckAttribute(tixiHandle, xpath, "a")) {
-            m_a = tixi::TixiGetAttribute<std::string>(tixiHandle, xpath, "a");
+        if (tixi::TixiTryGetAttribute(tixiHandle, xpath, "a", m_a)) {
             if (m_a->empty()) {
                 LOG(WARNING) << "Optional attribute a is present but empty at xpath " << xpath;
             }
         }
 
         // read attribute b
-        if (tixi::TixiCheckAttribute(tixiHandle, xpath, "b")) {
-            m_b = tixi::TixiGetAttribute<std::string>(tixiHandle, xpath, "b");
+        if (tixi::TixiTryGetAttribute(tixiHandle, xpath, "b", m_b)) {
             if (m_b->empty()) {
                 LOG(WARNING) << "Optional attribute b is present but empty at xpath " << xpath;
             }
         }
 
         // read attribute c
-        if (tixi::TixiCheckAttribute(tixiHandle, xpath, "c")) {
-            m_c = tixi::TixiGetAttribute<std::string>(tixiHandle, xpath, "c");
+        if (tixi::TixiTryGetAttribute(tixiHandle, xpath, "c", m_c)) {
             if (m_c->empty()) {
                 LOG(WARNING) << "Optional attribute c is present but empty at xpath " << xpath;
             }
         }
 
         // read attribute v
-        if (tixi::TixiCheckAttribute(tixiHandle, xpath, "v")) {
-            m_v = tixi::TixiGetAttribute<std::string>(tixiHandle, xpath, "v");
+        if (tixi::TixiTryGetAttribute(tixiHandle, xpath, "v", m_v)) {
             if (m_v->empty()) {
                 LOG(WARNING) << "Optional attribute v is present but empty at xpath " << xpath;
             }
         }
 
         // read attribute w
-        if (tixi::TixiCheckAttribute(tixiHandle, xpath, "w")) {
-            m_w = tixi::TixiGetAttribute<std::string>(tixiHandle, xpath, "w");
+        if (tixi::TixiTryGetAttribute(tixiHandle, xpath, "w", m_w)) {
             if (m_w->empty()) {
                 LOG(WARNING) << "Optional attribute w is present but empty at xpath " << xpath;
             }
@@ -194,6 +187,23 @@ namespace generated
 
     }
 
+    bool CPACSStringVectorBase::IsDirty() const
+    {
+        return m_dirty;
+    }
+
+    void CPACSStringVectorBase::ClearDirty()
+    {
+        m_dirty = false;
+    }
+
+    void CPACSStringVectorBase::WriteDirtyCPACS(const TixiDocumentHandle& tixiHandle, const std::string& xpath) const
+    {
+        if (m_dirty) {
+            WriteCPACS(tixiHandle, xpath);
+        }
+    }
+
     const std::string& CPACSStringVectorBase::GetMapType() const
     {
         return m_mapType;
@@ -201,6 +211,7 @@ namespace generated
 
     void CPACSStringVectorBase::SetMapType(const std::string& value)
     {
+        m_dirty = true;
         m_mapType = value;
     }
 
@@ -211,6 +222,7 @@ namespace generated
 
     void CPACSStringVectorBase::SetMu(const boost::optional<std::string>& value)
     {
+        m_dirty = true;
         m_mu = value;
     }
 
@@ -221,6 +233,7 @@ namespace generated
 
     void CPACSStringVectorBase::SetDelta(const boost::optional<std::string>& value)
     {
+        m_dirty = true;
         m_delta = value;
     }
 
@@ -231,6 +244,7 @@ namespace generated
 
     void CPACSStringVectorBase::SetA(const boost::optional<std::string>& value)
     {
+        m_dirty = true;
         m_a = value;
     }
 
@@ -241,6 +255,7 @@ namespace generated
 
     void CPACSStringVectorBase::SetB(const boost::optional<std::string>& value)
     {
+        m_dirty = true;
         m_b = value;
     }
 
@@ -251,6 +266,7 @@ namespace generated
 
     void CPACSStringVectorBase::SetC(const boost::optional<std::string>& value)
     {
+        m_dirty = true;
         m_c = value;
     }
 
@@ -261,6 +277,7 @@ namespace generated
 
     void CPACSStringVectorBase::SetV(const boost::optional<std::string>& value)
     {
+        m_dirty = true;
         m_v = value;
     }
 
@@ -271,6 +288,7 @@ namespace generated
 
     void CPACSStringVectorBase::SetW(const boost::optional<std::string>& value)
     {
+        m_dirty = true;
         m_w = value;
     }
 
@@ -281,6 +299,7 @@ namespace generated
 
     void CPACSStringVectorBase::SetSimpleContent(const std::string& value)
     {
+        m_dirty = true;
         m_simpleContent = value;
     }
 
@@ -30,6 +30,7 @@ namespace generated
 {
     CPACSStringer::CPACSStringer(CCPACSStringersAssembly* parent, CTiglUIDManager* uidMgr)
         : m_uidMgr(uidMgr)
+        , m_dirty(true)
     {
         //assert(parent != NULL);
         m_parent = parent;
@@ -63,8 +64,7 @@ namespace generated
     void CPACSStringer::ReadCPACS(const TixiDocumentHandle& tixiHandle, const std::string& xpath)
     {
         // read attribute uID
-        if (tixi::TixiCheckAttribute(tixiHandle, xpath, "uID")) {
-            m_uID = tixi::TixiGetAttribute<std::string>(tixiHandle, xpath, "uID");
+        if (tixi::TixiTryGetAttribute(tixiHandle, xpath, "uID", m_uID)) {
             if (m_uID.empty()) {
                 LOG(WARNING) << "Required attribute uID is empty at xpath " << xpath;
             }
@@ -91,6 +91,43 @@ namespace generated
 
     }
 
+    bool CPACSStringer::IsDirty() const
+    {
+        if (m_dirty) {
+            return true;
+        }
+        if (m_stringerPositions.size() != m_stringerPositionsClean.size()) {
+            return true;
+        }
+        for (std::size_t i = 0; i < m_stringerPositions.size(); i++) {
+            if (m_stringerPositions[i].get() != m_stringerPositionsClean[i] || m_stringerPositions[i]->IsDirty()) {
+                return true;
+            }
+        }
+        return false;
+    }
+
+    void CPACSStringer::ClearDirty()
+    {
+        m_dirty = false;
+        m_stringerPositionsClean.clear();
+        for (std::size_t i = 0; i < m_stringerPositions.size(); i++) {
+            m_stringerPositionsClean.push_back(m_stringerPositions[i].get());
+            m_stringerPositions[i]->ClearDirty();
+        }
+    }
+
+    void CPACSStringer::WriteDirtyCPACS(const TixiDocumentHandle& tixiHandle, const std::string& xpath) const
+    {
+        if (m_dirty) {
+            WriteCPACS(tixiHandle, xpath);
+            return;
+        }
+
+        // write modified elements stringerPosition
+        tixi::TixiSaveDirtyElements(tixiHandle, xpath + "/stringerPosition", m_stringerPositions, m_stringerPositionsClean);
+    }
+
     const std::string& CPACSStringer::GetUID() const
     {
         return m_uID;
@@ -98,6 +135,7 @@ namespace generated
 
     void CPACSStringer::SetUID(const std::string& value)
     {
+        m_dirty = true;
         if (m_uidMgr) {
             m_uidMgr->TryUnregisterObject(m_uID);
             m_uidMgr->RegisterObject(value, *this);
@@ -123,6 +161,7 @@ namespace generated
 
     void CPACSStringer::RemoveStringerPosition(CCPACSFuselageStringerFramePosition& ref)
     {
+        m_dirty = true;
         for (std::size_t i = 0; i < m_stringerPositions.size(); i++) {
             if (m_stringerPositions[i].get() == &ref) {
                 m_stringerPositions.erase(m_stringerPositions.begin() + i);
@@ -34,6 +34,7 @@ namespace generated
         , m_referenceY(0)
         , m_referenceZ(0)
         , m_referenceAngle(0)
+        , m_dirty(true)
     {
         //assert(parent != NULL);
         m_parent = parent;
@@ -46,6 +47,7 @@ namespace generated
         , m_referenceY(0)
         , m_referenceZ(0)
         , m_referenceAngle(0)
+        , m_dirty(true)
     {
         //assert(parent != NULL);
         m_parent = parent;
@@ -70,8 +72,7 @@ namespace generated
     void CPACSStringerFramePosition::ReadCPACS(const TixiDocumentHandle& tixiHandle, const std::string& xpath)
     {
         // read attribute uID
-        if (tixi::TixiCheckAttribute(tixiHandle, xpath, "uID")) {
-            m_uID = tixi::TixiGetAttribute<std::string>(tixiHandle, xpath, "uID");
+        if (tixi::TixiTryGetAttribute(tixiHandle, xpath, "uID", m_uID)) {
             if (m_uID.empty()) {
                 LOG(WARNING) << "Required attribute uID is empty at xpath " << xpath;
             }
@@ -81,8 +82,7 @@ namespace generated
         }
 
         // read element structuralElementUID
-        if (tixi::TixiCheckElement(tixiHandle, xpath + "/structuralElementUID")) {
-            m_structuralElementUID = tixi::TixiGetElement<std::string>(tixiHandle, xpath + "/structuralElementUID");
+        if (tixi::TixiTryGetElement(tixiHandle, xpath + "/structuralElementUID", m_structuralElementUID)) {
             if (m_structuralElementUID.empty()) {
                 LOG(WARNING) << "Required element structuralElementUID is empty at xpath " << xpath;
             }
@@ -92,34 +92,22 @@ namespace generated
         }
 
         // read element positionX
-        if (tixi::TixiCheckElement(tixiHandle, xpath + "/positionX")) {
-            m_positionX = tixi::TixiGetElement<double>(tixiHandle, xpath + "/positionX");
-        }
-        else {
+        if (!tixi::TixiTryGetElement(tixiHandle, xpath + "/positionX", m_positionX)) {
             LOG(ERROR) << "Required element positionX is missing at xpath " << xpath;
         }
 
         // read element referenceY
-        if (tixi::TixiCheckElement(tixiHandle, xpath + "/referenceY")) {
-            m_referenceY = tixi::TixiGetElement<double>(tixiHandle, xpath + "/referenceY");
-        }
-        else {
+        if (!tixi::TixiTryGetElement(tixiHandle, xpath + "/referenceY", m_referenceY)) {
             LOG(ERROR) << "Required element referenceY is missing at xpath " << xpath;
         }
 
         // read element referenceZ
-        if (tixi::TixiCheckElement(tixiHandle, xpath + "/referenceZ")) {
-            m_referenceZ = tixi::TixiGetElement<double>(tixiHandle, xpath + "/referenceZ");
-        }
-        else {
+        if (!tixi::TixiTryGetElement(tixiHandle, xpath + "/referenceZ", m_referenceZ)) {
             LOG(ERROR) << "Required element referenceZ is missing at xpath " << xpath;
         }
 
         // read element referenceAngle
-        if (tixi::TixiCheckElement(tixiHandle, xpath + "/referenceAngle")) {
-            m_referenceAngle = tixi::TixiGetElement<double>(tixiHandle, xpath + "/referenceAngle");
-        }
-        else {
+        if (!tixi::TixiTryGetElement(tixiHandle, xpath + "/referenceAngle", m_referenceAngle)) {
             LOG(ERROR) << "Required element referenceAngle is missing at xpath " << xpath;
         }
 
@@ -207,6 +195,39 @@ namespace generated
 
     }
 
+    bool CPACSStringerFramePosition::IsDirty() const
+    {
+        if (m_dirty) {
+            return true;
+        }
+        if (m_alignment && m_alignment->IsDirty()) {
+            return true;
+        }
+        return false;
+    }
+
+    void CPACSStringerFramePosition::ClearDirty()
+    {
+        m_dirty = false;
+        if (m_alignment) {
+            m_alignment->ClearDirty();
+        }
+    }
+
+    void CPACSStringerFramePosition::WriteDirtyCPACS(const TixiDocumentHandle& tixiHandle, const std::string& xpath) const
+    {
+        if (m_dirty) {
+            WriteCPACS(tixiHandle, xpath);
+            return;
+        }
+
+        // write modified element alignment
+        if (m_alignment && m_alignment->IsDirty()) {
+            tixi::TixiCreateElementIfNotExists(tixiHandle, xpath + "/alignment");
+            m_alignment->WriteDirtyCPACS(tixiHandle, xpath + "/alignment");
+        }
+    }
+
     const std::string& CPACSStringerFramePosition::GetUID() const
     {
         return m_uID;
@@ -214,6 +235,7 @@ namespace generated
 
     void CPACSStringerFramePosition::SetUID(const std::string& value)
     {
+        m_dirty = true;
         if (m_uidMgr) {
             m_uidMgr->TryUnregisterObject(m_uID);
             m_uidMgr->RegisterObject(value, *this);
@@ -228,6 +250,7 @@ namespace generated
 
     void CPACSStringerFramePosition::SetStructuralElementUID(const std::string& value)
     {
+        m_dirty = true;
         m_structuralElementUID = value;
     }
 
@@ -238,6 +261,7 @@ namespace generated
 
     void CPACSStringerFramePosition::SetPositionX(const double& value)
     {
+        m_dirty = true;
         m_positionX = value;
     }
 
@@ -248,6 +272,7 @@ namespace generated
 
     void CPACSStringerFramePosition::SetReferenceY(const double& value)
     {
+        m_dirty = true;
         m_referenceY = value;
     }
 
@@ -258,6 +283,7 @@ namespace generated
 
     void CPACSStringerFramePosition::SetReferenceZ(const double& value)
     {
+        m_dirty = true;
         m_referenceZ = value;
     }
 
@@ -268,6 +294,7 @@ namespace generated
 
     void CPACSStringerFramePosition::SetReferenceAngle(const double& value)
     {
+        m_dirty = true;
         m_referenceAngle = value;
     }
 
@@ -288,6 +315,7 @@ namespace generated
 
     void CPACSStringerFramePosition::SetContinuity(const boost::optional<CPACSContinuity>& value)
     {
+        m_dirty = true;
         m_continuity = value;
     }
 
@@ -298,6 +326,7 @@ namespace generated
 
     void CPACSStringerFramePosition::SetInterpolation(const boost::optional<CPACSInterpolation>& value)
     {
+        m_dirty = true;
         m_interpolation = value;
     }
 
@@ -310,6 +339,7 @@ namespace generated
 
     void CPACSStringerFramePosition::RemoveAlignment()
     {
+        m_dirty = true;
         m_alignment = boost::none;
     }
 
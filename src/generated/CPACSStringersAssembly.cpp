@@ -30,6 +30,7 @@ namespace generated
 {
     CPACSStringersAssembly::CPACSStringersAssembly(CCPACSFuselageStructure* parent, CTiglUIDManager* uidMgr)
         : m_uidMgr(uidMgr)
+        , m_dirty(true)
     {
         //assert(parent != NULL);
         m_parent = parent;
@@ -75,6 +76,43 @@ namespace generated
 
     }
 
+    bool CPACSStringersAssembly::IsDirty() const
+    {
+        if (m_dirty) {
+            return true;
+        }
+        if (m_stringers.size() != m_stringersClean.size()) {
+            return true;
+        }
+        for (std::size_t i = 0; i < m_stringers.size(); i++) {
+            if (m_stringers[i].get() != m_stringersClean[i] || m_stringers[i]->IsDirty()) {
+                return true;
+            }
+        }
+        return false;
+    }
+
+    void CPACSStringersAssembly::ClearDirty()
+    {
+        m_dirty = false;
+        m_stringersClean.clear();
+        for (std::size_t i = 0; i < m_stringers.size(); i++) {
+            m_stringersClean.push_back(m_stringers[i].get());
+            m_stringers[i]->ClearDirty();
+        }
+    }
+
+    void CPACSStringersAssembly::WriteDirtyCPACS(const TixiDocumentHandle& tixiHandle, const std::string& xpath) const
+    {
+        if (m_dirty) {
+            WriteCPACS(tixiHandle, xpath);
+            return;
+        }
+
+        // write modified elements stringer
+        tixi::TixiSaveDirtyElements(tixiHandle, xpath + "/stringer", m_stringers, m_stringersClean);
+    }
+
     const std::vector<unique_ptr<CCPACSFuselageStringer> >& CPACSStringersAssembly::GetStringers() const
     {
         return m_stringers;
@@ -93,6 +131,7 @@ namespace generated
 
     void CPACSStringersAssembly::RemoveStringer(CCPACSFuselageStringer& ref)
     {
+        m_dirty = true;
         for (std::size_t i = 0; i < m_stringers.size(); i++) {
             if (m_stringers[i].get() == &ref) {
                 m_stringers.erase(m_stringers.begin() + i);
@@ -27,6 +27,7 @@ namespace generated
 {
     CPACSStructuralElements::CPACSStructuralElements(CTiglUIDManager* uidMgr)
         : m_uidMgr(uidMgr)
+        , m_dirty(true)
     {
     }
 
@@ -228,6 +229,123 @@ namespace generated
 
     }
 
+    bool CPACSStructuralElements::IsDirty() const
+    {
+        if (m_dirty) {
+            return true;
+        }
+        if (m_sheetBasedStructuralElements && m_sheetBasedStructuralElements->IsDirty()) {
+            return true;
+        }
+        if (m_profileBasedStructuralElements && m_profileBasedStructuralElements->IsDirty()) {
+            return true;
+        }
+        if (m_pressureBulkheads && m_pressureBulkheads->IsDirty()) {
+            return true;
+        }
+        if (m_windows && m_windows->IsDirty()) {
+            return true;
+        }
+        if (m_doors && m_doors->IsDirty()) {
+            return true;
+        }
+        if (m_doorSurroundStructures && m_doorSurroundStructures->IsDirty()) {
+            return true;
+        }
+        if (m_seatModules && m_seatModules->IsDirty()) {
+            return true;
+        }
+        if (m_rivets && m_rivets->IsDirty()) {
+            return true;
+        }
+        return false;
+    }
+
+    void CPACSStructuralElements::ClearDirty()
+    {
+        m_dirty = false;
+        if (m_sheetBasedStructuralElements) {
+            m_sheetBasedStructuralElements->ClearDirty();
+        }
+        if (m_profileBasedStructuralElements) {
+            m_profileBasedStructuralElements->ClearDirty();
+        }
+        if (m_pressureBulkheads) {
+            m_pressureBulkheads->ClearDirty();
+        }
+        if (m_windows) {
+            m_windows->ClearDirty();
+        }
+        if (m_doors) {
+            m_doors->ClearDirty();
+        }
+        if (m_doorSurroundStructures) {
+            m_doorSurroundStructures->ClearDirty();
+        }
+        if (m_seatModules) {
+            m_seatModules->ClearDirty();
+        }
+        if (m_rivets) {
+            m_rivets->ClearDirty();
+        }
+    }
+
+    void CPACSStructuralElements::WriteDirtyCPACS(const TixiDocumentHandle& tixiHandle, const std::string& xpath) const
+    {
+        if (m_dirty) {
+            WriteCPACS(tixiHandle, xpath);
+            return;
+        }
+
+        // write modified element sheetBasedStructuralElements
+        if (m_sheetBasedStructuralElements && m_sheetBasedStructuralElements->IsDirty()) {
+            tixi::TixiCreateElementIfNotExists(tixiHandle, xpath + "/sheetBasedStructuralElements");
+            m_sheetBasedStructuralElements->WriteDirtyCPACS(tixiHandle, xpath + "/sheetBasedStructuralElements");
+        }
+
+        // write modified element profileBasedStructuralElements
+        if (m_profileBasedStructuralElements && m_profileBasedStructuralElements->IsDirty()) {
+            tixi::TixiCreateElementIfNotExists(tixiHandle, xpath + "/profileBasedStructuralElements");
+            m_profileBasedStructuralElements->WriteDirtyCPACS(tixiHandle, xpath + "/profileBasedStructuralElements");
+        }
+
+        // write modified element pressureBulkheads
+        if (m_pressureBulkheads && m_pressureBulkheads->IsDirty()) {
+            tixi::TixiCreateElementIfNotExists(tixiHandle, xpath + "/pressureBulkheads");
+            m_pressureBulkheads->WriteDirtyCPACS(tixiHandle, xpath + "/pressureBulkheads");
+        }
+
+        // write modified element windows
+        if (m_windows && m_windows->IsDirty()) {
+            tixi::TixiCreateElementIfNotExists(tixiHandle, xpath + "/windows");
+            m_windows->WriteDirtyCPACS(tixiHandle, xpath + "/windows");
+        }
+
+        // write modified element doors
+        if (m_doors && m_doors->IsDirty()) {
+            tixi::TixiCreateElementIfNotExists(tixiHandle, xpath + "/doors");
+            m_doors->WriteDirtyCPACS(tixiHandle, xpath + "/doors");
+        }
+
+        // write modified element doorSurroundStructures
+        if (m_doorSurroundStructures && m_doorSurroundStructures->IsDirty()) {
+            tixi::TixiCreateElementIfNotExists(tixiHandle, xpath + "/doorSurroundStructures");
+            m_doorSurroundStructures->WriteDirtyCPACS(tixiHandle, xpath + "/doorSurroundStructures");
+        }
+
+        // write modified element seatModules
+        if (m_seatModules && m_seatModules->IsDirty()) {
+            tixi::TixiCreateElementIfNotExists(tixiHandle, xpath + "/seatModules");
+            m_seatModules->WriteDirtyCPACS(tixiHandle, xpath + "/seatModules");
+        }
+
+        // write modified element rivets
+        if (m_rivets && m_rivets->IsDirty()) {
+            tixi::TixiCreateElementIfNotExists(tixiHandle, xpath + "/rivets");
+            m_rivets->WriteDirtyCPACS(tixiHandle, xpath + "/rivets");
+        }
+    }
+
     const boost::optional<CPACSSheetBasedStructuralElements>& CPACSStructuralElements::GetSheetBasedStructuralElements() const
     {
         return m_sheetBasedStructuralElements;
@@ -317,6 +435,7 @@ namespace generated
 
     void CPACSStructuralElements::RemoveSheetBasedStructuralElements()
     {
+        m_dirty = true;
         m_sheetBasedStructuralElements = boost::none;
     }
 
@@ -329,6 +448,7 @@ namespace generated
 
     void CPACSStructuralElements::RemoveProfileBasedStructuralElements()
     {
+        m_dirty = true;
         m_profileBasedStructuralElements = boost::none;
     }
 
@@ -341,6 +461,7 @@ namespace generated
 
     void CPACSStructuralElements::RemovePressureBulkheads()
     {
+        m_dirty = true;
         m_pressureBulkheads = boost::none;
     }
 
@@ -353,6 +474,7 @@ namespace generated
 
     void CPACSStructuralElements::RemoveWindows()
     {
+        m_dirty = true;
         m_windows = boost::none;
     }
 
@@ -365,6 +487,7 @@ namespace generated
 
     void CPACSStructuralElements::RemoveDoors()
     {
+        m_dirty = true;
         m_doors = boost::none;
     }
 
@@ -377,6 +500,7 @@ namespace generated
 
     void CPACSStructuralElements::RemoveDoorSurroundStructures()
     {
+        m_dirty = true;
         m_doorSurroundStructures = boost::none;
     }
 
@@ -389,6 +513,7 @@ namespace generated
 
     void CPACSStructuralElements::RemoveSeatModules()
     {
+        m_dirty = true;
         m_seatModules = boost::none;
     }
 
@@ -401,6 +526,7 @@ namespace generated
 
     void CPACSStructuralElements::RemoveRivets()
     {
+        m_dirty = true;
         m_rivets = boost::none;
     }
 
@@ -59,6 +59,10 @@ namespace generated
         TIGL_EXPORT virtual void ReadCPACS(const TixiDocumentHandle& tixiHandle, const std::string& xpath);
         TIGL_EXPORT virtual void WriteCPACS(const TixiDocumentHandle& tixiHandle, const std::string& xpath) const;
 
+        TIGL_EXPORT virtual bool IsDirty() const;
+        TIGL_EXPORT virtual void ClearDirty();
+        TIGL_EXPORT virtual void WriteDirtyCPACS(const TixiDocumentHandle& tixiHandle, const std::string& xpath) const;
+
         TIGL_EXPORT virtual const boost::optional<CPACSSheetBasedStructuralElements>& GetSheetBasedStructuralElements() const;
         TIGL_EXPORT virtual boost::optional<CPACSSheetBasedStructuralElements>& GetSheetBasedStructuralElements();
 
@@ -119,6 +123,9 @@ namespace generated
         boost::optional<CPACSSeatModules>                    m_seatModules;
         boost::optional<CPACSRivets>                         m_rivets;
 
+        /// Set by the setters, cleared after the object has been read or written
+        bool m_dirty;
+
     private:
 #ifdef HAVE_CPP11
         CPACSStructuralElements(const CPACSStructuralElements&) = delete;
@@ -31,6 +31,7 @@ namespace generated
         : m_uidMgr(uidMgr)
         , m_pointList(m_uidMgr)
         , m_sheetList(this, m_uidMgr)
+        , m_dirty(true)
     {
         //assert(parent != NULL);
         m_parent = parent;
@@ -64,8 +65,7 @@ namespace generated
     void CPACSStructuralProfile::ReadCPACS(const TixiDocumentHandle& tixiHandle, const std::string& xpath)
     {
         // read attribute uID
-        if (tixi::TixiCheckAttribute(tixiHandle, xpath, "uID")) {
-            m_uID = tixi::TixiGetAttribute<std::string>(tixiHandle, xpath, "uID");
+        if (tixi::TixiTryGetAttribute(tixiHandle, xpath, "uID", m_uID)) {
             if (m_uID.empty()) {
                 LOG(WARNING) << "Required attribute uID is empty at xpath " << xpath;
             }
@@ -75,8 +75,7 @@ namespace generated
         }
 
         // read element name
-        if (tixi::TixiCheckElement(tixiHandle, xpath + "/name")) {
-            m_name = tixi::TixiGetElement<std::string>(tixiHandle, xpath + "/name");
+        if (tixi::TixiTryGetElement(tixiHandle, xpath + "/name", m_name)) {
             if (m_name.empty()) {
                 LOG(WARNING) << "Required element name is empty at xpath " << xpath;
             }
@@ -86,8 +85,7 @@ namespace generated
         }
 
         // read element description
-        if (tixi::TixiCheckElement(tixiHandle, xpath + "/description")) {
-            m_description = tixi::TixiGetElement<std::string>(tixiHandle, xpath + "/description");
+        if (tixi::TixiTryGetElement(tixiHandle, xpath + "/description", m_description)) {
             if (m_description->empty()) {
                 LOG(WARNING) << "Optional element description is present but empty at xpath " << xpath;
             }
@@ -142,6 +140,47 @@ namespace generated
 
     }
 
+    bool CPACSStructuralProfile::IsDirty() const
+    {
+        if (m_dirty) {
+            return true;
+        }
+        if (m_pointList.IsDirty()) {
+            return true;
+        }
+        if (m_sheetList.IsDirty()) {
+            return true;
+        }
+        return false;
+    }
+
+    void CPACSStructuralProfile::ClearDirty()
+    {
+        m_dirty = false;
+        m_pointList.ClearDirty();
+        m_sheetList.ClearDirty();
+    }
+
+    void CPACSStructuralProfile::WriteDirtyCPACS(const TixiDocumentHandle& tixiHandle, const std::string& xpath) const
+    {
+        if (m_dirty) {
+            WriteCPACS(tixiHandle, xpath);
+            return;
+        }
+
+        // write modified element pointList
+        if (m_pointList.IsDirty()) {
+            tixi::TixiCreateElementIfNotExists(tixiHandle, xpath + "/pointList");
+            m_pointList.WriteDirtyCPACS(tixiHandle, xpath + "/pointList");
+        }
+
+        // write modified element sheetList
+        if (m_sheetList.IsDirty()) {
+            tixi::TixiCreateElementIfNotExists(tixiHandle, xpath + "/sheetList");
+            m_sheetList.WriteDirtyCPACS(tixiHandle, xpath + "/sheetList");
+        }
+    }
+
     const std::string& CPACSStructuralProfile::GetUID() const
     {
         return m_uID;
@@ -149,6 +188,7 @@ namespace generated
 
     void CPACSStructuralProfile::SetUID(const std::string& value)
     {
+        m_dirty = true;
         if (m_uidMgr) {
             m_uidMgr->TryUnregisterObject(m_uID);
             m_uidMgr->RegisterObject(value, *this);
@@ -163,6 +203,7 @@ namespace generated
 
     void CPACSStructuralProfile::SetName(const std::string& value)
     {
+        m_dirty = true;
         m_name = value;
     }
 
@@ -173,6 +214,7 @@ namespace generated
 
     void CPACSStructuralProfile::SetDescription(const boost::optional<std::string>& value)
     {
+        m_dirty = true;
         m_description = value;
     }
 
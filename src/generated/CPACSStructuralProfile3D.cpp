@@ -29,6 +29,7 @@ namespace generated
         : m_uidMgr(uidMgr)
         , m_pointList(m_uidMgr)
         , m_sheetList3D(m_uidMgr)
+        , m_dirty(true)
     {
     }
 
@@ -50,8 +51,7 @@ namespace generated
     void CPACSStructuralProfile3D::ReadCPACS(const TixiDocumentHandle& tixiHandle, const std::string& xpath)
     {
         // read attribute uID
-        if (tixi::TixiCheckAttribute(tixiHandle, xpath, "uID")) {
-            m_uID = tixi::TixiGetAttribute<std::string>(tixiHandle, xpath, "uID");
+        if (tixi::TixiTryGetAttribute(tixiHandle, xpath, "uID", m_uID)) {
             if (m_uID.empty()) {
                 LOG(WARNING) << "Required attribute uID is empty at xpath " << xpath;
             }
@@ -61,8 +61,7 @@ namespace generated
         }
 
         // read element name
-        if (tixi::TixiCheckElement(tixiHandle, xpath + "/name")) {
-            m_name = tixi::TixiGetElement<std::string>(tixiHandle, xpath + "/name");
+        if (tixi::TixiTryGetElement(tixiHandle, xpath + "/name", m_name)) {
             if (m_name.empty()) {
                 LOG(WARNING) << "Required element name is empty at xpath " << xpath;
             }
@@ -72,8 +71,7 @@ namespace generated
         }
 
         // read element description
-        if (tixi::TixiCheckElement(tixiHandle, xpath + "/description")) {
-            m_description = tixi::TixiGetElement<std::string>(tixiHandle, xpath + "/description");
+        if (tixi::TixiTryGetElement(tixiHandle, xpath + "/description", m_description)) {
             if (m_description->empty()) {
                 LOG(WARNING) << "Optional element description is present but empty at xpath " << xpath;
             }
@@ -128,6 +126,47 @@ namespace generated
 
     }
 
+    bool CPACSStructuralProfile3D::IsDirty() const
+    {
+        if (m_dirty) {
+            return true;
+        }
+        if (m_pointList.IsDirty()) {
+            return true;
+        }
+        if (m_sheetList3D.IsDirty()) {
+            return true;
+        }
+        return false;
+    }
+
+    void CPACSStructuralProfile3D::ClearDirty()
+    {
+        m_dirty = false;
+        m_pointList.ClearDirty();
+        m_sheetList3D.ClearDirty();
+    }
+
+    void CPACSStructuralProfile3D::WriteDirtyCPACS(const TixiDocumentHandle& tixiHandle, const std::string& xpath) const
+    {
+        if (m_dirty) {
+            WriteCPACS(tixiHandle, xpath);
+            return;
+        }
+
+        // write modified element pointList
+        if (m_pointList.IsDirty()) {
+            tixi::TixiCreateElementIfNotExists(tixiHandle, xpath + "/pointList");
+            m_pointList.WriteDirtyCPACS(tixiHandle, xpath + "/pointList");
+        }
+
+        // write modified element sheetList3D
+        if (m_sheetList3D.IsDirty()) {
+            tixi::TixiCreateElementIfNotExists(tixiHandle, xpath + "/sheetList3D");
+            m_sheetList3D.WriteDirtyCPACS(tixiHandle, xpath + "/sheetList3D");
+        }
+    }
+
     const std::string& CPACSStructuralProfile3D::GetUID() const
     {
         return m_uID;
@@ -135,6 +174,7 @@ namespace generated
 
     void CPACSStructuralProfile3D::SetUID(const std::string& value)
     {
+        m_dirty = true;
         if (m_uidMgr) {
             m_uidMgr->TryUnregisterObject(m_uID);
             m_uidMgr->RegisterObject(value, *this);
@@ -149,6 +189,7 @@ namespace generated
 
     void CPACSStructuralProfile3D::SetName(const std::string& value)
     {
+        m_dirty = true;
         m_name = value;
     }
 
@@ -159,6 +200,7 @@ namespace generated
 
     void CPACSStructuralProfile3D::SetDescription(const boost::optional<std::string>& value)
     {
+        m_dirty = true;
         m_description = value;
     }
 
@@ -29,6 +29,7 @@ namespace generated
 {
     CPACSStructuralProfiles::CPACSStructuralProfiles(CTiglUIDManager* uidMgr)
         : m_uidMgr(uidMgr)
+        , m_dirty(true)
     {
     }
 
@@ -70,6 +71,59 @@ namespace generated
 
     }
 
+    bool CPACSStructuralProfiles::IsDirty() const
+    {
+        if (m_dirty) {
+            return true;
+        }
+        if (m_structuralProfile2Ds.size() != m_structuralProfile2DsClean.size()) {
+            return true;
+        }
+        for (std::size_t i = 0; i < m_structuralProfile2Ds.size(); i++) {
+            if (m_structuralProfile2Ds[i].get() != m_structuralProfile2DsClean[i] || m_structuralProfile2Ds[i]->IsDirty()) {
+                return true;
+            }
+        }
+        if (m_structuralProfile3Ds.size() != m_structuralProfile3DsClean.size()) {
+            return true;
+        }
+        for (std::size_t i = 0; i < m_structuralProfile3Ds.size(); i++) {
+            if (m_structuralProfile3Ds[i].get() != m_structuralProfile3DsClean[i] || m_structuralProfile3Ds[i]->IsDirty()) {
+                return true;
+            }
+        }
+        return false;
+    }
+
+    void CPACSStructuralProfiles::ClearDirty()
+    {
+        m_dirty = false;
+        m_structuralProfile2DsClean.clear();
+        for (std::size_t i = 0; i < m_structuralProfile2Ds.size(); i++) {
+            m_structuralProfile2DsClean.push_back(m_structuralProfile2Ds[i].get());
+            m_structuralProfile2Ds[i]->ClearDirty();
+        }
+        m_structuralProfile3DsClean.clear();
+        for (std::size_t i = 0; i < m_structuralProfile3Ds.size(); i++) {
+            m_structuralProfile3DsClean.push_back(m_structuralProfile3Ds[i].get());
+            m_structuralProfile3Ds[i]->ClearDirty();
+        }
+    }
+
+    void CPACSStructuralProfiles::WriteDirtyCPACS(const TixiDocumentHandle& tixiHandle, const std::string& xpath) const
+    {
+        if (m_dirty) {
+            WriteCPACS(tixiHandle, xpath);
+            return;
+        }
+
+        // write modified elements structuralProfile2D
+        tixi::TixiSaveDirtyElements(tixiHandle, xpath + "/structuralProfile2D", m_structuralProfile2Ds, m_structuralProfile2DsClean);
+
+        // write modified elements structuralProfile3D
+        tixi::TixiSaveDirtyElements(tixiHandle, xpath + "/structuralProfile3D", m_structuralProfile3Ds, m_structuralProfile3DsClean);
+    }
+
     const std::vector<unique_ptr<CPACSStructuralProfile> >& CPACSStructuralProfiles::GetStructuralProfile2Ds() const
     {
         return m_structuralProfile2Ds;
@@ -98,6 +152,7 @@ namespace generated
 
     void CPACSStructuralProfiles::RemoveStructuralProfile2D(CPACSStructuralProfile& ref)
     {
+        m_dirty = true;
         for (std::size_t i = 0; i < m_structuralProfile2Ds.size(); i++) {
             if (m_structuralProfile2Ds[i].get() == &ref) {
                 m_structuralProfile2Ds.erase(m_structuralProfile2Ds.begin() + i);
@@ -115,6 +170,7 @@ namespace generated
 
     void CPACSStructuralProfiles::RemoveStructuralProfile3D(CPACSStructuralProfile3D& ref)
     {
+        m_dirty = true;
         for (std::size_t i = 0; i < m_structuralProfile3Ds.size(); i++) {
             if (m_structuralProfile3Ds[i].get() == &ref) {
                 m_structuralProfile3Ds.erase(m_structuralProfile3Ds.begin() + i);
@@ -53,6 +53,10 @@ namespace generated
         TIGL_EXPORT virtual void ReadCPACS(const TixiDocumentHandle& tixiHandle, const std::string& xpath);
         TIGL_EXPORT virtual void WriteCPACS(const TixiDocumentHandle& tixiHandle, const std::string& xpath) const;
 
+        TIGL_EXPORT virtual bool IsDirty() const;
+        TIGL_EXPORT virtual void ClearDirty();
+        TIGL_EXPORT virtual void WriteDirtyCPACS(const TixiDocumentHandle& tixiHandle, const std::string& xpath) const;
+
         TIGL_EXPORT virtual const std::vector<unique_ptr<CPACSStructuralProfile> >& GetStructuralProfile2Ds() const;
         TIGL_EXPORT virtual std::vector<unique_ptr<CPACSStructuralProfile> >& GetStructuralProfile2Ds();
 
@@ -71,6 +75,13 @@ namespace generated
         std::vector<unique_ptr<CPACSStructuralProfile> >   m_structuralProfile2Ds;
         std::vector<unique_ptr<CPACSStructuralProfile3D> > m_structuralProfile3Ds;
 
+        /// Set by the setters, cleared after the object has been read or written
+        bool m_dirty;
+
+        /// List elements at the last call of ClearDirty
+        std::vector<const CPACSStructuralProfile*> m_structuralProfile2DsClean;
+        std::vector<const CPACSStructuralProfile3D*> m_structuralProfile3DsClean;
+
     private:
 #ifdef HAVE_CPP11
         CPACSStructuralProfiles(const CPACSStructuralProfiles&) = delete;
@@ -25,6 +25,7 @@ namespace tigl
 namespace generated
 {
     CPACSTool::CPACSTool()
+        : m_dirty(true)
     {
     }
 
@@ -35,8 +36,7 @@ namespace generated
     void CPACSTool::ReadCPACS(const TixiDocumentHandle& tixiHandle, const std::string& xpath)
     {
         // read element name
-        if (tixi::TixiCheckElement(tixiHandle, xpath + "/name")) {
-            m_name = tixi::TixiGetElement<std::string>(tixiHandle, xpath + "/name");
+        if (tixi::TixiTryGetElement(tixiHandle, xpath + "/name", m_name)) {
             if (m_name.empty()) {
                 LOG(WARNING) << "Required element name is empty at xpath " << xpath;
             }
@@ -46,8 +46,7 @@ namespace generated
         }
 
         // read element version
-        if (tixi::TixiCheckElement(tixiHandle, xpath + "/version")) {
-            m_version = tixi::TixiGetElement<std::string>(tixiHandle, xpath + "/version");
+        if (tixi::TixiTryGetElement(tixiHandle, xpath + "/version", m_version)) {
             if (m_version.empty()) {
                 LOG(WARNING) << "Required element version is empty at xpath " << xpath;
             }
@@ -70,6 +69,23 @@ namespace generated
 
     }
 
+    bool CPACSTool::IsDirty() const
+    {
+        return m_dirty;
+    }
+
+    void CPACSTool::ClearDirty()
+    {
+        m_dirty = false;
+    }
+
+    void CPACSTool::WriteDirtyCPACS(const TixiDocumentHandle& tixiHandle, const std::string& xpath) const
+    {
+        if (m_dirty) {
+            WriteCPACS(tixiHandle, xpath);
+        }
+    }
+
     const std::string& CPACSTool::GetName() const
     {
         return m_name;
@@ -77,6 +93,7 @@ namespace generated
 
     void CPACSTool::SetName(const std::string& value)
     {
+        m_dirty = true;
         m_name = value;
     }
 
@@ -87,6 +104,7 @@ namespace generated
 
     void CPACSTool::SetVersion(const std::string& value)
     {
+        m_dirty = true;
         m_version = value;
     }
 
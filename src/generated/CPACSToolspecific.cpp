@@ -25,6 +25,7 @@ namespace tigl
 namespace generated
 {
     CPACSToolspecific::CPACSToolspecific()
+        : m_dirty(true)
     {
     }
 
@@ -62,6 +63,39 @@ namespace generated
 
     }
 
+    bool CPACSToolspecific::IsDirty() const
+    {
+        if (m_dirty) {
+            return true;
+        }
+        if (m_cFD && m_cFD->IsDirty()) {
+            return true;
+        }
+        return false;
+    }
+
+    void CPACSToolspecific::ClearDirty()
+    {
+        m_dirty = false;
+        if (m_cFD) {
+            m_cFD->ClearDirty();
+        }
+    }
+
+    void CPACSToolspecific::WriteDirtyCPACS(const TixiDocumentHandle& tixiHandle, const std::string& xpath) const
+    {
+        if (m_dirty) {
+            WriteCPACS(tixiHandle, xpath);
+            return;
+        }
+
+        // write modified element cFD
+        if (m_cFD && m_cFD->IsDirty()) {
+            tixi::TixiCreateElementIfNotExists(tixiHandle, xpath + "/cFD");
+            m_cFD->WriteDirtyCPACS(tixiHandle, xpath + "/cFD");
+        }
+    }
+
     const boost::optional<CPACSCFDTool>& CPACSToolspecific::GetCFD() const
     {
         return m_cFD;
@@ -81,6 +115,7 @@ namespace generated
 
     void CPACSToolspecific::RemoveCFD()
     {
+        m_dirty = true;
         m_cFD = boost::none;
     }
 
@@ -27,6 +27,7 @@ namespace generated
 {
     CPACSTrackActuator::CPACSTrackActuator(CTiglUIDManager* uidMgr)
         : m_uidMgr(uidMgr)
+        , m_dirty(true)
     {
     }
 
@@ -48,8 +49,7 @@ namespace generated
     void CPACSTrackActuator::ReadCPACS(const TixiDocumentHandle& tixiHandle, const std::string& xpath)
     {
         // read attribute uID
-        if (tixi::TixiCheckAttribute(tixiHandle, xpath, "uID")) {
-            m_uID = tixi::TixiGetAttribute<std::string>(tixiHandle, xpath, "uID");
+        if (tixi::TixiTryGetAttribute(tixiHandle, xpath, "uID", m_uID)) {
             if (m_uID.empty()) {
                 LOG(WARNING) << "Required attribute uID is empty at xpath " << xpath;
             }
@@ -59,8 +59,7 @@ namespace generated
         }
 
         // read element actuatorUID
-        if (tixi::TixiCheckElement(tixiHandle, xpath + "/actuatorUID")) {
-            m_actuatorUID = tixi::TixiGetElement<std::string>(tixiHandle, xpath + "/actuatorUID");
+        if (tixi::TixiTryGetElement(tixiHandle, xpath + "/actuatorUID", m_actuatorUID)) {
             if (m_actuatorUID.empty()) {
                 LOG(WARNING) << "Required element actuatorUID is empty at xpath " << xpath;
             }
@@ -95,6 +94,37 @@ namespace generated
 
     }
 
+    bool CPACSTrackActuator::IsDirty() const
+    {
+        if (m_dirty) {
+            return true;
+        }
+        if (m_material.IsDirty()) {
+            return true;
+        }
+        return false;
+    }
+
+    void CPACSTrackActuator::ClearDirty()
+    {
+        m_dirty = false;
+        m_material.ClearDirty();
+    }
+
+    void CPACSTrackActuator::WriteDirtyCPACS(const TixiDocumentHandle& tixiHandle, const std::string& xpath) const
+    {
+        if (m_dirty) {
+            WriteCPACS(tixiHandle, xpath);
+            return;
+        }
+
+        // write modified element material
+        if (m_material.IsDirty()) {
+            tixi::TixiCreateElementIfNotExists(tixiHandle, xpath + "/material");
+            m_material.WriteDirtyCPACS(tixiHandle, xpath + "/material");
+        }
+    }
+
     const std::string& CPACSTrackActuator::GetUID() const
     {
         return m_uID;
@@ -102,6 +132,7 @@ namespace generated
 
     void CPACSTrackActuator::SetUID(const std::string& value)
     {
+        m_dirty = true;
         if (m_uidMgr) {
             m_uidMgr->TryUnregisterObject(m_uID);
             m_uidMgr->RegisterObject(value, *this);
@@ -116,6 +147,7 @@ namespace generated
 
     void CPACSTrackActuator::SetActuatorUID(const std::string& value)
     {
+        m_dirty = true;
         m_actuatorUID = value;
     }
 
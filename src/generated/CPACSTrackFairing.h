@@ -43,6 +43,10 @@ namespace generated
         TIGL_EXPORT virtual void ReadCPACS(const TixiDocumentHandle& tixiHandle, const std::string& xpath);
         TIGL_EXPORT virtual void WriteCPACS(const TixiDocumentHandle& tixiHandle, const std::string& xpath) const;
 
+        TIGL_EXPORT virtual bool IsDirty() const;
+        TIGL_EXPORT virtual void ClearDirty();
+        TIGL_EXPORT virtual void WriteDirtyCPACS(const TixiDocumentHandle& tixiHandle, const std::string& xpath) const;
+
         TIGL_EXPORT virtual const CCPACSMaterialDefinition& GetMaterial() const;
         TIGL_EXPORT virtual CCPACSMaterialDefinition& GetMaterial();
 
@@ -50,6 +54,9 @@ namespace generated
         /// Definition of the material properties.
         CCPACSMaterialDefinition m_material;
 
+        /// Set by the setters, cleared after the object has been read or written
+        bool m_dirty;
+
     private:
 #ifdef HAVE_CPP11
         CPACSTrackFairing(const CPACSTrackFairing&) = delete;
@@ -25,6 +25,7 @@ namespace tigl
 namespace generated
 {
     CPACSTrackStructure::CPACSTrackStructure()
+        : m_dirty(true)
     {
     }
 
@@ -282,6 +283,159 @@ namespace generated
 
     }
 
+    bool CPACSTrackStructure::IsDirty() const
+    {
+        if (m_dirty) {
+            return true;
+        }
+        if (m_controlSurfaceAttachment && m_controlSurfaceAttachment->IsDirty()) {
+            return true;
+        }
+        if (m_car && m_car->IsDirty()) {
+            return true;
+        }
+        if (m_strut1 && m_strut1->IsDirty()) {
+            return true;
+        }
+        if (m_strut2 && m_strut2->IsDirty()) {
+            return true;
+        }
+        if (m_strut3 && m_strut3->IsDirty()) {
+            return true;
+        }
+        if (m_sidePanels && m_sidePanels->IsDirty()) {
+            return true;
+        }
+        if (m_upperPanel && m_upperPanel->IsDirty()) {
+            return true;
+        }
+        if (m_lowerPanel && m_lowerPanel->IsDirty()) {
+            return true;
+        }
+        if (m_rollerTrack && m_rollerTrack->IsDirty()) {
+            return true;
+        }
+        if (m_ribs && m_ribs->IsDirty()) {
+            return true;
+        }
+        if (m_fairing && m_fairing->IsDirty()) {
+            return true;
+        }
+        return false;
+    }
+
+    void CPACSTrackStructure::ClearDirty()
+    {
+        m_dirty = false;
+        if (m_controlSurfaceAttachment) {
+            m_controlSurfaceAttachment->ClearDirty();
+        }
+        if (m_car) {
+            m_car->ClearDirty();
+        }
+        if (m_strut1) {
+            m_strut1->ClearDirty();
+        }
+        if (m_strut2) {
+            m_strut2->ClearDirty();
+        }
+        if (m_strut3) {
+            m_strut3->ClearDirty();
+        }
+        if (m_sidePanels) {
+            m_sidePanels->ClearDirty();
+        }
+        if (m_upperPanel) {
+            m_upperPanel->ClearDirty();
+        }
+        if (m_lowerPanel) {
+            m_lowerPanel->ClearDirty();
+        }
+        if (m_rollerTrack) {
+            m_rollerTrack->ClearDirty();
+        }
+        if (m_ribs) {
+            m_ribs->ClearDirty();
+        }
+        if (m_fairing) {
+            m_fairing->ClearDirty();
+        }
+    }
+
+    void CPACSTrackStructure::WriteDirtyCPACS(const TixiDocumentHandle& tixiHandle, const std::string& xpath) const
+    {
+        if (m_dirty) {
+            WriteCPACS(tixiHandle, xpath);
+            return;
+        }
+
+        // write modified element controlSurfaceAttachment
+        if (m_controlSurfaceAttachment && m_controlSurfaceAttachment->IsDirty()) {
+            tixi::TixiCreateElementIfNotExists(tixiHandle, xpath + "/controlSurfaceAttachment");
+            m_controlSurfaceAttachment->WriteDirtyCPACS(tixiHandle, xpath + "/controlSurfaceAttachment");
+        }
+
+        // write modified element car
+        if (m_car && m_car->IsDirty()) {
+            tixi::TixiCreateElementIfNotExists(tixiHandle, xpath + "/car");
+            m_car->WriteDirtyCPACS(tixiHandle, xpath + "/car");
+        }
+
+        // write modified element strut1
+        if (m_strut1 && m_strut1->IsDirty()) {
+            tixi::TixiCreateElementIfNotExists(tixiHandle, xpath + "/strut1");
+            m_strut1->WriteDirtyCPACS(tixiHandle, xpath + "/strut1");
+        }
+
+        // write modified element strut2
+        if (m_strut2 && m_strut2->IsDirty()) {
+            tixi::TixiCreateElementIfNotExists(tixiHandle, xpath + "/strut2");
+            m_strut2->WriteDirtyCPACS(tixiHandle, xpath + "/strut2");
+        }
+
+        // write modified element strut3
+        if (m_strut3 && m_strut3->IsDirty()) {
+            tixi::TixiCreateElementIfNotExists(tixiHandle, xpath + "/strut3");
+            m_strut3->WriteDirtyCPACS(tixiHandle, xpath + "/strut3");
+        }
+
+        // write modified element sidePanels
+        if (m_sidePanels && m_sidePanels->IsDirty()) {
+            tixi::TixiCreateElementIfNotExists(tixiHandle, xpath + "/sidePanels");
+            m_sidePanels->WriteDirtyCPACS(tixiHandle, xpath + "/sidePanels");
+        }
+
+        // write modified element upperPanel
+        if (m_upperPanel && m_upperPanel->IsDirty()) {
+            tixi::TixiCreateElementIfNotExists(tixiHandle, xpath + "/upperPanel");
+            m_upperPanel->WriteDirtyCPACS(tixiHandle, xpath + "/upperPanel");
+        }
+
+        // write modified element lowerPanel
+        if (m_lowerPanel && m_lowerPanel->IsDirty()) {
+            tixi::TixiCreateElementIfNotExists(tixiHandle, xpath + "/lowerPanel");
+            m_lowerPanel->WriteDirtyCPACS(tixiHandle, xpath + "/lowerPanel");
+        }
+
+        // write modified element rollerTrack
+        if (m_rollerTrack && m_rollerTrack->IsDirty()) {
+            tixi::TixiCreateElementIfNotExists(tixiHandle, xpath + "/rollerTrack");
+            m_rollerTrack->WriteDirtyCPACS(tixiHandle, xpath + "/rollerTrack");
+        }
+
+        // write modified element ribs
+        if (m_ribs && m_ribs->IsDirty()) {
+            tixi::TixiCreateElementIfNotExists(tixiHandle, xpath + "/ribs");
+            m_ribs->WriteDirtyCPACS(tixiHandle, xpath + "/ribs");
+        }
+
+        // write modified element fairing
+        if (m_fairing && m_fairing->IsDirty()) {
+            tixi::TixiCreateElementIfNotExists(tixiHandle, xpath + "/fairing");
+            m_fairing->WriteDirtyCPACS(tixiHandle, xpath + "/fairing");
+        }
+    }
+
     const boost::optional<CCPACSMaterialDefinition>& CPACSTrackStructure::GetControlSurfaceAttachment() const
     {
         return m_controlSurfaceAttachment;
@@ -401,6 +555,7 @@ namespace generated
 
     void CPACSTrackStructure::RemoveControlSurfaceAttachment()
     {
+        m_dirty = true;
         m_controlSurfaceAttachment = boost::none;
     }
 
@@ -413,6 +568,7 @@ namespace generated
 
     void CPACSTrackStructure::RemoveCar()
     {
+        m_dirty = true;
         m_car = boost::none;
     }
 
@@ -425,6 +581,7 @@ namespace generated
 
     void CPACSTrackStructure::RemoveStrut1()
     {
+        m_dirty = true;
         m_strut1 = boost::none;
     }
 
@@ -437,6 +594,7 @@ namespace generated
 
     void CPACSTrackStructure::RemoveStrut2()
     {
+        m_dirty = true;
         m_strut2 = boost::none;
     }
 
@@ -449,6 +607,7 @@ namespace generated
 
     void CPACSTrackStructure::RemoveStrut3()
     {
+        m_dirty = true;
         m_strut3 = boost::none;
     }
 
@@ -461,6 +620,7 @@ namespace generated
 
     void CPACSTrackStructure::RemoveSidePanels()
     {
+        m_dirty = true;
         m_sidePanels = boost::none;
     }
 
@@ -473,6 +633,7 @@ namespace generated
 
     void CPACSTrackStructure::RemoveUpperPanel()
     {
+        m_dirty = true;
         m_upperPanel = boost::none;
     }
 
@@ -485,6 +646,7 @@ namespace generated
 
     void CPACSTrackStructure::RemoveLowerPanel()
     {
+        m_dirty = true;
         m_lowerPanel = boost::none;
     }
 
@@ -497,6 +659,7 @@ namespace generated
 
     void CPACSTrackStructure::RemoveRollerTrack()
     {
+        m_dirty = true;
         m_rollerTrack = boost::none;
     }
 
@@ -509,6 +672,7 @@ namespace generated
 
     void CPACSTrackStructure::RemoveRibs()
     {
+        m_dirty = true;
         m_ribs = boost::none;
     }
 
@@ -521,6 +685,7 @@ namespace generated
 
     void CPACSTrackStructure::RemoveFairing()
     {
+        m_dirty = true;
         m_fairing = boost::none;
     }
 
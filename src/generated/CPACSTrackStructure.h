@@ -51,6 +51,10 @@ namespace generated
         TIGL_EXPORT virtual void ReadCPACS(const TixiDocumentHandle& tixiHandle, const std::string& xpath);
         TIGL_EXPORT virtual void WriteCPACS(const TixiDocumentHandle& tixiHandle, const std::string& xpath) const;
 
+        TIGL_EXPORT virtual bool IsDirty() const;
+        TIGL_EXPORT virtual void ClearDirty();
+        TIGL_EXPORT virtual void WriteDirtyCPACS(const TixiDocumentHandle& tixiHandle, const std::string& xpath) const;
+
         TIGL_EXPORT virtual const boost::optional<CCPACSMaterialDefinition>& GetControlSurfaceAttachment() const;
         TIGL_EXPORT virtual boost::optional<CCPACSMaterialDefinition>& GetControlSurfaceAttachment();
 
@@ -130,6 +134,9 @@ namespace generated
         boost::optional<CCPACSMaterialDefinition> m_ribs;
         boost::optional<CPACSTrackFairing>        m_fairing;
 
+        /// Set by the setters, cleared after the object has been read or written
+        bool m_dirty;
+
     private:
 #ifdef HAVE_CPP11
         CPACSTrackStructure(const CPACSTrackStructure&) = delete;
@@ -25,6 +25,7 @@ namespace tigl
 namespace generated
 {
     CPACSTrackStrut2::CPACSTrackStrut2()
+        : m_dirty(true)
     {
     }
 
@@ -52,6 +53,37 @@ namespace generated
 
     }
 
+    bool CPACSTrackStrut2::IsDirty() const
+    {
+        if (m_dirty) {
+            return true;
+        }
+        if (m_material.IsDirty()) {
+            return true;
+        }
+        return false;
+    }
+
+    void CPACSTrackStrut2::ClearDirty()
+    {
+        m_dirty = false;
+        m_material.ClearDirty();
+    }
+
+    void CPACSTrackStrut2::WriteDirtyCPACS(const TixiDocumentHandle& tixiHandle, const std::string& xpath) const
+    {
+        if (m_dirty) {
+            WriteCPACS(tixiHandle, xpath);
+            return;
+        }
+
+        // write modified element material
+        if (m_material.IsDirty()) {
+            tixi::TixiCreateElementIfNotExists(tixiHandle, xpath + "/material");
+            m_material.WriteDirtyCPACS(tixiHandle, xpath + "/material");
+        }
+    }
+
     const CCPACSMaterialDefinition& CPACSTrackStrut2::GetMaterial() const
     {
         return m_material;
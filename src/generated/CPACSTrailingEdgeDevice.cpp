@@ -31,6 +31,7 @@ namespace generated
         : m_uidMgr(uidMgr)
         , m_outerShape(reinterpret_cast<CCPACSTrailingEdgeDevice*>(this))
         , m_path(reinterpret_cast<CCPACSTrailingEdgeDevice*>(this), m_uidMgr)
+        , m_dirty(true)
     {
         //assert(parent != NULL);
         m_parent = parent;
@@ -64,8 +65,7 @@ namespace generated
     void CPACSTrailingEdgeDevice::ReadCPACS(const TixiDocumentHandle& tixiHandle, const std::string& xpath)
     {
         // read attribute uID
-        if (tixi::TixiCheckAttribute(tixiHandle, xpath, "uID")) {
-            m_uID = tixi::TixiGetAttribute<std::string>(tixiHandle, xpath, "uID");
+        if (tixi::TixiTryGetAttribute(tixiHandle, xpath, "uID", m_uID)) {
             if (m_uID.empty()) {
                 LOG(WARNING) << "Required attribute uID is empty at xpath " << xpath;
             }
@@ -75,8 +75,7 @@ namespace generated
         }
 
         // read element name
-        if (tixi::TixiCheckElement(tixiHandle, xpath + "/name")) {
-            m_name = tixi::TixiGetElement<std::string>(tixiHandle, xpath + "/name");
+        if (tixi::TixiTryGetElement(tixiHandle, xpath + "/name", m_name)) {
             if (m_name.empty()) {
                 LOG(WARNING) << "Required element name is empty at xpath " << xpath;
             }
@@ -86,16 +85,14 @@ namespace generated
         }
 
         // read element description
-        if (tixi::TixiCheckElement(tixiHandle, xpath + "/description")) {
-            m_description = tixi::TixiGetElement<std::string>(tixiHandle, xpath + "/description");
+        if (tixi::TixiTryGetElement(tixiHandle, xpath + "/description", m_description)) {
             if (m_description->empty()) {
                 LOG(WARNING) << "Optional element description is present but empty at xpath " << xpath;
             }
         }
 
         // read element parentUID
-        if (tixi::TixiCheckElement(tixiHandle, xpath + "/parentUID")) {
-            m_parentUID = tixi::TixiGetElement<std::string>(tixiHandle, xpath + "/parentUID");
+        if (tixi::TixiTryGetElement(tixiHandle, xpath + "/parentUID", m_parentUID)) {
             if (m_parentUID.empty()) {
                 LOG(WARNING) << "Required element parentUID is empty at xpath " << xpath;
             }
@@ -223,6 +220,83 @@ namespace generated
 
     }
 
+    bool CPACSTrailingEdgeDevice::IsDirty() const
+    {
+        if (m_dirty) {
+            return true;
+        }
+        if (m_outerShape.IsDirty()) {
+            return true;
+        }
+        if (m_wingCutOut && m_wingCutOut->IsDirty()) {
+            return true;
+        }
+        if (m_structure && m_structure->IsDirty()) {
+            return true;
+        }
+        if (m_path.IsDirty()) {
+            return true;
+        }
+        if (m_tracks && m_tracks->IsDirty()) {
+            return true;
+        }
+        return false;
+    }
+
+    void CPACSTrailingEdgeDevice::ClearDirty()
+    {
+        m_dirty = false;
+        m_outerShape.ClearDirty();
+        if (m_wingCutOut) {
+            m_wingCutOut->ClearDirty();
+        }
+        if (m_structure) {
+            m_structure->ClearDirty();
+        }
+        m_path.ClearDirty();
+        if (m_tracks) {
+            m_tracks->ClearDirty();
+        }
+    }
+
+    void CPACSTrailingEdgeDevice::WriteDirtyCPACS(const TixiDocumentHandle& tixiHandle, const std::string& xpath) const
+    {
+        if (m_dirty) {
+            WriteCPACS(tixiHandle, xpath);
+            return;
+        }
+
+        // write modified element outerShape
+        if (m_outerShape.IsDirty()) {
+            tixi::TixiCreateElementIfNotExists(tixiHandle, xpath + "/outerShape");
+            m_outerShape.WriteDirtyCPACS(tixiHandle, xpath + "/outerShape");
+        }
+
+        // write modified element wingCutOut
+        if (m_wingCutOut && m_wingCutOut->IsDirty()) {
+            tixi::TixiCreateElementIfNotExists(tixiHandle, xpath + "/wingCutOut");
+            m_wingCutOut->WriteDirtyCPACS(tixiHandle, xpath + "/wingCutOut");
+        }
+
+        // write modified element structure
+        if (m_structure && m_structure->IsDirty()) {
+            tixi::TixiCreateElementIfNotExists(tixiHandle, xpath + "/structure");
+            m_structure->WriteDirtyCPACS(tixiHandle, xpath + "/structure");
+        }
+
+        // write modified element path
+        if (m_path.IsDirty()) {
+            tixi::TixiCreateElementIfNotExists(tixiHandle, xpath + "/path");
+            m_path.WriteDirtyCPACS(tixiHandle, xpath + "/path");
+        }
+
+        // write modified element tracks
+        if (m_tracks && m_tracks->IsDirty()) {
+            tixi::TixiCreateElementIfNotExists(tixiHandle, xpath + "/tracks");
+            m_tracks->WriteDirtyCPACS(tixiHandle, xpath + "/tracks");
+        }
+    }
+
     const std::string& CPACSTrailingEdgeDevice::GetUID() const
     {
         return m_uID;
@@ -230,6 +304,7 @@ namespace generated
 
     void CPACSTrailingEdgeDevice::SetUID(const std::string& value)
     {
+        m_dirty = true;
         if (m_uidMgr) {
             m_uidMgr->TryUnregisterObject(m_uID);
             m_uidMgr->RegisterObject(value, *this);
@@ -244,6 +319,7 @@ namespace generated
 
     void CPACSTrailingEdgeDevice::SetName(const std::string& value)
     {
+        m_dirty = true;
         m_name = value;
     }
 
@@ -254,6 +330,7 @@ namespace generated
 
     void CPACSTrailingEdgeDevice::SetDescription(const boost::optional<std::string>& value)
     {
+        m_dirty = true;
         m_description = value;
     }
 
@@ -264,6 +341,7 @@ namespace generated
 
     void CPACSTrailingEdgeDevice::SetParentUID(const std::string& value)
     {
+        m_dirty = true;
         m_parentUID = value;
     }
 
@@ -326,6 +404,7 @@ namespace generated
 
     void CPACSTrailingEdgeDevice::RemoveWingCutOut()
     {
+        m_dirty = true;
         m_wingCutOut = boost::none;
     }
 
@@ -338,6 +417,7 @@ namespace generated
 
     void CPACSTrailingEdgeDevice::RemoveStructure()
     {
+        m_dirty = true;
         m_structure = boost::none;
     }
 
@@ -350,6 +430,7 @@ namespace generated
 
     void CPACSTrailingEdgeDevice::RemoveTracks()
     {
+        m_dirty = true;
         m_tracks = boost::none;
     }
 
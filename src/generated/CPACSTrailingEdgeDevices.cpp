@@ -30,6 +30,7 @@ namespace generated
 {
     CPACSTrailingEdgeDevices::CPACSTrailingEdgeDevices(CCPACSControlSurfaces* parent, CTiglUIDManager* uidMgr)
         : m_uidMgr(uidMgr)
+        , m_dirty(true)
     {
         //assert(parent != NULL);
         m_parent = parent;
@@ -75,6 +76,43 @@ namespace generated
 
     }
 
+    bool CPACSTrailingEdgeDevices::IsDirty() const
+    {
+        if (m_dirty) {
+            return true;
+        }
+        if (m_trailingEdgeDevices.size() != m_trailingEdgeDevicesClean.size()) {
+            return true;
+        }
+        for (std::size_t i = 0; i < m_trailingEdgeDevices.size(); i++) {
+            if (m_trailingEdgeDevices[i].get() != m_trailingEdgeDevicesClean[i] || m_trailingEdgeDevices[i]->IsDirty()) {
+                return true;
+            }
+        }
+        return false;
+    }
+
+    void CPACSTrailingEdgeDevices::ClearDirty()
+    {
+        m_dirty = false;
+        m_trailingEdgeDevicesClean.clear();
+        for (std::size_t i = 0; i < m_trailingEdgeDevices.size(); i++) {
+            m_trailingEdgeDevicesClean.push_back(m_trailingEdgeDevices[i].get());
+            m_trailingEdgeDevices[i]->ClearDirty();
+        }
+    }
+
+    void CPACSTrailingEdgeDevices::WriteDirtyCPACS(const TixiDocumentHandle& tixiHandle, const std::string& xpath) const
+    {
+        if (m_dirty) {
+            WriteCPACS(tixiHandle, xpath);
+            return;
+        }
+
+        // write modified elements trailingEdgeDevice
+        tixi::TixiSaveDirtyElements(tixiHandle, xpath + "/trailingEdgeDevice", m_trailingEdgeDevices, m_trailingEdgeDevicesClean);
+    }
+
     const std::vector<unique_ptr<CCPACSTrailingEdgeDevice> >& CPACSTrailingEdgeDevices::GetTrailingEdgeDevices() const
     {
         return m_trailingEdgeDevices;
@@ -93,6 +131,7 @@ namespace generated
 
     void CPACSTrailingEdgeDevices::RemoveTrailingEdgeDevice(CCPACSTrailingEdgeDevice& ref)
     {
+        m_dirty = true;
         for (std::size_t i = 0; i < m_trailingEdgeDevices.size(); i++) {
             if (m_trailingEdgeDevices[i].get() == &ref) {
                 m_trailingEdgeDevices.erase(m_trailingEdgeDevices.begin() + i);
@@ -27,6 +27,7 @@ namespace generated
 {
     CPACSTransformation::CPACSTransformation(CTiglUIDManager* uidMgr)
         : m_uidMgr(uidMgr)
+        , m_dirty(true)
     {
     }
 
@@ -48,8 +49,7 @@ namespace generated
     void CPACSTransformation::ReadCPACS(const TixiDocumentHandle& tixiHandle, const std::string& xpath)
     {
         // read attribute uID
-        if (tixi::TixiCheckAttribute(tixiHandle, xpath, "uID")) {
-            m_uID = tixi::TixiGetAttribute<std::string>(tixiHandle, xpath, "uID");
+        if (tixi::TixiTryGetAttribute(tixiHandle, xpath, "uID", m_uID)) {
             if (m_uID.empty()) {
                 LOG(WARNING) << "Required attribute uID is empty at xpath " << xpath;
             }
@@ -134,6 +134,63 @@ namespace generated
 
     }
 
+    bool CPACSTransformation::IsDirty() const
+    {
+        if (m_dirty) {
+            return true;
+        }
+        if (m_scaling && m_scaling->IsDirty()) {
+            return true;
+        }
+        if (m_rotation && m_rotation->IsDirty()) {
+            return true;
+        }
+        if (m_translation && m_translation->IsDirty()) {
+            return true;
+        }
+        return false;
+    }
+
+    void CPACSTransformation::ClearDirty()
+    {
+        m_dirty = false;
+        if (m_scaling) {
+            m_scaling->ClearDirty();
+        }
+        if (m_rotation) {
+            m_rotation->ClearDirty();
+        }
+        if (m_translation) {
+            m_translation->ClearDirty();
+        }
+    }
+
+    void CPACSTransformation::WriteDirtyCPACS(const TixiDocumentHandle& tixiHandle, const std::string& xpath) const
+    {
+        if (m_dirty) {
+            WriteCPACS(tixiHandle, xpath);
+            return;
+        }
+
+        // write modified element scaling
+        if (m_scaling && m_scaling->IsDirty()) {
+            tixi::TixiCreateElementIfNotExists(tixiHandle, xpath + "/scaling");
+            m_scaling->WriteDirtyCPACS(tixiHandle, xpath + "/scaling");
+        }
+
+        // write modified element rotation
+        if (m_rotation && m_rotation->IsDirty()) {
+            tixi::TixiCreateElementIfNotExists(tixiHandle, xpath + "/rotation");
+            m_rotation->WriteDirtyCPACS(tixiHandle, xpath + "/rotation");
+        }
+
+        // write modified element translation
+        if (m_translation && m_translation->IsDirty()) {
+            tixi::TixiCreateElementIfNotExists(tixiHandle, xpath + "/translation");
+            m_translation->WriteDirtyCPACS(tixiHandle, xpath + "/translation");
+        }
+    }
+
     const std::string& CPACSTransformation::GetUID() const
     {
         return m_uID;
@@ -141,6 +198,7 @@ namespace generated
 
     void CPACSTransformation::SetUID(const std::string& value)
     {
+        m_dirty = true;
         if (m_uidMgr) {
             m_uidMgr->TryUnregisterObject(m_uID);
             m_uidMgr->RegisterObject(value, *this);
@@ -187,6 +245,7 @@ namespace generated
 
     void CPACSTransformation::RemoveScaling()
     {
+        m_dirty = true;
         m_scaling = boost::none;
     }
 
@@ -199,6 +258,7 @@ namespace generated
 
     void CPACSTransformation::RemoveRotation()
     {
+        m_dirty = true;
         m_rotation = boost::none;
     }
 
@@ -211,6 +271,7 @@ namespace generated
 
     void CPACSTransformation::RemoveTranslation()
     {
+        m_dirty = true;
         m_translation = boost::none;
     }
 
@@ -26,6 +26,7 @@ namespace generated
 {
     CPACSUpdate::CPACSUpdate()
         : m_timestamp(0)
+        , m_dirty(true)
     {
     }
 
@@ -36,8 +37,7 @@ namespace generated
     void CPACSUpdate::ReadCPACS(const TixiDocumentHandle& tixiHandle, const std::string& xpath)
     {
         // read element modification
-        if (tixi::TixiCheckElement(tixiHandle, xpath + "/modification")) {
-            m_modification = tixi::TixiGetElement<std::string>(tixiHandle, xpath + "/modification");
+        if (tixi::TixiTryGetElement(tixiHandle, xpath + "/modification", m_modification)) {
             if (m_modification.empty()) {
                 LOG(WARNING) << "Required element modification is empty at xpath " << xpath;
             }
@@ -47,8 +47,7 @@ namespace generated
         }
 
         // read element creator
-        if (tixi::TixiCheckElement(tixiHandle, xpath + "/creator")) {
-            m_creator = tixi::TixiGetElement<std::string>(tixiHandle, xpath + "/creator");
+        if (tixi::TixiTryGetElement(tixiHandle, xpath + "/creator", m_creator)) {
             if (m_creator.empty()) {
                 LOG(WARNING) << "Required element creator is empty at xpath " << xpath;
             }
@@ -58,16 +57,12 @@ namespace generated
         }
 
         // read element timestamp
-        if (tixi::TixiCheckElement(tixiHandle, xpath + "/timestamp")) {
-            m_timestamp = tixi::TixiGetElement<std::time_t>(tixiHandle, xpath + "/timestamp");
-        }
-        else {
+        if (!tixi::TixiTryGetElement(tixiHandle, xpath + "/timestamp", m_timestamp)) {
             LOG(ERROR) << "Required element timestamp is missing at xpath " << xpath;
         }
 
         // read element version
-        if (tixi::TixiCheckElement(tixiHandle, xpath + "/version")) {
-            m_version = tixi::TixiGetElement<std::string>(tixiHandle, xpath + "/version");
+        if (tixi::TixiTryGetElement(tixiHandle, xpath + "/version", m_version)) {
             if (m_version.empty()) {
                 LOG(WARNING) << "Required element version is empty at xpath " << xpath;
             }
@@ -77,8 +72,7 @@ namespace generated
         }
 
         // read element cpacsVersion
-        if (tixi::TixiCheckElement(tixiHandle, xpath + "/cpacsVersion")) {
-            m_cpacsVersion = tixi::TixiGetElement<std::string>(tixiHandle, xpath + "/cpacsVersion");
+        if (tixi::TixiTryGetElement(tixiHandle, xpath + "/cpacsVersion", m_cpacsVersion)) {
             if (m_cpacsVersion.empty()) {
                 LOG(WARNING) << "Required element cpacsVersion is empty at xpath " << xpath;
             }
@@ -113,6 +107,23 @@ namespace generated
 
     }
 
+    bool CPACSUpdate::IsDirty() const
+    {
+        return m_dirty;
+    }
+
+    void CPACSUpdate::ClearDirty()
+    {
+        m_dirty = false;
+    }
+
+    void CPACSUpdate::WriteDirtyCPACS(const TixiDocumentHandle& tixiHandle, const std::string& xpath) const
+    {
+        if (m_dirty) {
+            WriteCPACS(tixiHandle, xpath);
+        }
+    }
+
     const std::string& CPACSUpdate::GetModification() const
     {
         return m_modification;
@@ -120,6 +131,7 @@ namespace generated
 
     void CPACSUpdate::SetModification(const std::string& value)
     {
+        m_dirty = true;
         m_modification = value;
     }
 
@@ -130,6 +142,7 @@ namespace generated
 
     void CPACSUpdate::SetCreator(const std::string& value)
     {
+        m_dirty = true;
         m_creator = value;
     }
 
@@ -140,6 +153,7 @@ namespace generated
 
     void CPACSUpdate::SetTimestamp(const std::time_t& value)
     {
+        m_dirty = true;
         m_timestamp = value;
     }
 
@@ -150,6 +164,7 @@ namespace generated
 
     void CPACSUpdate::SetVersion(const std::string& value)
     {
+        m_dirty = true;
         m_version = value;
     }
 
@@ -160,6 +175,7 @@ namespace generated
 
     void CPACSUpdate::SetCpacsVersion(const std::string& value)
     {
+        m_dirty = true;
         m_cpacsVersion = value;
     }
 
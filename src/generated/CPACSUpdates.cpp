@@ -26,6 +26,7 @@ namespace tigl
 namespace generated
 {
     CPACSUpdates::CPACSUpdates()
+        : m_dirty(true)
     {
     }
 
@@ -49,6 +50,43 @@ namespace generated
 
     }
 
+    bool CPACSUpdates::IsDirty() const
+    {
+        if (m_dirty) {
+            return true;
+        }
+        if (m_updates.size() != m_updatesClean.size()) {
+            return true;
+        }
+        for (std::size_t i = 0; i < m_updates.size(); i++) {
+            if (m_updates[i].get() != m_updatesClean[i] || m_updates[i]->IsDirty()) {
+                return true;
+            }
+        }
+        return false;
+    }
+
+    void CPACSUpdates::ClearDirty()
+    {
+        m_dirty = false;
+        m_updatesClean.clear();
+        for (std::size_t i = 0; i < m_updates.size(); i++) {
+            m_updatesClean.push_back(m_updates[i].get());
+            m_updates[i]->ClearDirty();
+        }
+    }
+
+    void CPACSUpdates::WriteDirtyCPACS(const TixiDocumentHandle& tixiHandle, const std::string& xpath) const
+    {
+        if (m_dirty) {
+            WriteCPACS(tixiHandle, xpath);
+            return;
+        }
+
+        // write modified elements update
+        tixi::TixiSaveDirtyElements(tixiHandle, xpath + "/update", m_updates, m_updatesClean);
+    }
+
     const std::vector<unique_ptr<CPACSUpdate> >& CPACSUpdates::GetUpdates() const
     {
         return m_updates;
@@ -67,6 +105,7 @@ namespace generated
 
     void CPACSUpdates::RemoveUpdate(CPACSUpdate& ref)
     {
+        m_dirty = true;
         for (std::size_t i = 0; i < m_updates.size(); i++) {
             if (m_updates[i].get() == &ref) {
                 m_updates.erase(m_updates.begin() + i);
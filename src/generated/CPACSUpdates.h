@@ -47,6 +47,10 @@ namespace generated
         TIGL_EXPORT virtual void ReadCPACS(const TixiDocumentHandle& tixiHandle, const std::string& xpath);
         TIGL_EXPORT virtual void WriteCPACS(const TixiDocumentHandle& tixiHandle, const std::string& xpath) const;
 
+        TIGL_EXPORT virtual bool IsDirty() const;
+        TIGL_EXPORT virtual void ClearDirty();
+        TIGL_EXPORT virtual void WriteDirtyCPACS(const TixiDocumentHandle& tixiHandle, const std::string& xpath) const;
+
         TIGL_EXPORT virtual const std::vector<unique_ptr<CPACSUpdate> >& GetUpdates() const;
         TIGL_EXPORT virtual std::vector<unique_ptr<CPACSUpdate> >& GetUpdates();
 
@@ -56,6 +60,12 @@ namespace generated
     protected:
         std::vector<unique_ptr<CPACSUpdate> > m_updates;
 
+        /// Set by the setters, cleared after the object has been read or written
+        bool m_dirty;
+
+        /// List elements at the last call of ClearDirty
+        std::vector<const CPACSUpdate*> m_updatesClean;
+
     private:
 #ifdef HAVE_CPP11
         CPACSUpdates(const CPACSUpdates&) = delete;
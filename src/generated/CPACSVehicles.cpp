@@ -27,6 +27,7 @@ namespace generated
 {
     CPACSVehicles::CPACSVehicles(CTiglUIDManager* uidMgr)
         : m_uidMgr(uidMgr)
+        , m_dirty(true)
     {
     }
 
@@ -162,6 +163,87 @@ namespace generated
 
     }
 
+    bool CPACSVehicles::IsDirty() const
+    {
+        if (m_dirty) {
+            return true;
+        }
+        if (m_aircraft && m_aircraft->IsDirty()) {
+            return true;
+        }
+        if (m_rotorcraft && m_rotorcraft->IsDirty()) {
+            return true;
+        }
+        if (m_profiles && m_profiles->IsDirty()) {
+            return true;
+        }
+        if (m_structuralElements && m_structuralElements->IsDirty()) {
+            return true;
+        }
+        if (m_materials && m_materials->IsDirty()) {
+            return true;
+        }
+        return false;
+    }
+
+    void CPACSVehicles::ClearDirty()
+    {
+        m_dirty = false;
+        if (m_aircraft) {
+            m_aircraft->ClearDirty();
+        }
+        if (m_rotorcraft) {
+            m_rotorcraft->ClearDirty();
+        }
+        if (m_profiles) {
+            m_profiles->ClearDirty();
+        }
+        if (m_structuralElements) {
+            m_structuralElements->ClearDirty();
+        }
+        if (m_materials) {
+            m_materials->ClearDirty();
+        }
+    }
+
+    void CPACSVehicles::WriteDirtyCPACS(const TixiDocumentHandle& tixiHandle, const std::string& xpath) const
+    {
+        if (m_dirty) {
+            WriteCPACS(tixiHandle, xpath);
+            return;
+        }
+
+        // write modified element aircraft
+        if (m_aircraft && m_aircraft->IsDirty()) {
+            tixi::TixiCreateElementIfNotExists(tixiHandle, xpath + "/aircraft");
+            m_aircraft->WriteDirtyCPACS(tixiHandle, xpath + "/aircraft");
+        }
+
+        // write modified element rotorcraft
+        if (m_rotorcraft && m_rotorcraft->IsDirty()) {
+            tixi::TixiCreateElementIfNotExists(tixiHandle, xpath + "/rotorcraft");
+            m_rotorcraft->WriteDirtyCPACS(tixiHandle, xpath + "/rotorcraft");
+        }
+
+        // write modified element profiles
+        if (m_profiles && m_profiles->IsDirty()) {
+            tixi::TixiCreateElementIfNotExists(tixiHandle, xpath + "/profiles");
+            m_profiles->WriteDirtyCPACS(tixiHandle, xpath + "/profiles");
+        }
+
+        // write modified element structuralElements
+        if (m_structuralElements && m_structuralElements->IsDirty()) {
+            tixi::TixiCreateElementIfNotExists(tixiHandle, xpath + "/structuralElements");
+            m_structuralElements->WriteDirtyCPACS(tixiHandle, xpath + "/structuralElements");
+        }
+
+        // write modified element materials
+        if (m_materials && m_materials->IsDirty()) {
+            tixi::TixiCreateElementIfNotExists(tixiHandle, xpath + "/materials");
+            m_materials->WriteDirtyCPACS(tixiHandle, xpath + "/materials");
+        }
+    }
+
     const boost::optional<CPACSAircraft>& CPACSVehicles::GetAircraft() const
     {
         return m_aircraft;
@@ -221,6 +303,7 @@ namespace generated
 
     void CPACSVehicles::RemoveAircraft()
     {
+        m_dirty = true;
         m_aircraft = boost::none;
     }
 
@@ -233,6 +316,7 @@ namespace generated
 
     void CPACSVehicles::RemoveRotorcraft()
     {
+        m_dirty = true;
         m_rotorcraft = boost::none;
     }
 
@@ -245,6 +329,7 @@ namespace generated
 
     void CPACSVehicles::RemoveProfiles()
     {
+        m_dirty = true;
         m_profiles = boost::none;
     }
 
@@ -257,6 +342,7 @@ namespace generated
 
     void CPACSVehicles::RemoveStructuralElements()
     {
+        m_dirty = true;
         m_structuralElements = boost::none;
     }
 
@@ -269,6 +355,7 @@ namespace generated
 
     void CPACSVehicles::RemoveMaterials()
     {
+        m_dirty = true;
         m_materials = boost::none;
     }
 
@@ -57,6 +57,10 @@ namespace generated
         TIGL_EXPORT virtual void ReadCPACS(const TixiDocumentHandle& tixiHandle, const std::string& xpath);
         TIGL_EXPORT virtual void WriteCPACS(const TixiDocumentHandle& tixiHandle, const std::string& xpath) const;
 
+        TIGL_EXPORT virtual bool IsDirty() const;
+        TIGL_EXPORT virtual void ClearDirty();
+        TIGL_EXPORT virtual void WriteDirtyCPACS(const TixiDocumentHandle& tixiHandle, const std::string& xpath) const;
+
         TIGL_EXPORT virtual const boost::optional<CPACSAircraft>& GetAircraft() const;
         TIGL_EXPORT virtual boost::optional<CPACSAircraft>& GetAircraft();
 
@@ -96,6 +100,9 @@ namespace generated
         boost::optional<CPACSStructuralElements> m_structuralElements;
         boost::optional<CPACSMaterials>          m_materials;
 
+        /// Set by the setters, cleared after the object has been read or written
+        bool m_dirty;
+
     private:
 #ifdef HAVE_CPP11
         CPACSVehicles(const CPACSVehicles&) = delete;
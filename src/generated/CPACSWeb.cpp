@@ -26,6 +26,7 @@ namespace generated
 {
     CPACSWeb::CPACSWeb()
         : m_relPos(0)
+        , m_dirty(true)
     {
     }
 
@@ -44,10 +45,7 @@ namespace generated
         }
 
         // read element relPos
-        if (tixi::TixiCheckElement(tixiHandle, xpath + "/relPos")) {
-            m_relPos = tixi::TixiGetElement<double>(tixiHandle, xpath + "/relPos");
-        }
-        else {
+        if (!tixi::TixiTryGetElement(tixiHandle, xpath + "/relPos", m_relPos)) {
             LOG(ERROR) << "Required element relPos is missing at xpath " << xpath;
         }
 
@@ -65,6 +63,37 @@ namespace generated
 
     }
 
+    bool CPACSWeb::IsDirty() const
+    {
+        if (m_dirty) {
+            return true;
+        }
+        if (m_material.IsDirty()) {
+            return true;
+        }
+        return false;
+    }
+
+    void CPACSWeb::ClearDirty()
+    {
+        m_dirty = false;
+        m_material.ClearDirty();
+    }
+
+    void CPACSWeb::WriteDirtyCPACS(const TixiDocumentHandle& tixiHandle, const std::string& xpath) const
+    {
+        if (m_dirty) {
+            WriteCPACS(tixiHandle, xpath);
+            return;
+        }
+
+        // write modified element material
+        if (m_material.IsDirty()) {
+            tixi::TixiCreateElementIfNotExists(tixiHandle, xpath + "/material");
+            m_material.WriteDirtyCPACS(tixiHandle, xpath + "/material");
+        }
+    }
+
     const CCPACSMaterialDefinition& CPACSWeb::GetMaterial() const
     {
         return m_material;
@@ -82,6 +111,7 @@ namespace generated
 
     void CPACSWeb::SetRelPos(const double& value)
     {
+        m_dirty = true;
         m_relPos = value;
     }
 
@@ -28,6 +28,7 @@ namespace generated
 {
     CPACSWindows::CPACSWindows(CTiglUIDManager* uidMgr)
         : m_uidMgr(uidMgr)
+        , m_dirty(true)
     {
     }
 
@@ -49,8 +50,7 @@ namespace generated
     void CPACSWindows::ReadCPACS(const TixiDocumentHandle& tixiHandle, const std::string& xpath)
     {
         // read attribute uID
-        if (tixi::TixiCheckAttribute(tixiHandle, xpath, "uID")) {
-            m_uID = tixi::TixiGetAttribute<std::string>(tixiHandle, xpath, "uID");
+        if (tixi::TixiTryGetAttribute(tixiHandle, xpath, "uID", m_uID)) {
             if (m_uID.empty()) {
                 LOG(WARNING) << "Required attribute uID is empty at xpath " << xpath;
             }
@@ -77,6 +77,43 @@ namespace generated
 
     }
 
+    bool CPACSWindows::IsDirty() const
+    {
+        if (m_dirty) {
+            return true;
+        }
+        if (m_windows.size() != m_windowsClean.size()) {
+            return true;
+        }
+        for (std::size_t i = 0; i < m_windows.size(); i++) {
+            if (m_windows[i].get() != m_windowsClean[i] || m_windows[i]->IsDirty()) {
+                return true;
+            }
+        }
+        return false;
+    }
+
+    void CPACSWindows::ClearDirty()
+    {
+        m_dirty = false;
+        m_windowsClean.clear();
+        for (std::size_t i = 0; i < m_windows.size(); i++) {
+            m_windowsClean.push_back(m_windows[i].get());
+            m_windows[i]->ClearDirty();
+        }
+    }
+
+    void CPACSWindows::WriteDirtyCPACS(const TixiDocumentHandle& tixiHandle, const std::string& xpath) const
+    {
+        if (m_dirty) {
+            WriteCPACS(tixiHandle, xpath);
+            return;
+        }
+
+        // write modified elements window
+        tixi::TixiSaveDirtyElements(tixiHandle, xpath + "/window", m_windows, m_windowsClean);
+    }
+
     const std::string& CPACSWindows::GetUID() const
     {
         return m_uID;
@@ -84,6 +121,7 @@ namespace generated
 
     void CPACSWindows::SetUID(const std::string& value)
     {
+        m_dirty = true;
         if (m_uidMgr) {
             m_uidMgr->TryUnregisterObject(m_uID);
             m_uidMgr->RegisterObject(value, *this);
@@ -109,6 +147,7 @@ namespace generated
 
     void CPACSWindows::RemoveWindow(CPACSCutOut& ref)
     {
+        m_dirty = true;
         for (std::size_t i = 0; i < m_windows.size(); i++) {
             if (m_windows[i].get() == &ref) {
                 m_windows.erase(m_windows.begin() + i);
@@ -33,6 +33,7 @@ namespace generated
         , m_transformation(m_uidMgr)
         , m_sections(reinterpret_cast<CCPACSWing*>(this), m_uidMgr)
         , m_segments(reinterpret_cast<CCPACSWing*>(this), m_uidMgr)
+        , m_dirty(true)
     {
         //assert(parent != NULL);
         m_parent = parent;
@@ -44,6 +45,7 @@ namespace generated
         , m_transformation(m_uidMgr)
         , m_sections(reinterpret_cast<CCPACSWing*>(this), m_uidMgr)
         , m_segments(reinterpret_cast<CCPACSWing*>(this), m_uidMgr)
+        , m_dirty(true)
     {
         //assert(parent != NULL);
         m_parent = parent;
@@ -68,8 +70,7 @@ namespace generated
     void CPACSWing::ReadCPACS(const TixiDocumentHandle& tixiHandle, const std::string& xpath)
     {
         // read attribute uID
-        if (tixi::TixiCheckAttribute(tixiHandle, xpath, "uID")) {
-            m_uID = tixi::TixiGetAttribute<std::string>(tixiHandle, xpath, "uID");
+        if (tixi::TixiTryGetAttribute(tixiHandle, xpath, "uID", m_uID)) {
             if (m_uID.empty()) {
                 LOG(WARNING) << "Required attribute uID is empty at xpath " << xpath;
             }
@@ -84,8 +85,7 @@ namespace generated
         }
 
         // read element name
-        if (tixi::TixiCheckElement(tixiHandle, xpath + "/name")) {
-            m_name = tixi::TixiGetElement<std::string>(tixiHandle, xpath + "/name");
+        if (tixi::TixiTryGetElement(tixiHandle, xpath + "/name", m_name)) {
             if (m_name.empty()) {
                 LOG(WARNING) << "Required element name is empty at xpath " << xpath;
             }
@@ -95,16 +95,14 @@ namespace generated
         }
 
         // read element description
-        if (tixi::TixiCheckElement(tixiHandle, xpath + "/description")) {
-            m_description = tixi::TixiGetElement<std::string>(tixiHandle, xpath + "/description");
+        if (tixi::TixiTryGetElement(tixiHandle, xpath + "/description", m_description)) {
             if (m_description->empty()) {
                 LOG(WARNING) << "Optional element description is present but empty at xpath " << xpath;
             }
         }
 
         // read element parentUID
-        if (tixi::TixiCheckElement(tixiHandle, xpath + "/parentUID")) {
-            m_parentUID = tixi::TixiGetElement<std::string>(tixiHandle, xpath + "/parentUID");
+        if (tixi::TixiTryGetElement(tixiHandle, xpath + "/parentUID", m_parentUID)) {
             if (m_parentUID->empty()) {
                 LOG(WARNING) << "Optional element parentUID is present but empty at xpath " << xpath;
             }
@@ -236,6 +234,81 @@ namespace generated
 
     }
 
+    bool CPACSWing::IsDirty() const
+    {
+        if (m_dirty) {
+            return true;
+        }
+        if (m_transformation.IsDirty()) {
+            return true;
+        }
+        if (m_sections.IsDirty()) {
+            return true;
+        }
+        if (m_positionings && m_positionings->IsDirty()) {
+            return true;
+        }
+        if (m_segments.IsDirty()) {
+            return true;
+        }
+        if (m_componentSegments && m_componentSegments->IsDirty()) {
+            return true;
+        }
+        return false;
+    }
+
+    void CPACSWing::ClearDirty()
+    {
+        m_dirty = false;
+        m_transformation.ClearDirty();
+        m_sections.ClearDirty();
+        if (m_positionings) {
+            m_positionings->ClearDirty();
+        }
+        m_segments.ClearDirty();
+        if (m_componentSegments) {
+            m_componentSegments->ClearDirty();
+        }
+    }
+
+    void CPACSWing::WriteDirtyCPACS(const TixiDocumentHandle& tixiHandle, const std::string& xpath) const
+    {
+        if (m_dirty) {
+            WriteCPACS(tixiHandle, xpath);
+            return;
+        }
+
+        // write modified element transformation
+        if (m_transformation.IsDirty()) {
+            tixi::TixiCreateElementIfNotExists(tixiHandle, xpath + "/transformation");
+            m_transformation.WriteDirtyCPACS(tixiHandle, xpath + "/transformation");
+        }
+
+        // write modified element sections
+        if (m_sections.IsDirty()) {
+            tixi::TixiCreateElementIfNotExists(tixiHandle, xpath + "/sections");
+            m_sections.WriteDirtyCPACS(tixiHandle, xpath + "/sections");
+        }
+
+        // write modified element positionings
+        if (m_positionings && m_positionings->IsDirty()) {
+            tixi::TixiCreateElementIfNotExists(tixiHandle, xpath + "/positionings");
+            m_positionings->WriteDirtyCPACS(tixiHandle, xpath + "/positionings");
+        }
+
+        // write modified element segments
+        if (m_segments.IsDirty()) {
+            tixi::TixiCreateElementIfNotExists(tixiHandle, xpath + "/segments");
+            m_segments.WriteDirtyCPACS(tixiHandle, xpath + "/segments");
+        }
+
+        // write modified element componentSegments
+        if (m_componentSegments && m_componentSegments->IsDirty()) {
+            tixi::TixiCreateElementIfNotExists(tixiHandle, xpath + "/componentSegments");
+            m_componentSegments->WriteDirtyCPACS(tixiHandle, xpath + "/componentSegments");
+        }
+    }
+
     const std::string& CPACSWing::GetUID() const
     {
         return m_uID;
@@ -243,6 +316,7 @@ namespace generated
 
     void CPACSWing::SetUID(const std::string& value)
     {
+        m_dirty = true;
         if (m_uidMgr) {
             m_uidMgr->TryUnregisterObject(m_uID);
             m_uidMgr->RegisterObject(value, *this);
@@ -257,6 +331,7 @@ namespace generated
 
     void CPACSWing::SetSymmetry(const boost::optional<TiglSymmetryAxis>& value)
     {
+        m_dirty = true;
         m_symmetry = value;
     }
 
@@ -267,6 +342,7 @@ namespace generated
 
     void CPACSWing::SetName(const std::string& value)
     {
+        m_dirty = true;
         m_name = value;
     }
 
@@ -277,6 +353,7 @@ namespace generated
 
     void CPACSWing::SetDescription(const boost::optional<std::string>& value)
     {
+        m_dirty = true;
         m_description = value;
     }
 
@@ -287,6 +364,7 @@ namespace generated
 
     void CPACSWing::SetParentUID(const boost::optional<std::string>& value)
     {
+        m_dirty = true;
         m_parentUID = value;
     }
 
@@ -349,6 +427,7 @@ namespace generated
 
     void CPACSWing::RemovePositionings()
     {
+        m_dirty = true;
         m_positionings = boost::none;
     }
 
@@ -361,6 +440,7 @@ namespace generated
 
     void CPACSWing::RemoveComponentSegments()
     {
+        m_dirty = true;
         m_componentSegments = boost::none;
     }
 
@@ -28,6 +28,7 @@ namespace generated
 {
     CPACSWingAirfoils::CPACSWingAirfoils(CTiglUIDManager* uidMgr)
         : m_uidMgr(uidMgr)
+        , m_dirty(true)
     {
     }
 
@@ -61,6 +62,43 @@ namespace generated
 
     }
 
+    bool CPACSWingAirfoils::IsDirty() const
+    {
+        if (m_dirty) {
+            return true;
+        }
+        if (m_wingAirfoils.size() != m_wingAirfoilsClean.size()) {
+            return true;
+        }
+        for (std::size_t i = 0; i < m_wingAirfoils.size(); i++) {
+            if (m_wingAirfoils[i].get() != m_wingAirfoilsClean[i] || m_wingAirfoils[i]->IsDirty()) {
+                return true;
+            }
+        }
+        return false;
+    }
+
+    void CPACSWingAirfoils::ClearDirty()
+    {
+        m_dirty = false;
+        m_wingAirfoilsClean.clear();
+        for (std::size_t i = 0; i < m_wingAirfoils.size(); i++) {
+            m_wingAirfoilsClean.push_back(m_wingAirfoils[i].get());
+            m_wingAirfoils[i]->ClearDirty();
+        }
+    }
+
+    void CPACSWingAirfoils::WriteDirtyCPACS(const TixiDocumentHandle& tixiHandle, const std::string& xpath) const
+    {
+        if (m_dirty) {
+            WriteCPACS(tixiHandle, xpath);
+            return;
+        }
+
+        // write modified elements wingAirfoil
+        tixi::TixiSaveDirtyElements(tixiHandle, xpath + "/wingAirfoil", m_wingAirfoils, m_wingAirfoilsClean);
+    }
+
     const std::vector<unique_ptr<CPACSProfileGeometry> >& CPACSWingAirfoils::GetWingAirfoils() const
     {
         return m_wingAirfoils;
@@ -79,6 +117,7 @@ namespace generated
 
     void CPACSWingAirfoils::RemoveWingAirfoil(CPACSProfileGeometry& ref)
     {
+        m_dirty = true;
         for (std::size_t i = 0; i < m_wingAirfoils.size(); i++) {
             if (m_wingAirfoils[i].get() == &ref) {
                 m_wingAirfoils.erase(m_wingAirfoils.begin() + i);
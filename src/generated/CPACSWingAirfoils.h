@@ -52,6 +52,10 @@ namespace generated
         TIGL_EXPORT virtual void ReadCPACS(const TixiDocumentHandle& tixiHandle, const std::string& xpath);
         TIGL_EXPORT virtual void WriteCPACS(const TixiDocumentHandle& tixiHandle, const std::string& xpath) const;
 
+        TIGL_EXPORT virtual bool IsDirty() const;
+        TIGL_EXPORT virtual void ClearDirty();
+        TIGL_EXPORT virtual void WriteDirtyCPACS(const TixiDocumentHandle& tixiHandle, const std::string& xpath) const;
+
         TIGL_EXPORT virtual const std::vector<unique_ptr<CPACSProfileGeometry> >& GetWingAirfoils() const;
         TIGL_EXPORT virtual std::vector<unique_ptr<CPACSProfileGeometry> >& GetWingAirfoils();
 
@@ -63,6 +67,12 @@ namespace generated
 
         std::vector<unique_ptr<CPACSProfileGeometry> > m_wingAirfoils;
 
+        /// Set by the setters, cleared after the object has been read or written
+        bool m_dirty;
+
+        /// List elements at the last call of ClearDirty
+        std::vector<const CPACSProfileGeometry*> m_wingAirfoilsClean;
+
     private:
 #ifdef HAVE_CPP11
         CPACSWingAirfoils(const CPACSWingAirfoils&) = delete;
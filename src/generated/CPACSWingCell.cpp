@@ -33,6 +33,7 @@ namespace generated
         , m_positioningTrailingEdge(reinterpret_cast<CCPACSWingCell*>(this))
         , m_positioningInnerBorder(reinterpret_cast<CCPACSWingCell*>(this))
         , m_positioningOuterBorder(reinterpret_cast<CCPACSWingCell*>(this))
+        , m_dirty(true)
     {
         //assert(parent != NULL);
         m_parent = parent;
@@ -66,8 +67,7 @@ namespace generated
     void CPACSWingCell::ReadCPACS(const TixiDocumentHandle& tixiHandle, const std::string& xpath)
     {
         // read attribute uID
-        if (tixi::TixiCheckAttribute(tixiHandle, xpath, "uID")) {
-            m_uID = tixi::TixiGetAttribute<std::string>(tixiHandle, xpath, "uID");
+        if (tixi::TixiTryGetAttribute(tixiHandle, xpath, "uID", m_uID)) {
             if (m_uID.empty()) {
                 LOG(WARNING) << "Required attribute uID is empty at xpath " << xpath;
             }
@@ -146,6 +146,77 @@ namespace generated
 
     }
 
+    bool CPACSWingCell::IsDirty() const
+    {
+        if (m_dirty) {
+            return true;
+        }
+        if (m_skin.IsDirty()) {
+            return true;
+        }
+        if (m_positioningLeadingEdge.IsDirty()) {
+            return true;
+        }
+        if (m_positioningTrailingEdge.IsDirty()) {
+            return true;
+        }
+        if (m_positioningInnerBorder.IsDirty()) {
+            return true;
+        }
+        if (m_positioningOuterBorder.IsDirty()) {
+            return true;
+        }
+        return false;
+    }
+
+    void CPACSWingCell::ClearDirty()
+    {
+        m_dirty = false;
+        m_skin.ClearDirty();
+        m_positioningLeadingEdge.ClearDirty();
+        m_positioningTrailingEdge.ClearDirty();
+        m_positioningInnerBorder.ClearDirty();
+        m_positioningOuterBorder.ClearDirty();
+    }
+
+    void CPACSWingCell::WriteDirtyCPACS(const TixiDocumentHandle& tixiHandle, const std::string& xpath) const
+    {
+        if (m_dirty) {
+            WriteCPACS(tixiHandle, xpath);
+            return;
+        }
+
+        // write modified element skin
+        if (m_skin.IsDirty()) {
+            tixi::TixiCreateElementIfNotExists(tixiHandle, xpath + "/skin");
+            m_skin.WriteDirtyCPACS(tixiHandle, xpath + "/skin");
+        }
+
+        // write modified element positioningLeadingEdge
+        if (m_positioningLeadingEdge.IsDirty()) {
+            tixi::TixiCreateElementIfNotExists(tixiHandle, xpath + "/positioningLeadingEdge");
+            m_positioningLeadingEdge.WriteDirtyCPACS(tixiHandle, xpath + "/positioningLeadingEdge");
+        }
+
+        // write modified element positioningTrailingEdge
+        if (m_positioningTrailingEdge.IsDirty()) {
+            tixi::TixiCreateElementIfNotExists(tixiHandle, xpath + "/positioningTrailingEdge");
+            m_positioningTrailingEdge.WriteDirtyCPACS(tixiHandle, xpath + "/positioningTrailingEdge");
+        }
+
+        // write modified element positioningInnerBorder
+        if (m_positioningInnerBorder.IsDirty()) {
+            tixi::TixiCreateElementIfNotExists(tixiHandle, xpath + "/positioningInnerBorder");
+            m_positioningInnerBorder.WriteDirtyCPACS(tixiHandle, xpath + "/positioningInnerBorder");
+        }
+
+        // write modified element positioningOuterBorder
+        if (m_positioningOuterBorder.IsDirty()) {
+            tixi::TixiCreateElementIfNotExists(tixiHandle, xpath + "/positioningOuterBorder");
+            m_positioningOuterBorder.WriteDirtyCPACS(tixiHandle, xpath + "/positioningOuterBorder");
+        }
+    }
+
     const std::string& CPACSWingCell::GetUID() const
     {
         return m_uID;
@@ -153,6 +224,7 @@ namespace generated
 
     void CPACSWingCell::SetUID(const std::string& value)
     {
+        m_dirty = true;
         if (m_uidMgr) {
             m_uidMgr->TryUnregisterObject(m_uID);
             m_uidMgr->RegisterObject(value, *this);
@@ -30,6 +30,7 @@ namespace generated
 {
     CPACSWingCells::CPACSWingCells(CCPACSWingShell* parent, CTiglUIDManager* uidMgr)
         : m_uidMgr(uidMgr)
+        , m_dirty(true)
     {
         //assert(parent != NULL);
         m_parent = parent;
@@ -75,6 +76,43 @@ namespace generated
 
     }
 
+    bool CPACSWingCells::IsDirty() const
+    {
+        if (m_dirty) {
+            return true;
+        }
+        if (m_cells.size() != m_cellsClean.size()) {
+            return true;
+        }
+        for (std::size_t i = 0; i < m_cells.size(); i++) {
+            if (m_cells[i].get() != m_cellsClean[i] || m_cells[i]->IsDirty()) {
+                return true;
+            }
+        }
+        return false;
+    }
+
+    void CPACSWingCells::ClearDirty()
+    {
+        m_dirty = false;
+        m_cellsClean.clear();
+        for (std::size_t i = 0; i < m_cells.size(); i++) {
+            m_cellsClean.push_back(m_cells[i].get());
+            m_cells[i]->ClearDirty();
+        }
+    }
+
+    void CPACSWingCells::WriteDirtyCPACS(const TixiDocumentHandle& tixiHandle, const std::string& xpath) const
+    {
+        if (m_dirty) {
+            WriteCPACS(tixiHandle, xpath);
+            return;
+        }
+
+        // write modified elements cell
+        tixi::TixiSaveDirtyElements(tixiHandle, xpath + "/cell", m_cells, m_cellsClean);
+    }
+
     const std::vector<unique_ptr<CCPACSWingCell> >& CPACSWingCells::GetCells() const
     {
         return m_cells;
@@ -93,6 +131,7 @@ namespace generated
 
     void CPACSWingCells::RemoveCell(CCPACSWingCell& ref)
     {
+        m_dirty = true;
         for (std::size_t i = 0; i < m_cells.size(); i++) {
             if (m_cells[i].get() == &ref) {
                 m_cells.erase(m_cells.begin() + i);
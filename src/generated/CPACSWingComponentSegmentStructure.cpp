@@ -32,6 +32,7 @@ namespace generated
         : m_uidMgr(uidMgr)
         , m_upperShell(reinterpret_cast<CCPACSWingCSStructure*>(this), m_uidMgr)
         , m_lowerShell(reinterpret_cast<CCPACSWingCSStructure*>(this), m_uidMgr)
+        , m_dirty(true)
     {
         //assert(parent != NULL);
         m_parent = parent;
@@ -42,6 +43,7 @@ namespace generated
         : m_uidMgr(uidMgr)
         , m_upperShell(reinterpret_cast<CCPACSWingCSStructure*>(this), m_uidMgr)
         , m_lowerShell(reinterpret_cast<CCPACSWingCSStructure*>(this), m_uidMgr)
+        , m_dirty(true)
     {
         //assert(parent != NULL);
         m_parent = parent;
@@ -138,6 +140,71 @@ namespace generated
 
     }
 
+    bool CPACSWingComponentSegmentStructure::IsDirty() const
+    {
+        if (m_dirty) {
+            return true;
+        }
+        if (m_upperShell.IsDirty()) {
+            return true;
+        }
+        if (m_lowerShell.IsDirty()) {
+            return true;
+        }
+        if (m_ribsDefinitions && m_ribsDefinitions->IsDirty()) {
+            return true;
+        }
+        if (m_spars && m_spars->IsDirty()) {
+            return true;
+        }
+        return false;
+    }
+
+    void CPACSWingComponentSegmentStructure::ClearDirty()
+    {
+        m_dirty = false;
+        m_upperShell.ClearDirty();
+        m_lowerShell.ClearDirty();
+        if (m_ribsDefinitions) {
+            m_ribsDefinitions->ClearDirty();
+        }
+        if (m_spars) {
+            m_spars->ClearDirty();
+        }
+    }
+
+    void CPACSWingComponentSegmentStructure::WriteDirtyCPACS(const TixiDocumentHandle& tixiHandle, const std::string& xpath) const
+    {
+        if (m_dirty) {
+            WriteCPACS(tixiHandle, xpath);
+            return;
+        }
+
+        // write modified element upperShell
+        if (m_upperShell.IsDirty()) {
+            tixi::TixiCreateElementIfNotExists(tixiHandle, xpath + "/upperShell");
+            m_upperShell.WriteDirtyCPACS(tixiHandle, xpath + "/upperShell");
+        }
+
+        // write modified element lowerShell
+        if (m_lowerShell.IsDirty()) {
+            tixi::TixiCreateElementIfNotExists(tixiHandle, xpath + "/lowerShell");
+            m_lowerShell.WriteDirtyCPACS(tixiHandle, xpath + "/lowerShell");
+        }
+
+        // write modified element ribsDefinitions
+        if (m_ribsDefinitions && m_ribsDefinitions->IsDirty()) {
+            tixi::TixiCreateElementIfNotExists(tixiHandle, xpath + "/ribsDefinitions");
+            m_ribsDefinitions->WriteDirtyCPACS(tixiHandle, xpath + "/ribsDefinitions");
+        }
+
+        // write modified element spars
+        if (m_spars && m_spars->IsDirty()) {
+            tixi::TixiCreateElementIfNotExists(tixiHandle, xpath + "/spars");
+            m_spars->WriteDirtyCPACS(tixiHandle, xpath + "/spars");
+        }
+    }
+
     const CCPACSWingShell& CPACSWingComponentSegmentStructure::GetUpperShell() const
     {
         return m_upperShell;
@@ -187,6 +254,7 @@ namespace generated
 
     void CPACSWingComponentSegmentStructure::RemoveRibsDefinitions()
     {
+        m_dirty = true;
         m_ribsDefinitions = boost::none;
     }
 
@@ -199,6 +267,7 @@ namespace generated
 
     void CPACSWingComponentSegmentStructure::RemoveSpars()
     {
+        m_dirty = true;
         m_spars = boost::none;
     }
 
@@ -91,6 +91,10 @@ namespace generated
         TIGL_EXPORT virtual void ReadCPACS(const TixiDocumentHandle& tixiHandle, const std::string& xpath);
         TIGL_EXPORT virtual void WriteCPACS(const TixiDocumentHandle& tixiHandle, const std::string& xpath) const;
 
+        TIGL_EXPORT virtual bool IsDirty() const;
+        TIGL_EXPORT virtual void ClearDirty();
+        TIGL_EXPORT virtual void WriteDirtyCPACS(const TixiDocumentHandle& tixiHandle, const std::string& xpath) const;
+
         TIGL_EXPORT virtual const CCPACSWingShell& GetUpperShell() const;
         TIGL_EXPORT virtual CCPACSWingShell& GetUpperShell();
 
@@ -120,6 +124,9 @@ namespace generated
         boost::optional<CCPACSWingRibsDefinitions> m_ribsDefinitions;
         boost::optional<CCPACSWingSpars>           m_spars;
 
+        /// Set by the setters, cleared after the object has been read or written
+        bool m_dirty;
+
     private:
 #ifdef HAVE_CPP11
         CPACSWingComponentSegmentStructure(const CPACSWingComponentSegmentStructure&) = delete;
@@ -30,6 +30,7 @@ namespace generated
     CPACSWingElement::CPACSWingElement(CCPACSWingSectionElements* parent, CTiglUIDManager* uidMgr)
         : m_uidMgr(uidMgr)
         , m_transformation(m_uidMgr)
+        , m_dirty(true)
     {
         //assert(parent != NULL);
         m_parent = parent;
@@ -63,8 +64,7 @@ namespace generated
     void CPACSWingElement::ReadCPACS(const TixiDocumentHandle& tixiHandle, const std::string& xpath)
     {
         // read attribute uID
-        if (tixi::TixiCheckAttribute(tixiHandle, xpath, "uID")) {
-            m_uID = tixi::TixiGetAttribute<std::string>(tixiHandle, xpath, "uID");
+        if (tixi::TixiTryGetAttribute(tixiHandle, xpath, "uID", m_uID)) {
             if (m_uID.empty()) {
                 LOG(WARNING) << "Required attribute uID is empty at xpath " << xpath;
             }
@@ -74,8 +74,7 @@ namespace generated
         }
 
         // read element name
-        if (tixi::TixiCheckElement(tixiHandle, xpath + "/name")) {
-            m_name = tixi::TixiGetElement<std::string>(tixiHandle, xpath + "/name");
+        if (tixi::TixiTryGetElement(tixiHandle, xpath + "/name", m_name)) {
             if (m_name.empty()) {
                 LOG(WARNING) << "Required element name is empty at xpath " << xpath;
             }
@@ -85,16 +84,14 @@ namespace generated
         }
 
         // read element description
-        if (tixi::TixiCheckElement(tixiHandle, xpath + "/description")) {
-            m_description = tixi::TixiGetElement<std::string>(tixiHandle, xpath + "/description");
+        if (tixi::TixiTryGetElement(tixiHandle, xpath + "/description", m_description)) {
             if (m_description->empty()) {
                 LOG(WARNING) << "Optional element description is present but empty at xpath " << xpath;
             }
         }
 
         // read element airfoilUID
-        if (tixi::TixiCheckElement(tixiHandle, xpath + "/airfoilUID")) {
-            m_airfoilUID = tixi::TixiGetElement<std::string>(tixiHandle, xpath + "/airfoilUID");
+        if (tixi::TixiTryGetElement(tixiHandle, xpath + "/airfoilUID", m_airfoilUID)) {
             if (m_airfoilUID.empty()) {
                 LOG(WARNING) << "Required element airfoilUID is empty at xpath " << xpath;
             }
@@ -144,6 +141,37 @@ namespace generated
 
     }
 
+    bool CPACSWingElement::IsDirty() const
+    {
+        if (m_dirty) {
+            return true;
+        }
+        if (m_transformation.IsDirty()) {
+            return true;
+        }
+        return false;
+    }
+
+    void CPACSWingElement::ClearDirty()
+    {
+        m_dirty = false;
+        m_transformation.ClearDirty();
+    }
+
+    void CPACSWingElement::WriteDirtyCPACS(const TixiDocumentHandle& tixiHandle, const std::string& xpath) const
+    {
+        if (m_dirty) {
+            WriteCPACS(tixiHandle, xpath);
+            return;
+        }
+
+        // write modified element transformation
+        if (m_transformation.IsDirty()) {
+            tixi::TixiCreateElementIfNotExists(tixiHandle, xpath + "/transformation");
+            m_transformation.WriteDirtyCPACS(tixiHandle, xpath + "/transformation");
+        }
+    }
+
     const std::string& CPACSWingElement::GetUID() const
     {
         return m_uID;
@@ -151,6 +179,7 @@ namespace generated
 
     void CPACSWingElement::SetUID(const std::string& value)
     {
+        m_dirty = true;
         if (m_uidMgr) {
             m_uidMgr->TryUnregisterObject(m_uID);
             m_uidMgr->RegisterObject(value, *this);
@@ -165,6 +194,7 @@ namespace generated
 
     void CPACSWingElement::SetName(const std::string& value)
     {
+        m_dirty = true;
         m_name = value;
     }
 
@@ -175,6 +205,7 @@ namespace generated
 
     void CPACSWingElement::SetDescription(const boost::optional<std::string>& value)
     {
+        m_dirty = true;
         m_description = value;
     }
 
@@ -185,6 +216,7 @@ namespace generated
 
     void CPACSWingElement::SetAirfoilUID(const std::string& value)
     {
+        m_dirty = true;
         m_airfoilUID = value;
     }
 
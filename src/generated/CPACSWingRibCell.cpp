@@ -28,6 +28,7 @@ namespace generated
     CPACSWingRibCell::CPACSWingRibCell(CTiglUIDManager* uidMgr)
         : m_uidMgr(uidMgr)
         , m_ribRotation(m_uidMgr)
+        , m_dirty(true)
     {
     }
 
@@ -49,8 +50,7 @@ namespace generated
     void CPACSWingRibCell::ReadCPACS(const TixiDocumentHandle& tixiHandle, const std::string& xpath)
     {
         // read attribute uID
-        if (tixi::TixiCheckAttribute(tixiHandle, xpath, "uID")) {
-            m_uID = tixi::TixiGetAttribute<std::string>(tixiHandle, xpath, "uID");
+        if (tixi::TixiTryGetAttribute(tixiHandle, xpath, "uID", m_uID)) {
             if (m_uID.empty()) {
                 LOG(WARNING) << "Required attribute uID is empty at xpath " << xpath;
             }
@@ -60,8 +60,7 @@ namespace generated
         }
 
         // read element fromRib
-        if (tixi::TixiCheckElement(tixiHandle, xpath + "/fromRib")) {
-            m_fromRib = tixi::TixiGetElement<std::string>(tixiHandle, xpath + "/fromRib");
+        if (tixi::TixiTryGetElement(tixiHandle, xpath + "/fromRib", m_fromRib)) {
             if (m_fromRib.empty()) {
                 LOG(WARNING) << "Required element fromRib is empty at xpath " << xpath;
             }
@@ -71,8 +70,7 @@ namespace generated
         }
 
         // read element toRib
-        if (tixi::TixiCheckElement(tixiHandle, xpath + "/toRib")) {
-            m_toRib = tixi::TixiGetElement<std::string>(tixiHandle, xpath + "/toRib");
+        if (tixi::TixiTryGetElement(tixiHandle, xpath + "/toRib", m_toRib)) {
             if (m_toRib.empty()) {
                 LOG(WARNING) << "Required element toRib is empty at xpath " << xpath;
             }
@@ -147,6 +145,67 @@ namespace generated
 
     }
 
+    bool CPACSWingRibCell::IsDirty() const
+    {
+        if (m_dirty) {
+            return true;
+        }
+        if (m_ribRotation.IsDirty()) {
+            return true;
+        }
+        if (m_material.IsDirty()) {
+            return true;
+        }
+        if (m_upperCap.IsDirty()) {
+            return true;
+        }
+        if (m_lowerCap.IsDirty()) {
+            return true;
+        }
+        return false;
+    }
+
+    void CPACSWingRibCell::ClearDirty()
+    {
+        m_dirty = false;
+        m_ribRotation.ClearDirty();
+        m_material.ClearDirty();
+        m_upperCap.ClearDirty();
+        m_lowerCap.ClearDirty();
+    }
+
+    void CPACSWingRibCell::WriteDirtyCPACS(const TixiDocumentHandle& tixiHandle, const std::string& xpath) const
+    {
+        if (m_dirty) {
+            WriteCPACS(tixiHandle, xpath);
+            return;
+        }
+
+        // write modified element ribRotation
+        if (m_ribRotation.IsDirty()) {
+            tixi::TixiCreateElementIfNotExists(tixiHandle, xpath + "/ribRotation");
+            m_ribRotation.WriteDirtyCPACS(tixiHandle, xpath + "/ribRotation");
+        }
+
+        // write modified element material
+        if (m_material.IsDirty()) {
+            tixi::TixiCreateElementIfNotExists(tixiHandle, xpath + "/material");
+            m_material.WriteDirtyCPACS(tixiHandle, xpath + "/material");
+        }
+
+        // write modified element upperCap
+        if (m_upperCap.IsDirty()) {
+            tixi::TixiCreateElementIfNotExists(tixiHandle, xpath + "/upperCap");
+            m_upperCap.WriteDirtyCPACS(tixiHandle, xpath + "/upperCap");
+        }
+
+        // write modified element lowerCap
+        if (m_lowerCap.IsDirty()) {
+            tixi::TixiCreateElementIfNotExists(tixiHandle, xpath + "/lowerCap");
+            m_lowerCap.WriteDirtyCPACS(tixiHandle, xpath + "/lowerCap");
+        }
+    }
+
     const std::string& CPACSWingRibCell::GetUID() const
     {
         return m_uID;
@@ -154,6 +213,7 @@ namespace generated
 
     void CPACSWingRibCell::SetUID(const std::string& value)
     {
+        m_dirty = true;
         if (m_uidMgr) {
             m_uidMgr->TryUnregisterObject(m_uID);
             m_uidMgr->RegisterObject(value, *this);
@@ -168,6 +228,7 @@ namespace generated
 
     void CPACSWingRibCell::SetFromRib(const std::string& value)
     {
+        m_dirty = true;
         m_fromRib = value;
     }
 
@@ -178,6 +239,7 @@ namespace generated
 
     void CPACSWingRibCell::SetToRib(const std::string& value)
     {
+        m_dirty = true;
         m_toRib = value;
     }
 
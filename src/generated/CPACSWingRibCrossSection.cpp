@@ -29,6 +29,7 @@ namespace generated
 {
     CPACSWingRibCrossSection::CPACSWingRibCrossSection(CCPACSWingRibsDefinition* parent, CTiglUIDManager* uidMgr)
         : m_uidMgr(uidMgr)
+        , m_dirty(true)
     {
         //assert(parent != NULL);
         m_parent = parent;
@@ -166,6 +167,85 @@ namespace generated
 
     }
 
+    bool CPACSWingRibCrossSection::IsDirty() const
+    {
+        if (m_dirty) {
+            return true;
+        }
+        if (m_material.IsDirty()) {
+            return true;
+        }
+        if (m_ribRotation && m_ribRotation->IsDirty()) {
+            return true;
+        }
+        if (m_ribCell && m_ribCell->IsDirty()) {
+            return true;
+        }
+        if (m_upperCap && m_upperCap->IsDirty()) {
+            return true;
+        }
+        if (m_lowerCap && m_lowerCap->IsDirty()) {
+            return true;
+        }
+        return false;
+    }
+
+    void CPACSWingRibCrossSection::ClearDirty()
+    {
+        m_dirty = false;
+        m_material.ClearDirty();
+        if (m_ribRotation) {
+            m_ribRotation->ClearDirty();
+        }
+        if (m_ribCell) {
+            m_ribCell->ClearDirty();
+        }
+        if (m_upperCap) {
+            m_upperCap->ClearDirty();
+        }
+        if (m_lowerCap) {
+            m_lowerCap->ClearDirty();
+        }
+    }
+
+    void CPACSWingRibCrossSection::WriteDirtyCPACS(const TixiDocumentHandle& tixiHandle, const std::string& xpath) const
+    {
+        if (m_dirty) {
+            WriteCPACS(tixiHandle, xpath);
+            return;
+        }
+
+        // write modified element material
+        if (m_material.IsDirty()) {
+            tixi::TixiCreateElementIfNotExists(tixiHandle, xpath + "/material");
+            m_material.WriteDirtyCPACS(tixiHandle, xpath + "/material");
+        }
+
+        // write modified element ribRotation
+        if (m_ribRotation && m_ribRotation->IsDirty()) {
+            tixi::TixiCreateElementIfNotExists(tixiHandle, xpath + "/ribRotation");
+            m_ribRotation->WriteDirtyCPACS(tixiHandle, xpath + "/ribRotation");
+        }
+
+        // write modified element ribCell
+        if (m_ribCell && m_ribCell->IsDirty()) {
+            tixi::TixiCreateElementIfNotExists(tixiHandle, xpath + "/ribCell");
+            m_ribCell->WriteDirtyCPACS(tixiHandle, xpath + "/ribCell");
+        }
+
+        // write modified element upperCap
+        if (m_upperCap && m_upperCap->IsDirty()) {
+            tixi::TixiCreateElementIfNotExists(tixiHandle, xpath + "/upperCap");
+            m_upperCap->WriteDirtyCPACS(tixiHandle, xpath + "/upperCap");
+        }
+
+        // write modified element lowerCap
+        if (m_lowerCap && m_lowerCap->IsDirty()) {
+            tixi::TixiCreateElementIfNotExists(tixiHandle, xpath + "/lowerCap");
+            m_lowerCap->WriteDirtyCPACS(tixiHandle, xpath + "/lowerCap");
+        }
+    }
+
     const CCPACSMaterialDefinition& CPACSWingRibCrossSection::GetMaterial() const
     {
         return m_material;
@@ -225,6 +305,7 @@ namespace generated
 
     void CPACSWingRibCrossSection::RemoveRibRotation()
     {
+        m_dirty = true;
         m_ribRotation = boost::none;
     }
 
@@ -237,6 +318,7 @@ namespace generated
 
     void CPACSWingRibCrossSection::RemoveRibCell()
     {
+        m_dirty = true;
         m_ribCell = boost::none;
     }
 
@@ -249,6 +331,7 @@ namespace generated
 
     void CPACSWingRibCrossSection::RemoveUpperCap()
     {
+        m_dirty = true;
         m_upperCap = boost::none;
     }
 
@@ -261,6 +344,7 @@ namespace generated
 
     void CPACSWingRibCrossSection::RemoveLowerCap()
     {
+        m_dirty = true;
         m_lowerCap = boost::none;
     }
 
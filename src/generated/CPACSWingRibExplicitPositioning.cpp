@@ -29,6 +29,7 @@ namespace generated
     CPACSWingRibExplicitPositioning::CPACSWingRibExplicitPositioning(CCPACSWingRibsDefinition* parent)
         : m_etaStart(0)
         , m_etaEnd(0)
+        , m_dirty(true)
     {
         //assert(parent != NULL);
         m_parent = parent;
@@ -51,8 +52,7 @@ namespace generated
     void CPACSWingRibExplicitPositioning::ReadCPACS(const TixiDocumentHandle& tixiHandle, const std::string& xpath)
     {
         // read element startReference
-        if (tixi::TixiCheckElement(tixiHandle, xpath + "/startReference")) {
-            m_startReference = tixi::TixiGetElement<std::string>(tixiHandle, xpath + "/startReference");
+        if (tixi::TixiTryGetElement(tixiHandle, xpath + "/startReference", m_startReference)) {
             if (m_startReference.empty()) {
                 LOG(WARNING) << "Required element startReference is empty at xpath " << xpath;
             }
@@ -62,16 +62,12 @@ namespace generated
         }
 
         // read element etaStart
-        if (tixi::TixiCheckElement(tixiHandle, xpath + "/etaStart")) {
-            m_etaStart = tixi::TixiGetElement<double>(tixiHandle, xpath + "/etaStart");
-        }
-        else {
+        if (!tixi::TixiTryGetElement(tixiHandle, xpath + "/etaStart", m_etaStart)) {
             LOG(ERROR) << "Required element etaStart is missing at xpath " << xpath;
         }
 
         // read element endReference
-        if (tixi::TixiCheckElement(tixiHandle, xpath + "/endReference")) {
-            m_endReference = tixi::TixiGetElement<std::string>(tixiHandle, xpath + "/endReference");
+        if (tixi::TixiTryGetElement(tixiHandle, xpath + "/endReference", m_endReference)) {
             if (m_endReference.empty()) {
                 LOG(WARNING) << "Required element endReference is empty at xpath " << xpath;
             }
@@ -81,10 +77,7 @@ namespace generated
         }
 
         // read element etaEnd
-        if (tixi::TixiCheckElement(tixiHandle, xpath + "/etaEnd")) {
-            m_etaEnd = tixi::TixiGetElement<double>(tixiHandle, xpath + "/etaEnd");
-        }
-        else {
+        if (!tixi::TixiTryGetElement(tixiHandle, xpath + "/etaEnd", m_etaEnd)) {
             LOG(ERROR) << "Required element etaEnd is missing at xpath " << xpath;
         }
 
@@ -110,6 +103,23 @@ namespace generated
 
     }
 
+    bool CPACSWingRibExplicitPositioning::IsDirty() const
+    {
+        return m_dirty;
+    }
+
+    void CPACSWingRibExplicitPositioning::ClearDirty()
+    {
+        m_dirty = false;
+    }
+
+    void CPACSWingRibExplicitPositioning::WriteDirtyCPACS(const TixiDocumentHandle& tixiHandle, const std::string& xpath) const
+    {
+        if (m_dirty) {
+            WriteCPACS(tixiHandle, xpath);
+        }
+    }
+
     const std::string& CPACSWingRibExplicitPositioning::GetStartReference() const
     {
         return m_startReference;
@@ -117,6 +127,7 @@ namespace generated
 
     void CPACSWingRibExplicitPositioning::SetStartReference(const std::string& value)
     {
+        m_dirty = true;
         m_startReference = value;
     }
 
@@ -127,6 +138,7 @@ namespace generated
 
     void CPACSWingRibExplicitPositioning::SetEtaStart(const double& value)
     {
+        m_dirty = true;
         m_etaStart = value;
     }
 
@@ -137,6 +149,7 @@ namespace generated
 
     void CPACSWingRibExplicitPositioning::SetEndReference(const std::string& value)
     {
+        m_dirty = true;
         m_endReference = value;
     }
 
@@ -147,6 +160,7 @@ namespace generated
 
     void CPACSWingRibExplicitPositioning::SetEtaEnd(const double& value)
     {
+        m_dirty = true;
         m_etaEnd = value;
     }
 
@@ -30,6 +30,7 @@ namespace generated
     CPACSWingRibsDefinition::CPACSWingRibsDefinition(CCPACSWingRibsDefinitions* parent, CTiglUIDManager* uidMgr)
         : m_uidMgr(uidMgr)
         , m_ribCrossSection(reinterpret_cast<CCPACSWingRibsDefinition*>(this), m_uidMgr)
+        , m_dirty(true)
     {
         //assert(parent != NULL);
         m_parent = parent;
@@ -63,16 +64,14 @@ namespace generated
     void CPACSWingRibsDefinition::ReadCPACS(const TixiDocumentHandle& tixiHandle, const std::string& xpath)
     {
         // read attribute uID
-        if (tixi::TixiCheckAttribute(tixiHandle, xpath, "uID")) {
-            m_uID = tixi::TixiGetAttribute<std::string>(tixiHandle, xpath, "uID");
+        if (tixi::TixiTryGetAttribute(tixiHandle, xpath, "uID", m_uID)) {
             if (m_uID->empty()) {
                 LOG(WARNING) << "Optional attribute uID is present but empty at xpath " << xpath;
             }
         }
 
         // read element name
-        if (tixi::TixiCheckElement(tixiHandle, xpath + "/name")) {
-            m_name = tixi::TixiGetElement<std::string>(tixiHandle, xpath + "/name");
+        if (tixi::TixiTryGetElement(tixiHandle, xpath + "/name", m_name)) {
             if (m_name.empty()) {
                 LOG(WARNING) << "Required element name is empty at xpath " << xpath;
             }
@@ -82,8 +81,7 @@ namespace generated
         }
 
         // read element description
-        if (tixi::TixiCheckElement(tixiHandle, xpath + "/description")) {
-            m_description = tixi::TixiGetElement<std::string>(tixiHandle, xpath + "/description");
+        if (tixi::TixiTryGetElement(tixiHandle, xpath + "/description", m_description)) {
             if (m_description->empty()) {
                 LOG(WARNING) << "Optional element description is present but empty at xpath " << xpath;
             }
@@ -180,6 +178,61 @@ namespace generated
 
     }
 
+    bool CPACSWingRibsDefinition::IsDirty() const
+    {
+        if (m_dirty) {
+            return true;
+        }
+        if (m_ribCrossSection.IsDirty()) {
+            return true;
+        }
+        if (m_ribsPositioning_choice1 && m_ribsPositioning_choice1->IsDirty()) {
+            return true;
+        }
+        if (m_ribExplicitPositioning_choice2 && m_ribExplicitPositioning_choice2->IsDirty()) {
+            return true;
+        }
+        return false;
+    }
+
+    void CPACSWingRibsDefinition::ClearDirty()
+    {
+        m_dirty = false;
+        m_ribCrossSection.ClearDirty();
+        if (m_ribsPositioning_choice1) {
+            m_ribsPositioning_choice1->ClearDirty();
+        }
+        if (m_ribExplicitPositioning_choice2) {
+            m_ribExplicitPositioning_choice2->ClearDirty();
+        }
+    }
+
+    void CPACSWingRibsDefinition::WriteDirtyCPACS(const TixiDocumentHandle& tixiHandle, const std::string& xpath) const
+    {
+        if (m_dirty) {
+            WriteCPACS(tixiHandle, xpath);
+            return;
+        }
+
+        // write modified element ribCrossSection
+        if (m_ribCrossSection.IsDirty()) {
+            tixi::TixiCreateElementIfNotExists(tixiHandle, xpath + "/ribCrossSection");
+            m_ribCrossSection.WriteDirtyCPACS(tixiHandle, xpath + "/ribCrossSection");
+        }
+
+        // write modified element ribsPositioning
+        if (m_ribsPositioning_choice1 && m_ribsPositioning_choice1->IsDirty()) {
+            tixi::TixiCreateElementIfNotExists(tixiHandle, xpath + "/ribsPositioning");
+            m_ribsPositioning_choice1->WriteDirtyCPACS(tixiHandle, xpath + "/ribsPositioning");
+        }
+
+        // write modified element ribExplicitPositioning
+        if (m_ribExplicitPositioning_choice2 && m_ribExplicitPositioning_choice2->IsDirty()) {
+            tixi::TixiCreateElementIfNotExists(tixiHandle, xpath + "/ribExplicitPositioning");
+            m_ribExplicitPositioning_choice2->WriteDirtyCPACS(tixiHandle, xpath + "/ribExplicitPositioning");
+        }
+    }
+
     bool CPACSWingRibsDefinition::ValidateChoices() const
     {
         return
@@ -217,6 +270,7 @@ namespace generated
 
     void CPACSWingRibsDefinition::SetUID(const boost::optional<std::string>& value)
     {
+        m_dirty = true;
         if (m_uidMgr) {
             if (m_uID) m_uidMgr->TryUnregisterObject(*m_uID);
             if (value) m_uidMgr->RegisterObject(*value, *this);
@@ -231,6 +285,7 @@ namespace generated
 
     void CPACSWingRibsDefinition::SetName(const std::string& value)
     {
+        m_dirty = true;
         m_name = value;
     }
 
@@ -241,6 +296,7 @@ namespace generated
 
     void CPACSWingRibsDefinition::SetDescription(const boost::optional<std::string>& value)
     {
+        m_dirty = true;
         m_description = value;
     }
 
@@ -283,6 +339,7 @@ namespace generated
 
     void CPACSWingRibsDefinition::RemoveRibsPositioning_choice1()
     {
+        m_dirty = true;
         m_ribsPositioning_choice1 = boost::none;
     }
 
@@ -295,6 +352,7 @@ namespace generated
 
     void CPACSWingRibsDefinition::RemoveRibExplicitPositioning_choice2()
     {
+        m_dirty = true;
         m_ribExplicitPositioning_choice2 = boost::none;
     }
 
@@ -30,6 +30,7 @@ namespace generated
 {
     CPACSWingRibsDefinitions::CPACSWingRibsDefinitions(CCPACSWingCSStructure* parent, CTiglUIDManager* uidMgr)
         : m_uidMgr(uidMgr)
+        , m_dirty(true)
     {
         //assert(parent != NULL);
         m_parent = parent;
@@ -75,6 +76,43 @@ namespace generated
 
     }
 
+    bool CPACSWingRibsDefinitions::IsDirty() const
+    {
+        if (m_dirty) {
+            return true;
+        }
+        if (m_ribsDefinitions.size() != m_ribsDefinitionsClean.size()) {
+            return true;
+        }
+        for (std::size_t i = 0; i < m_ribsDefinitions.size(); i++) {
+            if (m_ribsDefinitions[i].get() != m_ribsDefinitionsClean[i] || m_ribsDefinitions[i]->IsDirty()) {
+                return true;
+            }
+        }
+        return false;
+    }
+
+    void CPACSWingRibsDefinitions::ClearDirty()
+    {
+        m_dirty = false;
+        m_ribsDefinitionsClean.clear();
+        for (std::size_t i = 0; i < m_ribsDefinitions.size(); i++) {
+            m_ribsDefinitionsClean.push_back(m_ribsDefinitions[i].get());
+            m_ribsDefinitions[i]->ClearDirty();
+        }
+    }
+
+    void CPACSWingRibsDefinitions::WriteDirtyCPACS(const TixiDocumentHandle& tixiHandle, const std::string& xpath) const
+    {
+        if (m_dirty) {
+            WriteCPACS(tixiHandle, xpath);
+            return;
+        }
+
+        // write modified elements ribsDefinition
+        tixi::TixiSaveDirtyElements(tixiHandle, xpath + "/ribsDefinition", m_ribsDefinitions, m_ribsDefinitionsClean);
+    }
+
     const std::vector<unique_ptr<CCPACSWingRibsDefinition> >& CPACSWingRibsDefinitions::GetRibsDefinitions() const
     {
         return m_ribsDefinitions;
@@ -93,6 +131,7 @@ namespace generated
 
     void CPACSWingRibsDefinitions::RemoveRibsDefinition(CCPACSWingRibsDefinition& ref)
     {
+        m_dirty = true;
         for (std::size_t i = 0; i < m_ribsDefinitions.size(); i++) {
             if (m_ribsDefinitions[i].get() == &ref) {
                 m_ribsDefinitions.erase(m_ribsDefinitions.begin() + i);
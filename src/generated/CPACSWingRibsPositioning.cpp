@@ -28,6 +28,7 @@ namespace generated
 {
     CPACSWingRibsPositioning::CPACSWingRibsPositioning(CCPACSWingRibsDefinition* parent)
         : m_ribRotation(reinterpret_cast<CCPACSWingRibsPositioning*>(this))
+        , m_dirty(true)
     {
         //assert(parent != NULL);
         m_parent = parent;
@@ -50,8 +51,7 @@ namespace generated
     void CPACSWingRibsPositioning::ReadCPACS(const TixiDocumentHandle& tixiHandle, const std::string& xpath)
     {
         // read element ribReference
-        if (tixi::TixiCheckElement(tixiHandle, xpath + "/ribReference")) {
-            m_ribReference = tixi::TixiGetElement<std::string>(tixiHandle, xpath + "/ribReference");
+        if (tixi::TixiTryGetElement(tixiHandle, xpath + "/ribReference", m_ribReference)) {
             if (m_ribReference.empty()) {
                 LOG(WARNING) << "Required element ribReference is empty at xpath " << xpath;
             }
@@ -61,8 +61,7 @@ namespace generated
         }
 
         // read element ribStart
-        if (tixi::TixiCheckElement(tixiHandle, xpath + "/ribStart")) {
-            m_ribStart = tixi::TixiGetElement<std::string>(tixiHandle, xpath + "/ribStart");
+        if (tixi::TixiTryGetElement(tixiHandle, xpath + "/ribStart", m_ribStart)) {
             if (m_ribStart.empty()) {
                 LOG(WARNING) << "Required element ribStart is empty at xpath " << xpath;
             }
@@ -72,8 +71,7 @@ namespace generated
         }
 
         // read element ribEnd
-        if (tixi::TixiCheckElement(tixiHandle, xpath + "/ribEnd")) {
-            m_ribEnd = tixi::TixiGetElement<std::string>(tixiHandle, xpath + "/ribEnd");
+        if (tixi::TixiTryGetElement(tixiHandle, xpath + "/ribEnd", m_ribEnd)) {
             if (m_ribEnd.empty()) {
                 LOG(WARNING) << "Required element ribEnd is empty at xpath " << xpath;
             }
@@ -99,56 +97,44 @@ namespace generated
         }
 
         // read element etaStart
-        if (tixi::TixiCheckElement(tixiHandle, xpath + "/etaStart")) {
-            m_etaStart_choice1 = tixi::TixiGetElement<double>(tixiHandle, xpath + "/etaStart");
-        }
+        tixi::TixiTryGetElement(tixiHandle, xpath + "/etaStart", m_etaStart_choice1);
 
         // read element elementStartUID
-        if (tixi::TixiCheckElement(tixiHandle, xpath + "/elementStartUID")) {
-            m_elementStartUID_choice2 = tixi::TixiGetElement<std::string>(tixiHandle, xpath + "/elementStartUID");
+        if (tixi::TixiTryGetElement(tixiHandle, xpath + "/elementStartUID", m_elementStartUID_choice2)) {
             if (m_elementStartUID_choice2->empty()) {
                 LOG(WARNING) << "Optional element elementStartUID is present but empty at xpath " << xpath;
             }
         }
 
         // read element sparPositionStartUID
-        if (tixi::TixiCheckElement(tixiHandle, xpath + "/sparPositionStartUID")) {
-            m_sparPositionStartUID_choice3 = tixi::TixiGetElement<std::string>(tixiHandle, xpath + "/sparPositionStartUID");
+        if (tixi::TixiTryGetElement(tixiHandle, xpath + "/sparPositionStartUID", m_sparPositionStartUID_choice3)) {
             if (m_sparPositionStartUID_choice3->empty()) {
                 LOG(WARNING) << "Optional element sparPositionStartUID is present but empty at xpath " << xpath;
             }
         }
 
         // read element etaEnd
-        if (tixi::TixiCheckElement(tixiHandle, xpath + "/etaEnd")) {
-            m_etaEnd_choice1 = tixi::TixiGetElement<double>(tixiHandle, xpath + "/etaEnd");
-        }
+        tixi::TixiTryGetElement(tixiHandle, xpath + "/etaEnd", m_etaEnd_choice1);
 
         // read element elementEndUID
-        if (tixi::TixiCheckElement(tixiHandle, xpath + "/elementEndUID")) {
-            m_elementEndUID_choice2 = tixi::TixiGetElement<std::string>(tixiHandle, xpath + "/elementEndUID");
+        if (tixi::TixiTryGetElement(tixiHandle, xpath + "/elementEndUID", m_elementEndUID_choice2)) {
             if (m_elementEndUID_choice2->empty()) {
                 LOG(WARNING) << "Optional element elementEndUID is present but empty at xpath " << xpath;
             }
         }
 
         // read element sparPositionEndUID
-        if (tixi::TixiCheckElement(tixiHandle, xpath + "/sparPositionEndUID")) {
-            m_sparPositionEndUID_choice3 = tixi::TixiGetElement<std::string>(tixiHandle, xpath + "/sparPositionEndUID");
+        if (tixi::TixiTryGetElement(tixiHandle, xpath + "/sparPositionEndUID", m_sparPositionEndUID_choice3)) {
             if (m_sparPositionEndUID_choice3->empty()) {
                 LOG(WARNING) << "Optional element sparPositionEndUID is present but empty at xpath " << xpath;
             }
         }
 
         // read element spacing
-        if (tixi::TixiCheckElement(tixiHandle, xpath + "/spacing")) {
-            m_spacing_choice1 = tixi::TixiGetElement<double>(tixiHandle, xpath + "/spacing");
-        }
+        tixi::TixiTryGetElement(tixiHandle, xpath + "/spacing", m_spacing_choice1);
 
         // read element numberOfRibs
-        if (tixi::TixiCheckElement(tixiHandle, xpath + "/numberOfRibs")) {
-            m_numberOfRibs_choice2 = tixi::TixiGetElement<int>(tixiHandle, xpath + "/numberOfRibs");
-        }
+        tixi::TixiTryGetElement(tixiHandle, xpath + "/numberOfRibs", m_numberOfRibs_choice2);
 
         if (!ValidateChoices()) {
             LOG(ERROR) << "Invalid choice configuration at xpath " << xpath;
@@ -267,6 +253,37 @@ namespace generated
 
     }
 
+    bool CPACSWingRibsPositioning::IsDirty() const
+    {
+        if (m_dirty) {
+            return true;
+        }
+        if (m_ribRotation.IsDirty()) {
+            return true;
+        }
+        return false;
+    }
+
+    void CPACSWingRibsPositioning::ClearDirty()
+    {
+        m_dirty = false;
+        m_ribRotation.ClearDirty();
+    }
+
+    void CPACSWingRibsPositioning::WriteDirtyCPACS(const TixiDocumentHandle& tixiHandle, const std::string& xpath) const
+    {
+        if (m_dirty) {
+            WriteCPACS(tixiHandle, xpath);
+            return;
+        }
+
+        // write modified element ribRotation
+        if (m_ribRotation.IsDirty()) {
+            tixi::TixiCreateElementIfNotExists(tixiHandle, xpath + "/ribRotation");
+            m_ribRotation.WriteDirtyCPACS(tixiHandle, xpath + "/ribRotation");
+        }
+    }
+
     bool CPACSWingRibsPositioning::ValidateChoices() const
     {
         return
@@ -382,6 +399,7 @@ namespace generated
 
     void CPACSWingRibsPositioning::SetRibReference(const std::string& value)
     {
+        m_dirty = true;
         m_ribReference = value;
     }
 
@@ -392,6 +410,7 @@ namespace generated
 
     void CPACSWingRibsPositioning::SetRibStart(const std::string& value)
     {
+        m_dirty = true;
         m_ribStart = value;
     }
 
@@ -402,6 +421,7 @@ namespace generated
 
     void CPACSWingRibsPositioning::SetRibEnd(const std::string& value)
     {
+        m_dirty = true;
         m_ribEnd = value;
     }
 
@@ -412,6 +432,7 @@ namespace generated
 
     void CPACSWingRibsPositioning::SetRibCrossingBehaviour(const CPACSRibCrossingBehaviour& value)
     {
+        m_dirty = true;
         m_ribCrossingBehaviour = value;
     }
 
@@ -432,6 +453,7 @@ namespace generated
 
     void CPACSWingRibsPositioning::SetEtaStart_choice1(const boost::optional<double>& value)
     {
+        m_dirty = true;
         m_etaStart_choice1 = value;
     }
 
@@ -442,6 +464,7 @@ namespace generated
 
     void CPACSWingRibsPositioning::SetElementStartUID_choice2(const boost::optional<std::string>& value)
     {
+        m_dirty = true;
         m_elementStartUID_choice2 = value;
     }
 
@@ -452,6 +475,7 @@ namespace generated
 
     void CPACSWingRibsPositioning::SetSparPositionStartUID_choice3(const boost::optional<std::string>& value)
     {
+        m_dirty = true;
         m_sparPositionStartUID_choice3 = value;
     }
 
@@ -462,6 +486,7 @@ namespace generated
 
     void CPACSWingRibsPositioning::SetEtaEnd_choice1(const boost::optional<double>& value)
     {
+        m_dirty = true;
         m_etaEnd_choice1 = value;
     }
 
@@ -472,6 +497,7 @@ namespace generated
 
     void CPACSWingRibsPositioning::SetElementEndUID_choice2(const boost::optional<std::string>& value)
     {
+        m_dirty = true;
         m_elementEndUID_choice2 = value;
     }
 
@@ -482,6 +508,7 @@ namespace generated
 
     void CPACSWingRibsPositioning::SetSparPositionEndUID_choice3(const boost::optional<std::string>& value)
     {
+        m_dirty = true;
         m_sparPositionEndUID_choice3 = value;
     }
 
@@ -492,6 +519,7 @@ namespace generated
 
     void CPACSWingRibsPositioning::SetSpacing_choice1(const boost::optional<double>& value)
     {
+        m_dirty = true;
         m_spacing_choice1 = value;
     }
 
@@ -502,6 +530,7 @@ namespace generated
 
     void CPACSWingRibsPositioning::SetNumberOfRibs_choice2(const boost::optional<int>& value)
     {
+        m_dirty = true;
         m_numberOfRibs_choice2 = value;
     }
 
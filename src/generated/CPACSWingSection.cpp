@@ -31,6 +31,7 @@ namespace generated
         : m_uidMgr(uidMgr)
         , m_transformation(m_uidMgr)
         , m_elements(reinterpret_cast<CCPACSWingSection*>(this), m_uidMgr)
+        , m_dirty(true)
     {
         //assert(parent != NULL);
         m_parent = parent;
@@ -64,8 +65,7 @@ namespace generated
     void CPACSWingSection::ReadCPACS(const TixiDocumentHandle& tixiHandle, const std::string& xpath)
     {
         // read attribute uID
-        if (tixi::TixiCheckAttribute(tixiHandle, xpath, "uID")) {
-            m_uID = tixi::TixiGetAttribute<std::string>(tixiHandle, xpath, "uID");
+        if (tixi::TixiTryGetAttribute(tixiHandle, xpath, "uID", m_uID)) {
             if (m_uID.empty()) {
                 LOG(WARNING) << "Required attribute uID is empty at xpath " << xpath;
             }
@@ -75,8 +75,7 @@ namespace generated
         }
 
         // read element name
-        if (tixi::TixiCheckElement(tixiHandle, xpath + "/name")) {
-            m_name = tixi::TixiGetElement<std::string>(tixiHandle, xpath + "/name");
+        if (tixi::TixiTryGetElement(tixiHandle, xpath + "/name", m_name)) {
             if (m_name.empty()) {
                 LOG(WARNING) << "Required element name is empty at xpath " << xpath;
             }
@@ -86,8 +85,7 @@ namespace generated
         }
 
         // read element description
-        if (tixi::TixiCheckElement(tixiHandle, xpath + "/description")) {
-            m_description = tixi::TixiGetElement<std::string>(tixiHandle, xpath + "/description");
+        if (tixi::TixiTryGetElement(tixiHandle, xpath + "/description", m_description)) {
             if (m_description->empty()) {
                 LOG(WARNING) << "Optional element description is present but empty at xpath " << xpath;
             }
@@ -142,6 +140,47 @@ namespace generated
 
     }
 
+    bool CPACSWingSection::IsDirty() const
+    {
+        if (m_dirty) {
+            return true;
+        }
+        if (m_transformation.IsDirty()) {
+            return true;
+        }
+        if (m_elements.IsDirty()) {
+            return true;
+        }
+        return false;
+    }
+
+    void CPACSWingSection::ClearDirty()
+    {
+        m_dirty = false;
+        m_transformation.ClearDirty();
+        m_elements.ClearDirty();
+    }
+
+    void CPACSWingSection::WriteDirtyCPACS(const TixiDocumentHandle& tixiHandle, const std::string& xpath) const
+    {
+        if (m_dirty) {
+            WriteCPACS(tixiHandle, xpath);
+            return;
+        }
+
+        // write modified element transformation
+        if (m_transformation.IsDirty()) {
+            tixi::TixiCreateElementIfNotExists(tixiHandle, xpath + "/transformation");
+            m_transformation.WriteDirtyCPACS(tixiHandle, xpath + "/transformation");
+        }
+
+        // write modified element elements
+        if (m_elements.IsDirty()) {
+            tixi::TixiCreateElementIfNotExists(tixiHandle, xpath + "/elements");
+            m_elements.WriteDirtyCPACS(tixiHandle, xpath + "/elements");
+        }
+    }
+
     const std::string& CPACSWingSection::GetUID() const
     {
         return m_uID;
@@ -149,6 +188,7 @@ namespace generated
 
     void CPACSWingSection::SetUID(const std::string& value)
     {
+        m_dirty = true;
         if (m_uidMgr) {
             m_uidMgr->TryUnregisterObject(m_uID);
             m_uidMgr->RegisterObject(value, *this);
@@ -163,6 +203,7 @@ namespace generated
 
     void CPACSWingSection::SetName(const std::string& value)
     {
+        m_dirty = true;
         m_name = value;
     }
 
@@ -173,6 +214,7 @@ namespace generated
 
     void CPACSWingSection::SetDescription(const boost::optional<std::string>& value)
     {
+        m_dirty = true;
         m_description = value;
     }
 
@@ -31,6 +31,7 @@ namespace generated
 {
     CPACSWingSections::CPACSWingSections(CCPACSEnginePylon* parent, CTiglUIDManager* uidMgr)
         : m_uidMgr(uidMgr)
+        , m_dirty(true)
     {
         //assert(parent != NULL);
         m_parent = parent;
@@ -39,6 +40,7 @@ namespace generated
 
     CPACSWingSections::CPACSWingSections(CCPACSWing* parent, CTiglUIDManager* uidMgr)
         : m_uidMgr(uidMgr)
+        , m_dirty(true)
     {
         //assert(parent != NULL);
         m_parent = parent;
@@ -75,6 +77,43 @@ namespace generated
 
     }
 
+    bool CPACSWingSections::IsDirty() const
+    {
+        if (m_dirty) {
+            return true;
+        }
+        if (m_sections.size() != m_sectionsClean.size()) {
+            return true;
+        }
+        for (std::size_t i = 0; i < m_sections.size(); i++) {
+            if (m_sections[i].get() != m_sectionsClean[i] || m_sections[i]->IsDirty()) {
+                return true;
+            }
+        }
+        return false;
+    }
+
+    void CPACSWingSections::ClearDirty()
+    {
+        m_dirty = false;
+        m_sectionsClean.clear();
+        for (std::size_t i = 0; i < m_sections.size(); i++) {
+            m_sectionsClean.push_back(m_sections[i].get());
+            m_sections[i]->ClearDirty();
+        }
+    }
+
+    void CPACSWingSections::WriteDirtyCPACS(const TixiDocumentHandle& tixiHandle, const std::string& xpath) const
+    {
+        if (m_dirty) {
+            WriteCPACS(tixiHandle, xpath);
+            return;
+        }
+
+        // write modified elements section
+        tixi::TixiSaveDirtyElements(tixiHandle, xpath + "/section", m_sections, m_sectionsClean);
+    }
+
     const std::vector<unique_ptr<CCPACSWingSection> >& CPACSWingSections::GetSections() const
     {
         return m_sections;
@@ -93,6 +132,7 @@ namespace generated
 
     void CPACSWingSections::RemoveSection(CCPACSWingSection& ref)
     {
+        m_dirty = true;
         for (std::size_t i = 0; i < m_sections.size(); i++) {
             if (m_sections[i].get() == &ref) {
                 m_sections.erase(m_sections.begin() + i);
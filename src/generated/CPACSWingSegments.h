@@ -88,6 +88,10 @@ namespace generated
         TIGL_EXPORT virtual void ReadCPACS(const TixiDocumentHandle& tixiHandle, const std::string& xpath);
         TIGL_EXPORT virtual void WriteCPACS(const TixiDocumentHandle& tixiHandle, const std::string& xpath) const;
 
+        TIGL_EXPORT virtual bool IsDirty() const;
+        TIGL_EXPORT virtual void ClearDirty();
+        TIGL_EXPORT virtual void WriteDirtyCPACS(const TixiDocumentHandle& tixiHandle, const std::string& xpath) const;
+
         TIGL_EXPORT virtual const std::vector<unique_ptr<CCPACSWingSegment> >& GetSegments() const;
         TIGL_EXPORT virtual std::vector<unique_ptr<CCPACSWingSegment> >& GetSegments();
 
@@ -102,6 +106,12 @@ namespace generated
 
         std::vector<unique_ptr<CCPACSWingSegment> > m_segments;
 
+        /// Set by the setters, cleared after the object has been read or written
+        bool m_dirty;
+
+        /// List elements at the last call of ClearDirty
+        std::vector<const CCPACSWingSegment*> m_segmentsClean;
+
     private:
 #ifdef HAVE_CPP11
         CPACSWingSegments(const CPACSWingSegments&) = delete;
@@ -29,6 +29,7 @@ namespace generated
 {
     CPACSWingShell::CPACSWingShell(CCPACSWingCSStructure* parent, CTiglUIDManager* uidMgr)
         : m_uidMgr(uidMgr)
+        , m_dirty(true)
     {
         //assert(parent != NULL);
         m_parent = parent;
@@ -62,8 +63,7 @@ namespace generated
     void CPACSWingShell::ReadCPACS(const TixiDocumentHandle& tixiHandle, const std::string& xpath)
     {
         // read attribute uID
-        if (tixi::TixiCheckAttribute(tixiHandle, xpath, "uID")) {
-            m_uID = tixi::TixiGetAttribute<std::string>(tixiHandle, xpath, "uID");
+        if (tixi::TixiTryGetAttribute(tixiHandle, xpath, "uID", m_uID)) {
             if (m_uID.empty()) {
                 LOG(WARNING) << "Required attribute uID is empty at xpath " << xpath;
             }
@@ -116,6 +116,49 @@ namespace generated
 
     }
 
+    bool CPACSWingShell::IsDirty() const
+    {
+        if (m_dirty) {
+            return true;
+        }
+        if (m_skin.IsDirty()) {
+            return true;
+        }
+        if (m_cells && m_cells->IsDirty()) {
+            return true;
+        }
+        return false;
+    }
+
+    void CPACSWingShell::ClearDirty()
+    {
+        m_dirty = false;
+        m_skin.ClearDirty();
+        if (m_cells) {
+            m_cells->ClearDirty();
+        }
+    }
+
+    void CPACSWingShell::WriteDirtyCPACS(const TixiDocumentHandle& tixiHandle, const std::string& xpath) const
+    {
+        if (m_dirty) {
+            WriteCPACS(tixiHandle, xpath);
+            return;
+        }
+
+        // write modified element skin
+        if (m_skin.IsDirty()) {
+            tixi::TixiCreateElementIfNotExists(tixiHandle, xpath + "/skin");
+            m_skin.WriteDirtyCPACS(tixiHandle, xpath + "/skin");
+        }
+
+        // write modified element cells
+        if (m_cells && m_cells->IsDirty()) {
+            tixi::TixiCreateElementIfNotExists(tixiHandle, xpath + "/cells");
+            m_cells->WriteDirtyCPACS(tixiHandle, xpath + "/cells");
+        }
+    }
+
     const std::string& CPACSWingShell::GetUID() const
     {
         return m_uID;
@@ -123,6 +166,7 @@ namespace generated
 
     void CPACSWingShell::SetUID(const std::string& value)
     {
+        m_dirty = true;
         if (m_uidMgr) {
             m_uidMgr->TryUnregisterObject(m_uID);
             m_uidMgr->RegisterObject(value, *this);
@@ -159,6 +203,7 @@ namespace generated
 
     void CPACSWingShell::RemoveCells()
     {
+        m_dirty = true;
         m_cells = boost::none;
     }
 
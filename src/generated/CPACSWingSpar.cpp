@@ -31,6 +31,7 @@ namespace generated
         : m_uidMgr(uidMgr)
         , m_sparPositions(reinterpret_cast<CCPACSWingSpars*>(this), m_uidMgr)
         , m_sparSegments(reinterpret_cast<CCPACSWingSpars*>(this), m_uidMgr)
+        , m_dirty(true)
     {
         //assert(parent != NULL);
         m_parent = parent;
@@ -92,6 +93,47 @@ namespace generated
 
     }
 
+    bool CPACSWingSpar::IsDirty() const
+    {
+        if (m_dirty) {
+            return true;
+        }
+        if (m_sparPositions.IsDirty()) {
+            return true;
+        }
+        if (m_sparSegments.IsDirty()) {
+            return true;
+        }
+        return false;
+    }
+
+    void CPACSWingSpar::ClearDirty()
+    {
+        m_dirty = false;
+        m_sparPositions.ClearDirty();
+        m_sparSegments.ClearDirty();
+    }
+
+    void CPACSWingSpar::WriteDirtyCPACS(const TixiDocumentHandle& tixiHandle, const std::string& xpath) const
+    {
+        if (m_dirty) {
+            WriteCPACS(tixiHandle, xpath);
+            return;
+        }
+
+        // write modified element sparPositions
+        if (m_sparPositions.IsDirty()) {
+            tixi::TixiCreateElementIfNotExists(tixiHandle, xpath + "/sparPositions");
+            m_sparPositions.WriteDirtyCPACS(tixiHandle, xpath + "/sparPositions");
+        }
+
+        // write modified element sparSegments
+        if (m_sparSegments.IsDirty()) {
+            tixi::TixiCreateElementIfNotExists(tixiHandle, xpath + "/sparSegments");
+            m_sparSegments.WriteDirtyCPACS(tixiHandle, xpath + "/sparSegments");
+        }
+    }
+
     const CCPACSWingSparPositions& CPACSWingSpar::GetSparPositions() const
     {
         return m_sparPositions;
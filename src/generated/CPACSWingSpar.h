@@ -72,6 +72,10 @@ namespace generated
         TIGL_EXPORT virtual void ReadCPACS(const TixiDocumentHandle& tixiHandle, const std::string& xpath);
         TIGL_EXPORT virtual void WriteCPACS(const TixiDocumentHandle& tixiHandle, const std::string& xpath) const;
 
+        TIGL_EXPORT virtual bool IsDirty() const;
+        TIGL_EXPORT virtual void ClearDirty();
+        TIGL_EXPORT virtual void WriteDirtyCPACS(const TixiDocumentHandle& tixiHandle, const std::string& xpath) const;
+
         TIGL_EXPORT virtual const CCPACSWingSparPositions& GetSparPositions() const;
         TIGL_EXPORT virtual CCPACSWingSparPositions& GetSparPositions();
 
@@ -86,6 +90,9 @@ namespace generated
         CCPACSWingSparPositions m_sparPositions;
         CCPACSWingSparSegments  m_sparSegments;
 
+        /// Set by the setters, cleared after the object has been read or written
+        bool m_dirty;
+
     private:
 #ifdef HAVE_CPP11
         CPACSWingSpar(const CPACSWingSpar&) = delete;
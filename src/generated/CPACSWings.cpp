@@ -31,6 +31,7 @@ namespace generated
 {
     CPACSWings::CPACSWings(CCPACSAircraftModel* parent, CTiglUIDManager* uidMgr)
         : m_uidMgr(uidMgr)
+        , m_dirty(true)
     {
         //assert(parent != NULL);
         m_parent = parent;
@@ -39,6 +40,7 @@ namespace generated
 
     CPACSWings::CPACSWings(CCPACSRotorcraftModel* parent, CTiglUIDManager* uidMgr)
         : m_uidMgr(uidMgr)
+        , m_dirty(true)
     {
         //assert(parent != NULL);
         m_parent = parent;
@@ -75,6 +77,43 @@ namespace generated
 
     }
 
+    bool CPACSWings::IsDirty() const
+    {
+        if (m_dirty) {
+            return true;
+        }
+        if (m_wings.size() != m_wingsClean.size()) {
+            return true;
+        }
+        for (std::size_t i = 0; i < m_wings.size(); i++) {
+            if (m_wings[i].get() != m_wingsClean[i] || m_wings[i]->IsDirty()) {
+                return true;
+            }
+        }
+        return false;
+    }
+
+    void CPACSWings::ClearDirty()
+    {
+        m_dirty = false;
+        m_wingsClean.clear();
+        for (std::size_t i = 0; i < m_wings.size(); i++) {
+            m_wingsClean.push_back(m_wings[i].get());
+            m_wings[i]->ClearDirty();
+        }
+    }
+
+    void CPACSWings::WriteDirtyCPACS(const TixiDocumentHandle& tixiHandle, const std::string& xpath) const
+    {
+        if (m_dirty) {
+            WriteCPACS(tixiHandle, xpath);
+            return;
+        }
+
+        // write modified elements wing
+        tixi::TixiSaveDirtyElements(tixiHandle, xpath + "/wing", m_wings, m_wingsClean);
+    }
+
     const std::vector<unique_ptr<CCPACSWing> >& CPACSWings::GetWings() const
     {
         return m_wings;
@@ -93,6 +132,7 @@ namespace generated
 
     void CPACSWings::RemoveWing(CCPACSWing& ref)
     {
+        m_dirty = true;
         for (std::size_t i = 0; i < m_wings.size(); i++) {
             if (m_wings[i].get() == &ref) {
                 m_wings.erase(m_wings.begin() + i);
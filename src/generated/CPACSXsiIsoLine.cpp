@@ -26,6 +26,7 @@ namespace generated
 {
     CPACSXsiIsoLine::CPACSXsiIsoLine()
         : m_xsi(0)
+        , m_dirty(true)
     {
     }
 
@@ -36,16 +37,12 @@ namespace generated
     void CPACSXsiIsoLine::ReadCPACS(const TixiDocumentHandle& tixiHandle, const std::string& xpath)
     {
         // read element xsi
-        if (tixi::TixiCheckElement(tixiHandle, xpath + "/xsi")) {
-            m_xsi = tixi::TixiGetElement<double>(tixiHandle, xpath + "/xsi");
-        }
-        else {
+        if (!tixi::TixiTryGetElement(tixiHandle, xpath + "/xsi", m_xsi)) {
             LOG(ERROR) << "Required element xsi is missing at xpath " << xpath;
         }
 
         // read element referenceUID
-        if (tixi::TixiCheckElement(tixiHandle, xpath + "/referenceUID")) {
-            m_referenceUID = tixi::TixiGetElement<std::string>(tixiHandle, xpath + "/referenceUID");
+        if (tixi::TixiTryGetElement(tixiHandle, xpath + "/referenceUID", m_referenceUID)) {
             if (m_referenceUID.empty()) {
                 LOG(WARNING) << "Required element referenceUID is empty at xpath " << xpath;
             }
@@ -68,6 +65,23 @@ namespace generated
 
     }
 
+    bool CPACSXsiIsoLine::IsDirty() const
+    {
+        return m_dirty;
+    }
+
+    void CPACSXsiIsoLine::ClearDirty()
+    {
+        m_dirty = false;
+    }
+
+    void CPACSXsiIsoLine::WriteDirtyCPACS(const TixiDocumentHandle& tixiHandle, const std::string& xpath) const
+    {
+        if (m_dirty) {
+            WriteCPACS(tixiHandle, xpath);
+        }
+    }
+
     const double& CPACSXsiIsoLine::GetXsi() const
     {
         return m_xsi;
@@ -75,6 +89,7 @@ namespace generated
 
     void CPACSXsiIsoLine::SetXsi(const double& value)
     {
+        m_dirty = true;
         m_xsi = value;
     }
 
@@ -85,6 +100,7 @@ namespace generated
 
     void CPACSXsiIsoLine::SetReferenceUID(const std::string& value)
     {
+        m_dirty = true;
         m_referenceUID = value;
     }
 
@@ -24,6 +24,8 @@
 
 #include <ctime>
 
+#include <boost/optional.hpp>
+
 #include "UniquePtr.h"
 #ifndef CPACS_GEN
 #include "CTiglLogging.h"
@@ -48,6 +50,126 @@ namespace tixi
         TixiSaveElement(tixiHandle, xpath, boost::posix_time::to_iso_extended_string(boost::posix_time::from_time_t(value)));
     }
 
+    namespace internal
+    {
+        // Single xpath evaluation reads. value is only written on success.
+        inline ReturnCode TixiTryGetElementImpl(const TixiDocumentHandle& tixiHandle, const std::string& xpath, std::string& value)
+        {
+            char* text = NULL;
+            const ReturnCode ret = tixiGetTextElement(tixiHandle, xpath.c_str(), &text);
+            if (ret == SUCCESS) {
+                value = text;
+            }
+            return ret;
+        }
+
+        inline ReturnCode TixiTryGetElementImpl(const TixiDocumentHandle& tixiHandle, const std::string& xpath, double& value)
+        {
+            return tixiGetDoubleElement(tixiHandle, xpath.c_str(), &value);
+        }
+
+        inline ReturnCode TixiTryGetElementImpl(const TixiDocumentHandle& tixiHandle, const std::string& xpath, int& value)
+        {
+            return tixiGetIntegerElement(tixiHandle, xpath.c_str(), &value);
+        }
+
+        inline ReturnCode TixiTryGetElementImpl(const TixiDocumentHandle& tixiHandle, const std::string& xpath, bool& value)
+        {
+            int boolean = 0;
+            const ReturnCode ret = tixiGetBooleanElement(tixiHandle, xpath.c_str(), &boolean);
+            if (ret == SUCCESS) {
+                value = boolean != 0;
+            }
+            return ret;
+        }
+
+        inline ReturnCode TixiTryGetElementImpl(const TixiDocumentHandle& tixiHandle, const std::string& xpath, std::time_t& value)
+        {
+            std::string text;
+            const ReturnCode ret = TixiTryGetElementImpl(tixiHandle, xpath, text);
+            if (ret == SUCCESS) {
+                value = boost::posix_time::to_time_t(boost::posix_time::from_iso_extended_string(text));
+            }
+            return ret;
+        }
+
+        inline ReturnCode TixiTryGetAttributeImpl(const TixiDocumentHandle& tixiHandle, const std::string& xpath, const std::string& attribute, std::string& value)
+        {
+            char* text = NULL;
+            const ReturnCode ret = tixiGetTextAttribute(tixiHandle, xpath.c_str(), attribute.c_str(), &text);
+            if (ret == SUCCESS) {
+                value = text;
+            }
+            return ret;
+        }
+    }
+
+    // Reads the element at xpath into value, if it exists, and returns whether it exists.
+    // This is equivalent to TixiCheckElement followed by TixiGetElement, but the
+    // xpath is evaluated only once in the common case.
+    template<typename T>
+    bool TixiTryGetElement(const TixiDocumentHandle& tixiHandle, const std::string& xpath, T& value)
+    {
+        const ReturnCode ret = internal::TixiTryGetElementImpl(tixiHandle, xpath, value);
+        if (ret == SUCCESS) {
+            return true;
+        }
+        if (ret == ELEMENT_NOT_FOUND) {
+            return false;
+        }
+
+        // let the checked functions report all other errors as usual
+        if (!TixiCheckElement(tixiHandle, xpath)) {
+            return false;
+        }
+        value = TixiGetElement<T>(tixiHandle, xpath);
+        return true;
+    }
+
+    template<typename T>
+    bool TixiTryGetElement(const TixiDocumentHandle& tixiHandle, const std::string& xpath, boost::optional<T>& value)
+    {
+        T result;
+        if (!TixiTryGetElement(tixiHandle, xpath, result)) {
+            return false;
+        }
+        value = result;
+        return true;
+    }
+
+    // Reads the attribute of the element at xpath into value, if it exists, and returns whether it exists.
+    // This is equivalent to TixiCheckAttribute followed by TixiGetAttribute, but the
+    // xpath is evaluated only once in the common case.
+    template<typename T>
+    bool TixiTryGetAttribute(const TixiDocumentHandle& tixiHandle, const std::string& xpath, const std::string& attribute, T& value)
+    {
+        const ReturnCode ret = internal::TixiTryGetAttributeImpl(tixiHandle, xpath, attribute, value);
+        if (ret == SUCCESS) {
+            return true;
+        }
+        if (ret == ATTRIBUTE_NOT_FOUND) {
+            return false;
+        }
+
+        // let the checked functions report all other errors as usual
+        if (!TixiCheckAttribute(tixiHandle, xpath, attribute)) {
+            return false;
+        }
+        value = TixiGetAttribute<T>(tixiHandle, xpath, attribute);
+        return true;
+    }
+
+    template<typename T>
+    bool TixiTryGetAttribute(const TixiDocumentHandle& tixiHandle, const std::string& xpath, const std::string& attribute, boost::optional<T>& value)
+    {
+        T result;
+        if (!TixiTryGetAttribute(tixiHandle, xpath, attribute, result)) {
+            return false;
+        }
+        value = result;
+        return true;
+    }
+
 
     template<typename T, typename ReadChildFunc>
     void TixiReadElements(const TixiDocumentHandle& tixiHandle, const std::string& xpath, std::vector<T>& children, ReadChildFunc readChild, int minOccurs = -1, int maxOccurs = -1)
@@ -225,4 +347,30 @@ namespace tixi
     {
         TixiSaveElements(tixiHandle, xpath, children, ChildWriter<T>());
     }
+
+    template<typename T>
+    void TixiSaveDirtyElements(const TixiDocumentHandle& tixiHandle, const std::string& xpath, const std::vector<tigl::unique_ptr<T> >& children,
+                               const std::vector<const T*>& cleanChildren)
+    {
+        // child objects have been added, removed or reordered since the last ClearDirty, or the
+        // document differs from the objects, write all of them. This has to be tested first, as
+        // the remaining child objects may all be unmodified.
+        bool changed = children.size() != cleanChildren.size()
+                    || static_cast<std::size_t>(TixiGetNamedChildrenCount(tixiHandle, xpath)) != children.size();
+        for (std::size_t i = 0; i < children.size() && !changed; i++) {
+            changed = children[i].get() != cleanChildren[i];
+        }
+        if (changed) {
+            TixiSaveElements(tixiHandle, xpath, children);
+            return;
+        }
+
+        // write modified child objects. A new object at the address of an erased one is dirty
+        // and is written completely.
+        for (std::size_t i = 0; i < children.size(); i++) {
+            if (children[i]->IsDirty()) {
+                children[i]->WriteDirtyCPACS(tixiHandle, xpath + "[" + internal::to_string(i + 1) + "]");
+            }
+        }
+    }
 }
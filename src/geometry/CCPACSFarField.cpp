@@ -45,7 +45,7 @@ CCPACSFarField::CCPACSFarField() {
 void CCPACSFarField::init()
 {
     SetType(NONE);
-    loft.clear();
+    CTiglAbstractGeometricComponent::Reset();
 }
 
 void CCPACSFarField::ReadCPACS(const TixiDocumentHandle& tixiHandle, const std::string& xpath)
@@ -46,6 +46,7 @@ void CCPACSTransformation::reset()
 
 CCPACSTransformation &CCPACSTransformation::operator =(const CCPACSTransformation &trafo)
 {
+    m_dirty = true;
     m_scaling = trafo.m_scaling;
     m_rotation = trafo.m_rotation;
     m_translation = trafo.m_translation;
@@ -25,6 +25,8 @@
 #include "TiglSymmetryAxis.h"
 #include "CCPACSTransformation.h"
 #include "CNamedShape.h"
+#include "CTiglLoftDiskCache.h"
+#include "CTiglCacheAccounting.h"
 
 // OCCT defines
 #include <BRepBuilderAPI_Transform.hxx>
@@ -32,15 +34,45 @@
 #include <Bnd_Box.hxx>
 #include <BRepBndLib.hxx>
 
+#include <boost/thread/lock_guard.hpp>
+
 namespace tigl
 {
 CTiglAbstractGeometricComponent::CTiglAbstractGeometricComponent()
     : loft(*this, &CTiglAbstractGeometricComponent::BuildLoft)
+    , loftBuildCount(0)
+    , loftRequested(false)
+    , loftEvicted(false)
+    , mirroredLoftAxis(TIGL_NO_SYMMETRY)
+    , exactProperties(*this, &CTiglAbstractGeometricComponent::BuildExactProperties)
+    , fastProperties(*this, &CTiglAbstractGeometricComponent::BuildFastProperties)
+{
+}
+
+CTiglAbstractGeometricComponent::~CTiglAbstractGeometricComponent()
 {
+    if (cacheAccounting) {
+        cacheAccounting->Remove("loft:" + accountingKey);
+        cacheAccounting->Remove("mirroredLoft:" + accountingKey);
+    }
 }
 
 void CTiglAbstractGeometricComponent::Reset() {
+    if (loftCacheContext) {
+        loftCacheContext->valid = false;
+    }
+    if (cacheAccounting) {
+        cacheAccounting->Remove("loft:" + accountingKey);
+        cacheAccounting->Remove("mirroredLoft:" + accountingKey);
+    }
+    loftEvicted = false;
     loft.clear();
+    exactProperties.clear();
+    fastProperties.clear();
+
+    boost::lock_guard<boost::mutex> guard(mirroredLoftMutex);
+    mirroredLoft.reset();
+    mirroredLoftSource.reset();
 }
 
 TiglSymmetryAxis CTiglAbstractGeometricComponent::GetSymmetryAxis() const
@@ -50,16 +82,46 @@ TiglSymmetryAxis CTiglAbstractGeometricComponent::GetSymmetryAxis() const
 
 PNamedShape CTiglAbstractGeometricComponent::GetLoft() const
 {
+    if (cacheAccounting) {
+        cacheAccounting->Touch("loft:" + accountingKey);
+    }
     return *loft;
 }
 
 PNamedShape CTiglAbstractGeometricComponent::GetMirroredLoft()
 {
-    const TiglSymmetryAxis& symmetryAxis = GetSymmetryAxis();
+    const TiglSymmetryAxis symmetryAxis = GetSymmetryAxis();
     if (symmetryAxis == TIGL_NO_SYMMETRY) {
         return PNamedShape();
     }
 
+    // The loft cache is also cleared directly by the derived classes. Hence,
+    // the mirrored loft is checked against the loft it was built from.
+    const PNamedShape loft = GetLoft();
+
+    boost::lock_guard<boost::mutex> guard(mirroredLoftMutex);
+    if (!mirroredLoft || mirroredLoftSource != loft || mirroredLoftAxis != symmetryAxis) {
+        mirroredLoft       = BuildMirroredLoft(loft, symmetryAxis);
+        mirroredLoftSource = loft;
+        mirroredLoftAxis   = symmetryAxis;
+
+        if (cacheAccounting && mirroredLoft) {
+            cacheAccounting->Insert("mirroredLoft:" + accountingKey, EstimateShapeMemory(mirroredLoft->Shape()),
+                                    [this]() { EvictMirroredLoft(); });
+        }
+    }
+    else if (cacheAccounting) {
+        cacheAccounting->Touch("mirroredLoft:" + accountingKey);
+    }
+    return mirroredLoft;
+}
+
+PNamedShape CTiglAbstractGeometricComponent::BuildMirroredLoft(const PNamedShape& loft, TiglSymmetryAxis symmetryAxis) const
+{
+    if (!loft) {
+        return PNamedShape();
+    }
+
     gp_Ax2 mirrorPlane;
     if (symmetryAxis == TIGL_X_Z_PLANE) {
         mirrorPlane = gp_Ax2(gp_Pnt(0,0,0),gp_Dir(0.,1.,0.));
@@ -73,7 +135,6 @@ PNamedShape CTiglAbstractGeometricComponent::GetMirroredLoft()
 
     gp_Trsf theTransformation;
     theTransformation.SetMirror(mirrorPlane);
-    const PNamedShape& loft = GetLoft();
     BRepBuilderAPI_Transform myBRepTransformation(loft->Shape(), theTransformation);
     std::string mirrorName = loft->Name();
     mirrorName += "M";
@@ -140,9 +201,115 @@ bool CTiglAbstractGeometricComponent::GetIsOnMirrored(const gp_Pnt& pnt)
     return GetIsOn(mirroredPnt);
 }
 
+unsigned int CTiglAbstractGeometricComponent::GetLoftBuildCount() const
+{
+    return loftBuildCount;
+}
+
+void CTiglAbstractGeometricComponent::SetLoftCacheContext(CSharedPtr<CTiglLoftCacheContext> context, const std::string& key)
+{
+    loftCacheContext = context;
+    loftCacheKey = key;
+}
+
+void CTiglAbstractGeometricComponent::SetCacheAccounting(CSharedPtr<CTiglCacheAccounting> accounting, const std::string& key)
+{
+    if (cacheAccounting) {
+        cacheAccounting->Remove("loft:" + accountingKey);
+        cacheAccounting->Remove("mirroredLoft:" + accountingKey);
+    }
+    cacheAccounting = accounting;
+    accountingKey = key;
+}
+
+const CTiglIntegralProperties& CTiglAbstractGeometricComponent::GetIntegralProperties(TiglIntegrationAccuracy accuracy) const
+{
+    if (accuracy == TIGL_INTEGRATION_FAST) {
+        return *fastProperties;
+    }
+    return *exactProperties;
+}
+
+void CTiglAbstractGeometricComponent::BuildExactProperties(CTiglIntegralProperties& cache) const
+{
+    const PNamedShape shape = GetLoft();
+    if (shape) {
+        cache = ComputeIntegralProperties(shape->Shape(), TIGL_INTEGRATION_EXACT);
+    }
+}
+
+void CTiglAbstractGeometricComponent::BuildFastProperties(CTiglIntegralProperties& cache) const
+{
+    const PNamedShape shape = GetLoft();
+    if (shape) {
+        cache = ComputeIntegralProperties(shape->Shape(), TIGL_INTEGRATION_FAST);
+    }
+}
+
+void CTiglAbstractGeometricComponent::EvictLoft()
+{
+    // a loft, that has not been built yet, must be reported as rebuilt
+    if (!loft.isBuilt()) {
+        return;
+    }
+
+    // the geometry is unchanged, hence the rebuilt loft is neither
+    // reported as rebuilt nor does it invalidate the disk cache
+    loftEvicted = true;
+    loft.clear();
+    EvictMirroredLoft();
+    if (cacheAccounting) {
+        cacheAccounting->Remove("loft:" + accountingKey);
+        cacheAccounting->Remove("mirroredLoft:" + accountingKey);
+    }
+    EvictDerivedGeometry();
+}
+
+void CTiglAbstractGeometricComponent::EvictDerivedGeometry()
+{
+}
+
+void CTiglAbstractGeometricComponent::EvictMirroredLoft()
+{
+    boost::lock_guard<boost::mutex> guard(mirroredLoftMutex);
+    mirroredLoft.reset();
+    mirroredLoftSource.reset();
+}
+
 void CTiglAbstractGeometricComponent::BuildLoft(PNamedShape& cache) const
 {
-    cache = BuildLoft();
+    const bool evicted = loftEvicted.exchange(false);
+
+    // The loft is only requested again after the cache has been cleared, i.e.
+    // the geometry of the configuration is not the one stored in the file anymore
+    const bool rebuild = loftRequested.exchange(true) && !evicted;
+    if (rebuild && loftCacheContext) {
+        loftCacheContext->valid = false;
+    }
+
+    // the objects may have been modified by their setters before the first build
+    const bool useDiskCache = loftCacheContext && CTiglLoftDiskCache::IsEnabled() && loftCacheContext->IsValid();
+    if (useDiskCache) {
+        cache = CTiglLoftDiskCache::Load(loftCacheKey);
+    }
+
+    if (!cache) {
+        cache = BuildLoft();
+        if (!evicted) {
+            ++loftBuildCount;
+        }
+
+        if (useDiskCache && loftCacheContext->valid) {
+            CTiglLoftDiskCache::Store(loftCacheKey, cache);
+        }
+    }
+
+    if (cacheAccounting && cache) {
+        CTiglAbstractGeometricComponent* self = const_cast<CTiglAbstractGeometricComponent*>(this);
+        cacheAccounting->Insert("loft:" + accountingKey, EstimateShapeMemory(cache->Shape()), [self]() {
+            self->EvictLoft();
+        });
+    }
 }
 
 } // end namespace tigl
@@ -23,21 +23,29 @@
 #define CTIGLABSTRACTGEOMETRICCOMPONENT_H
 
 #include <gp_Pnt.hxx>
+#include <atomic>
 #include <string>
 
+#include <boost/thread/mutex.hpp>
+
 #include "PNamedShape.h"
 #include "ITiglGeometricComponent.h"
 #include "Cache.h"
+#include "CSharedPtr.h"
+#include "CTiglIntegralProperties.h"
 
 namespace tigl
 {
 class CCPACSTransformation;
+struct CTiglLoftCacheContext;
+class CTiglCacheAccounting;
 
 // TODO(bgruber): think about merging CTiglAbstractGeometricComponent into ITiglGeometricComponent, I don't think we need a separate interface
 class CTiglAbstractGeometricComponent : public ITiglGeometricComponent
 {
 public:
     CTiglAbstractGeometricComponent();
+    TIGL_EXPORT virtual ~CTiglAbstractGeometricComponent();
 
     TIGL_EXPORT void Reset();
 
@@ -47,6 +55,7 @@ public:
     TIGL_EXPORT PNamedShape GetLoft() const OVERRIDE;
 
     // Get the loft mirrored at the mirror plane
+    // The mirrored loft is computed once and rebuilt only if the loft changes
     TIGL_EXPORT virtual PNamedShape GetMirroredLoft();
 
     // return if pnt lies on the loft
@@ -56,9 +65,31 @@ public:
     // if the loft as no symmetry, false is returned
     TIGL_EXPORT bool GetIsOnMirrored(const gp_Pnt &pnt);
 
+    // Returns how often the loft of this component has been built
+    TIGL_EXPORT unsigned int GetLoftBuildCount() const;
+
+    // Enables loading and storing the loft from/to the disk cache (see CTiglLoftDiskCache)
+    // using the given key, as long as the context is valid
+    TIGL_EXPORT void SetLoftCacheContext(CSharedPtr<CTiglLoftCacheContext> context, const std::string& key);
+
+    // Accounts the memory of the loft and the mirrored loft using the given key.
+    // Both may be evicted by the accounting and are rebuilt on demand.
+    TIGL_EXPORT void SetCacheAccounting(CSharedPtr<CTiglCacheAccounting> accounting, const std::string& key);
+
+    // Drops the loft, the mirrored loft and all cached geometry sharing the loft to free memory.
+    // The geometry is unchanged, hence the loft is rebuilt on demand without being reported as rebuilt.
+    TIGL_EXPORT void EvictLoft();
+
+    // Returns the volume, surface area, centroid and inertia of the loft.
+    // The properties are computed once per accuracy and rebuilt only if the geometry changes.
+    TIGL_EXPORT const CTiglIntegralProperties& GetIntegralProperties(TiglIntegrationAccuracy accuracy = TIGL_INTEGRATION_EXACT) const;
+
 protected:
     virtual PNamedShape BuildLoft() const = 0;
 
+    // Called by EvictLoft. Drops the cached geometry, that is derived from the loft and would keep it alive.
+    virtual void EvictDerivedGeometry();
+
     Cache<PNamedShape, CTiglAbstractGeometricComponent> loft;
 
 private:
@@ -66,6 +97,30 @@ private:
     void operator=(const CTiglAbstractGeometricComponent&);
 
     void BuildLoft(PNamedShape& cache) const;
+    void BuildExactProperties(CTiglIntegralProperties& cache) const;
+    void BuildFastProperties(CTiglIntegralProperties& cache) const;
+    PNamedShape BuildMirroredLoft(const PNamedShape& loft, TiglSymmetryAxis symmetryAxis) const;
+    void EvictMirroredLoft();
+
+    mutable std::atomic<unsigned int> loftBuildCount;
+    mutable std::atomic<bool> loftRequested;
+    mutable std::atomic<bool> loftEvicted;
+
+    CSharedPtr<CTiglLoftCacheContext> loftCacheContext;
+    std::string loftCacheKey;
+
+    CSharedPtr<CTiglCacheAccounting> cacheAccounting;
+    std::string accountingKey;
+
+    // the mirrored loft is valid as long as it was built from the current loft
+    boost::mutex mirroredLoftMutex;
+    PNamedShape mirroredLoft;
+    PNamedShape mirroredLoftSource;
+    TiglSymmetryAxis mirroredLoftAxis;
+
+    // not cleared on eviction of the loft, as the geometry is unchanged
+    Cache<CTiglIntegralProperties, CTiglAbstractGeometricComponent> exactProperties;
+    Cache<CTiglIntegralProperties, CTiglAbstractGeometricComponent> fastProperties;
 };
 
 } // end namespace tigl
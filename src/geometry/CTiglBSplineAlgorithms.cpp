@@ -856,6 +856,54 @@ math_Matrix CTiglBSplineAlgorithms::bsplineBasisMat(int degree, const TColStd_Ar
     return mx;
 }
 
+int CTiglBSplineAlgorithms::bsplineBasisNonZeros(int degree, const TColStd_Array1OfReal& flatKnots, double param, math_Vector& values)
+{
+    math_Matrix bspl_basis(1, 1, 1, degree + 1);
+    bspl_basis.Init(0.);
+    Standard_Integer basis_start_index = 0;
+#if OCC_VERSION_HEX >= VERSION_HEX_CODE(7,1,0)
+    BSplCLib::EvalBsplineBasis(0, degree + 1, flatKnots, param, basis_start_index, bspl_basis);
+#else
+    BSplCLib::EvalBsplineBasis(1, 0, degree + 1, flatKnots, param, basis_start_index, bspl_basis);
+#endif
+    for (Standard_Integer i = 1; i <= degree + 1; ++i) {
+        values(values.Lower() + i - 1) = bspl_basis(1, i);
+    }
+    return basis_start_index;
+}
+
+CTiglBandedMatrix CTiglBSplineAlgorithms::bsplineBasisBandedMat(int degree, const TColStd_Array1OfReal& flatKnots, const TColStd_Array1OfReal& params)
+{
+    Standard_Integer ncp = flatKnots.Length() - degree - 1;
+    Standard_Integer nParams = params.Length();
+    if (ncp != nParams) {
+        throw CTiglError("Number of parameters and control points differ in CTiglBSplineAlgorithms::bsplineBasisBandedMat", TIGL_MATH_ERROR);
+    }
+
+    // evaluate all rows first to determine the bandwidth
+    std::vector<int> startIndices(static_cast<size_t>(nParams));
+    math_Matrix values(1, nParams, 1, degree + 1);
+    math_Vector row(1, degree + 1);
+    int lowerBandwidth = 0;
+    int upperBandwidth = 0;
+    for (Standard_Integer iparm = 1; iparm <= nParams; ++iparm) {
+        int start = bsplineBasisNonZeros(degree, flatKnots, params.Value(iparm), row);
+        startIndices[static_cast<size_t>(iparm - 1)] = start;
+        values.SetRow(iparm, row);
+        lowerBandwidth = std::max(lowerBandwidth, iparm - start);
+        upperBandwidth = std::max(upperBandwidth, start + degree - iparm);
+    }
+
+    CTiglBandedMatrix mx(nParams, lowerBandwidth, upperBandwidth);
+    for (Standard_Integer iparm = 1; iparm <= nParams; ++iparm) {
+        int start = startIndices[static_cast<size_t>(iparm - 1)];
+        for (int k = 0; k <= degree; ++k) {
+            mx(iparm, start + k) = values(iparm, k + 1);
+        }
+    }
+    return mx;
+}
+
 std::vector<double> CTiglBSplineAlgorithms::getKinkParameters(const Handle(Geom_BSplineCurve)& curve)
 {
     if (curve.IsNull()) {
@@ -20,6 +20,7 @@
 #define CTIGLBSPLINEALGORITHMS_H
 
 #include "tigl_internal.h"
+#include "CTiglBandedMatrix.h"
 
 #include <Geom_BSplineCurve.hxx>
 #include <Geom_BSplineSurface.hxx>
@@ -32,6 +33,7 @@
 #include <utility>
 #include <vector>
 #include <math_Matrix.hxx>
+#include <math_Vector.hxx>
 
 #include <BSplCLib_EvaluatorFunction.hxx>
 
@@ -78,6 +80,30 @@ public:
      */
     TIGL_EXPORT static math_Matrix bsplineBasisMat(int degree, const TColStd_Array1OfReal& flatKnots, const TColStd_Array1OfReal& params, unsigned int derivOrder=0);
 
+    /**
+     * @brief Evaluates the degree + 1 B-spline basis functions, that are nonzero at the parameter
+     * @param degree    Degree of the bspline
+     * @param flatKnots Flatted know vector
+     * @param param     Parameter of B-Spline evaluation
+     * @param values    Vector of size degree + 1 receiving the basis function values
+     * @return          Index of the first nonzero basis function, i.e. the column of values(1) in bsplineBasisMat
+     */
+    TIGL_EXPORT static int bsplineBasisNonZeros(int degree, const TColStd_Array1OfReal& flatKnots, double param, math_Vector& values);
+
+    /**
+     * @brief Computes the square bspline basis matrix in banded storage
+     *
+     * This is the same matrix as bsplineBasisMat, but the storage and assembly
+     * cost is proportional to the number of parameters instead of its square.
+     * The number of parameters must equal the number of control points.
+     *
+     * @param degree    Degree of the bspline
+     * @param flatKnots Flatted know vector
+     * @param params    Parameters of B-Spline evaluation
+     * @return          The banded B-spline matrix
+     */
+    TIGL_EXPORT static CTiglBandedMatrix bsplineBasisBandedMat(int degree, const TColStd_Array1OfReal& flatKnots, const TColStd_Array1OfReal& params);
+
     /**
      * @brief computeParamsBSplineSurf:
      *          Computes the parameters of a Geom_BSplineSurface at the given points
@@ -20,6 +20,7 @@
 
 #include <CTiglError.h>
 #include <CTiglBSplineAlgorithms.h>
+#include <CTiglBandedMatrix.h>
 
 #include <TColgp_Array1OfPnt.hxx>
 #include <Geom_BSplineCurve.hxx>
@@ -389,6 +390,142 @@ CTiglApproxResult CTiglBSplineApproxInterp::solve(const std::vector<double>& par
         throw tigl::CTiglError("Wrong number of control points for curve interpolation!");
     }
 
+    TColgp_Array1OfPnt poles(1, nCtrPnts);
+
+    // Without constraints coupling the curve ends, the systems are banded
+    bool solved = false;
+    if (!makeClosed && n_intpolated == 0) {
+        solved = solveBandedLeastSquares(params, flatKnots, poles);
+    }
+    else if (!makeClosed && n_apprxmated == 0) {
+        solved = solveBandedInterpolation(params, flatKnots, poles);
+    }
+    if (!solved) {
+        solveDense(params, flatKnots, n_continuityConditions, poles);
+    }
+
+    CTiglApproxResult result;
+    result.curve = new Geom_BSplineCurve(poles, knots, mults, m_degree, false);
+
+    // compute error
+    double max_error = 0.;
+    for (std::vector<size_t>::const_iterator it_idx = m_indexOfApproximated.begin(); it_idx != m_indexOfApproximated.end(); ++it_idx) {
+        Standard_Integer ipnt = static_cast<Standard_Integer>(*it_idx + 1);
+        const gp_Pnt& p = m_pnts.Value(ipnt);
+        double par = params[*it_idx];
+
+        double error = result.curve->Value(par).Distance(p);
+        max_error = std::max(max_error, error);
+    }
+    result.error = max_error;
+
+    return result;
+}
+
+bool CTiglBSplineApproxInterp::solveBandedLeastSquares(const std::vector<double>& params, const TColStd_Array1OfReal& flatKnots,
+                                                       TColgp_Array1OfPnt& poles) const
+{
+    // Each row of the basis matrix A has at most m_degree + 1 consecutive nonzeros.
+    // Hence, A^T*A is a symmetric banded matrix with bandwidth m_degree and
+    // can be assembled row by row without forming A.
+    Standard_Integer nCtrPnts = poles.Length();
+    if (!CTiglBandedMatrix::IsEfficientFor(nCtrPnts, m_degree, m_degree)) {
+        return false;
+    }
+
+    CTiglBandedMatrix lhs(nCtrPnts, m_degree, m_degree);
+    math_Vector rhsx(1, nCtrPnts, 0.);
+    math_Vector rhsy(1, nCtrPnts, 0.);
+    math_Vector rhsz(1, nCtrPnts, 0.);
+
+    math_Vector basis(1, m_degree + 1);
+    for (std::vector<size_t>::const_iterator it_idx = m_indexOfApproximated.begin(); it_idx != m_indexOfApproximated.end(); ++it_idx) {
+        const gp_Pnt& p = m_pnts.Value(static_cast<Standard_Integer>(*it_idx + 1));
+        int start = CTiglBSplineAlgorithms::bsplineBasisNonZeros(m_degree, flatKnots, params[*it_idx], basis);
+        for (int i = 0; i <= m_degree; ++i) {
+            double bi = basis(i + 1);
+            for (int j = 0; j <= i; ++j) {
+                lhs(start + i, start + j) += bi * basis(j + 1);
+            }
+            rhsx(start + i) += bi * p.X();
+            rhsy(start + i) += bi * p.Y();
+            rhsz(start + i) += bi * p.Z();
+        }
+    }
+
+    CTiglBandedCholesky solver(lhs);
+    if (!solver.IsDone()) {
+        // let the dense solver decide, whether the matrix is really singular
+        return false;
+    }
+
+    math_Vector cp_x(1, nCtrPnts);
+    math_Vector cp_y(1, nCtrPnts);
+    math_Vector cp_z(1, nCtrPnts);
+    solver.Solve(rhsx, cp_x);
+    solver.Solve(rhsy, cp_y);
+    solver.Solve(rhsz, cp_z);
+
+    for (Standard_Integer icp = 1; icp <= nCtrPnts; ++icp) {
+        poles.SetValue(icp, gp_Pnt(cp_x.Value(icp), cp_y.Value(icp), cp_z.Value(icp)));
+    }
+    return true;
+}
+
+bool CTiglBSplineApproxInterp::solveBandedInterpolation(const std::vector<double>& params, const TColStd_Array1OfReal& flatKnots,
+                                                        TColgp_Array1OfPnt& poles) const
+{
+    Standard_Integer nCtrPnts = poles.Length();
+    Standard_Integer n_intpolated = static_cast<Standard_Integer>(m_indexOfInterpolated.size());
+    if (n_intpolated != nCtrPnts) {
+        return false;
+    }
+
+    TColStd_Array1OfReal interpParams(1, n_intpolated);
+    math_Vector dx(1, n_intpolated);
+    math_Vector dy(1, n_intpolated);
+    math_Vector dz(1, n_intpolated);
+    Standard_Integer intpIndex = 1;
+    for (std::vector<size_t>::const_iterator it_idx = m_indexOfInterpolated.begin(); it_idx != m_indexOfInterpolated.end(); ++it_idx) {
+        const gp_Pnt& p = m_pnts.Value(static_cast<Standard_Integer>(*it_idx + 1));
+        dx(intpIndex) = p.X();
+        dy(intpIndex) = p.Y();
+        dz(intpIndex) = p.Z();
+        interpParams(intpIndex) = params[*it_idx];
+        intpIndex++;
+    }
+
+    CTiglBandedMatrix C = CTiglBSplineAlgorithms::bsplineBasisBandedMat(m_degree, flatKnots, interpParams);
+    if (!CTiglBandedMatrix::IsEfficientFor(C.Size(), C.LowerBandwidth(), C.UpperBandwidth())) {
+        return false;
+    }
+
+    CTiglBandedLU solver(C);
+    if (!solver.IsDone()) {
+        return false;
+    }
+
+    math_Vector cp_x(1, nCtrPnts);
+    math_Vector cp_y(1, nCtrPnts);
+    math_Vector cp_z(1, nCtrPnts);
+    solver.Solve(dx, cp_x);
+    solver.Solve(dy, cp_y);
+    solver.Solve(dz, cp_z);
+
+    for (Standard_Integer icp = 1; icp <= nCtrPnts; ++icp) {
+        poles.SetValue(icp, gp_Pnt(cp_x.Value(icp), cp_y.Value(icp), cp_z.Value(icp)));
+    }
+    return true;
+}
+
+void CTiglBSplineApproxInterp::solveDense(const std::vector<double>& params, const TColStd_Array1OfReal& flatKnots,
+                                          int n_continuityConditions, TColgp_Array1OfPnt& poles) const
+{
+    Standard_Integer n_apprxmated = static_cast<Standard_Integer>(m_indexOfApproximated.size());
+    Standard_Integer n_intpolated = static_cast<Standard_Integer>(m_indexOfInterpolated.size());
+    Standard_Integer nCtrPnts = poles.Length();
+    bool makeClosed = n_continuityConditions > 0;
+
     // Build left hand side of the equation
     Standard_Integer n_vars = nCtrPnts + n_intpolated + n_continuityConditions;
     math_Matrix lhs(1, n_vars, 1, n_vars);
@@ -487,28 +624,10 @@ CTiglApproxResult CTiglBSplineApproxInterp::solve(const std::vector<double>& par
         throw CTiglError("Singular Matrix", TIGL_MATH_ERROR);
     }
 
-    TColgp_Array1OfPnt poles(1, nCtrPnts);
     for (Standard_Integer icp = 1; icp <= nCtrPnts; ++icp) {
         gp_Pnt pnt(cp_x.Value(icp), cp_y.Value(icp), cp_z.Value(icp));
         poles.SetValue(icp, pnt);
     }
-
-    CTiglApproxResult result;
-    result.curve = new Geom_BSplineCurve(poles, knots, mults, m_degree, false);
-
-    // compute error
-    double max_error = 0.;
-    for (std::vector<size_t>::const_iterator it_idx = m_indexOfApproximated.begin(); it_idx != m_indexOfApproximated.end(); ++it_idx) {
-        Standard_Integer ipnt = static_cast<Standard_Integer>(*it_idx + 1);
-        const gp_Pnt& p = m_pnts.Value(ipnt);
-        double par = params[*it_idx];
-
-        double error = result.curve->Value(par).Distance(p);
-        max_error = std::max(max_error, error);
-    }
-    result.error = max_error;
-
-    return result;
 }
 
 /**
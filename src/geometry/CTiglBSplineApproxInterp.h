@@ -69,6 +69,14 @@ private:
     void computeKnots(int ncp, const std::vector<double>& params, std::vector<double>& knots, std::vector<int>& mults) const;
 
     CTiglApproxResult solve(const std::vector<double>& params, const TColStd_Array1OfReal& knots, const TColStd_Array1OfInteger& mults) const;
+    /// Solves the unconstrained least squares problem using the banded normal equations.
+    /// Returns false, if the dense solver should be used instead
+    bool solveBandedLeastSquares(const std::vector<double>& params, const TColStd_Array1OfReal& flatKnots, TColgp_Array1OfPnt& poles) const;
+    /// Solves the pure interpolation problem as a banded system.
+    /// Returns false, if the dense solver should be used instead
+    bool solveBandedInterpolation(const std::vector<double>& params, const TColStd_Array1OfReal& flatKnots, TColgp_Array1OfPnt& poles) const;
+    /// Solves the constrained least squares problem using a dense gauss solver
+    void solveDense(const std::vector<double>& params, const TColStd_Array1OfReal& flatKnots, int n_continuityConditions, TColgp_Array1OfPnt& poles) const;
     math_Matrix getContinuityMatrix(int nCtrPnts, int contin_cons, const std::vector<double>& params, const TColStd_Array1OfReal& flatKnots) const;
 
     void optimizeParameters(const Handle(Geom_Curve)& curve, std::vector<double>& parms) const;
@@ -0,0 +1,206 @@
+/*
+* Copyright (C) 2019 German Aerospace Center (DLR/SC)
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*/
+
+#include "CTiglBoundingBoxTree.h"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+namespace
+{
+    const int LEAF_SIZE = 2;
+}
+
+namespace tigl
+{
+
+CTiglBoundingBoxTree::CTiglBoundingBoxTree()
+{
+}
+
+CTiglBoundingBoxTree::CTiglBoundingBoxTree(const std::vector<Bnd_Box>& boxes)
+{
+    Build(boxes);
+}
+
+void CTiglBoundingBoxTree::Build(const std::vector<Bnd_Box>& boxes)
+{
+    const double inf = std::numeric_limits<double>::max();
+
+    m_min.assign(3 * boxes.size(), inf);
+    m_max.assign(3 * boxes.size(), -inf);
+    m_order.clear();
+    m_nodes.clear();
+
+    for (size_t i = 0; i < boxes.size(); ++i) {
+        const Bnd_Box& box = boxes[i];
+        if (box.IsVoid()) {
+            continue;
+        }
+
+        if (box.IsWhole()) {
+            for (int k = 0; k < 3; ++k) {
+                m_min[3*i + k] = -inf;
+                m_max[3*i + k] = inf;
+            }
+        }
+        else {
+            box.Get(m_min[3*i], m_min[3*i + 1], m_min[3*i + 2], m_max[3*i], m_max[3*i + 1], m_max[3*i + 2]);
+        }
+        m_order.push_back(i);
+    }
+
+    if (!m_order.empty()) {
+        m_nodes.reserve(2 * m_order.size());
+        BuildNode(0, static_cast<int>(m_order.size()));
+    }
+}
+
+size_t CTiglBoundingBoxTree::Size() const
+{
+    return m_min.size() / 3;
+}
+
+int CTiglBoundingBoxTree::BuildNode(int first, int count)
+{
+    const int index = static_cast<int>(m_nodes.size());
+    m_nodes.push_back(Node());
+
+    Node node;
+    node.left = node.right = -1;
+    node.first = first;
+    node.count = count;
+    for (int k = 0; k < 3; ++k) {
+        node.min[k] = std::numeric_limits<double>::max();
+        node.max[k] = -std::numeric_limits<double>::max();
+    }
+    for (int i = first; i < first + count; ++i) {
+        const size_t ibox = m_order[i];
+        for (int k = 0; k < 3; ++k) {
+            node.min[k] = std::min(node.min[k], m_min[3*ibox + k]);
+            node.max[k] = std::max(node.max[k], m_max[3*ibox + k]);
+        }
+    }
+
+    if (count > LEAF_SIZE) {
+        // split at the median of the box centers along the largest extent
+        int axis = 0;
+        for (int k = 1; k < 3; ++k) {
+            if (node.max[k] - node.min[k] > node.max[axis] - node.min[axis]) {
+                axis = k;
+            }
+        }
+
+        const std::vector<double>& mins = m_min;
+        const std::vector<double>& maxs = m_max;
+        std::vector<size_t>::iterator begin = m_order.begin() + first;
+        std::nth_element(begin, begin + count/2, begin + count, [&mins, &maxs, axis](size_t a, size_t b) {
+            // half of the center, avoids overflows for whole boxes
+            return 0.5*mins[3*a + axis] + 0.5*maxs[3*a + axis] < 0.5*mins[3*b + axis] + 0.5*maxs[3*b + axis];
+        });
+
+        node.left  = BuildNode(first, count/2);
+        node.right = BuildNode(first + count/2, count - count/2);
+    }
+
+    m_nodes[index] = node;
+    return index;
+}
+
+template <typename Predicate>
+std::vector<size_t> CTiglBoundingBoxTree::Collect(Predicate hit) const
+{
+    std::vector<size_t> result;
+    if (m_nodes.empty()) {
+        return result;
+    }
+
+    std::vector<int> stack(1, 0);
+    while (!stack.empty()) {
+        const Node& node = m_nodes[stack.back()];
+        stack.pop_back();
+
+        if (!hit(node.min, node.max)) {
+            continue;
+        }
+
+        if (node.left < 0) {
+            for (int i = node.first; i < node.first + node.count; ++i) {
+                const size_t ibox = m_order[i];
+                if (hit(&m_min[3*ibox], &m_max[3*ibox])) {
+                    result.push_back(ibox);
+                }
+            }
+        }
+        else {
+            stack.push_back(node.left);
+            stack.push_back(node.right);
+        }
+    }
+
+    std::sort(result.begin(), result.end());
+    return result;
+}
+
+std::vector<size_t> CTiglBoundingBoxTree::Find(const gp_Pnt& point, double tolerance) const
+{
+    const double p[3] = {point.X(), point.Y(), point.Z()};
+
+    return Collect([&p, tolerance](const double* min, const double* max) {
+        for (int k = 0; k < 3; ++k) {
+            if (p[k] < min[k] - tolerance || p[k] > max[k] + tolerance) {
+                return false;
+            }
+        }
+        return true;
+    });
+}
+
+std::vector<size_t> CTiglBoundingBoxTree::FindAlongRay(const gp_Lin& ray, double tolerance) const
+{
+    const double o[3] = {ray.Location().X(), ray.Location().Y(), ray.Location().Z()};
+    const double d[3] = {ray.Direction().X(), ray.Direction().Y(), ray.Direction().Z()};
+
+    // slab test of the ray parameter range [0, inf) against the box
+    return Collect([&o, &d, tolerance](const double* min, const double* max) {
+        double tmin = 0.;
+        double tmax = std::numeric_limits<double>::max();
+        for (int k = 0; k < 3; ++k) {
+            const double lo = min[k] - tolerance;
+            const double hi = max[k] + tolerance;
+            if (std::abs(d[k]) < 1e-15) {
+                if (o[k] < lo || o[k] > hi) {
+                    return false;
+                }
+                continue;
+            }
+            double t1 = (lo - o[k]) / d[k];
+            double t2 = (hi - o[k]) / d[k];
+            if (t1 > t2) {
+                std::swap(t1, t2);
+            }
+            tmin = std::max(tmin, t1);
+            tmax = std::min(tmax, t2);
+            if (tmin > tmax) {
+                return false;
+            }
+        }
+        return true;
+    });
+}
+
+} // namespace tigl
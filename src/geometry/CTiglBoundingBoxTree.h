@@ -0,0 +1,82 @@
+/*
+* Copyright (C) 2019 German Aerospace Center (DLR/SC)
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*/
+
+#ifndef CTIGLBOUNDINGBOXTREE_H
+#define CTIGLBOUNDINGBOXTREE_H
+
+#include "tigl_internal.h"
+
+#include <Bnd_Box.hxx>
+#include <gp_Lin.hxx>
+#include <gp_Pnt.hxx>
+
+#include <cstddef>
+#include <vector>
+
+namespace tigl
+{
+
+/**
+ * @brief Axis aligned bounding box tree to find all boxes containing a point
+ *
+ * The tree is static, i.e. it has to be rebuilt, if the boxes change.
+ * Queries are thread-safe.
+ */
+class CTiglBoundingBoxTree
+{
+public:
+    TIGL_EXPORT CTiglBoundingBoxTree();
+
+    /// Builds the tree from the given boxes. Void boxes are never found, whole boxes always.
+    TIGL_EXPORT explicit CTiglBoundingBoxTree(const std::vector<Bnd_Box>& boxes);
+
+    TIGL_EXPORT void Build(const std::vector<Bnd_Box>& boxes);
+
+    /// Number of boxes in the tree
+    TIGL_EXPORT size_t Size() const;
+
+    /// Returns the indices of all boxes containing the point in ascending order.
+    /// The boxes are enlarged by the tolerance.
+    TIGL_EXPORT std::vector<size_t> Find(const gp_Pnt& point, double tolerance = 0.) const;
+
+    /// Returns the indices of all boxes hit by the ray in ascending order.
+    /// The ray starts at the location of the line and follows its direction.
+    /// The boxes are enlarged by the tolerance.
+    TIGL_EXPORT std::vector<size_t> FindAlongRay(const gp_Lin& ray, double tolerance = 0.) const;
+
+private:
+    struct Node
+    {
+        double min[3], max[3];
+        int left, right;    // child nodes, -1 for leaves
+        int first, count;   // range in m_order for leaves
+    };
+
+    int BuildNode(int first, int count);
+
+    // Collects all boxes, for which the predicate returns true. The predicate
+    // must return true for a node, if it is true for any box inside the node.
+    template <typename Predicate>
+    std::vector<size_t> Collect(Predicate hit) const;
+
+    std::vector<double> m_min, m_max; // 3 values per box
+    std::vector<size_t> m_order;      // box indices sorted by the tree
+    std::vector<Node> m_nodes;
+};
+
+} // namespace tigl
+
+#endif // CTIGLBOUNDINGBOXTREE_H
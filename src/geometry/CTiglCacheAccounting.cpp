@@ -0,0 +1,417 @@
+/*
+* Copyright (C) 2019 German Aerospace Center (DLR/SC)
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*/
+
+#include "CTiglCacheAccounting.h"
+#include "CTiglLogging.h"
+
+#include <BRep_Tool.hxx>
+#include <Geom_BezierCurve.hxx>
+#include <Geom_BezierSurface.hxx>
+#include <Geom_BSplineCurve.hxx>
+#include <Geom_BSplineSurface.hxx>
+#include <Geom_OffsetSurface.hxx>
+#include <Geom_RectangularTrimmedSurface.hxx>
+#include <Geom_TrimmedCurve.hxx>
+#include <Poly_Triangulation.hxx>
+#include <TopExp.hxx>
+#include <TopLoc_Location.hxx>
+#include <TopoDS.hxx>
+#include <TopoDS_Shape.hxx>
+#include <TopTools_IndexedMapOfShape.hxx>
+#include <gp_Pnt.hxx>
+#include <gp_Pnt2d.hxx>
+
+#include <algorithm>
+#include <atomic>
+#include <set>
+#include <vector>
+
+#include <boost/thread/lock_guard.hpp>
+
+namespace
+{
+
+// rough memory of the topological entities and of analytic curves and surfaces
+const size_t TopologyBytes = 128;
+const size_t ElementaryGeometryBytes = 128;
+const size_t PCurveBytes = 256;
+
+std::atomic<size_t> memoryBudget(0);
+std::atomic<size_t> totalResidentBytes(0);
+std::atomic<size_t> requestedBytes(0); // marked for eviction, but still resident
+std::atomic<unsigned long long> useCounter(0);
+
+// all living accountings, such that the budget can be enforced across configurations
+boost::mutex& registryMutex()
+{
+    static boost::mutex mutex;
+    return mutex;
+}
+
+std::set<tigl::CTiglCacheAccounting*>& registry()
+{
+    static std::set<tigl::CTiglCacheAccounting*> accountings;
+    return accountings;
+}
+
+size_t surfaceBytes(Handle(Geom_Surface) surface)
+{
+    while (!surface.IsNull()) {
+        Handle(Geom_RectangularTrimmedSurface) trimmed = Handle(Geom_RectangularTrimmedSurface)::DownCast(surface);
+        Handle(Geom_OffsetSurface) offset = Handle(Geom_OffsetSurface)::DownCast(surface);
+        if (!trimmed.IsNull()) {
+            surface = trimmed->BasisSurface();
+        }
+        else if (!offset.IsNull()) {
+            surface = offset->BasisSurface();
+        }
+        else {
+            break;
+        }
+    }
+
+    Handle(Geom_BSplineSurface) bspline = Handle(Geom_BSplineSurface)::DownCast(surface);
+    if (!bspline.IsNull()) {
+        const size_t poleBytes = sizeof(gp_Pnt) + (bspline->IsURational() || bspline->IsVRational() ? sizeof(double) : 0);
+        return static_cast<size_t>(bspline->NbUPoles() * bspline->NbVPoles()) * poleBytes
+             + static_cast<size_t>(bspline->NbUKnots() + bspline->NbVKnots()) * (sizeof(double) + sizeof(int));
+    }
+    Handle(Geom_BezierSurface) bezier = Handle(Geom_BezierSurface)::DownCast(surface);
+    if (!bezier.IsNull()) {
+        return static_cast<size_t>(bezier->NbUPoles() * bezier->NbVPoles()) * (sizeof(gp_Pnt) + sizeof(double));
+    }
+    return ElementaryGeometryBytes;
+}
+
+size_t curveBytes(Handle(Geom_Curve) curve)
+{
+    Handle(Geom_TrimmedCurve) trimmed = Handle(Geom_TrimmedCurve)::DownCast(curve);
+    while (!trimmed.IsNull()) {
+        curve = trimmed->BasisCurve();
+        trimmed = Handle(Geom_TrimmedCurve)::DownCast(curve);
+    }
+
+    Handle(Geom_BSplineCurve) bspline = Handle(Geom_BSplineCurve)::DownCast(curve);
+    if (!bspline.IsNull()) {
+        const size_t poleBytes = sizeof(gp_Pnt) + (bspline->IsRational() ? sizeof(double) : 0);
+        return static_cast<size_t>(bspline->NbPoles()) * poleBytes
+             + static_cast<size_t>(bspline->NbKnots()) * (sizeof(double) + sizeof(int));
+    }
+    Handle(Geom_BezierCurve) bezier = Handle(Geom_BezierCurve)::DownCast(curve);
+    if (!bezier.IsNull()) {
+        return static_cast<size_t>(bezier->NbPoles()) * (sizeof(gp_Pnt) + sizeof(double));
+    }
+    return ElementaryGeometryBytes;
+}
+
+// resident memory without the entries, that are already marked for eviction
+size_t pendingResidentBytes()
+{
+    const size_t resident = totalResidentBytes;
+    const size_t requested = requestedBytes;
+    return resident > requested ? resident - requested : 0;
+}
+
+} // namespace
+
+namespace tigl
+{
+
+size_t EstimateShapeMemory(const TopoDS_Shape& shape)
+{
+    if (shape.IsNull()) {
+        return 0;
+    }
+
+    TopTools_IndexedMapOfShape subShapes;
+    TopExp::MapShapes(shape, subShapes);
+    size_t bytes = static_cast<size_t>(subShapes.Extent()) * TopologyBytes;
+
+    // geometries and triangulations may be shared by several faces or edges
+    std::set<const Standard_Transient*> counted;
+
+    TopTools_IndexedMapOfShape faces;
+    TopExp::MapShapes(shape, TopAbs_FACE, faces);
+    for (int iface = 1; iface <= faces.Extent(); ++iface) {
+        const TopoDS_Face& face = TopoDS::Face(faces(iface));
+        TopLoc_Location location;
+
+        const Handle(Geom_Surface)& surface = BRep_Tool::Surface(face, location);
+        if (!surface.IsNull() && counted.insert(surface.operator->()).second) {
+            bytes += surfaceBytes(surface);
+        }
+
+        const Handle(Poly_Triangulation)& triangulation = BRep_Tool::Triangulation(face, location);
+        if (!triangulation.IsNull() && counted.insert(triangulation.operator->()).second) {
+            const size_t nodeBytes = sizeof(gp_Pnt) + (triangulation->HasUVNodes() ? sizeof(gp_Pnt2d) : 0);
+            bytes += static_cast<size_t>(triangulation->NbNodes()) * nodeBytes
+                   + static_cast<size_t>(triangulation->NbTriangles()) * 3 * sizeof(int);
+        }
+    }
+
+    TopTools_IndexedMapOfShape edges;
+    TopExp::MapShapes(shape, TopAbs_EDGE, edges);
+    for (int iedge = 1; iedge <= edges.Extent(); ++iedge) {
+        const TopoDS_Edge& edge = TopoDS::Edge(edges(iedge));
+        TopLoc_Location location;
+        Standard_Real first, last;
+        const Handle(Geom_Curve)& curve = BRep_Tool::Curve(edge, location, first, last);
+        if (!curve.IsNull() && counted.insert(curve.operator->()).second) {
+            bytes += curveBytes(curve);
+        }
+        // the curves on the adjacent faces
+        bytes += PCurveBytes;
+    }
+
+    return bytes;
+}
+
+void CTiglCacheAccounting::SetMemoryBudget(size_t bytes)
+{
+    memoryBudget = bytes;
+}
+
+size_t CTiglCacheAccounting::GetMemoryBudget()
+{
+    return memoryBudget;
+}
+
+size_t CTiglCacheAccounting::GetTotalResidentBytes()
+{
+    return totalResidentBytes;
+}
+
+CTiglCacheAccounting::CTiglCacheAccounting()
+    : m_epoch(0)
+    , m_requestedBytes(0)
+{
+    boost::lock_guard<boost::mutex> registryGuard(registryMutex());
+    registry().insert(this);
+}
+
+CTiglCacheAccounting::~CTiglCacheAccounting()
+{
+    boost::lock_guard<boost::mutex> registryGuard(registryMutex());
+    registry().erase(this);
+    totalResidentBytes -= m_stats.residentBytes;
+    requestedBytes -= m_requestedBytes;
+}
+
+void CTiglCacheAccounting::Insert(const std::string& key, size_t bytes, const EvictFunction& evict)
+{
+    boost::lock_guard<boost::mutex> guard(m_mutex);
+
+    EntryMap::iterator it = m_entries.find(key);
+    if (it != m_entries.end()) {
+        RemoveEntry(it);
+    }
+
+    Entry entry;
+    entry.bytes       = bytes;
+    entry.lastUse     = m_epoch;
+    entry.lastTick    = ++useCounter;
+    entry.evict       = evict;
+    entry.lruPosition = m_lru.insert(m_lru.end(), key);
+    entry.evictionRequested = false;
+    m_entries.insert(std::make_pair(key, entry));
+
+    m_stats.misses++;
+    m_stats.entries++;
+    m_stats.residentBytes += bytes;
+    totalResidentBytes += bytes;
+}
+
+bool CTiglCacheAccounting::Touch(const std::string& key)
+{
+    boost::lock_guard<boost::mutex> guard(m_mutex);
+
+    EntryMap::iterator it = m_entries.find(key);
+    if (it == m_entries.end()) {
+        return false;
+    }
+
+    Entry& entry = it->second;
+    entry.lastUse  = m_epoch;
+    entry.lastTick = ++useCounter;
+    m_lru.splice(m_lru.end(), m_lru, entry.lruPosition);
+    if (entry.evictionRequested) {
+        // used again before its configuration evicted it
+        entry.evictionRequested = false;
+        m_requestedBytes -= entry.bytes;
+        requestedBytes -= entry.bytes;
+    }
+    m_stats.hits++;
+    return true;
+}
+
+void CTiglCacheAccounting::Remove(const std::string& key)
+{
+    boost::lock_guard<boost::mutex> guard(m_mutex);
+
+    EntryMap::iterator it = m_entries.find(key);
+    if (it != m_entries.end()) {
+        RemoveEntry(it);
+    }
+}
+
+void CTiglCacheAccounting::RemovePrefix(const std::string& prefix)
+{
+    boost::lock_guard<boost::mutex> guard(m_mutex);
+
+    EntryMap::iterator it = m_entries.lower_bound(prefix);
+    while (it != m_entries.end() && it->first.compare(0, prefix.size(), prefix) == 0) {
+        EntryMap::iterator next = it;
+        ++next;
+        RemoveEntry(it);
+        it = next;
+    }
+}
+
+void CTiglCacheAccounting::RemoveEntry(EntryMap::iterator it)
+{
+    if (it->second.evictionRequested) {
+        m_requestedBytes -= it->second.bytes;
+        requestedBytes -= it->second.bytes;
+    }
+    m_stats.entries--;
+    m_stats.residentBytes -= it->second.bytes;
+    totalResidentBytes -= it->second.bytes;
+    m_lru.erase(it->second.lruPosition);
+    m_entries.erase(it);
+}
+
+void CTiglCacheAccounting::CollectEvictable(unsigned long long protectedEpoch,
+                                            std::vector<std::pair<unsigned long long, std::string> >& keys) const
+{
+    for (LruList::const_iterator lruIt = m_lru.begin(); lruIt != m_lru.end(); ++lruIt) {
+        const Entry& entry = m_entries.find(*lruIt)->second;
+        if (entry.lastUse >= protectedEpoch) {
+            // the remaining entries are more recent
+            break;
+        }
+        if (entry.evictionRequested) {
+            continue;
+        }
+        keys.push_back(std::make_pair(entry.lastTick, *lruIt));
+    }
+}
+
+size_t CTiglCacheAccounting::EnforceBudget()
+{
+    // the registry lock keeps the other accountings alive and serializes the eviction
+    boost::lock_guard<boost::mutex> registryGuard(registryMutex());
+
+    std::vector<EvictFunction> victims;
+
+    // entries used since the previous call may still be referenced by the caller
+    unsigned long long protectedEpoch;
+    {
+        boost::lock_guard<boost::mutex> guard(m_mutex);
+        protectedEpoch = m_epoch;
+        m_epoch++;
+
+        // evict the entries marked by other configurations, they are not used since then
+        EntryMap::iterator it = m_entries.begin();
+        while (it != m_entries.end()) {
+            EntryMap::iterator next = it;
+            ++next;
+            if (it->second.evictionRequested) {
+                victims.push_back(it->second.evict);
+                RemoveEntry(it);
+                m_stats.evictions++;
+            }
+            it = next;
+        }
+    }
+
+    const size_t budget = memoryBudget;
+    size_t requested = 0;
+    if (budget > 0 && pendingResidentBytes() > budget) {
+        // Collect the candidates of all configurations. The entries of the other configurations
+        // are protected, if they have been used since their own last call of EnforceBudget.
+        struct Candidate
+        {
+            unsigned long long tick;
+            CTiglCacheAccounting* accounting;
+            std::string key;
+
+            bool operator<(const Candidate& other) const
+            {
+                return tick < other.tick;
+            }
+        };
+        std::vector<Candidate> candidates;
+        std::set<CTiglCacheAccounting*>& accountings = registry();
+        for (std::set<CTiglCacheAccounting*>::iterator it = accountings.begin(); it != accountings.end(); ++it) {
+            CTiglCacheAccounting* accounting = *it;
+            std::vector<std::pair<unsigned long long, std::string> > keys;
+            {
+                boost::lock_guard<boost::mutex> guard(accounting->m_mutex);
+                accounting->CollectEvictable(accounting == this ? protectedEpoch : accounting->m_epoch, keys);
+            }
+            for (size_t i = 0; i < keys.size(); ++i) {
+                Candidate candidate = {keys[i].first, accounting, keys[i].second};
+                candidates.push_back(candidate);
+            }
+        }
+        std::sort(candidates.begin(), candidates.end());
+
+        for (size_t i = 0; i < candidates.size() && pendingResidentBytes() > budget; ++i) {
+            CTiglCacheAccounting* accounting = candidates[i].accounting;
+            boost::lock_guard<boost::mutex> guard(accounting->m_mutex);
+
+            // the entry may have been used or dropped in the meantime by another thread
+            EntryMap::iterator it = accounting->m_entries.find(candidates[i].key);
+            if (it == accounting->m_entries.end() || it->second.lastTick != candidates[i].tick) {
+                continue;
+            }
+
+            if (accounting == this) {
+                victims.push_back(it->second.evict);
+                RemoveEntry(it);
+                m_stats.evictions++;
+            }
+            else {
+                // The other configuration may be in use by another thread. Its owners must not
+                // be called from here, the entry is evicted by its own next call instead.
+                it->second.evictionRequested = true;
+                accounting->m_requestedBytes += it->second.bytes;
+                requestedBytes += it->second.bytes;
+                requested++;
+            }
+        }
+    }
+
+    // the owners may lock their own mutexes, hence they are called without holding the accounting mutexes
+    for (size_t i = 0; i < victims.size(); ++i) {
+        victims[i]();
+    }
+
+    if (!victims.empty() || requested > 0) {
+        LOG(INFO) << "Evicted " << victims.size() << " cache entries and marked " << requested
+                  << " cache entries of other configurations to meet the memory budget of "
+                  << budget << " bytes.";
+    }
+    return victims.size();
+}
+
+CTiglCacheStatistics CTiglCacheAccounting::GetStatistics() const
+{
+    boost::lock_guard<boost::mutex> guard(m_mutex);
+    return m_stats;
+}
+
+} // namespace tigl
@@ -0,0 +1,140 @@
+/*
+* Copyright (C) 2019 German Aerospace Center (DLR/SC)
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*/
+
+#ifndef CTIGLCACHEACCOUNTING_H
+#define CTIGLCACHEACCOUNTING_H
+
+#include "tigl_internal.h"
+
+#include <cstddef>
+#include <functional>
+#include <list>
+#include <map>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <boost/thread/mutex.hpp>
+
+class TopoDS_Shape;
+
+namespace tigl
+{
+
+/// Returns the estimated memory of the B-rep geometry and the triangulations of a shape in bytes
+TIGL_EXPORT size_t EstimateShapeMemory(const TopoDS_Shape& shape);
+
+struct CTiglCacheStatistics
+{
+    CTiglCacheStatistics()
+        : hits(0)
+        , misses(0)
+        , evictions(0)
+        , residentBytes(0)
+        , entries(0)
+    {
+    }
+
+    unsigned long long hits;      ///< Number of requests served from the cache
+    unsigned long long misses;    ///< Number of requests, that had to build the entry
+    unsigned long long evictions; ///< Number of entries evicted to meet the memory budget
+    size_t residentBytes;         ///< Estimated memory of all cached entries
+    size_t entries;               ///< Number of cached entries
+};
+
+/**
+ * @brief Memory accounting and LRU eviction of the cached shapes of one configuration
+ *
+ * The owners of the cached shapes (component lofts, shape cache) register each
+ * entry together with its estimated size and a function, that drops the entry.
+ * Entries must be rebuildable on demand after they have been evicted.
+ *
+ * The memory budget and the LRU order are global for all configurations. If the
+ * resident memory of all configurations exceeds the budget, EnforceBudget selects the
+ * least recently used entries of any configuration. Entries used since the previous
+ * call of EnforceBudget of their own configuration are never selected. The entries of
+ * the calling configuration are evicted immediately. The entries of other configurations
+ * may be in use by another thread, hence they are only marked and evicted by the next
+ * call of EnforceBudget of their own configuration, unless they are used before.
+ * EnforceBudget must only be called, when no reference to a cached value of its
+ * configuration is held, i.e. between two API calls.
+ */
+class CTiglCacheAccounting
+{
+public:
+    typedef std::function<void()> EvictFunction;
+
+    /// Sets the global memory budget in bytes. A budget of 0 disables eviction (default).
+    TIGL_EXPORT static void SetMemoryBudget(size_t bytes);
+    TIGL_EXPORT static size_t GetMemoryBudget();
+
+    /// Returns the resident memory of the caches of all configurations in bytes
+    TIGL_EXPORT static size_t GetTotalResidentBytes();
+
+    TIGL_EXPORT CTiglCacheAccounting();
+    TIGL_EXPORT ~CTiglCacheAccounting();
+
+    /// Adds or replaces the entry after it has been built. Counts a cache miss.
+    TIGL_EXPORT void Insert(const std::string& key, size_t bytes, const EvictFunction& evict);
+
+    /// Marks the entry as used. Returns true and counts a cache hit, if the entry is resident.
+    TIGL_EXPORT bool Touch(const std::string& key);
+
+    /// Removes the entry, because its owner dropped it. This does not count as eviction.
+    TIGL_EXPORT void Remove(const std::string& key);
+
+    /// Removes all entries, whose key starts with prefix
+    TIGL_EXPORT void RemovePrefix(const std::string& prefix);
+
+    /// Evicts the entries marked by other configurations and the least recently used entries
+    /// until the global budget is met. Returns the number of entries evicted by this call.
+    TIGL_EXPORT size_t EnforceBudget();
+
+    TIGL_EXPORT CTiglCacheStatistics GetStatistics() const;
+
+private:
+    CTiglCacheAccounting(const CTiglCacheAccounting&);
+    CTiglCacheAccounting& operator=(const CTiglCacheAccounting&);
+
+    typedef std::list<std::string> LruList;
+
+    struct Entry
+    {
+        size_t bytes;
+        unsigned long long lastUse;  // epoch of the last use
+        unsigned long long lastTick; // global use counter at the last use, orders the entries of all configurations
+        EvictFunction evict;
+        LruList::iterator lruPosition;
+        bool evictionRequested;      // marked by EnforceBudget of another configuration
+    };
+    typedef std::map<std::string, Entry> EntryMap;
+
+    void RemoveEntry(EntryMap::iterator it);
+
+    // Appends the entries, that may be evicted, in LRU order. Requires the lock of m_mutex.
+    void CollectEvictable(unsigned long long protectedEpoch, std::vector<std::pair<unsigned long long, std::string> >& keys) const;
+
+    mutable boost::mutex m_mutex;
+    EntryMap m_entries;
+    LruList m_lru;                   // least recently used first
+    unsigned long long m_epoch;      // incremented by EnforceBudget
+    size_t m_requestedBytes;         // memory of the entries marked for eviction
+    CTiglCacheStatistics m_stats;
+};
+
+} // namespace tigl
+
+#endif // CTIGLCACHEACCOUNTING_H
@@ -0,0 +1,359 @@
+/*
+* Copyright (C) 2019 German Aerospace Center (DLR/SC)
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*/
+
+#include "CTiglIntegralProperties.h"
+
+#include "CTiglLogging.h"
+#include "CTiglProfiler.h"
+#include "tiglparallel.h"
+
+#include <BRepBndLib.hxx>
+#include <BRepBuilderAPI_Copy.hxx>
+#include <BRepGProp.hxx>
+#include <BRepMesh_IncrementalMesh.hxx>
+#include <BRep_Tool.hxx>
+#include <Bnd_Box.hxx>
+#include <GProp_GProps.hxx>
+#include <Geom_Surface.hxx>
+#include <Poly_Triangulation.hxx>
+#include <TopExp_Explorer.hxx>
+#include <TopoDS.hxx>
+#include <TopoDS_Face.hxx>
+#include <TopoDS_Shape.hxx>
+#include <gp.hxx>
+
+#include <algorithm>
+#include <cmath>
+#include <map>
+#include <vector>
+
+namespace
+{
+    // linear deflection of the triangulation relative to the bounding box diagonal
+    const double RELATIVE_DEFLECTION = 1e-3;
+
+    // Mass, first and second moments with respect to a reference point.
+    // second(i,j) is the integral of x_i * x_j.
+    struct Moments
+    {
+        Moments()
+            : mass(0.)
+        {
+            for (int i = 0; i < 3; ++i) {
+                first[i] = 0.;
+                for (int j = 0; j < 3; ++j) {
+                    second[i][j] = 0.;
+                }
+            }
+        }
+
+        void Add(const Moments& other)
+        {
+            mass += other.mass;
+            for (int i = 0; i < 3; ++i) {
+                first[i] += other.first[i];
+                for (int j = 0; j < 3; ++j) {
+                    second[i][j] += other.second[i][j];
+                }
+            }
+        }
+
+        // adds the properties computed by BRepGProp
+        void Add(const GProp_GProps& props, const gp_Pnt& reference)
+        {
+            const double m = props.Mass();
+            const gp_XYZ d = props.CentreOfMass().XYZ() - reference.XYZ();
+            const gp_Mat inertia = props.MatrixOfInertia();
+            const double halfTrace = 0.5 * (inertia(1, 1) + inertia(2, 2) + inertia(3, 3));
+
+            mass += m;
+            for (int i = 0; i < 3; ++i) {
+                first[i] += m * d.Coord(i + 1);
+                for (int j = 0; j < 3; ++j) {
+                    // second moments about the centre of mass, shifted to the reference point
+                    const double central = (i == j ? halfTrace : 0.) - inertia(i + 1, j + 1);
+                    second[i][j] += central + m * d.Coord(i + 1) * d.Coord(j + 1);
+                }
+            }
+        }
+
+        // adds sum_k(v_k * v_k^T) + s * s^T of the vertices v_k and their sum s scaled by factor
+        void AddVertexProducts(const gp_XYZ* vertices, double factor)
+        {
+            const gp_XYZ s = vertices[0] + vertices[1] + vertices[2];
+            for (int i = 1; i <= 3; ++i) {
+                for (int j = 1; j <= 3; ++j) {
+                    double sum = s.Coord(i) * s.Coord(j);
+                    for (int k = 0; k < 3; ++k) {
+                        sum += vertices[k].Coord(i) * vertices[k].Coord(j);
+                    }
+                    second[i-1][j-1] += factor * sum;
+                }
+            }
+        }
+
+        double mass;
+        double first[3];
+        double second[3][3];
+    };
+
+    struct FaceMoments
+    {
+        Moments volume;
+        Moments surface;
+    };
+
+    // adds the tetrahedron spanned by the triangle and the reference point and the triangle itself
+    void addTriangle(const gp_XYZ* p, bool withVolume, FaceMoments& result)
+    {
+        const gp_XYZ s = p[0] + p[1] + p[2];
+
+        if (withVolume) {
+            const double v = p[0].Dot(p[1].Crossed(p[2])) / 6.;
+            Moments& vol = result.volume;
+            vol.mass += v;
+            for (int i = 0; i < 3; ++i) {
+                vol.first[i] += v * s.Coord(i + 1) / 4.;
+            }
+            vol.AddVertexProducts(p, v / 20.);
+        }
+
+        const double a = 0.5 * (p[1] - p[0]).Crossed(p[2] - p[0]).Modulus();
+        Moments& surf = result.surface;
+        surf.mass += a;
+        for (int i = 0; i < 3; ++i) {
+            surf.first[i] += a * s.Coord(i + 1) / 3.;
+        }
+        surf.AddVertexProducts(p, a / 12.);
+    }
+
+    void setFromMoments(const Moments& moments, const gp_Pnt& reference, tigl::CTiglIntegralProperties& result)
+    {
+        if (std::fabs(moments.mass) < 1e-20) {
+            result.centroid = tigl::CTiglPoint(reference.XYZ());
+            result.inertia = gp_Mat(0., 0., 0., 0., 0., 0., 0., 0., 0.);
+            return;
+        }
+
+        double c[3];
+        for (int i = 0; i < 3; ++i) {
+            c[i] = moments.first[i] / moments.mass;
+        }
+
+        // central second moments
+        double central[3][3];
+        double trace = 0.;
+        for (int i = 0; i < 3; ++i) {
+            for (int j = 0; j < 3; ++j) {
+                central[i][j] = moments.second[i][j] - moments.mass * c[i] * c[j];
+            }
+            trace += central[i][i];
+        }
+
+        for (int i = 0; i < 3; ++i) {
+            for (int j = 0; j < 3; ++j) {
+                result.inertia(i + 1, j + 1) = (i == j ? trace : 0.) - central[i][j];
+            }
+        }
+        result.centroid = tigl::CTiglPoint(reference.X() + c[0], reference.Y() + c[1], reference.Z() + c[2]);
+    }
+
+    // single faces do not enclose a volume
+    bool hasShells(const TopoDS_Shape& shape)
+    {
+        return TopExp_Explorer(shape, TopAbs_SHELL).More();
+    }
+
+    std::vector<TopoDS_Face> collectFaces(const TopoDS_Shape& shape)
+    {
+        std::vector<TopoDS_Face> faces;
+        for (TopExp_Explorer faceExp(shape, TopAbs_FACE); faceExp.More(); faceExp.Next()) {
+            faces.push_back(TopoDS::Face(faceExp.Current()));
+        }
+        return faces;
+    }
+
+    FaceMoments sequentialExact(const TopoDS_Shape& shape, bool withVolume, gp_Pnt& reference)
+    {
+        FaceMoments result;
+
+        GProp_GProps surfaceProps;
+        BRepGProp::SurfaceProperties(shape, surfaceProps);
+        result.surface.Add(surfaceProps, gp::Origin());
+
+        reference = gp::Origin();
+        if (withVolume) {
+            GProp_GProps volumeProps;
+            BRepGProp::VolumeProperties(shape, volumeProps);
+            result.volume.Add(volumeProps, gp::Origin());
+        }
+        return result;
+    }
+
+    FaceMoments integrateExact(const TopoDS_Shape& shape, bool withVolume, gp_Pnt& reference)
+    {
+        const std::vector<TopoDS_Face> faces = collectFaces(shape);
+        if (faces.empty()) {
+            reference = gp::Origin();
+            return FaceMoments();
+        }
+
+        // The volume contribution of a face depends on the reference point of the integration,
+        // which BRepGProp derives from the location of the shape. Only faces with the same
+        // location can be integrated separately.
+        for (size_t i = 1; i < faces.size(); ++i) {
+            if (!faces[i].Location().IsEqual(faces[0].Location())) {
+                return sequentialExact(shape, withVolume, reference);
+            }
+        }
+        reference = gp::Origin().Transformed(faces[0].Location().Transformation());
+
+        // The evaluation of a surface is not thread safe. Faces sharing
+        // a surface are integrated by the same thread.
+        std::map<const Standard_Transient*, size_t> groupOfSurface;
+        std::vector<std::vector<size_t> > groups;
+        for (size_t i = 0; i < faces.size(); ++i) {
+            TopLoc_Location location;
+            const Standard_Transient* surface = BRep_Tool::Surface(faces[i], location).operator->();
+            std::map<const Standard_Transient*, size_t>::iterator it = groupOfSurface.find(surface);
+            if (it == groupOfSurface.end()) {
+                it = groupOfSurface.insert(std::make_pair(surface, groups.size())).first;
+                groups.push_back(std::vector<size_t>());
+            }
+            groups[it->second].push_back(i);
+        }
+
+        std::vector<FaceMoments> groupMoments(groups.size());
+        const gp_Pnt ref = reference;
+        tigl::ParallelForDynamic(groups.size(), [&](size_t igroup) {
+            for (size_t k = 0; k < groups[igroup].size(); ++k) {
+                const TopoDS_Face& face = faces[groups[igroup][k]];
+
+                GProp_GProps surfaceProps;
+                BRepGProp::SurfaceProperties(face, surfaceProps);
+                groupMoments[igroup].surface.Add(surfaceProps, ref);
+
+                if (withVolume) {
+                    GProp_GProps volumeProps;
+                    BRepGProp::VolumeProperties(face, volumeProps);
+                    groupMoments[igroup].volume.Add(volumeProps, ref);
+                }
+            }
+        });
+
+        // sum up in a fixed order to get reproducible results
+        FaceMoments result;
+        for (size_t i = 0; i < groupMoments.size(); ++i) {
+            result.volume.Add(groupMoments[i].volume);
+            result.surface.Add(groupMoments[i].surface);
+        }
+        return result;
+    }
+
+    bool integrateTriangulation(const TopoDS_Shape& shape, bool withVolume, FaceMoments& result)
+    {
+        Bnd_Box boundingBox;
+        BRepBndLib::Add(shape, boundingBox);
+        if (boundingBox.IsVoid()) {
+            return false;
+        }
+
+        double xmin, ymin, zmin, xmax, ymax, zmax;
+        boundingBox.Get(xmin, ymin, zmin, xmax, ymax, zmax);
+        double diagonal = std::sqrt((xmax-xmin)*(xmax-xmin) + (ymax-ymin)*(ymax-ymin) + (zmax-zmin)*(zmax-zmin));
+
+        // mesh a copy, the triangulation of the cached shapes must not be changed
+        TopoDS_Shape copy = BRepBuilderAPI_Copy(shape);
+        BRepMesh_IncrementalMesh(copy, RELATIVE_DEFLECTION * diagonal, Standard_False, 0.5, Standard_True);
+
+        const std::vector<TopoDS_Face> faces = collectFaces(copy);
+        std::vector<FaceMoments> faceMoments(faces.size());
+        std::vector<char> meshed(faces.size(), 0);
+        tigl::ParallelFor(faces.size(), [&](size_t iface) {
+            const TopoDS_Face& face = faces[iface];
+            TopLoc_Location location;
+            const Handle(Poly_Triangulation) triangulation = BRep_Tool::Triangulation(face, location);
+            if (triangulation.IsNull()) {
+                return;
+            }
+            meshed[iface] = 1;
+
+            const gp_Trsf nodeTransformation = location;
+            const bool reversed = face.Orientation() == TopAbs_REVERSED;
+            const TColgp_Array1OfPnt& nodes = triangulation->Nodes();
+            const Poly_Array1OfTriangle& triangles = triangulation->Triangles();
+            for (int j = triangles.Lower(); j <= triangles.Upper(); ++j) {
+                int i1, i2, i3;
+                triangles(j).Get(i1, i2, i3);
+                if (reversed) {
+                    std::swap(i2, i3);
+                }
+                gp_XYZ p[3] = {
+                    nodes(i1).Transformed(nodeTransformation).XYZ(),
+                    nodes(i2).Transformed(nodeTransformation).XYZ(),
+                    nodes(i3).Transformed(nodeTransformation).XYZ()
+                };
+                addTriangle(p, withVolume, faceMoments[iface]);
+            }
+        });
+
+        for (size_t i = 0; i < faces.size(); ++i) {
+            if (!meshed[i]) {
+                return false;
+            }
+            result.volume.Add(faceMoments[i].volume);
+            result.surface.Add(faceMoments[i].surface);
+        }
+        return true;
+    }
+}
+
+namespace tigl
+{
+
+CTiglIntegralProperties ComputeIntegralProperties(const TopoDS_Shape& shape, TiglIntegrationAccuracy accuracy)
+{
+    CTiglScopedTimer timer("ComputeIntegralProperties");
+
+    CTiglIntegralProperties properties;
+    if (shape.IsNull()) {
+        return properties;
+    }
+
+    const bool withVolume = hasShells(shape);
+
+    FaceMoments moments;
+    gp_Pnt reference = gp::Origin();
+    bool done = false;
+    if (accuracy == TIGL_INTEGRATION_FAST) {
+        done = integrateTriangulation(shape, withVolume, moments);
+        if (!done) {
+            LOG(WARNING) << "Could not triangulate all faces of the shape. Falling back to the exact integration.";
+            moments = FaceMoments();
+        }
+    }
+    if (!done) {
+        moments = integrateExact(shape, withVolume, reference);
+    }
+
+    properties.volume      = moments.volume.mass;
+    properties.surfaceArea = moments.surface.mass;
+    const bool hasVolume = withVolume && std::fabs(properties.volume) > 1e-20;
+    setFromMoments(hasVolume ? moments.volume : moments.surface, reference, properties);
+    return properties;
+}
+
+} // namespace tigl
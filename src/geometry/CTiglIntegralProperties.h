@@ -0,0 +1,63 @@
+/*
+* Copyright (C) 2019 German Aerospace Center (DLR/SC)
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*/
+/**
+* @file
+* @brief Volume, area, centroid and inertia of shapes
+*/
+
+#ifndef CTIGLINTEGRALPROPERTIES_H
+#define CTIGLINTEGRALPROPERTIES_H
+
+#include "tigl.h"
+#include "tigl_internal.h"
+#include "CTiglPoint.h"
+
+#include <gp_Mat.hxx>
+
+class TopoDS_Shape;
+
+namespace tigl
+{
+
+/// Integral properties of a shape with unit density
+struct CTiglIntegralProperties
+{
+    CTiglIntegralProperties()
+        : volume(0.)
+        , surfaceArea(0.)
+    {
+    }
+
+    double volume;        ///< Volume enclosed by the shells, zero for shapes without shells
+    double surfaceArea;   ///< Area of all faces
+    CTiglPoint centroid;  ///< Center of the volume, center of the surface for shapes without volume
+    gp_Mat inertia;       ///< Inertia tensor about the centroid, off-diagonal entries are the negative products of inertia
+};
+
+/**
+ * @brief Integrates the volume, surface area, centroid and inertia of a shape
+ *
+ * The faces are integrated concurrently. TIGL_INTEGRATION_EXACT uses the Gauss
+ * integration of BRepGProp. TIGL_INTEGRATION_FAST integrates a triangulation of a
+ * copy of the shape. It is much faster for large shapes, but the relative error
+ * is about 1e-3.
+ */
+TIGL_EXPORT CTiglIntegralProperties ComputeIntegralProperties(const TopoDS_Shape& shape,
+                                                              TiglIntegrationAccuracy accuracy = TIGL_INTEGRATION_EXACT);
+
+} // namespace tigl
+
+#endif // CTIGLINTEGRALPROPERTIES_H
@@ -0,0 +1,340 @@
+/*
+* Copyright (C) 2019 German Aerospace Center (DLR/SC)
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*/
+
+#include "CTiglLoftDiskCache.h"
+
+#include "CNamedShape.h"
+#include "CTiglError.h"
+#include "CTiglLogging.h"
+
+#include <BRepTools.hxx>
+#include <BRep_Builder.hxx>
+#include <TopoDS_Shape.hxx>
+
+#include <boost/filesystem.hpp>
+#include <boost/thread/lock_guard.hpp>
+#include <boost/thread/mutex.hpp>
+
+#include <algorithm>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <sstream>
+#include <stdint.h>
+
+namespace
+{
+    // increase, whenever the file format changes
+    const char* const FILE_HEADER = "TIGL_LOFT_CACHE 1";
+
+    boost::mutex& directoryMutex()
+    {
+        static boost::mutex mutex;
+        return mutex;
+    }
+
+    std::string& directoryStorage()
+    {
+        static std::string directory;
+        return directory;
+    }
+
+    // SHA-256 (FIPS 180-4)
+    class Sha256
+    {
+    public:
+        Sha256()
+            : m_length(0)
+            , m_bufferSize(0)
+        {
+            const uint32_t init[8] = {0x6a09e667, 0xbb67ae85, 0x3c6ef372, 0xa54ff53a,
+                                      0x510e527f, 0x9b05688c, 0x1f83d9ab, 0x5be0cd19};
+            std::copy(init, init + 8, m_state);
+        }
+
+        void Update(const unsigned char* data, size_t size)
+        {
+            m_length += size;
+            while (size > 0) {
+                const size_t n = std::min(size, sizeof(m_buffer) - m_bufferSize);
+                std::memcpy(m_buffer + m_bufferSize, data, n);
+                m_bufferSize += n;
+                data += n;
+                size -= n;
+                if (m_bufferSize == sizeof(m_buffer)) {
+                    ProcessBlock();
+                    m_bufferSize = 0;
+                }
+            }
+        }
+
+        std::string HexDigest()
+        {
+            // padding with a single one bit and the message length in bits
+            const uint64_t bitLength = static_cast<uint64_t>(m_length) * 8;
+            const unsigned char one = 0x80;
+            const unsigned char zero = 0;
+            Update(&one, 1);
+            while (m_bufferSize != 56) {
+                Update(&zero, 1);
+            }
+            unsigned char lengthBytes[8];
+            for (int i = 0; i < 8; ++i) {
+                lengthBytes[i] = static_cast<unsigned char>(bitLength >> (56 - 8 * i));
+            }
+            Update(lengthBytes, 8);
+
+            char buffer[65];
+            for (int i = 0; i < 8; ++i) {
+                std::snprintf(buffer + 8 * i, 9, "%08x", static_cast<unsigned int>(m_state[i]));
+            }
+            return buffer;
+        }
+
+    private:
+        static uint32_t rotr(uint32_t x, int n)
+        {
+            return (x >> n) | (x << (32 - n));
+        }
+
+        void ProcessBlock()
+        {
+            static const uint32_t k[64] = {
+                0x428a2f98, 0x71374491, 0xb5c0fbcf, 0xe9b5dba5, 0x3956c25b, 0x59f111f1, 0x923f82a4, 0xab1c5ed5,
+                0xd807aa98, 0x12835b01, 0x243185be, 0x550c7dc3, 0x72be5d74, 0x80deb1fe, 0x9bdc06a7, 0xc19bf174,
+                0xe49b69c1, 0xefbe4786, 0x0fc19dc6, 0x240ca1cc, 0x2de92c6f, 0x4a7484aa, 0x5cb0a9dc, 0x76f988da,
+                0x983e5152, 0xa831c66d, 0xb00327c8, 0xbf597fc7, 0xc6e00bf3, 0xd5a79147, 0x06ca6351, 0x14292967,
+                0x27b70a85, 0x2e1b2138, 0x4d2c6dfc, 0x53380d13, 0x650a7354, 0x766a0abb, 0x81c2c92e, 0x92722c85,
+                0xa2bfe8a1, 0xa81a664b, 0xc24b8b70, 0xc76c51a3, 0xd192e819, 0xd6990624, 0xf40e3585, 0x106aa070,
+                0x19a4c116, 0x1e376c08, 0x2748774c, 0x34b0bcb5, 0x391c0cb3, 0x4ed8aa4a, 0x5b9cca4f, 0x682e6ff3,
+                0x748f82ee, 0x78a5636f, 0x84c87814, 0x8cc70208, 0x90befffa, 0xa4506ceb, 0xbef9a3f7, 0xc67178f2
+            };
+
+            uint32_t w[64];
+            for (int i = 0; i < 16; ++i) {
+                w[i] = (static_cast<uint32_t>(m_buffer[4 * i]) << 24) | (static_cast<uint32_t>(m_buffer[4 * i + 1]) << 16)
+                     | (static_cast<uint32_t>(m_buffer[4 * i + 2]) << 8) | static_cast<uint32_t>(m_buffer[4 * i + 3]);
+            }
+            for (int i = 16; i < 64; ++i) {
+                const uint32_t s0 = rotr(w[i - 15], 7) ^ rotr(w[i - 15], 18) ^ (w[i - 15] >> 3);
+                const uint32_t s1 = rotr(w[i - 2], 17) ^ rotr(w[i - 2], 19) ^ (w[i - 2] >> 10);
+                w[i] = w[i - 16] + s0 + w[i - 7] + s1;
+            }
+
+            uint32_t a = m_state[0], b = m_state[1], c = m_state[2], d = m_state[3];
+            uint32_t e = m_state[4], f = m_state[5], g = m_state[6], h = m_state[7];
+            for (int i = 0; i < 64; ++i) {
+                const uint32_t t1 = h + (rotr(e, 6) ^ rotr(e, 11) ^ rotr(e, 25)) + ((e & f) ^ (~e & g)) + k[i] + w[i];
+                const uint32_t t2 = (rotr(a, 2) ^ rotr(a, 13) ^ rotr(a, 22)) + ((a & b) ^ (a & c) ^ (b & c));
+                h = g;
+                g = f;
+                f = e;
+                e = d + t1;
+                d = c;
+                c = b;
+                b = a;
+                a = t1 + t2;
+            }
+            m_state[0] += a;
+            m_state[1] += b;
+            m_state[2] += c;
+            m_state[3] += d;
+            m_state[4] += e;
+            m_state[5] += f;
+            m_state[6] += g;
+            m_state[7] += h;
+        }
+
+        uint32_t m_state[8];
+        unsigned char m_buffer[64];
+        size_t m_length;
+        size_t m_bufferSize;
+    };
+
+    std::string entryPath(const std::string& directory, const std::string& key, const char* extension)
+    {
+        return (boost::filesystem::path(directory) / (key + extension)).string();
+    }
+
+    bool readLine(std::istream& in, std::string& line)
+    {
+        if (!std::getline(in, line)) {
+            return false;
+        }
+        // tolerate files copied between platforms
+        if (!line.empty() && line[line.size() - 1] == '\r') {
+            line.erase(line.size() - 1);
+        }
+        return true;
+    }
+
+    // writes to a temporary file first and renames it afterwards,
+    // such that concurrent processes never see partially written entries
+    bool commitFile(const boost::filesystem::path& tmpFile, const std::string& target)
+    {
+        boost::system::error_code ec;
+        boost::filesystem::rename(tmpFile, target, ec);
+        if (ec) {
+            boost::filesystem::remove(tmpFile, ec);
+            return false;
+        }
+        return true;
+    }
+}
+
+namespace tigl
+{
+
+void CTiglLoftDiskCache::SetDirectory(const std::string& directory)
+{
+    if (!directory.empty()) {
+        boost::system::error_code ec;
+        boost::filesystem::create_directories(directory, ec);
+        if (ec || !boost::filesystem::is_directory(directory, ec)) {
+            throw CTiglError("Cannot create loft cache directory \"" + directory + "\" in CTiglLoftDiskCache::SetDirectory", TIGL_OPEN_FAILED);
+        }
+    }
+
+    boost::lock_guard<boost::mutex> lock(directoryMutex());
+    directoryStorage() = directory;
+}
+
+std::string CTiglLoftDiskCache::GetDirectory()
+{
+    boost::lock_guard<boost::mutex> lock(directoryMutex());
+    return directoryStorage();
+}
+
+bool CTiglLoftDiskCache::IsEnabled()
+{
+    return !GetDirectory().empty();
+}
+
+std::string CTiglLoftDiskCache::Hash(const std::string& data)
+{
+    Sha256 sha;
+    sha.Update(reinterpret_cast<const unsigned char*>(data.data()), data.size());
+    return sha.HexDigest();
+}
+
+PNamedShape CTiglLoftDiskCache::Load(const std::string& key)
+{
+    const std::string directory = GetDirectory();
+    if (directory.empty()) {
+        return PNamedShape();
+    }
+
+    std::ifstream names(entryPath(directory, key, ".names").c_str());
+    if (!names) {
+        return PNamedShape();
+    }
+
+    std::string header, name, shortName, countLine;
+    if (!readLine(names, header) || header != FILE_HEADER ||
+        !readLine(names, name) || !readLine(names, shortName) || !readLine(names, countLine)) {
+        LOG(WARNING) << "Invalid loft cache entry " << key << ". Rebuilding the loft.";
+        return PNamedShape();
+    }
+
+    unsigned int nFaces = 0;
+    std::istringstream(countLine) >> nFaces;
+
+    TopoDS_Shape shape;
+    BRep_Builder builder;
+    if (!BRepTools::Read(shape, entryPath(directory, key, ".brep").c_str(), builder) || shape.IsNull()) {
+        LOG(WARNING) << "Cannot read loft cache entry " << key << ". Rebuilding the loft.";
+        return PNamedShape();
+    }
+
+    PNamedShape loft(new CNamedShape(shape, name, shortName));
+    if (loft->GetFaceCount() != nFaces) {
+        LOG(WARNING) << "Inconsistent loft cache entry " << key << ". Rebuilding the loft.";
+        return PNamedShape();
+    }
+
+    for (unsigned int iFace = 0; iFace < nFaces; ++iFace) {
+        std::string faceName, componentUID;
+        if (!readLine(names, faceName) || !readLine(names, componentUID)) {
+            LOG(WARNING) << "Invalid loft cache entry " << key << ". Rebuilding the loft.";
+            return PNamedShape();
+        }
+        CFaceTraits& traits = loft->FaceTraits(static_cast<int>(iFace));
+        traits.SetName(faceName);
+        traits.SetComponentUID(componentUID);
+    }
+
+    return loft;
+}
+
+bool CTiglLoftDiskCache::Store(const std::string& key, const PNamedShape& loft)
+{
+    const std::string directory = GetDirectory();
+    if (directory.empty() || !loft || loft->Shape().IsNull()) {
+        return false;
+    }
+
+    // faces referring to other shapes cannot be restored from disk
+    const unsigned int nFaces = loft->GetFaceCount();
+    for (unsigned int iFace = 0; iFace < nFaces; ++iFace) {
+        if (loft->GetFaceTraits(static_cast<int>(iFace)).Origin()) {
+            return false;
+        }
+    }
+
+    std::ostringstream names;
+    names << FILE_HEADER << "\n"
+          << loft->Name() << "\n"
+          << loft->ShortName() << "\n"
+          << nFaces << "\n";
+    for (unsigned int iFace = 0; iFace < nFaces; ++iFace) {
+        const CFaceTraits& traits = loft->GetFaceTraits(static_cast<int>(iFace));
+        names << traits.Name() << "\n" << traits.ComponentUID() << "\n";
+    }
+
+    boost::system::error_code ec;
+    const boost::filesystem::path tmpBrep = boost::filesystem::path(directory) / boost::filesystem::unique_path("%%%%-%%%%-%%%%.brep.tmp", ec);
+    const boost::filesystem::path tmpNames = boost::filesystem::path(directory) / boost::filesystem::unique_path("%%%%-%%%%-%%%%.names.tmp", ec);
+    if (ec) {
+        return false;
+    }
+
+    if (!BRepTools::Write(loft->Shape(), tmpBrep.string().c_str())) {
+        boost::filesystem::remove(tmpBrep, ec);
+        LOG(WARNING) << "Cannot write loft cache entry " << key << ".";
+        return false;
+    }
+
+    {
+        std::ofstream out(tmpNames.string().c_str());
+        out << names.str();
+        if (!out) {
+            boost::filesystem::remove(tmpBrep, ec);
+            boost::filesystem::remove(tmpNames, ec);
+            LOG(WARNING) << "Cannot write loft cache entry " << key << ".";
+            return false;
+        }
+    }
+
+    // The brep file is committed first. As a load requires the names file,
+    // a reader never sees an entry without its shape.
+    if (!commitFile(tmpBrep, entryPath(directory, key, ".brep"))) {
+        boost::filesystem::remove(tmpNames, ec);
+        return false;
+    }
+    return commitFile(tmpNames, entryPath(directory, key, ".names"));
+}
+
+} // namespace tigl
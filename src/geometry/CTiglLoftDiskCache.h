@@ -0,0 +1,96 @@
+/*
+* Copyright (C) 2019 German Aerospace Center (DLR/SC)
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*/
+
+#ifndef CTIGLLOFTDISKCACHE_H
+#define CTIGLLOFTDISKCACHE_H
+
+#include "tigl_internal.h"
+#include "PNamedShape.h"
+
+#include <atomic>
+#include <functional>
+#include <string>
+
+namespace tigl
+{
+
+/**
+ * @brief Persistent storage of component lofts across process runs
+ *
+ * Each loft is stored as <key>.brep together with a <key>.names file
+ * containing the shape and face names. The keys are content hashes
+ * computed by the caller, i.e. an entry is never invalidated but simply
+ * not found anymore, if the geometry changes.
+ *
+ * The cache is disabled by default and enabled by setting a directory.
+ */
+class CTiglLoftDiskCache
+{
+public:
+    /// Sets the cache directory and creates it, if required. An empty string disables the cache.
+    /// Only configurations opened afterwards use the cache.
+    TIGL_EXPORT static void SetDirectory(const std::string& directory);
+
+    /// Returns the cache directory or an empty string, if the cache is disabled
+    TIGL_EXPORT static std::string GetDirectory();
+
+    TIGL_EXPORT static bool IsEnabled();
+
+    /// Returns the SHA-256 digest of the data as hex string, usable as cache key
+    TIGL_EXPORT static std::string Hash(const std::string& data);
+
+    /// Returns the stored loft with the given key or a null pointer, if no valid entry exists
+    TIGL_EXPORT static PNamedShape Load(const std::string& key);
+
+    /// Stores the loft with the given key. Returns false, if the loft could not be stored.
+    TIGL_EXPORT static bool Store(const std::string& key, const PNamedShape& loft);
+};
+
+/**
+ * @brief Shared state of all components of one configuration regarding the disk cache
+ *
+ * The document hash is computed once after reading the configuration. As soon as
+ * any geometry of the configuration is modified, the context is invalidated and
+ * the disk cache is bypassed for all components of the configuration.
+ * Modifications by the setters of the CPACS objects are detected by isModified,
+ * even if no loft has been built before.
+ */
+struct CTiglLoftCacheContext
+{
+    CTiglLoftCacheContext(const std::string& documentHash, const std::function<bool()>& isModified)
+        : documentHash(documentHash)
+        , isModified(isModified)
+        , valid(true)
+    {
+    }
+
+    /// Returns whether the configuration still matches the document hash
+    bool IsValid()
+    {
+        if (valid && isModified && isModified()) {
+            valid = false;
+        }
+        return valid;
+    }
+
+    const std::string documentHash;
+    const std::function<bool()> isModified;
+    std::atomic<bool> valid;
+};
+
+} // namespace tigl
+
+#endif // CTIGLLOFTDISKCACHE_H
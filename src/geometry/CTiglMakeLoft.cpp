@@ -27,6 +27,7 @@
 #include "CTiglPatchShell.h"
 #include "Debugging.h"
 #include "to_string.h"
+#include "tiglparallel.h"
 
 #include "contrib/MakePatches.hxx"
 
@@ -52,6 +53,8 @@
 #include <GProp_GProps.hxx>
 #include <BRep_Tool.hxx>
 
+#include <memory>
+
 namespace {
     TopoDS_Shape CutShellAtUVParameters(TopoDS_Shape const& shape, std::vector<double> uparams, std::vector<double> vparams);
     TopoDS_Shape ResortFaces(TopoDS_Shape const& shape, int nu, int nv, bool umajor2vmajor = true);
@@ -150,6 +153,11 @@ void CTiglMakeLoft::setMakeSmooth(bool enabled)
     _makeSmooth = enabled;
 }
 
+void CTiglMakeLoft::setRunParallel(bool enabled)
+{
+    _runParallel = enabled;
+}
+
 /**
  * @brief Builds the loft using profiles and guide curves
  */
@@ -243,49 +251,61 @@ void CTiglMakeLoft::makeLoftWithGuides()
 
 void CTiglMakeLoft::makeLoftWithoutGuides()
 {
-    TopoDS_Shell faces;
-    BRep_Builder builder;
-    builder.MakeShell(faces);
-
     // get number of edges per profile wire
     // --> should be the same for all profiles
-    TopTools_IndexedMapOfShape firstProfileMap;
-    TopExp::MapShapes(profiles[0], TopAbs_EDGE, firstProfileMap);
-    int const nEdgesPerProfile = firstProfileMap.Extent();
+    std::vector<TopTools_IndexedMapOfShape> profileMaps(profiles.size());
+    for (unsigned iP=0; iP<profiles.size(); ++iP ) {
+        TopExp::MapShapes(profiles[iP], TopAbs_EDGE, profileMaps[iP]);
+    }
+    int const nEdgesPerProfile = profileMaps[0].Extent();
 
-    // skin the surface edge by adge
+    // get the curves of each strip
     // CAUTION: Here it is assumed that the edges are ordered
     // in the same way along each profile (e.g. lower edge,
     // upper edge, trailing edge for a wing)
+    std::vector<std::vector<Handle(Geom_Curve)> > stripCurves(nEdgesPerProfile);
     for ( int iE = 1; iE <= nEdgesPerProfile; ++iE ) {
-
-        // get the curves
-        std::vector<Handle(Geom_Curve)> profileCurves;
+        std::vector<Handle(Geom_Curve)>& profileCurves = stripCurves[iE-1];
         profileCurves.reserve(profiles.size());
         for (unsigned iP=0; iP<profiles.size(); ++iP ) {
+            assert( profileMaps[iP].Extent() >= iE );
 
-            TopTools_IndexedMapOfShape profileMap;
-            TopExp::MapShapes(profiles[iP], TopAbs_EDGE, profileMap);
-            assert( profileMap.Extent() >= iE );
-
-            TopoDS_Edge edge = TopoDS::Edge(profileMap(iE));
+            TopoDS_Edge edge = TopoDS::Edge(profileMaps[iP](iE));
             profileCurves.push_back(GetBSplineCurve(edge));
         }
+    }
 
-        // skin the curves
-        tigl::CTiglCurvesToSurface surfaceSkinner(profileCurves, vparams);
-        if (!_makeSmooth) {
-            surfaceSkinner.SetMaxDegree(1);
-        }
-        Handle(Geom_BSplineSurface) surface = surfaceSkinner.Surface();
+    // the profile parameters of the first strip are used for all strips
+    std::unique_ptr<tigl::CTiglCurvesToSurface> firstSkinner;
+    if (vparams.size()==0) {
+        firstSkinner.reset(new tigl::CTiglCurvesToSurface(stripCurves[0], vparams));
+        vparams = firstSkinner->GetParameters();
+    }
 
-        // remember the profile parameters used for the skinning
-        if (vparams.size()==0) {
-            vparams = surfaceSkinner.GetParameters();
+    // skin the surface edge by edge, the strips are independent
+    std::vector<TopoDS_Face> stripFaces(nEdgesPerProfile);
+    tigl::ParallelFor(stripCurves.size(), [&](size_t iE) {
+        std::unique_ptr<tigl::CTiglCurvesToSurface> surfaceSkinner;
+        if (iE == 0 && firstSkinner) {
+            surfaceSkinner.swap(firstSkinner);
+        }
+        else {
+            surfaceSkinner.reset(new tigl::CTiglCurvesToSurface(stripCurves[iE], vparams));
         }
+        if (!_makeSmooth) {
+            surfaceSkinner->SetMaxDegree(1);
+        }
+        Handle(Geom_BSplineSurface) surface = surfaceSkinner->Surface();
 
         BRepBuilderAPI_MakeFace faceMaker(surface, 1e-10);
-        builder.Add(faces, faceMaker.Face());
+        stripFaces[iE] = faceMaker.Face();
+    }, _runParallel ? 0 : 1);
+
+    TopoDS_Shell faces;
+    BRep_Builder builder;
+    builder.MakeShell(faces);
+    for (size_t iE = 0; iE < stripFaces.size(); ++iE) {
+        builder.Add(faces, stripFaces[iE]);
     }
     _result = CutShellAtUVParameters(faces, uparams, vparams);
 
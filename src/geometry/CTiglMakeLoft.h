@@ -66,6 +66,15 @@ public:
      * @param enabled Set to true, if smoothing should be enabled.
      */
     TIGL_EXPORT void setMakeSmooth(bool enabled);
+
+    /**
+     * @brief setRunParallel switches, whether the surface strips between the
+     * profile edges are skinned concurrently. This switch only applies, if no
+     * guide curves are applied. The result does not depend on it. Enabled by default.
+     *
+     * @param enabled Set to false, to skin all strips in the calling thread.
+     */
+    TIGL_EXPORT void setRunParallel(bool enabled);
     
     TIGL_EXPORT TopoDS_Shape& Shape();
     
@@ -106,6 +115,7 @@ private:
     std::vector<Standard_Real> uparams, vparams;
     bool _hasPerformed, _makeSolid;
     bool _makeSmooth = false;
+    bool _runParallel = true;
     
     TopoDS_Shape _result;
 };
@@ -20,6 +20,7 @@
 
 #include "CTiglError.h"
 #include "CTiglBSplineAlgorithms.h"
+#include "CTiglBandedMatrix.h"
 
 #include <BSplCLib.hxx>
 #include <math_Gauss.hxx>
@@ -104,36 +105,20 @@ CTiglPointsToBSplineInterpolation::CTiglPointsToBSplineInterpolation(const Handl
 Handle(Geom_BSplineCurve) CTiglPointsToBSplineInterpolation::Curve() const
 {
     int degree = static_cast<int>(Degree());
+    bool closed = isClosed();
 
     std::vector<double> params = m_params;
 
     std::vector<double> knots =
-        CTiglBSplineAlgorithms::knotsFromCurveParameters(params, static_cast<unsigned int>(degree), isClosed());
+        CTiglBSplineAlgorithms::knotsFromCurveParameters(params, static_cast<unsigned int>(degree), closed);
 
-    if (isClosed()) {
+    if (closed) {
         // we remove the last parameter, since it is implicitly
         // included by wrapping the control points
         params.pop_back();
     }
 
-    math_Matrix bsplMat =
-        CTiglBSplineAlgorithms::bsplineBasisMat(degree, toArray(knots)->Array1(), toArray(params)->Array1());
-
-    // build left hand side of the linear system
     int nParams = static_cast<int>(params.size());
-    math_Matrix lhs(1, nParams, 1, nParams, 0.);
-    for (int iCol = 1; iCol <= nParams; ++iCol) {
-        lhs.SetCol(iCol, bsplMat.Col(iCol));
-    }
-    if (isClosed()) {
-        // sets the continuity constraints for closed curves on the left hand side if requested
-        // by wrapping around the control points
-
-        // This is a trick to make the matrix square and enforce the endpoint conditions
-        for (int iCol = 1; iCol <= degree; ++iCol) {
-            lhs.SetCol(iCol, lhs.Col(iCol) + bsplMat.Col(nParams + iCol));
-        }
-    }
 
     // right hand side
     math_Vector rhsx(1, nParams, 0.);
@@ -146,29 +131,23 @@ Handle(Geom_BSplineCurve) CTiglPointsToBSplineInterpolation::Curve() const
         rhsz(i)         = p.Z();
     }
 
-    math_Gauss solver(lhs);
-
     math_Vector cp_x(1, nParams);
     math_Vector cp_y(1, nParams);
     math_Vector cp_z(1, nParams);
 
-    solver.Solve(rhsx, cp_x);
-    if (!solver.IsDone()) {
-        throw CTiglError("Singular Matrix", TIGL_MATH_ERROR);
+    // The interpolation matrix of open curves is banded. For many points,
+    // solving it as a banded system is much faster than the dense solver.
+    // The wrapped control points of closed curves destroy the band structure.
+    bool solved = false;
+    if (!closed) {
+        solved = solveBanded(degree, knots, params, rhsx, rhsy, rhsz, cp_x, cp_y, cp_z);
     }
-
-    solver.Solve(rhsy, cp_y);
-    if (!solver.IsDone()) {
-        throw CTiglError("Singular Matrix", TIGL_MATH_ERROR);
-    }
-
-    solver.Solve(rhsz, cp_z);
-    if (!solver.IsDone()) {
-        throw CTiglError("Singular Matrix", TIGL_MATH_ERROR);
+    if (!solved) {
+        solveDense(degree, closed, knots, params, rhsx, rhsy, rhsz, cp_x, cp_y, cp_z);
     }
 
     int nCtrPnts = static_cast<int>(m_params.size());
-    if (isClosed()) {
+    if (closed) {
         nCtrPnts += degree - 1;
     }
     if (needsShifting()) {
@@ -180,7 +159,7 @@ Handle(Geom_BSplineCurve) CTiglPointsToBSplineInterpolation::Curve() const
         poles.SetValue(icp, pnt);
     }
 
-    if (isClosed()) {
+    if (closed) {
         // wrap control points
         for (Standard_Integer icp = 1; icp <= degree; ++icp) {
             gp_Pnt pnt(cp_x.Value(icp), cp_y.Value(icp), cp_z.Value(icp));
@@ -209,13 +188,82 @@ Handle(Geom_BSplineCurve) CTiglPointsToBSplineInterpolation::Curve() const
     Handle(Geom_BSplineCurve) result = new Geom_BSplineCurve(poles, occKnots, occMults, degree, false);
 
     // clamp bspline
-    if (isClosed()) {
+    if (closed) {
         clamp(result, m_params.front(), m_params.back());
     }
 
     return result;
 }
 
+bool CTiglPointsToBSplineInterpolation::solveBanded(int degree, const std::vector<double>& knots, const std::vector<double>& params,
+                                                    const math_Vector& rhsx, const math_Vector& rhsy, const math_Vector& rhsz,
+                                                    math_Vector& cp_x, math_Vector& cp_y, math_Vector& cp_z) const
+{
+    if (knots.size() != params.size() + static_cast<size_t>(degree) + 1) {
+        // not a square system
+        return false;
+    }
+
+    CTiglBandedMatrix lhs =
+        CTiglBSplineAlgorithms::bsplineBasisBandedMat(degree, toArray(knots)->Array1(), toArray(params)->Array1());
+
+    if (!CTiglBandedMatrix::IsEfficientFor(lhs.Size(), lhs.LowerBandwidth(), lhs.UpperBandwidth())) {
+        return false;
+    }
+
+    CTiglBandedLU solver(lhs);
+    if (!solver.IsDone()) {
+        // let the dense solver decide, whether the matrix is really singular
+        return false;
+    }
+
+    solver.Solve(rhsx, cp_x);
+    solver.Solve(rhsy, cp_y);
+    solver.Solve(rhsz, cp_z);
+    return true;
+}
+
+void CTiglPointsToBSplineInterpolation::solveDense(int degree, bool closed, const std::vector<double>& knots, const std::vector<double>& params,
+                                                    const math_Vector& rhsx, const math_Vector& rhsy, const math_Vector& rhsz,
+                                                    math_Vector& cp_x, math_Vector& cp_y, math_Vector& cp_z) const
+{
+    math_Matrix bsplMat =
+        CTiglBSplineAlgorithms::bsplineBasisMat(degree, toArray(knots)->Array1(), toArray(params)->Array1());
+
+    // build left hand side of the linear system
+    int nParams = static_cast<int>(params.size());
+    math_Matrix lhs(1, nParams, 1, nParams, 0.);
+    for (int iCol = 1; iCol <= nParams; ++iCol) {
+        lhs.SetCol(iCol, bsplMat.Col(iCol));
+    }
+    if (closed) {
+        // sets the continuity constraints for closed curves on the left hand side if requested
+        // by wrapping around the control points
+
+        // This is a trick to make the matrix square and enforce the endpoint conditions
+        for (int iCol = 1; iCol <= degree; ++iCol) {
+            lhs.SetCol(iCol, lhs.Col(iCol) + bsplMat.Col(nParams + iCol));
+        }
+    }
+
+    math_Gauss solver(lhs);
+
+    solver.Solve(rhsx, cp_x);
+    if (!solver.IsDone()) {
+        throw CTiglError("Singular Matrix", TIGL_MATH_ERROR);
+    }
+
+    solver.Solve(rhsy, cp_y);
+    if (!solver.IsDone()) {
+        throw CTiglError("Singular Matrix", TIGL_MATH_ERROR);
+    }
+
+    solver.Solve(rhsz, cp_z);
+    if (!solver.IsDone()) {
+        throw CTiglError("Singular Matrix", TIGL_MATH_ERROR);
+    }
+}
+
 double CTiglPointsToBSplineInterpolation::maxDistanceOfBoundingBox(const TColgp_Array1OfPnt& points) const
 {
     double maxDistance = 0.;
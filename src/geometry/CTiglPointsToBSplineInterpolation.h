@@ -24,6 +24,7 @@
 #include <Geom_BSplineCurve.hxx>
 #include <TColgp_HArray1OfPnt.hxx>
 #include <math_Matrix.hxx>
+#include <math_Vector.hxx>
 #include <vector>
 
 namespace tigl
@@ -63,6 +64,17 @@ private:
 
     bool needsShifting() const;
 
+    /// Solves the interpolation system of an open curve as a banded system.
+    /// Returns false, if the dense solver should be used instead
+    bool solveBanded(int degree, const std::vector<double>& knots, const std::vector<double>& params,
+                     const math_Vector& rhsx, const math_Vector& rhsy, const math_Vector& rhsz,
+                     math_Vector& cp_x, math_Vector& cp_y, math_Vector& cp_z) const;
+
+    /// Solves the interpolation system using a dense gauss solver
+    void solveDense(int degree, bool closed, const std::vector<double>& knots, const std::vector<double>& params,
+                    const math_Vector& rhsx, const math_Vector& rhsy, const math_Vector& rhsz,
+                    math_Vector& cp_x, math_Vector& cp_y, math_Vector& cp_z) const;
+
     /// curve coordinates to be fitted by the B-spline
     const Handle(TColgp_HArray1OfPnt) & m_pnts;
 
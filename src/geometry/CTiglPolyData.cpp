@@ -29,10 +29,14 @@
 
 #include <iostream>
 #include <cassert>
+#include <climits>
+#include <cmath>
+#include <iterator>
 #include <vector>
 #include <map>
-#include <set>
+#include <unordered_map>
 #include <utility>
+#include <stdint.h>
 
 #include <fstream>
 #include <cfloat>
@@ -45,170 +49,121 @@ using namespace tigl;
 #endif
 
 
+// squared distance, below which two points are considered as equal
 #define COMP_TOLERANCE 1.e-10
 
-
-struct TiglPointComparer;
-
-class PointImpl 
+namespace
 {
-public:
-    PointImpl() : 
-        p_(CTiglPoint(0,0,0)),
-        n_(CTiglPoint(1,0,0)) 
-    {
-    }
+    // the welding distance, i.e. sqrt(COMP_TOLERANCE)
+    const double WELD_DISTANCE = 1.e-5;
 
-    PointImpl(const CTiglPoint& p, const CTiglPoint& n) : p_(p), n_(n) 
-    {
-        realDataMap.clear();
-    }
+    // edge length of the cells of the welding grid. As the cells are at least
+    // twice as large as the welding distance, a point has to be compared
+    // with the points of at most 2x2x2 cells.
+    const double GRID_CELL_SIZE = 2. * WELD_DISTANCE;
 
-    CTiglPoint& point(){ return p_; }
-    CTiglPoint& normal(){ return n_; }
+    const unsigned long NO_VERTEX = ULONG_MAX;
 
-    const CTiglPoint& getPoint() const { return p_; }
-    const CTiglPoint& getNormal()const { return n_; }
-    
-    void setRealData(const char * txt, double value)
+    struct GridCell
     {
-        realDataMap[txt] = value;
-    }
-    
-    double getRealData(const char * txt) const 
-    {
-        std::map<std::string, double>::const_iterator it=realDataMap.find(txt);
-        if (it != realDataMap.end()) {
-            return it->second;
-        }
-        else {
-            return UNDEFINED_REAL;
+        GridCell(int64_t x, int64_t y, int64_t z)
+            : ix(x), iy(y), iz(z)
+        {
         }
-    }
 
-private:
-    CTiglPoint p_;
-    CTiglPoint n_;
-    
-    std::map<std::string, double> realDataMap;
-};
+        bool operator==(const GridCell& other) const
+        {
+            return ix == other.ix && iy == other.iy && iz == other.iz;
+        }
 
-typedef std::map<PointImpl, unsigned int, TiglPointComparer> PointMap;
+        int64_t ix, iy, iz;
+    };
 
-// Comparer for gp_Pnts
-struct TiglPointComparer
-{
-    bool isSmaller(const CTiglPoint& lhs, const CTiglPoint& rhs) const 
+    struct GridCellHash
     {
-        // if two points lie inside the epsilon environment
-        // they should be the same, hence lhs is not smaller than rhs
-        if (lhs.distance2(rhs) < COMP_TOLERANCE ) {
-            return false;
+        size_t operator()(const GridCell& c) const
+        {
+            return static_cast<size_t>(c.ix * 73856093LL) ^ static_cast<size_t>(c.iy * 19349663LL) ^ static_cast<size_t>(c.iz * 83492791LL);
         }
+    };
 
-
-        // as lhs and rhs don't lie inside an epsilon environment
-        if (lhs.x < rhs.x) {
-            return true;
-        }
-        else if (lhs.x == rhs.x) {
-            if (lhs.y < rhs.y) {
-                return true;
-            }
-            else if (lhs.y == rhs.y) {
-                return lhs.z < rhs.z;
-            }
-            else {
-                return false;
-            }
-        }
-        else {
-            return false;
-        }
+    inline int64_t gridIndex(double coordinate)
+    {
+        return static_cast<int64_t>(std::floor(coordinate / GRID_CELL_SIZE));
     }
 
-
-    // function should only return true, if lhs < rhs
-    bool operator()(const PointImpl& lhs, const PointImpl& rhs) const
+    inline double distance2(const double* a, const CTiglPoint& b)
     {
-        const CTiglPoint& leftP  = lhs.getPoint();
-        const CTiglPoint& rightP = rhs.getPoint();
-
-        const CTiglPoint& leftN  = lhs.getNormal();
-        const CTiglPoint& rightN = rhs.getNormal();
+        return (a[0] - b.x)*(a[0] - b.x) + (a[1] - b.y)*(a[1] - b.y) + (a[2] - b.z)*(a[2] - b.z);
+    }
 
-        if (isSmaller(leftP,rightP)) {
-            return true;
-        }
-        else {
-            // if points are equal, compare normals
-            if (leftP.distance2(rightP) <  COMP_TOLERANCE ) {
-                return isSmaller(leftN, rightN);
-            }
-            else {
-                return false;
+    /**
+     * Stores real valued data fields column-wise, i.e. one array per field.
+     *
+     * The fields are addressed by their id, which is the order of creation.
+     * The field names are enumerated in alphabetical order.
+     */
+    class DataColumns
+    {
+    public:
+        // returns the id of the field, creates the field if it does not exist
+        unsigned int fieldId(const std::string& name)
+        {
+            std::map<std::string, unsigned int>::const_iterator it = m_ids.find(name);
+            if (it != m_ids.end()) {
+                return it->second;
             }
+            unsigned int id = static_cast<unsigned int>(m_columns.size());
+            m_ids[name] = id;
+            m_columns.push_back(std::vector<double>());
+            return id;
         }
-    }
-};
 
+        // returns the id of the field or -1, if the field does not exist
+        int findField(const std::string& name) const
+        {
+            std::map<std::string, unsigned int>::const_iterator it = m_ids.find(name);
+            return it != m_ids.end() ? static_cast<int>(it->second) : -1;
+        }
 
-//class to store a polygon by its point indices
-struct PolyIndexList
-{
-    PolyIndexList(int num) : _metadata("")
-    {
-        myid = num;
-    }
-
-    void setMetadata(const std::string& str)
-    {
-        _metadata = str;
-    }
+        bool isValidId(unsigned int id) const
+        {
+            return id < m_columns.size();
+        }
 
-    const std::string& getMetadata() const
-    {
-        return _metadata;
-    }
-    
-    void addPoint(int index);
-    
-    void setRealData(const char * txt, double value)
-    {
-        realDataMap[txt] = value;
-    }
-    
-    double getRealData(const char * txt) const 
-    {
-        std::map<std::string, double>::const_iterator it=realDataMap.find(txt);
-        if (it != realDataMap.end()) {
-            return it->second;
+        void set(unsigned long index, unsigned int id, double value)
+        {
+            std::vector<double>& column = m_columns[id];
+            if (column.size() <= index) {
+                column.resize(index + 1, UNDEFINED_REAL);
+            }
+            column[index] = value;
         }
-        else {
-            return UNDEFINED_REAL;
+
+        double get(unsigned long index, unsigned int id) const
+        {
+            const std::vector<double>& column = m_columns[id];
+            return index < column.size() ? column[index] : UNDEFINED_REAL;
         }
-    }
-    
-    int getNVert() const
-    {
-        return static_cast<int>(pindex.size());
-    }
 
-    int getPointIndex(int i) const
-    {
-        return pindex.at(i);
-    }
-    
-private:
-    std::vector<int> pindex;
+        unsigned int count() const
+        {
+            return static_cast<unsigned int>(m_columns.size());
+        }
 
-    //each polygon should have it's own metadata
-    std::string _metadata;
-    
-    std::map<std::string, double> realDataMap;
+        // returns the name of the ith field in alphabetical order
+        const char * name(unsigned long i) const
+        {
+            std::map<std::string, unsigned int>::const_iterator it = m_ids.begin();
+            std::advance(it, i);
+            return it->first.c_str();
+        }
 
-    int myid;
-};
+    private:
+        std::map<std::string, unsigned int> m_ids;
+        std::vector<std::vector<double> > m_columns;
+    };
+} // namespace
 
 
 class ObjectImpl 
@@ -216,44 +171,53 @@ class ObjectImpl
 public:
     ObjectImpl()
     {
-        pointlist.clear();
-        polys.clear();
-        pPoints.clear();
         has_normals = false;
         has_metadata = false;
         metaDataElements = "";
+        polyOffsets.push_back(0);
     }
 
-    void addPointNorm(const CTiglPoint &p, const CTiglPoint& norm, long polynum);
     unsigned long addPointNorm(const CTiglPoint &p, const CTiglPoint &norm);
     
     unsigned long addTriangleByVertexIndex(unsigned long i1, unsigned long i2, unsigned long i3 );
     
     void addPolygon(const CTiglPolygon&);
     
-    unsigned long getNPolygons() const;
-    unsigned long getNPointsOfPolygon(unsigned long ipoly) const;
+    unsigned long getNVertices() const
+    {
+        return static_cast<unsigned long>(nextInCell.size());
+    }
 
-    const CTiglPoint& getVertexPoint(unsigned long iVertexIndex) const;
-    const CTiglPoint& getVertexNormal(unsigned long iVertexIndex) const;
+    unsigned long getNPolygons() const
+    {
+        return static_cast<unsigned long>(polyOffsets.size() - 1);
+    }
 
-    unsigned long getVertexIndexOfPolygon(unsigned long ipoint, unsigned long ipoly) const;
+    unsigned long getNPointsOfPolygon(unsigned long ipoly) const;
 
     bool has_normals;
     bool has_metadata;
 
-    // we use this container to store point data, it allows us to find
-    // efficiently a specific point in the list
-    PointMap pointlist;
+    // vertex coordinates and normals, stored as x, y, z for each vertex
+    std::vector<double> coordinates;
+    std::vector<double> normals;
 
-    // this vector keeps track of the order of points, it complies with
-    // the polygon indices
-    std::vector<PointImpl*> pPoints;
+    // hash grid to find existing vertices. Each cell references its last
+    // added vertex, nextInCell links the vertices of the same cell.
+    typedef std::unordered_map<GridCell, unsigned long, GridCellHash> VertexGrid;
+    VertexGrid grid;
+    std::vector<unsigned long> nextInCell;
 
-    std::vector<PolyIndexList> polys;
-    
-    std::set<std::string> polyDataElems;
-    std::set<std::string> vertexDataElems;
+    // vertex indices of all polygons. The indices of polygon i are stored
+    // in the range [polyOffsets[i], polyOffsets[i+1])
+    std::vector<unsigned long> polyVertices;
+    std::vector<size_t> polyOffsets;
+
+    // metadata text of the polygons, only allocated if metadata are set
+    std::vector<std::string> polyMetadata;
+
+    DataColumns polyData;
+    DataColumns vertexData;
     
     std::string metaDataElements;
 };
@@ -347,19 +311,6 @@ unsigned long CTiglPolyData::getTotalVertexCount() const
     return nVertices;
 }
 
-// --------------------------------------------------------------------------//
-
-void PolyIndexList::addPoint(int index)
-{
-    // dont add same point twice
-    if (pindex.size() == 0 || pindex.back() != index) {
-         pindex.push_back(index);
-    }
-}
-
-
-//--------------------------------------------------------------------------//
-
 CTiglPolyObject::CTiglPolyObject()
 {
     impl = new ObjectImpl;
@@ -370,6 +321,16 @@ CTiglPolyObject::~CTiglPolyObject()
     delete impl;
 }
 
+void CTiglPolyObject::reserve(unsigned long nVertices, unsigned long nPolygons)
+{
+    impl->coordinates.reserve(3 * nVertices);
+    impl->normals.reserve(3 * nVertices);
+    impl->nextInCell.reserve(nVertices);
+    impl->grid.reserve(nVertices);
+    impl->polyOffsets.reserve(nPolygons + 1);
+    impl->polyVertices.reserve(3 * nPolygons);
+}
+
 unsigned long CTiglPolyObject::addPointNormal(const CTiglPoint &p, const CTiglPoint &n)
 {
     return impl->addPointNorm(p,n);
@@ -397,7 +358,7 @@ unsigned long CTiglPolyObject::getNPolygons() const
 
 unsigned long CTiglPolyObject::getNVertices() const
 {
-    return static_cast<unsigned long>(impl->pPoints.size());
+    return impl->getNVertices();
 }
 
 void CTiglPolyObject::enableNormals(bool normals_enabled)
@@ -414,7 +375,7 @@ unsigned long CTiglPolyObject::getVertexIndexOfPolygon(unsigned long iPoint, uns
 {
     if (iPoly < getNPolygons()) {
         if (iPoint < getNPointsOfPolygon(iPoly)) {
-            return impl->polys[iPoly].getPointIndex(iPoint);
+            return impl->polyVertices[impl->polyOffsets[iPoly] + iPoint];
         }
         else {
             throw tigl::CTiglError("Illegal Point Index at CTiglPolyObject::getVertexIndexOfPolygon", TIGL_INDEX_ERROR);
@@ -425,20 +386,22 @@ unsigned long CTiglPolyObject::getVertexIndexOfPolygon(unsigned long iPoint, uns
     }
 }
 
-const CTiglPoint& CTiglPolyObject::getVertexNormal(unsigned long iVertexIndex) const 
+CTiglPoint CTiglPolyObject::getVertexNormal(unsigned long iVertexIndex) const 
 {
     if (iVertexIndex < getNVertices()) {
-        return impl->pPoints[iVertexIndex]->getNormal();
+        const double* n = &impl->normals[3*iVertexIndex];
+        return CTiglPoint(n[0], n[1], n[2]);
     }
     else {
         throw tigl::CTiglError("Illegal Vertex Index at CTiglPolyObject::getVertexNormal", TIGL_INDEX_ERROR);
     }
 }
 
-const CTiglPoint& CTiglPolyObject::getVertexPoint(unsigned long iVertexIndex) const 
+CTiglPoint CTiglPolyObject::getVertexPoint(unsigned long iVertexIndex) const 
 {
     if (iVertexIndex < getNVertices()) {
-        return impl->pPoints[iVertexIndex]->getPoint();
+        const double* p = &impl->coordinates[3*iVertexIndex];
+        return CTiglPoint(p[0], p[1], p[2]);
     }
     else {
         throw tigl::CTiglError("Illegal Vertex Index at CTiglPolyObject::getVertexNormal", TIGL_INDEX_ERROR);
@@ -463,7 +426,10 @@ void CTiglPolyObject::setMetadataElements(const char * elems)
 const char * CTiglPolyObject::getPolyMetadata(unsigned long iPoly) const 
 {
     if (iPoly < getNPolygons()) {
-        return impl->polys[iPoly].getMetadata().c_str();
+        if (iPoly < impl->polyMetadata.size()) {
+            return impl->polyMetadata[iPoly].c_str();
+        }
+        return "";
     }
     else {
         throw tigl::CTiglError("Illegal Polygon Index at CTiglPolyObject::getPolyMetadata", TIGL_INDEX_ERROR);
@@ -473,7 +439,10 @@ const char * CTiglPolyObject::getPolyMetadata(unsigned long iPoly) const
 void CTiglPolyObject::setPolyMetadata(unsigned long iPoly, const char * txt)
 {
     if (iPoly < getNPolygons()) {
-        impl->polys[iPoly].setMetadata(txt);
+        if (impl->polyMetadata.size() <= iPoly) {
+            impl->polyMetadata.resize(getNPolygons());
+        }
+        impl->polyMetadata[iPoly] = txt;
         impl->has_metadata = true;
     }
     else {
@@ -484,10 +453,7 @@ void CTiglPolyObject::setPolyMetadata(unsigned long iPoly, const char * txt)
 void CTiglPolyObject::setVertexDataReal(unsigned long iVertexIndex, const char *dataName, double value)
 {
     if (iVertexIndex < getNVertices()) {
-        //insert into elems
-        impl->vertexDataElems.insert(dataName);
-        
-        impl->pPoints[iVertexIndex]->setRealData(dataName, value);
+        impl->vertexData.set(iVertexIndex, impl->vertexData.fieldId(dataName), value);
     }
     else {
         throw tigl::CTiglError("Illegal Vertex Index at CTiglPolyObject::setVertexDataReal", TIGL_INDEX_ERROR);
@@ -497,51 +463,77 @@ void CTiglPolyObject::setVertexDataReal(unsigned long iVertexIndex, const char *
 double CTiglPolyObject::getVertexDataReal(unsigned long iVertexIndex, const char *dataName) const
 {
     if (iVertexIndex < getNVertices()) {
-        return impl->pPoints[iVertexIndex]->getRealData(dataName);
+        int id = impl->vertexData.findField(dataName);
+        return id >= 0 ? impl->vertexData.get(iVertexIndex, static_cast<unsigned int>(id)) : UNDEFINED_REAL;
     }
     else {
         throw tigl::CTiglError("Illegal Vertex Index at CTiglPolyObject::getVertexDataReal", TIGL_INDEX_ERROR);
     }
 }
 
+unsigned int CTiglPolyObject::getPolyDataFieldId(const char * dataName)
+{
+    return impl->polyData.fieldId(dataName);
+}
+
 void CTiglPolyObject::setPolyDataReal(unsigned long iPolyIndex, const char *dataName, double value)
 {
     if (iPolyIndex < getNPolygons()) {
-        //insert into elems
-        impl->polyDataElems.insert(dataName);
-        
-        impl->polys[iPolyIndex].setRealData(dataName, value);
+        impl->polyData.set(iPolyIndex, impl->polyData.fieldId(dataName), value);
     }
     else {
         throw tigl::CTiglError("Illegal Polygon Index at CTiglPolyObject::setPolyDataReal", TIGL_INDEX_ERROR);
     }
 }
 
+void CTiglPolyObject::setPolyDataRealById(unsigned long iPolyIndex, unsigned int fieldId, double value)
+{
+    if (!impl->polyData.isValidId(fieldId)) {
+        throw tigl::CTiglError("Illegal Data Field Id at CTiglPolyObject::setPolyDataRealById", TIGL_INDEX_ERROR);
+    }
+    if (iPolyIndex < getNPolygons()) {
+        impl->polyData.set(iPolyIndex, fieldId, value);
+    }
+    else {
+        throw tigl::CTiglError("Illegal Polygon Index at CTiglPolyObject::setPolyDataRealById", TIGL_INDEX_ERROR);
+    }
+}
+
 double CTiglPolyObject::getPolyDataReal(unsigned long iPolyIndex, const char *dataName) const
 {
     if (iPolyIndex < getNPolygons()) {
-        return impl->polys[iPolyIndex].getRealData(dataName);
+        int id = impl->polyData.findField(dataName);
+        return id >= 0 ? impl->polyData.get(iPolyIndex, static_cast<unsigned int>(id)) : UNDEFINED_REAL;
     }
     else {
         throw tigl::CTiglError("Illegal Polygon Index at CTiglPolyObject::getPolyDataReal", TIGL_INDEX_ERROR);
     }
 }
 
+double CTiglPolyObject::getPolyDataRealById(unsigned long iPolyIndex, unsigned int fieldId) const
+{
+    if (!impl->polyData.isValidId(fieldId)) {
+        throw tigl::CTiglError("Illegal Data Field Id at CTiglPolyObject::getPolyDataRealById", TIGL_INDEX_ERROR);
+    }
+    if (iPolyIndex < getNPolygons()) {
+        return impl->polyData.get(iPolyIndex, fieldId);
+    }
+    else {
+        throw tigl::CTiglError("Illegal Polygon Index at CTiglPolyObject::getPolyDataRealById", TIGL_INDEX_ERROR);
+    }
+}
+
 // returns the number if different polygon data entries 
 unsigned int CTiglPolyObject::getNumberOfPolyRealData() const 
 {
-    return static_cast<unsigned int>(impl->polyDataElems.size());
+    return impl->polyData.count();
 }
 
 // retuns the  name of the ith data field (i = 0 .. getNumberPolyReadlData - 1)
 const char * CTiglPolyObject::getPolyDataFieldName(unsigned long iField) const 
 {
     if (iField < getNumberOfPolyRealData()) {
-        std::set<std::string>::iterator it = impl->polyDataElems.begin();
-        for (unsigned long i = 0; i < iField; ++i) {
-            ++it;
-        }
-        return it->c_str();
+        return impl->polyData.name(iField);
     }
     else {
         throw tigl::CTiglError("Illegal Data Field Index at CTiglPolyObject::getPolyDataFieldName", TIGL_INDEX_ERROR);
@@ -600,38 +592,48 @@ const char * CTiglPolygon::getMetadata() const
 
 //--------------------------------------------------------------//
 
-void ObjectImpl::addPointNorm(const CTiglPoint& p, const CTiglPoint& n, long polynum)
+unsigned long ObjectImpl::addPointNorm(const CTiglPoint& p, const CTiglPoint& n) 
 {
-    unsigned long index = addPointNorm(p,n);
-
-    // now insert point into polygon list
-    if (polynum > (long) polys.size()) {
-        polys.push_back(PolyIndexList(polynum));
+    // check if point is already in the grid. The points must be within the
+    // welding distance and must have the same normal vector
+    const int64_t ixMin = gridIndex(p.x - WELD_DISTANCE), ixMax = gridIndex(p.x + WELD_DISTANCE);
+    const int64_t iyMin = gridIndex(p.y - WELD_DISTANCE), iyMax = gridIndex(p.y + WELD_DISTANCE);
+    const int64_t izMin = gridIndex(p.z - WELD_DISTANCE), izMax = gridIndex(p.z + WELD_DISTANCE);
+    for (int64_t ix = ixMin; ix <= ixMax; ++ix) {
+        for (int64_t iy = iyMin; iy <= iyMax; ++iy) {
+            for (int64_t iz = izMin; iz <= izMax; ++iz) {
+                VertexGrid::const_iterator cell = grid.find(GridCell(ix, iy, iz));
+                if (cell == grid.end()) {
+                    continue;
+                }
+                for (unsigned long index = cell->second; index != NO_VERTEX; index = nextInCell[index]) {
+                    if (distance2(&coordinates[3*index], p) < COMP_TOLERANCE &&
+                        distance2(&normals[3*index], n) < COMP_TOLERANCE) {
+                        return index;
+                    }
+                }
+            }
+        }
     }
-    assert(polynum == polys.size());
-    polys.at(polynum-1).addPoint(index);
-}
 
-unsigned long ObjectImpl::addPointNorm(const CTiglPoint& p, const CTiglPoint& n) 
-{
-    //check if point is already in pointlist
-    unsigned int index = static_cast<unsigned int>(pointlist.size());
-    std::pair<PointMap::iterator,bool> ret;
+    // a new point
+    const unsigned long index = getNVertices();
+    coordinates.push_back(p.x);
+    coordinates.push_back(p.y);
+    coordinates.push_back(p.z);
+    normals.push_back(n.x);
+    normals.push_back(n.y);
+    normals.push_back(n.z);
 
-    ret = pointlist.insert(std::pair<PointImpl, int>(PointImpl(p,n),index));
-    index = ret.first->second;
-/*#ifndef NDEBUG
-    if(ret.second == false){
-        double dist = ret.first->first.dist2(p);
-        assert(pointlist.size() == 0 ||  dist < 1e-9);
+    std::pair<VertexGrid::iterator, bool> ret = grid.insert(std::make_pair(GridCell(gridIndex(p.x), gridIndex(p.y), gridIndex(p.z)), index));
+    if (ret.second) {
+        nextInCell.push_back(NO_VERTEX);
     }
-#endif*/
-    if (ret.second == true) {
-        // a new point was inserted, we have to keep track
-        PointImpl * ptmp = (PointImpl*)&ret.first->first;
-        pPoints.push_back(ptmp);
+    else {
+        nextInCell.push_back(ret.first->second);
+        ret.first->second = index;
     }
-    
+
     return index;
 }
 
@@ -642,13 +644,11 @@ unsigned long ObjectImpl::addTriangleByVertexIndex(unsigned long i1, unsigned lo
         return ULONG_MAX;
     }
 
-    unsigned long nPolys = static_cast<unsigned long>(polys.size());
-    polys.push_back(PolyIndexList(nPolys));
-    
-    std::vector<PolyIndexList>::iterator itLastPoly = polys.end()-1;
-    itLastPoly->addPoint(i1);
-    itLastPoly->addPoint(i2);
-    itLastPoly->addPoint(i3);
+    unsigned long nPolys = getNPolygons();
+    polyVertices.push_back(i1);
+    polyVertices.push_back(i2);
+    polyVertices.push_back(i3);
+    polyOffsets.push_back(polyVertices.size());
     
     return nPolys;
 }
@@ -656,35 +656,33 @@ unsigned long ObjectImpl::addTriangleByVertexIndex(unsigned long i1, unsigned lo
 
 void ObjectImpl::addPolygon(const CTiglPolygon & poly)
 {
-    long polynum = static_cast<long>(polys.size()) + 1;
-    if (!has_normals) {
-        for (unsigned long i = 0 ; i < poly.getNPoints(); ++i) {
-            CTiglPoint n(1,0,0);
-            addPointNorm(poly.getPointConst(i), n, polynum);
+    const size_t polyStart = polyVertices.size();
+    for (unsigned long i = 0 ; i < poly.getNPoints(); ++i) {
+        unsigned long index = has_normals
+            ? addPointNorm(poly.getPointConst(i), poly.getNormConst(i))
+            : addPointNorm(poly.getPointConst(i), CTiglPoint(1,0,0));
+
+        // dont add same point twice
+        if (polyVertices.size() == polyStart || polyVertices.back() != index) {
+            polyVertices.push_back(index);
         }
     }
-    else {
-        for (unsigned long i = 0 ; i < poly.getNPoints(); ++i) {
-            addPointNorm(poly.getPointConst(i), poly.getNormConst(i), polynum);
-        }
+    polyOffsets.push_back(polyVertices.size());
+
+    std::string metadata = poly.getMetadata();
+    if (!metadata.empty()) {
+        polyMetadata.resize(getNPolygons());
+        polyMetadata.back() = metadata;
     }
-    assert(polynum == polys.size());
-    polys.at(polynum-1).setMetadata(poly.getMetadata());
 }
 
 
-unsigned long ObjectImpl::getNPolygons() const 
-{
-    return static_cast<unsigned long>(polys.size());
-}
-
 unsigned long ObjectImpl::getNPointsOfPolygon(unsigned long ipoly) const 
 {
     if (ipoly < getNPolygons()) {
-        return polys[ipoly].getNVert();
+        return static_cast<unsigned long>(polyOffsets[ipoly + 1] - polyOffsets[ipoly]);
     }
     else {
         throw tigl::CTiglError("Illegal Polygon Index at SurfaceImpl::getNPointsOfPolygon", TIGL_INDEX_ERROR);
     }
 }
-
@@ -76,6 +76,9 @@ public:
     TIGL_EXPORT void enableNormals(bool);
 
     TIGL_EXPORT bool hasNormals() const;
+
+    // reserves memory for the given number of vertices and polygons
+    TIGL_EXPORT void reserve(unsigned long nVertices, unsigned long nPolygons);
     
     // adds a triangle to the global polygon list. the corners are spcified with the vertex indices
     // returned by addPointNormal or getVertexIndexOfPolygon. Returns index of added Triangle
@@ -113,16 +116,25 @@ public:
     
     TIGL_EXPORT double getPolyDataReal(unsigned long iPoly, const char * dataName) const;
 
+    // returns the id of a polygon data field, creates the field if it does not exist.
+    // Setting data by id avoids the name lookup, e.g. inside loops over all polygons
+    TIGL_EXPORT unsigned int getPolyDataFieldId(const char * dataName);
+
+    TIGL_EXPORT void setPolyDataRealById(unsigned long iPoly, unsigned int fieldId, double value);
+
+    TIGL_EXPORT double getPolyDataRealById(unsigned long iPoly, unsigned int fieldId) const;
+
     //  ---------- Vertex specific methods -----------------
     
-    // adds a point and its normal vector to the global point list and returns its index in the list
+    // adds a point and its normal vector to the global point list and returns its index in the list.
+    // If the point and normal already exist (within a tolerance of 1e-5), the index of the existing vertex is returned
     TIGL_EXPORT unsigned long addPointNormal(const class CTiglPoint& p, const class CTiglPoint& n);
     
     // returns the actual point, specified with the vertex index
-    TIGL_EXPORT const CTiglPoint& getVertexPoint(unsigned long iVertexIndex) const;
+    TIGL_EXPORT CTiglPoint getVertexPoint(unsigned long iVertexIndex) const;
     
     // returns the normal vector, specified with vertex index
-    TIGL_EXPORT const CTiglPoint& getVertexNormal(unsigned long iVertexIndex) const;
+    TIGL_EXPORT CTiglPoint getVertexNormal(unsigned long iVertexIndex) const;
     
     // each vertex has a list of data elements, this methods sets the value
     TIGL_EXPORT void setVertexDataReal(unsigned long iVertexIndex, const char * dataName, double value);
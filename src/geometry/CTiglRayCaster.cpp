@@ -0,0 +1,119 @@
+/*
+* Copyright (C) 2019 German Aerospace Center (DLR/SC)
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*/
+
+#include "CTiglRayCaster.h"
+
+#include "tiglparallel.h"
+
+#include <BRepBndLib.hxx>
+#include <Bnd_Box.hxx>
+#include <IntCurvesFace_Intersector.hxx>
+#include <TopExp_Explorer.hxx>
+#include <TopoDS.hxx>
+
+#include <boost/thread/lock_guard.hpp>
+
+#include <limits>
+#include <utility>
+
+namespace tigl
+{
+
+CTiglRayCaster::CTiglRayCaster()
+    : m_tolerance(0.1)
+{
+}
+
+CTiglRayCaster::CTiglRayCaster(const TopoDS_Shape& shape, double tolerance)
+{
+    SetShape(shape, tolerance);
+}
+
+// defined here, as IntCurvesFace_Intersector is incomplete in the header
+CTiglRayCaster::~CTiglRayCaster()
+{
+}
+
+void CTiglRayCaster::SetShape(const TopoDS_Shape& shape, double tolerance)
+{
+    m_tolerance = tolerance;
+    m_faces.clear();
+
+    std::vector<Bnd_Box> boxes;
+    for (TopExp_Explorer exp(shape, TopAbs_FACE); exp.More(); exp.Next()) {
+        Face* face = new Face;
+        face->face = TopoDS::Face(exp.Current());
+        m_faces.push_back(unique_ptr<Face>(face));
+
+        Bnd_Box box;
+        BRepBndLib::Add(face->face, box);
+        boxes.push_back(box);
+    }
+
+    m_tree.Build(boxes);
+}
+
+bool CTiglRayCaster::PerformOnFace(Face& face, const gp_Lin& ray, gp_Pnt& intersection) const
+{
+    unique_ptr<IntCurvesFace_Intersector> intersector;
+    {
+        boost::lock_guard<boost::mutex> lock(face.mutex);
+        if (!face.intersectors.empty()) {
+            intersector = std::move(face.intersectors.back());
+            face.intersectors.pop_back();
+        }
+    }
+    if (!intersector) {
+        intersector.reset(new IntCurvesFace_Intersector(face.face, m_tolerance));
+    }
+
+    intersector->Perform(ray, 0, std::numeric_limits<Standard_Real>::max());
+    const bool found = intersector->IsDone() && intersector->NbPnt() > 0;
+    if (found) {
+        intersection = intersector->Pnt(1);
+    }
+
+    boost::lock_guard<boost::mutex> lock(face.mutex);
+    face.intersectors.push_back(std::move(intersector));
+    return found;
+}
+
+bool CTiglRayCaster::Perform(const gp_Lin& ray, gp_Pnt& intersection) const
+{
+    // the intersector accepts points within the tolerance, hence the boxes are enlarged
+    const std::vector<size_t> candidates = m_tree.FindAlongRay(ray, m_tolerance);
+    for (std::vector<size_t>::const_iterator it = candidates.begin(); it != candidates.end(); ++it) {
+        if (PerformOnFace(*m_faces[*it], ray, intersection)) {
+            return true;
+        }
+    }
+    return false;
+}
+
+void CTiglRayCaster::Perform(const std::vector<gp_Lin>& rays, std::vector<gp_Pnt>& intersections,
+                             std::vector<bool>& hits, int nThreads) const
+{
+    intersections.assign(rays.size(), gp_Pnt());
+    std::vector<char> hit(rays.size(), 0);
+
+    ParallelFor(rays.size(), [&](size_t i) {
+        hit[i] = Perform(rays[i], intersections[i]) ? 1 : 0;
+    }, nThreads);
+
+    hits.assign(hit.begin(), hit.end());
+}
+
+} // namespace tigl
@@ -0,0 +1,88 @@
+/*
+* Copyright (C) 2019 German Aerospace Center (DLR/SC)
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*/
+
+#ifndef CTIGLRAYCASTER_H
+#define CTIGLRAYCASTER_H
+
+#include "tigl_internal.h"
+#include "generated/UniquePtr.h"
+#include "CTiglBoundingBoxTree.h"
+
+#include <TopoDS_Face.hxx>
+#include <TopoDS_Shape.hxx>
+#include <gp_Lin.hxx>
+#include <gp_Pnt.hxx>
+
+#include <boost/thread/mutex.hpp>
+
+#include <vector>
+
+class IntCurvesFace_Intersector;
+
+namespace tigl
+{
+
+/**
+ * @brief Intersects many rays with the faces of a shape
+ *
+ * The result is the same as the one of a loop over all faces of the shape in the
+ * order of TopExp_Explorer, that returns the first intersection point of the first
+ * face hit by the ray. In contrast to such a loop, the faces are stored in a bounding
+ * box tree and only faces, whose box is hit by the ray, are intersected. The face
+ * intersectors are built on first use and reused for all further rays.
+ *
+ * The ray caster is thread-safe.
+ */
+class CTiglRayCaster
+{
+public:
+    TIGL_EXPORT CTiglRayCaster();
+    TIGL_EXPORT explicit CTiglRayCaster(const TopoDS_Shape& shape, double tolerance = 0.1);
+    TIGL_EXPORT ~CTiglRayCaster();
+
+    /// Sets the shape to intersect with. The tolerance is passed to the face intersectors.
+    TIGL_EXPORT void SetShape(const TopoDS_Shape& shape, double tolerance = 0.1);
+
+    /// Intersects the ray starting at the location of the line. Returns false, if no face is hit.
+    TIGL_EXPORT bool Perform(const gp_Lin& ray, gp_Pnt& intersection) const;
+
+    /// Intersects all rays. If nThreads <= 0, all hardware threads are used.
+    TIGL_EXPORT void Perform(const std::vector<gp_Lin>& rays, std::vector<gp_Pnt>& intersections,
+                             std::vector<bool>& hits, int nThreads = 1) const;
+
+private:
+    struct Face
+    {
+        TopoDS_Face face;
+        // The intersectors store their results. Hence, each thread
+        // takes an intersector from the pool while using it.
+        boost::mutex mutex;
+        std::vector<unique_ptr<IntCurvesFace_Intersector> > intersectors;
+    };
+
+    CTiglRayCaster(const CTiglRayCaster&);
+    void operator=(const CTiglRayCaster&);
+
+    bool PerformOnFace(Face& face, const gp_Lin& ray, gp_Pnt& intersection) const;
+
+    std::vector<unique_ptr<Face> > m_faces;
+    CTiglBoundingBoxTree m_tree;
+    double m_tolerance;
+};
+
+} // namespace tigl
+
+#endif // CTIGLRAYCASTER_H
@@ -17,11 +17,17 @@
 */
 
 #include "CTiglShapeCache.h"
+#include "CTiglCacheAccounting.h"
 #include <sstream>
 
 namespace tigl 
 {
 
+namespace
+{
+    const std::string accountingPrefix = "shape:";
+}
+
 CTiglShapeCache::CTiglShapeCache() 
 {
     Reset();
@@ -30,6 +36,12 @@ CTiglShapeCache::CTiglShapeCache()
 void CTiglShapeCache::Insert(const TopoDS_Shape &shape, const std::string& id)
 {
     shapeContainer[id] = shape;
+
+    if (accounting) {
+        accounting->Insert(accountingPrefix + id, EstimateShapeMemory(shape), [this, id]() {
+            shapeContainer.erase(id);
+        });
+    }
 }
 
 TopoDS_Shape& CTiglShapeCache::GetShape(const std::string& id) 
@@ -47,7 +59,12 @@ TopoDS_Shape& CTiglShapeCache::GetShape(const std::string& id)
 bool CTiglShapeCache::HasShape(const std::string& id)
 {
     ShapeContainer::iterator it = shapeContainer.find(id);
-    return it != shapeContainer.end();
+    const bool found = it != shapeContainer.end();
+    if (found && accounting) {
+        // a miss is counted, when the computed shape is inserted
+        accounting->Touch(accountingPrefix + id);
+    }
+    return found;
 }
 
 unsigned int CTiglShapeCache::GetNShape() const 
@@ -59,6 +76,9 @@ unsigned int CTiglShapeCache::GetNShape() const
 void CTiglShapeCache::Clear()
 {
     shapeContainer.clear();
+    if (accounting) {
+        accounting->RemovePrefix(accountingPrefix);
+    }
 }
 
 void CTiglShapeCache::Remove(const std::string& id) 
@@ -67,6 +87,9 @@ void CTiglShapeCache::Remove(const std::string& id)
     if (it != shapeContainer.end()) {
         shapeContainer.erase(it);
     }
+    if (accounting) {
+        accounting->Remove(accountingPrefix + id);
+    }
 }
 
 void CTiglShapeCache::Reset() 
@@ -80,4 +103,12 @@ CTiglShapeCache::ShapeContainer& CTiglShapeCache::GetContainer()
     return shapeContainer;
 }
 
+void CTiglShapeCache::SetAccounting(CSharedPtr<CTiglCacheAccounting> newAccounting)
+{
+    if (accounting) {
+        accounting->RemovePrefix(accountingPrefix);
+    }
+    accounting = newAccounting;
+}
+
 } // namespace tigl
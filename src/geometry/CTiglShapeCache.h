@@ -25,6 +25,7 @@
 #define CTIGLSHAPECACHE_H
 
 #include "tigl_internal.h"
+#include "CSharedPtr.h"
 #include <map>
 #include <string>
 #include <TopoDS_Shape.hxx>
@@ -32,6 +33,8 @@
 namespace tigl 
 {
 
+class CTiglCacheAccounting;
+
 class CTiglShapeCache
 {
 public:
@@ -59,12 +62,17 @@ public:
     
     /// Returns the underlying map for direct access
     TIGL_EXPORT ShapeContainer& GetContainer();
+
+    /// Accounts the memory of the inserted shapes. The shapes may be evicted
+    /// by the accounting, if the memory budget is exceeded.
+    TIGL_EXPORT void SetAccounting(CSharedPtr<CTiglCacheAccounting> accounting);
     
 private:
     void Reset();
     
     ShapeContainer shapeContainer;
     TopoDS_Shape nullShape;
+    CSharedPtr<CTiglCacheAccounting> accounting;
 };
 
 } // namespace tigl
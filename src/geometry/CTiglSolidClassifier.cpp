@@ -0,0 +1,499 @@
+/*
+* Copyright (C) 2019 German Aerospace Center (DLR/SC)
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*/
+
+#include "CTiglSolidClassifier.h"
+
+#include "CTiglCacheAccounting.h"
+#include "CTiglError.h"
+#include "tiglparallel.h"
+
+#include <BRepBndLib.hxx>
+#include <BRepBuilderAPI_Copy.hxx>
+#include <BRepMesh_IncrementalMesh.hxx>
+#include <BRep_Tool.hxx>
+#include <Poly_Triangulation.hxx>
+#include <Standard_Failure.hxx>
+#include <TopExp_Explorer.hxx>
+#include <TopoDS.hxx>
+#include <TopoDS_Face.hxx>
+
+#include <algorithm>
+#include <cmath>
+
+namespace
+{
+    // linear deflection of the triangulation relative to the bounding box diagonal
+    const double RELATIVE_DEFLECTION = 5e-4;
+
+    // maximum number of triangles per leaf of the bvh
+    const int LEAF_SIZE = 4;
+
+    // Ray direction for the parity test. It is not aligned to any axis
+    // in order to avoid rays running along the edges of the triangulation.
+    const double RAY_DIR[3] = {0.8503416780, 0.4271355128, 0.3073521614};
+
+    inline void sub(const double a[3], const double b[3], double r[3])
+    {
+        r[0] = a[0] - b[0];
+        r[1] = a[1] - b[1];
+        r[2] = a[2] - b[2];
+    }
+
+    inline double dot(const double a[3], const double b[3])
+    {
+        return a[0]*b[0] + a[1]*b[1] + a[2]*b[2];
+    }
+
+    inline void cross(const double a[3], const double b[3], double r[3])
+    {
+        r[0] = a[1]*b[2] - a[2]*b[1];
+        r[1] = a[2]*b[0] - a[0]*b[2];
+        r[2] = a[0]*b[1] - a[1]*b[0];
+    }
+
+    // squared distance between point p and the triangle (a, b, c),
+    // see Ericson, Real-Time Collision Detection, 5.1.5
+    double squareDistancePointTriangle(const double p[3], const double a[3], const double b[3], const double c[3])
+    {
+        double ab[3], ac[3], ap[3], closest[3];
+        sub(b, a, ab);
+        sub(c, a, ac);
+        sub(p, a, ap);
+
+        double d1 = dot(ab, ap);
+        double d2 = dot(ac, ap);
+        if (d1 <= 0. && d2 <= 0.) {
+            return dot(ap, ap);
+        }
+
+        double bp[3];
+        sub(p, b, bp);
+        double d3 = dot(ab, bp);
+        double d4 = dot(ac, bp);
+        if (d3 >= 0. && d4 <= d3) {
+            return dot(bp, bp);
+        }
+
+        double vc = d1*d4 - d3*d2;
+        if (vc <= 0. && d1 >= 0. && d3 <= 0.) {
+            double v = d1 / (d1 - d3);
+            for (int k = 0; k < 3; ++k) {
+                closest[k] = a[k] + v * ab[k];
+            }
+        }
+        else {
+            double cp[3];
+            sub(p, c, cp);
+            double d5 = dot(ab, cp);
+            double d6 = dot(ac, cp);
+            if (d6 >= 0. && d5 <= d6) {
+                return dot(cp, cp);
+            }
+
+            double vb = d5*d2 - d1*d6;
+            double va = d3*d6 - d5*d4;
+            if (vb <= 0. && d2 >= 0. && d6 <= 0.) {
+                double w = d2 / (d2 - d6);
+                for (int k = 0; k < 3; ++k) {
+                    closest[k] = a[k] + w * ac[k];
+                }
+            }
+            else if (va <= 0. && (d4 - d3) >= 0. && (d5 - d6) >= 0.) {
+                double w = (d4 - d3) / ((d4 - d3) + (d5 - d6));
+                for (int k = 0; k < 3; ++k) {
+                    closest[k] = b[k] + w * (c[k] - b[k]);
+                }
+            }
+            else {
+                double denom = 1. / (va + vb + vc);
+                double v = vb * denom;
+                double w = vc * denom;
+                for (int k = 0; k < 3; ++k) {
+                    closest[k] = a[k] + v * ab[k] + w * ac[k];
+                }
+            }
+        }
+
+        double d[3];
+        sub(p, closest, d);
+        return dot(d, d);
+    }
+
+    enum RayHit
+    {
+        NoHit,
+        Hit,
+        Ambiguous
+    };
+
+    // Moeller-Trumbore ray triangle intersection. Hits close to an edge or a
+    // vertex of the triangle are reported as ambiguous, as they could be
+    // counted twice or not at all.
+    RayHit intersectRayTriangle(const double origin[3], const double dir[3],
+                                const double a[3], const double b[3], const double c[3])
+    {
+        const double eps = 1e-10;
+
+        double e1[3], e2[3], pvec[3];
+        sub(b, a, e1);
+        sub(c, a, e2);
+        cross(dir, e2, pvec);
+        double det = dot(e1, pvec);
+
+        double scale = std::sqrt(dot(e1, e1) * dot(e2, e2));
+        if (std::fabs(det) <= eps * scale) {
+            // ray parallel to the triangle
+            double n[3], ap[3];
+            cross(e1, e2, n);
+            sub(origin, a, ap);
+            return std::fabs(dot(n, ap)) <= eps * scale ? Ambiguous : NoHit;
+        }
+
+        double invDet = 1. / det;
+        double tvec[3], qvec[3];
+        sub(origin, a, tvec);
+        double u = dot(tvec, pvec) * invDet;
+        if (u < -eps || u > 1. + eps) {
+            return NoHit;
+        }
+
+        cross(tvec, e1, qvec);
+        double v = dot(dir, qvec) * invDet;
+        if (v < -eps || u + v > 1. + eps) {
+            return NoHit;
+        }
+
+        double t = dot(e2, qvec) * invDet;
+        if (t < 0.) {
+            return NoHit;
+        }
+
+        if (u < eps || v < eps || u + v > 1. - eps) {
+            return Ambiguous;
+        }
+        return Hit;
+    }
+
+    inline bool rayHitsBox(const double origin[3], const double invDir[3], const double bmin[3], const double bmax[3])
+    {
+        double tmin = 0.;
+        double tmax = 1e300;
+        for (int k = 0; k < 3; ++k) {
+            double t1 = (bmin[k] - origin[k]) * invDir[k];
+            double t2 = (bmax[k] - origin[k]) * invDir[k];
+            tmin = std::max(tmin, std::min(t1, t2));
+            tmax = std::min(tmax, std::max(t1, t2));
+        }
+        return tmin <= tmax;
+    }
+
+    inline bool boxNearPoint(const double p[3], double margin, const double bmin[3], const double bmax[3])
+    {
+        for (int k = 0; k < 3; ++k) {
+            if (p[k] < bmin[k] - margin || p[k] > bmax[k] + margin) {
+                return false;
+            }
+        }
+        return true;
+    }
+}
+
+namespace tigl
+{
+
+CTiglSolidClassifier::CTiglSolidClassifier(const TopoDS_Shape& solid, double tolerance)
+    : m_tolerance(tolerance)
+    , m_isReversed(false)
+    , m_useTriangulation(false)
+    , m_margin(0.)
+{
+    try {
+        m_solid = TopoDS::Solid(solid);
+    }
+    catch (Standard_Failure) {
+        throw CTiglError("The shape is not a solid");
+    }
+
+    BRepBndLib::Add(m_solid, m_boundingBox);
+    m_boundingBox.Enlarge(m_tolerance);
+
+    m_classifier.Load(m_solid);
+
+    // test whether a point at infinity lies inside. If yes, then the shape is reversed
+    m_classifier.PerformInfinitePoint(m_tolerance);
+    m_isReversed = (m_classifier.State() == TopAbs_IN);
+
+    BuildTriangulation();
+}
+
+const TopoDS_Solid& CTiglSolidClassifier::Solid() const
+{
+    return m_solid;
+}
+
+size_t CTiglSolidClassifier::EstimateMemory() const
+{
+    // the solid is counted as well, since it is kept alive by the classifier after the loft has been evicted
+    return EstimateShapeMemory(m_solid)
+         + m_triangles.capacity() * sizeof(Triangle)
+         + m_nodes.capacity() * sizeof(Node);
+}
+
+void CTiglSolidClassifier::BuildTriangulation()
+{
+    if (m_boundingBox.IsVoid()) {
+        return;
+    }
+
+    double xmin, ymin, zmin, xmax, ymax, zmax;
+    m_boundingBox.Get(xmin, ymin, zmin, xmax, ymax, zmax);
+    double diagonal = std::sqrt((xmax-xmin)*(xmax-xmin) + (ymax-ymin)*(ymax-ymin) + (zmax-zmin)*(zmax-zmin));
+    double deflection = RELATIVE_DEFLECTION * diagonal;
+
+    // mesh a copy, the triangulation of the loft itself must not be changed
+    TopoDS_Shape copy = BRepBuilderAPI_Copy(m_solid);
+    BRepMesh_IncrementalMesh mesher(copy, deflection, Standard_False, 0.3);
+
+    for (TopExp_Explorer faceExp(copy, TopAbs_FACE); faceExp.More(); faceExp.Next()) {
+        const TopoDS_Face& face = TopoDS::Face(faceExp.Current());
+        TopLoc_Location location;
+        const Handle(Poly_Triangulation) triangulation = BRep_Tool::Triangulation(face, location);
+        if (triangulation.IsNull()) {
+            // the parity test requires a closed triangulation
+            m_triangles.clear();
+            return;
+        }
+
+        gp_Trsf nodeTransformation = location;
+        const TColgp_Array1OfPnt& nodes = triangulation->Nodes();
+        const Poly_Array1OfTriangle& triangles = triangulation->Triangles();
+        for (int j = triangles.Lower(); j <= triangles.Upper(); ++j) {
+            int i1, i2, i3;
+            triangles(j).Get(i1, i2, i3);
+            gp_Pnt p1 = nodes(i1).Transformed(nodeTransformation);
+            gp_Pnt p2 = nodes(i2).Transformed(nodeTransformation);
+            gp_Pnt p3 = nodes(i3).Transformed(nodeTransformation);
+
+            Triangle t;
+            p1.Coord(t.p0[0], t.p0[1], t.p0[2]);
+            p2.Coord(t.p1[0], t.p1[1], t.p1[2]);
+            p3.Coord(t.p2[0], t.p2[1], t.p2[2]);
+            m_triangles.push_back(t);
+        }
+    }
+
+    if (m_triangles.empty()) {
+        return;
+    }
+
+    // The triangulation deviates at most by about the deflection from the exact surface.
+    // Points closer to the triangulation are classified exactly.
+    m_margin = 2. * deflection + m_tolerance;
+
+    std::vector<double> centers(3 * m_triangles.size());
+    for (size_t i = 0; i < m_triangles.size(); ++i) {
+        for (int k = 0; k < 3; ++k) {
+            centers[3*i + k] = (m_triangles[i].p0[k] + m_triangles[i].p1[k] + m_triangles[i].p2[k]) / 3.;
+        }
+    }
+
+    m_nodes.reserve(2 * m_triangles.size() / LEAF_SIZE + 1);
+    BuildNode(0, static_cast<int>(m_triangles.size()), centers);
+    m_useTriangulation = true;
+}
+
+int CTiglSolidClassifier::BuildNode(int first, int count, std::vector<double>& centers)
+{
+    int index = static_cast<int>(m_nodes.size());
+    m_nodes.push_back(Node());
+
+    Node node;
+    node.left = node.right = -1;
+    node.first = first;
+    node.count = count;
+    for (int k = 0; k < 3; ++k) {
+        node.min[k] = 1e300;
+        node.max[k] = -1e300;
+    }
+
+    double cmin[3] = {1e300, 1e300, 1e300};
+    double cmax[3] = {-1e300, -1e300, -1e300};
+    for (int i = first; i < first + count; ++i) {
+        const Triangle& t = m_triangles[i];
+        for (int k = 0; k < 3; ++k) {
+            node.min[k] = std::min(node.min[k], std::min(t.p0[k], std::min(t.p1[k], t.p2[k])));
+            node.max[k] = std::max(node.max[k], std::max(t.p0[k], std::max(t.p1[k], t.p2[k])));
+            cmin[k] = std::min(cmin[k], centers[3*i + k]);
+            cmax[k] = std::max(cmax[k], centers[3*i + k]);
+        }
+    }
+
+    if (count > LEAF_SIZE) {
+        // split at the median of the longest axis of the triangle centers
+        int axis = 0;
+        for (int k = 1; k < 3; ++k) {
+            if (cmax[k] - cmin[k] > cmax[axis] - cmin[axis]) {
+                axis = k;
+            }
+        }
+
+        std::vector<int> order(count);
+        for (int i = 0; i < count; ++i) {
+            order[i] = first + i;
+        }
+        int half = count / 2;
+        std::nth_element(order.begin(), order.begin() + half, order.end(), [&centers, axis](int a, int b) {
+            return centers[3*a + axis] < centers[3*b + axis];
+        });
+
+        std::vector<Triangle> sortedTriangles(count);
+        std::vector<double> sortedCenters(3 * count);
+        for (int i = 0; i < count; ++i) {
+            sortedTriangles[i] = m_triangles[order[i]];
+            for (int k = 0; k < 3; ++k) {
+                sortedCenters[3*i + k] = centers[3*order[i] + k];
+            }
+        }
+        std::copy(sortedTriangles.begin(), sortedTriangles.end(), m_triangles.begin() + first);
+        std::copy(sortedCenters.begin(), sortedCenters.end(), centers.begin() + 3*first);
+
+        node.left = BuildNode(first, half, centers);
+        node.right = BuildNode(first + half, count - half, centers);
+        node.count = 0;
+    }
+
+    m_nodes[index] = node;
+    return index;
+}
+
+bool CTiglSolidClassifier::IsNearBoundary(const double p[3]) const
+{
+    const double margin2 = m_margin * m_margin;
+
+    std::vector<int> stack;
+    stack.reserve(64);
+    stack.push_back(0);
+    while (!stack.empty()) {
+        const Node& node = m_nodes[stack.back()];
+        stack.pop_back();
+        if (!boxNearPoint(p, m_margin, node.min, node.max)) {
+            continue;
+        }
+        if (node.left < 0) {
+            for (int i = node.first; i < node.first + node.count; ++i) {
+                const Triangle& t = m_triangles[i];
+                if (squareDistancePointTriangle(p, t.p0, t.p1, t.p2) <= margin2) {
+                    return true;
+                }
+            }
+        }
+        else {
+            stack.push_back(node.left);
+            stack.push_back(node.right);
+        }
+    }
+    return false;
+}
+
+CTiglSolidClassifier::State CTiglSolidClassifier::RayParity(const double p[3]) const
+{
+    const double invDir[3] = {1. / RAY_DIR[0], 1. / RAY_DIR[1], 1. / RAY_DIR[2]};
+
+    int nHits = 0;
+    std::vector<int> stack;
+    stack.reserve(64);
+    stack.push_back(0);
+    while (!stack.empty()) {
+        const Node& node = m_nodes[stack.back()];
+        stack.pop_back();
+        if (!rayHitsBox(p, invDir, node.min, node.max)) {
+            continue;
+        }
+        if (node.left < 0) {
+            for (int i = node.first; i < node.first + node.count; ++i) {
+                const Triangle& t = m_triangles[i];
+                RayHit hit = intersectRayTriangle(p, RAY_DIR, t.p0, t.p1, t.p2);
+                if (hit == Ambiguous) {
+                    return Unknown;
+                }
+                if (hit == Hit) {
+                    ++nHits;
+                }
+            }
+        }
+        else {
+            stack.push_back(node.left);
+            stack.push_back(node.right);
+        }
+    }
+    return (nHits % 2 == 1) ? Inside : Outside;
+}
+
+CTiglSolidClassifier::State CTiglSolidClassifier::ClassifyFast(const gp_Pnt& point) const
+{
+    if (m_boundingBox.IsOut(point)) {
+        // same result as the exact classifier for points far away
+        return Outside;
+    }
+
+    if (!m_useTriangulation) {
+        return Unknown;
+    }
+
+    double p[3];
+    point.Coord(p[0], p[1], p[2]);
+    if (IsNearBoundary(p)) {
+        return Unknown;
+    }
+    return RayParity(p);
+}
+
+bool CTiglSolidClassifier::ClassifyExact(const gp_Pnt& point)
+{
+    m_classifier.Perform(point, m_tolerance);
+    return ((m_classifier.State() == TopAbs_IN) != m_isReversed) || (m_classifier.State() == TopAbs_ON);
+}
+
+bool CTiglSolidClassifier::IsInside(const gp_Pnt& point)
+{
+    State state = ClassifyFast(point);
+    if (state == Unknown) {
+        return ClassifyExact(point);
+    }
+    return state == Inside;
+}
+
+std::vector<bool> CTiglSolidClassifier::IsInside(const std::vector<gp_Pnt>& points, int nThreads)
+{
+    std::vector<char> states(points.size());
+    ParallelFor(points.size(), [this, &points, &states](size_t i) {
+        states[i] = static_cast<char>(ClassifyFast(points[i]));
+    }, nThreads);
+
+    // the OCCT classifier is not thread-safe
+    std::vector<bool> result(points.size());
+    for (size_t i = 0; i < points.size(); ++i) {
+        if (states[i] == Unknown) {
+            result[i] = ClassifyExact(points[i]);
+        }
+        else {
+            result[i] = states[i] == Inside;
+        }
+    }
+    return result;
+}
+
+} // namespace tigl
@@ -0,0 +1,112 @@
+/*
+* Copyright (C) 2019 German Aerospace Center (DLR/SC)
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*/
+
+#ifndef CTIGLSOLIDCLASSIFIER_H
+#define CTIGLSOLIDCLASSIFIER_H
+
+#include "tigl_internal.h"
+
+#include <BRepClass3d_SolidClassifier.hxx>
+#include <Bnd_Box.hxx>
+#include <TopoDS_Solid.hxx>
+#include <gp_Pnt.hxx>
+
+#include <vector>
+
+namespace tigl
+{
+
+/**
+ * @brief Classifies many points against a solid
+ *
+ * The result is the same as the one of IsPointInsideShape, i.e. points on the
+ * boundary are considered inside. In contrast to IsPointInsideShape, the setup
+ * is done only once: the solid is triangulated and the triangles are stored in a
+ * bounding volume hierarchy. Points far from the boundary are classified by counting
+ * the intersections of a ray with the triangulation. Only points close to the boundary
+ * (closer than the triangulation deflection) are passed to the exact OCCT classifier.
+ *
+ * The classifier is not thread-safe. The batch variant of IsInside uses multiple threads internally.
+ */
+class CTiglSolidClassifier
+{
+public:
+    /// Throws, if the shape is not a solid
+    TIGL_EXPORT explicit CTiglSolidClassifier(const TopoDS_Shape& solid, double tolerance = 1e-3);
+
+    /// Returns the classified solid
+    TIGL_EXPORT const TopoDS_Solid& Solid() const;
+
+    /// Returns true, if the point lies inside or on the solid
+    TIGL_EXPORT bool IsInside(const gp_Pnt& point);
+
+    /// Classifies all points. If nThreads <= 0, all hardware threads are used.
+    TIGL_EXPORT std::vector<bool> IsInside(const std::vector<gp_Pnt>& points, int nThreads = 0);
+
+    /// Returns the estimated memory of the solid, the triangulation and the search tree in bytes
+    TIGL_EXPORT size_t EstimateMemory() const;
+
+private:
+    enum State
+    {
+        Outside,
+        Inside,
+        Unknown
+    };
+
+    struct Triangle
+    {
+        double p0[3], p1[3], p2[3];
+    };
+
+    struct Node
+    {
+        double min[3], max[3];
+        int left, right;    // child nodes, -1 for leaves
+        int first, count;   // range in m_triangles for leaves
+    };
+
+    CTiglSolidClassifier(const CTiglSolidClassifier&);
+    void operator=(const CTiglSolidClassifier&);
+
+    void BuildTriangulation();
+    int BuildNode(int first, int count, std::vector<double>& centers);
+
+    // fast classification using the triangulation, thread-safe
+    State ClassifyFast(const gp_Pnt& point) const;
+
+    // exact classification using the OCCT classifier
+    bool ClassifyExact(const gp_Pnt& point);
+
+    bool IsNearBoundary(const double p[3]) const;
+    State RayParity(const double p[3]) const;
+
+    TopoDS_Solid m_solid;
+    double m_tolerance;
+    Bnd_Box m_boundingBox;
+
+    BRepClass3d_SolidClassifier m_classifier;
+    bool m_isReversed;
+
+    bool m_useTriangulation;
+    double m_margin;
+    std::vector<Triangle> m_triangles;
+    std::vector<Node> m_nodes;
+};
+
+} // namespace tigl
+
+#endif // CTIGLSOLIDCLASSIFIER_H
@@ -25,6 +25,7 @@
 #include "BRepBuilderAPI_GTransform.hxx"
 #include "BRepBuilderAPI_Transform.hxx"
 #include "gp_XYZ.hxx"
+#include "TopLoc_Location.hxx"
 #include "Standard_Version.hxx"
 
 namespace tigl 
@@ -507,6 +508,50 @@ bool CTiglTransformation::IsUniform() const
     return true;
 }
 
+bool CTiglTransformation::IsRigid() const
+{
+    gp_XYZ col1(m_matrix[0][0], m_matrix[1][0], m_matrix[2][0]);
+    gp_XYZ col2(m_matrix[0][1], m_matrix[1][1], m_matrix[2][1]);
+    gp_XYZ col3(m_matrix[0][2], m_matrix[1][2], m_matrix[2][2]);
+
+    // the projective part must be trivial
+    if (fabs(m_matrix[3][0]) > Precision::Confusion() || fabs(m_matrix[3][1]) > Precision::Confusion() ||
+        fabs(m_matrix[3][2]) > Precision::Confusion() || fabs(m_matrix[3][3] - 1.) > Precision::Confusion()) {
+        return false;
+    }
+
+    // M^T * M = I
+    if (fabs(col1.Modulus() - 1.) > Precision::Confusion() ||
+        fabs(col2.Modulus() - 1.) > Precision::Confusion() ||
+        fabs(col3.Modulus() - 1.) > Precision::Confusion() ||
+        fabs(col1.Dot(col2)) > Precision::Confusion() ||
+        fabs(col1.Dot(col3)) > Precision::Confusion() ||
+        fabs(col2.Dot(col3)) > Precision::Confusion()) {
+        return false;
+    }
+
+    // no mirroring
+    return gp_Mat(col1, col2, col3).Determinant() > 0.;
+}
+
+TopoDS_Shape CTiglTransformation::Locate(const TopoDS_Shape& shape) const
+{
+    if (!IsRigid()) {
+        throw CTiglError("Transformation is not rigid in CTiglTransformation::Locate", TIGL_MATH_ERROR);
+    }
+
+    gp_Trsf t;
+    t.SetValues(m_matrix[0][0], m_matrix[0][1], m_matrix[0][2], m_matrix[0][3],
+                m_matrix[1][0], m_matrix[1][1], m_matrix[1][2], m_matrix[1][3],
+                m_matrix[2][0], m_matrix[2][1], m_matrix[2][2], m_matrix[2][3]
+#if OCC_VERSION_HEX >= VERSION_HEX_CODE(6,8,0)
+            );
+#else
+            ,1e-10, 1e-10);
+#endif
+    return shape.Moved(TopLoc_Location(t));
+}
+
 CTiglTransformation CTiglTransformation::Inverted() const
 {
     return Get_gp_GTrsf().Inverted();
@@ -107,6 +107,14 @@ public:
     // returns the transformed point
     TIGL_EXPORT gp_Pnt Transform(const gp_Pnt& point) const;
     
+    // Returns true, if the transformation is a rigid motion, i.e. a rotation
+    // followed by a translation without any scaling or mirroring
+    TIGL_EXPORT bool IsRigid() const;
+
+    // Returns a located instance of the shape, that shares its geometry with the
+    // original shape. Throws, if the transformation is not rigid.
+    TIGL_EXPORT TopoDS_Shape Locate(const TopoDS_Shape& shape) const;
+
     // Returns the inverted Transformation
     TIGL_EXPORT CTiglTransformation Inverted() const;
 
@@ -23,6 +23,9 @@
 #include "CCPACSWingSegment.h"
 #include "CCPACSConfiguration.h"
 #include "CTiglFusePlane.h"
+#include "CTiglLogging.h"
+#include "CTiglProfiler.h"
+#include "tiglparallel.h"
 
 #include <TopoDS.hxx>
 #include <TopoDS_Shape.hxx>
@@ -43,7 +46,11 @@
 #include <TColgp_Array1OfPnt2d.hxx>
 #include <TopTools_IndexedMapOfShape.hxx>
 #include <TopExp.hxx>
+#include <Bnd_Box.hxx>
+#include <BRepBndLib.hxx>
 #include <climits>
+#include <map>
+#include <sstream>
 
 namespace 
 {
@@ -62,6 +69,173 @@ namespace
         }
         return p;
     }
+
+    // tolerance of CCPACSWingSegment::GetIsOn
+    const double SEGMENT_TOLERANCE = 0.03;
+
+    // The triangles of a single face with a face local vertex numbering.
+    // The faces are triangulated concurrently and merged afterwards.
+    struct FaceBlock
+    {
+        FaceBlock()
+            : segment(NULL)
+        {
+        }
+
+        std::vector<tigl::CTiglPoint> points;
+        std::vector<tigl::CTiglPoint> normals;
+        std::vector<unsigned long> triangles; // three local vertex indices per triangle
+
+        // segment info, only set if the segment of the face is known
+        tigl::CCPACSWingSegment* segment;
+        double isUpper;
+        std::vector<double> eta;              // per triangle
+        std::vector<double> xsi;              // per triangle
+        std::vector<std::string> metadata;    // per triangle
+    };
+
+    // The wing segments of a component with their bounding boxes.
+    // This is used to find the segment of a face without testing all segments.
+    struct ComponentSegments
+    {
+        std::vector<tigl::CCPACSWingSegment*> segments;
+        std::vector<Bnd_Box> boxes;
+    };
+
+    void triangulateFace(const TopoDS_Face& face, bool computeNormals, FaceBlock& block)
+    {
+        TopLoc_Location location;
+        const Handle(Poly_Triangulation) triangulation = BRep_Tool::Triangulation(face, location);
+        if (triangulation.IsNull()) {
+            return;
+        }
+
+        gp_Trsf nodeTransformation = location;
+
+        int ilower = 0;
+        if (triangulation->HasUVNodes() && computeNormals) {
+            // we use the uv nodes to compute normal vectors for each point
+            BRepGProp_Face prop(face);
+
+            const TColgp_Array1OfPnt2d& uvnodes = triangulation->UVNodes();
+            ilower = uvnodes.Lower();
+            block.points.reserve(uvnodes.Length());
+            block.normals.reserve(uvnodes.Length());
+            for (int inode = uvnodes.Lower(); inode <= uvnodes.Upper(); ++inode) {
+                const gp_Pnt2d& uv_pnt = uvnodes(inode);
+                gp_Pnt p; gp_Vec n;
+                prop.Normal(uv_pnt.X(),uv_pnt.Y(),p,n);
+                if (n.SquareMagnitude() > 0.) {
+                    n.Normalize();
+                }
+                if (face.Orientation() == TopAbs_INTERNAL) {
+                    n.Reverse();
+                }
+                block.points.push_back(p.XYZ());
+                block.normals.push_back(n.XYZ());
+            }
+        }
+        else {
+            const TColgp_Array1OfPnt& nodes = triangulation->Nodes();
+            ilower = nodes.Lower();
+            block.points.reserve(nodes.Length());
+            block.normals.reserve(nodes.Length());
+            for (int inode = nodes.Lower(); inode <= nodes.Upper(); inode++) {
+                const gp_Pnt& p = nodes(inode).Transformed(nodeTransformation);
+                block.points.push_back(p.XYZ());
+                block.normals.push_back(tigl::CTiglPoint(1,0,0));
+            }
+        }
+
+        const bool reversed = face.Orientation() == TopAbs_REVERSED || face.Orientation() == TopAbs_INTERNAL;
+        const Poly_Array1OfTriangle& triangles = triangulation->Triangles();
+        block.triangles.reserve(3 * triangles.Length());
+        for (int j = triangles.Lower(); j <= triangles.Upper(); j++) {
+            int occindex1, occindex2, occindex3;
+            triangles(j).Get(occindex1, occindex2, occindex3);
+            block.triangles.push_back(occindex1 - ilower);
+            if (!reversed) {
+                block.triangles.push_back(occindex2 - ilower);
+                block.triangles.push_back(occindex3 - ilower);
+            }
+            else {
+                block.triangles.push_back(occindex3 - ilower);
+                block.triangles.push_back(occindex2 - ilower);
+            }
+        }
+    }
+
+    gp_Pnt centralFacePoint(const TopoDS_Face& face)
+    {
+        BRepGProp_Face prop(face);
+        Standard_Real umin, umax, vmin, vmax;
+        prop.Bounds(umin, umax, vmin, vmax);
+
+        gp_Pnt centralP; gp_Vec n;
+        prop.Normal(0.5*(umin+umax), 0.5*(vmin+vmax), centralP, n);
+        return centralP;
+    }
+
+    // Searches the segment containing the point. The segments, whose bounding box
+    // contains the point, are tested first. Returns NULL, if no segment is found.
+    tigl::CCPACSWingSegment* findSegment(const ComponentSegments& lookup, const gp_Pnt& p, bool& mirrored)
+    {
+        for (int pass = 0; pass < 2; ++pass) {
+            for (size_t i = 0; i < lookup.segments.size(); ++i) {
+                tigl::CCPACSWingSegment& segment = *lookup.segments[i];
+                const bool hasSymmetry = segment.GetSymmetryAxis() != TIGL_NO_SYMMETRY;
+                const bool inBox = !lookup.boxes[i].IsOut(p) ||
+                                   (hasSymmetry && !lookup.boxes[i].IsOut(mirrorPoint(p, segment.GetSymmetryAxis())));
+                if (inBox != (pass == 0)) {
+                    continue;
+                }
+
+                if (segment.GetIsOn(p)) {
+                    mirrored = false;
+                    return &segment;
+                }
+                else if (hasSymmetry && segment.GetIsOnMirrored(p)) {
+                    mirrored = true;
+                    return &segment;
+                }
+            }
+        }
+        return NULL;
+    }
+
+    // computes the segment meta data of all triangles in the block
+    void annotateFace(tigl::CCPACSWingSegment& segment, bool mirrored, gp_Pnt pointOnSegmentFace, FaceBlock& block)
+    {
+        if (mirrored) {
+            pointOnSegmentFace = mirrorPoint(pointOnSegmentFace, segment.GetSymmetryAxis());
+        }
+
+        block.segment = &segment;
+        block.isUpper = segment.GetIsOnTop(pointOnSegmentFace);
+
+        const std::string symm = mirrored ? "_sym" : "";
+        const size_t nTriangles = block.triangles.size() / 3;
+        block.eta.resize(nTriangles);
+        block.xsi.resize(nTriangles);
+        block.metadata.resize(nTriangles);
+        for (size_t iTria = 0; iTria < nTriangles; ++iTria) {
+            tigl::CTiglPoint baryCenter(0.,0.,0.);
+            for (size_t jPoint = 0; jPoint < 3; ++jPoint) {
+                baryCenter += block.points[block.triangles[3*iTria + jPoint]];
+            }
+            baryCenter = baryCenter*(1./3.);
+            if (mirrored) {
+                baryCenter = mirrorPoint(baryCenter.Get_gp_Pnt(), segment.GetSymmetryAxis()).XYZ();
+            }
+
+            segment.GetEtaXsi(baryCenter.Get_gp_Pnt(), block.eta[iTria], block.xsi[iTria]);
+
+            std::stringstream stream;
+            stream << "\"" << segment.GetUID() << symm << "\" " << segment.GetSegmentIndex() << " "
+                   << block.eta[iTria] << " " << block.xsi[iTria] << " " << (block.isUpper != 0.);
+            block.metadata[iTria] = stream.str();
+        }
+    }
 }
 
 namespace tigl
@@ -77,15 +251,20 @@ CTiglTriangularizer::CTiglTriangularizer(PNamedShape pshape, double deflection,
     triangularizeComponent(NULL, pshape, deflection, NO_INFO);
 }
 
-CTiglTriangularizer::CTiglTriangularizer(const CTiglUIDManager* uidMgr, PNamedShape shape, double deflection, ComponentTraingMode mode, bool computeNormals)
+CTiglTriangularizer::CTiglTriangularizer(const CTiglUIDManager* uidMgr, PNamedShape shape, double deflection, ComponentTraingMode mode, bool computeNormals,
+                                         bool runParallel)
     : m_computeNormals(computeNormals)
 {
     if (!shape) {
         throw CTiglError("Null pointer shape in CTiglTriangularizer", TIGL_NULL_POINTER);
     }
 
-    triangularizeComponent(uidMgr, shape, deflection, mode);
-    
+    if (runParallel) {
+        triangularizeComponentParallel(uidMgr, shape, deflection, mode);
+    }
+    else {
+        triangularizeComponent(uidMgr, shape, deflection, mode);
+    }
 }
 
 bool isValidCoord(double c) 
@@ -101,13 +280,19 @@ bool isValidCoord(double c)
 
 void CTiglTriangularizer::writeFaceDummyMeta(unsigned long iPolyLower, unsigned long iPolyUpper)
 {
+    CTiglPolyObject& co = polys.currentObject();
+    const unsigned int isUpperId = co.getPolyDataFieldId("is_upper");
+    const unsigned int segmentIndexId = co.getPolyDataFieldId("segment_index");
+    const unsigned int etaId = co.getPolyDataFieldId("eta");
+    const unsigned int xsiId = co.getPolyDataFieldId("xsi");
+
     for (unsigned int iPoly = iPolyLower; iPoly <= iPolyUpper; iPoly++) {
-        polys.currentObject().setPolyDataReal(iPoly, "is_upper", 0.);
-        polys.currentObject().setPolyDataReal(iPoly, "segment_index", 0.);
-        polys.currentObject().setPolyDataReal(iPoly, "eta", 0.);
-        polys.currentObject().setPolyDataReal(iPoly, "xsi", 0.);
+        co.setPolyDataRealById(iPoly, isUpperId, 0.);
+        co.setPolyDataRealById(iPoly, segmentIndexId, 0.);
+        co.setPolyDataRealById(iPoly, etaId, 0.);
+        co.setPolyDataRealById(iPoly, xsiId, 0.);
 
-        polys.currentObject().setPolyMetadata(iPoly,"\"\" 0 0.0 0.0 0");
+        co.setPolyMetadata(iPoly,"\"\" 0 0.0 0.0 0");
     }
 }
 
@@ -171,9 +356,14 @@ int CTiglTriangularizer::triangularizeComponent(const CTiglUIDManager* uidMgr, P
         return TIGL_NULL_POINTER;
     }
 
+    CTiglScopedTimer timer("CTiglTriangularizer", pshape->Name());
+
     TopoDS_Shape shape = pshape->Shape();
     BRepTools::Clean (shape);
-    BRepMesh_IncrementalMesh(shape, deflection);
+    {
+        CTiglScopedTimer meshTimer("BRepMesh_IncrementalMesh", pshape->Name());
+        BRepMesh_IncrementalMesh(shape, deflection);
+    }
     LOG(INFO) << "Done meshing";
 
     polys.currentObject().enableNormals(m_computeNormals);
@@ -195,6 +385,152 @@ int CTiglTriangularizer::triangularizeComponent(const CTiglUIDManager* uidMgr, P
     return TIGL_SUCCESS;
 }
 
+/**
+ * Parallel version of triangularizeComponent
+ *
+ * The faces are meshed in parallel. Then, each face is triangulated into its own
+ * block of vertices and triangles, again in parallel. For the segment info, the
+ * wing segments of each component are collected once, such that each face
+ * only has to test the segments near to it. Finally, the blocks are merged
+ * in the order of the faces, which gives the same result as the serial version.
+ */
+int CTiglTriangularizer::triangularizeComponentParallel(const CTiglUIDManager* uidMgr, PNamedShape pshape, double deflection, ComponentTraingMode mode)
+{
+    if (!pshape) {
+        return TIGL_NULL_POINTER;
+    }
+
+    CTiglScopedTimer timer("CTiglTriangularizer", pshape->Name());
+
+    TopoDS_Shape shape = pshape->Shape();
+    BRepTools::Clean (shape);
+    {
+        CTiglScopedTimer meshTimer("BRepMesh_IncrementalMesh", pshape->Name());
+        BRepMesh_IncrementalMesh(shape, deflection, Standard_False, 0.5, Standard_True);
+    }
+    LOG(INFO) << "Done meshing";
+
+    polys.currentObject().enableNormals(m_computeNormals);
+
+    TopTools_IndexedMapOfShape faceMap;
+    TopExp::MapShapes(shape, TopAbs_FACE, faceMap);
+    const size_t nFaces = static_cast<size_t>(faceMap.Extent());
+
+    // collect the segments of each component, i.e. the face -> segment lookup
+    const bool writeMeta = mode == SEGMENT_INFO && uidMgr;
+    std::map<std::string, ComponentSegments> componentSegments;
+    std::vector<const ComponentSegments*> faceLookup(nFaces, static_cast<const ComponentSegments*>(NULL));
+    std::vector<std::string> faceComponents(nFaces);
+    for (size_t iface = 0; iface < nFaces && writeMeta; ++iface) {
+        faceComponents[iface] = pshape->GetFaceTraits(static_cast<int>(iface)).ComponentUID();
+        const std::string& componentUID = faceComponents[iface];
+        if (componentUID.empty()) {
+            continue;
+        }
+
+        std::map<std::string, ComponentSegments>::iterator it = componentSegments.find(componentUID);
+        if (it == componentSegments.end()) {
+            ComponentSegments lookup;
+            try {
+                ITiglGeometricComponent& component = uidMgr->GetGeometricComponent(componentUID);
+                if (component.GetComponentType() == TIGL_COMPONENT_WING) {
+                    CCPACSWing& wing = dynamic_cast<CCPACSWing&>(component);
+                    for (int iSegment = 1 ; iSegment <= wing.GetSegmentCount(); ++iSegment) {
+                        lookup.segments.push_back(&wing.GetSegment(iSegment));
+                    }
+                }
+                else if (component.GetComponentType() == TIGL_COMPONENT_WINGSEGMENT) {
+                    lookup.segments.push_back(&dynamic_cast<CCPACSWingSegment&>(component));
+                }
+            }
+            catch(CTiglError&) {
+                // uid is not a component. do nothing
+            }
+
+            for (size_t iSegment = 0; iSegment < lookup.segments.size(); ++iSegment) {
+                Bnd_Box box;
+                BRepBndLib::Add(lookup.segments[iSegment]->GetLoft()->Shape(), box);
+                box.Enlarge(SEGMENT_TOLERANCE);
+                lookup.boxes.push_back(box);
+            }
+            it = componentSegments.insert(std::make_pair(componentUID, lookup)).first;
+        }
+        faceLookup[iface] = &it->second;
+    }
+
+    // triangulate and annotate the faces concurrently
+    std::vector<FaceBlock> blocks(nFaces);
+    const bool computeNormals = m_computeNormals;
+    ParallelFor(nFaces, [&](size_t iface) {
+        const TopoDS_Face& face = TopoDS::Face(faceMap(static_cast<int>(iface) + 1));
+        FaceBlock& block = blocks[iface];
+        triangulateFace(face, computeNormals, block);
+
+        if (block.points.empty() || !faceLookup[iface]) {
+            return;
+        }
+
+        gp_Pnt centralP = centralFacePoint(face);
+        bool mirrored = false;
+        CCPACSWingSegment* segment = findSegment(*faceLookup[iface], centralP, mirrored);
+        if (segment) {
+            annotateFace(*segment, mirrored, centralP, block);
+        }
+    });
+
+    // merge the blocks
+    CTiglPolyObject& co = polys.currentObject();
+    unsigned int isUpperId = 0, segmentIndexId = 0, etaId = 0, xsiId = 0;
+    if (writeMeta) {
+        isUpperId = co.getPolyDataFieldId("is_upper");
+        segmentIndexId = co.getPolyDataFieldId("segment_index");
+        etaId = co.getPolyDataFieldId("eta");
+        xsiId = co.getPolyDataFieldId("xsi");
+    }
+
+    std::vector<unsigned long> vertexIndex;
+    for (size_t iface = 0; iface < nFaces; ++iface) {
+        const FaceBlock& block = blocks[iface];
+        if (block.points.empty()) {
+            continue;
+        }
+
+        vertexIndex.resize(block.points.size());
+        for (size_t i = 0; i < block.points.size(); ++i) {
+            vertexIndex[i] = co.addPointNormal(block.points[i], block.normals[i]);
+        }
+
+        for (size_t iTria = 0; iTria < block.triangles.size() / 3; ++iTria) {
+            unsigned long iPoly = co.addTriangleByVertexIndex(vertexIndex[block.triangles[3*iTria]],
+                                                              vertexIndex[block.triangles[3*iTria + 1]],
+                                                              vertexIndex[block.triangles[3*iTria + 2]]);
+            // In some rare cases, 2 indices are the same
+            // which means, that we dont have a true triangle.
+            // Ignore this triangle
+            if (iPoly == ULONG_MAX || !writeMeta) {
+                continue;
+            }
+
+            if (block.segment) {
+                co.setPolyDataRealById(iPoly, isUpperId, block.isUpper);
+                co.setPolyDataRealById(iPoly, segmentIndexId, (double) block.segment->GetSegmentIndex());
+                co.setPolyDataRealById(iPoly, etaId, block.eta[iTria]);
+                co.setPolyDataRealById(iPoly, xsiId, block.xsi[iTria]);
+                co.setPolyMetadata(iPoly, block.metadata[iTria].c_str());
+            }
+            else {
+                co.setPolyDataRealById(iPoly, isUpperId, 0.);
+                co.setPolyDataRealById(iPoly, segmentIndexId, 0.);
+                co.setPolyDataRealById(iPoly, etaId, 0.);
+                co.setPolyDataRealById(iPoly, xsiId, 0.);
+                co.setPolyMetadata(iPoly, "\"\" 0 0.0 0.0 0");
+            }
+        }
+    }
+
+    return TIGL_SUCCESS;
+}
+
 
 /**
  * @brief CTiglTriangularizer::annotateWingSegment Determines for polys in range iPolyLower...iPolyUpper the segment information, including segment index,
@@ -231,9 +567,15 @@ bool CTiglTriangularizer::writeWingSegmentMeta(tigl::ITiglGeometricComponent &se
     // GetIsOnTop is very slow, therefore we do it only once per face 
     bool isUpperFace = segment.GetIsOnTop(pointOnSegmentFace);
     
+    CTiglPolyObject& co = polys.currentObject();
+    const unsigned int isUpperId = co.getPolyDataFieldId("is_upper");
+    const unsigned int segmentIndexId = co.getPolyDataFieldId("segment_index");
+    const unsigned int etaId = co.getPolyDataFieldId("eta");
+    const unsigned int xsiId = co.getPolyDataFieldId("xsi");
+
     for (unsigned long iPoly = iPolyLower; iPoly <= iPolyUpper; iPoly++) {
-        polys.currentObject().setPolyDataReal(iPoly, "is_upper", (double) isUpperFace);
-        polys.currentObject().setPolyDataReal(iPoly, "segment_index", (double) segment.GetSegmentIndex());
+        co.setPolyDataRealById(iPoly, isUpperId, (double) isUpperFace);
+        co.setPolyDataRealById(iPoly, segmentIndexId, (double) segment.GetSegmentIndex());
         
         unsigned long npoints = polys.currentObject().getNPointsOfPolygon(iPoly);
         
@@ -249,8 +591,8 @@ bool CTiglTriangularizer::writeWingSegmentMeta(tigl::ITiglGeometricComponent &se
         
         double eta = 0., xsi = 0.;
         segment.GetEtaXsi(baryCenter.Get_gp_Pnt(), eta, xsi);
-        polys.currentObject().setPolyDataReal(iPoly, "eta", eta);
-        polys.currentObject().setPolyDataReal(iPoly, "xsi", xsi);
+        co.setPolyDataRealById(iPoly, etaId, eta);
+        co.setPolyDataRealById(iPoly, xsiId, xsi);
         
         // create metadata string
         std::stringstream stream;
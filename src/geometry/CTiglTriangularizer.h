@@ -50,8 +50,10 @@ class CTiglTriangularizer
 public:
     TIGL_EXPORT CTiglTriangularizer(PNamedShape shape, double deflection, bool computeNormals = true);
 
+    // If runParallel is true, the faces are meshed and annotated concurrently
     TIGL_EXPORT CTiglTriangularizer(const CTiglUIDManager* uidMgr, PNamedShape shape, double deflection,
-                                    ComponentTraingMode mode = NO_INFO, bool computeNormals = true);
+                                    ComponentTraingMode mode = NO_INFO, bool computeNormals = true,
+                                    bool runParallel = false);
 
     const CTiglPolyData& getTriangulation() const
     {
@@ -60,6 +62,7 @@ public:
 
 private:
     int triangularizeComponent(const CTiglUIDManager* uidMgr, PNamedShape shape, double deflection, ComponentTraingMode = NO_INFO);
+    int triangularizeComponentParallel(const CTiglUIDManager* uidMgr, PNamedShape shape, double deflection, ComponentTraingMode = NO_INFO);
     int triangularizeFace(const TopoDS_Face&, unsigned long& nVertices, unsigned long& iPolyLow, unsigned long& iPolyUp);
 
     void writeFaceDummyMeta(unsigned long iPolyLower, unsigned long iPolyUpper);
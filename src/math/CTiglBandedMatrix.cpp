@@ -0,0 +1,216 @@
+/*
+* Copyright (C) 2019 German Aerospace Center (DLR/SC)
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*/
+
+#include "CTiglBandedMatrix.h"
+
+#include "CTiglError.h"
+
+#include <algorithm>
+#include <cmath>
+
+namespace
+{
+    // Below this size, the dense solver is used
+    const int BANDED_MIN_SIZE = 50;
+}
+
+namespace tigl
+{
+
+CTiglBandedMatrix::CTiglBandedMatrix(int n, int lowerBandwidth, int upperBandwidth)
+    : m_n(n)
+    , m_kl(lowerBandwidth)
+    , m_ku(upperBandwidth)
+{
+    if (n < 1 || lowerBandwidth < 0 || upperBandwidth < 0) {
+        throw CTiglError("Invalid matrix dimensions in CTiglBandedMatrix::CTiglBandedMatrix", TIGL_MATH_ERROR);
+    }
+    m_data.assign(static_cast<size_t>(n) * static_cast<size_t>(m_kl + m_ku + 1), 0.);
+}
+
+bool CTiglBandedMatrix::IsEfficientFor(int n, int lowerBandwidth, int upperBandwidth)
+{
+    return n >= BANDED_MIN_SIZE && 4 * (2 * lowerBandwidth + upperBandwidth + 1) <= n;
+}
+
+CTiglBandedLU::CTiglBandedLU(const CTiglBandedMatrix& A, double minPivot)
+    : m_n(A.Size())
+    , m_kl(A.LowerBandwidth())
+    , m_ku(A.UpperBandwidth())
+    , m_width(2 * A.LowerBandwidth() + A.UpperBandwidth() + 1)
+    , m_pivots(static_cast<size_t>(A.Size()), 0)
+    , m_done(false)
+{
+    // Row interchanges widen the upper band of U by kl, hence
+    // each row stores the columns i - kl ... i + ku + kl
+    m_lu.assign(static_cast<size_t>(m_n) * static_cast<size_t>(m_width), 0.);
+    for (int i = 1; i <= m_n; ++i) {
+        int jmax = std::min(m_n, i + m_ku);
+        for (int j = std::max(1, i - m_kl); j <= jmax; ++j) {
+            lu(i, j) = A.Value(i, j);
+        }
+    }
+
+    for (int k = 1; k <= m_n; ++k) {
+        int imax = std::min(m_n, k + m_kl);
+        int jmax = std::min(m_n, k + m_ku + m_kl);
+
+        // find the pivot in column k
+        int pivot = k;
+        for (int i = k + 1; i <= imax; ++i) {
+            if (std::fabs(lu(i, k)) > std::fabs(lu(pivot, k))) {
+                pivot = i;
+            }
+        }
+        m_pivots[static_cast<size_t>(k - 1)] = pivot;
+        if (std::fabs(lu(pivot, k)) <= minPivot) {
+            return;
+        }
+
+        if (pivot != k) {
+            for (int j = k; j <= jmax; ++j) {
+                std::swap(lu(k, j), lu(pivot, j));
+            }
+        }
+
+        double diag = lu(k, k);
+        for (int i = k + 1; i <= imax; ++i) {
+            double factor = lu(i, k) / diag;
+            lu(i, k) = factor;
+            if (factor == 0.) {
+                continue;
+            }
+            for (int j = k + 1; j <= jmax; ++j) {
+                lu(i, j) -= factor * lu(k, j);
+            }
+        }
+    }
+    m_done = true;
+}
+
+void CTiglBandedLU::Solve(const math_Vector& b, math_Vector& x) const
+{
+    if (!m_done) {
+        throw CTiglError("Singular Matrix", TIGL_MATH_ERROR);
+    }
+    if (b.Length() != m_n || x.Length() != m_n) {
+        throw CTiglError("Invalid vector size in CTiglBandedLU::Solve", TIGL_MATH_ERROR);
+    }
+
+    std::vector<double> y(static_cast<size_t>(m_n) + 1);
+    for (int i = 1; i <= m_n; ++i) {
+        y[static_cast<size_t>(i)] = b.Value(b.Lower() + i - 1);
+    }
+
+    // forward substitution with the row interchanges applied in order
+    for (int k = 1; k <= m_n; ++k) {
+        int pivot = m_pivots[static_cast<size_t>(k - 1)];
+        if (pivot != k) {
+            std::swap(y[static_cast<size_t>(k)], y[static_cast<size_t>(pivot)]);
+        }
+        int imax = std::min(m_n, k + m_kl);
+        for (int i = k + 1; i <= imax; ++i) {
+            y[static_cast<size_t>(i)] -= lu(i, k) * y[static_cast<size_t>(k)];
+        }
+    }
+
+    // backward substitution
+    for (int k = m_n; k >= 1; --k) {
+        double sum = y[static_cast<size_t>(k)];
+        int jmax = std::min(m_n, k + m_ku + m_kl);
+        for (int j = k + 1; j <= jmax; ++j) {
+            sum -= lu(k, j) * y[static_cast<size_t>(j)];
+        }
+        y[static_cast<size_t>(k)] = sum / lu(k, k);
+    }
+
+    for (int i = 1; i <= m_n; ++i) {
+        x(x.Lower() + i - 1) = y[static_cast<size_t>(i)];
+    }
+}
+
+CTiglBandedCholesky::CTiglBandedCholesky(const CTiglBandedMatrix& A)
+    : m_n(A.Size())
+    , m_k(A.LowerBandwidth())
+    , m_done(false)
+{
+    m_l.assign(static_cast<size_t>(m_n) * static_cast<size_t>(m_k + 1), 0.);
+    for (int i = 1; i <= m_n; ++i) {
+        for (int j = std::max(1, i - m_k); j <= i; ++j) {
+            l(i, j) = A.Value(i, j);
+        }
+    }
+
+    for (int j = 1; j <= m_n; ++j) {
+        int kmin = std::max(1, j - m_k);
+        double diag = l(j, j);
+        for (int k = kmin; k < j; ++k) {
+            diag -= l(j, k) * l(j, k);
+        }
+        if (diag <= 0.) {
+            return;
+        }
+        diag = std::sqrt(diag);
+        l(j, j) = diag;
+
+        int imax = std::min(m_n, j + m_k);
+        for (int i = j + 1; i <= imax; ++i) {
+            double sum = l(i, j);
+            for (int k = std::max(1, i - m_k); k < j; ++k) {
+                sum -= l(i, k) * l(j, k);
+            }
+            l(i, j) = sum / diag;
+        }
+    }
+    m_done = true;
+}
+
+void CTiglBandedCholesky::Solve(const math_Vector& b, math_Vector& x) const
+{
+    if (!m_done) {
+        throw CTiglError("Matrix not positive definite", TIGL_MATH_ERROR);
+    }
+    if (b.Length() != m_n || x.Length() != m_n) {
+        throw CTiglError("Invalid vector size in CTiglBandedCholesky::Solve", TIGL_MATH_ERROR);
+    }
+
+    std::vector<double> y(static_cast<size_t>(m_n) + 1);
+
+    // L*y = b
+    for (int i = 1; i <= m_n; ++i) {
+        double sum = b.Value(b.Lower() + i - 1);
+        for (int k = std::max(1, i - m_k); k < i; ++k) {
+            sum -= l(i, k) * y[static_cast<size_t>(k)];
+        }
+        y[static_cast<size_t>(i)] = sum / l(i, i);
+    }
+
+    // L^T*x = y
+    for (int i = m_n; i >= 1; --i) {
+        double sum = y[static_cast<size_t>(i)];
+        int kmax = std::min(m_n, i + m_k);
+        for (int k = i + 1; k <= kmax; ++k) {
+            sum -= l(k, i) * y[static_cast<size_t>(k)];
+        }
+        y[static_cast<size_t>(i)] = sum / l(i, i);
+    }
+
+    for (int i = 1; i <= m_n; ++i) {
+        x(x.Lower() + i - 1) = y[static_cast<size_t>(i)];
+    }
+}
+
+} // namespace tigl
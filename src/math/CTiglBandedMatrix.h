@@ -0,0 +1,153 @@
+/*
+* Copyright (C) 2019 German Aerospace Center (DLR/SC)
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*/
+
+#ifndef CTIGLBANDEDMATRIX_H
+#define CTIGLBANDEDMATRIX_H
+
+#include "tigl_internal.h"
+
+#include <math_Vector.hxx>
+
+#include <cstddef>
+#include <vector>
+
+namespace tigl
+{
+
+/**
+ * @brief Square matrix, that stores only the diagonal band
+ *
+ * Entry (i, j) is nonzero only for i - LowerBandwidth() <= j <= i + UpperBandwidth().
+ * Indices are one based as in math_Matrix.
+ */
+class CTiglBandedMatrix
+{
+public:
+    /// Creates a zero initialized n x n matrix with the given bandwidths
+    TIGL_EXPORT CTiglBandedMatrix(int n, int lowerBandwidth, int upperBandwidth);
+
+    TIGL_EXPORT int Size() const { return m_n; }
+    TIGL_EXPORT int LowerBandwidth() const { return m_kl; }
+    TIGL_EXPORT int UpperBandwidth() const { return m_ku; }
+
+    /// Returns true, if (i, j) lies within the band
+    TIGL_EXPORT bool InBand(int i, int j) const
+    {
+        return j >= i - m_kl && j <= i + m_ku;
+    }
+
+    /// Returns the entry (i, j). Entries outside the band are zero
+    TIGL_EXPORT double Value(int i, int j) const
+    {
+        return InBand(i, j) ? m_data[index(i, j)] : 0.;
+    }
+
+    /// Read/write access to an entry inside the band
+    TIGL_EXPORT double& operator()(int i, int j)
+    {
+        return m_data[index(i, j)];
+    }
+
+    /**
+     * @brief Returns true, if the banded solvers should be preferred over
+     * a dense solver for a system of size n with the given bandwidths
+     *
+     * For small systems, the dense solver is as fast and more robust
+     * against badly conditioned matrices, as it pivots over the whole column.
+     */
+    TIGL_EXPORT static bool IsEfficientFor(int n, int lowerBandwidth, int upperBandwidth);
+
+private:
+    size_t index(int i, int j) const
+    {
+        return static_cast<size_t>(i - 1) * static_cast<size_t>(m_kl + m_ku + 1)
+             + static_cast<size_t>(j - i + m_kl);
+    }
+
+    int m_n, m_kl, m_ku;
+    std::vector<double> m_data;
+};
+
+/**
+ * @brief LU decomposition with partial pivoting of a banded matrix
+ *
+ * The interface follows math_Gauss. Factorization costs O(n*kl*(kl+ku)),
+ * each solve O(n*(2*kl+ku)).
+ */
+class CTiglBandedLU
+{
+public:
+    TIGL_EXPORT explicit CTiglBandedLU(const CTiglBandedMatrix& A, double minPivot = 1.0e-20);
+
+    /// Returns false, if the matrix is singular
+    TIGL_EXPORT bool IsDone() const { return m_done; }
+
+    /// Solves A*x = b
+    TIGL_EXPORT void Solve(const math_Vector& b, math_Vector& x) const;
+
+private:
+    double& lu(int i, int j)
+    {
+        return m_lu[static_cast<size_t>(i - 1) * static_cast<size_t>(m_width) + static_cast<size_t>(j - i + m_kl)];
+    }
+
+    double lu(int i, int j) const
+    {
+        return m_lu[static_cast<size_t>(i - 1) * static_cast<size_t>(m_width) + static_cast<size_t>(j - i + m_kl)];
+    }
+
+    int m_n, m_kl, m_ku, m_width;
+    std::vector<double> m_lu;
+    std::vector<int> m_pivots;
+    bool m_done;
+};
+
+/**
+ * @brief Cholesky decomposition of a symmetric positive definite banded matrix
+ *
+ * Only the lower band of the matrix is used. The interface follows math_Gauss.
+ * Factorization costs O(n*k^2), each solve O(n*k) with k the bandwidth.
+ */
+class CTiglBandedCholesky
+{
+public:
+    TIGL_EXPORT explicit CTiglBandedCholesky(const CTiglBandedMatrix& A);
+
+    /// Returns false, if the matrix is not positive definite
+    TIGL_EXPORT bool IsDone() const { return m_done; }
+
+    /// Solves A*x = b
+    TIGL_EXPORT void Solve(const math_Vector& b, math_Vector& x) const;
+
+private:
+    double& l(int i, int j)
+    {
+        return m_l[static_cast<size_t>(i - 1) * static_cast<size_t>(m_k + 1) + static_cast<size_t>(j - i + m_k)];
+    }
+
+    double l(int i, int j) const
+    {
+        return m_l[static_cast<size_t>(i - 1) * static_cast<size_t>(m_k + 1) + static_cast<size_t>(j - i + m_k)];
+    }
+
+    int m_n, m_k;
+    std::vector<double> m_l;
+    bool m_done;
+};
+
+} // namespace tigl
+
+#endif // CTIGLBANDEDMATRIX_H
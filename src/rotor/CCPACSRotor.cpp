@@ -32,8 +32,6 @@
 #include "CTiglError.h"
 #include "CNamedShape.h"
 
-#include "GProp_GProps.hxx"
-#include "BRepGProp.hxx"
 #include "BRep_Builder.hxx"
 
 namespace tigl
@@ -181,25 +179,13 @@ PNamedShape CCPACSRotor::BuildLoft() const
 // Returns the volume of this rotor
 double CCPACSRotor::GetVolume()
 {
-    TopoDS_Shape fusedRotorBlades = GetLoft()->Shape();
-
-    // Calculate volume
-    GProp_GProps System;
-    BRepGProp::VolumeProperties(fusedRotorBlades, System);
-    double myVolume = System.Mass();
-    return myVolume;
+    return GetIntegralProperties(TIGL_INTEGRATION_EXACT).volume;
 }
 
 // Returns the surface area of this rotor
 double CCPACSRotor::GetSurfaceArea()
 {
-    TopoDS_Shape fusedRotorBlades = GetLoft()->Shape();
-
-    // Calculate surface area
-    GProp_GProps System;
-    BRepGProp::SurfaceProperties(fusedRotorBlades, System);
-    double myArea = System.Mass();
-    return myArea;
+    return GetIntegralProperties(TIGL_INTEGRATION_EXACT).surfaceArea;
 }
 
 // Returns the reference area of this rotor
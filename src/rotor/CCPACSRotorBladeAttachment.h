@@ -46,6 +46,10 @@ public:
     using generated::CPACSRotorBladeAttachment::ReadCPACS;
     using generated::CPACSRotorBladeAttachment::WriteCPACS;
 
+    using generated::CPACSRotorBladeAttachment::IsDirty;
+    using generated::CPACSRotorBladeAttachment::ClearDirty;
+    using generated::CPACSRotorBladeAttachment::WriteDirtyCPACS;
+
     using generated::CPACSRotorBladeAttachment::GetUID;
     using generated::CPACSRotorBladeAttachment::SetUID;
 
@@ -64,6 +64,7 @@ void CCPACSRotorProfiles::DeleteProfile(std::string uid)
 {
     for (std::vector<unique_ptr<CCPACSProfileGeometry> >::iterator it = m_rotorAirfoils.begin(); it != m_rotorAirfoils.end(); ++it) {
         if ((*it)->GetUID() == uid) {
+            m_dirty = true;
             m_rotorAirfoils.erase(it);
             return;
         }
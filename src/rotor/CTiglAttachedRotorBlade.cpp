@@ -32,8 +32,6 @@
 #include "CNamedShape.h"
 #include "math/tiglmathfunctions.h"
 
-#include "GProp_GProps.hxx"
-#include "BRepGProp.hxx"
 #include "BRepBuilderAPI_MakePolygon.hxx"
 #include "BRepPrimAPI_MakeRevol.hxx"
 
@@ -122,25 +120,23 @@ double CTiglAttachedRotorBlade::GetAzimuthAngle() const
 // Returns the volume of this rotor blade
 double CTiglAttachedRotorBlade::GetVolume()
 {
-    TopoDS_Shape fusedSegments = GetLoft()->Shape();
+    // rigid transformations do not change the volume
+    if (GetTransformationMatrix().IsRigid()) {
+        return rotorBlade->GetVolume();
+    }
 
-    // Calculate volume
-    GProp_GProps System;
-    BRepGProp::VolumeProperties(fusedSegments, System);
-    double myVolume = System.Mass();
-    return myVolume;
+    return GetIntegralProperties(TIGL_INTEGRATION_EXACT).volume;
 }
 
 // Returns the surface area of this rotor blade
 double CTiglAttachedRotorBlade::GetSurfaceArea()
 {
-    TopoDS_Shape fusedSegments = GetLoft()->Shape();
+    // rigid transformations do not change the area
+    if (GetTransformationMatrix().IsRigid()) {
+        return rotorBlade->GetSurfaceArea();
+    }
 
-    // Calculate surface area
-    GProp_GProps System;
-    BRepGProp::SurfaceProperties(fusedSegments, System);
-    double myArea = System.Mass();
-    return myArea;
+    return GetIntegralProperties(TIGL_INTEGRATION_EXACT).surfaceArea;
 }
 
 // Returns the planform area of this rotor blade
@@ -279,9 +275,19 @@ double CTiglAttachedRotorBlade::GetLocalTwistAngle(const int& segmentIndex, cons
 }
 
 
-// Create the rotor blade geometry by copying and transforming the original unattached rotor blade geometry
+// Create the rotor blade geometry as located instance or transformed copy of the original unattached rotor blade geometry
 PNamedShape CTiglAttachedRotorBlade::BuildLoft() const
 {
+    const CTiglTransformation& bladeTransformation = transformation.getTransformationMatrix();
+    if (bladeTransformation.IsRigid()) {
+        // All blades of the rotor share the geometry of the unattached rotor blade,
+        // each blade is just a located instance of it
+        PNamedShape unattachedLoft = rotorBlade->GetLoft();
+        PNamedShape rotorBladeInstance(new CNamedShape(*unattachedLoft));
+        rotorBladeInstance->SetShape(bladeTransformation.Locate(unattachedLoft->Shape()));
+        return rotorBladeInstance;
+    }
+
     // Create a new instance of the referenced unattached rotor blade and apply the transformations to it
     PNamedShape rotorBladeCopy = rotorBlade->GetLoft()->DeepCopy();
     TopoDS_Shape transformedShape = transformation.getTransformationMatrix().Transform(rotorBladeCopy->Shape());
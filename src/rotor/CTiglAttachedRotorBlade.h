@@ -114,7 +114,8 @@ protected:
     // Builds transformation matrix for the rotor blade including rotor transformation
     void BuildMatrix();
 
-    // Create the rotor blade geometry by copying and transforming the original unattached rotor blade geometry
+    // Create the rotor blade geometry as located instance of the original unattached rotor blade geometry.
+    // If the blade transformation is not rigid, the geometry is copied and transformed.
     PNamedShape BuildLoft() const OVERRIDE;
 
 private:
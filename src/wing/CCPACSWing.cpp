@@ -30,6 +30,7 @@
 #include "CCPACSConfiguration.h"
 #include "CTiglAbstractSegment.h"
 #include "CCPACSWingSegment.h"
+#include "CCPACSWingComponentSegment.h"
 #include "CCPACSWings.h"
 #include "CCPACSAircraftModel.h"
 #include "CCPACSRotorcraftModel.h"
@@ -43,8 +44,6 @@
 #include "BRepOffsetAPI_ThruSections.hxx"
 #include "BRepAlgoAPI_Fuse.hxx"
 #include "ShapeFix_Shape.hxx"
-#include "GProp_GProps.hxx"
-#include "BRepGProp.hxx"
 #include "BRepAlgoAPI_Cut.hxx"
 #include "Bnd_Box.hxx"
 #include "BRepBndLib.hxx"
@@ -54,6 +53,8 @@
 #include "CTiglMakeLoft.h"
 #include <TopExp.hxx>
 #include <TopTools_IndexedMapOfShape.hxx>
+#include <TopoDS_Shell.hxx>
+#include <BRep_Builder.hxx>
 
 
 namespace tigl
@@ -94,6 +95,7 @@ CCPACSWing::CCPACSWing(CCPACSWings* parent, CTiglUIDManager* uidMgr)
     , rebuildFusedSegWEdge(true)
     , rebuildShells(true)
     , guideCurves(*this, &CCPACSWing::BuildGuideCurveWires)
+    , wettedArea(-1.)
 {
     if (parent->IsParent<CCPACSAircraftModel>())
         configuration = &parent->GetParent<CCPACSAircraftModel>()->GetConfiguration();
@@ -112,6 +114,7 @@ CCPACSWing::CCPACSWing(CCPACSRotorBlades* parent, CTiglUIDManager* uidMgr)
     , rebuildFusedSegWEdge(true)
     , rebuildShells(true)
     , guideCurves(*this, &CCPACSWing::BuildGuideCurveWires)
+    , wettedArea(-1.)
 {
     Cleanup();
 }
@@ -133,6 +136,60 @@ void CCPACSWing::Invalidate()
         m_componentSegments->Invalidate();
 }
 
+// Invalidates only the geometry depending on the given section element
+void CCPACSWing::InvalidateSectionElement(const std::string& elementUID)
+{
+    std::vector<CCPACSWingSegment*> affectedSegments;
+    for (int i = 1; i <= GetSegmentCount(); ++i) {
+        CCPACSWingSegment& segment = GetSegment(i);
+        // segments, that are not lofted linearly, are cut from the wing loft and
+        // would keep the faces of the old wing loft
+        if (segment.GetFromElementUID() == elementUID || segment.GetToElementUID() == elementUID
+            || !segment.IsLoftedLinearly()) {
+            segment.Invalidate();
+            affectedSegments.push_back(&segment);
+        }
+    }
+
+    if (m_componentSegments) {
+        for (int i = 1; i <= m_componentSegments->GetComponentSegmentCount(); ++i) {
+            CCPACSWingComponentSegment& componentSegment = m_componentSegments->GetComponentSegment(i);
+            const SegmentList& segments = componentSegment.GetSegmentList();
+            for (std::size_t j = 0; j < affectedSegments.size(); ++j) {
+                if (std::find(segments.begin(), segments.end(), affectedSegments[j]) != segments.end()) {
+                    componentSegment.Invalidate();
+                    break;
+                }
+            }
+        }
+    }
+
+    // the wing loft and the fused aircraft depend on all segments
+    CTiglAbstractGeometricComponent::Reset();
+    guideCurves.clear();
+    rebuildFusedSegments = true;
+    rebuildFusedSegWEdge = true;
+    rebuildShells        = true;
+    configuration->InvalidateFusedAircraft();
+}
+
+void CCPACSWing::EvictDerivedGeometry()
+{
+    // the segments would keep the faces of the old wing loft and not share the ones of the rebuilt loft
+    for (int i = 1; i <= GetSegmentCount(); ++i) {
+        CCPACSWingSegment& segment = GetSegment(i);
+        if (!segment.IsLoftedLinearly()) {
+            segment.EvictLoft();
+        }
+    }
+    upperShape.Nullify();
+    lowerShape.Nullify();
+    rebuildShells = true;
+    wettedAreaLoft.Nullify();
+    wettedAreaParent.Nullify();
+    wettedArea = -1.;
+}
+
 // Cleanup routine
 void CCPACSWing::Cleanup()
 {
@@ -342,9 +399,38 @@ PNamedShape CCPACSWing::BuildFusedSegments(bool splitWingInUpperAndLower) const
     return loft;
 }
     
-// Builds a fused shape of all wing segments
+// Builds the upper and lower shells of the wing
 void CCPACSWing::BuildUpperLowerShells()
 {
+    // share the faces of the wing loft instead of lofting the profiles again
+    PNamedShape wingLoft = GetLoft();
+    TopTools_IndexedMapOfShape faceMap;
+    TopExp::MapShapes(wingLoft->Shape(), TopAbs_FACE, faceMap);
+
+    TopoDS_Shell upperShell, lowerShell;
+    BRep_Builder builder;
+    builder.MakeShell(upperShell);
+    builder.MakeShell(lowerShell);
+    int nUpperFaces = 0, nLowerFaces = 0;
+    for (int iFace = 1; iFace <= faceMap.Extent(); ++iFace) {
+        const std::string& faceName = wingLoft->GetFaceTraits(iFace - 1).Name();
+        if (faceName == "Top") {
+            builder.Add(upperShell, faceMap(iFace));
+            nUpperFaces++;
+        }
+        else if (faceName == "Bottom") {
+            builder.Add(lowerShell, faceMap(iFace));
+            nLowerFaces++;
+        }
+    }
+
+    if (nUpperFaces > 0 && nLowerFaces > 0) {
+        upperShape = upperShell;
+        lowerShape = lowerShell;
+        return;
+    }
+
+    // the faces of the loft could not be named, loft the upper and lower profile wires
     //@todo: this probably works only if the wings does not split somewere
     BRepOffsetAPI_ThruSections generatorUp(Standard_False, Standard_True, Precision::Confusion() );
     BRepOffsetAPI_ThruSections generatorLow(Standard_False, Standard_True, Precision::Confusion() );
@@ -405,25 +491,13 @@ gp_Pnt CCPACSWing::GetChordPoint(int segmentIndex, double eta, double xsi)
 // Returns the volume of this wing
 double CCPACSWing::GetVolume()
 {
-    const TopoDS_Shape fusedSegments = GetLoft()->Shape();
-
-    // Calculate volume
-    GProp_GProps System;
-    BRepGProp::VolumeProperties(fusedSegments, System);
-    double myVolume = System.Mass();
-    return myVolume;
+    return GetIntegralProperties(TIGL_INTEGRATION_EXACT).volume;
 }
 
 // Returns the surface area of this wing
 double CCPACSWing::GetSurfaceArea()
 {
-    const TopoDS_Shape fusedSegments = GetLoft()->Shape();
-
-    // Calculate surface area
-    GProp_GProps System;
-    BRepGProp::SurfaceProperties(fusedSegments, System);
-    double myArea = System.Mass();
-    return myArea;
+    return GetIntegralProperties(TIGL_INTEGRATION_EXACT).surfaceArea;
 }
 
 // Returns the reference area of the wing by taking account the quadrilateral portions
@@ -443,12 +517,14 @@ double CCPACSWing::GetWettedArea(TopoDS_Shape parent)
 {
     const TopoDS_Shape loft = GetLoft()->Shape();
 
-    TopoDS_Shape wettedLoft = BRepAlgoAPI_Cut(loft, parent); 
-
-    GProp_GProps System;
-    BRepGProp::SurfaceProperties(wettedLoft, System);
-    double wetArea = System.Mass();
-    return wetArea;
+    // The boolean cut is only repeated if the wing or the parent changed
+    if (wettedArea < 0. || !wettedAreaLoft.IsSame(loft) || !wettedAreaParent.IsSame(parent)) {
+        TopoDS_Shape wettedLoft = BRepAlgoAPI_Cut(loft, parent);
+        wettedArea       = ComputeIntegralProperties(wettedLoft, TIGL_INTEGRATION_EXACT).surfaceArea;
+        wettedAreaLoft   = loft;
+        wettedAreaParent = parent;
+    }
+    return wettedArea;
 }
 
     
@@ -58,6 +58,12 @@ public:
     // Invalidates internal state
     TIGL_EXPORT void Invalidate();
 
+    // Invalidates only the geometry depending on the given section element, i.e.
+    // the segments connected to the element, the segments cut from the wing loft,
+    // the component segments containing these segments and the wing loft.
+    // Linearly lofted segments not connected to the element keep their cached geometry.
+    TIGL_EXPORT void InvalidateSectionElement(const std::string& elementUID);
+
     // Read CPACS wing elements
     TIGL_EXPORT void ReadCPACS(const TixiDocumentHandle& tixiHandle, const std::string& wingXPath) OVERRIDE;
 
@@ -176,6 +182,9 @@ protected:
     PNamedShape BuildFusedSegments(bool splitWingInUpperAndLower) const;
         
     PNamedShape BuildLoft() const OVERRIDE;
+
+    // Drops the segment lofts cut from the wing loft and the shells sharing its faces
+    void EvictDerivedGeometry() OVERRIDE;
         
     void BuildUpperLowerShells();
 
@@ -190,6 +199,9 @@ private:
     TopoDS_Shape                   upperShape;
     TopoDS_Shape                   lowerShape;
     Cache<TopoDS_Compound, CCPACSWing> guideCurves;
+    TopoDS_Shape                   wettedAreaLoft;           /**< Loft, for which the wetted area has been computed */
+    TopoDS_Shape                   wettedAreaParent;         /**< Parent loft, for which the wetted area has been computed */
+    double                         wettedArea;               /**< Wetted area, negative if not computed */
     bool                           invalidated;              /**< Internal state flag */
     bool                           rebuildFusedSegments;     /**< Indicates if segmentation fusing need rebuild */
     bool                           rebuildFusedSegWEdge;     /**< Indicates if segmentation fusing need rebuild */
@@ -37,6 +37,7 @@ CCPACSWingCellPositionChordwise::InputType CCPACSWingCellPositionChordwise::GetI
 
 void CCPACSWingCellPositionChordwise::SetXsi1(double xsi1)
 {
+    m_dirty = true;
     m_xsi1_choice2 = xsi1;
     m_sparUID_choice1 = boost::none;
 
@@ -45,6 +46,7 @@ void CCPACSWingCellPositionChordwise::SetXsi1(double xsi1)
 
 void CCPACSWingCellPositionChordwise::SetXsi2(double xsi2)
 {
+    m_dirty = true;
     m_xsi2_choice2 = xsi2;
     m_sparUID_choice1 = boost::none;
 
@@ -53,6 +55,7 @@ void CCPACSWingCellPositionChordwise::SetXsi2(double xsi2)
 
 void CCPACSWingCellPositionChordwise::SetXsi(double xsi1, double xsi2)
 {
+    m_dirty = true;
     m_xsi1_choice2 = xsi1;
     m_xsi2_choice2 = xsi2;
     m_sparUID_choice1 = boost::none;
@@ -78,6 +81,7 @@ std::pair<double, double> CCPACSWingCellPositionChordwise::GetXsi() const
 
 void CCPACSWingCellPositionChordwise::SetSparUId(std::string sparUId)
 {
+    m_dirty = true;
     m_xsi1_choice2 = boost::none;
     m_xsi2_choice2 = boost::none;
     m_sparUID_choice1 = sparUId;
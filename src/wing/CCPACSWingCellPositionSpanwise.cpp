@@ -34,6 +34,7 @@ CCPACSWingCellPositionSpanwise::InputType CCPACSWingCellPositionSpanwise::GetInp
 }
 
 void CCPACSWingCellPositionSpanwise::SetEta1(double eta1) {
+    m_dirty = true;
     m_eta1_choice1 = eta1;
     m_ribNumber_choice2 = boost::none;
     m_ribDefinitionUID_choice2 = boost::none;
@@ -42,6 +43,7 @@ void CCPACSWingCellPositionSpanwise::SetEta1(double eta1) {
 }
 
 void CCPACSWingCellPositionSpanwise::SetEta2(double eta2) {
+    m_dirty = true;
     m_eta2_choice1 = eta2;
     m_ribNumber_choice2 = boost::none;
     m_ribDefinitionUID_choice2 = boost::none;
@@ -50,6 +52,7 @@ void CCPACSWingCellPositionSpanwise::SetEta2(double eta2) {
 }
 
 void CCPACSWingCellPositionSpanwise::SetEta(double eta1, double eta2) {
+    m_dirty = true;
     m_eta1_choice1 = eta1;
     m_eta2_choice1 = eta2;
 
@@ -74,6 +77,7 @@ std::pair<double, double> CCPACSWingCellPositionSpanwise::GetEta() const {
 }
 
 void CCPACSWingCellPositionSpanwise::SetRib(const std::string& ribUId, int nRib) {
+    m_dirty = true;
     m_eta1_choice1 = boost::none;
     m_eta2_choice1 = boost::none;
     m_ribNumber_choice2 = nRib;
@@ -83,6 +87,7 @@ void CCPACSWingCellPositionSpanwise::SetRib(const std::string& ribUId, int nRib)
 }
 
 void CCPACSWingCellPositionSpanwise::SetRibDefinitionUID(const std::string& ribUId) {
+    m_dirty = true;
     m_eta1_choice1 = boost::none;
     m_eta2_choice1 = boost::none;
     m_ribDefinitionUID_choice2 = ribUId;
@@ -91,6 +96,7 @@ void CCPACSWingCellPositionSpanwise::SetRibDefinitionUID(const std::string& ribU
 }
 
 void CCPACSWingCellPositionSpanwise::SetRibNumber(int nRib) {
+    m_dirty = true;
     m_eta1_choice1 = boost::none;
     m_eta2_choice1 = boost::none;
     m_ribNumber_choice2 = nRib;
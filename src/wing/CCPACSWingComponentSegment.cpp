@@ -38,6 +38,7 @@
 #include "CTiglMakeLoft.h"
 #include "CPointsToLinearBSpline.h"
 #include "tiglcommonfunctions.h"
+#include "tiglparallel.h"
 #include "CCPACSWingCSStructure.h"
 #include "CNamedShape.h"
 #include "CTiglWingChordface.h"
@@ -161,6 +162,7 @@ CCPACSWingComponentSegment::CCPACSWingComponentSegment(CCPACSWingComponentSegmen
     , wingSegments(*this, &CCPACSWingComponentSegment::BuildWingSegments)
     , geomCache(*this, &CCPACSWingComponentSegment::BuildGeometry)
     , linesCache(*this, &CCPACSWingComponentSegment::BuildLines)
+    , segmentIndex(*this, &CCPACSWingComponentSegment::BuildSegmentIndex)
     , upperShape(tigl::make_unique<ShapeAdaptor>(this, &CCPACSWingComponentSegment::GetUpperShape, m_uidMgr))
     , lowerShape(tigl::make_unique<ShapeAdaptor>(this, &CCPACSWingComponentSegment::GetLowerShape, m_uidMgr))
     , chordFace(make_unique<CTiglWingChordface>(*this, uidMgr))
@@ -186,6 +188,7 @@ void CCPACSWingComponentSegment::Invalidate()
     }
     geomCache.clear();
     linesCache.clear();
+    segmentIndex.clear();
     chordFace->Reset();
     upperShape->Reset();
     lowerShape->Reset();
@@ -199,6 +202,7 @@ void CCPACSWingComponentSegment::Cleanup()
     m_toElementUID   = "";
     geomCache.clear();
     linesCache.clear();
+    segmentIndex.clear();
     CTiglAbstractSegment<CCPACSWingComponentSegment>::Reset();
     wingSegments.clear();
 }
@@ -890,6 +894,28 @@ gp_Pnt CCPACSWingComponentSegment::GetPoint(double eta, double xsi, TiglCoordina
     return result;
 }
 
+// Gets points on the chord face for a list of eta/xsi coordinates in the global coordinate system.
+// The points are evaluated using up to nThreads threads (nThreads <= 0: number of hardware threads).
+std::vector<gp_Pnt> CCPACSWingComponentSegment::GetPoints(const std::vector<double>& etas, const std::vector<double>& xsis, int nThreads) const
+{
+    if (etas.size() != xsis.size()) {
+        throw CTiglError("Number of eta and xsi values differ in CCPACSWingComponentSegment::GetPoints", TIGL_ERROR);
+    }
+
+    std::vector<gp_Pnt> points(etas.size());
+    if (points.empty()) {
+        return points;
+    }
+
+    // build the chord face before going parallel
+    points[0] = GetPoint(etas[0], xsis[0]);
+    ParallelFor(etas.size() - 1, [&](size_t i) {
+        points[i + 1] = GetPoint(etas[i + 1], xsis[i + 1]);
+    }, nThreads);
+
+    return points;
+}
+
 void CCPACSWingComponentSegment::GetEtaXsi(const gp_Pnt& globalPoint, double& eta, double& xsi) const
 {
     // TODO (siggel): check that point is part of component segment
@@ -996,34 +1022,44 @@ double CCPACSWingComponentSegment::GetSurfaceArea()
     return geomCache->mySurfaceArea;
 }
 
-// Returns the segment to a given point on the componentSegment. 
-// Returns null if the point is not an that wing!
-const CCPACSWingSegment* CCPACSWingComponentSegment::findSegment(double x, double y, double z, gp_Pnt& nearestPoint, double& deviation, double maxDeviation) const
+namespace
 {
-    CCPACSWingSegment* result = NULL;
-    gp_Pnt pnt(x, y, z);
-
+    struct NearestSegment
+    {
+        NearestSegment()
+            : segment(NULL)
+            , eta(0.)
+            , xsi(0.)
+            , deviation(std::numeric_limits<double>::max())
+        {
+        }
 
-    const SegmentList& segments = GetSegmentList();
+        const CCPACSWingSegment* segment;
+        gp_Pnt nearestPoint;
+        double eta, xsi;
+        double deviation;
+    };
 
-    deviation = std::numeric_limits<double>::max();
-    // now discover to which segment the point belongs
-    for (SegmentList::const_iterator segit = segments.begin(); segit != segments.end(); ++segit) {
+    // Projects the point onto the segment and updates nearest, if the segment is closer
+    void updateNearestSegment(const CCPACSWingSegment& segment, const gp_Pnt& pnt, NearestSegment& nearest)
+    {
         try {
             double eta, xsi;
-            (*segit)->GetEtaXsi(pnt, eta, xsi);
-            gp_Pnt pointProjected = (*segit)->GetChordPoint(eta, xsi);
+            segment.GetEtaXsi(pnt, eta, xsi);
+            gp_Pnt pointProjected = segment.GetChordPoint(eta, xsi);
 
             // Get nearest point on this segment
             double nextEta = GetNearestValidParameter(eta);
             double nextXsi = GetNearestValidParameter(xsi);
-            gp_Pnt currentPoint = (*segit)->GetChordPoint(nextEta, nextXsi);
+            gp_Pnt currentPoint = segment.GetChordPoint(nextEta, nextXsi);
 
             double currentDist = currentPoint.Distance(pointProjected);
-            if (currentDist < deviation) {
-                deviation    = currentDist;
-                nearestPoint = currentPoint;
-                result       = *segit;
+            if (currentDist < nearest.deviation) {
+                nearest.deviation    = currentDist;
+                nearest.nearestPoint = currentPoint;
+                nearest.eta          = nextEta;
+                nearest.xsi          = nextXsi;
+                nearest.segment      = &segment;
             }
         }
         catch (...) {
@@ -1031,12 +1067,123 @@ const CCPACSWingSegment* CCPACSWingComponentSegment::findSegment(double x, doubl
         }
     }
 
+    // Returns the maximum thickness of the profile relative to its chord length
+    double relativeProfileThickness(const CCPACSWingProfile& profile)
+    {
+        const int nSamples = 20;
+        double thickness = 0.;
+        for (int i = 0; i <= nSamples; ++i) {
+            const double xsi = static_cast<double>(i) / nSamples;
+            thickness = std::max(thickness, profile.GetUpperPoint(xsi).Distance(profile.GetLowerPoint(xsi)));
+        }
+        const double chord = profile.GetLEPoint().Distance(profile.GetTEPoint());
+        return chord > Precision::Confusion() ? thickness / chord : 0.;
+    }
+}
+
+// Returns the segment to a given point on the componentSegment. 
+// Returns null if the point is not an that wing!
+const CCPACSWingSegment* CCPACSWingComponentSegment::findSegment(double x, double y, double z, gp_Pnt& nearestPoint, double& deviation, double maxDeviation) const
+{
+    double eta, xsi;
+    return findSegment(gp_Pnt(x, y, z), nearestPoint, deviation, eta, xsi, maxDeviation);
+}
+
+const CCPACSWingSegment* CCPACSWingComponentSegment::findSegment(const gp_Pnt& pnt, gp_Pnt& nearestPoint, double& deviation,
+                                                                 double& segmentEta, double& segmentXsi, double maxDeviation) const
+{
+    const SegmentList& segments = GetSegmentList();
+
+    // First check only the segments, whose bounding box contains the point.
+    // The segments are checked in the same order as in the full search below,
+    // such that the same segment is found in case of equal deviations.
+    std::vector<bool> checked(segments.size(), false);
+    NearestSegment nearest;
+    const std::vector<size_t> candidates = segmentIndex->Find(pnt, maxDeviation);
+    for (std::vector<size_t>::const_iterator it = candidates.begin(); it != candidates.end(); ++it) {
+        updateNearestSegment(*segments[*it], pnt, nearest);
+        checked[*it] = true;
+    }
+
+    // The deviation is measured within the chord surface only. Hence, points outside
+    // of all boxes might still be assigned to a segment. If no candidate contains the
+    // point exactly, fall back to check all remaining segments.
+    if (nearest.deviation > 0.) {
+        for (size_t i = 0; i < segments.size(); ++i) {
+            if (!checked[i]) {
+                updateNearestSegment(*segments[i], pnt, nearest);
+            }
+        }
+    }
+
+    deviation    = nearest.deviation;
+    nearestPoint = nearest.nearestPoint;
+    segmentEta   = nearest.eta;
+    segmentXsi   = nearest.xsi;
+
     // check if pnt lies on component segment shape with maxDeviation tolerance (default 1cm)
     if (deviation > maxDeviation) {
         return NULL;
     }
 
-    return result;
+    return nearest.segment;
+}
+
+void CCPACSWingComponentSegment::findSegments(const std::vector<gp_Pnt>& points, std::vector<const CCPACSWingSegment*>& segments,
+                                              std::vector<double>& segmentEtas, std::vector<double>& segmentXsis,
+                                              int nThreads, double maxDeviation) const
+{
+    segments.assign(points.size(), NULL);
+    segmentEtas.assign(points.size(), 0.);
+    segmentXsis.assign(points.size(), 0.);
+    if (points.empty()) {
+        return;
+    }
+
+    auto findPoint = [&](size_t i) {
+        gp_Pnt nearestPoint;
+        double deviation;
+        segments[i] = findSegment(points[i], nearestPoint, deviation, segmentEtas[i], segmentXsis[i], maxDeviation);
+    };
+
+    // build the segment index and chord faces before going parallel
+    for (SegmentList::const_iterator it = GetSegmentList().begin(); it != GetSegmentList().end(); ++it) {
+        (*it)->GetChordPoint(0., 0.);
+    }
+    findPoint(0);
+    ParallelFor(points.size() - 1, [&](size_t i) {
+        findPoint(i + 1);
+    }, nThreads);
+}
+
+void CCPACSWingComponentSegment::BuildSegmentIndex(CTiglBoundingBoxTree& cache) const
+{
+    const SegmentList& segments = GetSegmentList();
+    std::vector<Bnd_Box> boxes(segments.size());
+    for (size_t i = 0; i < segments.size(); ++i) {
+        try {
+            // The box is built from the chord surface, such that the lofts are not required.
+            // It is enlarged by the profile thickness to contain the skins as well.
+            const CCPACSWingSegment& segment = *segments[i];
+            const gp_Pnt innerLE = segment.GetChordPoint(0., 0.);
+            const gp_Pnt innerTE = segment.GetChordPoint(0., 1.);
+            const gp_Pnt outerLE = segment.GetChordPoint(1., 0.);
+            const gp_Pnt outerTE = segment.GetChordPoint(1., 1.);
+            boxes[i].Add(innerLE);
+            boxes[i].Add(innerTE);
+            boxes[i].Add(outerLE);
+            boxes[i].Add(outerTE);
+
+            const double innerThickness = relativeProfileThickness(segment.GetInnerConnection().GetProfile()) * innerLE.Distance(innerTE);
+            const double outerThickness = relativeProfileThickness(segment.GetOuterConnection().GetProfile()) * outerLE.Distance(outerTE);
+            boxes[i].Enlarge(std::max(innerThickness, outerThickness));
+        }
+        catch (...) {
+            // always check segments without valid loft
+            boxes[i].SetWhole();
+        }
+    }
+    cache.Build(boxes);
 }
 
 MaterialList CCPACSWingComponentSegment::GetMaterials(double eta, double xsi, TiglStructureType type)
@@ -44,6 +44,7 @@
 #include "CCPACSTransformation.h"
 #include "CTiglShapeGeomComponentAdaptor.h"
 #include "Cache.h"
+#include "CTiglBoundingBoxTree.h"
 
 namespace tigl
 {
@@ -89,6 +90,10 @@ public:
     // Gets a point in relative wing coordinates for a given eta and xsi
     TIGL_EXPORT gp_Pnt GetPoint(double eta, double xsi, TiglCoordinateSystem referenceCS = GLOBAL_COORDINATE_SYSTEM) const;
 
+    // Gets points in global coordinates for a list of eta and xsi coordinates.
+    // The points are computed using up to nThreads threads (nThreads <= 0: all hardware threads).
+    TIGL_EXPORT std::vector<gp_Pnt> GetPoints(const std::vector<double>& etas, const std::vector<double>& xsis, int nThreads = 1) const;
+
     // Returns the eta xsi coordinates of a points projected onto the midplane / chordface
     TIGL_EXPORT void GetEtaXsi(const gp_Pnt& globalPoint, double& eta, double& xsi) const;
     TIGL_EXPORT void GetEtaXsiLocal(const gp_Pnt& localPoint, double& eta, double& xsi) const;
@@ -126,6 +131,17 @@ public:
     // Returns null if the point is not an that wing, i.e. deviates more than 1 cm from the wing
     TIGL_EXPORT const CCPACSWingSegment* findSegment(double x, double y, double z, gp_Pnt& nearestPoint, double& deviation, double maxDeviation = 1.e-2) const;
 
+    // Same as above, but additionally returns the eta xsi coordinates of the point on the found segment
+    TIGL_EXPORT const CCPACSWingSegment* findSegment(const gp_Pnt& point, gp_Pnt& nearestPoint, double& deviation,
+                                                     double& segmentEta, double& segmentXsi, double maxDeviation = 1.e-2) const;
+
+    // Finds the segments and segment eta xsi coordinates for a list of global points.
+    // Points not on the component segment get a null segment. The points are processed
+    // using up to nThreads threads (nThreads <= 0: all hardware threads).
+    TIGL_EXPORT void findSegments(const std::vector<gp_Pnt>& points, std::vector<const CCPACSWingSegment*>& segments,
+                                  std::vector<double>& segmentEtas, std::vector<double>& segmentXsis,
+                                  int nThreads = 1, double maxDeviation = 1.e-2) const;
+
     TIGL_EXPORT TiglGeometricComponentType GetComponentType() const OVERRIDE { return TIGL_COMPONENT_WINGCOMPSEGMENT; }
     TIGL_EXPORT TiglGeometricComponentIntent GetComponentIntent() const OVERRIDE {return TIGL_INTENT_LOGICAL; }
 
@@ -215,6 +231,7 @@ private:
     void BuildWingSegments(SegmentList& cache) const;
     void BuildGeometry(GeometryCache& cache) const;
     void BuildLines(LinesCache& cache) const; // Method for building wires for eta-, leading edge-, trailing edge-lines
+    void BuildSegmentIndex(CTiglBoundingBoxTree& cache) const; // Bounding box tree of the segments
 
 private:
     // get short name for loft
@@ -238,6 +255,7 @@ private:
     Cache<SegmentList, CCPACSWingComponentSegment> wingSegments; ///< List of segments belonging to the component segment
     Cache<GeometryCache, CCPACSWingComponentSegment> geomCache;
     Cache<LinesCache, CCPACSWingComponentSegment> linesCache;
+    Cache<CTiglBoundingBoxTree, CCPACSWingComponentSegment> segmentIndex; ///< Spatial index of the segments, used by findSegment
 };
 
 inline std::vector<tigl::CCPACSWingSegment*> getSortedSegments(const CCPACSWingComponentSegment& cs)
@@ -19,6 +19,7 @@
 * @brief  Implementation of CPACS wing profile handling routines.
 */
 
+#include <algorithm>
 #include <iostream>
 #include <sstream>
 #include <vector>
@@ -32,6 +33,8 @@
 #include "gp_Vec2d.hxx"
 #include "gp_Dir2d.hxx"
 #include "gp_Pln.hxx"
+#include "gp_Vec.hxx"
+#include "Precision.hxx"
 #include "Geom2d_Line.hxx"
 #include "Geom2d_TrimmedCurve.hxx"
 #include "Geom_TrimmedCurve.hxx"
@@ -91,6 +94,7 @@ CCPACSWingProfile::CCPACSWingProfile(CTiglUIDManager* uidMgr)
     : generated::CPACSProfileGeometry(uidMgr)
     , isRotorProfile(false)
     , pointListAlgo(*this, &CCPACSWingProfile::buildPointListAlgo)
+    , pointLookup(*this, &CCPACSWingProfile::buildPointLookup)
 {
 }
 
@@ -101,6 +105,7 @@ void CCPACSWingProfile::Cleanup()
 {
     isRotorProfile = false;
     pointListAlgo.clear();
+    pointLookup.clear();
 }
 
 // Read wing profile file
@@ -128,6 +133,7 @@ bool CCPACSWingProfile::IsRotorProfile() const
 void CCPACSWingProfile::Invalidate()
 {
     GetProfileAlgo()->Invalidate();
+    pointLookup.clear();
 }
 
 // Returns the wing profile upper wire
@@ -267,6 +273,19 @@ gp_Pnt CCPACSWingProfile::GetPoint(double xsi, bool fromUpper) const
         return GetTEPoint();
     }
 
+    gp_Pnt point;
+    if (GetPointFromLookup(xsi, fromUpper, point)) {
+        return point;
+    }
+
+    // the lookup table can not be used, e.g. if the profile curve is not monotone in xsi
+    return GetPointFromIntersection(xsi, fromUpper);
+}
+
+// Computes the profile point at xsi by intersecting the profile curve with
+// a line normal to the chord line
+gp_Pnt CCPACSWingProfile::GetPointFromIntersection(double xsi, bool fromUpper) const
+{
     gp_Pnt   chordPoint3d = GetChordPoint(xsi);
     gp_Pnt2d chordPoint2d(chordPoint3d.X(), chordPoint3d.Z());
 
@@ -338,6 +357,117 @@ gp_Pnt CCPACSWingProfile::GetPoint(double xsi, bool fromUpper) const
     throw CTiglError("No intersection point found in CCPACSWingProfile::GetPoint", TIGL_NOT_FOUND);
 }
 
+// Computes the profile point at xsi using the lookup table. The table gives a start
+// parameter, which is refined by a safeguarded newton iteration. Returns false,
+// if the point can not be computed from the table.
+bool CCPACSWingProfile::GetPointFromLookup(double xsi, bool fromUpper, gp_Pnt& point) const
+{
+    const PointLookupCache& lookup = *pointLookup;
+    const XsiParameterTable& table = fromUpper ? lookup.upper : lookup.lower;
+    if (!table.valid || xsi < table.xsis.front() || xsi > table.xsis.back()) {
+        return false;
+    }
+
+    // find interval with xsis[i-1] <= xsi <= xsis[i]
+    size_t i = std::upper_bound(table.xsis.begin(), table.xsis.end(), xsi) - table.xsis.begin();
+    i = std::max<size_t>(1, std::min(i, table.xsis.size() - 1));
+
+    // parameters, where xsi(tLow) <= xsi <= xsi(tHigh)
+    double tLow  = table.params[i-1];
+    double tHigh = table.params[i];
+    double t = tLow + (tHigh - tLow) * (xsi - table.xsis[i-1]) / (table.xsis[i] - table.xsis[i-1]);
+
+    const double chordX = lookup.te.X() - lookup.le.X();
+    const double chordZ = lookup.te.Z() - lookup.le.Z();
+    const double chordLength2 = chordX*chordX + chordZ*chordZ;
+    const double chordLength  = sqrt(chordLength2);
+
+    const int maxIter = 20;
+    for (int iter = 0; iter < maxIter; ++iter) {
+        gp_Pnt p;
+        gp_Vec dp;
+        table.curve->D1(t, p, dp);
+
+        double f = ((p.X() - lookup.le.X())*chordX + (p.Z() - lookup.le.Z())*chordZ) / chordLength2 - xsi;
+        if (fabs(f) * chordLength < Precision::Confusion()) {
+            point = gp_Pnt(p.X(), 0.0, p.Z());
+            return true;
+        }
+
+        // shrink the bracket
+        if (f < 0.) {
+            tLow = t;
+        }
+        else {
+            tHigh = t;
+        }
+
+        // newton step, fall back to bisection if the step leaves the bracket
+        double dfdt = (dp.X()*chordX + dp.Z()*chordZ) / chordLength2;
+        double tNew = fabs(dfdt) > 0. ? t - f / dfdt : 0.5 * (tLow + tHigh);
+        if (tNew <= std::min(tLow, tHigh) || tNew >= std::max(tLow, tHigh)) {
+            tNew = 0.5 * (tLow + tHigh);
+        }
+        t = tNew;
+    }
+
+    return false;
+}
+
+void CCPACSWingProfile::buildPointLookup(PointLookupCache& cache) const
+{
+    cache.le = GetLEPoint();
+    cache.te = GetTEPoint();
+    buildXsiParameterTable(GetUpperWire(), cache.le, cache.te, cache.upper);
+    buildXsiParameterTable(GetLowerWire(), cache.le, cache.te, cache.lower);
+}
+
+// Samples the profile edge and stores the chord parameter xsi of each sample point.
+// The table is only marked as valid, if xsi is strictly monotone along the edge.
+void CCPACSWingProfile::buildXsiParameterTable(const TopoDS_Edge& edge, const gp_Pnt& le, const gp_Pnt& te, XsiParameterTable& table) const
+{
+    table.valid = false;
+
+    Standard_Real firstParam;
+    Standard_Real lastParam;
+    Handle(Geom_Curve) curve = BRep_Tool::Curve(edge, firstParam, lastParam);
+    if (curve.IsNull()) {
+        return;
+    }
+
+    const double chordX = te.X() - le.X();
+    const double chordZ = te.Z() - le.Z();
+    const double chordLength2 = chordX*chordX + chordZ*chordZ;
+    if (chordLength2 < Precision::SquareConfusion()) {
+        return;
+    }
+
+    const int nSamples = 200;
+    table.curve = curve;
+    table.xsis.resize(nSamples);
+    table.params.resize(nSamples);
+    for (int i = 0; i < nSamples; ++i) {
+        double t = firstParam + (lastParam - firstParam) * static_cast<double>(i) / static_cast<double>(nSamples - 1);
+        gp_Pnt p = curve->Value(t);
+        table.params[i] = t;
+        table.xsis[i] = ((p.X() - le.X())*chordX + (p.Z() - le.Z())*chordZ) / chordLength2;
+    }
+
+    // the upper curve usually runs from the trailing edge to the leading edge
+    if (table.xsis.front() > table.xsis.back()) {
+        std::reverse(table.xsis.begin(), table.xsis.end());
+        std::reverse(table.params.begin(), table.params.end());
+    }
+
+    for (int i = 1; i < nSamples; ++i) {
+        if (table.xsis[i] <= table.xsis[i-1]) {
+            return;
+        }
+    }
+
+    table.valid = true;
+}
+
 // Helper function to determine the chord line between leading and trailing edge in the profile plane
 Handle(Geom2d_TrimmedCurve) CCPACSWingProfile::GetChordLine() const
 {
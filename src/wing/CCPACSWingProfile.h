@@ -37,8 +37,11 @@
 
 #include <gp_Pnt.hxx>
 
+#include <Geom_Curve.hxx>
 #include <Geom2d_TrimmedCurve.hxx>
 
+#include <vector>
+
 namespace tigl 
 {
 class CTiglWingProfilePointList;
@@ -107,6 +110,15 @@ public:
     // Checks, whether the trailing edge is blunt or not
     TIGL_EXPORT bool HasBluntTE() const;
 
+    // Computes the profile point at xsi using the lookup table of GetPoint. Returns false,
+    // if the point can not be computed from the table, e.g. if the profile curve is not
+    // monotone in xsi
+    TIGL_EXPORT bool GetPointFromLookup(double xsi, bool fromUpper, gp_Pnt& point) const;
+
+    // Computes the profile point at xsi by intersecting the profile curve with
+    // a line normal to the chord line. This is the fallback of GetPoint.
+    TIGL_EXPORT gp_Pnt GetPointFromIntersection(double xsi, bool fromUpper) const;
+
 protected:
     // Cleanup routine
     void Cleanup();
@@ -123,6 +135,31 @@ protected:
 
     void buildPointListAlgo(unique_ptr<CTiglWingProfilePointList>& cache) const;
 
+private:
+    // Monotone lookup table xsi -> curve parameter of the upper or lower profile curve
+    struct XsiParameterTable
+    {
+        XsiParameterTable() : valid(false) {}
+
+        Handle(Geom_Curve)  curve;
+        std::vector<double> xsis;   // strictly increasing
+        std::vector<double> params; // curve parameters belonging to xsis
+        bool                valid;  // false, if xsi is not monotone along the curve
+    };
+
+    struct PointLookupCache
+    {
+        gp_Pnt            le;
+        gp_Pnt            te;
+        XsiParameterTable upper;
+        XsiParameterTable lower;
+    };
+
+    void buildPointLookup(PointLookupCache& cache) const;
+
+    // Builds the xsi -> parameter table of a profile edge
+    void buildXsiParameterTable(const TopoDS_Edge& edge, const gp_Pnt& le, const gp_Pnt& te, XsiParameterTable& table) const;
+
 private:
     // Copy constructor
     CCPACSWingProfile(const CCPACSWingProfile& );
@@ -133,6 +170,7 @@ private:
 private:
     bool                                  isRotorProfile; /**< Indicates if this profile is a rotor profile */
     Cache<unique_ptr<CTiglWingProfilePointList>, CCPACSWingProfile> pointListAlgo;  // is created in case the wing profile alg is a point list, otherwise cst2d constructed in the base class is used
+    Cache<PointLookupCache, CCPACSWingProfile> pointLookup;  // speeds up repeated calls of GetPoint
 
 }; // class CCPACSWingProfile
 
@@ -457,7 +457,18 @@ void CCPACSWingRibsDefinition::BuildGeometry(RibGeometryCache& cache) const
 
     TopoDS_Shape loft = CTiglWingStructureReference(getStructure()).GetLoft(WING_COORDINATE_SYSTEM)->Shape();
 
+    // intersect all rib cut faces with the loft in a single boolean operation
+    std::vector<TopoDS_Shape> ribCutFaces;
+    for (int i = 0; i < GetNumberOfRibs(); i++) {
+        const CutGeometry& cutGeometry = GetRibCutGeometry(i + 1);
+        if (!cutGeometry.isTargetFace) {
+            ribCutFaces.push_back(cutGeometry.shape);
+        }
+    }
+    const std::vector<TopoDS_Shape> ribCutEdgesPerRib = CutShapesPerFace(ribCutFaces, loft);
+
     // Step 3: iterate over all ribs for this rib definition
+    size_t ribCutIndex = 0;
     for (int i = 0; i < GetNumberOfRibs(); i++) {
         const CutGeometry& cutGeometry = GetRibCutGeometry(i + 1);
         // handle case when ribCutFace is identical with target rib face
@@ -466,8 +477,8 @@ void CCPACSWingRibsDefinition::BuildGeometry(RibGeometryCache& cache) const
             cache.ribFaces.push_back(cutGeometry.shape);
         }
         else {
-            // intersect rib cut face with loft
-            TopoDS_Shape ribCutEdges = CutShapes(cutGeometry.shape, loft);
+            // intersection of rib cut face with loft
+            const TopoDS_Shape& ribCutEdges = ribCutEdgesPerRib[ribCutIndex++];
 
             // build wires out of connected edges
             TopTools_ListOfShape wireList;
@@ -57,6 +57,7 @@ CCPACSWingRibsPositioning::StartDefinitionType CCPACSWingRibsPositioning::GetSta
 
 void CCPACSWingRibsPositioning::SetEtaStart(double value)
 {
+    m_dirty = true;
     generated::CPACSWingRibsPositioning::SetEtaStart_choice1(value);
 
     m_elementStartUID_choice2 = boost::none;
@@ -68,6 +69,7 @@ void CCPACSWingRibsPositioning::SetEtaStart(double value)
 
 void CCPACSWingRibsPositioning::SetElementStartUID(const std::string& uid)
 {
+    m_dirty = true;
     generated::CPACSWingRibsPositioning::SetElementStartUID_choice2(uid);
 
     m_etaStart_choice1 = boost::none;
@@ -78,6 +80,7 @@ void CCPACSWingRibsPositioning::SetElementStartUID(const std::string& uid)
 
 void CCPACSWingRibsPositioning::SetSparPositionStartUID(const std::string& uid)
 {
+    m_dirty = true;
     generated::CPACSWingRibsPositioning::SetSparPositionStartUID_choice3(uid);
 
     m_etaStart_choice1 = boost::none;
@@ -99,6 +102,7 @@ CCPACSWingRibsPositioning::EndDefinitionType CCPACSWingRibsPositioning::GetEndDe
 
 void CCPACSWingRibsPositioning::SetEtaEnd(double value)
 {
+    m_dirty = true;
     generated::CPACSWingRibsPositioning::SetEtaEnd_choice1(value);
 
     m_elementEndUID_choice2 = boost::none;
@@ -109,6 +113,7 @@ void CCPACSWingRibsPositioning::SetEtaEnd(double value)
 
 void CCPACSWingRibsPositioning::SetElementEndUID(const std::string& uid)
 {
+    m_dirty = true;
     generated::CPACSWingRibsPositioning::SetElementEndUID_choice2(uid);
 
     m_etaEnd_choice1 = boost::none;
@@ -119,6 +124,7 @@ void CCPACSWingRibsPositioning::SetElementEndUID(const std::string& uid)
 
 void CCPACSWingRibsPositioning::SetSparPositionEndUID(const std::string& uid)
 {
+    m_dirty = true;
     generated::CPACSWingRibsPositioning::SetSparPositionEndUID_choice3(uid);
 
     m_etaEnd_choice1 = boost::none;
@@ -138,6 +144,7 @@ CCPACSWingRibsPositioning::RibCountDefinitionType CCPACSWingRibsPositioning::Get
 
 void CCPACSWingRibsPositioning::SetNumberOfRibs(int numRibs)
 {
+    m_dirty = true;
     m_numberOfRibs_choice2 = numRibs;
 
     m_spacing_choice1 = boost::none;
@@ -147,6 +154,7 @@ void CCPACSWingRibsPositioning::SetNumberOfRibs(int numRibs)
 
 void CCPACSWingRibsPositioning::SetSpacing(double value)
 {
+    m_dirty = true;
     m_spacing_choice1 = value;
 
     m_numberOfRibs_choice2 = boost::none;
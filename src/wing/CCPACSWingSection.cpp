@@ -71,19 +71,29 @@ CTiglPoint CCPACSWingSection::GetScaling() const
 void CCPACSWingSection::SetTranslation(const CTiglPoint& trans)
 {
     m_transformation.setTranslation(trans, ABS_LOCAL);
-
+    InvalidateElements();
 }
 
 // Setter for rotation
 void CCPACSWingSection::SetRotation(const CTiglPoint& rot)
 {
     m_transformation.setRotation(rot);
+    InvalidateElements();
 }
 
 // Setter for scaling
 void CCPACSWingSection::SetScaling(const CTiglPoint& scale)
 {
     m_transformation.setScaling(scale);
+    InvalidateElements();
+}
+
+// Invalidates the geometry depending on the elements of this section
+void CCPACSWingSection::InvalidateElements()
+{
+    for (int i = 1; i <= GetSectionElementCount(); ++i) {
+        GetSectionElement(i).Invalidate();
+    }
 }
 
 } // end namespace tigl
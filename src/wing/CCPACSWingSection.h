@@ -64,6 +64,10 @@ public:
 
     // Setter for scaling
     TIGL_EXPORT void SetScaling(const CTiglPoint& scaling);
+
+private:
+    // Invalidates the geometry depending on the elements of this section
+    void InvalidateElements();
 };
 
 } // end namespace tigl
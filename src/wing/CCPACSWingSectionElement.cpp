@@ -22,7 +22,9 @@
 #include "CCPACSWingSectionElement.h"
 
 #include "CCPACSWingSection.h"
+#include "CCPACSWingSections.h"
 #include "CCPACSWing.h"
+#include "CCPACSEnginePylon.h"
 
 namespace tigl
 {
@@ -31,8 +33,20 @@ CCPACSWingSectionElement::CCPACSWingSectionElement(CCPACSWingSectionElements* pa
 
 void CCPACSWingSectionElement::SetAirfoilUID(const std::string& value) {
     generated::CPACSWingElement::SetAirfoilUID(value);
-    // invalidate wing as we affect wing segments and component segments
-    m_parent->GetParent()->GetParent()->GetParent<CCPACSWing>()->Invalidate();
+    Invalidate();
+}
+
+// Invalidates the geometry depending on this element. For wings, only the
+// segments and component segments connected to the element are invalidated.
+void CCPACSWingSectionElement::Invalidate()
+{
+    CCPACSWingSections* sections = m_parent->GetParent()->GetParent();
+    if (sections->IsParent<CCPACSWing>()) {
+        sections->GetParent<CCPACSWing>()->InvalidateSectionElement(m_uID);
+    }
+    else if (sections->IsParent<CCPACSEnginePylon>()) {
+        sections->GetParent<CCPACSEnginePylon>()->Invalidate();
+    }
 }
 
 // Gets the section element transformation
@@ -59,16 +73,19 @@ CTiglPoint CCPACSWingSectionElement::GetScaling() const
 void CCPACSWingSectionElement::SetTranslation(const CTiglPoint &trans)
 {
     m_transformation.setTranslation(trans, ABS_LOCAL);
+    Invalidate();
 }
 
 void CCPACSWingSectionElement::SetRotation(const CTiglPoint &rot)
 {
     m_transformation.setRotation(rot);
+    Invalidate();
 }
 
 void CCPACSWingSectionElement::SetScaling(const CTiglPoint &scaling)
 {
     m_transformation.setScaling(scaling);
+    Invalidate();
 }
 
 } // end namespace tigl
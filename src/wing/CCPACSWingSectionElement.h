@@ -56,6 +56,9 @@ public:
 
     // Setter for scaling
     TIGL_EXPORT void SetScaling(const CTiglPoint& scaling);
+
+    // Invalidates the geometry depending on this element
+    TIGL_EXPORT void Invalidate();
 };
 
 } // end namespace tigl
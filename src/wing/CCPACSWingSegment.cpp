@@ -42,6 +42,7 @@
 #include "CTiglMakeLoft.h"
 #include "CTiglPatchShell.h"
 #include "tiglcommonfunctions.h"
+#include "tiglparallel.h"
 #include "tigl_config.h"
 #include "math/tiglmathfunctions.h"
 #include "CNamedShape.h"
@@ -117,13 +118,18 @@ namespace tigl
 
 namespace
 {
-    gp_Pnt transformProfilePoint(const tigl::CTiglTransformation& wingTransform, const tigl::CTiglWingConnection& connection, const gp_Pnt& point)
+    CTiglTransformation getProfileTransformation(const tigl::CTiglTransformation& wingTransform, const tigl::CTiglWingConnection& connection)
     {
         CTiglTransformation trafo = connection.GetSectionElementTransformation();
         trafo.PreMultiply(connection.GetSectionTransformation());
         trafo.PreMultiply(connection.GetPositioningTransformation());
         trafo.PreMultiply(wingTransform);
-        return trafo.Transform(point);
+        return trafo;
+    }
+
+    gp_Pnt transformProfilePoint(const tigl::CTiglTransformation& wingTransform, const tigl::CTiglWingConnection& connection, const gp_Pnt& point)
+    {
+        return getProfileTransformation(wingTransform, connection).Transform(point);
     }
 
     // Set the face traits
@@ -207,6 +213,11 @@ void CCPACSWingSegment::Invalidate()
     volumeCache.clear();
 }
 
+bool CCPACSWingSegment::IsLoftedLinearly() const
+{
+    return loftLinearly;
+}
+
 // Cleanup routine
 void CCPACSWingSegment::Cleanup()
 {
@@ -389,7 +400,11 @@ std::string CCPACSWingSegment::GetShortShapeName () const
 PNamedShape CCPACSWingSegment::BuildLoft() const
 {
     TopoDS_Shape loftShape;
-    if ( loftLinearly ) {
+    if ( !loftLinearly ) {
+        // share the surfaces of the wing loft
+        loftShape = BuildLoftFromWing();
+    }
+    if ( loftShape.IsNull() ) {
         // build loft using inner and outer wires and possibly guidecurves
         TopoDS_Wire innerWire = GetInnerWire();
         TopoDS_Wire outerWire = GetOuterWire();
@@ -435,42 +450,6 @@ PNamedShape CCPACSWingSegment::BuildLoft() const
         sfs->Perform();
         loftShape = sfs->Shape();
     }
-    else {
-        const CCPACSWingSegments* segments = GetParent();
-        PNamedShape wingLoft = segments->GetParentComponent()->GetLoft();
-
-
-        TopoDS_Shell loftShell;
-        BRep_Builder BB;
-        BB.MakeShell(loftShell);
-
-        TopTools_IndexedMapOfShape faceMap;
-        TopExp::MapShapes(wingLoft->Shape(), TopAbs_FACE, faceMap);
-        int nFaces = faceMap.Extent();
-        int nSegments = segments->GetSegmentCount();
-        int nFacesPerSegment = (nFaces - 2)/nSegments;
-
-        // determine index of segment to retrieve the correct subshapes of the wing
-        // Here we explicitly require the subshapes to be ordered consistently
-        for (int j = 1; j <= segments->GetSegmentCount(); j++) {
-            const CCPACSWingSegment& ws = segments->GetSegment(j);
-            if (GetUID() == ws.GetUID()) {
-                for(int i=0; i<nFacesPerSegment; ++i) {
-                    BB.Add(loftShell, TopoDS::Face(faceMap((j-1)*nFacesPerSegment + i + 1))); // guides
-                }
-                break;
-            }
-        }
-
-        //close the shell with sidecaps and make them a solid
-        TopoDS_Wire innerWire = GetInnerWire();
-        TopoDS_Wire outerWire = GetOuterWire();
-
-        CTiglPatchShell patcher(loftShell);
-        patcher.AddSideCap(innerWire);
-        patcher.AddSideCap(outerWire);
-        loftShape = patcher.PatchedShape();
-    }
 
     // Set Names
     std::string loftName = GetUID();
@@ -480,6 +459,53 @@ PNamedShape CCPACSWingSegment::BuildLoft() const
     return loft;
 }
 
+// Extracts the faces of this segment from the wing loft. The wing loft
+// is built once for all segments, hence the profiles are not skinned again.
+TopoDS_Shape CCPACSWingSegment::BuildLoftFromWing() const
+{
+    const CCPACSWingSegments* segments = GetParent();
+    PNamedShape wingLoft = segments->GetParentComponent()->GetLoft();
+    if (!wingLoft) {
+        return TopoDS_Shape();
+    }
+
+    TopTools_IndexedMapOfShape faceMap;
+    TopExp::MapShapes(wingLoft->Shape(), TopAbs_FACE, faceMap);
+    int nFaces = faceMap.Extent();
+    int nSegments = segments->GetSegmentCount();
+    if (nFaces <= 2 || (nFaces - 2) % nSegments != 0) {
+        LOG(WARNING) << "Cannot extract the faces of wing segment " << GetUID()
+                     << " from the wing loft. The segment is lofted separately.";
+        return TopoDS_Shape();
+    }
+    int nFacesPerSegment = (nFaces - 2)/nSegments;
+
+    TopoDS_Shell loftShell;
+    BRep_Builder BB;
+    BB.MakeShell(loftShell);
+
+    // determine index of segment to retrieve the correct subshapes of the wing
+    // Here we explicitly require the subshapes to be ordered consistently
+    for (int j = 1; j <= segments->GetSegmentCount(); j++) {
+        const CCPACSWingSegment& ws = segments->GetSegment(j);
+        if (GetUID() == ws.GetUID()) {
+            for(int i=0; i<nFacesPerSegment; ++i) {
+                BB.Add(loftShell, TopoDS::Face(faceMap((j-1)*nFacesPerSegment + i + 1))); // guides
+            }
+            break;
+        }
+    }
+
+    //close the shell with sidecaps and make them a solid
+    TopoDS_Wire innerWire = GetInnerWire();
+    TopoDS_Wire outerWire = GetOuterWire();
+
+    CTiglPatchShell patcher(loftShell);
+    patcher.AddSideCap(innerWire);
+    patcher.AddSideCap(outerWire);
+    return patcher.PatchedShape();
+}
+
 // Gets the upper point in relative wing coordinates for a given eta and xsi
 gp_Pnt CCPACSWingSegment::GetUpperPoint(double eta, double xsi) const
 {
@@ -801,6 +827,44 @@ gp_Pnt CCPACSWingSegment::GetPoint(double eta, double xsi, bool fromUpper, TiglC
     return profilePoint;
 }
 
+// Returns upper or lower points on the segment surface for a list of
+// eta/xsi coordinates. The profiles and section transformations are resolved
+// only once for the whole list. The points are evaluated using up to nThreads
+// threads (nThreads <= 0: number of hardware threads).
+std::vector<gp_Pnt> CCPACSWingSegment::GetPoints(const std::vector<double>& etas, const std::vector<double>& xsis, bool fromUpper, int nThreads) const
+{
+    if (etas.size() != xsis.size()) {
+        throw CTiglError("Number of eta and xsi values differ in CCPACSWingSegment::GetPoints", TIGL_ERROR);
+    }
+
+    const CCPACSWingProfile& innerProfile = innerConnection.GetProfile();
+    const CCPACSWingProfile& outerProfile = outerConnection.GetProfile();
+
+    const CTiglTransformation parentTransformation = GetParentTransformation();
+    const CTiglTransformation innerTransformation  = getProfileTransformation(parentTransformation, innerConnection);
+    const CTiglTransformation outerTransformation  = getProfileTransformation(parentTransformation, outerConnection);
+
+    std::vector<gp_Pnt> points(etas.size());
+    ParallelFor(etas.size(), [&](size_t i) {
+        const double eta = etas[i];
+        const double xsi = xsis[i];
+        if (eta < 0.0 || eta > 1.0) {
+            throw CTiglError("Parameter eta not in the range 0.0 <= eta <= 1.0 in CCPACSWingSegment::GetPoints", TIGL_ERROR);
+        }
+
+        gp_Pnt innerProfilePoint = fromUpper ? innerProfile.GetUpperPoint(xsi) : innerProfile.GetLowerPoint(xsi);
+        gp_Pnt outerProfilePoint = fromUpper ? outerProfile.GetUpperPoint(xsi) : outerProfile.GetLowerPoint(xsi);
+
+        innerProfilePoint = innerTransformation.Transform(innerProfilePoint);
+        outerProfilePoint = outerTransformation.Transform(outerProfilePoint);
+
+        // linear interpolation in eta direction, same as in GetPoint
+        points[i] = gp_Pnt(innerProfilePoint.XYZ() * (1. - eta) + outerProfilePoint.XYZ() * eta);
+    }, nThreads);
+
+    return points;
+}
+
 gp_Pnt CCPACSWingSegment::GetPointDirection(double eta, double xsi, double dirx, double diry, double dirz, bool fromUpper, double& deviation) const
 {
     if (!GetParent()->IsParent<CCPACSWing>()) {
@@ -24,6 +24,7 @@
 #define CCPACSWINGSEGMENT_H
 
 #include <string>
+#include <vector>
 
 #include "generated/CPACSWingSegment.h"
 #include "tigl_config.h"
@@ -63,6 +64,9 @@ public:
     // Invalidates internal state
     TIGL_EXPORT void Invalidate();
 
+    // Returns true, if the loft is built from the segment profiles only and not cut from the wing loft
+    TIGL_EXPORT bool IsLoftedLinearly() const;
+
     // Read CPACS segment elements
     TIGL_EXPORT void ReadCPACS(const TixiDocumentHandle& tixiHandle, const std::string& segmentXPath) OVERRIDE;
 
@@ -199,6 +203,13 @@ public:
     // on the upper surface is returned, otherwise from the lower.
     TIGL_EXPORT gp_Pnt GetPoint(double eta, double xsi, bool fromUpper, TiglCoordinateSystem referenceCS = GLOBAL_COORDINATE_SYSTEM) const;
 
+    // Returns upper or lower points on the segment surface for a list of
+    // eta/xsi coordinates in the global coordinate system. This is
+    // equivalent to calling GetPoint for each pair, but resolves the
+    // profiles and transformations only once. The points are computed
+    // using up to nThreads threads (nThreads <= 0: all hardware threads).
+    TIGL_EXPORT std::vector<gp_Pnt> GetPoints(const std::vector<double>& etas, const std::vector<double>& xsis, bool fromUpper, int nThreads = 1) const;
+
     // Returns an upper or lower point on the segment surface in
     // dependence of parameters eta and xsi, which range from 0.0 to 1.0.
     // For eta = 0.0, xsi = 0.0 point is equal to leading edge on the
@@ -241,6 +252,10 @@ private:
     // get short name for loft
     std::string GetShortShapeName () const;
 
+    // Extracts the faces of this segment from the wing loft and closes them.
+    // Returns a null shape, if the faces of the wing loft cannot be assigned to the segments.
+    TopoDS_Shape BuildLoftFromWing() const;
+
     // Builds upper and lower surfaces
     void ComputeArea(double& cache) const;
 
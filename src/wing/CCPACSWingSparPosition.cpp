@@ -46,6 +46,7 @@ const std::string& CCPACSWingSparPosition::GetElementUID() const
 
 void CCPACSWingSparPosition::SetElementUID(const std::string& uid)
 {
+    m_dirty = true;
     m_elementUID_choice2 = uid;
     m_eta_choice1 = boost::none;
 
@@ -63,6 +64,7 @@ double CCPACSWingSparPosition::GetEta() const
 
 void CCPACSWingSparPosition::SetEta(double value)
 {
+    m_dirty = true;
     m_eta_choice1 = value;
     m_elementUID_choice2 = boost::none;
 
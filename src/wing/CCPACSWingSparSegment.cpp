@@ -37,6 +37,7 @@
 #include <TopoDS.hxx>
 #include <BRepAdaptor_Surface.hxx>
 #include <ShapeAnalysis_Surface.hxx>
+#include <Standard_Version.hxx>
 #include <GeomLProp_SLProps.hxx>
 #include <BRep_Tool.hxx>
 #include <BRepTools.hxx>
@@ -375,14 +376,14 @@ void CCPACSWingSparSegment::BuildGeometry(GeometryCache& cache) const
     BRepBndLib::Add(loft, bbox);
     double bboxSize = sqrt(bbox.SquareExtent());
 
-    // iterate over all spar cut faces
+    // intersect all spar cut faces with the loft in a single boolean operation
     TopoDS_Shape sparCutGeometry = GetSparCutGeometry(WING_COORDINATE_SYSTEM);
-    TopExp_Explorer exp;
-    for (exp.Init(sparCutGeometry, TopAbs_FACE); exp.More(); exp.Next()) {
-        TopoDS_Face sparCutFace = TopoDS::Face(exp.Current());
+    const std::vector<TopoDS_Shape> sparCutFaces = GetSubShapes(sparCutGeometry, TopAbs_FACE);
+    const std::vector<TopoDS_Shape> sparCutEdgesPerFace = CutShapesPerFace(loft, sparCutFaces);
 
-        // intersect spar cut face with loft
-        TopoDS_Shape sparCutEdges = CutShapes(loft, sparCutFace);
+    // iterate over all spar cut faces
+    for (size_t iFace = 0; iFace < sparCutFaces.size(); ++iFace) {
+        const TopoDS_Shape& sparCutEdges = sparCutEdgesPerFace[iFace];
 
         // build wires out of connected edges
         TopTools_ListOfShape wireList;
@@ -418,23 +419,43 @@ void CCPACSWingSparSegment::BuildSplittedSparGeometry(SplittedGeomCache& cache)
     // next iterate over all ribs from the component segment
     const CCPACSWingCSStructure& structure = *sparsNode.GetParent();
     int numRibs = structure.GetRibsDefinitionCount();
-    // NOTE: changed implementation to separate splitting because
-    //       of problems with OCC7.1 when using compound
-    //BRep_Builder builder;
-    //TopoDS_Compound compound;
-    //builder.MakeCompound(compound);
+    std::vector<TopoDS_Shape> ribCutShapes;
     for (int i = 1; i <= numRibs; i++) {
         // get the split geometry from the ribs
         const tigl::CCPACSWingRibsDefinition& ribsDefinition = structure.GetRibsDefinition(i);
         for (int k = 0; k < ribsDefinition.GetNumberOfRibs(); k++) {
-            const tigl::CCPACSWingRibsDefinition::CutGeometry& cutGeom = ribsDefinition.GetRibCutGeometry(k + 1);
-            //builder.Add(compound, cutGeom.shape);
+            ribCutShapes.push_back(ribsDefinition.GetRibCutGeometry(k + 1).shape);
+        }
+    }
+
+    // split the spar geometry with all rib split geometries at once
+    // NOTE: splitting with a compound failed with OCC 7.1. Hence, the
+    //       ribs are applied separately for older versions or if the
+    //       single split fails.
+    bool splitDone = false;
+#if OCC_VERSION_HEX >= VERSION_HEX_CODE(7,2,0)
+    if (ribCutShapes.size() > 1) {
+        BRep_Builder builder;
+        TopoDS_Compound compound;
+        builder.MakeCompound(compound);
+        for (size_t i = 0; i < ribCutShapes.size(); ++i) {
+            builder.Add(compound, ribCutShapes[i]);
+        }
+        try {
+            splittedSparGeometry = SplitShape(splittedSparGeometry, compound);
+            splitDone = true;
+        }
+        catch (const CTiglError&) {
+            LOG(WARNING) << "Splitting spar \"" << m_uID.value_or("") << "\" with all ribs at once failed. Splitting with each rib separately.";
+        }
+    }
+#endif
+    if (!splitDone) {
+        for (size_t i = 0; i < ribCutShapes.size(); ++i) {
             // split the spar geometry with the rib split geometry
-            splittedSparGeometry = SplitShape(splittedSparGeometry, cutGeom.shape);
+            splittedSparGeometry = SplitShape(splittedSparGeometry, ribCutShapes[i]);
         }
     }
-    //// split the spar geometry with the rib split geometry
-    //splittedSparGeometry = SplitShape(splittedSparGeometry, compound);
 
     // split spar geometry with all other Spars
     Bnd_Box bBoxBorder1, bBoxBorder2;
@@ -0,0 +1,374 @@
+/*
+* Copyright (C) 2019 German Aerospace Center (DLR/SC)
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*/
+
+#include "benchmark.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstring>
+#include <ctime>
+#include <exception>
+#include <iostream>
+#include <numeric>
+#include <sstream>
+
+#ifdef _WIN32
+#include <windows.h>
+#include <psapi.h>
+#else
+#include <sys/resource.h>
+#include <sys/time.h>
+#include <unistd.h>
+#endif
+
+#ifdef __APPLE__
+#include <mach/mach.h>
+#endif
+
+namespace
+{
+
+std::string jsonString(const std::string& value)
+{
+    std::string result = "\"";
+    for (std::string::const_iterator it = value.begin(); it != value.end(); ++it) {
+        const unsigned char c = static_cast<unsigned char>(*it);
+        switch (c) {
+        case '"':
+            result += "\\\"";
+            break;
+        case '\\':
+            result += "\\\\";
+            break;
+        case '\n':
+            result += "\\n";
+            break;
+        case '\r':
+            result += "\\r";
+            break;
+        case '\t':
+            result += "\\t";
+            break;
+        default:
+            if (c < 0x20) {
+                char buffer[8];
+                std::snprintf(buffer, sizeof(buffer), "\\u%04x", c);
+                result += buffer;
+            }
+            else {
+                result += static_cast<char>(c);
+            }
+        }
+    }
+    return result + "\"";
+}
+
+std::string jsonNumber(double value)
+{
+    char buffer[32];
+    std::snprintf(buffer, sizeof(buffer), "%.9g", value);
+    return buffer;
+}
+
+std::string jsonStatistics(const std::vector<double>& values)
+{
+    if (values.empty()) {
+        return "null";
+    }
+    const double sum = std::accumulate(values.begin(), values.end(), 0.);
+    std::ostringstream out;
+    out << "{\"min\": " << jsonNumber(*std::min_element(values.begin(), values.end()))
+        << ", \"mean\": " << jsonNumber(sum / static_cast<double>(values.size()))
+        << ", \"max\": " << jsonNumber(*std::max_element(values.begin(), values.end())) << "}";
+    return out.str();
+}
+
+std::string fileName(const std::string& path)
+{
+    const size_t pos = path.find_last_of("/\\");
+    return pos == std::string::npos ? path : path.substr(pos + 1);
+}
+
+#ifdef __linux__
+// Reads a value in kB from /proc/self/status, e.g. VmHWM. Returns 0 if not available.
+unsigned long long procStatusBytes(const char* key)
+{
+    FILE* file = std::fopen("/proc/self/status", "r");
+    if (!file) {
+        return 0;
+    }
+    const size_t keyLength = std::strlen(key);
+    unsigned long long result = 0;
+    char line[256];
+    while (std::fgets(line, sizeof(line), file)) {
+        unsigned long long kb = 0;
+        if (std::strncmp(line, key, keyLength) == 0 && line[keyLength] == ':' &&
+            std::sscanf(line + keyLength + 1, "%llu", &kb) == 1) {
+            result = kb * 1024ULL;
+            break;
+        }
+    }
+    std::fclose(file);
+    return result;
+}
+#endif
+
+double difference(unsigned long long a, unsigned long long b)
+{
+    return static_cast<double>(a) - static_cast<double>(b);
+}
+
+std::string currentDate()
+{
+    char buffer[32];
+    std::time_t now = std::time(NULL);
+    std::strftime(buffer, sizeof(buffer), "%Y-%m-%dT%H:%M:%SZ", std::gmtime(&now));
+    return buffer;
+}
+
+} // namespace
+
+namespace tigl
+{
+namespace benchmark
+{
+
+ResourceUsage CurrentResourceUsage()
+{
+    ResourceUsage usage;
+    usage.wallTime = std::chrono::duration<double>(std::chrono::steady_clock::now().time_since_epoch()).count();
+
+#ifdef _WIN32
+    FILETIME creationTime, exitTime, kernelTime, userTime;
+    usage.cpuTime = 0.;
+    if (GetProcessTimes(GetCurrentProcess(), &creationTime, &exitTime, &kernelTime, &userTime)) {
+        ULARGE_INTEGER kernel, user;
+        kernel.LowPart  = kernelTime.dwLowDateTime;
+        kernel.HighPart = kernelTime.dwHighDateTime;
+        user.LowPart    = userTime.dwLowDateTime;
+        user.HighPart   = userTime.dwHighDateTime;
+        // 100 ns units
+        usage.cpuTime = static_cast<double>(kernel.QuadPart + user.QuadPart) * 1e-7;
+    }
+#else
+    struct rusage ru;
+    getrusage(RUSAGE_SELF, &ru);
+    usage.cpuTime = static_cast<double>(ru.ru_utime.tv_sec + ru.ru_stime.tv_sec)
+                  + static_cast<double>(ru.ru_utime.tv_usec + ru.ru_stime.tv_usec) * 1e-6;
+#endif
+
+    usage.residentSetSize = 0;
+#if defined(_WIN32)
+    PROCESS_MEMORY_COUNTERS counters;
+    if (GetProcessMemoryInfo(GetCurrentProcess(), &counters, sizeof(counters))) {
+        usage.residentSetSize = static_cast<unsigned long long>(counters.WorkingSetSize);
+    }
+#elif defined(__APPLE__)
+    mach_task_basic_info_data_t info;
+    mach_msg_type_number_t count = MACH_TASK_BASIC_INFO_COUNT;
+    if (task_info(mach_task_self(), MACH_TASK_BASIC_INFO, reinterpret_cast<task_info_t>(&info), &count) == KERN_SUCCESS) {
+        usage.residentSetSize = static_cast<unsigned long long>(info.resident_size);
+    }
+#elif defined(__linux__)
+    usage.residentSetSize = procStatusBytes("VmRSS");
+#endif
+    return usage;
+}
+
+unsigned long long PeakResidentSetSize()
+{
+#ifdef _WIN32
+    PROCESS_MEMORY_COUNTERS counters;
+    if (GetProcessMemoryInfo(GetCurrentProcess(), &counters, sizeof(counters))) {
+        return static_cast<unsigned long long>(counters.PeakWorkingSetSize);
+    }
+    return 0;
+#elif defined(__linux__)
+    // in contrast to ru_maxrss, VmHWM can be reset
+    return procStatusBytes("VmHWM");
+#else
+    struct rusage ru;
+    getrusage(RUSAGE_SELF, &ru);
+    // bytes on macOS
+    return static_cast<unsigned long long>(ru.ru_maxrss);
+#endif
+}
+
+bool ResetPeakResidentSetSize()
+{
+#ifdef __linux__
+    // see clear_refs in proc(5)
+    FILE* file = std::fopen("/proc/self/clear_refs", "w");
+    if (!file) {
+        return false;
+    }
+    const bool written = std::fputs("5", file) >= 0;
+    return std::fclose(file) == 0 && written;
+#else
+    return false;
+#endif
+}
+
+BenchmarkState::BenchmarkState(const std::string& model, const std::string& outputDirectory, int nThreads)
+    : m_model(model)
+    , m_outputDirectory(outputDirectory)
+    , m_nThreads(nThreads)
+{
+}
+
+void BenchmarkState::Measure(const std::string& caseName, const std::function<void()>& func, double items)
+{
+    const bool peakReset = ResetPeakResidentSetSize();
+    const unsigned long long peakBefore = PeakResidentSetSize();
+    const ResourceUsage start = CurrentResourceUsage();
+    func();
+    const ResourceUsage stop = CurrentResourceUsage();
+    const unsigned long long peakAfter = PeakResidentSetSize();
+
+    std::map<std::string, CaseResult>::iterator it = m_results.find(caseName);
+    if (it == m_results.end()) {
+        it = m_results.insert(std::make_pair(caseName, CaseResult())).first;
+        m_caseOrder.push_back(caseName);
+    }
+    it->second.wallTimes.push_back(stop.wallTime - start.wallTime);
+    it->second.cpuTimes.push_back(stop.cpuTime - start.cpuTime);
+    it->second.rssDeltas.push_back(difference(stop.residentSetSize, start.residentSetSize));
+
+    // Without a reset, the peak of the process only changes, if func exceeds it.
+    // Otherwise, the memory kept by func is the best known lower bound.
+    if (peakReset || peakAfter > peakBefore) {
+        it->second.peakRssDeltas.push_back(std::max(0., difference(peakAfter, start.residentSetSize)));
+    }
+    else {
+        it->second.peakRssDeltas.push_back(std::max(0., it->second.rssDeltas.back()));
+    }
+    it->second.items = items;
+}
+
+void BenchmarkState::SetItems(const std::string& caseName, double items)
+{
+    std::map<std::string, CaseResult>::iterator it = m_results.find(caseName);
+    if (it != m_results.end()) {
+        it->second.items = items;
+    }
+}
+
+BenchmarkRegistry& BenchmarkRegistry::Instance()
+{
+    static BenchmarkRegistry registry;
+    return registry;
+}
+
+void BenchmarkRegistry::Register(const std::string& name, const BenchmarkFunction& func)
+{
+    m_benchmarks.push_back(std::make_pair(name, func));
+}
+
+std::vector<std::string> BenchmarkRegistry::Names() const
+{
+    std::vector<std::string> names;
+    for (size_t i = 0; i < m_benchmarks.size(); ++i) {
+        names.push_back(m_benchmarks[i].first);
+    }
+    return names;
+}
+
+int BenchmarkRegistry::Run(const RunOptions& options, std::ostream& json) const
+{
+    int nFailed = 0;
+    bool first = true;
+
+    json << "{\n"
+         << "  \"context\": {\n"
+         << "    \"date\": " << jsonString(currentDate()) << ",\n"
+         << "    \"tigl_version\": " << jsonString(options.tiglVersion) << ",\n"
+#ifdef NDEBUG
+         << "    \"build_type\": \"release\",\n"
+#else
+         << "    \"build_type\": \"debug\",\n"
+#endif
+         << "    \"threads\": " << options.nThreads << ",\n"
+         << "    \"repetitions\": " << options.repetitions << ",\n"
+         << "    \"exact_peak_rss\": " << (ResetPeakResidentSetSize() ? "true" : "false") << "\n"
+         << "  },\n"
+         << "  \"benchmarks\": [";
+
+    for (size_t iModel = 0; iModel < options.models.size(); ++iModel) {
+        const std::string& model = options.models[iModel];
+        for (size_t iBench = 0; iBench < m_benchmarks.size(); ++iBench) {
+            const std::string& name = m_benchmarks[iBench].first;
+            if (!options.filter.empty() && name.find(options.filter) == std::string::npos) {
+                continue;
+            }
+
+            std::cerr << "Running " << name << " on " << fileName(model) << std::endl;
+
+            BenchmarkState state(model, options.outputDirectory, options.nThreads);
+            std::string error;
+            try {
+                for (int rep = 0; rep < options.repetitions; ++rep) {
+                    m_benchmarks[iBench].second(state);
+                }
+            }
+            catch (const std::exception& ex) {
+                error = ex.what();
+            }
+            catch (...) {
+                error = "unknown error";
+            }
+
+            if (!error.empty()) {
+                std::cerr << "  failed: " << error << std::endl;
+                json << (first ? "\n" : ",\n")
+                     << "    {\"name\": " << jsonString(name)
+                     << ", \"model\": " << jsonString(fileName(model))
+                     << ", \"error\": " << jsonString(error) << "}";
+                first = false;
+                ++nFailed;
+                continue;
+            }
+
+            const std::vector<std::string>& cases = state.CaseOrder();
+            for (size_t iCase = 0; iCase < cases.size(); ++iCase) {
+                const CaseResult& result = state.Results().find(cases[iCase])->second;
+                const double meanWall = std::accumulate(result.wallTimes.begin(), result.wallTimes.end(), 0.)
+                                      / static_cast<double>(result.wallTimes.size());
+
+                json << (first ? "\n" : ",\n")
+                     << "    {\n"
+                     << "      \"name\": " << jsonString(name) << ",\n"
+                     << "      \"case\": " << jsonString(cases[iCase]) << ",\n"
+                     << "      \"model\": " << jsonString(fileName(model)) << ",\n"
+                     << "      \"repetitions\": " << result.wallTimes.size() << ",\n"
+                     << "      \"wall_time_s\": " << jsonStatistics(result.wallTimes) << ",\n"
+                     << "      \"cpu_time_s\": " << jsonStatistics(result.cpuTimes) << ",\n"
+                     << "      \"rss_delta_bytes\": " << jsonStatistics(result.rssDeltas) << ",\n"
+                     << "      \"peak_rss_delta_bytes\": " << jsonStatistics(result.peakRssDeltas) << ",\n"
+                     << "      \"items\": " << jsonNumber(result.items) << ",\n"
+                     << "      \"items_per_second\": " << jsonNumber(meanWall > 0. ? result.items / meanWall : 0.) << "\n"
+                     << "    }";
+                first = false;
+            }
+        }
+    }
+
+    json << "\n  ]\n}\n";
+    return nFailed;
+}
+
+} // namespace benchmark
+} // namespace tigl
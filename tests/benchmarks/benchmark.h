@@ -0,0 +1,161 @@
+/*
+* Copyright (C) 2019 German Aerospace Center (DLR/SC)
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*/
+/**
+* @file
+* @brief Minimal benchmark runner with JSON output, used by tigl_benchmarks
+*/
+
+#ifndef TIGL_BENCHMARK_H
+#define TIGL_BENCHMARK_H
+
+#include <functional>
+#include <map>
+#include <ostream>
+#include <string>
+#include <vector>
+
+namespace tigl
+{
+namespace benchmark
+{
+
+/// Resource usage of the process at some point in time
+struct ResourceUsage
+{
+    double wallTime;                     // seconds since an arbitrary point in time
+    double cpuTime;                      // user + system time of all threads in seconds
+    unsigned long long residentSetSize;  // current resident set size in bytes, 0 if unknown
+};
+
+ResourceUsage CurrentResourceUsage();
+
+/// Peak resident set size of the process in bytes, 0 if unknown
+unsigned long long PeakResidentSetSize();
+
+/// Resets the peak resident set size to the current resident set size.
+/// Returns false, if this is not supported by the operating system (only Linux supports it).
+bool ResetPeakResidentSetSize();
+
+/// Timings of one measured case over all repetitions
+struct CaseResult
+{
+    CaseResult()
+        : items(0.)
+    {
+    }
+
+    std::vector<double> wallTimes;
+    std::vector<double> cpuTimes;
+    std::vector<double> rssDeltas;     // resident set size after minus before the case, i.e. memory kept
+    std::vector<double> peakRssDeltas; // peak resident set size during the case minus the one before
+    double items; // items processed per repetition, e.g. evaluated points
+};
+
+/**
+ * @brief Passed to the benchmark functions
+ *
+ * A benchmark does its setup without being measured and wraps the code to
+ * be measured into Measure. A benchmark may measure multiple cases, e.g.
+ * one per component of the model.
+ */
+class BenchmarkState
+{
+public:
+    BenchmarkState(const std::string& model, const std::string& outputDirectory, int nThreads);
+
+    /// Path of the CPACS file to run the benchmark on
+    const std::string& Model() const { return m_model; }
+
+    /// Directory for files written by the benchmark
+    const std::string& OutputDirectory() const { return m_outputDirectory; }
+
+    /// Number of threads for the parallel variants
+    int Threads() const { return m_nThreads; }
+
+    /// Measures the wall and cpu time and the memory usage of func. Items is the number
+    /// of processed items (e.g. points) used to compute the throughput.
+    void Measure(const std::string& caseName, const std::function<void()>& func, double items = 1.);
+
+    /// Sets the number of processed items of a case, if it is only known after the measurement
+    void SetItems(const std::string& caseName, double items);
+
+    const std::map<std::string, CaseResult>& Results() const { return m_results; }
+    const std::vector<std::string>& CaseOrder() const { return m_caseOrder; }
+
+private:
+    std::string m_model;
+    std::string m_outputDirectory;
+    int m_nThreads;
+    std::map<std::string, CaseResult> m_results;
+    std::vector<std::string> m_caseOrder;
+};
+
+typedef std::function<void(BenchmarkState&)> BenchmarkFunction;
+
+struct RunOptions
+{
+    RunOptions()
+        : repetitions(3)
+        , nThreads(0)
+    {
+    }
+
+    std::string tiglVersion;
+    std::vector<std::string> models;
+    std::string filter;          // only run benchmarks containing this string
+    std::string outputDirectory; // directory for exported files
+    int repetitions;
+    int nThreads;                // threads of the parallel variants, 0 = all cores
+};
+
+/// Registry of all benchmarks
+class BenchmarkRegistry
+{
+public:
+    static BenchmarkRegistry& Instance();
+
+    void Register(const std::string& name, const BenchmarkFunction& func);
+
+    std::vector<std::string> Names() const;
+
+    /// Runs all benchmarks matching the filter on all models and writes the results as JSON
+    /// Returns the number of failed benchmarks
+    int Run(const RunOptions& options, std::ostream& json) const;
+
+private:
+    BenchmarkRegistry() {}
+
+    std::vector<std::pair<std::string, BenchmarkFunction> > m_benchmarks;
+};
+
+/// Registers a benchmark at program start
+struct BenchmarkRegistration
+{
+    BenchmarkRegistration(const std::string& name, const BenchmarkFunction& func)
+    {
+        BenchmarkRegistry::Instance().Register(name, func);
+    }
+};
+
+#define TIGL_BENCHMARK(name) \
+    static void benchmark_##name(tigl::benchmark::BenchmarkState& state); \
+    static tigl::benchmark::BenchmarkRegistration registration_##name(#name, benchmark_##name); \
+    static void benchmark_##name(tigl::benchmark::BenchmarkState& state)
+
+} // namespace benchmark
+} // namespace tigl
+
+#endif // TIGL_BENCHMARK_H
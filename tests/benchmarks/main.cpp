@@ -0,0 +1,138 @@
+/*
+* Copyright (C) 2019 German Aerospace Center (DLR/SC)
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*/
+
+#include "benchmark.h"
+
+#include "tigl.h"
+
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
+#include <string>
+#include <vector>
+
+namespace
+{
+
+void printUsage(const char* program)
+{
+    std::cout << "Usage: " << program << " [options] [cpacs files...]\n"
+              << "\n"
+              << "Runs the TiGL benchmarks on the given CPACS files and writes the results as JSON.\n"
+              << "Without cpacs files, the models of the unit test data are used.\n"
+              << "\n"
+              << "Options:\n"
+              << "  --filter <text>       Run only benchmarks whose name contains text\n"
+              << "  --repetitions <n>     Number of repetitions of each benchmark (default: 3)\n"
+              << "  --threads <n>         Threads of the parallel variants (default: 0 = all cores)\n"
+              << "  --output <file>       Write the JSON results to file instead of stdout\n"
+              << "  --output-dir <dir>    Directory for exported files (default: current directory)\n"
+              << "  --list                List all benchmarks\n"
+              << "  --help                Show this help\n";
+}
+
+bool nextArgument(int argc, char* argv[], int& i, std::string& value)
+{
+    if (i + 1 >= argc) {
+        std::cerr << "Missing value for " << argv[i] << std::endl;
+        return false;
+    }
+    value = argv[++i];
+    return true;
+}
+
+} // namespace
+
+int main(int argc, char* argv[])
+{
+    tigl::benchmark::RunOptions options;
+    options.tiglVersion = tiglGetVersion();
+    options.outputDirectory = ".";
+    std::string outputFile;
+
+    for (int i = 1; i < argc; ++i) {
+        const std::string arg = argv[i];
+        std::string value;
+        if (arg == "--help" || arg == "-h") {
+            printUsage(argv[0]);
+            return 0;
+        }
+        else if (arg == "--list") {
+            const std::vector<std::string> names = tigl::benchmark::BenchmarkRegistry::Instance().Names();
+            for (size_t iName = 0; iName < names.size(); ++iName) {
+                std::cout << names[iName] << "\n";
+            }
+            return 0;
+        }
+        else if (arg == "--filter" || arg == "--repetitions" || arg == "--threads" ||
+                 arg == "--output" || arg == "--output-dir") {
+            if (!nextArgument(argc, argv, i, value)) {
+                return 1;
+            }
+            if (arg == "--filter") {
+                options.filter = value;
+            }
+            else if (arg == "--repetitions") {
+                options.repetitions = std::atoi(value.c_str());
+            }
+            else if (arg == "--threads") {
+                options.nThreads = std::atoi(value.c_str());
+            }
+            else if (arg == "--output") {
+                outputFile = value;
+            }
+            else {
+                options.outputDirectory = value;
+            }
+        }
+        else if (arg.compare(0, 2, "--") == 0) {
+            std::cerr << "Unknown option " << arg << std::endl;
+            printUsage(argv[0]);
+            return 1;
+        }
+        else {
+            options.models.push_back(arg);
+        }
+    }
+
+    if (options.repetitions < 1) {
+        std::cerr << "The number of repetitions must be positive" << std::endl;
+        return 1;
+    }
+
+    if (options.models.empty()) {
+        const std::string dataDir = TIGL_BENCHMARK_DATA_DIR;
+        options.models.push_back(dataDir + "/simpletest.cpacs.xml");
+        options.models.push_back(dataDir + "/CPACS_30_D150.xml");
+    }
+
+    tiglLogSetVerbosity(TILOG_ERROR);
+
+    int nFailed = 0;
+    if (outputFile.empty()) {
+        nFailed = tigl::benchmark::BenchmarkRegistry::Instance().Run(options, std::cout);
+    }
+    else {
+        std::ofstream out(outputFile.c_str());
+        if (!out) {
+            std::cerr << "Cannot open " << outputFile << " for writing" << std::endl;
+            return 1;
+        }
+        nFailed = tigl::benchmark::BenchmarkRegistry::Instance().Run(options, out);
+    }
+
+    return nFailed == 0 ? 0 : 1;
+}
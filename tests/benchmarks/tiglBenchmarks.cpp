@@ -0,0 +1,405 @@
+/*
+* Copyright (C) 2019 German Aerospace Center (DLR/SC)
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*/
+/**
+* @file
+* @brief The benchmarks of tigl_benchmarks
+*
+* Each benchmark opens the model itself, such that caches of previous
+* benchmarks do not influence the measurement. Only the code inside
+* BenchmarkState::Measure is timed.
+*/
+
+#include "benchmark.h"
+
+#include "tigl.h"
+#include "tixi.h"
+#include "CCPACSConfigurationManager.h"
+#include "CCPACSConfiguration.h"
+#include "CCPACSWing.h"
+#include "CCPACSFuselage.h"
+#include "CTiglFusePlane.h"
+#include "CTiglTriangularizer.h"
+#include "CTiglExporterFactory.h"
+#include "CNamedShape.h"
+#include "to_string.h"
+#include "generated/TixiHelper.h"
+
+#include <BRepTools.hxx>
+
+#include <memory>
+#include <random>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+using tigl::benchmark::BenchmarkState;
+
+namespace
+{
+
+void check(TiglReturnCode ret, const std::string& what)
+{
+    if (ret != TIGL_SUCCESS) {
+        throw std::runtime_error(what + " failed with " + tiglGetErrorString(ret));
+    }
+}
+
+// Opens a CPACS file and closes it on destruction
+class Model
+{
+public:
+    explicit Model(const std::string& filename)
+        : m_tixiHandle(-1)
+        , m_tiglHandle(-1)
+    {
+        if (tixiOpenDocument(filename.c_str(), &m_tixiHandle) != SUCCESS) {
+            throw std::runtime_error("Cannot open " + filename);
+        }
+        if (tiglOpenCPACSConfiguration(m_tixiHandle, "", &m_tiglHandle) != TIGL_SUCCESS) {
+            tixiCloseDocument(m_tixiHandle);
+            throw std::runtime_error("Cannot open the CPACS configuration of " + filename);
+        }
+    }
+
+    ~Model()
+    {
+        tiglCloseCPACSConfiguration(m_tiglHandle);
+        tixiCloseDocument(m_tixiHandle);
+    }
+
+    TiglCPACSConfigurationHandle Handle() const
+    {
+        return m_tiglHandle;
+    }
+
+    tigl::CCPACSConfiguration& Configuration() const
+    {
+        return tigl::CCPACSConfigurationManager::GetInstance().GetConfiguration(m_tiglHandle);
+    }
+
+private:
+    Model(const Model&);
+    void operator=(const Model&);
+
+    TixiDocumentHandle m_tixiHandle;
+    TiglCPACSConfigurationHandle m_tiglHandle;
+};
+
+// Opens a TiXI document and closes it on destruction
+class Document
+{
+public:
+    explicit Document(const std::string& filename)
+        : m_handle(-1)
+    {
+        if (tixiOpenDocument(filename.c_str(), &m_handle) != SUCCESS) {
+            throw std::runtime_error("Cannot open " + filename);
+        }
+    }
+
+    ~Document()
+    {
+        tixiCloseDocument(m_handle);
+    }
+
+    TixiDocumentHandle Handle() const
+    {
+        return m_handle;
+    }
+
+private:
+    Document(const Document&);
+    void operator=(const Document&);
+
+    TixiDocumentHandle m_handle;
+};
+
+// Random, but reproducible parameters in [0, 1]
+std::vector<double> parameters(size_t n, unsigned int seed)
+{
+    std::mt19937 generator(seed);
+    std::uniform_real_distribution<double> distribution(0., 1.);
+    std::vector<double> values(n);
+    for (size_t i = 0; i < n; ++i) {
+        values[i] = distribution(generator);
+    }
+    return values;
+}
+
+std::string threadsCase(const std::string& prefix, int nThreads)
+{
+    return prefix + "_threads=" + (nThreads > 0 ? tigl::std_to_string(nThreads) : std::string("all"));
+}
+
+const size_t POINT_COUNTS[] = {1000, 100000};
+
+} // namespace
+
+TIGL_BENCHMARK(cpacs_open)
+{
+    std::unique_ptr<Model> model;
+    state.Measure("open", [&]() {
+        model.reset(new Model(state.Model()));
+    });
+    state.Measure("close", [&]() {
+        model.reset();
+    });
+}
+
+TIGL_BENCHMARK(cpacs_read_elements)
+{
+    Document document(state.Model());
+    const TixiDocumentHandle handle = document.Handle();
+
+    // All text elements of the document, each followed by a child that does not exist. Most
+    // elements read by the generated classes are optional, hence both cases are frequent.
+    const char* textElements = "//*[not(*) and text()]";
+    int nElements = 0;
+    if (tixiXPathEvaluateNodeNumber(handle, textElements, &nElements) != SUCCESS) {
+        return;
+    }
+    std::vector<std::string> xpaths;
+    for (int i = 1; i <= nElements; ++i) {
+        char* xpath = NULL;
+        if (tixiXPathExpressionGetXPath(handle, textElements, i, &xpath) != SUCCESS) {
+            throw std::runtime_error("Cannot evaluate " + std::string(textElements));
+        }
+        xpaths.push_back(xpath);
+        xpaths.push_back(std::string(xpath) + "/missing");
+    }
+
+    // the former code of the generated readers, which evaluates the xpath twice
+    std::string value;
+    state.Measure("check_and_get", [&]() {
+        for (size_t i = 0; i < xpaths.size(); ++i) {
+            if (tixi::TixiCheckElement(handle, xpaths[i])) {
+                value = tixi::TixiGetElement<std::string>(handle, xpaths[i]);
+            }
+        }
+    }, static_cast<double>(xpaths.size()));
+
+    state.Measure("try_get", [&]() {
+        for (size_t i = 0; i < xpaths.size(); ++i) {
+            tixi::TixiTryGetElement(handle, xpaths[i], value);
+        }
+    }, static_cast<double>(xpaths.size()));
+}
+
+TIGL_BENCHMARK(loft_build)
+{
+    Model model(state.Model());
+    tigl::CCPACSConfiguration& config = model.Configuration();
+
+    for (int i = 1; i <= config.GetWingCount(); ++i) {
+        tigl::CCPACSWing& wing = config.GetWing(i);
+        state.Measure(wing.GetUID(), [&]() {
+            wing.GetLoft();
+        });
+    }
+    for (int i = 1; i <= config.GetFuselageCount(); ++i) {
+        tigl::CCPACSFuselage& fuselage = config.GetFuselage(i);
+        state.Measure(fuselage.GetUID(), [&]() {
+            fuselage.GetLoft();
+        });
+    }
+}
+
+TIGL_BENCHMARK(build_all_lofts)
+{
+    const int threadCounts[] = {1, state.Threads()};
+    for (int i = 0; i < 2; ++i) {
+        Model model(state.Model());
+        state.Measure(threadsCase("lofts", threadCounts[i]), [&]() {
+            check(tiglConfigurationBuildAllLofts(model.Handle(), threadCounts[i]), "tiglConfigurationBuildAllLofts");
+        });
+    }
+}
+
+TIGL_BENCHMARK(fused_aircraft)
+{
+    const bool runParallel[] = {false, true};
+    for (int i = 0; i < 2; ++i) {
+        Model model(state.Model());
+        tigl::PTiglFusePlane fuser = model.Configuration().AircraftFusingAlgo();
+        fuser->SetResultMode(tigl::FULL_PLANE);
+        fuser->SetRunParallel(runParallel[i]);
+        state.Measure(runParallel[i] ? "parallel" : "serial", [&]() {
+            if (!fuser->FusedPlane()) {
+                throw std::runtime_error("Fusing the aircraft failed");
+            }
+        });
+    }
+}
+
+TIGL_BENCHMARK(wing_point_evaluation)
+{
+    Model model(state.Model());
+    if (model.Configuration().GetWingCount() < 1) {
+        return;
+    }
+
+    // build the loft outside of the measurement
+    double x, y, z;
+    check(tiglWingGetUpperPoint(model.Handle(), 1, 1, 0.5, 0.5, &x, &y, &z), "tiglWingGetUpperPoint");
+
+    for (size_t iCount = 0; iCount < sizeof(POINT_COUNTS)/sizeof(POINT_COUNTS[0]); ++iCount) {
+        const size_t n = POINT_COUNTS[iCount];
+        const std::vector<double> etas = parameters(n, 1);
+        const std::vector<double> xsis = parameters(n, 2);
+        std::vector<double> px(n), py(n), pz(n);
+
+        state.Measure("single_n=" + tigl::std_to_string(n), [&]() {
+            for (size_t i = 0; i < n; ++i) {
+                check(tiglWingGetUpperPoint(model.Handle(), 1, 1, etas[i], xsis[i], &px[i], &py[i], &pz[i]), "tiglWingGetUpperPoint");
+            }
+        }, static_cast<double>(n));
+
+        state.Measure("batch_n=" + tigl::std_to_string(n), [&]() {
+            check(tiglWingGetUpperPoints(model.Handle(), 1, 1, static_cast<int>(n), &etas[0], &xsis[0], &px[0], &py[0], &pz[0]),
+                  "tiglWingGetUpperPoints");
+        }, static_cast<double>(n));
+    }
+}
+
+TIGL_BENCHMARK(fuselage_point_evaluation)
+{
+    Model model(state.Model());
+    if (model.Configuration().GetFuselageCount() < 1) {
+        return;
+    }
+
+    // build the loft outside of the measurement
+    double x, y, z;
+    check(tiglFuselageGetPoint(model.Handle(), 1, 1, 0.5, 0.5, &x, &y, &z), "tiglFuselageGetPoint");
+
+    for (size_t iCount = 0; iCount < sizeof(POINT_COUNTS)/sizeof(POINT_COUNTS[0]); ++iCount) {
+        const size_t n = POINT_COUNTS[iCount];
+        const std::vector<double> etas = parameters(n, 3);
+        const std::vector<double> zetas = parameters(n, 4);
+        std::vector<double> px(n), py(n), pz(n);
+
+        state.Measure("single_n=" + tigl::std_to_string(n), [&]() {
+            for (size_t i = 0; i < n; ++i) {
+                check(tiglFuselageGetPoint(model.Handle(), 1, 1, etas[i], zetas[i], &px[i], &py[i], &pz[i]), "tiglFuselageGetPoint");
+            }
+        }, static_cast<double>(n));
+
+        state.Measure("batch_n=" + tigl::std_to_string(n), [&]() {
+            check(tiglFuselageGetPoints(model.Handle(), 1, 1, static_cast<int>(n), &etas[0], &zetas[0], &px[0], &py[0], &pz[0]),
+                  "tiglFuselageGetPoints");
+        }, static_cast<double>(n));
+    }
+}
+
+TIGL_BENCHMARK(eta_xsi_inversion)
+{
+    Model model(state.Model());
+    tigl::CCPACSConfiguration& config = model.Configuration();
+    if (config.GetWingCount() < 1) {
+        return;
+    }
+
+    // points on the upper surface of all segments of the first wing
+    const size_t n = 1000;
+    const int nSegments = config.GetWing(1).GetSegmentCount();
+    std::vector<double> px, py, pz;
+    for (int iSegment = 1; iSegment <= nSegments; ++iSegment) {
+        const size_t nSegmentPoints = n / static_cast<size_t>(nSegments) + 1;
+        const std::vector<double> etas = parameters(nSegmentPoints, 5 + iSegment);
+        const std::vector<double> xsis = parameters(nSegmentPoints, 105 + iSegment);
+        std::vector<double> x(nSegmentPoints), y(nSegmentPoints), z(nSegmentPoints);
+        check(tiglWingGetUpperPoints(model.Handle(), 1, iSegment, static_cast<int>(nSegmentPoints), &etas[0], &xsis[0], &x[0], &y[0], &z[0]),
+              "tiglWingGetUpperPoints");
+        px.insert(px.end(), x.begin(), x.end());
+        py.insert(py.end(), y.begin(), y.end());
+        pz.insert(pz.end(), z.begin(), z.end());
+    }
+
+    state.Measure("wing_segment", [&]() {
+        for (size_t i = 0; i < px.size(); ++i) {
+            int segmentIndex, isOnTop;
+            double eta, xsi;
+            check(tiglWingGetSegmentEtaXsi(model.Handle(), 1, px[i], py[i], pz[i], &segmentIndex, &eta, &xsi, &isOnTop),
+                  "tiglWingGetSegmentEtaXsi");
+        }
+    }, static_cast<double>(px.size()));
+
+    if (config.GetWing(1).GetComponentSegmentCount() < 1) {
+        return;
+    }
+
+    const std::string csUID = config.GetWing(1).GetComponentSegment(1).GetUID();
+    std::vector<int> segmentIndices(px.size());
+    std::vector<double> etas(px.size()), xsis(px.size());
+    state.Measure("component_segment_batch", [&]() {
+        check(tiglWingComponentSegmentPointsGetSegmentEtaXsi(model.Handle(), csUID.c_str(), static_cast<int>(px.size()),
+                                                             &px[0], &py[0], &pz[0], &segmentIndices[0], &etas[0], &xsis[0]),
+              "tiglWingComponentSegmentPointsGetSegmentEtaXsi");
+    }, static_cast<double>(px.size()));
+}
+
+TIGL_BENCHMARK(triangulation)
+{
+    Model model(state.Model());
+    tigl::CCPACSConfiguration& config = model.Configuration();
+    if (config.GetWingCount() < 1) {
+        return;
+    }
+
+    PNamedShape loft = config.GetWing(1).GetLoft();
+    const bool runParallel[] = {false, true};
+    for (int i = 0; i < 2; ++i) {
+        const std::string caseName = std::string("wing_segment_info_") + (runParallel[i] ? "parallel" : "serial");
+        unsigned long nTriangles = 0;
+        // the triangularizer removes any existing triangulation before meshing
+        state.Measure(caseName, [&]() {
+            tigl::CTiglTriangularizer triangularizer(&config.GetUIDManager(), loft, 0.01, tigl::SEGMENT_INFO, true, runParallel[i]);
+            nTriangles = triangularizer.getTriangulation().getTotalPolygonCount();
+        });
+        state.SetItems(caseName, static_cast<double>(nTriangles));
+    }
+}
+
+TIGL_BENCHMARK(export)
+{
+    Model model(state.Model());
+    tigl::CCPACSConfiguration& config = model.Configuration();
+    check(tiglConfigurationBuildAllLofts(model.Handle(), state.Threads()), "tiglConfigurationBuildAllLofts");
+
+    const char* fileTypes[] = {"step", "igs", "brep", "stl", "vtp", "dae"};
+    const bool meshed[] = {false, false, false, true, true, true};
+    for (size_t i = 0; i < sizeof(fileTypes)/sizeof(fileTypes[0]); ++i) {
+        tigl::PTiglCADExporter exporter = tigl::createExporter(fileTypes[i]);
+        if (meshed[i]) {
+            exporter->AddConfiguration(config, tigl::TriangulatedExportOptions(0.01));
+        }
+        else {
+            exporter->AddConfiguration(config);
+        }
+
+        // each meshed export starts without triangulation
+        for (size_t iShape = 0; iShape < exporter->NShapes(); ++iShape) {
+            BRepTools::Clean(exporter->GetShape(iShape)->Shape());
+        }
+
+        const std::string filename = state.OutputDirectory() + "/benchmark_export." + fileTypes[i];
+        state.Measure(fileTypes[i], [&]() {
+            if (!exporter->Write(filename)) {
+                throw std::runtime_error("Writing " + filename + " failed");
+            }
+        });
+    }
+}
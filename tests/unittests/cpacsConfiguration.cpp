@@ -23,6 +23,24 @@
 #include "test.h" // Brings in the GTest framework
 #include "tigl.h"
 #include "tigl_version.h"
+#include "CCPACSConfigurationManager.h"
+#include "CCPACSConfiguration.h"
+#include "CCPACSWing.h"
+#include "CCPACSWingSection.h"
+#include "CCPACSWingSegment.h"
+#include "CCPACSFuselage.h"
+#include "CNamedShape.h"
+
+#include <BRepTools.hxx>
+#include <TopExp.hxx>
+#include <TopTools_IndexedMapOfShape.hxx>
+
+#include <boost/filesystem.hpp>
+
+#include <algorithm>
+#include <sstream>
+#include <string>
+#include <vector>
 
 /******************************************************************************/
 
@@ -261,3 +279,263 @@ TEST_F(SimpleConfigurationTests, GetBoundingBox)
     EXPECT_NEAR(-0.75, minZ, 1e-1);
     EXPECT_NEAR( 0.5, maxZ, 1e-1);
 }
+
+/******************************************************************************/
+
+class tiglRebuiltComponents : public ::testing::Test
+{
+protected:
+    void SetUp() OVERRIDE
+    {
+        const char* filename = "TestData/CPACS_30_D150.xml";
+
+        tiglHandle = -1;
+        tixiHandle = -1;
+
+        ASSERT_TRUE(tixiOpenDocument(filename, &tixiHandle) == SUCCESS);
+        ASSERT_TRUE(tiglOpenCPACSConfiguration(tixiHandle, "D150_VAMP", &tiglHandle) == TIGL_SUCCESS);
+    }
+
+    void TearDown() OVERRIDE
+    {
+        ASSERT_TRUE(tiglCloseCPACSConfiguration(tiglHandle) == TIGL_SUCCESS);
+        ASSERT_TRUE(tixiCloseDocument(tixiHandle) == SUCCESS);
+        tiglHandle = -1;
+        tixiHandle = -1;
+    }
+
+    std::vector<std::string> GetRebuiltComponents()
+    {
+        std::vector<std::string> uids;
+        int count = 0;
+        EXPECT_EQ(TIGL_SUCCESS, tiglConfigurationGetRebuiltComponentCount(tiglHandle, &count));
+        for (int i = 1; i <= count; ++i) {
+            char* uid = NULL;
+            EXPECT_EQ(TIGL_SUCCESS, tiglConfigurationGetRebuiltComponentUID(tiglHandle, i, &uid));
+            uids.push_back(uid);
+        }
+        return uids;
+    }
+
+    TixiDocumentHandle           tixiHandle;
+    TiglCPACSConfigurationHandle tiglHandle;
+};
+
+TEST_F(tiglRebuiltComponents, invalidArguments)
+{
+    char* uid = NULL;
+    EXPECT_EQ(TIGL_NULL_POINTER, tiglConfigurationGetRebuiltComponentCount(tiglHandle, NULL));
+    EXPECT_EQ(TIGL_NULL_POINTER, tiglConfigurationGetRebuiltComponentUID(tiglHandle, 1, NULL));
+    EXPECT_EQ(TIGL_INDEX_ERROR, tiglConfigurationGetRebuiltComponentUID(tiglHandle, 0, &uid));
+
+    int count = 0;
+    ASSERT_EQ(TIGL_SUCCESS, tiglConfigurationGetRebuiltComponentCount(tiglHandle, &count));
+    EXPECT_EQ(TIGL_INDEX_ERROR, tiglConfigurationGetRebuiltComponentUID(tiglHandle, count + 1, &uid));
+    EXPECT_EQ(TIGL_NOT_FOUND, tiglConfigurationGetRebuiltComponentUID(tiglHandle + 1, 1, &uid));
+    EXPECT_EQ(TIGL_NOT_FOUND, tiglConfigurationClearRebuiltComponents(tiglHandle + 1));
+}
+
+/**
+* Changing the twist of a wing section must only rebuild the owning wing and its segments.
+* Segments not connected to the section are cut from the new wing loft and share its faces.
+*/
+TEST_F(tiglRebuiltComponents, sectionRotation)
+{
+    tigl::CCPACSConfiguration& config = tigl::CCPACSConfigurationManager::GetInstance().GetConfiguration(tiglHandle);
+    tigl::CCPACSWing& wing = config.GetWing("D150_VAMP_W1");
+
+    for (int i = 1; i <= wing.GetSegmentCount(); ++i) {
+        wing.GetSegment(i).GetLoft();
+    }
+    wing.GetLoft();
+    config.GetWing("D150_VAMP_HL1").GetLoft();
+    config.GetFuselage(1).GetLoft();
+
+    std::vector<std::string> rebuilt = GetRebuiltComponents();
+    EXPECT_TRUE(std::find(rebuilt.begin(), rebuilt.end(), "D150_VAMP_FL1") != rebuilt.end());
+
+    ASSERT_EQ(TIGL_SUCCESS, tiglConfigurationClearRebuiltComponents(tiglHandle));
+    EXPECT_EQ(0u, GetRebuiltComponents().size());
+
+    PNamedShape oldSegmentLoft = wing.GetSegment(1).GetLoft();
+    const int lastSegment = wing.GetSegmentCount();
+    PNamedShape oldUnaffectedLoft = wing.GetSegment(lastSegment).GetLoft();
+
+    tigl::CCPACSWingSection& section = wing.GetSection(1);
+    tigl::CTiglPoint rotation = section.GetRotation();
+    rotation.y += 2.;
+    section.SetRotation(rotation);
+
+    for (int i = 1; i <= wing.GetSegmentCount(); ++i) {
+        wing.GetSegment(i).GetLoft();
+    }
+    wing.GetLoft();
+    config.GetWing("D150_VAMP_HL1").GetLoft();
+    config.GetFuselage(1).GetLoft();
+
+    rebuilt = GetRebuiltComponents();
+    ASSERT_EQ(static_cast<size_t>(lastSegment + 1), rebuilt.size());
+    EXPECT_TRUE(std::find(rebuilt.begin(), rebuilt.end(), "D150_VAMP_W1") != rebuilt.end());
+    EXPECT_TRUE(std::find(rebuilt.begin(), rebuilt.end(), "D150_VAMP_W1_Seg1") != rebuilt.end());
+    EXPECT_TRUE(std::find(rebuilt.begin(), rebuilt.end(), "D150_VAMP_HL1") == rebuilt.end());
+    EXPECT_TRUE(std::find(rebuilt.begin(), rebuilt.end(), "D150_VAMP_FL1") == rebuilt.end());
+
+    EXPECT_FALSE(oldSegmentLoft->Shape().IsSame(wing.GetSegment(1).GetLoft()->Shape()));
+
+    // the unaffected segment must not keep the faces of the old wing loft
+    PNamedShape unaffectedLoft = wing.GetSegment(lastSegment).GetLoft();
+    EXPECT_FALSE(oldUnaffectedLoft->Shape().IsSame(unaffectedLoft->Shape()));
+
+    TopTools_IndexedMapOfShape wingFaces;
+    TopExp::MapShapes(wing.GetLoft()->Shape(), TopAbs_FACE, wingFaces);
+    TopTools_IndexedMapOfShape segmentFaces;
+    TopExp::MapShapes(unaffectedLoft->Shape(), TopAbs_FACE, segmentFaces);
+    ASSERT_GT(segmentFaces.Extent(), 0);
+    int sharedFaces = 0;
+    for (int i = 1; i <= segmentFaces.Extent(); ++i) {
+        if (wingFaces.Contains(segmentFaces(i))) {
+            sharedFaces++;
+        }
+    }
+    EXPECT_GT(sharedFaces, 0);
+}
+
+namespace
+{
+    std::string brepString(PNamedShape loft)
+    {
+        std::ostringstream stream;
+        BRepTools::Write(loft->Shape(), stream);
+        return stream.str();
+    }
+}
+
+/**
+* Building all lofts concurrently must yield the same shapes as building them on demand
+*/
+TEST_F(tiglRebuiltComponents, buildAllLofts)
+{
+    ASSERT_EQ(TIGL_SUCCESS, tiglConfigurationBuildAllLofts(tiglHandle, 4));
+    EXPECT_EQ(TIGL_NOT_FOUND, tiglConfigurationBuildAllLofts(tiglHandle + 1, 4));
+
+    std::vector<std::string> rebuilt = GetRebuiltComponents();
+    EXPECT_TRUE(std::find(rebuilt.begin(), rebuilt.end(), "D150_VAMP_W1") != rebuilt.end());
+    EXPECT_TRUE(std::find(rebuilt.begin(), rebuilt.end(), "D150_VAMP_W1_Seg1") != rebuilt.end());
+    EXPECT_TRUE(std::find(rebuilt.begin(), rebuilt.end(), "D150_VAMP_FL1") != rebuilt.end());
+
+    // nothing is built twice
+    ASSERT_EQ(TIGL_SUCCESS, tiglConfigurationClearRebuiltComponents(tiglHandle));
+    ASSERT_EQ(TIGL_SUCCESS, tiglConfigurationBuildAllLofts(tiglHandle, 0));
+    EXPECT_EQ(0u, GetRebuiltComponents().size());
+
+    // compare to a serially built configuration
+    TixiDocumentHandle serialTixiHandle = -1;
+    TiglCPACSConfigurationHandle serialTiglHandle = -1;
+    ASSERT_EQ(SUCCESS, tixiOpenDocument("TestData/CPACS_30_D150.xml", &serialTixiHandle));
+    ASSERT_EQ(TIGL_SUCCESS, tiglOpenCPACSConfiguration(serialTixiHandle, "D150_VAMP", &serialTiglHandle));
+
+    tigl::CCPACSConfiguration& config = tigl::CCPACSConfigurationManager::GetInstance().GetConfiguration(tiglHandle);
+    tigl::CCPACSConfiguration& serialConfig = tigl::CCPACSConfigurationManager::GetInstance().GetConfiguration(serialTiglHandle);
+
+    const char* uids[] = {"D150_VAMP_W1", "D150_VAMP_W1_Seg1", "D150_VAMP_HL1", "D150_VAMP_FL1"};
+    for (size_t i = 0; i < sizeof(uids)/sizeof(uids[0]); ++i) {
+        PNamedShape parallelLoft = config.GetUIDManager().GetGeometricComponent(uids[i]).GetLoft();
+        PNamedShape serialLoft = serialConfig.GetUIDManager().GetGeometricComponent(uids[i]).GetLoft();
+        ASSERT_TRUE(parallelLoft && serialLoft);
+        EXPECT_EQ(brepString(serialLoft), brepString(parallelLoft)) << uids[i];
+    }
+
+    ASSERT_EQ(TIGL_SUCCESS, tiglCloseCPACSConfiguration(serialTiglHandle));
+    ASSERT_EQ(SUCCESS, tixiCloseDocument(serialTixiHandle));
+}
+
+/******************************************************************************/
+
+/**
+* Opening the same file again must load the lofts from the disk cache,
+* modifying the geometry before or after building a loft must bypass the cache. Segment lofts
+* are cut from the loaded wing loft and share its faces.
+*/
+TEST(tiglLoftDiskCache, reopenConfiguration)
+{
+    // start with an empty cache
+    const boost::filesystem::path cacheDirectory = boost::filesystem::unique_path("TestData/export/loftcache-%%%%-%%%%");
+    EXPECT_EQ(TIGL_NULL_POINTER, tiglSetLoftCacheDirectory(NULL));
+    ASSERT_EQ(TIGL_SUCCESS, tiglSetLoftCacheDirectory(cacheDirectory.string().c_str()));
+
+    const char* filename = "TestData/CPACS_30_D150.xml";
+    TixiDocumentHandle tixiHandle = -1;
+    TiglCPACSConfigurationHandle tiglHandle = -1;
+
+    // first run, fills the cache
+    ASSERT_EQ(SUCCESS, tixiOpenDocument(filename, &tixiHandle));
+    ASSERT_EQ(TIGL_SUCCESS, tiglOpenCPACSConfiguration(tixiHandle, "D150_VAMP", &tiglHandle));
+    {
+        tigl::CCPACSConfiguration& config = tigl::CCPACSConfigurationManager::GetInstance().GetConfiguration(tiglHandle);
+        config.GetWing("D150_VAMP_W1").GetLoft();
+        config.GetWing("D150_VAMP_W1").GetSegment(1).GetLoft();
+    }
+    ASSERT_EQ(TIGL_SUCCESS, tiglCloseCPACSConfiguration(tiglHandle));
+    ASSERT_EQ(SUCCESS, tixiCloseDocument(tixiHandle));
+
+    // second run, loads the lofts
+    ASSERT_EQ(SUCCESS, tixiOpenDocument(filename, &tixiHandle));
+    ASSERT_EQ(TIGL_SUCCESS, tiglOpenCPACSConfiguration(tixiHandle, "D150_VAMP", &tiglHandle));
+    {
+        tigl::CCPACSConfiguration& config = tigl::CCPACSConfigurationManager::GetInstance().GetConfiguration(tiglHandle);
+        tigl::CCPACSWing& wing = config.GetWing("D150_VAMP_W1");
+
+        PNamedShape wingLoft = wing.GetLoft();
+        PNamedShape segmentLoft = wing.GetSegment(1).GetLoft();
+        EXPECT_EQ(0u, wing.GetLoftBuildCount());
+        EXPECT_EQ(1u, wing.GetSegment(1).GetLoftBuildCount());
+
+        ASSERT_TRUE(wingLoft && segmentLoft);
+        EXPECT_EQ("D150_VAMP_W1_Seg1", segmentLoft->Name());
+        ASSERT_GT(segmentLoft->GetFaceCount(), 0u);
+        EXPECT_EQ("D150_VAMP_W1_Seg1", segmentLoft->GetFaceTraits(0).ComponentUID());
+
+        TopTools_IndexedMapOfShape wingFaces, segmentFaces;
+        TopExp::MapShapes(wingLoft->Shape(), TopAbs_FACE, wingFaces);
+        TopExp::MapShapes(segmentLoft->Shape(), TopAbs_FACE, segmentFaces);
+        int sharedFaces = 0;
+        for (int i = 1; i <= segmentFaces.Extent(); ++i) {
+            if (wingFaces.Contains(segmentFaces(i))) {
+                sharedFaces++;
+            }
+        }
+        EXPECT_GT(sharedFaces, 0);
+
+        // the modified geometry must not be loaded from the cache
+        tigl::CCPACSWingSection& section = wing.GetSection(1);
+        tigl::CTiglPoint rotation = section.GetRotation();
+        rotation.y += 2.;
+        section.SetRotation(rotation);
+
+        EXPECT_FALSE(segmentLoft->Shape().IsSame(wing.GetSegment(1).GetLoft()->Shape()));
+        EXPECT_EQ(2u, wing.GetSegment(1).GetLoftBuildCount());
+        EXPECT_EQ(1u, wing.GetLoftBuildCount());
+    }
+    ASSERT_EQ(TIGL_SUCCESS, tiglCloseCPACSConfiguration(tiglHandle));
+    ASSERT_EQ(SUCCESS, tixiCloseDocument(tixiHandle));
+
+    // third run, a setter modifies the geometry before the first loft is built
+    ASSERT_EQ(SUCCESS, tixiOpenDocument(filename, &tixiHandle));
+    ASSERT_EQ(TIGL_SUCCESS, tiglOpenCPACSConfiguration(tixiHandle, "D150_VAMP", &tiglHandle));
+    {
+        tigl::CCPACSConfiguration& config = tigl::CCPACSConfigurationManager::GetInstance().GetConfiguration(tiglHandle);
+        tigl::CCPACSWing& wing = config.GetWing("D150_VAMP_W1");
+
+        boost::optional<tigl::CCPACSPoint>& rotation = wing.GetSection(1).GetTransformation().GetRotation();
+        ASSERT_TRUE(rotation);
+        rotation->SetY(rotation->GetY().get_value_or(0.) + 2.);
+
+        wing.GetLoft();
+        EXPECT_EQ(1u, wing.GetLoftBuildCount());
+    }
+    ASSERT_EQ(TIGL_SUCCESS, tiglCloseCPACSConfiguration(tiglHandle));
+    ASSERT_EQ(SUCCESS, tixiCloseDocument(tixiHandle));
+
+    EXPECT_EQ(TIGL_SUCCESS, tiglSetLoftCacheDirectory(""));
+    boost::filesystem::remove_all(cacheDirectory);
+}
@@ -231,6 +231,18 @@ class TestTiglApi(unittest.TestCase):
         
     def test_wingGetLowerPoint(self):
         (x, y, z) = self.tigl.wingGetLowerPoint(1,1,0.5,0.5);
+
+    def test_wingGetUpperPoints(self):
+        (xs, ys, zs) = self.tigl.wingGetUpperPoints(1, 1, 3, [0., 0.5, 1.], [0., 0.5, 1.])
+        self.assertEqual(len(xs), 3)
+        (x, y, z) = self.tigl.wingGetUpperPoint(1, 1, 0.5, 0.5)
+        self.assertAlmostEqual(x, xs[1])
+        self.assertAlmostEqual(y, ys[1])
+        self.assertAlmostEqual(z, zs[1])
+
+    def test_wingGetLowerPoints(self):
+        (xs, ys, zs) = self.tigl.wingGetLowerPoints(1, 1, 3, [0., 0.5, 1.], [0., 0.5, 1.])
+        self.assertEqual(len(xs), 3)
         
     def test_wingGetInnerConnectedSegmentCount(self):
         segmentCount = self.tigl.wingGetInnerConnectedSegmentCount(1,1)
@@ -520,7 +532,18 @@ class TestTiglApi(unittest.TestCase):
         componentUID = self.tigl.wingGetUID(1)
         ret = self.tigl.componentGetHashCode(componentUID)
         self.assertEqual(isinstance(ret,int),True)
+
+    def test_checkPointsInside(self):
+        componentUID = self.tigl.fuselageGetUID(1)
+        ret = self.tigl.checkPointsInside(componentUID, 2, [20., 20.], [0., 100.], [0., 0.])
+        self.assertEqual(len(ret), 2)
+        self.assertEqual(ret[0], self.tigl.checkPointInside(20., 0., 0., componentUID))
+        self.assertEqual(ret[1], 0)
                     
+    def test_configurationBuildAllLofts(self):
+        self.tigl.configurationBuildAllLofts(2)
+        self.assertTrue(self.tigl.configurationGetRebuiltComponentCount() > 0)
+
     def test_configurationGetLength(self):
         ret = self.tigl.configurationGetLength()
         self.assertEqual(isinstance(ret,float),True)
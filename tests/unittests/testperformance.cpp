@@ -23,7 +23,9 @@
 #include "CTiglPointTranslator.h"
 
 #include <string.h>
+#include <chrono>
 #include <ctime>
+#include <vector>
 
 
 /******************************************************************************/
@@ -92,6 +94,46 @@ TEST_F(TestPerformance, wingGetPoint)
     }
 }
 
+TEST_F(TestPerformance, wingGetPointThroughput)
+{
+    const int npoints = 5000;
+
+    std::vector<double> etas(npoints), xsis(npoints);
+    for (int i = 0; i < npoints; ++i) {
+        etas[i] = static_cast <double> (rand()) / static_cast <double> (RAND_MAX);
+        xsis[i] = static_cast <double> (rand()) / static_cast <double> (RAND_MAX);
+    }
+    std::vector<double> px(npoints), py(npoints), pz(npoints);
+
+    // single point evaluation
+    // wall clock time, as the batched evaluation may run in parallel
+    std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+    for (int i = 0; i < npoints; ++i) {
+        ASSERT_EQ(TIGL_SUCCESS, tiglWingGetUpperPoint(tiglHandle, 1, 1, etas[i], xsis[i], &px[i], &py[i], &pz[i]));
+    }
+    std::chrono::steady_clock::time_point stop = std::chrono::steady_clock::now();
+    double time_elapsed = std::chrono::duration<double>(stop - start).count();
+    if (time_elapsed > 0.) {
+        std::cout << "wingGetUpperPoint [points/s]: " << npoints / time_elapsed << std::endl;
+    }
+
+    // batched evaluation
+    std::vector<double> bx(npoints), by(npoints), bz(npoints);
+    start = std::chrono::steady_clock::now();
+    ASSERT_EQ(TIGL_SUCCESS, tiglWingGetUpperPoints(tiglHandle, 1, 1, npoints, &etas[0], &xsis[0], &bx[0], &by[0], &bz[0]));
+    stop = std::chrono::steady_clock::now();
+    time_elapsed = std::chrono::duration<double>(stop - start).count();
+    if (time_elapsed > 0.) {
+        std::cout << "wingGetUpperPoints (batched) [points/s]: " << npoints / time_elapsed << std::endl;
+    }
+
+    for (int i = 0; i < npoints; ++i) {
+        ASSERT_NEAR(px[i], bx[i], 1e-10);
+        ASSERT_NEAR(py[i], by[i], 1e-10);
+        ASSERT_NEAR(pz[i], bz[i], 1e-10);
+    }
+}
+
 TEST_F(TestPerformance, fuselageGetPoint)
 {
     int nruns = 100;
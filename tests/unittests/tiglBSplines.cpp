@@ -34,7 +34,10 @@
 #include <TopoDS_Compound.hxx>
 #include <CTiglBSplineAlgorithms.h>
 #include <cmath>
+#include <algorithm>
 #include <math_Matrix.hxx>
+#include <math_Gauss.hxx>
+#include "CTiglBandedMatrix.h"
 #include "CTiglBSplineFit.h"
 #include "CTiglPointsToBSplineInterpolation.h"
 
@@ -244,6 +247,100 @@ TEST(BSplines, bSplineMatDeriv1)
     EXPECT_NEAR(A.Value(4,3), 2., 1e-10);
 }
 
+TEST(BSplines, bSplineBandedMat)
+{
+    int degree = 3;
+    int nParams = 60;
+    std::vector<double> parms;
+    for (int i = 0; i < nParams; ++i) {
+        double t = static_cast<double>(i) / static_cast<double>(nParams - 1);
+        parms.push_back(t * t);
+    }
+    std::vector<double> knots = tigl::CTiglBSplineAlgorithms::knotsFromCurveParameters(parms, degree, false);
+
+    TColStd_Array1OfReal flatKnots(1, static_cast<int>(knots.size()));
+    for (size_t i = 0; i < knots.size(); ++i) {
+        flatKnots.SetValue(static_cast<int>(i) + 1, knots[i]);
+    }
+    TColStd_Array1OfReal params(1, nParams);
+    for (int i = 0; i < nParams; ++i) {
+        params.SetValue(i + 1, parms[static_cast<size_t>(i)]);
+    }
+
+    math_Matrix dense = tigl::CTiglBSplineAlgorithms::bsplineBasisMat(degree, flatKnots, params);
+    tigl::CTiglBandedMatrix banded = tigl::CTiglBSplineAlgorithms::bsplineBasisBandedMat(degree, flatKnots, params);
+
+    ASSERT_EQ(nParams, banded.Size());
+    EXPECT_LE(banded.LowerBandwidth() + banded.UpperBandwidth(), 2 * degree);
+    for (int i = 1; i <= nParams; ++i) {
+        for (int j = 1; j <= nParams; ++j) {
+            EXPECT_NEAR(dense(i, j), banded.Value(i, j), 1e-14);
+        }
+    }
+}
+
+TEST(BSplines, bandedSolvers)
+{
+    int n = 80;
+    int kl = 2;
+    int ku = 3;
+
+    // diagonally weak, non-symmetric banded matrix requiring pivoting
+    tigl::CTiglBandedMatrix A(n, kl, ku);
+    math_Matrix Adense(1, n, 1, n, 0.);
+    for (int i = 1; i <= n; ++i) {
+        for (int j = std::max(1, i - kl); j <= std::min(n, i + ku); ++j) {
+            double value = sin(0.7 * i + 1.3 * j) + (i == j ? 0.1 : 0.);
+            A(i, j) = value;
+            Adense(i, j) = value;
+        }
+    }
+
+    math_Vector b(1, n);
+    for (int i = 1; i <= n; ++i) {
+        b(i) = cos(0.1 * i);
+    }
+
+    math_Vector xDense(1, n);
+    math_Gauss gauss(Adense);
+    gauss.Solve(b, xDense);
+
+    tigl::CTiglBandedLU lu(A);
+    ASSERT_TRUE(lu.IsDone());
+    math_Vector x(1, n);
+    lu.Solve(b, x);
+    for (int i = 1; i <= n; ++i) {
+        EXPECT_NEAR(xDense(i), x(i), 1e-9);
+    }
+
+    // symmetric positive definite matrix
+    tigl::CTiglBandedMatrix S(n, kl, kl);
+    math_Matrix Sdense(1, n, 1, n, 0.);
+    for (int i = 1; i <= n; ++i) {
+        for (int j = std::max(1, i - kl); j <= std::min(n, i + kl); ++j) {
+            double value = i == j ? 4. : 1. / (1. + std::abs(i - j) + 0.01 * (i + j));
+            S(i, j) = value;
+            Sdense(i, j) = value;
+        }
+    }
+
+    math_Gauss gaussSpd(Sdense);
+    gaussSpd.Solve(b, xDense);
+
+    tigl::CTiglBandedCholesky cholesky(S);
+    ASSERT_TRUE(cholesky.IsDone());
+    cholesky.Solve(b, x);
+    for (int i = 1; i <= n; ++i) {
+        EXPECT_NEAR(xDense(i), x(i), 1e-12);
+    }
+
+    // not positive definite
+    S(1, 1) = -1.;
+    tigl::CTiglBandedCholesky cholesky2(S);
+    EXPECT_FALSE(cholesky2.IsDone());
+    EXPECT_THROW(cholesky2.Solve(b, x), tigl::CTiglError);
+}
+
 class BSplineInterpolation : public ::testing::Test
 {
 protected:
@@ -697,6 +794,54 @@ TEST_F(BSplineInterpolation, interpolationLinear)
 
 }
 
+TEST_F(BSplineInterpolation, interpolationManyPoints)
+{
+    // large enough to use the banded solver
+    int nPoints = 200;
+    Handle(TColgp_HArray1OfPnt) pnt2 = new TColgp_HArray1OfPnt(1, nPoints);
+    for (int i = 0; i < nPoints; ++i) {
+        double t = 6. * M_PI * static_cast<double>(i) / static_cast<double>(nPoints - 1);
+        pnt2->SetValue(i + 1, gp_Pnt(cos(t), sin(t), 0.1 * t));
+    }
+
+    tigl::CTiglPointsToBSplineInterpolation app(pnt2, 3, false);
+    Handle(Geom_BSplineCurve) result = app.Curve();
+    EXPECT_EQ(nPoints, result->NbPoles());
+
+    // test interpolation accuracy
+    const std::vector<double>& params = app.Parameters();
+    for (size_t iparm = 0; iparm < params.size(); ++iparm) {
+        gp_Pnt p = result->Value(params[iparm]);
+        EXPECT_NEAR(0., p.Distance(pnt2->Value(static_cast<int>(iparm) + 1)), 1e-10);
+    }
+}
+
+TEST_F(BSplineInterpolation, approxManyControlPoints)
+{
+    // large enough to use the banded normal equations
+    tigl::CTiglBSplineApproxInterp app(pnts, 60, 3);
+    tigl::CTiglApproxResult result = app.FitCurve(parms);
+    EXPECT_LT(result.error, 0.01898);
+
+    // The least squares solution must fulfill the normal equations A^T*(A*x - b) = 0
+    Handle(Geom_BSplineCurve) curve = result.curve;
+    TColStd_Array1OfReal flatKnots(1, curve->NbPoles() + curve->Degree() + 1);
+    curve->KnotSequence(flatKnots);
+    TColStd_Array1OfReal params(1, pnts.Length());
+    for (int i = 1; i <= pnts.Length(); ++i) {
+        params.SetValue(i, parms[static_cast<size_t>(i - 1)]);
+    }
+    math_Matrix A = tigl::CTiglBSplineAlgorithms::bsplineBasisMat(curve->Degree(), flatKnots, params);
+    for (int icol = 1; icol <= curve->NbPoles(); ++icol) {
+        gp_Vec gradient(0., 0., 0.);
+        for (int irow = 1; irow <= pnts.Length(); ++irow) {
+            gp_Vec residual(pnts.Value(irow), curve->Value(params.Value(irow)));
+            gradient += A(irow, icol) * residual;
+        }
+        EXPECT_NEAR(0., gradient.Magnitude(), 1e-10);
+    }
+}
+
 TEST_F(BSplineInterpolation, interpolationClosedIssue1)
 {
 
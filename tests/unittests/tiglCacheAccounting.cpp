@@ -0,0 +1,218 @@
+/*
+* Copyright (C) 2019 German Aerospace Center (DLR/SC)
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*/
+/**
+* @file
+* @brief Tests for the memory budget and the LRU eviction of cached shapes
+*/
+
+#include "test.h"
+#include "tigl.h"
+#include "CTiglCacheAccounting.h"
+#include "CCPACSConfigurationManager.h"
+#include "CCPACSConfiguration.h"
+#include "CCPACSWing.h"
+#include "CCPACSWingSegment.h"
+#include "CNamedShape.h"
+
+#include <BRepGProp.hxx>
+#include <BRepPrimAPI_MakeBox.hxx>
+#include <GProp_GProps.hxx>
+#include <TopExp.hxx>
+#include <TopTools_IndexedMapOfShape.hxx>
+
+#include <string>
+#include <vector>
+
+class CacheAccounting : public ::testing::Test
+{
+protected:
+    void TearDown() OVERRIDE
+    {
+        tigl::CTiglCacheAccounting::SetMemoryBudget(0);
+    }
+};
+
+TEST_F(CacheAccounting, estimateShapeMemory)
+{
+    EXPECT_EQ(0, tigl::EstimateShapeMemory(TopoDS_Shape()));
+    EXPECT_GT(tigl::EstimateShapeMemory(BRepPrimAPI_MakeBox(1., 1., 1.).Shape()), 0);
+}
+
+TEST_F(CacheAccounting, statistics)
+{
+    tigl::CTiglCacheAccounting accounting;
+    accounting.Insert("a", 100, []() {});
+    accounting.Insert("b", 50, []() {});
+    EXPECT_TRUE(accounting.Touch("a"));
+    EXPECT_FALSE(accounting.Touch("c"));
+
+    tigl::CTiglCacheStatistics stats = accounting.GetStatistics();
+    EXPECT_EQ(1, stats.hits);
+    EXPECT_EQ(2, stats.misses);
+    EXPECT_EQ(0, stats.evictions);
+    EXPECT_EQ(150, stats.residentBytes);
+    EXPECT_EQ(2, stats.entries);
+
+    accounting.RemovePrefix("a");
+    stats = accounting.GetStatistics();
+    EXPECT_EQ(50, stats.residentBytes);
+    EXPECT_EQ(1, stats.entries);
+}
+
+TEST_F(CacheAccounting, evictLeastRecentlyUsed)
+{
+    tigl::CTiglCacheAccounting accounting;
+    std::vector<std::string> evicted;
+
+    const size_t otherBytes = tigl::CTiglCacheAccounting::GetTotalResidentBytes();
+    tigl::CTiglCacheAccounting::SetMemoryBudget(otherBytes + 250);
+
+    accounting.Insert("a", 100, [&evicted]() { evicted.push_back("a"); });
+    accounting.Insert("b", 100, [&evicted]() { evicted.push_back("b"); });
+    accounting.Insert("c", 100, [&evicted]() { evicted.push_back("c"); });
+
+    // the entries used since the last call are protected
+    EXPECT_EQ(0, accounting.EnforceBudget());
+
+    accounting.Touch("a");
+    EXPECT_EQ(1, accounting.EnforceBudget());
+    ASSERT_EQ(1, evicted.size());
+    EXPECT_EQ("b", evicted[0]);
+    EXPECT_FALSE(accounting.Touch("b"));
+    EXPECT_EQ(1, accounting.GetStatistics().evictions);
+    EXPECT_EQ(200, accounting.GetStatistics().residentBytes);
+}
+
+TEST_F(CacheAccounting, evictIdleConfigurations)
+{
+    tigl::CTiglCacheAccounting idle;
+    tigl::CTiglCacheAccounting active;
+    std::vector<std::string> evicted;
+
+    const size_t otherBytes = tigl::CTiglCacheAccounting::GetTotalResidentBytes();
+    tigl::CTiglCacheAccounting::SetMemoryBudget(otherBytes + 150);
+
+    idle.Insert("a", 100, [&evicted]() { evicted.push_back("a"); });
+    EXPECT_EQ(0, idle.EnforceBudget());
+    idle.Insert("c", 10, [&evicted]() { evicted.push_back("c"); });
+
+    // the budget is exceeded by the active configuration, the idle one has to give way
+    active.Insert("b", 100, [&evicted]() { evicted.push_back("b"); });
+    EXPECT_EQ(0, active.EnforceBudget());
+
+    // the idle configuration might be in use by another thread, it evicts the entry itself
+    EXPECT_TRUE(evicted.empty());
+    EXPECT_EQ(1, idle.EnforceBudget());
+    ASSERT_EQ(1, evicted.size());
+    EXPECT_EQ("a", evicted[0]);
+    EXPECT_EQ(1, idle.GetStatistics().evictions);
+    EXPECT_EQ(0, active.GetStatistics().evictions);
+
+    // used after the last call of the idle configuration
+    EXPECT_TRUE(idle.Touch("c"));
+    EXPECT_TRUE(active.Touch("b"));
+}
+
+TEST_F(CacheAccounting, usedEntriesAreNotEvictedLazily)
+{
+    tigl::CTiglCacheAccounting idle;
+    tigl::CTiglCacheAccounting active;
+
+    const size_t otherBytes = tigl::CTiglCacheAccounting::GetTotalResidentBytes();
+    tigl::CTiglCacheAccounting::SetMemoryBudget(otherBytes + 150);
+
+    idle.Insert("a", 100, []() { FAIL() << "No eviction expected"; });
+    EXPECT_EQ(0, idle.EnforceBudget());
+    active.Insert("b", 100, []() { FAIL() << "No eviction expected"; });
+    EXPECT_EQ(0, active.EnforceBudget());
+
+    // the marked entry is used again before the next call of its configuration
+    EXPECT_TRUE(idle.Touch("a"));
+    EXPECT_EQ(0, idle.EnforceBudget());
+    EXPECT_EQ(0, idle.GetStatistics().evictions);
+    EXPECT_EQ(100, idle.GetStatistics().residentBytes);
+}
+
+TEST_F(CacheAccounting, unlimitedBudget)
+{
+    tigl::CTiglCacheAccounting accounting;
+    accounting.Insert("a", 1000, []() { FAIL() << "No eviction expected"; });
+    accounting.EnforceBudget();
+    EXPECT_EQ(0, accounting.EnforceBudget());
+}
+
+TEST_F(CacheAccounting, configurationLoftsAreRebuilt)
+{
+    const char* filename = "TestData/simpletest.cpacs.xml";
+    TixiDocumentHandle tixiHandle = -1;
+    TiglCPACSConfigurationHandle tiglHandle = -1;
+    ASSERT_EQ(SUCCESS, tixiOpenDocument(filename, &tixiHandle));
+    ASSERT_EQ(TIGL_SUCCESS, tiglOpenCPACSConfiguration(tixiHandle, "", &tiglHandle));
+
+    tigl::CCPACSWing& wing = tigl::CCPACSConfigurationManager::GetInstance().GetConfiguration(tiglHandle).GetWing(1);
+    const PNamedShape loft = wing.GetLoft();
+    wing.GetSegment(1).GetLoft();
+    const unsigned int buildCount = wing.GetLoftBuildCount();
+
+    double hits = 0., misses = 0., evictions = 0., residentBytes = 0.;
+    ASSERT_EQ(TIGL_SUCCESS, tiglConfigurationGetCacheStatistics(tiglHandle, &hits, &misses, &evictions, &residentBytes));
+    EXPECT_GT(misses, 0.);
+    EXPECT_EQ(0., evictions);
+    EXPECT_GT(residentBytes, 0.);
+
+    // the wing loft is evicted after it has not been used for one call
+    ASSERT_EQ(TIGL_SUCCESS, tiglSetCacheMemoryBudget(1.));
+    ASSERT_EQ(TIGL_SUCCESS, tiglConfigurationGetCacheStatistics(tiglHandle, &hits, &misses, &evictions, &residentBytes));
+    ASSERT_EQ(TIGL_SUCCESS, tiglConfigurationGetCacheStatistics(tiglHandle, &hits, &misses, &evictions, &residentBytes));
+    EXPECT_GT(evictions, 0.);
+
+    // the rebuilt loft is a new shape with the same geometry and is not reported as rebuilt
+    ASSERT_EQ(TIGL_SUCCESS, tiglSetCacheMemoryBudget(0.));
+    const PNamedShape rebuiltLoft = wing.GetLoft();
+    ASSERT_TRUE(loft && rebuiltLoft);
+    EXPECT_FALSE(loft->Shape().IsSame(rebuiltLoft->Shape()));
+    EXPECT_EQ(loft->GetFaceCount(), rebuiltLoft->GetFaceCount());
+    EXPECT_EQ(buildCount, wing.GetLoftBuildCount());
+
+    GProp_GProps properties, rebuiltProperties;
+    BRepGProp::VolumeProperties(loft->Shape(), properties);
+    BRepGProp::VolumeProperties(rebuiltLoft->Shape(), rebuiltProperties);
+    EXPECT_NEAR(properties.Mass(), rebuiltProperties.Mass(), 1e-10);
+    EXPECT_TRUE(properties.CentreOfMass().IsEqual(rebuiltProperties.CentreOfMass(), 1e-10));
+
+    // the segment is cut from the rebuilt wing loft again
+    TopTools_IndexedMapOfShape wingFaces, segmentFaces;
+    TopExp::MapShapes(rebuiltLoft->Shape(), TopAbs_FACE, wingFaces);
+    TopExp::MapShapes(wing.GetSegment(1).GetLoft()->Shape(), TopAbs_FACE, segmentFaces);
+    int sharedFaces = 0;
+    for (int i = 1; i <= segmentFaces.Extent(); ++i) {
+        if (wingFaces.Contains(segmentFaces(i))) {
+            sharedFaces++;
+        }
+    }
+    EXPECT_GT(sharedFaces, 0);
+
+    ASSERT_EQ(TIGL_SUCCESS, tiglCloseCPACSConfiguration(tiglHandle));
+    ASSERT_EQ(SUCCESS, tixiCloseDocument(tixiHandle));
+}
+
+TEST_F(CacheAccounting, invalidArguments)
+{
+    double hits = 0., misses = 0., evictions = 0., residentBytes = 0.;
+    EXPECT_EQ(TIGL_ERROR, tiglSetCacheMemoryBudget(-1.));
+    EXPECT_EQ(TIGL_NULL_POINTER, tiglConfigurationGetCacheStatistics(-1, NULL, &misses, &evictions, &residentBytes));
+    EXPECT_EQ(TIGL_NOT_FOUND, tiglConfigurationGetCacheStatistics(-1, &hits, &misses, &evictions, &residentBytes));
+}
@@ -18,11 +18,13 @@
 #include "tigl.h"
 #include "tiglcommonfunctions.h"
 #include "test.h"
+#include "CTiglSolidClassifier.h"
 #include <BRep_Builder.hxx>
 #include <BRepTools.hxx>
 
 #include <gp_Pln.hxx>
 #include <BRepPrimAPI_MakeBox.hxx>
+#include <BRepPrimAPI_MakeSphere.hxx>
 #include <BRepBuilderAPI_MakeVertex.hxx>
 
 TEST(TiglCommonFunctions, isPathRelative)
@@ -103,6 +105,45 @@ TEST(TiglCommonFunctions, IsPointInsideShape)
     EXPECT_THROW(IsPointInsideShape(v, gp_Pnt(0., 0., 0.)), tigl::CTiglError);
 }
 
+TEST(TiglCommonFunctions, SolidClassifier)
+{
+    TopoDS_Shape box = BRepPrimAPI_MakeBox(1., 1., 1).Solid();
+
+    for (int irev = 0; irev < 2; ++irev) {
+        tigl::CTiglSolidClassifier classifier(irev == 0 ? box : box.Reversed());
+        EXPECT_TRUE(classifier.IsInside(gp_Pnt(0.5, 0.5, 0.5)));
+        EXPECT_TRUE(classifier.IsInside(gp_Pnt(1.0, 0.5, 0.5)));
+        EXPECT_FALSE(classifier.IsInside(gp_Pnt(1.5, 0.5, 0.5)));
+        EXPECT_TRUE(classifier.IsInside(gp_Pnt(1.0009, 0.5, 0.5)));
+        EXPECT_FALSE(classifier.IsInside(gp_Pnt(1.0011, 0.5, 0.5)));
+    }
+
+    // compare with IsPointInsideShape on a curved solid, including points close to the surface
+    TopoDS_Shape sphere = BRepPrimAPI_MakeSphere(gp_Pnt(0.3, -0.2, 0.1), 1.).Solid();
+    std::vector<gp_Pnt> points;
+    for (int i = 0; i <= 20; ++i) {
+        for (int j = 0; j <= 20; ++j) {
+            for (int k = 0; k <= 20; ++k) {
+                points.push_back(gp_Pnt(-1.0 + 0.1*i, -1.5 + 0.1*j, -1.2 + 0.11*k));
+            }
+        }
+    }
+    points.push_back(gp_Pnt(1.3, -0.2, 0.1));
+    points.push_back(gp_Pnt(1.3005, -0.2, 0.1));
+    points.push_back(gp_Pnt(1.302, -0.2, 0.1));
+
+    tigl::CTiglSolidClassifier classifier(sphere);
+    std::vector<bool> inside = classifier.IsInside(points, 4);
+    ASSERT_EQ(points.size(), inside.size());
+    for (size_t i = 0; i < points.size(); ++i) {
+        EXPECT_EQ(IsPointInsideShape(sphere, points[i]), inside[i]) << "point " << i;
+        EXPECT_EQ(inside[i], classifier.IsInside(points[i]));
+    }
+
+    TopoDS_Vertex v = BRepBuilderAPI_MakeVertex(gp_Pnt(10., 10., 10.));
+    EXPECT_THROW(tigl::CTiglSolidClassifier c(v), tigl::CTiglError);
+}
+
 TEST(TiglCommonFunctions, tiglCheckPointInside_api)
 {
     TixiDocumentHandle tixiSimpleWingHandle = -1;
@@ -128,6 +169,26 @@ TEST(TiglCommonFunctions, tiglCheckPointInside_api)
     EXPECT_EQ(TIGL_NULL_POINTER, tiglCheckPointInside(tiglSimpleWingHandle, 0., 0., 0., NULL, &isInside));
     EXPECT_EQ(TIGL_NULL_POINTER, tiglCheckPointInside(tiglSimpleWingHandle, 0., 0., 0., "wrongUID", NULL));
 
+    // batch classification
+    double px[3] = {0., 0., 0.};
+    double py[3] = {0., 0., 0.};
+    double pz[3] = {0., 2., 0.1};
+    TiglBoolean inside[3];
+    ASSERT_EQ(TIGL_SUCCESS, tiglCheckPointsInside(tiglSimpleWingHandle, "segmentD150_Fuselage_1Segment2ID", 3, px, py, pz, inside));
+    for (int i = 0; i < 3; ++i) {
+        ASSERT_EQ(TIGL_SUCCESS, tiglCheckPointInside(tiglSimpleWingHandle, px[i], py[i], pz[i], "segmentD150_Fuselage_1Segment2ID", &isInside));
+        EXPECT_EQ(isInside, inside[i]);
+    }
+    EXPECT_EQ(TIGL_TRUE, inside[0]);
+    EXPECT_EQ(TIGL_FALSE, inside[1]);
+
+    EXPECT_EQ(TIGL_SUCCESS, tiglCheckPointsInside(tiglSimpleWingHandle, "segmentD150_Fuselage_1Segment2ID", 0, px, py, pz, inside));
+    EXPECT_EQ(TIGL_ERROR, tiglCheckPointsInside(tiglSimpleWingHandle, "segmentD150_Fuselage_1Segment2ID", -1, px, py, pz, inside));
+    EXPECT_EQ(TIGL_UID_ERROR, tiglCheckPointsInside(tiglSimpleWingHandle, "wrongUID", 3, px, py, pz, inside));
+    EXPECT_EQ(TIGL_NULL_POINTER, tiglCheckPointsInside(tiglSimpleWingHandle, NULL, 3, px, py, pz, inside));
+    EXPECT_EQ(TIGL_NULL_POINTER, tiglCheckPointsInside(tiglSimpleWingHandle, "wrongUID", 3, px, NULL, pz, inside));
+    EXPECT_EQ(TIGL_NULL_POINTER, tiglCheckPointsInside(tiglSimpleWingHandle, "wrongUID", 3, px, py, pz, NULL));
+
 
 }
 
@@ -0,0 +1,197 @@
+/*
+* Copyright (C) 2019 German Aerospace Center (DLR/SC)
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*/
+/**
+* @file
+* @brief Tests for the incremental writing of modified CPACS objects
+*/
+
+#include "test.h"
+#include "tigl.h"
+#include "CCPACSConfigurationManager.h"
+#include "CCPACSConfiguration.h"
+#include "CCPACSWing.h"
+#include "CCPACSWingSection.h"
+#include "CCPACSWingSections.h"
+
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace
+{
+    std::string exportDocument(TixiDocumentHandle tixiHandle)
+    {
+        char* text = NULL;
+        if (tixiExportDocumentAsString(tixiHandle, &text) != SUCCESS) {
+            return "";
+        }
+        return text;
+    }
+}
+
+class DirtyWriteCPACS : public ::testing::Test
+{
+protected:
+    void SetUp() OVERRIDE
+    {
+        const char* filename = "TestData/simpletest.cpacs.xml";
+        tixiHandle = -1;
+        tiglHandle = -1;
+        ASSERT_EQ(SUCCESS, tixiOpenDocument(filename, &tixiHandle));
+        ASSERT_EQ(TIGL_SUCCESS, tiglOpenCPACSConfiguration(tixiHandle, "", &tiglHandle));
+    }
+
+    void TearDown() OVERRIDE
+    {
+        ASSERT_EQ(TIGL_SUCCESS, tiglCloseCPACSConfiguration(tiglHandle));
+        ASSERT_EQ(SUCCESS, tixiCloseDocument(tixiHandle));
+    }
+
+    tigl::CCPACSConfiguration& configuration()
+    {
+        return tigl::CCPACSConfigurationManager::GetInstance().GetConfiguration(tiglHandle);
+    }
+
+    TixiDocumentHandle           tixiHandle;
+    TiglCPACSConfigurationHandle tiglHandle;
+};
+
+TEST_F(DirtyWriteCPACS, notModifiedAfterOpen)
+{
+    tigl::CCPACSWing& wing = configuration().GetWing(1);
+    EXPECT_FALSE(wing.IsDirty());
+
+    wing.GetSection(2).GetTransformation().setRotation(tigl::CTiglPoint(0., 0., 5.));
+    EXPECT_TRUE(wing.GetSection(2).GetTransformation().IsDirty());
+    EXPECT_TRUE(wing.IsDirty());
+    EXPECT_FALSE(wing.GetSection(1).IsDirty());
+
+    ASSERT_EQ(TIGL_SUCCESS, tiglSaveCPACSConfigurationIncremental("Cpacs2Test", tiglHandle));
+    EXPECT_FALSE(wing.IsDirty());
+}
+
+TEST_F(DirtyWriteCPACS, sameResultAsFullWrite)
+{
+    // both documents are written completely once, so that they only differ by the modifications
+    ASSERT_EQ(TIGL_SUCCESS, tiglSaveCPACSConfiguration("Cpacs2Test", tiglHandle));
+    tigl::CCPACSWing& wing = configuration().GetWing(1);
+    wing.SetName("modified wing");
+    wing.GetSection(2).GetTransformation().setRotation(tigl::CTiglPoint(0., 0., 5.));
+    ASSERT_EQ(TIGL_SUCCESS, tiglSaveCPACSConfigurationIncremental("Cpacs2Test", tiglHandle));
+    const std::string incremental = exportDocument(tixiHandle);
+
+    TixiDocumentHandle otherTixiHandle = -1;
+    TiglCPACSConfigurationHandle otherTiglHandle = -1;
+    ASSERT_EQ(SUCCESS, tixiOpenDocument("TestData/simpletest.cpacs.xml", &otherTixiHandle));
+    ASSERT_EQ(TIGL_SUCCESS, tiglOpenCPACSConfiguration(otherTixiHandle, "", &otherTiglHandle));
+    ASSERT_EQ(TIGL_SUCCESS, tiglSaveCPACSConfiguration("Cpacs2Test", otherTiglHandle));
+    tigl::CCPACSWing& otherWing = tigl::CCPACSConfigurationManager::GetInstance().GetConfiguration(otherTiglHandle).GetWing(1);
+    otherWing.SetName("modified wing");
+    otherWing.GetSection(2).GetTransformation().setRotation(tigl::CTiglPoint(0., 0., 5.));
+    ASSERT_EQ(TIGL_SUCCESS, tiglSaveCPACSConfiguration("Cpacs2Test", otherTiglHandle));
+    const std::string full = exportDocument(otherTixiHandle);
+    ASSERT_EQ(TIGL_SUCCESS, tiglCloseCPACSConfiguration(otherTiglHandle));
+    ASSERT_EQ(SUCCESS, tixiCloseDocument(otherTixiHandle));
+
+    EXPECT_FALSE(incremental.empty());
+    EXPECT_EQ(full, incremental);
+
+    // the written document can be read again
+    TiglCPACSConfigurationHandle reopenedHandle = -1;
+    ASSERT_EQ(TIGL_SUCCESS, tiglOpenCPACSConfiguration(tixiHandle, "", &reopenedHandle));
+    EXPECT_EQ("modified wing", tigl::CCPACSConfigurationManager::GetInstance().GetConfiguration(reopenedHandle).GetWing(1).GetName());
+    ASSERT_EQ(TIGL_SUCCESS, tiglCloseCPACSConfiguration(reopenedHandle));
+}
+
+TEST_F(DirtyWriteCPACS, unmodifiedObjectsAreNotVisited)
+{
+    char* wingXPath = NULL;
+    ASSERT_EQ(SUCCESS, tixiUIDGetXPath(tixiHandle, "Wing", &wingXPath));
+    const std::string namePath = std::string(wingXPath) + "/name";
+
+    // changes of the document are kept, since the wing is not modified
+    ASSERT_EQ(SUCCESS, tixiUpdateTextElement(tixiHandle, namePath.c_str(), "changed in document"));
+    configuration().GetWing(1).GetSection(1).SetName("modified section");
+    ASSERT_EQ(TIGL_SUCCESS, tiglSaveCPACSConfigurationIncremental("Cpacs2Test", tiglHandle));
+
+    char* name = NULL;
+    ASSERT_EQ(SUCCESS, tixiGetTextElement(tixiHandle, namePath.c_str(), &name));
+    EXPECT_STREQ("changed in document", name);
+
+    // a full write restores the name of the wing
+    ASSERT_EQ(TIGL_SUCCESS, tiglSaveCPACSConfiguration("Cpacs2Test", tiglHandle));
+    ASSERT_EQ(SUCCESS, tixiGetTextElement(tixiHandle, namePath.c_str(), &name));
+    EXPECT_STREQ(configuration().GetWing(1).GetName().c_str(), name);
+}
+
+TEST_F(DirtyWriteCPACS, erasedListElementsAreRemoved)
+{
+    char* wingXPath = NULL;
+    ASSERT_EQ(SUCCESS, tixiUIDGetXPath(tixiHandle, "Wing", &wingXPath));
+    const std::string sectionsPath = std::string(wingXPath) + "/sections";
+
+    int count = 0;
+    ASSERT_EQ(SUCCESS, tixiGetNamedChildrenCount(tixiHandle, sectionsPath.c_str(), "section", &count));
+    ASSERT_GT(count, 1);
+
+    // erase an unmodified section via the non-const getter, the remaining sections are unmodified as well
+    std::vector<tigl::unique_ptr<tigl::CCPACSWingSection> >& sections = configuration().GetWing(1).GetSections().GetSections();
+    ASSERT_EQ(static_cast<std::size_t>(count), sections.size());
+    sections.pop_back();
+    EXPECT_TRUE(configuration().GetWing(1).IsDirty());
+
+    ASSERT_EQ(TIGL_SUCCESS, tiglSaveCPACSConfigurationIncremental("Cpacs2Test", tiglHandle));
+    ASSERT_EQ(SUCCESS, tixiGetNamedChildrenCount(tixiHandle, sectionsPath.c_str(), "section", &count));
+    EXPECT_EQ(sections.size(), static_cast<std::size_t>(count));
+    EXPECT_FALSE(configuration().GetWing(1).IsDirty());
+}
+
+TEST_F(DirtyWriteCPACS, replacedListElementsAreWritten)
+{
+    char* wingXPath = NULL;
+    ASSERT_EQ(SUCCESS, tixiUIDGetXPath(tixiHandle, "Wing", &wingXPath));
+    const std::string sectionsPath = std::string(wingXPath) + "/sections";
+
+    // erase a section in the middle and append a new one, the number of sections does not change
+    tigl::CCPACSWingSections& wingSections = configuration().GetWing(1).GetSections();
+    std::vector<tigl::unique_ptr<tigl::CCPACSWingSection> >& sections = wingSections.GetSections();
+    ASSERT_EQ(3, sections.size());
+    sections.erase(sections.begin() + 1);
+    wingSections.AddSection().SetUID("Cpacs2Test_Wing_Sec4");
+    EXPECT_TRUE(configuration().GetWing(1).IsDirty());
+
+    ASSERT_EQ(TIGL_SUCCESS, tiglSaveCPACSConfigurationIncremental("Cpacs2Test", tiglHandle));
+    int count = 0;
+    ASSERT_EQ(SUCCESS, tixiGetNamedChildrenCount(tixiHandle, sectionsPath.c_str(), "section", &count));
+    ASSERT_EQ(sections.size(), static_cast<std::size_t>(count));
+    for (std::size_t i = 0; i < sections.size(); i++) {
+        const std::string sectionPath = sectionsPath + "/section[" + std::to_string(i + 1) + "]";
+        char* uid = NULL;
+        ASSERT_EQ(SUCCESS, tixiGetTextAttribute(tixiHandle, sectionPath.c_str(), "uID", &uid));
+        EXPECT_EQ(sections[i]->GetUID(), uid);
+    }
+    EXPECT_FALSE(configuration().GetWing(1).IsDirty());
+
+    // reordering is detected as well
+    std::swap(sections[0], sections[1]);
+    EXPECT_TRUE(configuration().GetWing(1).IsDirty());
+}
+
+TEST_F(DirtyWriteCPACS, invalidArguments)
+{
+    EXPECT_EQ(TIGL_NULL_POINTER, tiglSaveCPACSConfigurationIncremental(NULL, tiglHandle));
+    EXPECT_EQ(TIGL_UNINITIALIZED, tiglSaveCPACSConfigurationIncremental("Cpacs2Test", -1));
+}
@@ -31,6 +31,28 @@
 #include "CTiglExporterFactory.h"
 #include "CGlobalExporterConfigs.h"
 #include "CTiglExportIges.h"
+#include "CTiglExportStep.h"
+#include "CTiglExportStl.h"
+#include "CCPACSWingSegment.h"
+#include "CCPACSRotor.h"
+#include "CTiglAttachedRotorBlade.h"
+#include "CNamedShape.h"
+
+#include <Interface_Static.hxx>
+#include <STEPCAFControl_Reader.hxx>
+#include <TCollection_AsciiString.hxx>
+#include <TDataStd_Name.hxx>
+#include <TDF_LabelMap.hxx>
+#include <TDF_LabelSequence.hxx>
+#include <TDocStd_Document.hxx>
+#include <TopExp_Explorer.hxx>
+#include <XCAFApp_Application.hxx>
+#include <XCAFDoc_DocumentTool.hxx>
+#include <XCAFDoc_ShapeTool.hxx>
+
+#include <fstream>
+#include <set>
+#include <string>
 
 
 /******************************************************************************/
@@ -315,6 +337,69 @@ TEST_F(tiglExportSimple, export_generic_stl)
     ASSERT_EQ(true, ret);
 }
 
+TEST_F(tiglExportSimple, export_stl_multiple_solids)
+{
+    tigl::CCPACSConfigurationManager & manager = tigl::CCPACSConfigurationManager::GetInstance();
+    tigl::CCPACSConfiguration & config = manager.GetConfiguration(tiglSimpleHandle);
+
+    tigl::StlOptions options;
+    options.Set("MultipleSolids", true);
+    options.Set("ParallelMeshing", true);
+
+    tigl::CTiglExportStl stlExporter(options);
+    stlExporter.AddShape(config.GetWing(1).GetLoft(), tigl::TriangulatedExportOptions(0.01));
+    stlExporter.AddShape(config.GetFuselage(1).GetLoft(), tigl::TriangulatedExportOptions(0.01));
+
+    const char* filename = "TestData/export/simpletest_export_multiple_solids.stl";
+    ASSERT_TRUE(stlExporter.Write(filename));
+
+    // one named solid per shape
+    std::ifstream file(filename);
+    std::vector<std::string> solidNames;
+    std::string line;
+    while (std::getline(file, line)) {
+        if (line.compare(0, 6, "solid ") == 0) {
+            solidNames.push_back(line.substr(6));
+        }
+    }
+    ASSERT_EQ(2u, solidNames.size());
+    EXPECT_EQ(config.GetWing(1).GetLoft()->Name(), solidNames[0]);
+    EXPECT_EQ(config.GetFuselage(1).GetLoft()->Name(), solidNames[1]);
+}
+
+TEST_F(tiglExportSimple, export_stl_binary)
+{
+    tigl::CCPACSConfigurationManager & manager = tigl::CCPACSConfigurationManager::GetInstance();
+    tigl::CCPACSConfiguration & config = manager.GetConfiguration(tiglSimpleHandle);
+
+    tigl::StlOptions options;
+    options.Set("WriteBinary", true);
+
+    tigl::CTiglExportStl stlExporter(options);
+    stlExporter.AddShape(config.GetWing(1).GetLoft(), tigl::TriangulatedExportOptions(0.01));
+
+    const char* filename = "TestData/export/simpletest_export_binary.stl";
+    ASSERT_TRUE(stlExporter.Write(filename));
+
+    std::ifstream file(filename, std::ios::binary);
+    ASSERT_TRUE(file.good());
+
+    // 80 bytes header, triangle count, 50 bytes per triangle
+    char header[84];
+    file.read(header, sizeof(header));
+    ASSERT_TRUE(file.good());
+    EXPECT_NE(0, std::string(header, 5).compare("solid"));
+
+    unsigned long nTriangles = 0;
+    for (int i = 3; i >= 0; --i) {
+        nTriangles = (nTriangles << 8) | static_cast<unsigned char>(header[80 + i]);
+    }
+    EXPECT_GT(nTriangles, 0ul);
+
+    file.seekg(0, std::ios::end);
+    EXPECT_EQ(84ul + 50ul * nTriangles, static_cast<unsigned long>(file.tellg()));
+}
+
 TEST_F(tiglExportSimple, export_iges_layers)
 {
     tigl::CCPACSConfigurationManager & manager = tigl::CCPACSConfigurationManager::GetInstance();
@@ -387,6 +472,222 @@ TEST_F(tiglExportSimple, export_iges_symmetry)
     ASSERT_EQ(true, ret);
 }
 
+TEST_F(tiglExportSimple, mirrored_loft_is_cached)
+{
+    tigl::CCPACSConfigurationManager & manager = tigl::CCPACSConfigurationManager::GetInstance();
+    tigl::CCPACSConfiguration & config = manager.GetConfiguration(tiglSimpleHandle);
+
+    tigl::CCPACSWingSegment& segment = static_cast<tigl::CCPACSWingSegment&>(config.GetWing(1).GetSegment(1));
+    ASSERT_NE(TIGL_NO_SYMMETRY, segment.GetSymmetryAxis());
+
+    PNamedShape mirrored = segment.GetMirroredLoft();
+    ASSERT_TRUE(mirrored);
+    EXPECT_EQ(mirrored, segment.GetMirroredLoft());
+
+    // the mirrored loft is rebuilt together with the loft
+    segment.Reset();
+    PNamedShape rebuilt = segment.GetMirroredLoft();
+    ASSERT_TRUE(rebuilt);
+    EXPECT_NE(mirrored, rebuilt);
+    EXPECT_EQ(rebuilt, segment.GetMirroredLoft());
+}
+
+namespace
+{
+    std::streamoff fileSize(const char* filename)
+    {
+        std::ifstream file(filename, std::ios::binary | std::ios::ate);
+        return file ? static_cast<std::streamoff>(file.tellg()) : 0;
+    }
+
+    std::string labelName(const TDF_Label& label)
+    {
+        Handle(TDataStd_Name) name;
+        if (!label.FindAttribute(TDataStd_Name::GetID(), name)) {
+            return "";
+        }
+        return TCollection_AsciiString(name->Get()).ToCString();
+    }
+
+    // Product structure of a step file, as read by the XCAF reader
+    struct StepAssembly
+    {
+        StepAssembly()
+            : nFreeShapes(0), isAssembly(false), nInstances(0), nParts(0)
+        {
+        }
+
+        int nFreeShapes;                  // number of top level products
+        bool isAssembly;                  // the first top level product is an assembly
+        std::string name;                 // name of the first top level product
+        int nInstances;                   // number of components of the assembly
+        int nParts;                       // number of distinct products referred by the components
+        std::set<std::string> partNames;
+    };
+
+    StepAssembly readStepAssembly(const char* filename)
+    {
+        StepAssembly result;
+
+        Handle(XCAFApp_Application) app = XCAFApp_Application::GetApplication();
+        Handle(TDocStd_Document) doc;
+        app->NewDocument("MDTV-XCAF", doc);
+
+        STEPCAFControl_Reader reader;
+        reader.SetNameMode(true);
+        if (reader.ReadFile(filename) != IFSelect_RetDone || !reader.Transfer(doc)) {
+            app->Close(doc);
+            return result;
+        }
+
+        Handle(XCAFDoc_ShapeTool) shapeTool = XCAFDoc_DocumentTool::ShapeTool(doc->Main());
+        TDF_LabelSequence freeShapes;
+        shapeTool->GetFreeShapes(freeShapes);
+        result.nFreeShapes = freeShapes.Length();
+        if (freeShapes.IsEmpty()) {
+            app->Close(doc);
+            return result;
+        }
+
+        const TDF_Label& root = freeShapes.Value(1);
+        result.isAssembly = XCAFDoc_ShapeTool::IsAssembly(root);
+        result.name = labelName(root);
+
+        TDF_LabelSequence components;
+        XCAFDoc_ShapeTool::GetComponents(root, components);
+        result.nInstances = components.Length();
+
+        TDF_LabelMap parts;
+        for (int i = 1; i <= components.Length(); ++i) {
+            TDF_Label part;
+            if (XCAFDoc_ShapeTool::GetReferredShape(components.Value(i), part) && parts.Add(part)) {
+                result.partNames.insert(labelName(part));
+            }
+        }
+        result.nParts = parts.Extent();
+
+        app->Close(doc);
+        return result;
+    }
+
+    // number of shapes of the exporter, that are written as parts of the assembly
+    int countPartShapes(const tigl::CTiglCADExporter& exporter, std::set<std::string>& names)
+    {
+        int count = 0;
+        for (size_t i = 0; i < exporter.NShapes(); ++i) {
+            PNamedShape shape = exporter.GetShape(i);
+            if (shape && TopExp_Explorer(shape->Shape(), TopAbs_FACE).More()) {
+                names.insert(shape->Name());
+                ++count;
+            }
+        }
+        return count;
+    }
+}
+
+TEST_F(tiglExportSimple, export_step_assembly)
+{
+    tigl::CCPACSConfigurationManager & manager = tigl::CCPACSConfigurationManager::GetInstance();
+    tigl::CCPACSConfiguration & config = manager.GetConfiguration(tiglSimpleHandle);
+
+    tigl::ExporterOptions options = tigl::getExportConfig("step");
+    options.SetApplySymmetries(true);
+    options.Set("WriteAssembly", true);
+    tigl::PTiglCADExporter stepExporter = tigl::createExporter("step", options);
+
+    stepExporter->AddConfiguration(config);
+
+    // the global step settings of the caller are kept
+    const int writeAssembly = Interface_Static::IVal("write.step.assembly");
+    Interface_Static::SetIVal("write.step.assembly", 2);
+    ASSERT_TRUE(stepExporter->Write("TestData/export/simpletest_assembly.stp"));
+    EXPECT_EQ(2, Interface_Static::IVal("write.step.assembly"));
+    Interface_Static::SetIVal("write.step.assembly", writeAssembly);
+
+    std::set<std::string> shapeNames;
+    const int nShapes = countPartShapes(*stepExporter, shapeNames);
+    ASSERT_GT(nShapes, 0);
+
+    // one assembly named after the configuration, containing one instance per shape
+    StepAssembly assembly = readStepAssembly("TestData/export/simpletest_assembly.stp");
+    EXPECT_EQ(1, assembly.nFreeShapes);
+    EXPECT_TRUE(assembly.isAssembly);
+    EXPECT_EQ(config.GetUID(), assembly.name);
+    EXPECT_EQ(nShapes, assembly.nInstances);
+    EXPECT_GT(assembly.nParts, 0);
+    EXPECT_LE(assembly.nParts, assembly.nInstances);
+    for (std::set<std::string>::const_iterator it = assembly.partNames.begin(); it != assembly.partNames.end(); ++it) {
+        EXPECT_TRUE(shapeNames.find(*it) != shapeNames.end()) << "Unexpected part name " << *it;
+    }
+
+    EXPECT_EQ(TIGL_SUCCESS, tiglSetExportOptions("step", "WriteAssembly", "true"));
+    EXPECT_EQ(TIGL_SUCCESS, tiglExportConfiguration(tiglSimpleHandle, "TestData/export/simpletest_assembly_api.stp", TIGL_FALSE, 0.));
+    EXPECT_EQ(TIGL_SUCCESS, tiglSetExportOptions("step", "WriteAssembly", "false"));
+
+    StepAssembly apiAssembly = readStepAssembly("TestData/export/simpletest_assembly_api.stp");
+    EXPECT_EQ(1, apiAssembly.nFreeShapes);
+    EXPECT_TRUE(apiAssembly.isAssembly);
+    EXPECT_EQ(config.GetUID(), apiAssembly.name);
+    EXPECT_GT(apiAssembly.nInstances, 0);
+
+    // without the option, no assembly is written
+    EXPECT_EQ(TIGL_SUCCESS, tiglExportConfiguration(tiglSimpleHandle, "TestData/export/simpletest_flat_api.stp", TIGL_FALSE, 0.));
+    StepAssembly flat = readStepAssembly("TestData/export/simpletest_flat_api.stp");
+    EXPECT_GT(flat.nFreeShapes, 0);
+    EXPECT_NE(config.GetUID(), flat.name);
+}
+
+TEST(TiglExportStepAssembly, rotorBladesAreWrittenOnce)
+{
+    TixiDocumentHandle tixiHandle = -1;
+    TiglCPACSConfigurationHandle tiglHandle = -1;
+    ASSERT_EQ(SUCCESS, tixiOpenDocument("TestData/simple_test_rotors.cpacs.xml", &tixiHandle));
+    ASSERT_EQ(TIGL_SUCCESS, tiglOpenCPACSConfiguration(tixiHandle, "RotorTestModel", &tiglHandle));
+
+    tigl::CCPACSConfiguration & config = tigl::CCPACSConfigurationManager::GetInstance().GetConfiguration(tiglHandle);
+    tigl::CCPACSRotor& rotor = config.GetRotor(1);
+    const int nBlades = rotor.GetRotorBladeCount();
+    ASSERT_GT(nBlades, 1);
+
+    tigl::ExporterOptions options = tigl::getExportConfig("step");
+    options.Set("WriteAssembly", false);
+    tigl::PTiglCADExporter flatExporter = tigl::createExporter("step", options);
+    options.Set("WriteAssembly", true);
+    tigl::PTiglCADExporter assemblyExporter = tigl::createExporter("step", options);
+
+    std::set<std::string> bladeNames;
+    for (int i = 1; i <= nBlades; ++i) {
+        PNamedShape blade = rotor.GetRotorBlade(i).GetLoft();
+        bladeNames.insert(blade->Name());
+        flatExporter->AddShape(blade, &config);
+        assemblyExporter->AddShape(blade, &config);
+    }
+
+    ASSERT_TRUE(flatExporter->Write("TestData/export/rotor_blades_flat.stp"));
+    ASSERT_TRUE(assemblyExporter->Write("TestData/export/rotor_blades_assembly.stp"));
+
+    // each blade is an instance of the same part
+    StepAssembly assembly = readStepAssembly("TestData/export/rotor_blades_assembly.stp");
+    EXPECT_EQ(1, assembly.nFreeShapes);
+    EXPECT_TRUE(assembly.isAssembly);
+    EXPECT_EQ(config.GetUID(), assembly.name);
+    EXPECT_EQ(nBlades, assembly.nInstances);
+    EXPECT_EQ(1, assembly.nParts);
+    ASSERT_EQ(1u, assembly.partNames.size());
+    EXPECT_TRUE(bladeNames.find(*assembly.partNames.begin()) != bladeNames.end());
+
+    // the flat file contains a separate product for each blade
+    StepAssembly flat = readStepAssembly("TestData/export/rotor_blades_flat.stp");
+    EXPECT_EQ(nBlades, flat.nFreeShapes);
+    EXPECT_FALSE(flat.isAssembly);
+
+    // the blade geometry is contained only once in the assembly
+    EXPECT_LT(fileSize("TestData/export/rotor_blades_assembly.stp"), fileSize("TestData/export/rotor_blades_flat.stp"));
+
+    ASSERT_EQ(TIGL_SUCCESS, tiglCloseCPACSConfiguration(tiglHandle));
+    ASSERT_EQ(SUCCESS, tixiCloseDocument(tixiHandle));
+}
+
 // check if face names were set correctly in the case with a trailing edge
 TEST_F(tiglExportSimple, check_face_traits)
 {
@@ -35,6 +35,10 @@
 #include <BRepAlgoAPI_Section.hxx>
 #include <BRepCheck_Analyzer.hxx>
 #include <TopExp.hxx>
+#include <GProp_GProps.hxx>
+#include <BRepGProp.hxx>
+
+#include <cmath>
 
 #include "CTiglExportBrep.h"
 #include "CTiglFusePlane.h"
@@ -239,6 +243,58 @@ TEST_P(tiglFuseAircraftCPACS, fusedAircraftMirror)
     ASSERT_TRUE(BRepTools::Write(airplane->Shape(), ("TestData/export/" + name + "_fusedAircraftMirrored.brep").c_str()));
 }
 
+/**
+* Compares the serial and the parallel fuse of the mirror symmetric aircraft
+*/
+TEST_P(tiglFuseAircraftCPACS, fusedAircraftParallel)
+{
+    tigl::CCPACSConfigurationManager& manager = tigl::CCPACSConfigurationManager::GetInstance();
+    tigl::CCPACSConfiguration& config = manager.GetConfiguration(tiglHandle);
+
+    // build the lofts in advance, such that both fusers use the same lofts
+    for (int iwing = 1; iwing <= config.GetWingCount(); ++iwing) {
+        config.GetWing(iwing).GetLoft();
+    }
+    for (int ifusel = 1; ifusel <= config.GetFuselageCount(); ++ifusel) {
+        config.GetFuselage(ifusel).GetLoft();
+    }
+
+    tigl::CTiglFusePlane serialFuser(config);
+    serialFuser.SetResultMode(tigl::FULL_PLANE);
+    PNamedShape serialPlane = serialFuser.FusedPlane();
+
+    tigl::CTiglFusePlane parallelFuser(config);
+    parallelFuser.SetResultMode(tigl::FULL_PLANE);
+    parallelFuser.SetRunParallel(true);
+    PNamedShape parallelPlane = parallelFuser.FusedPlane();
+
+    ASSERT_TRUE(serialPlane != NULL);
+    ASSERT_TRUE(parallelPlane != NULL);
+
+    BRepCheck_Analyzer analyzer(parallelPlane->Shape());
+    EXPECT_TRUE(analyzer.IsValid());
+    EXPECT_EQ(serialPlane->Shape().ShapeType(), parallelPlane->Shape().ShapeType());
+    EXPECT_EQ(serialPlane->GetFaceCount(), parallelPlane->GetFaceCount());
+
+    TopTools_IndexedMapOfShape serialFaces, parallelFaces;
+    TopExp::MapShapes(serialPlane->Shape(), TopAbs_FACE, serialFaces);
+    TopExp::MapShapes(parallelPlane->Shape(), TopAbs_FACE, parallelFaces);
+    EXPECT_EQ(serialFaces.Extent(), parallelFaces.Extent());
+
+    GProp_GProps serialProps, parallelProps;
+    BRepGProp::VolumeProperties(serialPlane->Shape(), serialProps);
+    BRepGProp::VolumeProperties(parallelPlane->Shape(), parallelProps);
+    EXPECT_NEAR(serialProps.Mass(), parallelProps.Mass(), 1e-4 * std::abs(serialProps.Mass()));
+
+    const ListPNamedShape& serialInts = serialFuser.Intersections();
+    const ListPNamedShape& parallelInts = parallelFuser.Intersections();
+    ASSERT_EQ(serialInts.size(), parallelInts.size());
+    for (size_t i = 0; i < serialInts.size(); ++i) {
+        EXPECT_EQ(serialInts[i]->Name(), parallelInts[i]->Name());
+        EXPECT_EQ(serialInts[i]->Shape().ShapeType(), parallelInts[i]->Shape().ShapeType());
+    }
+}
+
 INSTANTIATE_TEST_CASE_P(xrf1, tiglFuseAircraftCPACS, ::testing::Values(
                         testcase("D150WithGuides", "D150modelID", 246) 
                         ));
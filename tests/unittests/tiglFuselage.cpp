@@ -27,6 +27,17 @@
 #include "tigl.h"
 #include <string.h>
 
+#include "CCPACSConfigurationManager.h"
+#include "CCPACSFuselage.h"
+#include "CNamedShape.h"
+
+#include <IntCurvesFace_Intersector.hxx>
+#include <TopExp_Explorer.hxx>
+#include <TopoDS.hxx>
+
+#include <limits>
+#include <vector>
+
 
 /******************************************************************************/
 
@@ -152,6 +163,102 @@ TEST_F(TiglFuselage, tiglFuselageGetSegmentIndex_wrongHandle)
     ASSERT_TRUE(tiglFuselageGetSegmentIndex(myWrongHandle, "D150_VAMP_FL1_Seg1", &segmentIndex, &fuselageIndex) == TIGL_NOT_FOUND);
 }
 
+/**
+* Tests for the fuselage ray intersections
+*/
+TEST_F(TiglFuselage, intersection_sameAsFaceLoop)
+{
+    const tigl::CCPACSConfiguration& config = tigl::CCPACSConfigurationManager::GetInstance().GetConfiguration(tiglHandle);
+    const tigl::CCPACSFuselage& fuselage = config.GetFuselage(1);
+    const TopoDS_Shape loft = fuselage.GetLoft(FUSELAGE_COORDINATE_SYSTEM)->Shape();
+
+    // reference points in the fuselage, in fuselage coordinates
+    const tigl::CTiglTransformation toLocal = fuselage.GetTransformationMatrix().Inverted();
+    std::vector<gp_Pnt> pRefs;
+    std::vector<double> angles;
+    for (int iseg = 2; iseg < fuselage.GetSegmentCount(); ++iseg) {
+        double x1, y1, z1, x2, y2, z2;
+        ASSERT_EQ(TIGL_SUCCESS, tiglFuselageGetPointAngle(tiglHandle, 1, iseg, 0.5, 0., &x1, &y1, &z1));
+        ASSERT_EQ(TIGL_SUCCESS, tiglFuselageGetPointAngle(tiglHandle, 1, iseg, 0.5, 180., &x2, &y2, &z2));
+        const gp_Pnt center = toLocal.Transform(gp_Pnt(0.5*(x1 + x2), 0.5*(y1 + y2), 0.5*(z1 + z2)));
+        for (double angle = 0.; angle < 2.*M_PI; angle += M_PI/5.) {
+            pRefs.push_back(center);
+            angles.push_back(angle);
+        }
+    }
+    ASSERT_FALSE(pRefs.empty());
+
+    const std::vector<gp_Lin> lines = fuselage.Intersections(pRefs, angles, 0);
+    ASSERT_EQ(pRefs.size(), lines.size());
+
+    for (size_t i = 0; i < pRefs.size(); ++i) {
+        // the plain loop over all faces, as used before the ray caster
+        const gp_Dir angleDir = gp_Dir(0, 0, 1).Rotated(gp_Ax1(pRefs[i], gp_Dir(1, 0, 0)), angles[i]);
+        const gp_Lin line(pRefs[i], angleDir);
+        bool found = false;
+        for (TopExp_Explorer exp(loft, TopAbs_FACE); exp.More() && !found; exp.Next()) {
+            IntCurvesFace_Intersector intersection(TopoDS::Face(exp.Current()), 0.1);
+            intersection.Perform(line, 0, std::numeric_limits<Standard_Real>::max());
+            if (intersection.IsDone() && intersection.NbPnt() > 0) {
+                EXPECT_NEAR(0., intersection.Pnt(1).Distance(lines[i].Location()), 1e-10);
+                found = true;
+            }
+        }
+        EXPECT_TRUE(found);
+        EXPECT_TRUE(lines[i].Direction().IsEqual(angleDir, 1e-10));
+    }
+}
+
+TEST_F(TiglFuselage, tiglFuselageGetRayIntersections)
+{
+    // rays from the center of the fuselage segments to points on their surfaces
+    int nSegments = 0;
+    ASSERT_EQ(TIGL_SUCCESS, tiglFuselageGetSegmentCount(tiglHandle, 1, &nSegments));
+
+    std::vector<double> ox, oy, oz, dx, dy, dz, expectedX, expectedY, expectedZ;
+    for (int iseg = 2; iseg < nSegments; ++iseg) {
+        for (double alpha = 0.; alpha < 180.; alpha += 45.) {
+            double x1, y1, z1, x2, y2, z2;
+            ASSERT_EQ(TIGL_SUCCESS, tiglFuselageGetPointAngle(tiglHandle, 1, iseg, 0.5, alpha, &x1, &y1, &z1));
+            ASSERT_EQ(TIGL_SUCCESS, tiglFuselageGetPointAngle(tiglHandle, 1, iseg, 0.5, alpha + 180., &x2, &y2, &z2));
+            ox.push_back(0.5*(x1 + x2)); oy.push_back(0.5*(y1 + y2)); oz.push_back(0.5*(z1 + z2));
+            dx.push_back(x1 - ox.back()); dy.push_back(y1 - oy.back()); dz.push_back(z1 - oz.back());
+            expectedX.push_back(x1); expectedY.push_back(y1); expectedZ.push_back(z1);
+        }
+    }
+
+    // a ray pointing away from the fuselage
+    ox.push_back(0.); oy.push_back(100.); oz.push_back(0.);
+    dx.push_back(0.); dy.push_back(1.); dz.push_back(0.);
+    expectedX.push_back(0.); expectedY.push_back(0.); expectedZ.push_back(0.);
+
+    const int nRays = static_cast<int>(ox.size());
+    std::vector<double> px(nRays), py(nRays), pz(nRays);
+    std::vector<int> hits(nRays, -1);
+    ASSERT_EQ(TIGL_SUCCESS, tiglFuselageGetRayIntersections(tiglHandle, 1, nRays, &ox[0], &oy[0], &oz[0], &dx[0], &dy[0], &dz[0],
+                                                            &px[0], &py[0], &pz[0], &hits[0]));
+
+    for (int i = 0; i < nRays - 1; ++i) {
+        ASSERT_EQ(1, hits[i]);
+        EXPECT_NEAR(expectedX[i], px[i], 1e-3);
+        EXPECT_NEAR(expectedY[i], py[i], 1e-3);
+        EXPECT_NEAR(expectedZ[i], pz[i], 1e-3);
+    }
+    EXPECT_EQ(0, hits[nRays - 1]);
+
+    ASSERT_EQ(TIGL_INDEX_ERROR, tiglFuselageGetRayIntersections(tiglHandle, 0, nRays, &ox[0], &oy[0], &oz[0], &dx[0], &dy[0], &dz[0],
+                                                                &px[0], &py[0], &pz[0], &hits[0]));
+    ASSERT_EQ(TIGL_NULL_POINTER, tiglFuselageGetRayIntersections(tiglHandle, 1, nRays, &ox[0], &oy[0], &oz[0], &dx[0], &dy[0], &dz[0],
+                                                                 &px[0], &py[0], &pz[0], NULL));
+    ASSERT_EQ(TIGL_ERROR, tiglFuselageGetRayIntersections(tiglHandle, 1, -1, &ox[0], &oy[0], &oz[0], &dx[0], &dy[0], &dz[0],
+                                                          &px[0], &py[0], &pz[0], &hits[0]));
+
+    // zero direction
+    dx[0] = dy[0] = dz[0] = 0.;
+    ASSERT_EQ(TIGL_MATH_ERROR, tiglFuselageGetRayIntersections(tiglHandle, 1, nRays, &ox[0], &oy[0], &oz[0], &dx[0], &dy[0], &dz[0],
+                                                               &px[0], &py[0], &pz[0], &hits[0]));
+}
+
 TEST(TiglSimpleFuselage, getSurfaceArea_FullModel)
 {
     const char* filename = "TestData/simpletest.cpacs.xml";
@@ -146,6 +146,30 @@ TEST_F(TiglFuselageGetPoint, success)
     ASSERT_NEAR( 1.5, x, accuracy);
 }
 
+/**
+* Tests that tiglFuselageGetPoints matches tiglFuselageGetPoint.
+*/
+TEST_F(TiglFuselageGetPoint, getPoints)
+{
+    double etas[] = {0.0, 0.5, 1.0, 0.25, 0.75};
+    double zetas[] = {0.0, 0.5, 1.0, 0.8, 0.1};
+    double xs[5], ys[5], zs[5];
+
+    ASSERT_EQ(TIGL_SUCCESS, tiglFuselageGetPoints(tiglHandle, 1, 1, 5, etas, zetas, xs, ys, zs));
+    for (int i = 0; i < 5; ++i) {
+        double x, y, z;
+        ASSERT_EQ(TIGL_SUCCESS, tiglFuselageGetPoint(tiglHandle, 1, 1, etas[i], zetas[i], &x, &y, &z));
+        EXPECT_NEAR(x, xs[i], 1e-10);
+        EXPECT_NEAR(y, ys[i], 1e-10);
+        EXPECT_NEAR(z, zs[i], 1e-10);
+    }
+
+    ASSERT_EQ(TIGL_NOT_FOUND, tiglFuselageGetPoints(-1, 1, 1, 5, etas, zetas, xs, ys, zs));
+    ASSERT_EQ(TIGL_INDEX_ERROR, tiglFuselageGetPoints(tiglHandle, 1, 3, 5, etas, zetas, xs, ys, zs));
+    ASSERT_EQ(TIGL_NULL_POINTER, tiglFuselageGetPoints(tiglHandle, 1, 1, 5, etas, NULL, xs, ys, zs));
+    ASSERT_EQ(TIGL_ERROR, tiglFuselageGetPoints(tiglHandle, 1, 1, -5, etas, zetas, xs, ys, zs));
+}
+
 /**
 * Testing a bug in getPointAtAngle.
 */
@@ -0,0 +1,198 @@
+/*
+* Copyright (C) 2019 German Aerospace Center (DLR/SC)
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*/
+/**
+* @file
+* @brief Tests for the volume, area, centroid and inertia computation
+*/
+
+#include "test.h"
+#include "tigl.h"
+#include "CTiglIntegralProperties.h"
+#include "CCPACSConfigurationManager.h"
+#include "CCPACSConfiguration.h"
+#include "CCPACSWing.h"
+#include "CCPACSWingSection.h"
+#include "CNamedShape.h"
+
+#include <BRepBuilderAPI_MakeFace.hxx>
+#include <BRepGProp.hxx>
+#include <BRepPrimAPI_MakeBox.hxx>
+#include <GProp_GProps.hxx>
+#include <gp_Pln.hxx>
+
+#include <cmath>
+
+TEST(IntegralProperties, box)
+{
+    const TopoDS_Shape box = BRepPrimAPI_MakeBox(gp_Pnt(1., 2., 3.), 2., 3., 4.).Shape();
+
+    for (int accuracy = TIGL_INTEGRATION_FAST; accuracy <= TIGL_INTEGRATION_EXACT; ++accuracy) {
+        tigl::CTiglIntegralProperties props = tigl::ComputeIntegralProperties(box, static_cast<TiglIntegrationAccuracy>(accuracy));
+        EXPECT_NEAR(24., props.volume, 1e-8);
+        EXPECT_NEAR(52., props.surfaceArea, 1e-8);
+        EXPECT_NEAR(2., props.centroid.x, 1e-8);
+        EXPECT_NEAR(3.5, props.centroid.y, 1e-8);
+        EXPECT_NEAR(5., props.centroid.z, 1e-8);
+
+        // m * (b^2 + c^2) / 12
+        EXPECT_NEAR(50., props.inertia(1, 1), 1e-8);
+        EXPECT_NEAR(40., props.inertia(2, 2), 1e-8);
+        EXPECT_NEAR(26., props.inertia(3, 3), 1e-8);
+        EXPECT_NEAR(0., props.inertia(1, 2), 1e-8);
+        EXPECT_NEAR(0., props.inertia(1, 3), 1e-8);
+        EXPECT_NEAR(0., props.inertia(2, 3), 1e-8);
+    }
+}
+
+TEST(IntegralProperties, faceWithoutVolume)
+{
+    const TopoDS_Shape face = BRepBuilderAPI_MakeFace(gp_Pln(gp::XOY()), 0., 2., 0., 1.).Shape();
+
+    tigl::CTiglIntegralProperties props = tigl::ComputeIntegralProperties(face);
+    EXPECT_NEAR(0., props.volume, 1e-10);
+    EXPECT_NEAR(2., props.surfaceArea, 1e-10);
+    EXPECT_NEAR(1., props.centroid.x, 1e-10);
+    EXPECT_NEAR(0.5, props.centroid.y, 1e-10);
+    EXPECT_NEAR(0., props.centroid.z, 1e-10);
+}
+
+TEST(IntegralProperties, nullShape)
+{
+    tigl::CTiglIntegralProperties props = tigl::ComputeIntegralProperties(TopoDS_Shape());
+    EXPECT_EQ(0., props.volume);
+    EXPECT_EQ(0., props.surfaceArea);
+}
+
+class IntegralPropertiesSimple : public ::testing::Test
+{
+protected:
+    void SetUp() OVERRIDE
+    {
+        const char* filename = "TestData/simpletest.cpacs.xml";
+        tixiHandle = -1;
+        tiglHandle = -1;
+        ASSERT_EQ(SUCCESS, tixiOpenDocument(filename, &tixiHandle));
+        ASSERT_EQ(TIGL_SUCCESS, tiglOpenCPACSConfiguration(tixiHandle, "", &tiglHandle));
+    }
+
+    void TearDown() OVERRIDE
+    {
+        ASSERT_EQ(TIGL_SUCCESS, tiglCloseCPACSConfiguration(tiglHandle));
+        ASSERT_EQ(SUCCESS, tixiCloseDocument(tixiHandle));
+    }
+
+    tigl::CCPACSWing& wing()
+    {
+        return tigl::CCPACSConfigurationManager::GetInstance().GetConfiguration(tiglHandle).GetWing(1);
+    }
+
+    // Compares the exact properties returned by the API with BRepGProp applied to the whole loft
+    void CheckAgainstLoft(const TopoDS_Shape& loft)
+    {
+        GProp_GProps volumeProps, surfaceProps;
+        BRepGProp::VolumeProperties(loft, volumeProps);
+        BRepGProp::SurfaceProperties(loft, surfaceProps);
+        const double volume = volumeProps.Mass();
+        const gp_Pnt centroid = volumeProps.CentreOfMass();
+        const gp_Mat inertia = volumeProps.MatrixOfInertia();
+        const double tol = 1e-6;
+
+        double v = 0., a = 0., cx = 0., cy = 0., cz = 0.;
+        ASSERT_EQ(TIGL_SUCCESS, tiglComponentGetIntegralProperties(tiglHandle, "Wing", TIGL_INTEGRATION_EXACT,
+                                                                   &v, &a, &cx, &cy, &cz));
+        EXPECT_NEAR(volume, v, tol * volume);
+        EXPECT_NEAR(surfaceProps.Mass(), a, tol * surfaceProps.Mass());
+        EXPECT_NEAR(centroid.X(), cx, tol);
+        EXPECT_NEAR(centroid.Y(), cy, tol);
+        EXPECT_NEAR(centroid.Z(), cz, tol);
+
+        double ixx = 0., iyy = 0., izz = 0., ixy = 0., ixz = 0., iyz = 0.;
+        ASSERT_EQ(TIGL_SUCCESS, tiglComponentGetInertiaTensor(tiglHandle, "Wing", TIGL_INTEGRATION_EXACT,
+                                                              &ixx, &iyy, &izz, &ixy, &ixz, &iyz));
+        const double inertiaTol = tol * inertia.Value(1, 1);
+        EXPECT_NEAR(inertia.Value(1, 1), ixx, inertiaTol);
+        EXPECT_NEAR(inertia.Value(2, 2), iyy, inertiaTol);
+        EXPECT_NEAR(inertia.Value(3, 3), izz, inertiaTol);
+        EXPECT_NEAR(inertia.Value(1, 2), ixy, inertiaTol);
+        EXPECT_NEAR(inertia.Value(1, 3), ixz, inertiaTol);
+        EXPECT_NEAR(inertia.Value(2, 3), iyz, inertiaTol);
+    }
+
+    TixiDocumentHandle           tixiHandle;
+    TiglCPACSConfigurationHandle tiglHandle;
+};
+
+TEST_F(IntegralPropertiesSimple, wing)
+{
+    CheckAgainstLoft(wing().GetLoft()->Shape());
+
+    double volume = 0., area = 0., cx = 0., cy = 0., cz = 0.;
+    ASSERT_EQ(TIGL_SUCCESS, tiglComponentGetIntegralProperties(tiglHandle, "Wing", TIGL_INTEGRATION_EXACT,
+                                                               &volume, &area, &cx, &cy, &cz));
+
+    double fastVolume = 0., fastArea = 0., fx = 0., fy = 0., fz = 0.;
+    ASSERT_EQ(TIGL_SUCCESS, tiglComponentGetIntegralProperties(tiglHandle, "Wing", TIGL_INTEGRATION_FAST,
+                                                               &fastVolume, &fastArea, &fx, &fy, &fz));
+    EXPECT_NEAR(volume, fastVolume, 1e-2 * std::fabs(volume));
+    EXPECT_NEAR(area, fastArea, 1e-2 * area);
+    EXPECT_NEAR(cx, fx, 1e-2);
+    EXPECT_NEAR(cy, fy, 1e-2);
+    EXPECT_NEAR(cz, fz, 1e-2);
+
+    double ixx = 0., iyy = 0., izz = 0., ixy = 0., ixz = 0., iyz = 0.;
+    ASSERT_EQ(TIGL_SUCCESS, tiglComponentGetInertiaTensor(tiglHandle, "Wing", TIGL_INTEGRATION_EXACT,
+                                                          &ixx, &iyy, &izz, &ixy, &ixz, &iyz));
+    EXPECT_GT(ixx, 0.);
+    EXPECT_GT(iyy, 0.);
+    EXPECT_GT(izz, 0.);
+    // triangle inequality of the principal moments
+    EXPECT_LE(ixx, iyy + izz + 1e-10);
+}
+
+TEST_F(IntegralPropertiesSimple, recomputedAfterGeometryChange)
+{
+    const TopoDS_Shape oldLoft = wing().GetLoft()->Shape();
+    CheckAgainstLoft(oldLoft);
+
+    double oldVolume = 0., area = 0., oldX = 0., oldY = 0., oldZ = 0.;
+    ASSERT_EQ(TIGL_SUCCESS, tiglComponentGetIntegralProperties(tiglHandle, "Wing", TIGL_INTEGRATION_EXACT,
+                                                               &oldVolume, &area, &oldX, &oldY, &oldZ));
+
+    // twist the tip section
+    tigl::CCPACSWingSection& section = wing().GetSection(wing().GetSectionCount());
+    tigl::CTiglPoint rotation = section.GetRotation();
+    rotation.y += 10.;
+    section.SetRotation(rotation);
+
+    const TopoDS_Shape newLoft = wing().GetLoft()->Shape();
+    ASSERT_FALSE(newLoft.IsSame(oldLoft));
+    CheckAgainstLoft(newLoft);
+
+    double volume = 0., x = 0., y = 0., z = 0.;
+    ASSERT_EQ(TIGL_SUCCESS, tiglComponentGetIntegralProperties(tiglHandle, "Wing", TIGL_INTEGRATION_EXACT,
+                                                               &volume, &area, &x, &y, &z));
+    EXPECT_GT(std::fabs(oldX - x) + std::fabs(oldZ - z), 1e-6);
+}
+
+TEST_F(IntegralPropertiesSimple, invalidArguments)
+{
+    double v = 0., a = 0., x = 0., y = 0., z = 0., xy = 0., xz = 0., yz = 0.;
+    EXPECT_EQ(TIGL_NULL_POINTER, tiglComponentGetIntegralProperties(tiglHandle, NULL, TIGL_INTEGRATION_EXACT, &v, &a, &x, &y, &z));
+    EXPECT_EQ(TIGL_NULL_POINTER, tiglComponentGetIntegralProperties(tiglHandle, "Wing", TIGL_INTEGRATION_EXACT, NULL, &a, &x, &y, &z));
+    EXPECT_EQ(TIGL_NULL_POINTER, tiglComponentGetInertiaTensor(tiglHandle, "Wing", TIGL_INTEGRATION_EXACT, &x, &y, &z, &xy, &xz, NULL));
+    EXPECT_EQ(TIGL_UID_ERROR, tiglComponentGetIntegralProperties(tiglHandle, "NoComponent", TIGL_INTEGRATION_EXACT, &v, &a, &x, &y, &z));
+    EXPECT_EQ(TIGL_NOT_FOUND, tiglComponentGetIntegralProperties(-1, "Wing", TIGL_INTEGRATION_EXACT, &v, &a, &x, &y, &z));
+}
@@ -31,6 +31,8 @@
 #include <TopoDS_Edge.hxx>
 #include <BRepBuilderAPI_MakeEdge.hxx>
 #include <BRepBuilderAPI_MakeWire.hxx>
+#include <BRepGProp.hxx>
+#include <GProp_GProps.hxx>
 
 TEST(makeLoft, nacelleInverted)
 {
@@ -99,6 +101,40 @@ TEST(makeLoft, nacelleClosed)
     BRepTools::Write(loft, "TestData/export/makeLoft_nacellePatchesClosed.brep");
 }
 
+TEST(makeLoft, parallelSkinning)
+{
+    TopoDS_Shape profiles;
+    BRep_Builder b;
+    ifstream in;
+    in.open("TestData/guideCurvePatch_nacelleProfilesClosed.brep");
+    BRepTools::Read(profiles, in, b);
+    in.close();
+
+    CTiglMakeLoft serialLofter;
+    serialLofter.addProfiles(profiles);
+    serialLofter.setMakeSmooth(true);
+    serialLofter.setRunParallel(false);
+    TopoDS_Shape serialLoft = serialLofter.Shape();
+
+    CTiglMakeLoft parallelLofter;
+    parallelLofter.addProfiles(profiles);
+    parallelLofter.setMakeSmooth(true);
+    TopoDS_Shape parallelLoft = parallelLofter.Shape();
+
+    ASSERT_FALSE(parallelLoft.IsNull());
+    ASSERT_EQ(serialLoft.ShapeType(), parallelLoft.ShapeType());
+
+    TopTools_IndexedMapOfShape serialFaces, parallelFaces;
+    TopExp::MapShapes(serialLoft, TopAbs_FACE, serialFaces);
+    TopExp::MapShapes(parallelLoft, TopAbs_FACE, parallelFaces);
+    ASSERT_EQ(serialFaces.Extent(), parallelFaces.Extent());
+
+    GProp_GProps serialProps, parallelProps;
+    BRepGProp::SurfaceProperties(serialLoft, serialProps);
+    BRepGProp::SurfaceProperties(parallelLoft, parallelProps);
+    EXPECT_NEAR(serialProps.Mass(), parallelProps.Mass(), 1e-10 * serialProps.Mass());
+}
+
 class CurveNetworkCoons: public ::testing::TestWithParam<std::string>
 {
 protected:
@@ -36,6 +36,11 @@
 #include <TopoDS_CompSolid.hxx>
 
 #include <ctime>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <iterator>
+#include <stdint.h>
 
 using namespace tigl;
 
@@ -95,6 +100,66 @@ TEST(TiglPolyData, simple)
     ASSERT_TRUE(!poly.currentObject().hasNormals());
 }
 
+TEST(TiglPolyData, vertex_welding)
+{
+    CTiglPolyData poly;
+    CTiglPolyObject& co = poly.currentObject();
+
+    unsigned long i1 = co.addPointNormal(CTiglPoint(1., 2., 3.), CTiglPoint(0., 0., 1.));
+    unsigned long i2 = co.addPointNormal(CTiglPoint(2., 2., 3.), CTiglPoint(0., 0., 1.));
+    ASSERT_NE(i1, i2);
+
+    // points within the tolerance are merged, also across grid cells
+    EXPECT_EQ(i1, co.addPointNormal(CTiglPoint(1. + 1e-7, 2. - 1e-7, 3.), CTiglPoint(0., 0., 1.)));
+    EXPECT_EQ(i2, co.addPointNormal(CTiglPoint(2. - 1e-7, 2., 3. + 1e-7), CTiglPoint(0., 0., 1.)));
+    EXPECT_EQ(2, co.getNVertices());
+
+    // same point with different normal is a new vertex
+    unsigned long i3 = co.addPointNormal(CTiglPoint(1., 2., 3.), CTiglPoint(1., 0., 0.));
+    EXPECT_NE(i1, i3);
+    EXPECT_EQ(3, co.getNVertices());
+    EXPECT_NEAR(0., co.getVertexNormal(i3).distance2(CTiglPoint(1., 0., 0.)), 1e-14);
+
+    // points far enough apart are not merged
+    unsigned long i4 = co.addPointNormal(CTiglPoint(1. + 1e-4, 2., 3.), CTiglPoint(0., 0., 1.));
+    EXPECT_EQ(4, co.getNVertices());
+    EXPECT_NEAR(0., co.getVertexPoint(i4).distance2(CTiglPoint(1. + 1e-4, 2., 3.)), 1e-14);
+}
+
+TEST(TiglPolyData, poly_data_field_ids)
+{
+    CTiglPolyData poly;
+    CTiglPolyObject& co = poly.currentObject();
+
+    unsigned long i1 = co.addPointNormal(CTiglPoint(0., 0., 0.), CTiglPoint(0., 0., 1.));
+    unsigned long i2 = co.addPointNormal(CTiglPoint(1., 0., 0.), CTiglPoint(0., 0., 1.));
+    unsigned long i3 = co.addPointNormal(CTiglPoint(0., 1., 0.), CTiglPoint(0., 0., 1.));
+    unsigned long i4 = co.addPointNormal(CTiglPoint(1., 1., 0.), CTiglPoint(0., 0., 1.));
+    co.addTriangleByVertexIndex(i1, i2, i3);
+    co.addTriangleByVertexIndex(i2, i4, i3);
+
+    unsigned int xsiId = co.getPolyDataFieldId("xsi");
+    unsigned int etaId = co.getPolyDataFieldId("eta");
+    EXPECT_EQ(xsiId, co.getPolyDataFieldId("xsi"));
+    EXPECT_NE(xsiId, etaId);
+
+    co.setPolyDataRealById(1, xsiId, 0.5);
+    co.setPolyDataReal(0, "eta", 0.25);
+
+    EXPECT_EQ(0.5, co.getPolyDataReal(1, "xsi"));
+    EXPECT_EQ(UNDEFINED_REAL, co.getPolyDataRealById(0, xsiId));
+    EXPECT_EQ(0.25, co.getPolyDataRealById(0, etaId));
+    EXPECT_EQ(UNDEFINED_REAL, co.getPolyDataReal(0, "unknown"));
+
+    // field names are sorted alphabetically
+    ASSERT_EQ(2, co.getNumberOfPolyRealData());
+    EXPECT_STREQ("eta", co.getPolyDataFieldName(0));
+    EXPECT_STREQ("xsi", co.getPolyDataFieldName(1));
+
+    EXPECT_THROW(co.setPolyDataRealById(2, xsiId, 1.), tigl::CTiglError);
+    EXPECT_THROW(co.setPolyDataRealById(0, 5, 1.), tigl::CTiglError);
+}
+
 TEST(TiglPolyData, cube_export_vtk_standard)
 {
     CTiglPolyData poly;
@@ -368,6 +433,59 @@ TEST(TiglPolyData, cube_export_vtk_withpieces)
     CTiglExportVtk::WritePolys(poly, "vtk_cube+pieces.vtp");
 }
 
+TEST(TiglPolyData, export_vtk_binary)
+{
+    CTiglPolyData poly;
+    CTiglPolyObject& co = poly.currentObject();
+
+    CTiglPolygon f1;
+    f1.addPoint(CTiglPoint(0, 0, 0));
+    f1.addPoint(CTiglPoint(1, 0, 0));
+    f1.addPoint(CTiglPoint(1, 1, 0));
+    co.addPolygon(f1);
+
+    CTiglPolygon f2;
+    f2.addPoint(CTiglPoint(0, 0, 0));
+    f2.addPoint(CTiglPoint(1, 1, 0));
+    f2.addPoint(CTiglPoint(0, 1, 2));
+    co.addPolygon(f2);
+
+    co.setPolyDataReal(0, "value", 3.);
+    co.setPolyDataReal(1, "value", 4.);
+
+    const char* filename = "TestData/export/vtk_binary.vtp";
+    ASSERT_NO_THROW(CTiglExportVtk::WritePolys(poly, filename, true));
+
+    std::ifstream file(filename, std::ios::binary);
+    ASSERT_TRUE(file.good());
+    std::string content((std::istreambuf_iterator<char>(file)), std::istreambuf_iterator<char>());
+
+    EXPECT_NE(std::string::npos, content.find("NumberOfPolys=\"2\""));
+    EXPECT_NE(std::string::npos, content.find("Name=\"value\""));
+
+    // read the points from the appended data
+    size_t pointsPos = content.find("Name=\"Points\"");
+    ASSERT_NE(std::string::npos, pointsPos);
+    size_t offsetPos = content.find("offset=\"", pointsPos);
+    ASSERT_NE(std::string::npos, offsetPos);
+    size_t offset = atoi(content.c_str() + offsetPos + 8);
+
+    size_t appendedPos = content.find("<AppendedData encoding=\"raw\">");
+    ASSERT_NE(std::string::npos, appendedPos);
+    size_t dataStart = content.find('_', appendedPos) + 1;
+
+    const char* data = content.c_str() + dataStart + offset;
+    uint64_t nBytes = 0;
+    memcpy(&nBytes, data, sizeof(uint64_t));
+    ASSERT_EQ(3 * sizeof(double) * co.getNVertices(), nBytes);
+
+    for (unsigned long i = 0; i < co.getNVertices(); ++i) {
+        double p[3];
+        memcpy(p, data + sizeof(uint64_t) + 3 * sizeof(double) * i, 3 * sizeof(double));
+        EXPECT_NEAR(0., co.getVertexPoint(i).distance2(CTiglPoint(p[0], p[1], p[2])), 1e-14);
+    }
+}
+
 TEST_F(TriangularizeShape, exportVTK_FusedWing)
 {
     tigl::CCPACSConfigurationManager & manager = tigl::CCPACSConfigurationManager::GetInstance();
@@ -440,6 +558,46 @@ TEST_F(TriangularizeShape, exportVTK_WingSegmentInfo)
     ASSERT_NO_THROW(CTiglExportVtk::WritePolys(polys, vtkWingFilename));
 }
 
+TEST_F(TriangularizeShape, exportVTK_WingSegmentInfoBinary)
+{
+    tigl::CCPACSConfigurationManager & manager = tigl::CCPACSConfigurationManager::GetInstance();
+    tigl::CCPACSConfiguration & config = manager.GetConfiguration(tiglHandle);
+    tigl::CCPACSWing& wing = config.GetWing(1);
+
+    tigl::CTiglTriangularizer mesher(&config.GetUIDManager(), wing.GetLoft(), 0.0001, SEGMENT_INFO);
+    const tigl::CTiglPolyData& polys = mesher.getTriangulation();
+
+    ASSERT_NO_THROW(CTiglExportVtk::WritePolys(polys, "TestData/export/simplewing_segmentinfo_binary.vtp", true, false));
+    ASSERT_NO_THROW(CTiglExportVtk::WritePolys(polys, "TestData/export/simplewing_segmentinfo_zlib.vtp", true, true));
+}
+
+TEST_F(TriangularizeShape, parallelSegmentInfo)
+{
+    tigl::CCPACSConfigurationManager & manager = tigl::CCPACSConfigurationManager::GetInstance();
+    tigl::CCPACSConfiguration & config = manager.GetConfiguration(tiglHandle);
+    tigl::CCPACSWing& wing = config.GetWing(1);
+
+    tigl::CTiglTriangularizer serialMesher(&config.GetUIDManager(), wing.GetLoft(), 0.001, SEGMENT_INFO);
+    tigl::CTiglTriangularizer parallelMesher(&config.GetUIDManager(), wing.GetLoft(), 0.001, SEGMENT_INFO, true, true);
+
+    const tigl::CTiglPolyObject& serial = serialMesher.getTriangulation().currentObject();
+    const tigl::CTiglPolyObject& parallel = parallelMesher.getTriangulation().currentObject();
+
+    ASSERT_EQ(serial.getNVertices(), parallel.getNVertices());
+    ASSERT_EQ(serial.getNPolygons(), parallel.getNPolygons());
+    ASSERT_EQ(serial.getNumberOfPolyRealData(), parallel.getNumberOfPolyRealData());
+
+    for (unsigned long iPoly = 0; iPoly < serial.getNPolygons(); ++iPoly) {
+        for (unsigned long jPoint = 0; jPoint < serial.getNPointsOfPolygon(iPoly); ++jPoint) {
+            ASSERT_EQ(serial.getVertexIndexOfPolygon(jPoint, iPoly), parallel.getVertexIndexOfPolygon(jPoint, iPoly));
+        }
+        EXPECT_EQ(serial.getPolyDataReal(iPoly, "segment_index"), parallel.getPolyDataReal(iPoly, "segment_index"));
+        EXPECT_EQ(serial.getPolyDataReal(iPoly, "is_upper"), parallel.getPolyDataReal(iPoly, "is_upper"));
+        EXPECT_NEAR(serial.getPolyDataReal(iPoly, "eta"), parallel.getPolyDataReal(iPoly, "eta"), 1e-6);
+        EXPECT_NEAR(serial.getPolyDataReal(iPoly, "xsi"), parallel.getPolyDataReal(iPoly, "xsi"), 1e-6);
+    }
+}
+
 TEST_F(TriangularizeShape, exportVTK_FullPlane_long)
 {
     const char* vtkWingFilename = "TestData/export/simplewing_fusedplane.vtp";
@@ -0,0 +1,124 @@
+/*
+* Copyright (C) 2019 German Aerospace Center (DLR/SC)
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*/
+/**
+* @file
+* @brief Tests for the profiling timers and the report API
+*/
+
+#include "test.h"
+#include "tigl.h"
+#include "CTiglProfiler.h"
+#include "tiglparallel.h"
+
+#include <string>
+
+class Profiling : public ::testing::Test
+{
+protected:
+    void SetUp() OVERRIDE
+    {
+        tiglProfilingReset();
+        tiglProfilingEnable(TIGL_TRUE);
+    }
+
+    void TearDown() OVERRIDE
+    {
+        tiglProfilingEnable(TIGL_FALSE);
+        tiglProfilingReset();
+    }
+
+    std::string Report(TiglProfilingFormat format)
+    {
+        char* report = NULL;
+        EXPECT_EQ(TIGL_SUCCESS, tiglProfilingGetReport(format, &report));
+        return report ? std::string(report) : std::string();
+    }
+};
+
+TEST_F(Profiling, disabled)
+{
+    tiglProfilingEnable(TIGL_FALSE);
+    {
+        tigl::CTiglScopedTimer timer("DisabledOperation");
+    }
+    EXPECT_EQ(std::string::npos, Report(TIGL_PROFILING_JSON).find("DisabledOperation"));
+}
+
+TEST_F(Profiling, nestedTimers)
+{
+    {
+        tigl::CTiglScopedTimer outer("Outer", "outerUID");
+        for (int i = 0; i < 3; ++i) {
+            tigl::CTiglScopedTimer inner("Inner");
+        }
+    }
+
+    const std::string json = Report(TIGL_PROFILING_JSON);
+    const size_t outerPos = json.find("\"operation\": \"Outer\"");
+    const size_t innerPos = json.find("\"operation\": \"Inner\"");
+    ASSERT_NE(std::string::npos, outerPos);
+    ASSERT_NE(std::string::npos, innerPos);
+    EXPECT_LT(outerPos, innerPos);
+    EXPECT_NE(std::string::npos, json.find("\"uid\": \"outerUID\""));
+    EXPECT_NE(std::string::npos, json.find("\"count\": 3", innerPos));
+
+    const std::string trace = Report(TIGL_PROFILING_CHROME_TRACE);
+    EXPECT_EQ(0, trace.find("{\"traceEvents\": ["));
+    EXPECT_NE(std::string::npos, trace.find("\"name\": \"Inner\""));
+    EXPECT_NE(std::string::npos, trace.find("\"ph\": \"X\""));
+}
+
+TEST_F(Profiling, parallelTimersAttachToCaller)
+{
+    {
+        tigl::CTiglScopedTimer outer("ParallelOuter");
+        tigl::ParallelFor(8, [](size_t) {
+            tigl::CTiglScopedTimer inner("ParallelInner");
+        }, 4);
+    }
+
+    const std::string json = Report(TIGL_PROFILING_JSON);
+    const size_t outerPos = json.find("\"operation\": \"ParallelOuter\"");
+    ASSERT_NE(std::string::npos, outerPos);
+    const size_t innerPos = json.find("\"operation\": \"ParallelInner\"", outerPos);
+    ASSERT_NE(std::string::npos, innerPos);
+    EXPECT_NE(std::string::npos, json.find("\"count\": 8", innerPos));
+}
+
+TEST_F(Profiling, cacheBuilds)
+{
+    const char* filename = "TestData/simpletest.cpacs.xml";
+    TixiDocumentHandle tixiHandle = -1;
+    TiglCPACSConfigurationHandle tiglHandle = -1;
+    ASSERT_EQ(SUCCESS, tixiOpenDocument(filename, &tixiHandle));
+    ASSERT_EQ(TIGL_SUCCESS, tiglOpenCPACSConfiguration(tixiHandle, "", &tiglHandle));
+
+    double volume = 0.;
+    ASSERT_EQ(TIGL_SUCCESS, tiglWingGetVolume(tiglHandle, 1, &volume));
+
+    const std::string json = Report(TIGL_PROFILING_JSON);
+    EXPECT_NE(std::string::npos, json.find("\"operation\": \"ReadCPACS\""));
+    EXPECT_NE(std::string::npos, json.find("\"operation\": \"Cache<"));
+    EXPECT_NE(std::string::npos, json.find("\"uid\": \"Wing\""));
+
+    ASSERT_EQ(TIGL_SUCCESS, tiglCloseCPACSConfiguration(tiglHandle));
+    ASSERT_EQ(SUCCESS, tixiCloseDocument(tixiHandle));
+}
+
+TEST_F(Profiling, nullPointer)
+{
+    EXPECT_EQ(TIGL_NULL_POINTER, tiglProfilingGetReport(TIGL_PROFILING_JSON, NULL));
+}
@@ -25,6 +25,15 @@
 
 #include "test.h" // Brings in the GTest framework
 #include "tigl.h"
+#include "CCPACSConfigurationManager.h"
+#include "CCPACSConfiguration.h"
+#include "CCPACSRotor.h"
+#include "CCPACSWing.h"
+#include "CTiglAttachedRotorBlade.h"
+#include "CNamedShape.h"
+
+#include <BRepGProp.hxx>
+#include <GProp_GProps.hxx>
 
 /******************************************************************************/
 
@@ -883,3 +892,30 @@ TEST_F(RotorSimple, tiglRotorBladeGetLocalTwistAngle)
             ASSERT_NEAR(localTwistAngle,-9.52576, 1E-3);
     }
 }
+
+/**
+* The attached rotor blades must share the geometry of the unattached blade
+*/
+TEST_F(RotorSimple, attachedBladesShareGeometry)
+{
+    tigl::CCPACSConfiguration& config = tigl::CCPACSConfigurationManager::GetInstance().GetConfiguration(tiglHandle);
+    tigl::CCPACSRotor& rotor = config.GetRotor(1);
+    ASSERT_GT(rotor.GetRotorBladeCount(), 1);
+
+    for (int i = 1; i <= rotor.GetRotorBladeCount(); ++i) {
+        tigl::CTiglAttachedRotorBlade& blade = rotor.GetRotorBlade(i);
+        ASSERT_TRUE(blade.GetTransformationMatrix().IsRigid());
+
+        TopoDS_Shape unattachedShape = blade.GetUnattachedRotorBlade().GetLoft()->Shape();
+        TopoDS_Shape bladeShape = blade.GetLoft()->Shape();
+        EXPECT_TRUE(bladeShape.IsPartner(unattachedShape));
+
+        GProp_GProps props;
+        BRepGProp::VolumeProperties(bladeShape, props);
+        EXPECT_NEAR(props.Mass(), blade.GetVolume(), 1e-8);
+        EXPECT_NEAR(blade.GetUnattachedRotorBlade().GetVolume(), blade.GetVolume(), 1e-12);
+    }
+
+    // the blades are different instances
+    EXPECT_FALSE(rotor.GetRotorBlade(1).GetLoft()->Shape().IsSame(rotor.GetRotorBlade(2).GetLoft()->Shape()));
+}
@@ -0,0 +1,100 @@
+/*
+* Copyright (C) 2019 German Aerospace Center (DLR/SC)
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*/
+/**
+* @file
+* @brief Tests for the TiXI helper functions used by the generated CPACS classes
+*/
+
+#include "test.h"
+#include "generated/TixiHelper.h"
+
+#include <string>
+
+class TixiHelper : public ::testing::Test
+{
+protected:
+    void SetUp() OVERRIDE
+    {
+        handle = -1;
+        ASSERT_EQ(SUCCESS, tixiImportFromString(
+            "<point uID=\"p1\" count=\"2\">"
+            "    <x>1.5</x>"
+            "    <n>3</n>"
+            "    <name>test</name>"
+            "    <y>no number</y>"
+            "</point>", &handle));
+    }
+
+    void TearDown() OVERRIDE
+    {
+        ASSERT_EQ(SUCCESS, tixiCloseDocument(handle));
+    }
+
+    TixiDocumentHandle handle;
+};
+
+TEST_F(TixiHelper, tryGetElement)
+{
+    double x = 0.;
+    EXPECT_TRUE(tixi::TixiTryGetElement(handle, "/point/x", x));
+    EXPECT_DOUBLE_EQ(1.5, x);
+
+    int n = 0;
+    EXPECT_TRUE(tixi::TixiTryGetElement(handle, "/point/n", n));
+    EXPECT_EQ(3, n);
+
+    std::string name;
+    EXPECT_TRUE(tixi::TixiTryGetElement(handle, "/point/name", name));
+    EXPECT_EQ("test", name);
+
+    // missing elements leave the value untouched
+    double z = 2.;
+    EXPECT_FALSE(tixi::TixiTryGetElement(handle, "/point/z", z));
+    EXPECT_DOUBLE_EQ(2., z);
+}
+
+TEST_F(TixiHelper, tryGetOptionalElement)
+{
+    boost::optional<double> z;
+    EXPECT_FALSE(tixi::TixiTryGetElement(handle, "/point/z", z));
+    EXPECT_FALSE(z);
+
+    boost::optional<double> x;
+    EXPECT_TRUE(tixi::TixiTryGetElement(handle, "/point/x", x));
+    ASSERT_TRUE(x);
+    EXPECT_DOUBLE_EQ(1.5, *x);
+}
+
+TEST_F(TixiHelper, tryGetAttribute)
+{
+    std::string uid;
+    EXPECT_TRUE(tixi::TixiTryGetAttribute(handle, "/point", "uID", uid));
+    EXPECT_EQ("p1", uid);
+    EXPECT_FALSE(tixi::TixiTryGetAttribute(handle, "/point", "symmetry", uid));
+    EXPECT_EQ("p1", uid);
+
+    boost::optional<std::string> count;
+    EXPECT_TRUE(tixi::TixiTryGetAttribute(handle, "/point", "count", count));
+    ASSERT_TRUE(count);
+    EXPECT_EQ("2", *count);
+}
+
+TEST_F(TixiHelper, tryGetReportsErrors)
+{
+    // errors other than a missing element are reported as by TixiGetElement
+    double y = 0.;
+    EXPECT_ANY_THROW(tixi::TixiTryGetElement(handle, "/point/y", y));
+}
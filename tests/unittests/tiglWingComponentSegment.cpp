@@ -448,6 +448,113 @@ TEST_F(WingComponentSegmentSimple, tiglWingComponentSegmentGetPoint_success)
     ASSERT_NEAR(0.0, z, accuracy);
 }
 
+TEST_F(WingComponentSegmentSimple, tiglWingComponentSegmentGetPoints_success)
+{
+    double accuracy = 1e-7;
+    double etas[] = {1./ (1. + sqrt(17./16.)), (1. + 0.5*sqrt(17./16.))/(1. + sqrt(17./16.)), 1.0};
+    double xsis[] = {0.0, 0.0, 0.0};
+    double x[3], y[3], z[3];
+    ASSERT_EQ(TIGL_SUCCESS, tiglWingComponentSegmentGetPoints(tiglHandle, "WING_CS1", 3, etas, xsis, x, y, z));
+    ASSERT_NEAR(0.0, x[0], accuracy);
+    ASSERT_NEAR(1.0, y[0], accuracy);
+    ASSERT_NEAR(0.0, z[0], accuracy);
+    ASSERT_NEAR(0.25, x[1], accuracy);
+    ASSERT_NEAR(1.5, y[1], accuracy);
+    ASSERT_NEAR(0.0, z[1], accuracy);
+    ASSERT_NEAR(0.5, x[2], accuracy);
+    ASSERT_NEAR(2.0, y[2], accuracy);
+    ASSERT_NEAR(0.0, z[2], accuracy);
+
+    ASSERT_EQ(TIGL_UID_ERROR, tiglWingComponentSegmentGetPoints(tiglHandle, "invalid", 3, etas, xsis, x, y, z));
+    ASSERT_EQ(TIGL_NULL_POINTER, tiglWingComponentSegmentGetPoints(tiglHandle, NULL, 3, etas, xsis, x, y, z));
+}
+
+TEST_F(WingComponentSegmentSimple, tiglWingComponentSegmentPointsGetSegmentEtaXsi)
+{
+    const tigl::CCPACSConfigurationManager & manager = tigl::CCPACSConfigurationManager::GetInstance();
+    const tigl::CCPACSConfiguration & config = manager.GetConfiguration(tiglHandle);
+    const tigl::CCPACSWing& wing = config.GetWing(1);
+
+    // points on the upper and lower skin of both segments
+    std::vector<double> px, py, pz;
+    std::vector<int> expectedSegments;
+    for (int iseg = 1; iseg <= 2; ++iseg) {
+        for (double eta = 0.1; eta < 1.; eta += 0.2) {
+            for (double xsi = 0.1; xsi < 1.; xsi += 0.2) {
+                double x, y, z;
+                ASSERT_EQ(TIGL_SUCCESS, tiglWingGetUpperPoint(tiglHandle, 1, iseg, eta, xsi, &x, &y, &z));
+                px.push_back(x); py.push_back(y); pz.push_back(z);
+                expectedSegments.push_back(iseg);
+
+                ASSERT_EQ(TIGL_SUCCESS, tiglWingGetLowerPoint(tiglHandle, 1, iseg, eta, xsi, &x, &y, &z));
+                px.push_back(x); py.push_back(y); pz.push_back(z);
+                expectedSegments.push_back(iseg);
+            }
+        }
+    }
+
+    // a point far away from the wing
+    px.push_back(100.); py.push_back(100.); pz.push_back(100.);
+    expectedSegments.push_back(0);
+
+    const int nPoints = static_cast<int>(px.size());
+    std::vector<int> segmentIndices(nPoints, -1);
+    std::vector<double> etas(nPoints), xsis(nPoints);
+    ASSERT_EQ(TIGL_SUCCESS, tiglWingComponentSegmentPointsGetSegmentEtaXsi(tiglHandle, "WING_CS1", nPoints, &px[0], &py[0], &pz[0],
+                                                                            &segmentIndices[0], &etas[0], &xsis[0]));
+
+    for (int i = 0; i < nPoints; ++i) {
+        EXPECT_EQ(expectedSegments[i], segmentIndices[i]);
+        if (segmentIndices[i] == 0) {
+            continue;
+        }
+
+        // compare with the single point functions
+        char *wingUID = NULL, *segmentUID = NULL;
+        ASSERT_EQ(TIGL_SUCCESS, tiglWingComponentSegmentFindSegment(tiglHandle, "WING_CS1", px[i], py[i], pz[i], &segmentUID, &wingUID));
+        const tigl::CCPACSWingSegment& segment = wing.GetSegment(segmentIndices[i]);
+        EXPECT_STREQ(segmentUID, segment.GetUID().c_str());
+
+        double eta, xsi;
+        segment.GetEtaXsi(gp_Pnt(px[i], py[i], pz[i]), eta, xsi);
+        EXPECT_NEAR(eta, etas[i], 1e-10);
+        EXPECT_NEAR(xsi, xsis[i], 1e-10);
+    }
+
+    ASSERT_EQ(TIGL_UID_ERROR, tiglWingComponentSegmentPointsGetSegmentEtaXsi(tiglHandle, "invalid", nPoints, &px[0], &py[0], &pz[0],
+                                                                              &segmentIndices[0], &etas[0], &xsis[0]));
+    ASSERT_EQ(TIGL_NULL_POINTER, tiglWingComponentSegmentPointsGetSegmentEtaXsi(tiglHandle, "WING_CS1", nPoints, &px[0], &py[0], &pz[0],
+                                                                                 NULL, &etas[0], &xsis[0]));
+    ASSERT_EQ(TIGL_ERROR, tiglWingComponentSegmentPointsGetSegmentEtaXsi(tiglHandle, "WING_CS1", -1, &px[0], &py[0], &pz[0],
+                                                                          &segmentIndices[0], &etas[0], &xsis[0]));
+}
+
+TEST_F(WingComponentSegmentSimple, findSegmentsWithoutLofts)
+{
+    const tigl::CCPACSConfigurationManager & manager = tigl::CCPACSConfigurationManager::GetInstance();
+    const tigl::CCPACSConfiguration & config = manager.GetConfiguration(tiglHandle);
+    const tigl::CCPACSWing& wing = config.GetWing(1);
+
+    std::vector<double> px, py, pz;
+    for (int iseg = 1; iseg <= 2; ++iseg) {
+        gp_Pnt p = wing.GetSegment(iseg).GetChordPoint(0.5, 0.5);
+        px.push_back(p.X()); py.push_back(p.Y()); pz.push_back(p.Z());
+    }
+
+    const int nPoints = static_cast<int>(px.size());
+    std::vector<int> segmentIndices(nPoints, -1);
+    std::vector<double> etas(nPoints), xsis(nPoints);
+    ASSERT_EQ(TIGL_SUCCESS, tiglWingComponentSegmentPointsGetSegmentEtaXsi(tiglHandle, "WING_CS1", nPoints, &px[0], &py[0], &pz[0],
+                                                                            &segmentIndices[0], &etas[0], &xsis[0]));
+    EXPECT_EQ(1, segmentIndices[0]);
+    EXPECT_EQ(2, segmentIndices[1]);
+
+    // the segment index is built from the chord surfaces
+    EXPECT_EQ(0u, wing.GetSegment(1).GetLoftBuildCount());
+    EXPECT_EQ(0u, wing.GetSegment(2).GetLoftBuildCount());
+    EXPECT_EQ(0u, wing.GetLoftBuildCount());
+}
+
 TEST_F(WingComponentSegmentSimple, GetSegmentEtaXsi)
 {
     int compseg = 1;
@@ -21,6 +21,25 @@
 
 #include "test.h" // Brings in the GTest framework
 #include "tigl.h"
+#include "CCPACSConfigurationManager.h"
+#include "CCPACSConfiguration.h"
+#include "CCPACSWing.h"
+#include "CCPACSWingSegment.h"
+#include "CNamedShape.h"
+
+#include <BRepBuilderAPI_MakeVertex.hxx>
+#include <BRepExtrema_DistShapeShape.hxx>
+
+#include <vector>
+
+namespace
+{
+    double DistanceToShape(const gp_Pnt& p, const TopoDS_Shape& shape)
+    {
+        BRepExtrema_DistShapeShape extrema(BRepBuilderAPI_MakeVertex(p).Vertex(), shape);
+        return extrema.Value();
+    }
+}
 
 /******************************************************************************/
 
@@ -240,6 +259,57 @@ TEST_F(WingGetPoint, tiglWingGetLowerPoint_success)
     ASSERT_TRUE(tiglWingGetLowerPoint(tiglHandle, 1, 1, 1.0, 1.0, &x, &y, &z) == TIGL_SUCCESS);
 }
 
+/**
+* Tests that the batched point functions match the single point functions.
+*/
+TEST_F(WingGetPoint, tiglWingGetPoints_success)
+{
+    const int npoints = 2000;
+    std::vector<double> etas(npoints), xsis(npoints);
+    for (int i = 0; i < npoints; ++i) {
+        etas[i] = static_cast<double>(i % 50) / 49.;
+        xsis[i] = static_cast<double>(i / 50) / 39.;
+    }
+
+    std::vector<double> xs(npoints), ys(npoints), zs(npoints);
+    ASSERT_EQ(TIGL_SUCCESS, tiglWingGetUpperPoints(tiglHandle, 1, 2, npoints, &etas[0], &xsis[0], &xs[0], &ys[0], &zs[0]));
+    for (int i = 0; i < npoints; i += 37) {
+        double x, y, z;
+        ASSERT_EQ(TIGL_SUCCESS, tiglWingGetUpperPoint(tiglHandle, 1, 2, etas[i], xsis[i], &x, &y, &z));
+        EXPECT_NEAR(x, xs[i], 1e-10);
+        EXPECT_NEAR(y, ys[i], 1e-10);
+        EXPECT_NEAR(z, zs[i], 1e-10);
+    }
+
+    ASSERT_EQ(TIGL_SUCCESS, tiglWingGetLowerPoints(tiglHandle, 1, 2, npoints, &etas[0], &xsis[0], &xs[0], &ys[0], &zs[0]));
+    for (int i = 0; i < npoints; i += 37) {
+        double x, y, z;
+        ASSERT_EQ(TIGL_SUCCESS, tiglWingGetLowerPoint(tiglHandle, 1, 2, etas[i], xsis[i], &x, &y, &z));
+        EXPECT_NEAR(x, xs[i], 1e-10);
+        EXPECT_NEAR(y, ys[i], 1e-10);
+        EXPECT_NEAR(z, zs[i], 1e-10);
+    }
+}
+
+/**
+* Tests the batched point functions with invalid arguments.
+*/
+TEST_F(WingGetPoint, tiglWingGetPoints_invalidArgs)
+{
+    double etas[] = {0.0, 0.5, 1.5};
+    double xsis[] = {0.0, 0.5, 0.5};
+    double xs[3], ys[3], zs[3];
+
+    ASSERT_EQ(TIGL_NOT_FOUND, tiglWingGetUpperPoints(-1, 1, 1, 2, etas, xsis, xs, ys, zs));
+    ASSERT_EQ(TIGL_INDEX_ERROR, tiglWingGetUpperPoints(tiglHandle, 0, 1, 2, etas, xsis, xs, ys, zs));
+    ASSERT_EQ(TIGL_INDEX_ERROR, tiglWingGetLowerPoints(tiglHandle, 1, 0, 2, etas, xsis, xs, ys, zs));
+    ASSERT_EQ(TIGL_NULL_POINTER, tiglWingGetUpperPoints(tiglHandle, 1, 1, 2, NULL, xsis, xs, ys, zs));
+    ASSERT_EQ(TIGL_NULL_POINTER, tiglWingGetLowerPoints(tiglHandle, 1, 1, 2, etas, xsis, xs, ys, NULL));
+    ASSERT_EQ(TIGL_ERROR, tiglWingGetUpperPoints(tiglHandle, 1, 1, -1, etas, xsis, xs, ys, zs));
+    // third eta is out of range
+    ASSERT_EQ(TIGL_ERROR, tiglWingGetUpperPoints(tiglHandle, 1, 1, 3, etas, xsis, xs, ys, zs));
+}
+
 TEST_F(WingGetPointSimple, checkCamberLine)
 {
     //inner wing profile
@@ -316,6 +386,43 @@ TEST_F(WingGetPointSimple, getPointDirection)
     ASSERT_EQ(TIGL_INDEX_ERROR, tiglWingGetUpperPointAtDirection(tiglHandle, 1, 0, 0.5, 0.5, 0., 0., 1., &px, &py, &pz, &distance));
 }
 
+// The upper and lower shells are faces of the smooth wing loft. Hence, the points
+// in the interior of the segments must lie on the loft, not on a ruled surface
+// between the sections.
+TEST_F(WingGetPoint, getPointDirectionOnLoft)
+{
+    tigl::CCPACSWing& wing = tigl::CCPACSConfigurationManager::GetInstance().GetConfiguration(tiglHandle).GetWing(1);
+    const TopoDS_Shape loft = wing.GetLoft()->Shape();
+
+    const double etas[] = {0.1, 0.5, 0.9};
+    const double xsis[] = {0.2, 0.5, 0.8};
+    for (int iseg = 1; iseg <= wing.GetSegmentCount(); ++iseg) {
+        const tigl::CCPACSWingSegment& segment = wing.GetSegment(iseg);
+        for (int ieta = 0; ieta < 3; ++ieta) {
+            for (int ixsi = 0; ixsi < 3; ++ixsi) {
+                const double eta = etas[ieta];
+                const double xsi = xsis[ixsi];
+                const gp_Pnt chordPoint = segment.GetChordPoint(eta, xsi);
+
+                double deviation = 1.;
+                gp_Pnt upper = segment.GetPointDirection(eta, xsi, 0., 0., 1., true, deviation);
+                EXPECT_LT(deviation, 1e-8);
+                gp_Pnt lower = segment.GetPointDirection(eta, xsi, 0., 0., 1., false, deviation);
+                EXPECT_LT(deviation, 1e-8);
+
+                EXPECT_NEAR(chordPoint.X(), upper.X(), 1e-6);
+                EXPECT_NEAR(chordPoint.Y(), upper.Y(), 1e-6);
+                EXPECT_NEAR(chordPoint.X(), lower.X(), 1e-6);
+                EXPECT_NEAR(chordPoint.Y(), lower.Y(), 1e-6);
+                EXPECT_GT(upper.Z(), lower.Z());
+
+                EXPECT_NEAR(0., DistanceToShape(upper, loft), 1e-6) << "segment " << iseg << ", eta " << eta << ", xsi " << xsi;
+                EXPECT_NEAR(0., DistanceToShape(lower, loft), 1e-6) << "segment " << iseg << ", eta " << eta << ", xsi " << xsi;
+            }
+        }
+    }
+}
+
 TEST_F(WingGetPointSimple, getPointDirection_smallmiss)
 {
     double px, py, pz, distance;
@@ -58,3 +58,60 @@ TEST(WingProfileBugs, Bug2)
     ASSERT_LE(p.Z(), 1.0);
     ASSERT_NEAR(0.0, p.Y(), 1e-7);
 }
+
+// GetPoint evaluates the profile using a lookup table. It must give the same points
+// as the intersection of the profile with a line normal to the chord.
+TEST(WingProfile, getPointLookupMatchesIntersection)
+{
+    TixiDocumentHandle tixiHandle;
+    ASSERT_EQ(SUCCESS, tixiOpenDocument("TestData/WingProfileBug1.xml", &tixiHandle));
+
+    TiglCPACSConfigurationHandle tiglHandle;
+    ASSERT_EQ(TIGL_SUCCESS, tiglOpenCPACSConfiguration(tixiHandle, "", &tiglHandle));
+
+    tigl::CCPACSConfigurationManager & manager = tigl::CCPACSConfigurationManager::GetInstance();
+    tigl::CCPACSConfiguration & config = manager.GetConfiguration(tiglHandle);
+    tigl::CCPACSWingProfile& profile = config.GetWingProfile("NACA653218");
+
+    for (int i = 1; i < 100; ++i) {
+        double xsi = static_cast<double>(i) / 100.;
+
+        gp_Pnt upperLookup, lowerLookup;
+        ASSERT_TRUE(profile.GetPointFromLookup(xsi, true, upperLookup));
+        ASSERT_TRUE(profile.GetPointFromLookup(xsi, false, lowerLookup));
+
+        EXPECT_NEAR(0., upperLookup.Distance(profile.GetPointFromIntersection(xsi, true)), 1e-6) << "xsi = " << xsi;
+        EXPECT_NEAR(0., lowerLookup.Distance(profile.GetPointFromIntersection(xsi, false)), 1e-6) << "xsi = " << xsi;
+        EXPECT_NEAR(0., upperLookup.Distance(profile.GetUpperPoint(xsi)), 1e-10);
+        EXPECT_NEAR(0., lowerLookup.Distance(profile.GetLowerPoint(xsi)), 1e-10);
+    }
+
+    ASSERT_EQ(TIGL_SUCCESS, tiglCloseCPACSConfiguration(tiglHandle));
+    ASSERT_EQ(SUCCESS, tixiCloseDocument(tixiHandle));
+}
+
+// If the profile curve is not monotone in xsi, GetPoint falls back to the intersection
+TEST(WingProfile, getPointNonMonotoneProfile)
+{
+    TixiDocumentHandle tixiHandle;
+    ASSERT_EQ(SUCCESS, tixiOpenDocument("TestData/WingProfileBug1.xml", &tixiHandle));
+
+    TiglCPACSConfigurationHandle tiglHandle;
+    ASSERT_EQ(TIGL_SUCCESS, tiglOpenCPACSConfiguration(tixiHandle, "", &tiglHandle));
+
+    tigl::CCPACSConfigurationManager & manager = tigl::CCPACSConfigurationManager::GetInstance();
+    tigl::CCPACSConfiguration & config = manager.GetConfiguration(tiglHandle);
+    tigl::CCPACSWingProfile& profile = config.GetWingProfile("HookedProfile");
+
+    gp_Pnt p;
+    EXPECT_FALSE(profile.GetPointFromLookup(0.5, true, p));
+
+    for (int i = 2; i < 10; ++i) {
+        double xsi = static_cast<double>(i) / 10.;
+        EXPECT_NEAR(0., profile.GetUpperPoint(xsi).Distance(profile.GetPointFromIntersection(xsi, true)), 1e-10) << "xsi = " << xsi;
+        EXPECT_NEAR(0., profile.GetLowerPoint(xsi).Distance(profile.GetPointFromIntersection(xsi, false)), 1e-10) << "xsi = " << xsi;
+    }
+
+    ASSERT_EQ(TIGL_SUCCESS, tiglCloseCPACSConfiguration(tiglHandle));
+    ASSERT_EQ(SUCCESS, tixiCloseDocument(tixiHandle));
+}
@@ -24,6 +24,19 @@
 #include "CCPACSWingRibsDefinition.h"
 #include "CCPACSWingRibsPositioning.h"
 #include "CCPACSWingSegment.h"
+#include "CCPACSWingSparSegment.h"
+#include "CTiglWingStructureReference.h"
+#include "tiglcommonfunctions.h"
+
+#include <BRep_Tool.hxx>
+#include <BRepBndLib.hxx>
+#include <BRepGProp.hxx>
+#include <Bnd_Box.hxx>
+#include <GProp_GProps.hxx>
+#include <TopExp_Explorer.hxx>
+#include <TopoDS.hxx>
+
+#include <cmath>
 
 using namespace tigl;
 
@@ -199,3 +212,88 @@ TEST_F(WingCellRibSpar2, computeSparIntersectionEtaXsi) {
         ribIndex++;
     }
 }
+
+namespace
+{
+    double edgeLength(const TopoDS_Shape& edges)
+    {
+        GProp_GProps props;
+        BRepGProp::LinearProperties(edges, props);
+        return props.Mass();
+    }
+
+    // returns true, if each edge has a pcurve on one of the faces of the shape
+    bool hasPCurvesOn(const TopoDS_Shape& edges, const TopoDS_Shape& shape)
+    {
+        for (TopExp_Explorer edgeExp(edges, TopAbs_EDGE); edgeExp.More(); edgeExp.Next()) {
+            bool found = false;
+            for (TopExp_Explorer faceExp(shape, TopAbs_FACE); faceExp.More() && !found; faceExp.Next()) {
+                Standard_Real first, last;
+                found = !BRep_Tool::CurveOnSurface(TopoDS::Edge(edgeExp.Current()), TopoDS::Face(faceExp.Current()), first, last).IsNull();
+            }
+            if (!found) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    // compares the section edges of a face by length and extent, as the
+    // edges may be split differently
+    void expectSameSection(const TopoDS_Shape& expected, const TopoDS_Shape& actual)
+    {
+        const double length = edgeLength(expected);
+        ASSERT_GT(length, 0.);
+        EXPECT_NEAR(length, edgeLength(actual), 1e-6 * length);
+
+        Bnd_Box expectedBox, actualBox;
+        BRepBndLib::Add(expected, expectedBox);
+        BRepBndLib::Add(actual, actualBox);
+        Standard_Real xmin1, ymin1, zmin1, xmax1, ymax1, zmax1;
+        Standard_Real xmin2, ymin2, zmin2, xmax2, ymax2, zmax2;
+        expectedBox.Get(xmin1, ymin1, zmin1, xmax1, ymax1, zmax1);
+        actualBox.Get(xmin2, ymin2, zmin2, xmax2, ymax2, zmax2);
+        const double tol = 1e-6 * sqrt(expectedBox.SquareExtent());
+        EXPECT_NEAR(xmin1, xmin2, tol);
+        EXPECT_NEAR(ymin1, ymin2, tol);
+        EXPECT_NEAR(zmin1, zmin2, tol);
+        EXPECT_NEAR(xmax1, xmax2, tol);
+        EXPECT_NEAR(ymax1, ymax2, tol);
+        EXPECT_NEAR(zmax1, zmax2, tol);
+    }
+}
+
+TEST_F(WingCellRibSpar2, cutShapesPerFace)
+{
+    tigl::CCPACSConfiguration & config = tigl::CCPACSConfigurationManager::GetInstance().GetConfiguration(tiglHandle);
+    tigl::CCPACSWingComponentSegment& componentSegment = static_cast<tigl::CCPACSWingComponentSegment&>(config.GetWing(1).GetComponentSegment(1));
+    const tigl::CCPACSWingCSStructure& structure = *componentSegment.GetStructure();
+    const TopoDS_Shape loft = CTiglWingStructureReference(structure).GetLoft(WING_COORDINATE_SYSTEM)->Shape();
+
+    // rib cut faces, the pcurves are computed on the faces
+    const tigl::CCPACSWingRibsDefinition& ribsDefinition = structure.GetRibsDefinition(1);
+    std::vector<TopoDS_Shape> ribFaces;
+    for (int i = 1; i <= ribsDefinition.GetNumberOfRibs(); ++i) {
+        ribFaces.push_back(ribsDefinition.GetRibCutGeometry(i).shape);
+    }
+    ASSERT_GT(ribFaces.size(), 1u);
+
+    const std::vector<TopoDS_Shape> ribEdges = CutShapesPerFace(ribFaces, loft);
+    ASSERT_EQ(ribFaces.size(), ribEdges.size());
+    for (size_t i = 0; i < ribFaces.size(); ++i) {
+        expectSameSection(CutShapes(ribFaces[i], loft), ribEdges[i]);
+        EXPECT_TRUE(hasPCurvesOn(ribEdges[i], ribFaces[i]));
+    }
+
+    // spar cut faces, the pcurves are computed on the loft
+    const tigl::CCPACSWingSparSegment& spar = structure.GetSparSegment(1);
+    const std::vector<TopoDS_Shape> sparFaces = GetSubShapes(spar.GetSparCutGeometry(WING_COORDINATE_SYSTEM), TopAbs_FACE);
+    ASSERT_GT(sparFaces.size(), 1u);
+
+    const std::vector<TopoDS_Shape> sparEdges = CutShapesPerFace(loft, sparFaces);
+    ASSERT_EQ(sparFaces.size(), sparEdges.size());
+    for (size_t i = 0; i < sparFaces.size(); ++i) {
+        expectSameSection(CutShapes(loft, sparFaces[i]), sparEdges[i]);
+        EXPECT_TRUE(hasPCurvesOn(sparEdges[i], loft));
+    }
+}
@@ -28,6 +28,11 @@
 #include "CCPACSWingSegments.h"
 #include "tiglcommonfunctions.h"
 
+#include <BRep_Tool.hxx>
+#include <TopExp.hxx>
+#include <TopoDS.hxx>
+#include <TopTools_IndexedMapOfShape.hxx>
+
 /***************************************************************************************************/
 
 class WingSegment : public ::testing::Test 
@@ -752,6 +757,25 @@ TEST_F(WingSegmentSimple, getPointDirection)
     ASSERT_GT(deviation, 1e-3);
 }
 
+TEST_F(WingSegmentSimple, shapesShareWingLoftSurfaces)
+{
+    tigl::CCPACSConfigurationManager & manager = tigl::CCPACSConfigurationManager::GetInstance();
+    tigl::CCPACSConfiguration & config = manager.GetConfiguration(tiglSimpleHandle);
+    tigl::CCPACSWing& wing = config.GetWing(1);
+
+    TopTools_IndexedMapOfShape wingUpperFaces, wingLowerFaces;
+    TopExp::MapShapes(wing.GetUpperShape(), TopAbs_FACE, wingUpperFaces);
+    TopExp::MapShapes(wing.GetLowerShape(), TopAbs_FACE, wingLowerFaces);
+    ASSERT_EQ(wing.GetSegmentCount(), wingUpperFaces.Extent());
+    ASSERT_EQ(wing.GetSegmentCount(), wingLowerFaces.Extent());
+
+    for (int i = 1; i <= wing.GetSegmentCount(); ++i) {
+        tigl::CCPACSWingSegment& segment = (tigl::CCPACSWingSegment&) wing.GetSegment(i);
+        EXPECT_TRUE(BRep_Tool::Surface(TopoDS::Face(wingUpperFaces(i))) == segment.GetUpperSurface());
+        EXPECT_TRUE(BRep_Tool::Surface(TopoDS::Face(wingLowerFaces(i))) == segment.GetLowerSurface());
+    }
+}
+
 TEST_F(WingSegmentSimple, getIsOnTop_success)
 {
     // now we have do use the internal interface as we currently have no public api for this